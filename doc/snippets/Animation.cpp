@@ -33,6 +33,7 @@
 #include "Magnum/Math/Packing.h"
 #include "Magnum/Animation/Easing.h"
 #include "Magnum/Animation/Player.h"
+#include "Magnum/Animation/UniformTrack.h"
 
 #define DOXYGEN_ELLIPSIS(...) __VA_ARGS__
 
@@ -354,4 +355,42 @@ static_cast<void>(position);
 static_cast<void>(rotation);
 }
 
+{
+/* [Track-performance-batch] */
+/* Keyframes sampled at 30 FPS, values for all bones in each keyframe */
+Containers::StridedArrayView1D<const Float> keys = DOXYGEN_ELLIPSIS({});
+Containers::StridedArrayView2D<const Quaternion> rotations = DOXYGEN_ELLIPSIS({});
+Containers::StridedArrayView1D<Quaternion> boneRotations = DOXYGEN_ELLIPSIS({});
+
+Float time = 2.2f;
+std::size_t hint = 0;
+Animation::interpolateStrictInto<Float, Quaternion>(keys, rotations,
+    Animation::Interpolation::Linear, time, hint, boneRotations);
+/* [Track-performance-batch] */
+}
+
+{
+/* [Track-performance-uniform] */
+Animation::UniformTrackView<Float, const Vector2> jump{
+    0.0f, 1.0f/30.0f, DOXYGEN_ELLIPSIS({}), Math::lerp};
+
+Vector2 position = jump.at(2.2f);
+/* [Track-performance-uniform] */
+static_cast<void>(position);
+}
+
+{
+Animation::TrackView<const Float, const Vector3> translation;
+/* [UniformTrackView-resample] */
+/* Resample to 30 FPS */
+Containers::Array<Vector3> values = Animation::resample(translation, 1.0f/30.0f);
+Animation::UniformTrackView<Float, const Vector3> uniform{
+    translation.duration().min(), 1.0f/30.0f,
+    Containers::stridedArrayView(values), Math::lerp};
+
+Vector3 position = uniform.at(2.2f);
+/* [UniformTrackView-resample] */
+static_cast<void>(position);
+}
+
 }
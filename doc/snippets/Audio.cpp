@@ -29,10 +29,16 @@
 #define CORRADE_STATIC_PLUGIN
 
 #include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Pointer.h>
+#include <Corrade/PluginManager/Manager.h>
 
 #include "Magnum/Audio/AbstractImporter.h"
 #include "Magnum/Audio/Context.h"
 #include "Magnum/Audio/Extensions.h"
+#include "Magnum/Audio/Source.h"
+#include "Magnum/Audio/Streamer.h"
+
+#define DOXYGEN_ELLIPSIS(...) __VA_ARGS__
 
 using namespace Magnum;
 
@@ -61,6 +67,40 @@ CORRADE_PLUGIN_REGISTER(MyAudioImporter, MyNamespace::MyAudioImporter,
    avoid -Wmisssing-prototypes */
 void mainAudio();
 void mainAudio() {
+{
+PluginManager::Manager<Audio::AbstractImporter> manager;
+Containers::Pointer<Audio::AbstractImporter> importer = manager.loadAndInstantiate("AnyAudioImporter");
+/* [AbstractImporter-dataInto] */
+importer->openFile("music.wav");
+
+Containers::Array<char> chunk{NoInit, 16384};
+for(std::size_t offset = 0, size = importer->dataSize(); offset != size; ) {
+    std::size_t written = importer->dataInto(offset, chunk);
+    DOXYGEN_ELLIPSIS(static_cast<void>(written);) // process chunk.prefix(written)
+    offset += written;
+}
+/* [AbstractImporter-dataInto] */
+}
+
+{
+PluginManager::Manager<Audio::AbstractImporter> manager;
+Containers::Pointer<Audio::AbstractImporter> importer = manager.loadAndInstantiate("AnyAudioImporter");
+/* [Streamer] */
+importer->openFile("music.wav");
+
+Audio::Source source;
+Audio::Streamer streamer{source, *importer};
+streamer
+    .setLooping(true)
+    .play();
+
+DOXYGEN_ELLIPSIS()
+
+/* Every frame */
+streamer.update();
+/* [Streamer] */
+}
+
 {
 /* [Context-isExtensionSupported] */
 if(Audio::Context::current().isExtensionSupported<Audio::Extensions::ALC::SOFTX::HRTF>()) {
@@ -102,6 +102,14 @@ CORRADE_COMPARE_WITH(actual.pixels<Color3ub>().flipped<0>(), expected,
     (DebugTools::CompareImage{1.5f, 0.01f}));
 /* [CompareImage-pixels-flip] */
 }
+
+{
+Image2D actual = doProcessing();
+/* [CompareImage-threads] */
+CORRADE_COMPARE_WITH(actual, "expected.png",
+    (DebugTools::CompareImageToFile{1.5f, 0.01f}.setThreadCount(0)));
+/* [CompareImage-threads] */
+}
 }
 };
 
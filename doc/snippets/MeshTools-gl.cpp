@@ -33,10 +33,12 @@
 #include "Magnum/GL/Mesh.h"
 #include "Magnum/GL/MeshView.h"
 #include "Magnum/Math/Color.h"
+#include "Magnum/Math/Functions.h"
 #include "Magnum/MeshTools/Compile.h"
 #include "Magnum/MeshTools/CompressIndices.h"
 #include "Magnum/MeshTools/Concatenate.h"
 #include "Magnum/MeshTools/Interleave.h"
+#include "Magnum/MeshTools/Simplify.h"
 #include "Magnum/Trade/MeshData.h"
 
 #ifdef MAGNUM_BUILD_DEPRECATED
@@ -185,4 +187,21 @@ mesh.setCount(positions.size())
 /* [interleave1] */
 }
 
+{
+Float distance{};
+/* [generateLodChain] */
+Trade::MeshData data = DOXYGEN_ELLIPSIS(Trade::MeshData{MeshPrimitive::Triangles, 0});
+
+Containers::Pair<Trade::MeshData, Containers::Array<MeshTools::MeshLod>> lods =
+    MeshTools::generateLodChain(data, Containers::arrayView({0.5f, 0.25f, 0.125f}));
+GL::Mesh mesh = MeshTools::compile(lods.first());
+
+/* Pick a level based on the distance, draw just that range */
+const MeshTools::MeshLod& lod = lods.second()[
+    Math::min(std::size_t(distance/10.0f), lods.second().size() - 1)];
+mesh.setIndexOffset(lod.indexOffset)
+    .setCount(lod.indexCount);
+/* [generateLodChain] */
+}
+
 }
@@ -298,6 +298,20 @@ Containers::Array<Vector3> normals =
 /* [generateFlatNormals] */
 }
 
+{
+/* [SmoothNormalsAdjacency] */
+Containers::ArrayView<const UnsignedInt> indices;
+Containers::Array<Vector3> positions;
+Containers::Array<Vector3> normals{NoInit, positions.size()};
+
+/* Calculate the adjacency once */
+MeshTools::SmoothNormalsAdjacency adjacency{indices, positions.size()};
+
+/* Then, every time the positions change, regenerate just the normals */
+MeshTools::generateSmoothNormalsInto(adjacency, positions, normals);
+/* [SmoothNormalsAdjacency] */
+}
+
 {
 /* [interleave2] */
 Containers::ArrayView<const Vector4> positions;
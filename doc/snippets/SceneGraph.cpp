@@ -36,6 +36,7 @@
 #include "Magnum/SceneGraph/MatrixTransformation3D.h"
 #include "Magnum/SceneGraph/Camera.h"
 #include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/FlatScene.h"
 #include "Magnum/SceneGraph/Object.h"
 #include "Magnum/SceneGraph/Scene.h"
 
@@ -390,4 +391,54 @@ camera.draw(drawableTransformations);
 /* [Drawable-culling] */
 }
 
+{
+Object3D object, cameraObject;
+SceneGraph::Camera3D camera{cameraObject};
+SceneGraph::DrawableGroup3D drawableGroup;
+struct: SceneGraph::Drawable3D {
+    using SceneGraph::Drawable3D::Drawable3D;
+
+    void draw(const Matrix4&, SceneGraph::Camera3D&) override {}
+} drawable{object, &drawableGroup};
+/* [Drawable-culling-builtin] */
+/* A unit sphere around the object origin */
+drawable.setBoundingSphere({}, 1.0f);
+
+DOXYGEN_ELLIPSIS()
+
+/* Draw visible drawables front-to-back, i.e. the ones closest to the camera
+   (having the largest Z coordinate in camera space) first */
+camera.drawVisible(drawableGroup,
+    [](SceneGraph::Drawable3D&, const Matrix4& transformation) {
+        return -transformation.translation().z();
+    });
+/* [Drawable-culling-builtin] */
+}
+
+{
+struct MyDrawable: SceneGraph::Drawable3D {
+    using SceneGraph::Drawable3D::Drawable3D;
+
+    void draw(const Matrix4&, SceneGraph::Camera3D&) override {}
+};
+/* [FlatScene-usage] */
+SceneGraph::FlatScene3D scene;
+SceneGraph::DrawableGroup3D drawables;
+
+/* Reserve memory upfront and add objects depth-first to avoid reordering */
+scene.reserve(3);
+SceneGraph::FlatObject3D& car = scene.addObject();
+car.setTransformation(Matrix4::translation({5.0f, 0.0f, -3.0f}));
+SceneGraph::FlatObject3D& wheel = scene.addObject(&car);
+wheel.setTransformation(Matrix4::rotationX(35.0_degf));
+
+/* Features get attached the same way as with SceneGraph::Object */
+new MyDrawable{wheel, &drawables};
+
+SceneGraph::FlatObject3D& cameraObject = scene.addObject();
+SceneGraph::Camera3D camera{cameraObject};
+camera.draw(drawables);
+/* [FlatScene-usage] */
+}
+
 }
@@ -105,6 +105,23 @@ Trade::MeshData concatenated = MeshTools::concatenate(flattenedMeshes);
 /* [absoluteFieldTransformations3D-mesh-concatenate] */
 }
 
+{
+/* [TransformationHierarchy] */
+Trade::SceneData scene = DOXYGEN_ELLIPSIS(Trade::SceneData{{}, 0, nullptr, {}});
+
+/* Calculate the hierarchy once and the transformations for the whole scene */
+SceneTools::TransformationHierarchy3D hierarchy{scene, Trade::SceneField::Mesh};
+Containers::Array<Matrix4> transformations{NoInit, hierarchy.fieldSize()};
+hierarchy.updateInto(scene, transformations);
+
+/* Every frame, modify transformations of a few objects in the scene and then
+   recalculate just the subtrees affected by them */
+Containers::Array<UnsignedInt> changedObjects = DOXYGEN_ELLIPSIS({});
+DOXYGEN_ELLIPSIS()
+hierarchy.updateInto(scene, changedObjects, transformations);
+/* [TransformationHierarchy] */
+}
+
 {
 /* [childrenDepthFirst-extract-tree] */
 Trade::SceneData scene = DOXYGEN_ELLIPSIS(Trade::SceneData{{}, 0, nullptr, {}});
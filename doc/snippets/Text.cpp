@@ -282,6 +282,70 @@ cache.flushImage(*range);
 /* [AbstractGlyphCache-filling-glyphs] */
 }
 
+{
+struct: Text::AbstractGlyphCache {
+    using Text::AbstractGlyphCache::AbstractGlyphCache;
+
+    Text::GlyphCacheFeatures doFeatures() const override { return {}; }
+} cache{PixelFormat::R8Unorm, Vector2i{256}};
+Containers::Array<Image2D> images = DOXYGEN_ELLIPSIS({});
+/* [AbstractGlyphCache-filling-bulk] */
+UnsignedInt fontId = cache.addFont(images.size());
+
+/* Glyph IDs are array indices, all glyph offsets left at zero */
+Containers::Array<UnsignedInt> fontGlyphIds{NoInit, images.size()};
+for(UnsignedInt i = 0; i != images.size(); ++i)
+    fontGlyphIds[i] = i;
+Containers::Array<Vector2i> glyphOffsets{ValueInit, images.size()};
+
+/* Pack all images and add them as glyphs in a single step */
+Containers::Array<Vector2i> offsets{NoInit, images.size()};
+Containers::Optional<Range2Di> range = cache.addGlyphs(fontId, fontGlyphIds,
+    glyphOffsets, stridedArrayView(images).slice(&Image2D::size), offsets);
+CORRADE_INTERNAL_ASSERT(range);
+
+/* Copy the data to the cache image same as above and flush it */
+Containers::StridedArrayView3D<char> dst = cache.image().pixels()[0];
+for(UnsignedInt i = 0; i != images.size(); ++i) {
+    Containers::StridedArrayView3D<const char> src = images[i].pixels();
+    Utility::copy(src, dst.sliceSize({
+        std::size_t(offsets[i].y()),
+        std::size_t(offsets[i].x()),
+        0}, src.size()));
+}
+cache.flushImage(*range);
+/* [AbstractGlyphCache-filling-bulk] */
+}
+
+{
+struct: Text::AbstractGlyphCache {
+    using Text::AbstractGlyphCache::AbstractGlyphCache;
+
+    Text::GlyphCacheFeatures doFeatures() const override { return {}; }
+} cache{PixelFormat::R8Unorm, Vector2i{256}};
+UnsignedInt fontId{};
+Containers::Array<UnsignedInt> fontGlyphIds;
+Containers::Array<Vector2i> glyphOffsets, glyphSizes, offsets;
+Text::RendererCore renderer{cache};
+/* [AbstractGlyphCache-filling-eviction] */
+/* Every frame, mark glyphs of all visible text as used */
+cache.markGlyphsUsed(renderer.glyphIds());
+
+DOXYGEN_ELLIPSIS()
+
+/* When adding new glyphs, evict unused ones until the new glyphs fit */
+Containers::Optional<Range2Di> range;
+while(!(range = cache.addGlyphs(fontId, fontGlyphIds, glyphOffsets, glyphSizes,
+                                offsets)))
+    if(!cache.evictGlyphs(64)) break;
+
+/* Copy the glyph data to offsets in the image, same as above, and upload only
+   the areas that changed */
+DOXYGEN_ELLIPSIS()
+cache.flushImage();
+/* [AbstractGlyphCache-filling-eviction] */
+}
+
 {
 struct: Text::AbstractGlyphCache {
     using Text::AbstractGlyphCache::AbstractGlyphCache;
@@ -39,6 +39,7 @@
 #include "Magnum/Math/Range.h"
 #include "Magnum/MeshTools/Transform.h"
 #include "Magnum/TextureTools/Atlas.h"
+#include "Magnum/TextureTools/DistanceFieldCpu.h"
 #include "Magnum/Trade/MaterialData.h"
 #include "Magnum/Trade/MeshData.h"
 
@@ -167,6 +168,19 @@ Matrix3 matrix = (rotations[i] ?
 static_cast<void>(matrix);
 }
 
+{
+ImageView2D glyphImage{PixelFormat::R8Unorm, {}};
+/* [distanceFieldInto] */
+/* A 1024x1024 high-resolution input rendered by the font plugin */
+ImageView2D input = DOXYGEN_ELLIPSIS(glyphImage);
+
+/* Resulting distance field that's 8x smaller, using all available cores */
+Image2D output{PixelFormat::R8Unorm, input.size()/8,
+    Containers::Array<char>{NoInit, std::size_t((input.size()/8).product())}};
+TextureTools::distanceFieldInto(input, output, 32, 0);
+/* [distanceFieldInto] */
+}
+
 {
 Matrix3 matrix;
 /* [atlasTextureCoordinateTransformation-meshdata] */
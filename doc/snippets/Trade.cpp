@@ -1219,6 +1219,20 @@ for(const Containers::Pair<UnsignedInt, Int>& meshMaterial:
 /* [SceneData-per-object] */
 }
 
+{
+Trade::SceneData data{{}, 0, nullptr, nullptr};
+/* [SceneData-per-object-index] */
+/* Makes all per-object queries below O(log n) instead of O(n) */
+data.buildFieldObjectIndices();
+
+for(UnsignedLong object = 0; object != data.mappingBound(); ++object) {
+    Containers::Optional<Long> parent = data.parentFor(object);
+    Containers::Optional<Matrix4> transformation = data.transformation3DFor(object);
+    DOXYGEN_ELLIPSIS(static_cast<void>(parent); static_cast<void>(transformation);)
+}
+/* [SceneData-per-object-index] */
+}
+
 {
 Trade::SceneData data{{}, 0, nullptr, nullptr};
 typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
@@ -26,9 +26,21 @@
 
 #include "Interpolation.h"
 
+#include <Corrade/Cpu.h>
+
 #include "Magnum/Math/CubicHermite.h"
 #include "Magnum/Math/DualQuaternion.h"
 
+#ifdef CORRADE_ENABLE_SSE2
+#include <Corrade/Utility/IntrinsicsSse2.h>
+#endif
+#ifdef CORRADE_ENABLE_AVX
+#include <Corrade/Utility/IntrinsicsAvx.h>
+#endif
+#ifdef CORRADE_ENABLE_NEON
+#include <arm_neon.h>
+#endif
+
 namespace Magnum { namespace Animation {
 
 Debug& operator<<(Debug& debug, const Interpolation value) {
@@ -120,6 +132,147 @@ template<class T> auto TypeTraits<Math::CubicHermite<T>, T>::interpolator(Interp
     CORRADE_ASSERT_UNREACHABLE("Animation::interpolatorFor(): can't deduce interpolator function for" << interpolation, {});
 }
 
+namespace {
+
+/* Kernels for a linear interpolation of a contiguous range of floats, used by
+   interpolateBatch() when all views are contiguous. Calculated the same way
+   as Math::lerp(), i.e. (1 - t)*a + t*b, to give the same results as the
+   scalar code. The variant is picked at runtime based on CPU features, the
+   scalar variant is used for the remaining values that don't fill a whole
+   vector. */
+typedef void(*LerpKernel)(const Float*, const Float*, Float, Float*, std::size_t);
+
+void lerpScalar(const Float* const a, const Float* const b, const Float t, Float* const destination, const std::size_t count) {
+    const Float u = 1.0f - t;
+    for(std::size_t i = 0; i != count; ++i)
+        destination[i] = u*a[i] + t*b[i];
+}
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_ENABLE_SSE2 void lerpSse2(const Float* const a, const Float* const b, const Float t, Float* const destination, const std::size_t count) {
+    const __m128 u4 = _mm_set1_ps(1.0f - t);
+    const __m128 t4 = _mm_set1_ps(t);
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4)
+        _mm_storeu_ps(destination + i, _mm_add_ps(
+            _mm_mul_ps(u4, _mm_loadu_ps(a + i)),
+            _mm_mul_ps(t4, _mm_loadu_ps(b + i))));
+    lerpScalar(a + i, b + i, t, destination + i, count - i);
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX
+CORRADE_ENABLE_AVX void lerpAvx(const Float* const a, const Float* const b, const Float t, Float* const destination, const std::size_t count) {
+    const __m256 u8 = _mm256_set1_ps(1.0f - t);
+    const __m256 t8 = _mm256_set1_ps(t);
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8)
+        _mm256_storeu_ps(destination + i, _mm256_add_ps(
+            _mm256_mul_ps(u8, _mm256_loadu_ps(a + i)),
+            _mm256_mul_ps(t8, _mm256_loadu_ps(b + i))));
+    lerpScalar(a + i, b + i, t, destination + i, count - i);
+}
+#endif
+
+#ifdef CORRADE_ENABLE_NEON
+CORRADE_ENABLE_NEON void lerpNeon(const Float* const a, const Float* const b, const Float t, Float* const destination, const std::size_t count) {
+    const float32x4_t u4 = vdupq_n_f32(1.0f - t);
+    const float32x4_t t4 = vdupq_n_f32(t);
+    std::size_t i = 0;
+    /* Not using vmlaq_f32() as that could give different results than the
+       scalar code */
+    for(; i + 4 <= count; i += 4)
+        vst1q_f32(destination + i, vaddq_f32(
+            vmulq_f32(u4, vld1q_f32(a + i)),
+            vmulq_f32(t4, vld1q_f32(b + i))));
+    lerpScalar(a + i, b + i, t, destination + i, count - i);
+}
+#endif
+
+LerpKernel lerpKernel() {
+    const Cpu::Features features = Cpu::runtimeFeatures();
+    #ifdef CORRADE_ENABLE_AVX
+    if(features & Cpu::Avx) return lerpAvx;
+    #endif
+    #ifdef CORRADE_ENABLE_SSE2
+    if(features & Cpu::Sse2) return lerpSse2;
+    #endif
+    #ifdef CORRADE_ENABLE_NEON
+    if(features & Cpu::Neon) return lerpNeon;
+    #endif
+    static_cast<void>(features);
+    return lerpScalar;
+}
+
+template<class T> void interpolateBatchImplementation(const Interpolation interpolation, const Containers::StridedArrayView1D<const T>& a, const Containers::StridedArrayView1D<const T>& b, const Float t, const Containers::StridedArrayView1D<T>& destination) {
+    CORRADE_INTERNAL_DEBUG_ASSERT(a.size() == destination.size() && b.size() == destination.size());
+
+    switch(interpolation) {
+        case Interpolation::Constant: {
+            /* Same as Math::select() */
+            const Containers::StridedArrayView1D<const T>& source = t >= 1.0f ? b : a;
+            for(std::size_t i = 0, max = destination.size(); i != max; ++i)
+                destination[i] = source[i];
+        } return;
+
+        case Interpolation::Linear: {
+            if(a.isContiguous() && b.isContiguous() && destination.isContiguous()) {
+                /* Picked just once */
+                static const LerpKernel kernel = lerpKernel();
+                kernel(static_cast<const Float*>(a.data()), static_cast<const Float*>(b.data()), t, static_cast<Float*>(destination.data()), destination.size()*sizeof(T)/sizeof(Float));
+            } else for(std::size_t i = 0, max = destination.size(); i != max; ++i)
+                destination[i] = Math::lerp(a[i], b[i], t);
+        } return;
+
+        case Interpolation::Spline:
+        case Interpolation::Custom: ; /* nope */
+    }
+
+    CORRADE_ASSERT_UNREACHABLE("Animation::interpolateInto(): can't batch-interpolate with" << interpolation, );
+}
+
+}
+
+void interpolateBatch(const Interpolation interpolation, const Containers::StridedArrayView1D<const Float>& a, const Containers::StridedArrayView1D<const Float>& b, const Float t, const Containers::StridedArrayView1D<Float>& destination) {
+    interpolateBatchImplementation(interpolation, a, b, t, destination);
+}
+
+void interpolateBatch(const Interpolation interpolation, const Containers::StridedArrayView1D<const Vector2>& a, const Containers::StridedArrayView1D<const Vector2>& b, const Float t, const Containers::StridedArrayView1D<Vector2>& destination) {
+    interpolateBatchImplementation(interpolation, a, b, t, destination);
+}
+
+void interpolateBatch(const Interpolation interpolation, const Containers::StridedArrayView1D<const Vector3>& a, const Containers::StridedArrayView1D<const Vector3>& b, const Float t, const Containers::StridedArrayView1D<Vector3>& destination) {
+    interpolateBatchImplementation(interpolation, a, b, t, destination);
+}
+
+void interpolateBatch(const Interpolation interpolation, const Containers::StridedArrayView1D<const Vector4>& a, const Containers::StridedArrayView1D<const Vector4>& b, const Float t, const Containers::StridedArrayView1D<Vector4>& destination) {
+    interpolateBatchImplementation(interpolation, a, b, t, destination);
+}
+
+void interpolateBatch(const Interpolation interpolation, const Containers::StridedArrayView1D<const Quaternion>& a, const Containers::StridedArrayView1D<const Quaternion>& b, const Float t, const Containers::StridedArrayView1D<Quaternion>& destination) {
+    CORRADE_INTERNAL_DEBUG_ASSERT(a.size() == destination.size() && b.size() == destination.size());
+
+    switch(interpolation) {
+        case Interpolation::Constant: {
+            const Containers::StridedArrayView1D<const Quaternion>& source = t >= 1.0f ? b : a;
+            for(std::size_t i = 0, max = destination.size(); i != max; ++i)
+                destination[i] = source[i];
+        } return;
+
+        /* There's no SIMD variant of acos() and sin() to make use of, so this
+           is a plain loop. Still avoids an indirect call for every track. */
+        case Interpolation::Linear:
+            for(std::size_t i = 0, max = destination.size(); i != max; ++i)
+                destination[i] = Math::slerpShortestPath(a[i], b[i], t);
+            return;
+
+        case Interpolation::Spline:
+        case Interpolation::Custom: ; /* nope */
+    }
+
+    CORRADE_ASSERT_UNREACHABLE("Animation::interpolateInto(): can't batch-interpolate with" << interpolation, );
+}
+
 template struct MAGNUM_EXPORT TypeTraits<Math::Complex<Float>, Math::Complex<Float>>;
 template struct MAGNUM_EXPORT TypeTraits<Math::Quaternion<Float>, Math::Quaternion<Float>>;
 template struct MAGNUM_EXPORT TypeTraits<Math::DualQuaternion<Float>, Math::DualQuaternion<Float>>;
@@ -27,7 +27,7 @@
 */
 
 /** @file
- * @brief Alias @ref Magnum::Animation::ResultOf, enum @ref Magnum::Animation::Interpolation. @ref Magnum::Animation::Extrapolation, function @ref Magnum::Animation::interpolatorFor(), @ref Magnum::Animation::interpolate(), @ref Magnum::Animation::interpolateStrict(), @ref Magnum::Animation::ease(), @ref Magnum::Animation::easeClamped() @ref Magnum::Animation::unpack(), @ref Magnum::Animation::unpackEase(), @ref Magnum::Animation::unpackEaseClamped()
+ * @brief Alias @ref Magnum::Animation::ResultOf, enum @ref Magnum::Animation::Interpolation. @ref Magnum::Animation::Extrapolation, function @ref Magnum::Animation::interpolatorFor(), @ref Magnum::Animation::interpolate(), @ref Magnum::Animation::interpolateStrict(), @ref Magnum::Animation::interpolateInto(), @ref Magnum::Animation::interpolateStrictInto(), @ref Magnum::Animation::ease(), @ref Magnum::Animation::easeClamped() @ref Magnum::Animation::unpack(), @ref Magnum::Animation::unpackEase(), @ref Magnum::Animation::unpackEaseClamped()
  */
 
 #include <Corrade/Containers/StridedArrayView.h>
@@ -224,6 +224,86 @@ Used internally from @ref Track::atStrict() / @ref TrackView::atStrict(), see
 */
 template<class K, class V, class R = ResultOf<V>> R interpolateStrict(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView1D<const V>& values, R(*interpolator)(const V&, const V&, Float), K frame, std::size_t& hint);
 
+/**
+@brief Interpolate values of multiple tracks sharing the same keys
+@tparam K           Key type
+@tparam V           Value type
+@tparam R           Result type
+@param keys         Keys shared by all tracks
+@param values       Values, with the first dimension being keyframes and the
+    second tracks
+@param before       Extrapolation mode before first keyframe
+@param after        Extrapolation mode after last keyframe
+@param interpolator Interpolator function
+@param frame        Frame at which to interpolate
+@param hint         Hint for keyframe search
+@param destination  Where to put the interpolated values
+@m_since_latest
+
+Batch variant of @ref interpolate() for many tracks that have the same
+keyframe positions, such as skeletal animations exported with a fixed
+sampling rate. The keyframe search and interpolation factor calculation is
+done just once and then @p interpolator is called on each pair of values from
+the two found rows of @p values, writing the result to a corresponding item of
+@p destination. Behavior for extrapolation, single keyframe and no keyframes
+is the same as with @ref interpolate(), in case a default-constructed value
+would be returned, the whole @p destination is filled with
+default-constructed values.
+
+Expects that the first dimension of @p values has the same size as @p keys and
+the second dimension has the same size as @p destination.
+@see @ref interpolateStrictInto(), @ref Animation-Track-performance-batch
+@experimental
+*/
+template<class K, class V, class R = ResultOf<V>> void interpolateInto(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView2D<const V>& values, Extrapolation before, Extrapolation after, R(*interpolator)(const V&, const V&, Float), K frame, std::size_t& hint, const Containers::StridedArrayView1D<R>& destination);
+
+/**
+@brief Interpolate values of multiple tracks sharing the same keys using a builtin interpolator
+@m_since_latest
+
+Same as @ref interpolateInto(const Containers::StridedArrayView1D<const K>&, const Containers::StridedArrayView2D<const V>&, Extrapolation, Extrapolation, R(*)(const V&, const V&, Float), K, std::size_t&, const Containers::StridedArrayView1D<R>&),
+but instead of calling an interpolator function for each track, uses a builtin
+implementation of @p interpolation that processes all tracks at once. @p V is
+expected to be one of @relativeref{Magnum,Float}, @relativeref{Magnum,Vector2},
+@relativeref{Magnum,Vector3}, @relativeref{Magnum,Vector4} or
+@relativeref{Magnum,Quaternion}, and @p interpolation either
+@ref Interpolation::Constant or @ref Interpolation::Linear. The result is the
+same as with the interpolator returned from @ref interpolatorFor() for given
+type, i.e. @ref Math::select(), @ref Math::lerp() or
+@ref Math::slerpShortestPath(const Quaternion<T>&, const Quaternion<T>&, T).
+
+If the two rows of @p values and @p destination are contiguous, linear
+interpolation of scalars and vectors is done on all components at once with
+a SIMD implementation picked at runtime based on
+@ref Corrade::Cpu::runtimeFeatures(). Quaternions are processed in a plain
+loop, which still avoids an indirect function call for every track.
+@experimental
+*/
+template<class K, class V> void interpolateInto(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView2D<const V>& values, Extrapolation before, Extrapolation after, Interpolation interpolation, K frame, std::size_t& hint, const Containers::StridedArrayView1D<V>& destination);
+
+/**
+@brief Interpolate values of multiple tracks sharing the same keys with strict constraints
+@m_since_latest
+
+Batch variant of @ref interpolateStrict(), see @ref interpolateInto() for more
+information. Expects that there are always at least two keyframes, that the
+first dimension of @p values has the same size as @p keys and the second
+dimension has the same size as @p destination.
+@experimental
+*/
+template<class K, class V, class R = ResultOf<V>> void interpolateStrictInto(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView2D<const V>& values, R(*interpolator)(const V&, const V&, Float), K frame, std::size_t& hint, const Containers::StridedArrayView1D<R>& destination);
+
+/**
+@brief Interpolate values of multiple tracks sharing the same keys with strict constraints using a builtin interpolator
+@m_since_latest
+
+Batch variant of @ref interpolateStrict() using a builtin implementation of
+@p interpolation, see @ref interpolateInto(const Containers::StridedArrayView1D<const K>&, const Containers::StridedArrayView2D<const V>&, Extrapolation, Extrapolation, Interpolation, K, std::size_t&, const Containers::StridedArrayView1D<V>&)
+for more information.
+@experimental
+*/
+template<class K, class V> void interpolateStrictInto(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView2D<const V>& values, Interpolation interpolation, K frame, std::size_t& hint, const Containers::StridedArrayView1D<V>& destination);
+
 /**
 @brief Combine easing function and an interpolator
 
@@ -261,8 +341,8 @@ expressions give the same result:
 
 @see @ref unpackEase()
 */
-template<class T, class V, ResultOf<V>(*interpolator)(const V&, const V&, Float), V(*unpacker)(const T&)> constexpr auto unpack() -> ResultOf<V>(*)(const V&, const V&, Float) {
-    return [](const V& a, const V& b, Float t) { return interpolator(unpacker(a), unpacker(b), t); };
+template<class T, class V, ResultOf<V>(*interpolator)(const V&, const V&, Float), V(*unpacker)(const T&)> constexpr auto unpack() -> ResultOf<V>(*)(const T&, const T&, Float) {
+    return [](const T& a, const T& b, Float t) { return interpolator(unpacker(a), unpacker(b), t); };
 }
 
 /**
@@ -275,8 +355,8 @@ give the same result:
 
 @snippet Animation.cpp unpackEase
 */
-template<class T, class V, ResultOf<V>(*interpolator)(const V&, const V&, Float), V(*unpacker)(const T&), Float(*easer)(Float)> constexpr auto unpackEase() -> ResultOf<V>(*)(const V&, const V&, Float) {
-    return [](const V& a, const V& b, Float t) { return interpolator(unpacker(a), unpacker(b), easer(t)); };
+template<class T, class V, ResultOf<V>(*interpolator)(const V&, const V&, Float), V(*unpacker)(const T&), Float(*easer)(Float)> constexpr auto unpackEase() -> ResultOf<V>(*)(const T&, const T&, Float) {
+    return [](const T& a, const T& b, Float t) { return interpolator(unpacker(a), unpacker(b), easer(t)); };
 }
 
 /**
@@ -286,8 +366,8 @@ In addition to @ref unpackEase() clamps value coming to @p easer to range
 @f$ [0 ; 1] @f$. Useful when extrapolating with @ref Easing functions that have
 bad behavior outside of this range.
 */
-template<class T, class V, ResultOf<V>(*interpolator)(const V&, const V&, Float), V(*unpacker)(const T&), Float(*easer)(Float)> constexpr auto unpackEaseClamped() -> ResultOf<V>(*)(const V&, const V&, Float) {
-    return [](const V& a, const V& b, Float t) { return interpolator(unpacker(a), unpacker(b), easer(Math::clamp(t, 0.0f, 1.0f))); };
+template<class T, class V, ResultOf<V>(*interpolator)(const V&, const V&, Float), V(*unpacker)(const T&), Float(*easer)(Float)> constexpr auto unpackEaseClamped() -> ResultOf<V>(*)(const T&, const T&, Float) {
+    return [](const T& a, const T& b, Float t) { return interpolator(unpacker(a), unpacker(b), easer(Math::clamp(t, 0.0f, 1.0f))); };
 }
 
 namespace Implementation {
@@ -416,19 +496,24 @@ template<class V, class R> auto interpolatorFor(Interpolation interpolation) ->
     return Implementation::TypeTraits<typename std::remove_const<V>::type, R>::interpolator(interpolation);
 }
 
-template<class K, class V, class R> R interpolate(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView1D<const V>& values, const Extrapolation before, const Extrapolation after, R(*const interpolator)(const V&, const V&, Float), K frame, std::size_t& hint) {
-    CORRADE_ASSERT(keys.size() == values.size(), "Animation::interpolate(): keys and values don't have the same size", {});
+namespace Implementation {
 
+/* Shared between interpolate() and interpolateInto(). Returns false if a
+   default-constructed value should be produced, otherwise fills in indices of
+   the two keyframes to interpolate between and the interpolation factor. */
+template<class K> bool interpolationKeyframes(const Containers::StridedArrayView1D<const K>& keys, const Extrapolation before, const Extrapolation after, K frame, std::size_t& hint, std::size_t& first, std::size_t& second, Float& factor) {
     /* No data, return default-constructed value */
-    if(!keys.size()) return {};
+    if(!keys.size()) return false;
 
     /* Only one frame, return it verbatim (or default-constructed, if desired) */
     if(keys.size() == 1) {
         if((frame < keys[0] && before == Extrapolation::DefaultConstructed) ||
            (frame > keys[0] && after == Extrapolation::DefaultConstructed))
-            return {};
+            return false;
 
-        return interpolator(values[0], values[0], 0.0f);
+        first = second = 0;
+        factor = 0.0f;
+        return true;
     }
 
     /* Rewind from the beginning if hint is too late */
@@ -441,21 +526,22 @@ template<class K, class V, class R> R interpolate(const Containers::StridedArray
     /* Special extrapolation outside of range. Usual extrapolation is handled
        below. */
     if(frame < keys[hint]) {
-        if(before == Extrapolation::DefaultConstructed) return {};
+        if(before == Extrapolation::DefaultConstructed) return false;
         if(before == Extrapolation::Constant) frame = keys[hint];
     } else if(frame >= keys[hint + 1]) {
-        if(after == Extrapolation::DefaultConstructed) return {};
+        if(after == Extrapolation::DefaultConstructed) return false;
         if(after == Extrapolation::Constant) frame = keys[hint + 1];
     }
 
-    return interpolator(values[hint], values[hint + 1],
-        Math::lerpInverted(Float(keys[hint]), Float(keys[hint + 1]), Float(frame)));
+    first = hint;
+    second = hint + 1;
+    factor = Math::lerpInverted(Float(keys[hint]), Float(keys[hint + 1]), Float(frame));
+    return true;
 }
 
-template<class K, class V, class R> R interpolateStrict(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView1D<const V>& values, R(*const interpolator)(const V&, const V&, Float), const K frame, std::size_t& hint) {
-    CORRADE_ASSERT(keys.size() >= 2, "Animation::interpolateStrict(): at least two keyframes required", {});
-    CORRADE_ASSERT(keys.size() == values.size(), "Animation::interpolateStrict(): keys and values don't have the same size", {});
-
+/* Shared between interpolateStrict() and interpolateStrictInto(), expects
+   at least two keys */
+template<class K> Float interpolationKeyframesStrict(const Containers::StridedArrayView1D<const K>& keys, const K frame, std::size_t& hint) {
     /* Rewind from the beginning if hint is too late */
     if(hint >= keys.size() || frame < keys[hint]) hint = 0;
 
@@ -463,8 +549,89 @@ template<class K, class V, class R> R interpolateStrict(const Containers::Stride
     while(hint + 2 < keys.size() && frame >= keys[hint + 1])
         ++hint;
 
-    return interpolator(values[hint], values[hint + 1],
-        Math::lerpInverted(Float(keys[hint]), Float(keys[hint + 1]), Float(frame)));
+    return Math::lerpInverted(Float(keys[hint]), Float(keys[hint + 1]), Float(frame));
+}
+
+/* Builtin batch interpolators used by interpolateInto(), defined in
+   Interpolation.cpp. Only Interpolation::Constant and Linear are
+   supported. */
+MAGNUM_EXPORT void interpolateBatch(Interpolation interpolation, const Containers::StridedArrayView1D<const Float>& a, const Containers::StridedArrayView1D<const Float>& b, Float t, const Containers::StridedArrayView1D<Float>& destination);
+MAGNUM_EXPORT void interpolateBatch(Interpolation interpolation, const Containers::StridedArrayView1D<const Vector2>& a, const Containers::StridedArrayView1D<const Vector2>& b, Float t, const Containers::StridedArrayView1D<Vector2>& destination);
+MAGNUM_EXPORT void interpolateBatch(Interpolation interpolation, const Containers::StridedArrayView1D<const Vector3>& a, const Containers::StridedArrayView1D<const Vector3>& b, Float t, const Containers::StridedArrayView1D<Vector3>& destination);
+MAGNUM_EXPORT void interpolateBatch(Interpolation interpolation, const Containers::StridedArrayView1D<const Vector4>& a, const Containers::StridedArrayView1D<const Vector4>& b, Float t, const Containers::StridedArrayView1D<Vector4>& destination);
+MAGNUM_EXPORT void interpolateBatch(Interpolation interpolation, const Containers::StridedArrayView1D<const Quaternion>& a, const Containers::StridedArrayView1D<const Quaternion>& b, Float t, const Containers::StridedArrayView1D<Quaternion>& destination);
+
+}
+
+template<class K, class V, class R> R interpolate(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView1D<const V>& values, const Extrapolation before, const Extrapolation after, R(*const interpolator)(const V&, const V&, Float), K frame, std::size_t& hint) {
+    CORRADE_ASSERT(keys.size() == values.size(), "Animation::interpolate(): keys and values don't have the same size", {});
+
+    std::size_t first, second;
+    Float factor;
+    if(!Implementation::interpolationKeyframes(keys, before, after, frame, hint, first, second, factor))
+        return {};
+
+    return interpolator(values[first], values[second], factor);
+}
+
+template<class K, class V, class R> R interpolateStrict(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView1D<const V>& values, R(*const interpolator)(const V&, const V&, Float), const K frame, std::size_t& hint) {
+    CORRADE_ASSERT(keys.size() >= 2, "Animation::interpolateStrict(): at least two keyframes required", {});
+    CORRADE_ASSERT(keys.size() == values.size(), "Animation::interpolateStrict(): keys and values don't have the same size", {});
+
+    const Float factor = Implementation::interpolationKeyframesStrict(keys, frame, hint);
+    return interpolator(values[hint], values[hint + 1], factor);
+}
+
+template<class K, class V, class R> void interpolateInto(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView2D<const V>& values, const Extrapolation before, const Extrapolation after, R(*const interpolator)(const V&, const V&, Float), const K frame, std::size_t& hint, const Containers::StridedArrayView1D<R>& destination) {
+    CORRADE_ASSERT(keys.size() == values.size()[0], "Animation::interpolateInto(): keys and values don't have the same size", );
+    CORRADE_ASSERT(destination.size() == values.size()[1], "Animation::interpolateInto(): values and destination don't have the same size", );
+
+    std::size_t first, second;
+    Float factor;
+    if(!Implementation::interpolationKeyframes(keys, before, after, frame, hint, first, second, factor)) {
+        for(R& i: destination) i = R{};
+        return;
+    }
+
+    const Containers::StridedArrayView1D<const V> a = values[first];
+    const Containers::StridedArrayView1D<const V> b = values[second];
+    for(std::size_t i = 0, max = destination.size(); i != max; ++i)
+        destination[i] = interpolator(a[i], b[i], factor);
+}
+
+template<class K, class V> void interpolateInto(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView2D<const V>& values, const Extrapolation before, const Extrapolation after, const Interpolation interpolation, const K frame, std::size_t& hint, const Containers::StridedArrayView1D<V>& destination) {
+    CORRADE_ASSERT(keys.size() == values.size()[0], "Animation::interpolateInto(): keys and values don't have the same size", );
+    CORRADE_ASSERT(destination.size() == values.size()[1], "Animation::interpolateInto(): values and destination don't have the same size", );
+
+    std::size_t first, second;
+    Float factor;
+    if(!Implementation::interpolationKeyframes(keys, before, after, frame, hint, first, second, factor)) {
+        for(V& i: destination) i = V{};
+        return;
+    }
+
+    Implementation::interpolateBatch(interpolation, values[first], values[second], factor, destination);
+}
+
+template<class K, class V, class R> void interpolateStrictInto(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView2D<const V>& values, R(*const interpolator)(const V&, const V&, Float), const K frame, std::size_t& hint, const Containers::StridedArrayView1D<R>& destination) {
+    CORRADE_ASSERT(keys.size() >= 2, "Animation::interpolateStrictInto(): at least two keyframes required", );
+    CORRADE_ASSERT(keys.size() == values.size()[0], "Animation::interpolateStrictInto(): keys and values don't have the same size", );
+    CORRADE_ASSERT(destination.size() == values.size()[1], "Animation::interpolateStrictInto(): values and destination don't have the same size", );
+
+    const Float factor = Implementation::interpolationKeyframesStrict(keys, frame, hint);
+    const Containers::StridedArrayView1D<const V> a = values[hint];
+    const Containers::StridedArrayView1D<const V> b = values[hint + 1];
+    for(std::size_t i = 0, max = destination.size(); i != max; ++i)
+        destination[i] = interpolator(a[i], b[i], factor);
+}
+
+template<class K, class V> void interpolateStrictInto(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView2D<const V>& values, const Interpolation interpolation, const K frame, std::size_t& hint, const Containers::StridedArrayView1D<V>& destination) {
+    CORRADE_ASSERT(keys.size() >= 2, "Animation::interpolateStrictInto(): at least two keyframes required", );
+    CORRADE_ASSERT(keys.size() == values.size()[0], "Animation::interpolateStrictInto(): keys and values don't have the same size", );
+    CORRADE_ASSERT(destination.size() == values.size()[1], "Animation::interpolateStrictInto(): values and destination don't have the same size", );
+
+    const Float factor = Implementation::interpolationKeyframesStrict(keys, frame, hint);
+    Implementation::interpolateBatch(interpolation, values[hint], values[hint + 1], factor, destination);
 }
 
 }}
@@ -27,9 +27,13 @@
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Animation/Player.h"
+#include "Magnum/Animation/UniformTrack.h"
+#include "Magnum/Math/Quaternion.h"
 
 namespace Magnum { namespace Animation { namespace Test { namespace {
 
+using namespace Math::Literals;
+
 struct Benchmark: TestSuite::Tester {
     explicit Benchmark();
 
@@ -43,6 +47,8 @@ struct Benchmark: TestSuite::Tester {
     void atStrict();
     void atStrictInterleaved();
     void atStrictInterleavedDirectInterpolator();
+    void atUniform();
+    void atUniformStrict();
 
     void playerAdvanceEmpty();
     void playerAdvanceEmptyTrack();
@@ -51,6 +57,13 @@ struct Benchmark: TestSuite::Tester {
     void playerAdvanceRawCallback();
     void playerAdvanceRawCallbackDirectInterpolator();
 
+    void batchVector3PerTrack();
+    void batchVector3Into();
+    void batchVector3IntoBuiltin();
+    void batchQuaternionPerTrack();
+    void batchQuaternionInto();
+    void batchQuaternionIntoBuiltin();
+
     Containers::Array<Float> _keys;
     Containers::Array<Int> _values;
     Containers::Array<std::pair<Float, Int>> _interleaved;
@@ -58,10 +71,19 @@ struct Benchmark: TestSuite::Tester {
     Containers::StridedArrayView1D<const Int> _valuesInterleaved;
     TrackView<const Float, const Int> _track;
     TrackView<const Float, const Int> _trackInterleaved;
+    UniformTrackView<Float, const Int> _trackUniform;
+
+    Containers::Array<Float> _batchKeys;
+    Containers::Array<Vector3> _batchVector3;
+    Containers::Array<Quaternion> _batchQuaternion;
 };
 
 namespace {
     enum: std::size_t { DataSize = 2000 };
+
+    /* Roughly a few crowd characters with skeletal animations sampled at a
+       fixed rate, all sharing the same keys */
+    enum: std::size_t { BatchKeyCount = 60, BatchTrackCount = 1000 };
 }
 
 Benchmark::Benchmark() {
@@ -75,13 +97,22 @@ Benchmark::Benchmark() {
                    &Benchmark::atStrict,
                    &Benchmark::atStrictInterleaved,
                    &Benchmark::atStrictInterleavedDirectInterpolator,
+                   &Benchmark::atUniform,
+                   &Benchmark::atUniformStrict,
 
                    &Benchmark::playerAdvanceEmpty,
                    &Benchmark::playerAdvanceEmptyTrack,
                    &Benchmark::playerAdvance,
                    &Benchmark::playerAdvanceCallback,
                    &Benchmark::playerAdvanceRawCallback,
-                   &Benchmark::playerAdvanceRawCallbackDirectInterpolator}, 10);
+                   &Benchmark::playerAdvanceRawCallbackDirectInterpolator,
+
+                   &Benchmark::batchVector3PerTrack,
+                   &Benchmark::batchVector3Into,
+                   &Benchmark::batchVector3IntoBuiltin,
+                   &Benchmark::batchQuaternionPerTrack,
+                   &Benchmark::batchQuaternionInto,
+                   &Benchmark::batchQuaternionIntoBuiltin}, 10);
 
     _keys = Containers::Array<Float>{DataSize};
     _values = Containers::Array<Int>{DirectInit, DataSize, 1};
@@ -95,6 +126,21 @@ Benchmark::Benchmark() {
     _track = TrackView<const Float, const Int>{
         Containers::arrayView(_keys), Containers::arrayView(_values), Math::select};
     _trackInterleaved = {_keysInterleaved, _valuesInterleaved, Math::select};
+    _trackUniform = UniformTrackView<Float, const Int>{0.0f, 3.1254f,
+        Containers::arrayView(_values), Math::select};
+
+    /* Keyframe i has all values set to i / i degrees, so the interpolated
+       value can be easily checked */
+    _batchKeys = Containers::Array<Float>{NoInit, BatchKeyCount};
+    _batchVector3 = Containers::Array<Vector3>{NoInit, BatchKeyCount*BatchTrackCount};
+    _batchQuaternion = Containers::Array<Quaternion>{NoInit, BatchKeyCount*BatchTrackCount};
+    for(std::size_t i = 0; i != BatchKeyCount; ++i) {
+        _batchKeys[i] = Float(i);
+        for(std::size_t j = 0; j != BatchTrackCount; ++j) {
+            _batchVector3[i*BatchTrackCount + j] = Vector3{Float(i)};
+            _batchQuaternion[i*BatchTrackCount + j] = Quaternion::rotation(Deg(Float(i)), Vector3::yAxis());
+        }
+    }
 }
 
 void Benchmark::interpolateEmpty() {
@@ -185,6 +231,22 @@ void Benchmark::atStrictInterleavedDirectInterpolator() {
     CORRADE_COMPARE(result, 125000);
 }
 
+void Benchmark::atUniform() {
+    Int result{};
+    CORRADE_BENCHMARK(250)
+        for(Float i = 0.0f; i < 500.0f; i += 1.0f)
+            result += _trackUniform.at(i);
+    CORRADE_COMPARE(result, 125000);
+}
+
+void Benchmark::atUniformStrict() {
+    Int result{};
+    CORRADE_BENCHMARK(250)
+        for(Float i = 0.0f; i < 500.0f; i += 1.0f)
+            result += _trackUniform.atStrict(i);
+    CORRADE_COMPARE(result, 125000);
+}
+
 void Benchmark::playerAdvanceEmpty() {
     Player<Float> player;
     player.play(0.0f);
@@ -261,6 +323,86 @@ void Benchmark::playerAdvanceRawCallbackDirectInterpolator() {
     CORRADE_COMPARE(result, 125000);
 }
 
+void Benchmark::batchVector3PerTrack() {
+    const Containers::StridedArrayView2D<const Vector3> values{_batchVector3, {BatchKeyCount, BatchTrackCount}};
+    Containers::Array<TrackView<const Float, const Vector3>> tracks{BatchTrackCount};
+    for(std::size_t i = 0; i != BatchTrackCount; ++i)
+        tracks[i] = TrackView<const Float, const Vector3>{Containers::arrayView(_batchKeys), values.transposed<0, 1>()[i], Math::lerp};
+
+    Containers::Array<Vector3> out{BatchTrackCount};
+    Containers::Array<std::size_t> hints{ValueInit, BatchTrackCount};
+    CORRADE_BENCHMARK(10) {
+        for(Float time = 0.0f; time < 59.0f; time += 0.5f)
+            for(std::size_t i = 0; i != BatchTrackCount; ++i)
+                out[i] = tracks[i].atStrict(time, hints[i]);
+    }
+    CORRADE_COMPARE(out[BatchTrackCount - 1], Vector3{58.5f});
+}
+
+void Benchmark::batchVector3Into() {
+    const Containers::StridedArrayView2D<const Vector3> values{_batchVector3, {BatchKeyCount, BatchTrackCount}};
+
+    Containers::Array<Vector3> out{BatchTrackCount};
+    std::size_t hint{};
+    CORRADE_BENCHMARK(10) {
+        for(Float time = 0.0f; time < 59.0f; time += 0.5f)
+            interpolateStrictInto<Float, Vector3>(Containers::arrayView(_batchKeys), values, Math::lerp, time, hint, Containers::stridedArrayView(out));
+    }
+    CORRADE_COMPARE(out[BatchTrackCount - 1], Vector3{58.5f});
+}
+
+void Benchmark::batchVector3IntoBuiltin() {
+    const Containers::StridedArrayView2D<const Vector3> values{_batchVector3, {BatchKeyCount, BatchTrackCount}};
+
+    Containers::Array<Vector3> out{BatchTrackCount};
+    std::size_t hint{};
+    CORRADE_BENCHMARK(10) {
+        for(Float time = 0.0f; time < 59.0f; time += 0.5f)
+            interpolateStrictInto<Float, Vector3>(Containers::arrayView(_batchKeys), values, Interpolation::Linear, time, hint, Containers::stridedArrayView(out));
+    }
+    CORRADE_COMPARE(out[BatchTrackCount - 1], Vector3{58.5f});
+}
+
+void Benchmark::batchQuaternionPerTrack() {
+    const Containers::StridedArrayView2D<const Quaternion> values{_batchQuaternion, {BatchKeyCount, BatchTrackCount}};
+    Containers::Array<TrackView<const Float, const Quaternion>> tracks{BatchTrackCount};
+    for(std::size_t i = 0; i != BatchTrackCount; ++i)
+        tracks[i] = TrackView<const Float, const Quaternion>{Containers::arrayView(_batchKeys), values.transposed<0, 1>()[i], Math::slerpShortestPath};
+
+    Containers::Array<Quaternion> out{BatchTrackCount};
+    Containers::Array<std::size_t> hints{ValueInit, BatchTrackCount};
+    CORRADE_BENCHMARK(10) {
+        for(Float time = 0.0f; time < 59.0f; time += 0.5f)
+            for(std::size_t i = 0; i != BatchTrackCount; ++i)
+                out[i] = tracks[i].atStrict(time, hints[i]);
+    }
+    CORRADE_COMPARE(out[BatchTrackCount - 1], Quaternion::rotation(58.5_degf, Vector3::yAxis()));
+}
+
+void Benchmark::batchQuaternionInto() {
+    const Containers::StridedArrayView2D<const Quaternion> values{_batchQuaternion, {BatchKeyCount, BatchTrackCount}};
+
+    Containers::Array<Quaternion> out{BatchTrackCount};
+    std::size_t hint{};
+    CORRADE_BENCHMARK(10) {
+        for(Float time = 0.0f; time < 59.0f; time += 0.5f)
+            interpolateStrictInto<Float, Quaternion>(Containers::arrayView(_batchKeys), values, Math::slerpShortestPath, time, hint, Containers::stridedArrayView(out));
+    }
+    CORRADE_COMPARE(out[BatchTrackCount - 1], Quaternion::rotation(58.5_degf, Vector3::yAxis()));
+}
+
+void Benchmark::batchQuaternionIntoBuiltin() {
+    const Containers::StridedArrayView2D<const Quaternion> values{_batchQuaternion, {BatchKeyCount, BatchTrackCount}};
+
+    Containers::Array<Quaternion> out{BatchTrackCount};
+    std::size_t hint{};
+    CORRADE_BENCHMARK(10) {
+        for(Float time = 0.0f; time < 59.0f; time += 0.5f)
+            interpolateStrictInto<Float, Quaternion>(Containers::arrayView(_batchKeys), values, Interpolation::Linear, time, hint, Containers::stridedArrayView(out));
+    }
+    CORRADE_COMPARE(out[BatchTrackCount - 1], Quaternion::rotation(58.5_degf, Vector3::yAxis()));
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Animation::Test::Benchmark)
@@ -26,6 +26,7 @@
 
 #include <Corrade/Containers/String.h>
 #include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
 
 #include "Magnum/Animation/Easing.h"
 #include "Magnum/Animation/Interpolation.h"
@@ -78,6 +79,17 @@ struct InterpolationTest: TestSuite::Tester {
     void interpolateIntegerKey();
     void interpolateStrictIntegerKey();
 
+    void interpolateInto();
+    void interpolateIntoBuiltin();
+    void interpolateStrictInto();
+    void interpolateStrictIntoBuiltin();
+    void interpolateIntoBuiltinVector();
+    void interpolateIntoBuiltinQuaternion();
+    void interpolateIntoBuiltinConstant();
+    void interpolateIntoError();
+    void interpolateStrictIntoError();
+    void interpolateIntoBuiltinInvalid();
+
     void ease();
     void easeClamped();
     void unpack();
@@ -158,6 +170,14 @@ const struct {
     {"out of range", 405780454}
 };
 
+const struct {
+    const char* name;
+    bool strided;
+} BuiltinData[] {
+    {"contiguous", false},
+    {"strided", true}
+};
+
 InterpolationTest::InterpolationTest() {
     addTests({&InterpolationTest::interpolatorFor,
               &InterpolationTest::interpolatorForInvalid,
@@ -200,7 +220,22 @@ InterpolationTest::InterpolationTest() {
               &InterpolationTest::interpolateStrictError,
 
               &InterpolationTest::interpolateIntegerKey,
-              &InterpolationTest::interpolateStrictIntegerKey,
+              &InterpolationTest::interpolateStrictIntegerKey});
+
+    addInstancedTests({&InterpolationTest::interpolateInto,
+                       &InterpolationTest::interpolateIntoBuiltin,
+                       &InterpolationTest::interpolateStrictInto,
+                       &InterpolationTest::interpolateStrictIntoBuiltin},
+                       Containers::arraySize(Data));
+
+    addInstancedTests({&InterpolationTest::interpolateIntoBuiltinVector,
+                       &InterpolationTest::interpolateIntoBuiltinQuaternion},
+                       Containers::arraySize(BuiltinData));
+
+    addTests({&InterpolationTest::interpolateIntoBuiltinConstant,
+              &InterpolationTest::interpolateIntoError,
+              &InterpolationTest::interpolateStrictIntoError,
+              &InterpolationTest::interpolateIntoBuiltinInvalid,
 
               &InterpolationTest::ease,
               &InterpolationTest::easeClamped,
@@ -579,6 +614,295 @@ void InterpolationTest::interpolateStrictError() {
         "Animation::interpolateStrict(): keys and values don't have the same size\n");
 }
 
+/* Three tracks, each being the Values multiplied by 1, 2 and 3, so the
+   expected output is just the expected single-track value multiplied as
+   well */
+constexpr Float BatchValues[]{
+    3.0f, 6.0f, 9.0f,
+    1.0f, 2.0f, 3.0f,
+    2.5f, 5.0f, 7.5f,
+    0.5f, 1.0f, 1.5f
+};
+
+void InterpolationTest::interpolateInto() {
+    const auto& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Float out[]{1337.0f, 1337.0f, 1337.0f};
+    std::size_t hint{};
+    Animation::interpolateInto<Float, Float>(Keys,
+        Containers::StridedArrayView2D<const Float>{BatchValues, {4, 3}},
+        data.extrapolationBefore, data.extrapolationAfter,
+        Math::lerp, data.time, hint, Containers::stridedArrayView(out));
+    CORRADE_COMPARE_AS(Containers::arrayView(out), Containers::arrayView({
+        data.expectedValue,
+        data.expectedValue*2.0f,
+        data.expectedValue*3.0f
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(hint, data.expectedHint);
+}
+
+void InterpolationTest::interpolateIntoBuiltin() {
+    const auto& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Float out[]{1337.0f, 1337.0f, 1337.0f};
+    std::size_t hint{};
+    Animation::interpolateInto<Float, Float>(Keys,
+        Containers::StridedArrayView2D<const Float>{BatchValues, {4, 3}},
+        data.extrapolationBefore, data.extrapolationAfter,
+        Interpolation::Linear, data.time, hint, Containers::stridedArrayView(out));
+    CORRADE_COMPARE_AS(Containers::arrayView(out), Containers::arrayView({
+        data.expectedValue,
+        data.expectedValue*2.0f,
+        data.expectedValue*3.0f
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(hint, data.expectedHint);
+}
+
+void InterpolationTest::interpolateStrictInto() {
+    const auto& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Float out[]{1337.0f, 1337.0f, 1337.0f};
+    std::size_t hint{};
+    Animation::interpolateStrictInto<Float, Float>(Keys,
+        Containers::StridedArrayView2D<const Float>{BatchValues, {4, 3}},
+        Math::lerp, data.time, hint, Containers::stridedArrayView(out));
+    CORRADE_COMPARE_AS(Containers::arrayView(out), Containers::arrayView({
+        data.expectedValueStrict,
+        data.expectedValueStrict*2.0f,
+        data.expectedValueStrict*3.0f
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(hint, data.expectedHint);
+}
+
+void InterpolationTest::interpolateStrictIntoBuiltin() {
+    const auto& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Float out[]{1337.0f, 1337.0f, 1337.0f};
+    std::size_t hint{};
+    Animation::interpolateStrictInto<Float, Float>(Keys,
+        Containers::StridedArrayView2D<const Float>{BatchValues, {4, 3}},
+        Interpolation::Linear, data.time, hint, Containers::stridedArrayView(out));
+    CORRADE_COMPARE_AS(Containers::arrayView(out), Containers::arrayView({
+        data.expectedValueStrict,
+        data.expectedValueStrict*2.0f,
+        data.expectedValueStrict*3.0f
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(hint, data.expectedHint);
+}
+
+void InterpolationTest::interpolateIntoBuiltinVector() {
+    const auto& data = BuiltinData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Five tracks, so it's 15 floats in total that exercise both the SIMD
+       code and the remainder */
+    Vector3 values[4][5];
+    for(std::size_t i = 0; i != 4; ++i)
+        for(std::size_t j = 0; j != 5; ++j)
+            values[i][j] = Vector3{Float(i*j), Float(i) - Float(j), Float(i + j)*0.5f};
+    const Containers::StridedArrayView2D<const Vector3> valuesView{Containers::arrayView(&values[0][0], 20), {4, 5}};
+
+    /* The strided variant puts the output into every other item */
+    Vector3 out[10]{};
+    const Containers::StridedArrayView1D<Vector3> destination = data.strided ?
+        Containers::stridedArrayView(out).every(2) :
+        Containers::stridedArrayView(out).prefix(5);
+
+    std::size_t hint{};
+    Animation::interpolateInto<Float, Vector3>(Keys, valuesView,
+        Extrapolation::Extrapolated, Extrapolation::Extrapolated,
+        Interpolation::Linear, 4.75f, hint, destination);
+    CORRADE_COMPARE(hint, 2);
+
+    for(std::size_t i = 0; i != 5; ++i) {
+        CORRADE_ITERATION(i);
+        std::size_t trackHint{};
+        CORRADE_COMPARE(destination[i], (Animation::interpolate<Float, Vector3>(
+            Keys, valuesView.transposed<0, 1>()[i],
+            Extrapolation::Extrapolated, Extrapolation::Extrapolated,
+            Math::lerp, 4.75f, trackHint)));
+    }
+}
+
+void InterpolationTest::interpolateIntoBuiltinQuaternion() {
+    const auto& data = BuiltinData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* The second track needs the shortest path handling */
+    const Quaternion values[]{
+        Quaternion::rotation(0.0_degf, Vector3::xAxis()),
+        Quaternion::rotation(10.0_degf, Vector3::yAxis()),
+        Quaternion::rotation(90.0_degf, Vector3::xAxis()),
+        -Quaternion::rotation(60.0_degf, Vector3::yAxis()),
+        Quaternion::rotation(135.0_degf, Vector3::xAxis()),
+        Quaternion::rotation(120.0_degf, Vector3::yAxis()),
+        Quaternion::rotation(180.0_degf, Vector3::xAxis()),
+        -Quaternion::rotation(180.0_degf, Vector3::yAxis()),
+    };
+    const Containers::StridedArrayView2D<const Quaternion> valuesView{values, {4, 2}};
+
+    Quaternion out[4];
+    const Containers::StridedArrayView1D<Quaternion> destination = data.strided ?
+        Containers::stridedArrayView(out).every(2) :
+        Containers::stridedArrayView(out).prefix(2);
+
+    std::size_t hint{};
+    Animation::interpolateInto<Float, Quaternion>(Keys, valuesView,
+        Extrapolation::Constant, Extrapolation::Constant,
+        Interpolation::Linear, 1.5f, hint, destination);
+    CORRADE_COMPARE(hint, 0);
+    CORRADE_COMPARE(destination[0], Math::slerpShortestPath(values[0], values[2], 0.75f));
+    CORRADE_COMPARE(destination[1], Math::slerpShortestPath(values[1], values[3], 0.75f));
+}
+
+void InterpolationTest::interpolateIntoBuiltinConstant() {
+    Float out[3];
+
+    /* Before the second keyframe it's the first value */
+    std::size_t hint{};
+    Animation::interpolateStrictInto<Float, Float>(Keys,
+        Containers::StridedArrayView2D<const Float>{BatchValues, {4, 3}},
+        Interpolation::Constant, 3.5f, hint, Containers::stridedArrayView(out));
+    CORRADE_COMPARE_AS(Containers::arrayView(out), Containers::arrayView({
+        1.0f, 2.0f, 3.0f
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(hint, 1);
+
+    /* At the second keyframe it's the second value */
+    Animation::interpolateStrictInto<Float, Float>(Keys,
+        Containers::StridedArrayView2D<const Float>{BatchValues, {4, 3}},
+        Interpolation::Constant, 4.0f, hint, Containers::stridedArrayView(out));
+    CORRADE_COMPARE_AS(Containers::arrayView(out), Containers::arrayView({
+        2.5f, 5.0f, 7.5f
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(hint, 2);
+}
+
+void InterpolationTest::interpolateIntoError() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Float destination[3];
+    Float destinationInvalid[2];
+
+    Containers::String out;
+    Error redirectError{&out};
+
+    {
+        std::size_t hint{};
+        Animation::interpolateInto<Float, Float>(
+            Containers::arrayView(Keys).prefix(3),
+            Containers::StridedArrayView2D<const Float>{BatchValues, {4, 3}},
+            Extrapolation::Extrapolated, Extrapolation::Extrapolated,
+            Math::lerp, 0.0f, hint, Containers::stridedArrayView(destination));
+    } {
+        std::size_t hint{};
+        Animation::interpolateInto<Float, Float>(Keys,
+            Containers::StridedArrayView2D<const Float>{BatchValues, {4, 3}},
+            Extrapolation::Extrapolated, Extrapolation::Extrapolated,
+            Math::lerp, 0.0f, hint, Containers::stridedArrayView(destinationInvalid));
+    } {
+        std::size_t hint{};
+        Animation::interpolateInto<Float, Float>(
+            Containers::arrayView(Keys).prefix(3),
+            Containers::StridedArrayView2D<const Float>{BatchValues, {4, 3}},
+            Extrapolation::Extrapolated, Extrapolation::Extrapolated,
+            Interpolation::Linear, 0.0f, hint, Containers::stridedArrayView(destination));
+    } {
+        std::size_t hint{};
+        Animation::interpolateInto<Float, Float>(Keys,
+            Containers::StridedArrayView2D<const Float>{BatchValues, {4, 3}},
+            Extrapolation::Extrapolated, Extrapolation::Extrapolated,
+            Interpolation::Linear, 0.0f, hint, Containers::stridedArrayView(destinationInvalid));
+    }
+
+    CORRADE_COMPARE(out,
+        "Animation::interpolateInto(): keys and values don't have the same size\n"
+        "Animation::interpolateInto(): values and destination don't have the same size\n"
+        "Animation::interpolateInto(): keys and values don't have the same size\n"
+        "Animation::interpolateInto(): values and destination don't have the same size\n");
+}
+
+void InterpolationTest::interpolateStrictIntoError() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Float destination[3];
+    Float destinationInvalid[2];
+
+    Containers::String out;
+    Error redirectError{&out};
+
+    {
+        std::size_t hint{};
+        Animation::interpolateStrictInto<Float, Float>(
+            Containers::arrayView(Keys).prefix(1),
+            Containers::StridedArrayView2D<const Float>{BatchValues, {4, 3}}.prefix({1, 3}),
+            Math::lerp, 0.0f, hint, Containers::stridedArrayView(destination));
+    } {
+        std::size_t hint{};
+        Animation::interpolateStrictInto<Float, Float>(
+            Containers::arrayView(Keys).prefix(3),
+            Containers::StridedArrayView2D<const Float>{BatchValues, {4, 3}},
+            Math::lerp, 0.0f, hint, Containers::stridedArrayView(destination));
+    } {
+        std::size_t hint{};
+        Animation::interpolateStrictInto<Float, Float>(Keys,
+            Containers::StridedArrayView2D<const Float>{BatchValues, {4, 3}},
+            Math::lerp, 0.0f, hint, Containers::stridedArrayView(destinationInvalid));
+    } {
+        std::size_t hint{};
+        Animation::interpolateStrictInto<Float, Float>(
+            Containers::arrayView(Keys).prefix(1),
+            Containers::StridedArrayView2D<const Float>{BatchValues, {4, 3}}.prefix({1, 3}),
+            Interpolation::Linear, 0.0f, hint, Containers::stridedArrayView(destination));
+    } {
+        std::size_t hint{};
+        Animation::interpolateStrictInto<Float, Float>(
+            Containers::arrayView(Keys).prefix(3),
+            Containers::StridedArrayView2D<const Float>{BatchValues, {4, 3}},
+            Interpolation::Linear, 0.0f, hint, Containers::stridedArrayView(destination));
+    } {
+        std::size_t hint{};
+        Animation::interpolateStrictInto<Float, Float>(Keys,
+            Containers::StridedArrayView2D<const Float>{BatchValues, {4, 3}},
+            Interpolation::Linear, 0.0f, hint, Containers::stridedArrayView(destinationInvalid));
+    }
+
+    CORRADE_COMPARE(out,
+        "Animation::interpolateStrictInto(): at least two keyframes required\n"
+        "Animation::interpolateStrictInto(): keys and values don't have the same size\n"
+        "Animation::interpolateStrictInto(): values and destination don't have the same size\n"
+        "Animation::interpolateStrictInto(): at least two keyframes required\n"
+        "Animation::interpolateStrictInto(): keys and values don't have the same size\n"
+        "Animation::interpolateStrictInto(): values and destination don't have the same size\n");
+}
+
+void InterpolationTest::interpolateIntoBuiltinInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Float destination[3];
+    Quaternion destinationQuaternion[1];
+    const Quaternion valuesQuaternion[2];
+
+    Containers::String out;
+    Error redirectError{&out};
+
+    std::size_t hint{};
+    Animation::interpolateStrictInto<Float, Float>(Keys,
+        Containers::StridedArrayView2D<const Float>{BatchValues, {4, 3}},
+        Interpolation::Spline, 0.0f, hint, Containers::stridedArrayView(destination));
+    Animation::interpolateStrictInto<Float, Quaternion>(
+        Containers::arrayView(Keys).prefix(2),
+        Containers::StridedArrayView2D<const Quaternion>{valuesQuaternion, {2, 1}},
+        Interpolation::Custom, 0.0f, hint, Containers::stridedArrayView(destinationQuaternion));
+    CORRADE_COMPARE(out,
+        "Animation::interpolateInto(): can't batch-interpolate with Animation::Interpolation::Spline\n"
+        "Animation::interpolateInto(): can't batch-interpolate with Animation::Interpolation::Custom\n");
+}
+
 void InterpolationTest::ease() {
     auto lerpQuadratic = Animation::ease<Float, Math::lerp, Easing::quadraticIn>();
 
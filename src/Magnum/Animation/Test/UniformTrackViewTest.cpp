@@ -0,0 +1,534 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+
+#include "Magnum/Animation/UniformTrack.h"
+#include "Magnum/Math/Half.h"
+#include "Magnum/Math/PackingBatch.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace Animation { namespace Test { namespace {
+
+struct UniformTrackViewTest: TestSuite::Tester {
+    explicit UniformTrackViewTest();
+
+    void constructEmpty();
+    void constructInterpolator();
+    void constructInterpolatorDefaults();
+    void constructInterpolation();
+    void constructInterpolationDefaults();
+    void constructInterpolationInterpolator();
+    void constructInvalidStep();
+    void convertToConstView();
+
+    void at();
+    void atStrict();
+    void atSameAsTrackView();
+    void atSingleKeyframe();
+    void atStrictInvalid();
+    void atIntegerKey();
+    void atUnsignedIntegerKeyBefore();
+    void atDifferentResultType();
+
+    void resampleInto();
+    void resample();
+    void resampleTrack();
+    void resampleNotMultipleOfStep();
+    void resamplePacked();
+    void resampleEmpty();
+    void resampleInvalidStep();
+};
+
+/* Same as in InterpolationTest, but with uniformly distributed keys at 0, 2,
+   4 and 6 */
+const struct {
+    const char* name;
+    Extrapolation extrapolationBefore;
+    Extrapolation extrapolationAfter;
+    Float time;
+    Float expectedValue, expectedValueStrict;
+} AtData[] {
+    {"before default-constructed",
+        Extrapolation::DefaultConstructed, Extrapolation::Extrapolated,
+        -1.0f, 0.0f, 4.0f},
+    {"before constant",
+        Extrapolation::Constant, Extrapolation::Extrapolated,
+        -1.0f, 3.0f, 4.0f},
+    {"before extrapolated",
+        Extrapolation::Extrapolated, Extrapolation::DefaultConstructed,
+        -1.0f, 4.0f, 4.0f},
+    {"at first",
+        Extrapolation::DefaultConstructed, Extrapolation::DefaultConstructed,
+        0.0f, 3.0f, 3.0f},
+    {"during first",
+        Extrapolation::DefaultConstructed, Extrapolation::DefaultConstructed,
+        1.5f, 1.5f, 1.5f},
+    {"during last",
+        Extrapolation::DefaultConstructed, Extrapolation::DefaultConstructed,
+        5.5f, 1.0f, 1.0f},
+    {"after default-constructed",
+        Extrapolation::Extrapolated, Extrapolation::DefaultConstructed,
+        7.0f, 0.0f, -0.5f},
+    {"after constant",
+        Extrapolation::Extrapolated, Extrapolation::Constant,
+        7.0f, 0.5f, -0.5f},
+    {"after extrapolated",
+        Extrapolation::DefaultConstructed, Extrapolation::Extrapolated,
+        7.0f, -0.5f, -0.5f}
+};
+
+const struct {
+    const char* name;
+    Extrapolation extrapolation;
+    Float time;
+    Float expectedValue;
+} SingleKeyframeData[] {
+    {"before default-constructed",
+        Extrapolation::DefaultConstructed, -1.0f, 0.0f},
+    {"before constant",
+        Extrapolation::Constant, -1.0f, 3.0f},
+    {"at",
+        Extrapolation::DefaultConstructed, 2.0f, 3.0f},
+    {"after default-constructed",
+        Extrapolation::DefaultConstructed, 3.0f, 0.0f},
+    {"after extrapolated",
+        Extrapolation::Extrapolated, 3.0f, 3.0f}
+};
+
+UniformTrackViewTest::UniformTrackViewTest() {
+    addTests({&UniformTrackViewTest::constructEmpty,
+              &UniformTrackViewTest::constructInterpolator,
+              &UniformTrackViewTest::constructInterpolatorDefaults,
+              &UniformTrackViewTest::constructInterpolation,
+              &UniformTrackViewTest::constructInterpolationDefaults,
+              &UniformTrackViewTest::constructInterpolationInterpolator,
+              &UniformTrackViewTest::constructInvalidStep,
+              &UniformTrackViewTest::convertToConstView});
+
+    addInstancedTests({&UniformTrackViewTest::at,
+                       &UniformTrackViewTest::atStrict,
+                       &UniformTrackViewTest::atSameAsTrackView},
+        Containers::arraySize(AtData));
+
+    addInstancedTests({&UniformTrackViewTest::atSingleKeyframe},
+        Containers::arraySize(SingleKeyframeData));
+
+    addTests({&UniformTrackViewTest::atStrictInvalid,
+              &UniformTrackViewTest::atIntegerKey,
+              &UniformTrackViewTest::atUnsignedIntegerKeyBefore,
+              &UniformTrackViewTest::atDifferentResultType,
+
+              &UniformTrackViewTest::resampleInto,
+              &UniformTrackViewTest::resample,
+              &UniformTrackViewTest::resampleTrack,
+              &UniformTrackViewTest::resampleNotMultipleOfStep,
+              &UniformTrackViewTest::resamplePacked,
+              &UniformTrackViewTest::resampleEmpty,
+              &UniformTrackViewTest::resampleInvalidStep});
+}
+
+using namespace Math::Literals;
+
+void UniformTrackViewTest::constructEmpty() {
+    const UniformTrackView<Float, Vector3> a;
+    const UniformTrackView<Float, const Vector3> ca;
+
+    CORRADE_VERIFY(!a.interpolator());
+    CORRADE_COMPARE(a.begin(), 0.0f);
+    CORRADE_COMPARE(a.step(), 0.0f);
+    CORRADE_COMPARE(a.duration(), Range1D{});
+    CORRADE_VERIFY(!a.size());
+    CORRADE_VERIFY(a.values().isEmpty());
+    CORRADE_COMPARE(a.at(42.0f), Vector3{});
+
+    CORRADE_VERIFY(!ca.interpolator());
+    CORRADE_COMPARE(ca.begin(), 0.0f);
+    CORRADE_COMPARE(ca.step(), 0.0f);
+    CORRADE_COMPARE(ca.duration(), Range1D{});
+    CORRADE_VERIFY(!ca.size());
+    CORRADE_VERIFY(ca.values().isEmpty());
+    CORRADE_COMPARE(ca.at(42.0f), Vector3{});
+}
+
+void UniformTrackViewTest::constructInterpolator() {
+    Vector3 values[]{{3.0f, 1.0f, 0.1f}, {0.3f, 0.6f, 1.0f}, {1.0f, 0.5f, 0.0f}};
+
+    const UniformTrackView<Float, Vector3> a{1.0f, 2.5f, values, Math::select,
+        Extrapolation::Extrapolated, Extrapolation::DefaultConstructed};
+
+    CORRADE_COMPARE(a.interpolation(), Interpolation::Custom);
+    CORRADE_COMPARE(a.interpolator(), Math::select);
+    CORRADE_COMPARE(a.before(), Extrapolation::Extrapolated);
+    CORRADE_COMPARE(a.after(), Extrapolation::DefaultConstructed);
+    CORRADE_COMPARE(a.begin(), 1.0f);
+    CORRADE_COMPARE(a.step(), 2.5f);
+    CORRADE_COMPARE(a.duration(), (Range1D{1.0f, 6.0f}));
+    CORRADE_COMPARE(a.size(), 3);
+    CORRADE_COMPARE(a.values().size(), 3);
+    CORRADE_COMPARE(a.values()[1], (Vector3{0.3f, 0.6f, 1.0f}));
+    CORRADE_COMPARE(a.key(2), 6.0f);
+
+    constexpr Vector3 cvalues[]{{3.0f, 1.0f, 0.1f}, {0.3f, 0.6f, 1.0f}, {1.0f, 0.5f, 0.0f}};
+
+    const UniformTrackView<Float, const Vector3> ca{1.0f, 2.5f, cvalues, Math::select,
+        Extrapolation::Extrapolated, Extrapolation::DefaultConstructed};
+
+    CORRADE_COMPARE(ca.interpolation(), Interpolation::Custom);
+    CORRADE_COMPARE(ca.interpolator(), Math::select);
+    CORRADE_COMPARE(ca.before(), Extrapolation::Extrapolated);
+    CORRADE_COMPARE(ca.after(), Extrapolation::DefaultConstructed);
+    CORRADE_COMPARE(ca.begin(), 1.0f);
+    CORRADE_COMPARE(ca.step(), 2.5f);
+    CORRADE_COMPARE(ca.duration(), (Range1D{1.0f, 6.0f}));
+    CORRADE_COMPARE(ca.size(), 3);
+    CORRADE_COMPARE(ca.values().size(), 3);
+    CORRADE_COMPARE(ca.values()[1], (Vector3{0.3f, 0.6f, 1.0f}));
+    CORRADE_COMPARE(ca.key(2), 6.0f);
+}
+
+void UniformTrackViewTest::constructInterpolatorDefaults() {
+    Vector3 values[]{{3.0f, 1.0f, 0.1f}, {0.3f, 0.6f, 1.0f}};
+
+    const UniformTrackView<Float, Vector3> a{1.0f, 4.0f, values, Math::lerp,
+        Extrapolation::Extrapolated};
+
+    CORRADE_COMPARE(a.interpolation(), Interpolation::Custom);
+    CORRADE_COMPARE(a.interpolator(), Math::lerp);
+    CORRADE_COMPARE(a.before(), Extrapolation::Extrapolated);
+    CORRADE_COMPARE(a.after(), Extrapolation::Extrapolated);
+    CORRADE_COMPARE(a.duration(), (Range1D{1.0f, 5.0f}));
+    CORRADE_COMPARE(a.size(), 2);
+
+    const UniformTrackView<Float, Vector3> b{1.0f, 4.0f, values, Math::lerp};
+    CORRADE_COMPARE(b.before(), Extrapolation::Constant);
+    CORRADE_COMPARE(b.after(), Extrapolation::Constant);
+}
+
+void UniformTrackViewTest::constructInterpolation() {
+    Vector3 values[]{{3.0f, 1.0f, 0.1f}, {0.3f, 0.6f, 1.0f}};
+
+    const UniformTrackView<Float, Vector3> a{1.0f, 4.0f, values,
+        Interpolation::Linear, Extrapolation::Extrapolated,
+        Extrapolation::DefaultConstructed};
+
+    CORRADE_COMPARE(a.interpolation(), Interpolation::Linear);
+    CORRADE_COMPARE(a.interpolator(), Math::lerp);
+    CORRADE_COMPARE(a.before(), Extrapolation::Extrapolated);
+    CORRADE_COMPARE(a.after(), Extrapolation::DefaultConstructed);
+    CORRADE_COMPARE(a.duration(), (Range1D{1.0f, 5.0f}));
+    CORRADE_COMPARE(a.size(), 2);
+}
+
+void UniformTrackViewTest::constructInterpolationDefaults() {
+    Vector3 values[]{{3.0f, 1.0f, 0.1f}, {0.3f, 0.6f, 1.0f}};
+
+    const UniformTrackView<Float, Vector3> a{1.0f, 4.0f, values,
+        Interpolation::Constant};
+
+    CORRADE_COMPARE(a.interpolation(), Interpolation::Constant);
+    CORRADE_COMPARE(a.interpolator(), Math::select);
+    CORRADE_COMPARE(a.before(), Extrapolation::Constant);
+    CORRADE_COMPARE(a.after(), Extrapolation::Constant);
+    CORRADE_COMPARE(a.duration(), (Range1D{1.0f, 5.0f}));
+    CORRADE_COMPARE(a.size(), 2);
+}
+
+Vector3 customLerp(const Vector3&, const Vector3&, Float) { return {}; }
+
+void UniformTrackViewTest::constructInterpolationInterpolator() {
+    Vector3 values[]{{3.0f, 1.0f, 0.1f}, {0.3f, 0.6f, 1.0f}};
+
+    const UniformTrackView<Float, Vector3> a{1.0f, 4.0f, values,
+        Interpolation::Linear, customLerp, Extrapolation::Extrapolated,
+        Extrapolation::DefaultConstructed};
+
+    CORRADE_COMPARE(a.interpolation(), Interpolation::Linear);
+    CORRADE_COMPARE(a.interpolator(), customLerp);
+    CORRADE_COMPARE(a.before(), Extrapolation::Extrapolated);
+    CORRADE_COMPARE(a.after(), Extrapolation::DefaultConstructed);
+    CORRADE_COMPARE(a.duration(), (Range1D{1.0f, 5.0f}));
+    CORRADE_COMPARE(a.size(), 2);
+    CORRADE_COMPARE(a.at(3.0f), Vector3{});
+}
+
+void UniformTrackViewTest::constructInvalidStep() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Vector3 values[2]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    UniformTrackView<Float, Vector3>{1.0f, 0.0f, values, Math::select};
+    UniformTrackView<Float, Vector3>{1.0f, -1.0f, values, Math::select};
+    CORRADE_COMPARE(out,
+        "Animation::UniformTrackView: expected a positive step\n"
+        "Animation::UniformTrackView: expected a positive step\n");
+}
+
+void UniformTrackViewTest::convertToConstView() {
+    Vector3 values[]{{3.0f, 1.0f, 0.1f}, {0.3f, 0.6f, 1.0f}};
+
+    const UniformTrackView<Float, Vector3> a{1.0f, 4.0f, values,
+        Interpolation::Linear, customLerp, Extrapolation::Extrapolated,
+        Extrapolation::DefaultConstructed};
+
+    const UniformTrackView<Float, const Vector3> ca = a;
+
+    CORRADE_COMPARE(ca.interpolation(), Interpolation::Linear);
+    CORRADE_COMPARE(ca.interpolator(), customLerp);
+    CORRADE_COMPARE(ca.before(), Extrapolation::Extrapolated);
+    CORRADE_COMPARE(ca.after(), Extrapolation::DefaultConstructed);
+    CORRADE_COMPARE(ca.begin(), 1.0f);
+    CORRADE_COMPARE(ca.step(), 4.0f);
+    CORRADE_COMPARE(ca.size(), 2);
+    CORRADE_COMPARE(ca.values()[1], (Vector3{0.3f, 0.6f, 1.0f}));
+
+    /* Conversion back is not possible */
+    CORRADE_VERIFY(std::is_convertible<UniformTrackView<Float, Vector3>, UniformTrackView<Float, const Vector3>>::value);
+    CORRADE_VERIFY(!std::is_convertible<UniformTrackView<Float, const Vector3>, UniformTrackView<Float, Vector3>>::value);
+}
+
+constexpr Float Values[]{3.0f, 1.0f, 2.5f, 0.5f};
+
+void UniformTrackViewTest::at() {
+    const auto& data = AtData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const UniformTrackView<Float, const Float> a{0.0f, 2.0f, Values,
+        Math::lerp, data.extrapolationBefore, data.extrapolationAfter};
+    CORRADE_COMPARE(a.at(data.time), data.expectedValue);
+}
+
+void UniformTrackViewTest::atStrict() {
+    const auto& data = AtData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const UniformTrackView<Float, const Float> a{0.0f, 2.0f, Values,
+        Math::lerp, data.extrapolationBefore, data.extrapolationAfter};
+    CORRADE_COMPARE(a.atStrict(data.time), data.expectedValueStrict);
+}
+
+void UniformTrackViewTest::atSameAsTrackView() {
+    const auto& data = AtData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    constexpr Float keys[]{0.0f, 2.0f, 4.0f, 6.0f};
+    const TrackView<const Float, const Float> track{keys, Values,
+        Math::lerp, data.extrapolationBefore, data.extrapolationAfter};
+    const UniformTrackView<Float, const Float> a{0.0f, 2.0f, Values,
+        Math::lerp, data.extrapolationBefore, data.extrapolationAfter};
+
+    std::size_t hint{};
+    CORRADE_COMPARE(a.at(data.time), track.at(data.time));
+    CORRADE_COMPARE(a.atStrict(data.time), track.atStrict(data.time, hint));
+}
+
+void UniformTrackViewTest::atSingleKeyframe() {
+    const auto& data = SingleKeyframeData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const UniformTrackView<Float, const Float> a{2.0f, 1.0f,
+        Containers::arrayView(Values).prefix(1), Math::lerp,
+        data.extrapolation};
+    CORRADE_COMPARE(a.at(data.time), data.expectedValue);
+}
+
+void UniformTrackViewTest::atStrictInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const UniformTrackView<Float, const Float> a{2.0f, 1.0f,
+        Containers::arrayView(Values).prefix(1), Math::lerp};
+
+    Containers::String out;
+    Error redirectError{&out};
+    a.atStrict(3.0f);
+    CORRADE_COMPARE(out, "Animation::interpolateUniformStrict(): at least two keyframes required\n");
+}
+
+void UniformTrackViewTest::atIntegerKey() {
+    const UniformTrackView<Int, const Float> a{0, 48, Values, Math::lerp};
+    CORRADE_COMPARE(a.duration(), (Math::Range1D<Int>{0, 144}));
+    CORRADE_COMPARE(a.at(132), 1.0f);
+    CORRADE_COMPARE(a.atStrict(132), 1.0f);
+}
+
+void UniformTrackViewTest::atUnsignedIntegerKeyBefore() {
+    /* The frame is before the begin, which shouldn't wrap around and be
+       treated as extrapolation after the end */
+    const UniformTrackView<UnsignedInt, const Float> a{48, 48, Values, Math::lerp, Extrapolation::Extrapolated};
+    CORRADE_COMPARE(a.at(24), 4.0f);
+    CORRADE_COMPARE(a.at(0), 5.0f);
+    CORRADE_COMPARE(a.atStrict(24), 4.0f);
+    CORRADE_COMPARE(a.atStrict(0), 5.0f);
+}
+
+const Half HalfValues[]{3.0_h, 1.0_h, 2.5_h, 0.5_h};
+
+Float lerpHalf(const Half& a, const Half& b, Float t) {
+    return Math::lerp(Float(a), Float(b), t);
+}
+
+void UniformTrackViewTest::atDifferentResultType() {
+    const UniformTrackView<Float, const Half, Float> a{0.0f, 2.0f,
+        HalfValues, lerpHalf};
+    CORRADE_COMPARE(a.at(5.5f), 1.0f);
+    CORRADE_COMPARE(a.atStrict(5.5f), 1.0f);
+}
+
+/* Keys at 0, 1, 3 and 4, so resampling at a step of 1 and 0.5 gives exactly
+   the original values at the keyframes */
+constexpr Float ResampleKeys[]{0.0f, 1.0f, 3.0f, 4.0f};
+constexpr Float ResampleValues[]{2.0f, 4.0f, 0.0f, 1.0f};
+
+void UniformTrackViewTest::resampleInto() {
+    const TrackView<const Float, const Float> track{ResampleKeys,
+        ResampleValues, Math::lerp};
+
+    Float out[5];
+    Animation::resampleInto(track, -0.5f, 1.0f, Containers::stridedArrayView(out));
+    CORRADE_COMPARE_AS(Containers::arrayView(out), Containers::arrayView({
+        2.0f, /* constant extrapolation before */
+        3.0f,
+        3.0f,
+        1.0f,
+        0.5f
+    }), TestSuite::Compare::Container);
+}
+
+void UniformTrackViewTest::resample() {
+    const TrackView<const Float, const Float> track{ResampleKeys,
+        ResampleValues, Math::lerp};
+
+    Containers::Array<Float> out = Animation::resample(track, 0.5f);
+    CORRADE_COMPARE_AS(out, Containers::arrayView({
+        2.0f, 3.0f, 4.0f, 3.0f, 2.0f, 1.0f, 0.0f, 0.5f, 1.0f
+    }), TestSuite::Compare::Container);
+
+    /* Evaluating the uniform track gives the same results as the original
+       one at any point */
+    const UniformTrackView<Float, const Float> uniform{
+        track.duration().min(), 0.5f, Containers::stridedArrayView(out),
+        Math::lerp};
+    CORRADE_COMPARE(uniform.duration(), track.duration());
+    for(Float time: {-1.0f, 0.25f, 1.75f, 3.5f, 5.0f}) {
+        CORRADE_ITERATION(time);
+        CORRADE_COMPARE(uniform.at(time), track.at(time));
+    }
+}
+
+void UniformTrackViewTest::resampleTrack() {
+    const Track<Float, Vector3> track{{
+        {0.0f, Vector3{2.0f}},
+        {1.0f, Vector3{4.0f}},
+        {3.0f, Vector3{0.0f}}
+    }, Math::lerp};
+
+    Containers::Array<Vector3> out = Animation::resample(track, 1.0f);
+    CORRADE_COMPARE_AS(out, Containers::arrayView({
+        Vector3{2.0f}, Vector3{4.0f}, Vector3{2.0f}, Vector3{0.0f}
+    }), TestSuite::Compare::Container);
+
+    Vector3 outInto[2];
+    Animation::resampleInto(track, 0.5f, 2.0f, Containers::stridedArrayView(outInto));
+    CORRADE_COMPARE_AS(Containers::arrayView(outInto), Containers::arrayView({
+        Vector3{3.0f}, Vector3{1.0f}
+    }), TestSuite::Compare::Container);
+}
+
+void UniformTrackViewTest::resampleNotMultipleOfStep() {
+    const TrackView<const Float, const Float> track{ResampleKeys,
+        ResampleValues, Math::lerp};
+
+    /* The last sample is at 4.5, i.e. after the end of the track and thus
+       extrapolated */
+    Containers::Array<Float> out = Animation::resample(track, 1.5f);
+    CORRADE_COMPARE_AS(out, Containers::arrayView({
+        2.0f, 3.0f, 0.0f, 1.0f
+    }), TestSuite::Compare::Container);
+
+    /* A step that isn't exactly representable shouldn't result in an extra
+       sample due to a rounding error */
+    CORRADE_COMPARE(Animation::resample(track, 0.1f).size(), 41);
+    CORRADE_COMPARE(Animation::resample(track, 1.0f/30.0f).size(), 121);
+
+    /* A step for which the duration is just slightly more than a multiple of
+       it should still have the last sample not before the end */
+    const std::size_t count = Animation::resample(track, 0.099999f).size();
+    CORRADE_COMPARE(count, 42);
+    CORRADE_COMPARE_AS(Float(count - 1)*0.099999f, 4.0f,
+        TestSuite::Compare::GreaterOrEqual);
+}
+
+void UniformTrackViewTest::resamplePacked() {
+    const TrackView<const Float, const Float> track{ResampleKeys,
+        ResampleValues, Math::lerp};
+
+    /* Resample, scale to the [0, 1] range and pack to 16 bits */
+    Containers::Array<Float> resampled = Animation::resample(track, 0.5f);
+    for(Float& i: resampled) i *= 0.25f;
+    UnsignedShort packed[9];
+    CORRADE_COMPARE(resampled.size(), Containers::arraySize(packed));
+    Math::packInto(
+        Containers::arrayCast<2, const Float>(Containers::stridedArrayView(resampled)),
+        Containers::arrayCast<2, UnsignedShort>(Containers::stridedArrayView(packed)));
+
+    /* Evaluating the packed values with an unpacking interpolator gives the
+       same results as the original track, up to the packing precision */
+    const UniformTrackView<Float, const UnsignedShort, Float> uniform{
+        track.duration().min(), 0.5f, packed,
+        Animation::unpack<UnsignedShort, Float, Math::lerp, Math::unpack<Float>>()};
+    CORRADE_COMPARE(uniform.duration(), track.duration());
+    for(Float time: {-1.0f, 0.0f, 0.25f, 1.75f, 3.5f, 4.0f, 5.0f}) {
+        CORRADE_ITERATION(time);
+        CORRADE_COMPARE_WITH(uniform.at(time), track.at(time)*0.25f,
+            TestSuite::Compare::around(1.0e-4f));
+    }
+}
+
+void UniformTrackViewTest::resampleEmpty() {
+    const TrackView<const Float, const Float> track;
+    CORRADE_COMPARE(Animation::resample(track, 0.5f).size(), 0);
+}
+
+void UniformTrackViewTest::resampleInvalidStep() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const TrackView<const Float, const Float> track{ResampleKeys,
+        ResampleValues, Math::lerp};
+
+    Containers::String out;
+    Error redirectError{&out};
+    Animation::resample(track, 0.0f);
+    CORRADE_COMPARE(out, "Animation::resample(): expected a positive step\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Animation::Test::UniformTrackViewTest)
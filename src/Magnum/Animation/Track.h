@@ -106,6 +106,28 @@ instead of having data duplicated scattered across disjoint allocations of
 
 @snippet Animation.cpp Track-performance-cache
 
+@subsection Animation-Track-performance-batch Batch evaluation of many tracks
+
+When animating a large number of tracks that all share the same keyframe
+positions, such as bones of a skeleton sampled at a fixed rate, it's possible
+to store the values as a 2D array with one row per keyframe and one column per
+track and evaluate all tracks at once using @ref interpolateStrictInto() or
+@ref interpolateInto(). The keyframe search is then done just once for all
+tracks instead of once per track, and with a builtin @ref Interpolation the
+values are interpolated without an indirect function call for each of them:
+
+@snippet Animation.cpp Track-performance-batch
+
+@subsection Animation-Track-performance-uniform Uniform-rate tracks
+
+If the keyframes are at a fixed rate, or the track can be resampled to one,
+consider using a @ref UniformTrackView instead. It calculates the keyframe
+index directly from the time, which makes the evaluation cost constant
+regardless of the keyframe count and doesn't need any hint. It also doesn't
+need to store the keys. See @ref resample() for converting arbitrary tracks:
+
+@snippet Animation.cpp Track-performance-uniform
+
 @subsection Animation-Track-performance-interpolator Interpolator function choice
 
 The interpolator function has a direct effect on animation performance. You can
@@ -0,0 +1,473 @@
+#ifndef Magnum_Animation_UniformTrack_h
+#define Magnum_Animation_UniformTrack_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Animation::UniformTrackView, function @ref Magnum::Animation::interpolateUniform(), @ref Magnum::Animation::interpolateUniformStrict(), @ref Magnum::Animation::resampleInto(), @ref Magnum::Animation::resample()
+ * @m_since_latest
+ */
+
+#include "Magnum/Animation/Track.h"
+
+namespace Magnum { namespace Animation {
+
+/**
+@brief Interpolate a uniformly sampled animation value
+@tparam K           Key type
+@tparam V           Value type
+@tparam R           Result type
+@param begin        Key of the first value
+@param step         Distance between two successive values
+@param values       Values
+@param before       Extrapolation mode before first keyframe
+@param after        Extrapolation mode after last keyframe
+@param interpolator Interpolator function
+@param frame        Frame at which to interpolate
+@m_since_latest
+
+Equivalent to @ref interpolate() with keys being @p begin, @p begin + @p step,
+@p begin + 2 @p step etc., but instead of searching for the keyframe the index
+is calculated directly from @p frame, making the cost constant regardless of
+the keyframe count and without needing a search hint. Extrapolation, single
+keyframe and no keyframe behavior is the same as with @ref interpolate().
+
+Used internally from @ref UniformTrackView::at(), see its documentation for
+more information.
+@see @ref interpolateUniformStrict(), @ref resample()
+@experimental
+*/
+template<class K, class V, class R = ResultOf<V>> R interpolateUniform(K begin, K step, const Containers::StridedArrayView1D<const V>& values, Extrapolation before, Extrapolation after, R(*interpolator)(const V&, const V&, Float), K frame);
+
+/**
+@brief Interpolate a uniformly sampled animation value with strict constraints
+@m_since_latest
+
+A stricter but more performant version of @ref interpolateUniform() with
+implicit @ref Extrapolation::Extrapolated behavior. Expects that there are
+always at least two values.
+
+Used internally from @ref UniformTrackView::atStrict(), see its documentation
+for more information.
+@experimental
+*/
+template<class K, class V, class R = ResultOf<V>> R interpolateUniformStrict(K begin, K step, const Containers::StridedArrayView1D<const V>& values, R(*interpolator)(const V&, const V&, Float), K frame);
+
+/**
+@brief Uniformly sampled animation track view
+@tparam K       Key type
+@tparam V       Value type
+@tparam R       Result type
+@m_since_latest
+
+Compared to @ref TrackView, where each value has an explicit key, values in
+this view are sampled at a fixed rate, i.e. the first value is at
+@ref begin(), the second at @ref begin() + @ref step() and so on. This allows
+@ref at() to calculate the keyframe index directly from the time instead of
+performing a linear search, which makes the evaluation cost constant
+regardless of the keyframe count and removes the need for a search hint. It
+also removes the need to store the keys altogether.
+
+@section Animation-UniformTrackView-resampling Resampling existing tracks
+
+Tracks with arbitrary keyframe positions, such as tracks coming from
+@ref Trade::AnimationData::track(), can be converted to a uniform rate using
+@ref resample() or @ref resampleInto():
+
+@snippet Animation.cpp UniformTrackView-resample
+
+The resampling is lossless only if the original keyframes lie at multiples
+of the chosen step, in other cases the higher the rate is, the closer is the
+result to the original track, at a cost of higher memory use.
+
+@section Animation-UniformTrackView-quantization Quantized values
+
+Similarly to @ref Track and @ref TrackView, the value type doesn't need to be
+the same as the result type. The resampled values can thus be packed to a
+smaller type using functions from @ref Magnum/Math/PackingBatch.h and
+unpacked on the fly using @ref unpack() or @ref unpackEase(), further reducing
+the memory footprint.
+
+@experimental
+*/
+template<class K, class V, class R
+    #ifdef DOXYGEN_GENERATING_OUTPUT
+    = ResultOf<V>
+    #endif
+> class UniformTrackView {
+    static_assert(!std::is_const<K>::value && !std::is_const<R>::value,
+        "K and R shouldn't be const");
+
+    public:
+        /** @brief Key type */
+        typedef K KeyType;
+
+        /** @brief Value type */
+        typedef V ValueType;
+
+        /** @brief Animation result type */
+        typedef R ResultType;
+
+        /** @brief Interpolation function */
+        typedef ResultType(*Interpolator)(const ValueType&, const ValueType&, Float);
+
+        /**
+         * @brief Construct an empty track
+         *
+         * The @ref values() and @ref interpolator() functions return
+         * @cpp nullptr @ce, @ref at() always returns a default-constructed
+         * value.
+         */
+        /*implicit*/ UniformTrackView() noexcept: _begin{}, _step{}, _interpolator{}, _interpolation{}, _before{}, _after{} {}
+
+        /**
+         * @brief Construct with custom interpolator
+         * @param begin         Key of the first value
+         * @param step          Distance between two successive values,
+         *      expected to be positive
+         * @param values        Frame values
+         * @param interpolator  Interpolation function
+         * @param before        Extrapolation behavior before
+         * @param after         Extrapolation behavior after
+         *
+         * The @ref interpolation() field is set to @ref Interpolation::Custom.
+         */
+        /*implicit*/ UniformTrackView(K begin, K step, const Containers::StridedArrayView1D<V>& values, Interpolator interpolator, Extrapolation before, Extrapolation after) noexcept: UniformTrackView<K, V, R>{begin, step, values, Interpolation::Custom, interpolator, before, after} {}
+
+        /** @overload
+         * Equivalent to calling @ref UniformTrackView(K, K, const Containers::StridedArrayView1D<V>&, Interpolator, Extrapolation, Extrapolation)
+         * with both @p before and @p after set to @p extrapolation.
+         */
+        /*implicit*/ UniformTrackView(K begin, K step, const Containers::StridedArrayView1D<V>& values, Interpolator interpolator, Extrapolation extrapolation = Extrapolation::Constant) noexcept: UniformTrackView<K, V, R>{begin, step, values, interpolator, extrapolation, extrapolation} {}
+
+        /**
+         * @brief Construct with both generic and custom interpolator
+         * @param begin         Key of the first value
+         * @param step          Distance between two successive values,
+         *      expected to be positive
+         * @param values        Frame values
+         * @param interpolation Interpolation behavior
+         * @param interpolator  Interpolator function
+         * @param before        Extrapolation behavior before
+         * @param after         Extrapolation behavior after
+         *
+         * @p interpolation acts as a behavior hint to users that might want to
+         * supply their own interpolator function to @ref at() or
+         * @ref atStrict().
+         */
+        /*implicit*/ UniformTrackView(K begin, K step, const Containers::StridedArrayView1D<V>& values, Interpolation interpolation, Interpolator interpolator, Extrapolation before, Extrapolation after) noexcept: _begin{begin}, _step{step}, _values{values}, _interpolator{interpolator}, _interpolation{interpolation}, _before{before}, _after{after} {
+            CORRADE_ASSERT(step > K{}, "Animation::UniformTrackView: expected a positive step", );
+        }
+
+        /** @overload
+         * Equivalent to calling @ref UniformTrackView(K, K, const Containers::StridedArrayView1D<V>&, Interpolation, Interpolator, Extrapolation, Extrapolation)
+         * with both @p before and @p after set to @p extrapolation.
+         */
+        /*implicit*/ UniformTrackView(K begin, K step, const Containers::StridedArrayView1D<V>& values, Interpolation interpolation, Interpolator interpolator, Extrapolation extrapolation = Extrapolation::Constant) noexcept: UniformTrackView<K, V, R>{begin, step, values, interpolation, interpolator, extrapolation, extrapolation} {}
+
+        /**
+         * @brief Construct with generic interpolation behavior
+         * @param begin         Key of the first value
+         * @param step          Distance between two successive values,
+         *      expected to be positive
+         * @param values        Frame values
+         * @param interpolation Interpolation behavior
+         * @param before        Extrapolation behavior before
+         * @param after         Extrapolation behavior after
+         *
+         * The @ref interpolator() function is autodetected from
+         * @p interpolation using @ref interpolatorFor(). See its documentation
+         * for more information.
+         */
+        /*implicit*/ UniformTrackView(K begin, K step, const Containers::StridedArrayView1D<V>& values, Interpolation interpolation, Extrapolation before, Extrapolation after) noexcept: UniformTrackView<K, V, R>{begin, step, values, interpolation, interpolatorFor<typename std::remove_const<V>::type, R>(interpolation), before, after} {}
+
+        /** @overload
+         * Equivalent to calling @ref UniformTrackView(K, K, const Containers::StridedArrayView1D<V>&, Interpolation, Extrapolation, Extrapolation)
+         * with both @p before and @p after set to @p extrapolation.
+         */
+        /*implicit*/ UniformTrackView(K begin, K step, const Containers::StridedArrayView1D<V>& values, Interpolation interpolation, Extrapolation extrapolation = Extrapolation::Constant) noexcept: UniformTrackView<K, V, R>{begin, step, values, interpolation, extrapolation, extrapolation} {}
+
+        /** @brief Convert a mutable view to a const one */
+        template<class V2
+            #ifndef DOXYGEN_GENERATING_OUTPUT
+            , typename std::enable_if<std::is_same<const V2, V>::value, int>::type = 0
+            #endif
+        > /*implicit*/ UniformTrackView(const UniformTrackView<K, V2, R>& other) noexcept: _begin{other._begin}, _step{other._step}, _values{other._values}, _interpolator{other._interpolator}, _interpolation{other._interpolation}, _before{other._before}, _after{other._after} {}
+
+        /**
+         * @brief Interpolation behavior
+         *
+         * Acts as a behavior hint to users that might want to supply their own
+         * interpolator function to @ref at() or @ref atStrict().
+         * @see @ref interpolator()
+         */
+        Interpolation interpolation() const { return _interpolation; }
+
+        /**
+         * @brief Interpolation function
+         *
+         * @see @ref interpolation()
+         */
+        Interpolator interpolator() const { return _interpolator; }
+
+        /**
+         * @brief Extrapolation behavior before first keyframe
+         *
+         * @see @ref after(), @ref at()
+         */
+        Extrapolation before() const { return _before; }
+
+        /**
+         * @brief Extrapolation behavior after last keyframe
+         *
+         * @see @ref before(), @ref at()
+         */
+        Extrapolation after() const { return _after; }
+
+        /** @brief Key of the first value */
+        K begin() const { return _begin; }
+
+        /** @brief Distance between two successive values */
+        K step() const { return _step; }
+
+        /**
+         * @brief Duration of the track
+         *
+         * Calculated from @ref begin(), @ref step() and @ref size(). If there
+         * are no values, a default-constructed value is returned.
+         */
+        Math::Range1D<K> duration() const {
+            return _values.isEmpty() ? Math::Range1D<K>{} : Math::Range1D<K>{_begin, _begin + K(_values.size() - 1)*_step};
+        }
+
+        /** @brief Keyframe count */
+        std::size_t size() const { return _values.size(); }
+
+        /**
+         * @brief Value data
+         *
+         * @see @ref key()
+         */
+        Containers::StridedArrayView1D<V> values() const { return _values; }
+
+        /**
+         * @brief Key of given keyframe
+         *
+         * Equivalent to @ref begin() + @p i * @ref step(). The @p i is not
+         * required to be in bounds.
+         */
+        K key(std::size_t i) const { return _begin + K(i)*_step; }
+
+        /**
+         * @brief Animated value at a given time
+         *
+         * Calls @ref interpolateUniform(), see its documentation for more
+         * information.
+         * @see @ref atStrict(K) const, @ref at(Interpolator, K) const
+         */
+        R at(K frame) const {
+            return at(_interpolator, frame);
+        }
+
+        /**
+         * @brief Animated value at a given time
+         *
+         * Unlike @ref at(K) const calls @ref interpolateUniform() with
+         * @p interpolator, overriding the interpolator function set in
+         * constructor. See its documentation for more information.
+         * @see @ref atStrict(Interpolator, K) const
+         */
+        R at(Interpolator interpolator, K frame) const {
+            return interpolateUniform<K, typename std::remove_const<V>::type, R>(_begin, _step, _values, _before, _after, interpolator, frame);
+        }
+
+        /**
+         * @brief Animated value at a given time
+         *
+         * A faster version of @ref at(K) const with some restrictions. Calls
+         * @ref interpolateUniformStrict(), see its documentation for more
+         * information.
+         * @see @ref atStrict(Interpolator, K) const
+         */
+        R atStrict(K frame) const {
+            return atStrict(_interpolator, frame);
+        }
+
+        /**
+         * @brief Animated value at a given time
+         *
+         * Unlike @ref atStrict(K) const calls @ref interpolateUniformStrict()
+         * with @p interpolator, overriding the interpolator function set in
+         * constructor. See its documentation for more information.
+         * @see @ref at(Interpolator, K) const
+         */
+        R atStrict(Interpolator interpolator, K frame) const {
+            return interpolateUniformStrict<K, typename std::remove_const<V>::type, R>(_begin, _step, _values, interpolator, frame);
+        }
+
+    private:
+        template<class, class, class> friend class UniformTrackView;
+
+        K _begin, _step;
+        Containers::StridedArrayView1D<V> _values;
+        Interpolator _interpolator;
+        Interpolation _interpolation;
+        Extrapolation _before, _after;
+};
+
+/**
+@brief Resample a track to a uniform rate into given output
+@param track        Track to resample
+@param begin        Key of the first sample
+@param step         Distance between two successive samples
+@param destination  Where to put the resampled values
+@m_since_latest
+
+Evaluates @p track at @p begin, @p begin + @p step, @p begin + 2 @p step etc.
+for every item of @p destination, using the interpolator and extrapolation
+behavior the track was created with. The result can be then used in a
+@ref UniformTrackView with the same @p begin and @p step.
+@see @ref resample()
+@experimental
+*/
+template<class K, class V, class R> void resampleInto(const TrackView<const K, const V, R>& track, K begin, K step, const Containers::StridedArrayView1D<R>& destination) {
+    std::size_t hint{};
+    for(std::size_t i = 0, max = destination.size(); i != max; ++i)
+        destination[i] = track.at(begin + K(i)*step, hint);
+}
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+template<class K, class V, class R> void resampleInto(const Track<K, V, R>& track, K begin, K step, const Containers::StridedArrayView1D<R>& destination) {
+    resampleInto(TrackView<const K, const V, R>{track}, begin, step, destination);
+}
+
+/**
+@brief Resample a track to a uniform rate
+@param track        Track to resample
+@param step         Distance between two successive samples, expected to be
+    positive
+@m_since_latest
+
+Samples the whole @ref TrackView::duration() "duration" of @p track, the
+first sample is at its beginning and the number of samples is chosen so the
+last sample is not before the end of the track. If the duration is not a
+multiple of @p step, the last sample is thus evaluated with the
+after-extrapolation of @p track. If the track is empty, an empty array is
+returned. Create a @ref UniformTrackView with @p step and the beginning of the
+track duration as the first key to evaluate the result. See
+@ref resampleInto() for a variant that allows choosing the sample range.
+@experimental
+*/
+template<class K, class V, class R> Containers::Array<R> resample(const TrackView<const K, const V, R>& track, K step) {
+    CORRADE_ASSERT(step > K{}, "Animation::resample(): expected a positive step", {});
+
+    if(!track.size()) return {};
+
+    const Math::Range1D<K> duration = track.duration();
+    /* Round up so the last sample is never before the end. If the duration
+       is a multiple of the step, a floating-point error could add an extra
+       sample, so drop it if the one before is already not before the end.
+       Conversely, make sure the error doesn't put the last sample before the
+       end. Both checks are done on the keys the same way resampleInto()
+       calculates them. */
+    std::size_t count = std::size_t(Math::ceil(Float(duration.size())/Float(step)));
+    if(count && duration.min() + K(count - 1)*step >= duration.max())
+        --count;
+    if(duration.min() + K(count)*step < duration.max())
+        ++count;
+
+    Containers::Array<R> out{count + 1};
+    resampleInto(track, duration.min(), step, Containers::stridedArrayView(out));
+    return out;
+}
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+template<class K, class V, class R> Containers::Array<R> resample(const Track<K, V, R>& track, K step) {
+    return resample(TrackView<const K, const V, R>{track}, step);
+}
+
+namespace Implementation {
+    /* Position of `frame` in units of `step` relative to `begin`. Not
+       calculating `frame - begin` directly as it would wrap around for
+       unsigned keys before `begin`, and not converting both to a Float first
+       to not lose precision for large Double or integer keys. */
+    template<class K> Float uniformPosition(const K begin, const K step, const K frame) {
+        return (frame < begin ? -Float(begin - frame) : Float(frame - begin))/Float(step);
+    }
+}
+
+template<class K, class V, class R> R interpolateUniform(const K begin, const K step, const Containers::StridedArrayView1D<const V>& values, const Extrapolation before, const Extrapolation after, R(*const interpolator)(const V&, const V&, Float), const K frame) {
+    /* No data, return default-constructed value */
+    if(!values.size()) return {};
+
+    /* Only one frame, return it verbatim (or default-constructed, if desired) */
+    if(values.size() == 1) {
+        if((frame < begin && before == Extrapolation::DefaultConstructed) ||
+           (frame > begin && after == Extrapolation::DefaultConstructed))
+            return {};
+
+        return interpolator(values[0], values[0], 0.0f);
+    }
+
+    /* Calculate the position directly instead of searching for the keyframe.
+       Special extrapolation outside of range is handled the same way as in
+       interpolate(). */
+    const Float position = Implementation::uniformPosition(begin, step, frame);
+    const std::size_t last = values.size() - 1;
+    if(position < 0.0f) {
+        if(before == Extrapolation::DefaultConstructed) return {};
+        return interpolator(values[0], values[1],
+            before == Extrapolation::Constant ? 0.0f : position);
+    }
+    if(position >= Float(last)) {
+        if(after == Extrapolation::DefaultConstructed) return {};
+        return interpolator(values[last - 1], values[last],
+            after == Extrapolation::Constant ? 1.0f : position - Float(last - 1));
+    }
+
+    const std::size_t i = std::size_t(position);
+    return interpolator(values[i], values[i + 1], position - Float(i));
+}
+
+template<class K, class V, class R> R interpolateUniformStrict(const K begin, const K step, const Containers::StridedArrayView1D<const V>& values, R(*const interpolator)(const V&, const V&, Float), const K frame) {
+    CORRADE_ASSERT(values.size() >= 2, "Animation::interpolateUniformStrict(): at least two keyframes required", {});
+
+    const Float position = Implementation::uniformPosition(begin, step, frame);
+    /* Clamping to the first and last pair of keyframes, values outside are
+       extrapolated */
+    const std::size_t i = position < 1.0f ? 0 : Math::min(std::size_t(position), values.size() - 2);
+    return interpolator(values[i], values[i + 1], position - Float(i));
+}
+
+}}
+
+#endif
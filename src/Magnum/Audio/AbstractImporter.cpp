@@ -33,10 +33,13 @@
 #include <Corrade/Containers/String.h>
 #include <Corrade/Containers/StringStl.h> /** @todo remove once AbstractImporter is <string>-free */
 #include <Corrade/PluginManager/Manager.hpp>
+#include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/Assert.h>
 #include <Corrade/Utility/DebugStl.h> /** @todo remove once AbstractImporter is <string>-free */
 #include <Corrade/Utility/Path.h>
 
+#include "Magnum/Math/Functions.h"
+
 #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
 #include "Magnum/Audio/configure.h"
 #endif
@@ -141,6 +144,36 @@ Containers::Array<char> AbstractImporter::data() {
     return out;
 }
 
+std::size_t AbstractImporter::dataSize() {
+    CORRADE_ASSERT(isOpened(), "Audio::AbstractImporter::dataSize(): no file opened", {});
+    return doDataSize();
+}
+
+std::size_t AbstractImporter::doDataSize() {
+    return doData().size();
+}
+
+std::size_t AbstractImporter::dataInto(const std::size_t offset, const Containers::ArrayView<char> out) {
+    CORRADE_ASSERT(isOpened(), "Audio::AbstractImporter::dataInto(): no file opened", {});
+    #ifndef CORRADE_NO_ASSERT
+    const std::size_t size = doDataSize();
+    #endif
+    CORRADE_ASSERT(offset <= size,
+        "Audio::AbstractImporter::dataInto(): offset" << offset << "out of range for" << size << "bytes", {});
+
+    const std::size_t written = doDataInto(offset, out);
+    CORRADE_ASSERT(written <= out.size() && offset + written <= size,
+        "Audio::AbstractImporter::dataInto(): implementation wrote" << written << "bytes at offset" << offset << "into" << out.size() << "bytes out of" << size, {});
+    return written;
+}
+
+std::size_t AbstractImporter::doDataInto(const std::size_t offset, const Containers::ArrayView<char> out) {
+    const Containers::Array<char> data = doData();
+    const std::size_t size = Math::min(out.size(), data.size() - offset);
+    Utility::copy(data.sliceSize(offset, size), out.prefix(size));
+    return size;
+}
+
 Debug& operator<<(Debug& debug, const ImporterFeature value) {
     const bool packed = debug.immediateFlags() >= Debug::Flag::Packed;
 
@@ -81,11 +81,29 @@ around in order to have the returned data valid. Moreover, all returned
 deleters --- this is to avoid potential dangling function pointer calls when
 destructing such instances after the plugin module has been unloaded.
 
+@section Audio-AbstractImporter-streaming Streaming the data
+
+Besides getting the whole data at once using @ref data(), it's possible to
+retrieve them in smaller chunks with @ref dataInto(), which writes the data
+starting at given offset into a caller-provided view. Together with
+@ref dataSize() this allows to for example play long music tracks without
+having to keep them fully decoded in memory, see @ref Streamer for a ready-made
+implementation:
+
+@snippet Audio.cpp AbstractImporter-dataInto
+
+Whether this actually avoids keeping the whole data in memory depends on the
+plugin. Plugins that don't implement chunked access decode the whole data on
+each call, which is correct but slow.
+
 @section Audio-AbstractImporter-subclassing Subclassing
 
 Plugin implements function @ref doFeatures(), @ref doIsOpened(), one of or both
 @ref doOpenData() and @ref doOpenFile() functions, function @ref doClose() and
 data access functions @ref doFormat(), @ref doFrequency() and @ref doData().
+Plugins that are able to decode the data incrementally can additionally
+implement @ref doDataSize() and @ref doDataInto(), the default implementations
+go through @ref doData().
 
 You don't need to do most of the redundant sanity checks, these things are
 checked by the implementation:
@@ -97,6 +115,8 @@ checked by the implementation:
     is supported.
 -   All `do*()` implementations working on opened file are called only if
     there is any file opened.
+-   Function @ref doDataInto() is called only if the offset is not larger
+    than @ref dataSize().
 
 @m_class{m-block m-warning}
 
@@ -198,9 +218,41 @@ class MAGNUM_AUDIO_EXPORT AbstractImporter: public PluginManager::AbstractManagi
         /** @brief Sample frequency */
         UnsignedInt frequency() const;
 
-        /** @brief Sample data */
+        /**
+         * @brief Sample data
+         *
+         * @see @ref dataInto()
+         */
         Containers::Array<char> data();
 
+        /**
+         * @brief Sample data size
+         * @m_since_latest
+         *
+         * Size of the whole sample data in bytes, i.e. size of the array
+         * returned by @ref data().
+         * @see @ref dataInto()
+         */
+        std::size_t dataSize();
+
+        /**
+         * @brief Put a chunk of sample data into a view
+         * @param offset    Offset into the sample data, in bytes
+         * @param out       Where to put the data
+         * @return Count of bytes written to @p out
+         * @m_since_latest
+         *
+         * Writes sample data starting at @p offset to @p out. Returns
+         * size of @p out, or less if the end of the data was reached.
+         * Expects that @p offset is not larger than @ref dataSize(). The
+         * @p offset and the size of @p out should be a multiple of the sample
+         * frame size for given @ref format() in order to be able to use the
+         * chunks as separate buffers. See
+         * @ref Audio-AbstractImporter-streaming for more information.
+         * @see @ref data()
+         */
+        std::size_t dataInto(std::size_t offset, Containers::ArrayView<char> out);
+
         /* Since 1.8.17, the original short-hand group closing doesn't work
            anymore. FFS. */
         /**
@@ -237,6 +289,24 @@ class MAGNUM_AUDIO_EXPORT AbstractImporter: public PluginManager::AbstractManagi
 
         /** @brief Implementation for @ref data() */
         virtual Containers::Array<char> doData() = 0;
+
+        /**
+         * @brief Implementation for @ref dataSize()
+         * @m_since_latest
+         *
+         * Default implementation returns size of the array returned from
+         * @ref doData().
+         */
+        virtual std::size_t doDataSize();
+
+        /**
+         * @brief Implementation for @ref dataInto()
+         * @m_since_latest
+         *
+         * Default implementation copies the corresponding slice of the array
+         * returned from @ref doData().
+         */
+        virtual std::size_t doDataInto(std::size_t offset, Containers::ArrayView<char> out);
 };
 
 /**
@@ -257,7 +327,7 @@ updated interface string.
 */
 /* Silly indentation to make the string appear in pluginInterface() docs */
 #define MAGNUM_AUDIO_ABSTRACTIMPORTER_PLUGIN_INTERFACE /* [interface] */ \
-"cz.mosra.magnum.Audio.AbstractImporter/0.1"
+"cz.mosra.magnum.Audio.AbstractImporter/0.2"
 /* [interface] */
 
 }}
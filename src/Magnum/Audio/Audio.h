@@ -44,6 +44,7 @@ enum class BufferFormat: ALenum;
 class Buffer;
 class Context;
 class Source;
+class Streamer;
 /* Renderer used only statically */
 
 template<UnsignedInt> class Playable;
@@ -61,7 +61,8 @@ template<UnsignedInt dimensions> void Listener<dimensions>::clean(const MatrixTy
     /* Only clean if this Listener is active */
     if(!isActive()) return;
 
-    Renderer::setListenerPosition(_soundTransformation.transformVector(Vector3::pad(absoluteTransformationMatrix.translation())));
+    _position = _soundTransformation.transformVector(Vector3::pad(absoluteTransformationMatrix.translation()));
+    Renderer::setListenerPosition(_position);
 
     const Vector3 fwd = _soundTransformation.transformVector(-padMatrix4(absoluteTransformationMatrix).backward());
     const Vector3 up = _soundTransformation.transformVector(padMatrix4(absoluteTransformationMatrix).up());
@@ -85,19 +86,25 @@ template<UnsignedInt dimensions> void Listener<dimensions>::update(std::initiali
         Renderer::setListenerGain(_gain);
     }
 
-    /* Add all objects of the Playables in the PlayableGroups to a vector to
-       later setClean() */
-    std::vector<std::reference_wrapper<SceneGraph::AbstractObject<dimensions, Float>>> objects;
-
-    objects.push_back(this->object());
+    /* Add all dirty objects of the Playables in the PlayableGroups to a
+       vector to later setClean(). Clearing the vector keeps its capacity, so
+       this doesn't allocate once it's large enough. */
+    _objects.clear();
+    if(this->object().isDirty())
+        _objects.push_back(this->object());
     for(PlayableGroup<dimensions>& group: groups) {
         for(std::size_t i = 0; i != group.size(); ++i) {
-            objects.push_back(group[i].object());
+            if(group[i].object().isDirty())
+                _objects.push_back(group[i].object());
         }
     }
 
-    /* Use the more performant way to set multiple objects clean */
-    SceneGraph::AbstractObject<dimensions, Float>::setClean(objects);
+    /* Use the more performant way to set multiple objects clean. This only
+       records the changes in the Playables, the sources are updated after. */
+    SceneGraph::AbstractObject<dimensions, Float>::setClean(_objects);
+
+    for(PlayableGroup<dimensions>& group: groups)
+        group.update(_position);
 }
 
 template<UnsignedInt dimensions> Listener<dimensions>& Listener<dimensions>::setGain(const Float gain) {
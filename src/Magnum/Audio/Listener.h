@@ -31,6 +31,9 @@
  * @brief Class @ref Magnum::Audio::Listener, @ref Magnum::Audio::Listener2D, @ref Magnum::Audio::Listener3D
  */
 
+#include <functional>
+#include <vector>
+
 #include "Magnum/Audio/Audio.h"
 #include "Magnum/Audio/visibility.h"
 #include "Magnum/Math/Matrix4.h"
@@ -115,10 +118,13 @@ template<UnsignedInt dimensions> class Listener: public SceneGraph::AbstractFeat
          *
          * Makes this instance the active listener and calls
          * @ref SceneGraph::AbstractObject::setClean() on its parent object and
-         * all objects of the @ref Playable "Playables" in the group to reflect
-         * transformation changes to spatial audio behavior. Also updates
-         * listener-related configuration for @ref Renderer (position,
-         * orientation, gain).
+         * all dirty objects of the @ref Playable "Playables" in the group to
+         * reflect transformation changes to spatial audio behavior. Also
+         * updates listener-related configuration for @ref Renderer (position,
+         * orientation, gain). Sources of the playables are then updated in a
+         * batch, skipping the ones that didn't change or can't be heard, see
+         * @ref Audio-PlayableGroup-culling for more information. Memory used
+         * for the batch is reused across calls.
          */
         void update(std::initializer_list<Containers::Reference<PlayableGroup<dimensions>>> groups);
 
@@ -141,7 +147,11 @@ template<UnsignedInt dimensions> class Listener: public SceneGraph::AbstractFeat
         MAGNUM_AUDIO_LOCAL void clean(const MatrixTypeFor<dimensions, Float>& absoluteTransformationMatrix) override;
 
         Matrix4 _soundTransformation;
+        /* Position in the sound space, as last calculated in clean() */
+        Vector3 _position;
         Float _gain;
+        /* Temporary memory for update(), reused across calls */
+        std::vector<std::reference_wrapper<SceneGraph::AbstractObject<dimensions, Float>>> _objects;
 };
 
 /**
@@ -33,6 +33,16 @@
 
 namespace Magnum { namespace Audio {
 
+namespace {
+
+/* Vector3::operator==() is fuzzy, which would make slow continuous movement
+   never propagate to the source */
+bool exactlyEqual(const Vector3& a, const Vector3& b) {
+    return a.x() == b.x() && a.y() == b.y() && a.z() == b.z();
+}
+
+}
+
 template<UnsignedInt dimensions> Playable<dimensions>::Playable(SceneGraph::AbstractObject<dimensions, Float>& object, const VectorTypeFor<dimensions, Float>& direction, PlayableGroup<dimensions>* group): SceneGraph::AbstractGroupedFeature<dimensions, Playable<dimensions>, Float>(object, group), _direction{direction}, _gain{1.0f} {
     SceneGraph::AbstractFeature<dimensions, Float>::setCachedTransformations(SceneGraph::CachedTransformation::Absolute);
 }
@@ -49,13 +59,31 @@ template<UnsignedInt dimensions> void Playable<dimensions>::clean(const MatrixTy
     Vector3 position = Vector3::pad(absoluteTransformationMatrix.translation());
     if(playables())
         position = playables()->soundTransformation().transformVector(position);
-
-    _source.setPosition(position);
-    _source.setDirection(Vector3::pad(absoluteTransformationMatrix.rotation()*_direction));
+    const Vector3 direction = Vector3::pad(absoluteTransformationMatrix.rotation()*_direction);
+
+    /* Remember just what changed, the OpenAL calls are comparatively
+       expensive */
+    if(!exactlyEqual(position, _sourcePosition)) {
+        _sourcePosition = position;
+        _positionChanged = true;
+    }
+    if(!exactlyEqual(direction, _sourceDirection)) {
+        _sourceDirection = direction;
+        _directionChanged = true;
+    }
+
+    /* Grouped playables get updated in a batch from PlayableGroup::update() */
+    if(!playables()) cleanSource();
 
     /** @todo velocity */
 }
 
+template<UnsignedInt dimensions> void Playable<dimensions>::cleanSource() {
+    if(_positionChanged) _source.setPosition(_sourcePosition);
+    if(_directionChanged) _source.setDirection(_sourceDirection);
+    _positionChanged = _directionChanged = false;
+}
+
 template<UnsignedInt dimensions> PlayableGroup<dimensions>* Playable<dimensions>::playables() {
     return static_cast<PlayableGroup<dimensions>*>(this->group());
 }
@@ -65,7 +93,12 @@ template<UnsignedInt dimensions> const PlayableGroup<dimensions>* Playable<dimen
 }
 
 template<UnsignedInt dimensions> void Playable<dimensions>::cleanGain() {
-    _source.setGain(playables() ? _gain*playables()->gain() : _gain);
+    /* The culled state is maintained only by the group. If the playable was
+       removed from it, the state is stale, so reset it. */
+    if(!playables()) {
+        _culled = false;
+        _source.setGain(_gain);
+    } else _source.setGain(_culled ? 0.0f : _gain*playables()->gain());
 }
 
 /* On non-MinGW Windows the instantiations are already marked with extern
@@ -71,6 +71,18 @@ you have to use other means to update them:
     @ref Playable gain and updated on every call to @ref setGain() or
     @ref PlayableGroup::setGain().
 
+@section Audio-Playable-batching Batched source updates
+
+Source position and direction are updated only if they changed since the last
+time. For playables that are a part of a @ref PlayableGroup, the changes are
+not passed to the source directly when the object gets cleaned, but only at
+the end of @ref Listener::update(), for all playables of given group at once.
+That's also where playables that are inaudible are culled --- sources of
+playables with a zero gain or further than
+@ref PlayableGroup::setCullDistance() "the cull distance" from the listener
+don't have their position updated until they become audible again. See
+@ref Audio-PlayableGroup-culling for more information.
+
 @see @ref Playable2D, @ref Playable3D
 */
 template<UnsignedInt dimensions> class Playable: public SceneGraph::AbstractGroupedFeature<dimensions, Playable<dimensions>, Float> {
@@ -133,12 +145,25 @@ template<UnsignedInt dimensions> class Playable: public SceneGraph::AbstractGrou
         MAGNUM_AUDIO_LOCAL void clean(const MatrixTypeFor<dimensions, Float>& absoluteTransformationMatrix) override;
 
         /* Updates the gain of the underlying source to reflect changes in
-           _group and/or _gain. Called from setGain() and
-           PlayableGroup::setGain() */
+           _group, _gain and/or _culled. Called from setGain(),
+           PlayableGroup::setGain() and PlayableGroup::update() */
         MAGNUM_AUDIO_LOCAL void cleanGain();
 
+        /* Passes position and direction changes recorded by clean() to the
+           source. Called from clean() for playables without a group and from
+           PlayableGroup::update() otherwise */
+        MAGNUM_AUDIO_LOCAL void cleanSource();
+
         VectorTypeFor<dimensions, Float> _direction;
         Float _gain;
+        /* Position and direction in the sound space, as last calculated in
+           clean() */
+        Vector3 _sourcePosition, _sourceDirection;
+        bool _positionChanged{}, _directionChanged{};
+        /* Whether the playable was culled by distance in
+           PlayableGroup::update(). Ignored and reset by cleanGain() if the
+           playable isn't in any group. */
+        bool _culled{};
         Source _source;
 };
 
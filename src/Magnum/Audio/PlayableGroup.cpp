@@ -29,6 +29,7 @@
 
 #include "Magnum/Audio/Playable.h"
 #include "Magnum/Audio/Source.h"
+#include "Magnum/Math/Constants.h"
 #include "Magnum/SceneGraph/AbstractObject.h"
 
 namespace Magnum { namespace Audio {
@@ -45,7 +46,7 @@ template<UnsignedInt dimensions> std::vector<std::reference_wrapper<Source>> sou
 
 }
 
-template<UnsignedInt dimensions> PlayableGroup<dimensions>::PlayableGroup(): SceneGraph::FeatureGroup<dimensions, Playable<dimensions>, Float>(), _gain{1.0f} {}
+template<UnsignedInt dimensions> PlayableGroup<dimensions>::PlayableGroup(): SceneGraph::FeatureGroup<dimensions, Playable<dimensions>, Float>(), _gain{1.0f}, _cullDistance{Constants::inf()} {}
 
 template<UnsignedInt dimensions> PlayableGroup<dimensions>::~PlayableGroup() = default;
 
@@ -84,6 +85,32 @@ template<UnsignedInt dimensions> PlayableGroup<dimensions>& PlayableGroup<dimens
     return *this;
 }
 
+template<UnsignedInt dimensions> PlayableGroup<dimensions>& PlayableGroup<dimensions>::setCullDistance(const Float distance) {
+    _cullDistance = distance;
+    return *this;
+}
+
+template<UnsignedInt dimensions> void PlayableGroup<dimensions>::update(const Vector3& listenerPosition) {
+    /* Infinity squared is still infinity, so with the default nothing gets
+       culled */
+    const Float cullDistanceSquared = _cullDistance*_cullDistance;
+    for(std::size_t i = 0; i != this->size(); ++i) {
+        Playable<dimensions>& playable = (*this)[i];
+
+        /* Mute or unmute the source if it crossed the cull distance */
+        const bool culled = (playable._sourcePosition - listenerPosition).dot() > cullDistanceSquared;
+        if(culled != playable._culled) {
+            playable._culled = culled;
+            playable.cleanGain();
+        }
+
+        /* Inaudible sources keep their changes recorded for later */
+        if(culled || playable._gain*_gain == 0.0f) continue;
+
+        playable.cleanSource();
+    }
+}
+
 /* On non-MinGW Windows the instantiations are already marked with extern
    template. However Clang-CL doesn't propagate the export from the extern
    template, it seems. */
@@ -45,6 +45,27 @@ namespace Magnum { namespace Audio {
 Manages a group of @ref Playable instances with an ability to control gain,
 transformation or state for all of them at once. See @ref Playable and
 @ref Listener documentation for more information.
+
+@section Audio-PlayableGroup-culling Batched updates and culling
+
+When the group is passed to @ref Listener::update(), transformations of all
+objects that changed since the last update are calculated in a single batch
+and position and direction of the corresponding sources is updated only if it
+actually changed. Sources that can't be heard are culled before that, which
+means their position isn't updated until they become audible again:
+
+-   Sources of playables with a zero gain, either because of
+    @ref Playable::setGain() or @ref setGain(), are not updated.
+-   If @ref setCullDistance() is set, sources of playables that are further
+    than given distance from the listener are muted and not updated until
+    they get closer again. This is useful for example with
+    @ref Renderer::DistanceModel::InverseClamped or
+    @ref Renderer::DistanceModel::ExponentClamped, where the source is
+    audible at any distance, with the gain just not decreasing anymore after
+    @ref Source::setMaxDistance(). The distance is measured in the sound
+    space, i.e. after applying @ref Listener::setSoundTransformation() and
+    @ref setSoundTransformation().
+
 @see @ref PlayableGroup2D, @ref PlayableGroup3D
 */
 template<UnsignedInt dimensions> class PlayableGroup: public SceneGraph::FeatureGroup<dimensions, Playable<dimensions>, Float> {
@@ -100,11 +121,37 @@ template<UnsignedInt dimensions> class PlayableGroup: public SceneGraph::Feature
          */
         PlayableGroup& setSoundTransformation(const Matrix4& matrix);
 
+        /**
+         * @brief Cull distance
+         * @m_since_latest
+         */
+        Float cullDistance() const { return _cullDistance; }
+
+        /**
+         * @brief Set cull distance
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * Sources of playables that are further than @p distance from the
+         * listener are muted in the next @ref Listener::update(). Default is
+         * @ref Constants::inf(), i.e. no culling. See
+         * @ref Audio-PlayableGroup-culling for more information.
+         */
+        PlayableGroup& setCullDistance(Float distance);
+
     private:
         friend Playable<dimensions>;
+        friend Listener<dimensions>;
+
+        /* Culls the playables based on their distance from the listener and
+           passes position and direction changes of the remaining ones to
+           their sources. Called from Listener::update() after the objects
+           are cleaned. */
+        MAGNUM_AUDIO_LOCAL void update(const Vector3& listenerPosition);
 
         Matrix4 _soundTransform;
         Float _gain;
+        Float _cullDistance;
 };
 
 /**
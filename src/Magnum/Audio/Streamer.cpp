@@ -0,0 +1,172 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Streamer.h"
+
+#include <new>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Audio/AbstractImporter.h"
+#include "Magnum/Audio/Source.h"
+
+namespace Magnum { namespace Audio {
+
+namespace {
+
+/* Size of one sample for all channels. The buffers need to contain whole
+   frames, otherwise the channels would get swapped. */
+std::size_t frameSize(const BufferFormat format) {
+    switch(format) {
+        case BufferFormat::Mono8:
+        case BufferFormat::MonoALaw:
+        case BufferFormat::MonoMuLaw:
+            return 1;
+        case BufferFormat::Mono16:
+        case BufferFormat::Stereo8:
+        case BufferFormat::StereoALaw:
+        case BufferFormat::StereoMuLaw:
+        case BufferFormat::Rear8:
+            return 2;
+        case BufferFormat::Stereo16:
+        case BufferFormat::MonoFloat:
+        case BufferFormat::Quad8:
+        case BufferFormat::Rear16:
+            return 4;
+        case BufferFormat::Surround51Channel8:
+            return 6;
+        case BufferFormat::Surround61Channel8:
+            return 7;
+        case BufferFormat::StereoFloat:
+        case BufferFormat::MonoDouble:
+        case BufferFormat::Quad16:
+        case BufferFormat::Rear32:
+        case BufferFormat::Surround71Channel8:
+            return 8;
+        case BufferFormat::Surround51Channel16:
+            return 12;
+        case BufferFormat::Surround61Channel16:
+            return 14;
+        case BufferFormat::StereoDouble:
+        case BufferFormat::Quad32:
+        case BufferFormat::Surround71Channel16:
+            return 16;
+        case BufferFormat::Surround51Channel32:
+            return 24;
+        case BufferFormat::Surround61Channel32:
+            return 28;
+        case BufferFormat::Surround71Channel32:
+            return 32;
+    }
+
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+}
+
+Streamer::Streamer(Source& source, AbstractImporter& importer, const UnsignedInt bufferCount, const std::size_t bufferSize): _source(source), _importer(importer), _buffers{ValueInit, bufferCount}, _bufferReferences{NoInit, bufferCount}, _chunk{NoInit, bufferSize} {
+    CORRADE_ASSERT(bufferCount >= 2,
+        "Audio::Streamer: expected at least two buffers, got" << bufferCount, );
+
+    for(std::size_t i = 0; i != bufferCount; ++i)
+        new(&_bufferReferences[i]) Containers::Reference<Buffer>{_buffers[i]};
+}
+
+Streamer::~Streamer() {
+    if(_queuedCount) stop();
+}
+
+Streamer& Streamer::play() {
+    CORRADE_ASSERT(_importer.isOpened(),
+        "Audio::Streamer::play(): no file opened", *this);
+
+    stop();
+
+    _format = _importer.format();
+    _frequency = _importer.frequency();
+    _dataSize = _importer.dataSize();
+    const std::size_t size = frameSize(_format);
+    _chunkSize = _chunk.size() - _chunk.size() % size;
+    CORRADE_ASSERT(_chunkSize,
+        "Audio::Streamer::play(): buffer size" << _chunk.size() << "too small for" << _format, *this);
+
+    queue();
+    if(_queuedCount) _source.play();
+    return *this;
+}
+
+bool Streamer::update() {
+    if(!_queuedCount) return false;
+
+    /* The source processes the buffers in the order they were queued, so the
+       unqueued ones are always at the front of the queue */
+    const std::size_t count = _buffers.size();
+    for(std::size_t i = 0; i != _queuedCount; ++i)
+        _bufferReferences[i] = _buffers[(_queueBegin + i) % count];
+    const std::size_t unqueuedCount = _source.unqueueBuffers(_bufferReferences.prefix(_queuedCount));
+    _queueBegin = (_queueBegin + unqueuedCount) % count;
+    _queuedCount -= unqueuedCount;
+
+    queue();
+
+    /* If the source ran out of data before this call, it stopped. Resume the
+       playback if there's anything new queued. */
+    if(_queuedCount && _source.state() == Source::State::Stopped)
+        _source.play();
+
+    return _queuedCount != 0;
+}
+
+Streamer& Streamer::stop() {
+    /* Stopping marks all buffers as processed, after which they can be
+       detached all at once */
+    _source.stop();
+    _source.setBuffer(nullptr);
+    _queueBegin = _queuedCount = 0;
+    _offset = 0;
+    return *this;
+}
+
+void Streamer::queue() {
+    const std::size_t count = _buffers.size();
+    while(_queuedCount != count) {
+        if(_offset == _dataSize) {
+            if(!_looping || !_dataSize) break;
+            _offset = 0;
+        }
+
+        const std::size_t size = _importer.dataInto(_offset, _chunk.prefix(_chunkSize));
+        if(!size) break;
+        _offset += size;
+
+        Buffer& buffer = _buffers[(_queueBegin + _queuedCount) % count];
+        buffer.setData(_format, _chunk.prefix(size), _frequency);
+        Containers::Reference<Buffer> reference = buffer;
+        _source.queueBuffers({&reference, 1});
+        ++_queuedCount;
+    }
+}
+
+}}
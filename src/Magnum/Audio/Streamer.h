@@ -0,0 +1,220 @@
+#ifndef Magnum_Audio_Streamer_h
+#define Magnum_Audio_Streamer_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Audio::Streamer
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Reference.h>
+
+#include "Magnum/Audio/Buffer.h"
+#include "Magnum/Audio/BufferFormat.h"
+
+namespace Magnum { namespace Audio {
+
+/**
+@brief Streaming playback
+@m_since_latest
+
+Plays sample data from an @ref AbstractImporter on a @ref Source without
+having to decode the whole data upfront. Owns a fixed number of
+@ref Buffer instances, fills them with consecutive chunks of the data using
+@ref AbstractImporter::dataInto() and cycles them through
+@ref Source::queueBuffers() and @ref Source::unqueueBuffers(). The memory
+used is thus constant regardless of the clip length and the playback starts
+right after the first few chunks are decoded.
+
+@section Audio-Streamer-usage Usage
+
+Open a file in the importer, create the streamer on an existing source and
+call @ref play(). Then periodically call @ref update(), for example once every
+frame, to replace the buffers that were already played with new data:
+
+@snippet Audio.cpp Streamer
+
+The interval between @ref update() calls should be shorter than the
+playback duration of all buffers together, otherwise the source runs out of
+queued data. In that case the playback is resumed with the next call to
+@ref update(), resulting in an audible gap. The duration can be increased by
+passing a larger buffer count or buffer size to the constructor.
+
+Looping is handled by the streamer itself, enabled with @ref setLooping().
+Don't use @ref Source::setLooping() for streamed sources, as it would loop
+just the data that are currently queued. Similarly, don't attach or queue
+other buffers to the source while it's being used by the streamer.
+
+The importer is expected to stay opened and both the source and the importer
+are expected to outlive the streamer instance. The importer should
+implement @ref AbstractImporter::doDataInto() "chunked data access" for the
+streaming to be efficient, see @ref Audio-AbstractImporter-streaming for more
+information.
+*/
+class MAGNUM_AUDIO_EXPORT Streamer {
+    public:
+        /**
+         * @brief Constructor
+         * @param source        Source to play the data on
+         * @param importer      Importer to take the data from
+         * @param bufferCount   Count of buffers cycling in the source queue.
+         *      Expected to be at least @cpp 2 @ce.
+         * @param bufferSize    Size of each buffer in bytes. Rounded down to
+         *      a multiple of the sample frame size in @ref play().
+         *
+         * Creates @p bufferCount buffers and allocates memory for a
+         * single chunk of the data. Doesn't touch the @p source nor the
+         * @p importer.
+         */
+        explicit Streamer(Source& source, AbstractImporter& importer, UnsignedInt bufferCount = 3, std::size_t bufferSize = 16384);
+
+        /** @brief Copying is not allowed */
+        Streamer(const Streamer&) = delete;
+
+        /** @brief Moving is not allowed */
+        Streamer(Streamer&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * If there are any buffers queued, calls @ref stop().
+         */
+        ~Streamer();
+
+        /** @brief Copying is not allowed */
+        Streamer& operator=(const Streamer&) = delete;
+
+        /** @brief Moving is not allowed */
+        Streamer& operator=(Streamer&&) = delete;
+
+        /** @brief Source the data are played on */
+        Source& source() { return _source; }
+        const Source& source() const { return _source; } /**< @overload */
+
+        /** @brief Importer the data are taken from */
+        AbstractImporter& importer() { return _importer; }
+        const AbstractImporter& importer() const { return _importer; } /**< @overload */
+
+        /** @brief Buffer count */
+        UnsignedInt bufferCount() const { return _buffers.size(); }
+
+        /**
+         * @brief Buffer size
+         *
+         * The size passed to the constructor. The actual size of data in each
+         * buffer may be smaller, see @ref Streamer().
+         */
+        std::size_t bufferSize() const { return _chunk.size(); }
+
+        /**
+         * @brief Count of currently queued buffers
+         *
+         * Includes also buffers that were already played but not yet
+         * replaced with new data by @ref update().
+         */
+        UnsignedInt queuedBufferCount() const { return _queuedCount; }
+
+        /**
+         * @brief Offset of the next chunk of data
+         *
+         * Offset in bytes into @ref AbstractImporter::data() from which the
+         * next buffer will be filled. Note that this isn't the playback
+         * position, which lags behind by the duration of all queued buffers.
+         */
+        std::size_t offset() const { return _offset; }
+
+        /** @brief Whether the playback is looping */
+        bool isLooping() const { return _looping; }
+
+        /**
+         * @brief Set whether the playback is looping
+         * @return Reference to self (for method chaining)
+         *
+         * If enabled, after the end of the data is reached, new buffers are
+         * filled from the beginning again. Default is @cpp false @ce.
+         */
+        Streamer& setLooping(bool looping) {
+            _looping = looping;
+            return *this;
+        }
+
+        /**
+         * @brief Play
+         * @return Reference to self (for method chaining)
+         *
+         * Stops the source and detaches all buffers from it, fills and queues
+         * up to @ref bufferCount() buffers with data from the beginning of
+         * the importer data and starts the playback. Expects that the
+         * importer has a file opened.
+         * @see @ref update(), @ref stop()
+         */
+        Streamer& play();
+
+        /**
+         * @brief Update the buffer queue
+         * @return Whether there are any buffers left in the queue
+         *
+         * Unqueues buffers that were already played, fills them with next
+         * chunks of data and queues them again. If the source stopped because
+         * it ran out of queued data and there are new data queued, the
+         * playback is resumed. Returns @cpp false @ce once all data were
+         * played and looping is not enabled, after that the function is a
+         * no-op until @ref play() is called again.
+         */
+        bool update();
+
+        /**
+         * @brief Stop
+         * @return Reference to self (for method chaining)
+         *
+         * Stops the source, detaches all buffers from it and resets the
+         * offset back to the beginning.
+         * @see @ref play()
+         */
+        Streamer& stop();
+
+    private:
+        MAGNUM_AUDIO_LOCAL void queue();
+
+        Source& _source;
+        AbstractImporter& _importer;
+        Containers::Array<Buffer> _buffers;
+        Containers::Array<Containers::Reference<Buffer>> _bufferReferences;
+        Containers::Array<char> _chunk;
+        /* The queued buffers are _buffers[(_queueBegin + i) % _buffers.size()]
+           for i in [0, _queuedCount), in the order they were queued */
+        UnsignedInt _queueBegin{}, _queuedCount{};
+        std::size_t _chunkSize{}, _offset{}, _dataSize{};
+        BufferFormat _format{};
+        UnsignedInt _frequency{};
+        bool _looping{};
+};
+
+}}
+
+#endif
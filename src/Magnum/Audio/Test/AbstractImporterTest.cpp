@@ -66,6 +66,14 @@ struct AbstractImporterTest: TestSuite::Tester {
     void dataNoFile();
     void dataCustomDeleter();
 
+    void dataSize();
+    void dataSizeNoFile();
+    void dataInto();
+    void dataIntoNotImplemented();
+    void dataIntoNoFile();
+    void dataIntoOutOfRange();
+    void dataIntoImplementationTooMuchData();
+
     void debugFeature();
     void debugFeaturePacked();
     void debugFeatures();
@@ -93,6 +101,14 @@ AbstractImporterTest::AbstractImporterTest() {
               &AbstractImporterTest::dataNoFile,
               &AbstractImporterTest::dataCustomDeleter,
 
+              &AbstractImporterTest::dataSize,
+              &AbstractImporterTest::dataSizeNoFile,
+              &AbstractImporterTest::dataInto,
+              &AbstractImporterTest::dataIntoNotImplemented,
+              &AbstractImporterTest::dataIntoNoFile,
+              &AbstractImporterTest::dataIntoOutOfRange,
+              &AbstractImporterTest::dataIntoImplementationTooMuchData,
+
               &AbstractImporterTest::debugFeature,
               &AbstractImporterTest::debugFeaturePacked,
               &AbstractImporterTest::debugFeatures,
@@ -385,6 +401,155 @@ void AbstractImporterTest::dataCustomDeleter() {
     CORRADE_COMPARE(out, "Audio::AbstractImporter::data(): implementation is not allowed to use a custom Array deleter\n");
 }
 
+void AbstractImporterTest::dataSize() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        BufferFormat doFormat() const override { return {}; }
+        UnsignedInt doFrequency() const override { return {}; }
+        Containers::Array<char> doData() override {
+            return Containers::Array<char>{InPlaceInit, {'H', 'e', 'l', 'l', 'o'}};
+        }
+    } importer;
+
+    /* Default implementation goes through doData() */
+    CORRADE_COMPARE(importer.dataSize(), 5);
+}
+
+void AbstractImporterTest::dataSizeNoFile() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return false; }
+        void doClose() override {}
+
+        BufferFormat doFormat() const override { return {}; }
+        UnsignedInt doFrequency() const override { return {}; }
+        Containers::Array<char> doData() override { return nullptr; }
+    } importer;
+
+    Containers::String out;
+    Error redirectError{&out};
+
+    importer.dataSize();
+    CORRADE_COMPARE(out, "Audio::AbstractImporter::dataSize(): no file opened\n");
+}
+
+void AbstractImporterTest::dataInto() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        BufferFormat doFormat() const override { return {}; }
+        UnsignedInt doFrequency() const override { return {}; }
+        /* Shouldn't be called */
+        Containers::Array<char> doData() override { return {}; }
+        std::size_t doDataSize() override { return 5; }
+        std::size_t doDataInto(std::size_t offset, Containers::ArrayView<char> out) override {
+            CORRADE_COMPARE(offset, 3);
+            out[0] = 'l';
+            out[1] = 'o';
+            return 2;
+        }
+    } importer;
+
+    char out[4]{};
+    CORRADE_COMPARE(importer.dataInto(3, out), 2);
+    CORRADE_COMPARE_AS(Containers::arrayView(out).prefix(2), Containers::arrayView({'l', 'o'}), TestSuite::Compare::Container);
+}
+
+void AbstractImporterTest::dataIntoNotImplemented() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        BufferFormat doFormat() const override { return {}; }
+        UnsignedInt doFrequency() const override { return {}; }
+        Containers::Array<char> doData() override {
+            return Containers::Array<char>{InPlaceInit, {'H', 'e', 'l', 'l', 'o'}};
+        }
+    } importer;
+
+    /* Default implementation copies a slice of doData(), the last chunk is
+       shorter */
+    char out[3]{};
+    CORRADE_COMPARE(importer.dataInto(0, out), 3);
+    CORRADE_COMPARE_AS(Containers::arrayView(out), Containers::arrayView({'H', 'e', 'l'}), TestSuite::Compare::Container);
+    CORRADE_COMPARE(importer.dataInto(3, out), 2);
+    CORRADE_COMPARE_AS(Containers::arrayView(out).prefix(2), Containers::arrayView({'l', 'o'}), TestSuite::Compare::Container);
+    CORRADE_COMPARE(importer.dataInto(5, out), 0);
+}
+
+void AbstractImporterTest::dataIntoNoFile() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return false; }
+        void doClose() override {}
+
+        BufferFormat doFormat() const override { return {}; }
+        UnsignedInt doFrequency() const override { return {}; }
+        Containers::Array<char> doData() override { return nullptr; }
+    } importer;
+
+    Containers::String out;
+    Error redirectError{&out};
+
+    importer.dataInto(0, nullptr);
+    CORRADE_COMPARE(out, "Audio::AbstractImporter::dataInto(): no file opened\n");
+}
+
+void AbstractImporterTest::dataIntoOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        BufferFormat doFormat() const override { return {}; }
+        UnsignedInt doFrequency() const override { return {}; }
+        Containers::Array<char> doData() override { return {}; }
+        std::size_t doDataSize() override { return 5; }
+    } importer;
+
+    Containers::String out;
+    Error redirectError{&out};
+
+    char data[3];
+    importer.dataInto(6, data);
+    CORRADE_COMPARE(out, "Audio::AbstractImporter::dataInto(): offset 6 out of range for 5 bytes\n");
+}
+
+void AbstractImporterTest::dataIntoImplementationTooMuchData() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        BufferFormat doFormat() const override { return {}; }
+        UnsignedInt doFrequency() const override { return {}; }
+        Containers::Array<char> doData() override { return {}; }
+        std::size_t doDataSize() override { return 5; }
+        std::size_t doDataInto(std::size_t, Containers::ArrayView<char>) override { return 3; }
+    } importer;
+
+    Containers::String out;
+    Error redirectError{&out};
+
+    char data[3];
+    importer.dataInto(4, data);
+    CORRADE_COMPARE(out, "Audio::AbstractImporter::dataInto(): implementation wrote 3 bytes at offset 4 into 3 bytes out of 5\n");
+}
+
 void AbstractImporterTest::debugFeature() {
     Containers::String out;
 
@@ -52,6 +52,9 @@ struct ListenerALTest: TestSuite::Tester {
     void feature2D();
     void feature3D();
     void updateGroups();
+    void updateGroupsUnchanged();
+    void updateGroupsZeroGain();
+    void updateGroupsCullDistance();
 
     Context _context;
 };
@@ -62,7 +65,10 @@ ListenerALTest::ListenerALTest():
 {
     addTests({&ListenerALTest::feature2D,
               &ListenerALTest::feature3D,
-              &ListenerALTest::updateGroups});
+              &ListenerALTest::updateGroups,
+              &ListenerALTest::updateGroupsUnchanged,
+              &ListenerALTest::updateGroupsZeroGain,
+              &ListenerALTest::updateGroupsCullDistance});
 }
 
 void ListenerALTest::feature2D() {
@@ -111,6 +117,109 @@ void ListenerALTest::updateGroups() {
     CORRADE_COMPARE(playable.source().position(), offset*13.0f);
 }
 
+void ListenerALTest::updateGroupsUnchanged() {
+    Scene3D scene;
+    Object3D sourceObject{&scene};
+    Object3D object{&scene};
+    PlayableGroup3D group;
+    Playable3D playable{sourceObject, &group};
+    Listener3D listener{object};
+
+    sourceObject.translate({1.0f, 2.0f, 3.0f});
+    listener.update({group});
+    CORRADE_COMPARE(playable.source().position(), (Vector3{1.0f, 2.0f, 3.0f}));
+
+    /* The object didn't change, so the source shouldn't get updated. Setting
+       the position directly to verify that. */
+    playable.source().setPosition({7.0f, 8.0f, 9.0f});
+    listener.update({group});
+    CORRADE_COMPARE(playable.source().position(), (Vector3{7.0f, 8.0f, 9.0f}));
+
+    /* Marking the object dirty without an actual change doesn't cause an
+       update either */
+    sourceObject.setDirty();
+    listener.update({group});
+    CORRADE_COMPARE(playable.source().position(), (Vector3{7.0f, 8.0f, 9.0f}));
+
+    /* But a change does */
+    sourceObject.translate({1.0f, 0.0f, 0.0f});
+    listener.update({group});
+    CORRADE_COMPARE(playable.source().position(), (Vector3{2.0f, 2.0f, 3.0f}));
+
+    /* Even a change that's below the fuzzy compare epsilon */
+    playable.source().setPosition({7.0f, 8.0f, 9.0f});
+    sourceObject.translate({0.000001f, 0.0f, 0.0f});
+    listener.update({group});
+    CORRADE_COMPARE(playable.source().position(), (Vector3{2.000001f, 2.0f, 3.0f}));
+}
+
+void ListenerALTest::updateGroupsZeroGain() {
+    Scene3D scene;
+    Object3D sourceObject{&scene};
+    Object3D object{&scene};
+    PlayableGroup3D group;
+    Playable3D playable{sourceObject, &group};
+    Listener3D listener{object};
+
+    /* The source is inaudible, so its position isn't updated */
+    playable.setGain(0.0f);
+    sourceObject.translate({1.0f, 2.0f, 3.0f});
+    listener.update({group});
+    CORRADE_COMPARE(playable.source().position(), Vector3{});
+
+    /* Same if the group has a zero gain */
+    playable.setGain(1.0f);
+    group.setGain(0.0f);
+    listener.update({group});
+    CORRADE_COMPARE(playable.source().position(), Vector3{});
+
+    /* Once audible again, the recorded change is applied even though the
+       object didn't change since */
+    group.setGain(1.0f);
+    listener.update({group});
+    CORRADE_COMPARE(playable.source().position(), (Vector3{1.0f, 2.0f, 3.0f}));
+}
+
+void ListenerALTest::updateGroupsCullDistance() {
+    Scene3D scene;
+    Object3D sourceObject{&scene};
+    Object3D object{&scene};
+    PlayableGroup3D group;
+    Playable3D playable{sourceObject, &group};
+    Listener3D listener{object};
+    playable.setGain(0.5f);
+
+    group.setCullDistance(10.0f);
+    CORRADE_COMPARE(group.cullDistance(), 10.0f);
+
+    /* Further than the cull distance, the source gets muted and its position
+       isn't updated */
+    object.translate({0.0f, 0.0f, 5.0f});
+    sourceObject.translate({0.0f, 0.0f, -6.0f});
+    listener.update({group});
+    CORRADE_COMPARE(playable.source().gain(), 0.0f);
+    CORRADE_COMPARE(playable.source().position(), Vector3{});
+
+    /* Changing the gain keeps it muted */
+    playable.setGain(0.75f);
+    CORRADE_COMPARE(playable.source().gain(), 0.0f);
+
+    /* Moving the listener closer unmutes it and updates the position */
+    object.translate({0.0f, 0.0f, -2.0f});
+    listener.update({group});
+    CORRADE_COMPARE(playable.source().gain(), 0.75f);
+    CORRADE_COMPARE(playable.source().position(), (Vector3{0.0f, 0.0f, -6.0f}));
+
+    /* Culled again and then removed from the group, the culled state no
+       longer applies */
+    object.translate({0.0f, 0.0f, 2.0f});
+    listener.update({group});
+    CORRADE_COMPARE(playable.source().gain(), 0.0f);
+    group.remove(playable);
+    playable.setGain(0.25f);
+    CORRADE_COMPARE(playable.source().gain(), 0.25f);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Audio::Test::ListenerALTest)
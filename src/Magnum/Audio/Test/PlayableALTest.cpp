@@ -31,6 +31,7 @@
 #include "Magnum/Audio/Context.h"
 #include "Magnum/Audio/Playable.h"
 #include "Magnum/Audio/PlayableGroup.h"
+#include "Magnum/Math/Constants.h"
 #include "Magnum/SceneGraph/Scene.h"
 #include "Magnum/SceneGraph/Object.h"
 #include "Magnum/SceneGraph/MatrixTransformation3D.h"
@@ -84,6 +85,10 @@ void PlayableALTest::group() {
     CORRADE_COMPARE(playable.gain(), 0.5f);
     CORRADE_COMPARE(playable.source().gain(), 0.25f);
 
+    CORRADE_COMPARE(group.cullDistance(), Constants::inf());
+    group.setCullDistance(15.0f);
+    CORRADE_COMPARE(group.cullDistance(), 15.0f);
+
     group.play();
     group.pause();
     group.stop();
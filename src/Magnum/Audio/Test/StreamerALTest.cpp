@@ -0,0 +1,221 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Audio/AbstractImporter.h"
+#include "Magnum/Audio/BufferFormat.h"
+#include "Magnum/Audio/Context.h"
+#include "Magnum/Audio/Source.h"
+#include "Magnum/Audio/Streamer.h"
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum { namespace Audio { namespace Test { namespace {
+
+struct StreamerALTest: TestSuite::Tester {
+    explicit StreamerALTest();
+
+    void construct();
+    void constructCopy();
+
+    void play();
+    void playShorterThanQueue();
+    void playFrameSizeRounding();
+    void update();
+    void updateLooping();
+    void stop();
+
+    Context _context;
+};
+
+StreamerALTest::StreamerALTest():
+    TestSuite::Tester{TestSuite::Tester::TesterConfiguration{}.setSkippedArgumentPrefixes({"magnum"})},
+    _context{arguments().first(), arguments().second()}
+{
+    addTests({&StreamerALTest::construct,
+              &StreamerALTest::constructCopy,
+
+              &StreamerALTest::play,
+              &StreamerALTest::playShorterThanQueue,
+              &StreamerALTest::playFrameSizeRounding,
+              &StreamerALTest::update,
+              &StreamerALTest::updateLooping,
+              &StreamerALTest::stop});
+}
+
+/* Provides just the chunked access, with the whole data never being requested
+   at once */
+struct DataImporter: AbstractImporter {
+    explicit DataImporter(BufferFormat format, std::size_t size): _format{format}, _data{ValueInit, size} {}
+
+    ImporterFeatures doFeatures() const override { return {}; }
+    bool doIsOpened() const override { return true; }
+    void doClose() override {}
+
+    BufferFormat doFormat() const override { return _format; }
+    UnsignedInt doFrequency() const override { return 22050; }
+    Containers::Array<char> doData() override { return {}; }
+    std::size_t doDataSize() override { return _data.size(); }
+    std::size_t doDataInto(std::size_t offset, Containers::ArrayView<char> out) override {
+        const std::size_t size = Math::min(out.size(), _data.size() - offset);
+        Utility::copy(_data.sliceSize(offset, size), out.prefix(size));
+        return size;
+    }
+
+    BufferFormat _format;
+    Containers::Array<char> _data;
+};
+
+void StreamerALTest::construct() {
+    Source source;
+    DataImporter importer{BufferFormat::Mono8, 8*1024};
+    Streamer streamer{source, importer, 4, 2048};
+
+    CORRADE_COMPARE(&streamer.source(), &source);
+    CORRADE_COMPARE(&streamer.importer(), &importer);
+    CORRADE_COMPARE(streamer.bufferCount(), 4);
+    CORRADE_COMPARE(streamer.bufferSize(), 2048);
+    CORRADE_COMPARE(streamer.queuedBufferCount(), 0);
+    CORRADE_COMPARE(streamer.offset(), 0);
+    CORRADE_VERIFY(!streamer.isLooping());
+
+    /* The source isn't touched */
+    CORRADE_COMPARE(source.type(), Source::Type::Undetermined);
+}
+
+void StreamerALTest::constructCopy() {
+    CORRADE_VERIFY(!std::is_copy_constructible<Streamer>{});
+    CORRADE_VERIFY(!std::is_copy_assignable<Streamer>{});
+    CORRADE_VERIFY(!std::is_move_constructible<Streamer>{});
+    CORRADE_VERIFY(!std::is_move_assignable<Streamer>{});
+}
+
+void StreamerALTest::play() {
+    Source source;
+    DataImporter importer{BufferFormat::Mono8, 8*1024};
+    Streamer streamer{source, importer, 3, 1024};
+    streamer.play();
+
+    CORRADE_COMPARE(streamer.queuedBufferCount(), 3);
+    CORRADE_COMPARE(streamer.offset(), 3*1024);
+    CORRADE_COMPARE(source.type(), Source::Type::Streaming);
+}
+
+void StreamerALTest::playShorterThanQueue() {
+    Source source;
+    DataImporter importer{BufferFormat::Mono8, 1500};
+    Streamer streamer{source, importer, 3, 1024};
+    streamer.play();
+
+    CORRADE_COMPARE(streamer.queuedBufferCount(), 2);
+    CORRADE_COMPARE(streamer.offset(), 1500);
+}
+
+void StreamerALTest::playFrameSizeRounding() {
+    Source source;
+    DataImporter importer{BufferFormat::Stereo16, 8*1024};
+    Streamer streamer{source, importer, 3, 1023};
+    streamer.play();
+
+    /* Four bytes per frame, so each buffer gets just 1020 bytes */
+    CORRADE_COMPARE(streamer.bufferSize(), 1023);
+    CORRADE_COMPARE(streamer.queuedBufferCount(), 3);
+    CORRADE_COMPARE(streamer.offset(), 3*1020);
+}
+
+void StreamerALTest::update() {
+    Source source;
+    DataImporter importer{BufferFormat::Mono8, 8*1024};
+    Streamer streamer{source, importer, 3, 1024};
+    streamer.play();
+    CORRADE_COMPARE(streamer.offset(), 3*1024);
+
+    /* Stopping the source marks all queued buffers as processed, which
+       simulates a buffer underrun in a deterministic way. The update should
+       refill all of them and resume the playback. */
+    source.stop();
+    CORRADE_VERIFY(streamer.update());
+    CORRADE_COMPARE(streamer.queuedBufferCount(), 3);
+    CORRADE_COMPARE(streamer.offset(), 6*1024);
+    CORRADE_COMPARE(source.state(), Source::State::Playing);
+
+    /* Just two chunks left */
+    source.stop();
+    CORRADE_VERIFY(streamer.update());
+    CORRADE_COMPARE(streamer.queuedBufferCount(), 2);
+    CORRADE_COMPARE(streamer.offset(), 8*1024);
+
+    /* Nothing left */
+    source.stop();
+    CORRADE_VERIFY(!streamer.update());
+    CORRADE_COMPARE(streamer.queuedBufferCount(), 0);
+    CORRADE_COMPARE(source.state(), Source::State::Stopped);
+
+    /* Further updates are a no-op */
+    CORRADE_VERIFY(!streamer.update());
+}
+
+void StreamerALTest::updateLooping() {
+    Source source;
+    DataImporter importer{BufferFormat::Mono8, 4*1024};
+    Streamer streamer{source, importer, 3, 1024};
+    streamer.setLooping(true);
+    CORRADE_VERIFY(streamer.isLooping());
+
+    streamer.play();
+    CORRADE_COMPARE(streamer.offset(), 3*1024);
+
+    /* The last chunk and then two more from the beginning */
+    source.stop();
+    CORRADE_VERIFY(streamer.update());
+    CORRADE_COMPARE(streamer.queuedBufferCount(), 3);
+    CORRADE_COMPARE(streamer.offset(), 2*1024);
+}
+
+void StreamerALTest::stop() {
+    Source source;
+    DataImporter importer{BufferFormat::Mono8, 8*1024};
+    Streamer streamer{source, importer, 3, 1024};
+    streamer.play();
+    CORRADE_COMPARE(streamer.queuedBufferCount(), 3);
+
+    streamer.stop();
+    CORRADE_COMPARE(streamer.queuedBufferCount(), 0);
+    CORRADE_COMPARE(streamer.offset(), 0);
+    CORRADE_COMPARE(source.state(), Source::State::Stopped);
+    CORRADE_VERIFY(!streamer.update());
+
+    /* Playing again starts from the beginning */
+    streamer.play();
+    CORRADE_COMPARE(streamer.queuedBufferCount(), 3);
+    CORRADE_COMPARE(streamer.offset(), 3*1024);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Audio::Test::StreamerALTest)
@@ -26,8 +26,9 @@
 
 #include "CompareImage.h"
 
-#include <map>
+#include <algorithm> /* std::push_heap(), std::pop_heap(), std::sort_heap() */
 #include <sstream>
+#include <Corrade/Cpu.h>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/Pair.h>
@@ -41,6 +42,7 @@
 
 #include "Magnum/ImageView.h"
 #include "Magnum/PixelFormat.h"
+#include "Magnum/Implementation/parallel.h"
 #include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Half.h"
 #include "Magnum/Math/Color.h"
@@ -49,6 +51,13 @@
 #include "Magnum/Trade/AbstractImporter.h"
 #include "Magnum/Trade/ImageData.h"
 
+#ifdef CORRADE_ENABLE_SSE2
+#include <Corrade/Utility/IntrinsicsSse2.h>
+#endif
+#ifdef CORRADE_ENABLE_NEON
+#include <arm_neon.h>
+#endif
+
 namespace Magnum { namespace DebugTools { namespace Implementation {
 
 namespace {
@@ -57,67 +66,271 @@ namespace {
    any additional logic for handling NaN and infinity values, allowing the
    comparison to be much simpler & faster. */
 
-template<std::size_t size, class T, typename std::enable_if<Math::IsFloatingPoint<T>::value, int>::type = 0> Float calculateImageDelta(const Containers::StridedArrayView2D<const Math::Vector<size, T>>& actual, const Containers::StridedArrayView2D<const Math::Vector<size, T>>& expected, const Containers::StridedArrayView2D<Float>& output) {
-    CORRADE_INTERNAL_ASSERT(actual.size() == output.size());
-    CORRADE_INTERNAL_ASSERT(output.size() == expected.size());
+template<std::size_t size, class T, typename std::enable_if<Math::IsFloatingPoint<T>::value, int>::type = 0> Float calculateRowDeltaScalar(const Containers::StridedArrayView1D<const Math::Vector<size, T>>& actual, const Containers::StridedArrayView1D<const Math::Vector<size, T>>& expected, const Containers::StridedArrayView1D<Float>& output) {
+    CORRADE_INTERNAL_DEBUG_ASSERT(actual.size() == output.size());
+    CORRADE_INTERNAL_DEBUG_ASSERT(output.size() == expected.size());
 
     /* Calculate deltas and maximal value of them */
     Float max{};
-    for(std::size_t i = 0, iMax = expected.size()[0]; i != iMax; ++i) {
-        Containers::StridedArrayView1D<const Math::Vector<size, T>> actualRow = actual[i];
-        Containers::StridedArrayView1D<const Math::Vector<size, T>> expectedRow = expected[i];
-        Containers::StridedArrayView1D<Float> outputRow = output[i];
-
-        for(std::size_t j = 0, jMax = expectedRow.size(); j != jMax; ++j) {
-            /* Explicitly convert from T to Float */
-            auto actualPixel = Math::Vector<size, Float>(actualRow[j]);
-            auto expectedPixel = Math::Vector<size, Float>(expectedRow[j]);
-
-            /* First calculate a classic difference */
-            Math::Vector<size, Float> diff = Math::abs(actualPixel - expectedPixel);
-
-            /* Mark pixels that are NaN in both actual and expected pixels as
-               having no difference */
-            diff = Math::lerp(diff, {}, Math::isNan(actualPixel) & Math::isNan(expectedPixel));
-
-            /* Then also mark pixels that are the same sign of infnity in both
-               actual and expected pixel as having no difference */
-            diff = Math::lerp(diff, {}, Math::isInf(actualPixel) & Math::isInf(expectedPixel) & Math::equal(actualPixel, expectedPixel));
-
-            /* Calculate the difference and save it to the output image even
-               with NaN and ±Inf (as the user should know) */
-            outputRow[j] = diff.sum()/size;
-
-            /* On the other hand, infs and NaNs should not contribute to the
-               max delta -- because all other differences would be zero
-               compared to them */
-            max = Math::max(max, Math::lerp(diff, {}, Math::isNan(diff)|Math::isInf(diff)).sum()/size);
-        }
+    for(std::size_t j = 0, jMax = expected.size(); j != jMax; ++j) {
+        /* Explicitly convert from T to Float */
+        auto actualPixel = Math::Vector<size, Float>(actual[j]);
+        auto expectedPixel = Math::Vector<size, Float>(expected[j]);
+
+        /* First calculate a classic difference */
+        Math::Vector<size, Float> diff = Math::abs(actualPixel - expectedPixel);
+
+        /* Mark pixels that are NaN in both actual and expected pixels as
+           having no difference */
+        diff = Math::lerp(diff, {}, Math::isNan(actualPixel) & Math::isNan(expectedPixel));
+
+        /* Then also mark pixels that are the same sign of infnity in both
+           actual and expected pixel as having no difference */
+        diff = Math::lerp(diff, {}, Math::isInf(actualPixel) & Math::isInf(expectedPixel) & Math::equal(actualPixel, expectedPixel));
+
+        /* Calculate the difference and save it to the output image even with
+           NaN and ±Inf (as the user should know) */
+        output[j] = diff.sum()/size;
+
+        /* On the other hand, infs and NaNs should not contribute to the max
+           delta -- because all other differences would be zero compared to
+           them */
+        max = Math::max(max, Math::lerp(diff, {}, Math::isNan(diff)|Math::isInf(diff)).sum()/size);
+    }
+
+    return max;
+}
+
+template<std::size_t size, class T, typename std::enable_if<Math::IsIntegral<T>::value, int>::type = 0> Float calculateRowDeltaScalar(const Containers::StridedArrayView1D<const Math::Vector<size, T>>& actual, const Containers::StridedArrayView1D<const Math::Vector<size, T>>& expected, const Containers::StridedArrayView1D<Float>& output) {
+    CORRADE_INTERNAL_DEBUG_ASSERT(actual.size() == output.size());
+    CORRADE_INTERNAL_DEBUG_ASSERT(output.size() == expected.size());
+
+    /* Calculate deltas and maximal value of them */
+    Float max{};
+    for(std::size_t j = 0, jMax = expected.size(); j != jMax; ++j) {
+        /* Explicitly convert from T to Float */
+        auto actualPixel = Math::Vector<size, Float>(actual[j]);
+        auto expectedPixel = Math::Vector<size, Float>(expected[j]);
+
+        Math::Vector<size, Float> diff = Math::abs(actualPixel - expectedPixel);
+        output[j] = diff.sum()/size;
+        max = Math::max(max, output[j]);
     }
 
     return max;
 }
 
-template<std::size_t size, class T, typename std::enable_if<Math::IsIntegral<T>::value, int>::type = 0> Float calculateImageDelta(const Containers::StridedArrayView2D<const Math::Vector<size, T>>& actual, const Containers::StridedArrayView2D<const Math::Vector<size, T>>& expected, const Containers::StridedArrayView2D<Float>& output) {
+/* Vectorized kernels for contiguous rows of the most common formats, i.e.
+   8-bit images with one, two or four channels, and 32-bit float images with
+   one or four channels. Each kernel processes as many pixels as fit into
+   whole vectors and returns their count together with the max delta, the
+   rest is then done by the scalar code above. The results are bit-exact
+   with the scalar variant -- integer channel deltas are summed exactly, the
+   division by a power-of-two channel count is exact as well, and for floats
+   the channels are summed in the same order. */
+template<class T> using RowDeltaKernel = Containers::Pair<std::size_t, Float>(*)(const T*, const T*, Float*, std::size_t);
+
+#ifdef CORRADE_ENABLE_SSE2
+/* Sums of absolute channel deltas for four pixels, as 32-bit integers */
+template<std::size_t size> CORRADE_ENABLE_SSE2 __m128i pixelDeltaSums8Sse2(__m128i d, __m128i, std::size_t);
+template<> CORRADE_ENABLE_SSE2 inline __m128i pixelDeltaSums8Sse2<1>(const __m128i d, const __m128i zero, const std::size_t i) {
+    /* Widening the i-th group of four bytes */
+    const __m128i shifted = i == 0 ? d : i == 1 ? _mm_srli_si128(d, 4) :
+        i == 2 ? _mm_srli_si128(d, 8) : _mm_srli_si128(d, 12);
+    return _mm_unpacklo_epi16(_mm_unpacklo_epi8(shifted, zero), zero);
+}
+template<> CORRADE_ENABLE_SSE2 inline __m128i pixelDeltaSums8Sse2<2>(const __m128i d, const __m128i zero, const std::size_t i) {
+    /* Widening the i-th group of eight bytes to 16 bits, then summing
+       neighboring pairs to 32 bits */
+    const __m128i widened = i == 0 ? _mm_unpacklo_epi8(d, zero) : _mm_unpackhi_epi8(d, zero);
+    return _mm_madd_epi16(widened, _mm_set1_epi16(1));
+}
+template<> CORRADE_ENABLE_SSE2 inline __m128i pixelDeltaSums8Sse2<4>(const __m128i d, const __m128i, std::size_t) {
+    /* SAD sums eight bytes into the low 16 bits of each 64-bit half, so the
+       even and odd pixels are summed separately and then interleaved */
+    const __m128i even = _mm_sad_epu8(_mm_and_si128(d, _mm_set_epi32(0, -1, 0, -1)), _mm_setzero_si128());
+    const __m128i odd = _mm_sad_epu8(_mm_srli_epi64(d, 32), _mm_setzero_si128());
+    return _mm_or_si128(even, _mm_slli_epi64(odd, 32));
+}
+
+template<std::size_t size> CORRADE_ENABLE_SSE2 Containers::Pair<std::size_t, Float> rowDelta8Sse2(const UnsignedByte* const actual, const UnsignedByte* const expected, Float* const output, const std::size_t count) {
+    const __m128i zero = _mm_setzero_si128();
+    /* Dividing by a power of two, so multiplying by the inverse is exact */
+    const __m128 scale = _mm_set1_ps(1.0f/size);
+    __m128 max = _mm_setzero_ps();
+    constexpr std::size_t PixelsPerVector = 16/size;
+    std::size_t i = 0;
+    for(; i + PixelsPerVector <= count; i += PixelsPerVector) {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(actual + i*size));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(expected + i*size));
+        /* Absolute difference of unsigned bytes */
+        const __m128i d = _mm_or_si128(_mm_subs_epu8(a, b), _mm_subs_epu8(b, a));
+        for(std::size_t j = 0; j != PixelsPerVector/4; ++j) {
+            const __m128 delta = _mm_mul_ps(_mm_cvtepi32_ps(pixelDeltaSums8Sse2<size>(d, zero, j)), scale);
+            _mm_storeu_ps(output + i + j*4, delta);
+            max = _mm_max_ps(max, delta);
+        }
+    }
+
+    Float maxes[4];
+    _mm_storeu_ps(maxes, max);
+    return {i, Math::max(Math::max(maxes[0], maxes[1]), Math::max(maxes[2], maxes[3]))};
+}
+
+/* Zeroes channel deltas where both values are the same, which includes
+   infinities of the same sign, or where both values are NaN */
+CORRADE_ENABLE_SSE2 inline __m128 channelDeltaSse2(const __m128 a, const __m128 b) {
+    const __m128 same = _mm_or_ps(_mm_cmpeq_ps(a, b), _mm_and_ps(_mm_cmpunord_ps(a, a), _mm_cmpunord_ps(b, b)));
+    const __m128 diff = _mm_andnot_ps(_mm_castsi128_ps(_mm_set1_epi32(0x80000000)), _mm_sub_ps(a, b));
+    return _mm_andnot_ps(same, diff);
+}
+
+/* Channel deltas that are NaN or infinity zeroed out, for the max value */
+CORRADE_ENABLE_SSE2 inline __m128 finiteDeltaSse2(const __m128 diff) {
+    return _mm_and_ps(diff, _mm_cmplt_ps(diff, _mm_set1_ps(Constants::inf())));
+}
+
+CORRADE_ENABLE_SSE2 Containers::Pair<std::size_t, Float> rowDelta32F1Sse2(const Float* const actual, const Float* const expected, Float* const output, const std::size_t count) {
+    __m128 max = _mm_setzero_ps();
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4) {
+        const __m128 diff = channelDeltaSse2(_mm_loadu_ps(actual + i), _mm_loadu_ps(expected + i));
+        _mm_storeu_ps(output + i, diff);
+        max = _mm_max_ps(max, finiteDeltaSse2(diff));
+    }
+
+    Float maxes[4];
+    _mm_storeu_ps(maxes, max);
+    return {i, Math::max(Math::max(maxes[0], maxes[1]), Math::max(maxes[2], maxes[3]))};
+}
+
+CORRADE_ENABLE_SSE2 Containers::Pair<std::size_t, Float> rowDelta32F4Sse2(const Float* const actual, const Float* const expected, Float* const output, const std::size_t count) {
+    const __m128 scale = _mm_set1_ps(0.25f);
+    __m128 max = _mm_setzero_ps();
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4) {
+        __m128 d0 = channelDeltaSse2(_mm_loadu_ps(actual + i*4 + 0), _mm_loadu_ps(expected + i*4 + 0));
+        __m128 d1 = channelDeltaSse2(_mm_loadu_ps(actual + i*4 + 4), _mm_loadu_ps(expected + i*4 + 4));
+        __m128 d2 = channelDeltaSse2(_mm_loadu_ps(actual + i*4 + 8), _mm_loadu_ps(expected + i*4 + 8));
+        __m128 d3 = channelDeltaSse2(_mm_loadu_ps(actual + i*4 + 12), _mm_loadu_ps(expected + i*4 + 12));
+        /* Transposing so each vector contains one channel of four pixels,
+           summing them in the same order as Vector::sum() does */
+        _MM_TRANSPOSE4_PS(d0, d1, d2, d3);
+        _mm_storeu_ps(output + i, _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_add_ps(d0, d1), d2), d3), scale));
+        const __m128 finite = _mm_add_ps(_mm_add_ps(_mm_add_ps(finiteDeltaSse2(d0), finiteDeltaSse2(d1)), finiteDeltaSse2(d2)), finiteDeltaSse2(d3));
+        max = _mm_max_ps(max, _mm_mul_ps(finite, scale));
+    }
+
+    Float maxes[4];
+    _mm_storeu_ps(maxes, max);
+    return {i, Math::max(Math::max(maxes[0], maxes[1]), Math::max(maxes[2], maxes[3]))};
+}
+#endif
+
+#ifdef CORRADE_ENABLE_NEON
+template<std::size_t size> CORRADE_ENABLE_NEON uint32x4_t pixelDeltaSums8Neon(uint8x16_t, std::size_t);
+template<> CORRADE_ENABLE_NEON inline uint32x4_t pixelDeltaSums8Neon<1>(const uint8x16_t d, const std::size_t i) {
+    const uint16x8_t widened = vmovl_u8(i < 2 ? vget_low_u8(d) : vget_high_u8(d));
+    return vmovl_u16(i % 2 == 0 ? vget_low_u16(widened) : vget_high_u16(widened));
+}
+template<> CORRADE_ENABLE_NEON inline uint32x4_t pixelDeltaSums8Neon<2>(const uint8x16_t d, const std::size_t i) {
+    const uint16x8_t pairs = vpaddlq_u8(d);
+    return vmovl_u16(i == 0 ? vget_low_u16(pairs) : vget_high_u16(pairs));
+}
+template<> CORRADE_ENABLE_NEON inline uint32x4_t pixelDeltaSums8Neon<4>(const uint8x16_t d, std::size_t) {
+    return vpaddlq_u16(vpaddlq_u8(d));
+}
+
+template<std::size_t size> CORRADE_ENABLE_NEON Containers::Pair<std::size_t, Float> rowDelta8Neon(const UnsignedByte* const actual, const UnsignedByte* const expected, Float* const output, const std::size_t count) {
+    /* Dividing by a power of two, so multiplying by the inverse is exact */
+    const float32x4_t scale = vdupq_n_f32(1.0f/size);
+    float32x4_t max = vdupq_n_f32(0.0f);
+    constexpr std::size_t PixelsPerVector = 16/size;
+    std::size_t i = 0;
+    for(; i + PixelsPerVector <= count; i += PixelsPerVector) {
+        const uint8x16_t d = vabdq_u8(vld1q_u8(actual + i*size), vld1q_u8(expected + i*size));
+        for(std::size_t j = 0; j != PixelsPerVector/4; ++j) {
+            const float32x4_t delta = vmulq_f32(vcvtq_f32_u32(pixelDeltaSums8Neon<size>(d, j)), scale);
+            vst1q_f32(output + i + j*4, delta);
+            max = vmaxq_f32(max, delta);
+        }
+    }
+
+    Float maxes[4];
+    vst1q_f32(maxes, max);
+    return {i, Math::max(Math::max(maxes[0], maxes[1]), Math::max(maxes[2], maxes[3]))};
+}
+#endif
+
+template<std::size_t size> RowDeltaKernel<UnsignedByte> rowDelta8Kernel() {
+    const Cpu::Features features = Cpu::runtimeFeatures();
+    #ifdef CORRADE_ENABLE_SSE2
+    if(features & Cpu::Sse2) return rowDelta8Sse2<size>;
+    #endif
+    #ifdef CORRADE_ENABLE_NEON
+    if(features & Cpu::Neon) return rowDelta8Neon<size>;
+    #endif
+    static_cast<void>(features);
+    return nullptr;
+}
+
+template<std::size_t size> RowDeltaKernel<Float> rowDelta32FKernel();
+template<> RowDeltaKernel<Float> rowDelta32FKernel<1>() {
+    const Cpu::Features features = Cpu::runtimeFeatures();
+    #ifdef CORRADE_ENABLE_SSE2
+    if(features & Cpu::Sse2) return rowDelta32F1Sse2;
+    #endif
+    static_cast<void>(features);
+    return nullptr;
+}
+template<> RowDeltaKernel<Float> rowDelta32FKernel<4>() {
+    const Cpu::Features features = Cpu::runtimeFeatures();
+    #ifdef CORRADE_ENABLE_SSE2
+    if(features & Cpu::Sse2) return rowDelta32F4Sse2;
+    #endif
+    static_cast<void>(features);
+    return nullptr;
+}
+
+/* Picks a vectorized kernel for given type and channel count, if there's
+   any. Three-channel formats have no kernel as they don't fit the vectors
+   well. */
+template<std::size_t size, class T> inline RowDeltaKernel<T> rowDeltaKernel() { return nullptr; }
+template<> inline RowDeltaKernel<UnsignedByte> rowDeltaKernel<1, UnsignedByte>() { return rowDelta8Kernel<1>(); }
+template<> inline RowDeltaKernel<UnsignedByte> rowDeltaKernel<2, UnsignedByte>() { return rowDelta8Kernel<2>(); }
+template<> inline RowDeltaKernel<UnsignedByte> rowDeltaKernel<4, UnsignedByte>() { return rowDelta8Kernel<4>(); }
+template<> inline RowDeltaKernel<Float> rowDeltaKernel<1, Float>() { return rowDelta32FKernel<1>(); }
+template<> inline RowDeltaKernel<Float> rowDeltaKernel<4, Float>() { return rowDelta32FKernel<4>(); }
+
+template<std::size_t size, class T> Float calculateImageDelta(const Containers::StridedArrayView3D<const char>& actualPixels, const Containers::StridedArrayView3D<const char>& expectedPixels, const Containers::StridedArrayView2D<Float>& output) {
+    const Containers::StridedArrayView2D<const Math::Vector<size, T>> actual = Containers::arrayCast<2, const Math::Vector<size, T>>(actualPixels);
+    const Containers::StridedArrayView2D<const Math::Vector<size, T>> expected = Containers::arrayCast<2, const Math::Vector<size, T>>(expectedPixels);
     CORRADE_INTERNAL_ASSERT(actual.size() == output.size());
     CORRADE_INTERNAL_ASSERT(output.size() == expected.size());
 
-    /* Calculate deltas and maximal value of them */
+    /* Picked just once for each type */
+    static const RowDeltaKernel<T> kernel = rowDeltaKernel<size, T>();
+
     Float max{};
     for(std::size_t i = 0, iMax = expected.size()[0]; i != iMax; ++i) {
-        Containers::StridedArrayView1D<const Math::Vector<size, T>> actualRow = actual[i];
-        Containers::StridedArrayView1D<const Math::Vector<size, T>> expectedRow = expected[i];
-        Containers::StridedArrayView1D<Float> outputRow = output[i];
-
-        for(std::size_t j = 0, jMax = expectedRow.size(); j != jMax; ++j) {
-            /* Explicitly convert from T to Float */
-            auto actualPixel = Math::Vector<size, Float>(actualRow[j]);
-            auto expectedPixel = Math::Vector<size, Float>(expectedRow[j]);
-
-            Math::Vector<size, Float> diff = Math::abs(actualPixel - expectedPixel);
-            outputRow[j] = diff.sum()/size;
-            max = Math::max(max, outputRow[j]);
+        const Containers::StridedArrayView1D<const Math::Vector<size, T>> actualRow = actual[i];
+        const Containers::StridedArrayView1D<const Math::Vector<size, T>> expectedRow = expected[i];
+        const Containers::StridedArrayView1D<Float> outputRow = output[i];
+
+        /* Use the vectorized kernel for as much of the row as possible if the
+           rows are contiguous, the rest or everything else goes through the
+           scalar code */
+        std::size_t offset = 0;
+        if(kernel && actualRow.isContiguous() && expectedRow.isContiguous() && outputRow.isContiguous()) {
+            const Containers::Pair<std::size_t, Float> processedMax = kernel(
+                static_cast<const T*>(actualRow.data()),
+                static_cast<const T*>(expectedRow.data()),
+                static_cast<Float*>(outputRow.data()), outputRow.size());
+            offset = processedMax.first();
+            max = Math::max(max, processedMax.second());
         }
+
+        max = Math::max(max, calculateRowDeltaScalar<size, T>(actualRow.exceptPrefix(offset), expectedRow.exceptPrefix(offset), outputRow.exceptPrefix(offset)));
     }
 
     return max;
@@ -125,7 +338,7 @@ template<std::size_t size, class T, typename std::enable_if<Math::IsIntegral<T>:
 
 }
 
-Containers::Triple<Containers::Array<Float>, Float, Float> calculateImageDelta(const PixelFormat actualFormat, const Containers::StridedArrayView3D<const char>& actualPixels, const ImageView2D& expected) {
+Containers::Triple<Containers::Array<Float>, Float, Float> calculateImageDelta(const PixelFormat actualFormat, const Containers::StridedArrayView3D<const char>& actualPixels, const ImageView2D& expected, const UnsignedInt threadCount) {
     /* Calculate a delta image */
     Containers::Array<Float> deltaData{NoInit,
         std::size_t(expected.size().product())};
@@ -143,37 +356,29 @@ Containers::Triple<Containers::Array<Float>, Float, Float> calculateImageDelta(c
     #pragma GCC diagnostic push
     #pragma GCC diagnostic error "-Wswitch"
     #endif
-    Float max{Constants::nan()};
+    Float(*function)(const Containers::StridedArrayView3D<const char>&, const Containers::StridedArrayView3D<const char>&, const Containers::StridedArrayView2D<Float>&) = nullptr;
     switch(expected.format()) {
         #define _c(format, size, T)                                         \
             case PixelFormat::format:                                       \
-                max = calculateImageDelta<size, T>(                         \
-                    Containers::arrayCast<2, const Math::Vector<size, T>>(actualPixels), \
-                    expected.pixels<Math::Vector<size, T>>(), delta);       \
+                function = calculateImageDelta<size, T>;                    \
                 break;
         #define _d(first, second, size, T)                                  \
             case PixelFormat::first:                                        \
             case PixelFormat::second:                                       \
-                max = calculateImageDelta<size, T>(                         \
-                    Containers::arrayCast<2, const Math::Vector<size, T>>(actualPixels), \
-                    expected.pixels<Math::Vector<size, T>>(), delta);       \
+                function = calculateImageDelta<size, T>;                    \
                 break;
         #define _e(first, second, third, size, T)                           \
             case PixelFormat::first:                                        \
             case PixelFormat::second:                                       \
             case PixelFormat::third:                                        \
-                max = calculateImageDelta<size, T>(                         \
-                    Containers::arrayCast<2, const Math::Vector<size, T>>(actualPixels), \
-                    expected.pixels<Math::Vector<size, T>>(), delta);       \
+                function = calculateImageDelta<size, T>;                    \
                 break;
         #define _f(first, second, third, fourth, size, T)                   \
             case PixelFormat::first:                                        \
             case PixelFormat::second:                                       \
             case PixelFormat::third:                                        \
             case PixelFormat::fourth:                                       \
-                max = calculateImageDelta<size, T>(                         \
-                    Containers::arrayCast<2, const Math::Vector<size, T>>(actualPixels), \
-                    expected.pixels<Math::Vector<size, T>>(), delta);       \
+                function = calculateImageDelta<size, T>;                    \
                 break;
         /* LCOV_EXCL_START */
         _f(R8Unorm, R8Srgb, R8UI, Stencil8UI, 1, UnsignedByte)
@@ -223,14 +428,30 @@ Containers::Triple<Containers::Array<Float>, Float, Float> calculateImageDelta(c
     #pragma GCC diagnostic pop
     #endif
 
-    CORRADE_ASSERT(max == max,
+    CORRADE_ASSERT(function,
         "DebugTools::CompareImage: unknown format" << expected.format(), {});
 
+    /* Split the image among threads by row ranges, each calculating max for
+       its own range. The max is then combined from all ranges, giving the
+       same result regardless of the thread count. */
+    const std::size_t rowCount = delta.size()[0];
+    const Containers::StridedArrayView3D<const char> expectedPixels = expected.pixels();
+    Containers::Array<Float> maxes{ValueInit, Magnum::Implementation::parallelThreadCount(threadCount, rowCount)};
+    Magnum::Implementation::parallelFor(rowCount, threadCount, [&](const std::size_t begin, const std::size_t end, const UnsignedInt thread) {
+        maxes[thread] = function(
+            actualPixels.slice(begin, end),
+            expectedPixels.slice(begin, end),
+            delta.slice(begin, end));
+    });
+    Float max{};
+    for(const Float i: maxes) max = Math::max(max, i);
+
     /* Calculate mean delta. Do it the special way so we don't lose
        precision -- that would result in having false negatives! This
        *deliberately* leaves specials in. The `max` has them already filtered
        out so if this would filter them out as well, there would be nothing
-       left that could cause the comparison to fail. */
+       left that could cause the comparison to fail. Done serially after
+       all threads finish so the result doesn't depend on the thread count. */
     const Float mean = Math::Algorithms::kahanSum(deltaData.begin(), deltaData.end())/deltaData.size();
 
     return {Utility::move(deltaData), max, mean};
@@ -384,33 +605,56 @@ void printPixelAt(Debug& out, const Containers::StridedArrayView3D<const char>&
 }
 
 void printPixelDeltas(Debug& out, Containers::ArrayView<const Float> delta, PixelFormat format, const Containers::StridedArrayView3D<const char>& actualPixels, const Containers::StridedArrayView3D<const char>& expectedPixels, const Float maxThreshold, const Float meanThreshold, std::size_t maxCount) {
-    /* Find first maxCount values above mean threshold and put them into a
-       sorted map. Need to reverse the condition in order to catch NaNs. */
-    std::multimap<Float, std::size_t> large;
-    for(std::size_t i = 0; i != delta.size(); ++i)
-        if(!(delta[i] <= meanThreshold)) large.emplace(delta[i], i);
+    /* Ordering of the deltas for printing. NaN and infinity deltas go first,
+       then the rest from the largest, pixels with the same delta from the
+       last. Returns true if `a` should be printed before `b`. */
+    const auto printedBefore = [&delta](const std::size_t a, const std::size_t b) {
+        const bool aSpecial = Math::isNan(delta[a]) || Math::isInf(delta[a]);
+        const bool bSpecial = Math::isNan(delta[b]) || Math::isInf(delta[b]);
+        if(aSpecial != bSpecial) return aSpecial;
+        if(!aSpecial && delta[a] != delta[b]) return delta[a] > delta[b];
+        return a > b;
+    };
+
+    /* Keep maxCount values above mean threshold in a heap with the one that
+       would be printed last on top, so the memory use is bounded by maxCount
+       and not by the count of outliers. Need to reverse the condition in
+       order to catch NaNs. */
+    Containers::Array<std::size_t> large{NoInit, Math::min(maxCount, delta.size())};
+    std::size_t largeCount = 0;
+    std::size_t count = 0;
+    for(std::size_t i = 0; i != delta.size(); ++i) {
+        if(delta[i] <= meanThreshold) continue;
+
+        ++count;
+        if(largeCount < large.size()) {
+            large[largeCount++] = i;
+            std::push_heap(large.begin(), large.begin() + largeCount, printedBefore);
+        } else if(largeCount && printedBefore(i, large[0])) {
+            std::pop_heap(large.begin(), large.end(), printedBefore);
+            large.back() = i;
+            std::push_heap(large.begin(), large.end(), printedBefore);
+        }
+    }
 
     /* If there's no outliers, don't print anything. This can happen only when
        --verbose is used. */
-    if(large.empty()) return;
+    if(!count) return;
 
     /* If there are outliers, adding a newline to separate itself from the
        delta image -- calling code wouldn't know if we produce output or not,
        so it can't do that on its own. */
     out << Debug::newline;
 
-    if(large.size() > maxCount)
-        out << "        Top" << maxCount << "out of" << large.size() << "pixels above max/mean threshold:";
+    if(count > maxCount)
+        out << "        Top" << maxCount << "out of" << count << "pixels above max/mean threshold:";
     else
         out << "        Pixels above max/mean threshold:";
 
-    /* Print the values from largest to smallest. Branching on the done in the
-       inner loop but that doesn't matter as we always print just ~10 values. */
-    std::size_t count = 0;
-    for(auto it = large.crbegin(); it != large.crend(); ++it) {
-        if(++count > maxCount) break;
-
-        const Containers::Pair<Int, Int> div = Math::div(Int(it->second), Int(expectedPixels.size()[1]));
+    /* Print the values from largest to smallest */
+    std::sort_heap(large.begin(), large.begin() + largeCount, printedBefore);
+    for(const std::size_t i: large.prefix(largeCount)) {
+        const Containers::Pair<Int, Int> div = Math::div(Int(i), Int(expectedPixels.size()[1]));
         const Vector2i pos{div.second(), div.first()};
         out << Debug::newline << "          [" << Debug::nospace << pos.x()
             << Debug::nospace << "," << Debug::nospace << pos.y()
@@ -422,8 +666,8 @@ void printPixelDeltas(Debug& out, Containers::ArrayView<const Float> delta, Pixe
 
         printPixelAt(out, expectedPixels, pos, format);
 
-        out << "(Δ =" << Debug::boldColor(delta[it->second] > maxThreshold ?
-            Debug::Color::Red : Debug::Color::Yellow) << delta[it->second]
+        out << "(Δ =" << Debug::boldColor(delta[i] > maxThreshold ?
+            Debug::Color::Red : Debug::Color::Yellow) << delta[i]
             << Debug::nospace << Debug::resetColor << ")";
     }
 }
@@ -481,6 +725,7 @@ class ImageComparatorBase::State {
         Containers::Optional<ImageView2D> expectedImage;
 
         Float maxThreshold, meanThreshold;
+        UnsignedInt threadCount{1};
         Result result{};
         Float max{}, mean{};
         Containers::Array<Float> delta;
@@ -496,6 +741,10 @@ ImageComparatorBase::ImageComparatorBase(PluginManager::Manager<Trade::AbstractI
 
 ImageComparatorBase::~ImageComparatorBase() = default;
 
+void ImageComparatorBase::setThreadCount(const UnsignedInt count) {
+    _state->threadCount = count;
+}
+
 TestSuite::ComparisonStatusFlags ImageComparatorBase::compare(const PixelFormat actualFormat, const Containers::StridedArrayView3D<const char>& actualPixels, const ImageView2D& expected) {
     /* The reference can be pointing to the storage, don't call the assignment
        on itself in that case */
@@ -516,7 +765,7 @@ TestSuite::ComparisonStatusFlags ImageComparatorBase::compare(const PixelFormat
         return TestSuite::ComparisonStatusFlag::Failed;
     }
 
-    Containers::Triple<Containers::Array<Float>, Float, Float> deltaMaxMean = DebugTools::Implementation::calculateImageDelta(actualFormat, actualPixels, expected);
+    Containers::Triple<Containers::Array<Float>, Float, Float> deltaMaxMean = DebugTools::Implementation::calculateImageDelta(actualFormat, actualPixels, expected, _state->threadCount);
     _state->max = deltaMaxMean.second();
     _state->mean = deltaMaxMean.third();
 
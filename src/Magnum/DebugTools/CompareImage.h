@@ -49,7 +49,7 @@
 namespace Magnum { namespace DebugTools {
 
 namespace Implementation {
-    MAGNUM_DEBUGTOOLS_EXPORT Containers::Triple<Containers::Array<Float>, Float, Float> calculateImageDelta(PixelFormat actualFormat, const Containers::StridedArrayView3D<const char>& actualPixels, const ImageView2D& expected);
+    MAGNUM_DEBUGTOOLS_EXPORT Containers::Triple<Containers::Array<Float>, Float, Float> calculateImageDelta(PixelFormat actualFormat, const Containers::StridedArrayView3D<const char>& actualPixels, const ImageView2D& expected, UnsignedInt threadCount = 1);
 
     MAGNUM_DEBUGTOOLS_EXPORT void printDeltaImage(Debug& out, Containers::ArrayView<const Float> delta, const Vector2i& size, Float max, Float maxThreshold, Float meanThreshold);
 
@@ -75,6 +75,8 @@ class MAGNUM_DEBUGTOOLS_EXPORT ImageComparatorBase {
 
         ~ImageComparatorBase();
 
+        void setThreadCount(UnsignedInt count);
+
         TestSuite::ComparisonStatusFlags operator()(const ImageView2D& actual, const ImageView2D& expected);
 
         TestSuite::ComparisonStatusFlags operator()(Containers::StringView actual, Containers::StringView expected);
@@ -307,7 +309,27 @@ For floating-point input, the comparator treats the values similarly to how
     the comparison to fail.
 
 For the ASCII-art representation, NaN and infinity @f$ \Delta_{\boldsymbol{p}} @f$
-values are always treated as maximum difference.
+values are always treated as maximum difference. In the list of top deltas
+they're listed first.
+
+@section DebugTools-CompareImage-multithreading Multithreaded comparison
+
+By default the delta is calculated on the calling thread. For large images,
+such as when comparing many high-resolution renders, the calculation can be
+split among multiple threads by row ranges with @ref setThreadCount():
+
+@snippet DebugTools.cpp CompareImage-threads
+
+The calculated delta, max and mean values are the same regardless of the
+thread count. See @ref features-multithreading for more information.
+
+Independently of the thread count, contiguous rows of 8-bit pixels with one,
+two or four channels are processed with SSE2 or NEON and contiguous rows of
+32-bit floating-point pixels with one or four channels with SSE2, if
+available. The results are again the same as with the scalar code. For the
+list of top deltas only as many outliers as are printed are remembered, so
+comparing two completely different large images doesn't allocate memory
+proportional to the image size for it.
 
 @section DebugTools-CompareImage-pixels Comparing against pixel views
 
@@ -359,6 +381,20 @@ class CompareImage {
          */
         explicit CompareImage(): _c{0.0f, 0.0f} {}
 
+        /**
+         * @brief Set the number of threads used for calculating the delta
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * If @cpp 1 @ce, which is the default, the delta is calculated on the
+         * calling thread, @cpp 0 @ce means all hardware threads. See
+         * @ref DebugTools-CompareImage-multithreading for more information.
+         */
+        CompareImage& setThreadCount(UnsignedInt count) {
+            _c.setThreadCount(count);
+            return *this;
+        }
+
         #ifndef DOXYGEN_GENERATING_OUTPUT
         TestSuite::Comparator<CompareImage>& comparator() {
             return _c;
@@ -474,6 +510,18 @@ class CompareImageFile {
          */
         explicit CompareImageFile(): _c{nullptr, nullptr, 0.0f, 0.0f} {}
 
+        /**
+         * @brief Set the number of threads used for calculating the delta
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * See @ref CompareImage::setThreadCount() for more information.
+         */
+        CompareImageFile& setThreadCount(UnsignedInt count) {
+            _c.setThreadCount(count);
+            return *this;
+        }
+
         #ifndef DOXYGEN_GENERATING_OUTPUT
         TestSuite::Comparator<CompareImageFile>& comparator() {
             return _c;
@@ -546,6 +594,18 @@ class CompareImageToFile {
          */
         explicit CompareImageToFile(): _c{nullptr, nullptr, 0.0f, 0.0f} {}
 
+        /**
+         * @brief Set the number of threads used for calculating the delta
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * See @ref CompareImage::setThreadCount() for more information.
+         */
+        CompareImageToFile& setThreadCount(UnsignedInt count) {
+            _c.setThreadCount(count);
+            return *this;
+        }
+
         #ifndef DOXYGEN_GENERATING_OUTPUT
         TestSuite::Comparator<CompareImageToFile>& comparator() {
             return _c;
@@ -601,6 +661,18 @@ class CompareFileToImage {
          */
         explicit CompareFileToImage(): _c{nullptr, 0.0f, 0.0f} {}
 
+        /**
+         * @brief Set the number of threads used for calculating the delta
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * See @ref CompareImage::setThreadCount() for more information.
+         */
+        CompareFileToImage& setThreadCount(UnsignedInt count) {
+            _c.setThreadCount(count);
+            return *this;
+        }
+
         #ifndef DOXYGEN_GENERATING_OUTPUT
         TestSuite::Comparator<CompareFileToImage>& comparator() {
             return _c;
@@ -33,6 +33,7 @@
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
 #include <Corrade/TestSuite/Compare/File.h>
+#include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/Format.h>
 #include <Corrade/Utility/Path.h>
 #include <Corrade/Utility/String.h> /* replaceFirst() */
@@ -64,6 +65,8 @@ struct CompareImageTest: TestSuite::Tester {
     void calculateDeltaStorage();
     void calculateDeltaSpecials();
     void calculateDeltaSpecials3();
+    void calculateDeltaVectorized();
+    void calculateDeltaThreads();
 
     void deltaImage();
     void deltaImageScaling();
@@ -86,6 +89,7 @@ struct CompareImageTest: TestSuite::Tester {
     void compareSpecials();
     void compareSpecialsMeanOnly();
     void compareSpecialsDisallowedThreshold();
+    void compareThreads();
 
     void setupExternalPluginManager();
     void teardownExternalPluginManager();
@@ -144,6 +148,27 @@ const struct {
     {"sRGB", true}
 };
 
+const struct {
+    const char* name;
+    PixelFormat format;
+} CalculateDeltaVectorizedData[]{
+    {"R8Unorm", PixelFormat::R8Unorm},
+    {"RG8Unorm", PixelFormat::RG8Unorm},
+    {"RGB8Unorm", PixelFormat::RGB8Unorm},
+    {"RGBA8Unorm", PixelFormat::RGBA8Unorm},
+    {"R32F", PixelFormat::R32F},
+    {"RGBA32F", PixelFormat::RGBA32F},
+};
+
+const struct {
+    const char* name;
+    UnsignedInt threadCount;
+} CalculateDeltaThreadsData[]{
+    {"two threads", 2},
+    {"five threads", 5},
+    {"all hardware threads", 0},
+};
+
 CompareImageTest::CompareImageTest() {
     addTests({&CompareImageTest::formatUnknown,
               &CompareImageTest::formatPackedDepthStencil,
@@ -153,9 +178,15 @@ CompareImageTest::CompareImageTest() {
               &CompareImageTest::calculateDeltaInteger,
               &CompareImageTest::calculateDeltaStorage,
               &CompareImageTest::calculateDeltaSpecials,
-              &CompareImageTest::calculateDeltaSpecials3,
+              &CompareImageTest::calculateDeltaSpecials3});
+
+    addInstancedTests({&CompareImageTest::calculateDeltaVectorized},
+        Containers::arraySize(CalculateDeltaVectorizedData));
+
+    addInstancedTests({&CompareImageTest::calculateDeltaThreads},
+        Containers::arraySize(CalculateDeltaThreadsData));
 
-              &CompareImageTest::deltaImage,
+    addTests({&CompareImageTest::deltaImage,
               &CompareImageTest::deltaImageScaling,
               &CompareImageTest::deltaImageColors,
               &CompareImageTest::deltaImageSpecials,
@@ -176,6 +207,7 @@ CompareImageTest::CompareImageTest() {
               &CompareImageTest::compareSpecials,
               &CompareImageTest::compareSpecialsMeanOnly,
               &CompareImageTest::compareSpecialsDisallowedThreshold,
+              &CompareImageTest::compareThreads,
 
               &CompareImageTest::imageZeroDelta,
               &CompareImageTest::imageNonZeroDelta,
@@ -455,6 +487,94 @@ void CompareImageTest::calculateDeltaSpecials3() {
     CORRADE_COMPARE(deltaMaxMean.third(), -Constants::nan());
 }
 
+void CompareImageTest::calculateDeltaVectorized() {
+    auto&& data = CalculateDeltaVectorizedData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Pseudo-random data in a size that isn't a multiple of the vector size,
+       so the scalar fallback gets used for the rest of each row */
+    const Vector2i size{37, 5};
+    const std::size_t pixelSize = pixelFormatSize(data.format);
+    Containers::Array<char> actualData{NoInit, pixelSize*size.product()};
+    Containers::Array<char> expectedData{NoInit, pixelSize*size.product()};
+    UnsignedInt seed = 1;
+    for(std::size_t i = 0; i != actualData.size(); ++i) {
+        seed = seed*1103515245u + 12345u;
+        actualData[i] = char(seed >> 16);
+        /* Make roughly every other value the same in both */
+        expectedData[i] = seed & 0x100 ? actualData[i] : char(seed >> 24);
+    }
+
+    /* For floats make sure there are specials in the vectorized part. Random
+       bytes may produce them as well, but not reliably. */
+    if(data.format == PixelFormat::R32F || data.format == PixelFormat::RGBA32F) {
+        const Containers::ArrayView<Float> actualFloats = Containers::arrayCast<Float>(actualData);
+        const Containers::ArrayView<Float> expectedFloats = Containers::arrayCast<Float>(expectedData);
+        actualFloats[0] = Constants::nan();
+        expectedFloats[0] = Constants::nan();
+        actualFloats[1] = Constants::inf();
+        expectedFloats[1] = Constants::inf();
+        actualFloats[2] = -Constants::inf();
+        expectedFloats[2] = Constants::inf();
+        actualFloats[3] = Constants::nan();
+        expectedFloats[3] = 1.0f;
+    }
+
+    /* The same actual data with pixels in each row in reverse order. Viewing
+       it flipped gives back the original, but with a negative stride, which
+       means the scalar code gets used for all pixels */
+    Containers::Array<char> actualReversedData{NoInit, actualData.size()};
+    Utility::copy(
+        Containers::StridedArrayView3D<const char>{actualData, {std::size_t(size.y()), std::size_t(size.x()), pixelSize}},
+        Containers::StridedArrayView3D<char>{actualReversedData, {std::size_t(size.y()), std::size_t(size.x()), pixelSize}}.flipped<1>());
+
+    const ImageView2D actual{PixelStorage{}.setAlignment(1), data.format, size, actualData};
+    const ImageView2D actualReversed{PixelStorage{}.setAlignment(1), data.format, size, actualReversedData};
+    const ImageView2D expected{PixelStorage{}.setAlignment(1), data.format, size, expectedData};
+
+    Containers::Triple<Containers::Array<Float>, Float, Float> deltaMaxMean = Implementation::calculateImageDelta(data.format, actual.pixels(), expected);
+    Containers::Triple<Containers::Array<Float>, Float, Float> scalarDeltaMaxMean = Implementation::calculateImageDelta(data.format, actualReversed.pixels().flipped<1>(), expected);
+
+    /* The output should be bit-exact */
+    CORRADE_COMPARE_AS(deltaMaxMean.first(),
+        scalarDeltaMaxMean.first(),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(deltaMaxMean.second(), scalarDeltaMaxMean.second());
+    if(data.format == PixelFormat::R32F || data.format == PixelFormat::RGBA32F)
+        CORRADE_VERIFY(Math::isNan(deltaMaxMean.third()));
+    else
+        CORRADE_COMPARE(deltaMaxMean.third(), scalarDeltaMaxMean.third());
+}
+
+void CompareImageTest::calculateDeltaThreads() {
+    auto&& data = CalculateDeltaThreadsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* A gradient and a slightly different gradient, with a height that
+       doesn't split evenly among threads */
+    const Vector2i size{67, 41};
+    Containers::Array<Color4ub> actualData{NoInit, std::size_t(size.product())};
+    Containers::Array<Color4ub> expectedData{NoInit, std::size_t(size.product())};
+    for(Int y = 0; y != size.y(); ++y) {
+        for(Int x = 0; x != size.x(); ++x) {
+            actualData[y*size.x() + x] = Color4ub(x*3, y*5, x + y, 255);
+            expectedData[y*size.x() + x] = Color4ub(x*3 + (x*y) % 7, y*5, x + y - (x % 3), 255);
+        }
+    }
+    const ImageView2D actual{PixelFormat::RGBA8Unorm, size, actualData};
+    const ImageView2D expected{PixelFormat::RGBA8Unorm, size, expectedData};
+
+    Containers::Triple<Containers::Array<Float>, Float, Float> expectedDeltaMaxMean = Implementation::calculateImageDelta(actual.format(), actual.pixels(), expected, 1);
+    Containers::Triple<Containers::Array<Float>, Float, Float> deltaMaxMean = Implementation::calculateImageDelta(actual.format(), actual.pixels(), expected, data.threadCount);
+
+    /* The output should be bit-exact */
+    CORRADE_COMPARE_AS(deltaMaxMean.first(),
+        expectedDeltaMaxMean.first(),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(deltaMaxMean.second(), expectedDeltaMaxMean.second());
+    CORRADE_COMPARE(deltaMaxMean.third(), expectedDeltaMaxMean.third());
+}
+
 void CompareImageTest::deltaImage() {
     Containers::Array<Float> delta{32*32};
 
@@ -762,6 +882,31 @@ void CompareImageTest::compareAboveMaxThreshold() {
         "          [1,1] #abcd85, expected #abcdfa (Δ = 39)\n");
 }
 
+void CompareImageTest::compareThreads() {
+    Containers::String out;
+
+    /* Same as compareAboveMaxThreshold(), just with the delta calculated on
+       multiple threads */
+    {
+        TestSuite::Comparator<CompareImage> compare{30.0f, 20.0f};
+        compare.setThreadCount(2);
+        TestSuite::ComparisonStatusFlags flags = compare(ActualRgb, ExpectedRgb);
+        CORRADE_COMPARE(flags, TestSuite::ComparisonStatusFlag::Failed);
+        Debug d{&out, Debug::Flag::DisableColors};
+        compare.printMessage(flags, d, "a", "b");
+    }
+
+    CORRADE_COMPARE(out,
+        "Images a and b have max delta above threshold, actual 39 but at most 30 expected. Mean delta 18.5 is within threshold 20. Delta image:\n"
+        "          |?M|\n"
+        "        Pixels above max/mean threshold:\n"
+        "          [1,1] #abcd85, expected #abcdfa (Δ = 39)\n");
+
+    /* The setter should be chainable on the pseudo-type */
+    CORRADE_COMPARE_WITH(ActualRgb, ActualRgb,
+        (CompareImage{}.setThreadCount(0)));
+}
+
 void CompareImageTest::compareAboveMeanThreshold() {
     Containers::String out;
 
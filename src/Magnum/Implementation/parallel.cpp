@@ -0,0 +1,73 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "parallel.h"
+
+#include <Corrade/Containers/Array.h>
+
+/* Emscripten without -pthread has the <thread> header but spawning a thread
+   fails at runtime */
+#if !defined(CORRADE_TARGET_EMSCRIPTEN) || defined(__EMSCRIPTEN_PTHREADS__)
+#define MAGNUM_PARALLEL_USE_THREADS
+#include <thread>
+#endif
+
+namespace Magnum { namespace Implementation {
+
+UnsignedInt parallelThreadCount(UnsignedInt threadCount, const std::size_t count) {
+    #ifdef MAGNUM_PARALLEL_USE_THREADS
+    /* hardware_concurrency() is allowed to return 0 if it can't tell */
+    if(!threadCount) threadCount = std::thread::hardware_concurrency();
+    if(threadCount > count) threadCount = count;
+    return threadCount ? threadCount : 1;
+    #else
+    static_cast<void>(threadCount);
+    static_cast<void>(count);
+    return 1;
+    #endif
+}
+
+void parallelFor(const std::size_t count, const UnsignedInt threadCount, void(*const function)(void*, std::size_t, std::size_t, UnsignedInt), void* const state) {
+    const UnsignedInt actualThreadCount = parallelThreadCount(threadCount, count);
+
+    /* Range `i` is [count*i/n, count*(i + 1)/n). Doing the multiplication
+       first so the ranges are balanced even for small counts. */
+    #ifdef MAGNUM_PARALLEL_USE_THREADS
+    Containers::Array<std::thread> threads{actualThreadCount - 1};
+    for(UnsignedInt i = 1; i < actualThreadCount; ++i)
+        threads[i - 1] = std::thread{function, state,
+            count*i/actualThreadCount,
+            count*(i + 1)/actualThreadCount, i};
+    #endif
+
+    function(state, 0, count/actualThreadCount, 0);
+
+    #ifdef MAGNUM_PARALLEL_USE_THREADS
+    for(std::thread& thread: threads) thread.join();
+    #endif
+}
+
+}}
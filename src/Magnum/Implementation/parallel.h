@@ -0,0 +1,69 @@
+#ifndef Magnum_Implementation_parallel_h
+#define Magnum_Implementation_parallel_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstddef>
+#include <type_traits>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum { namespace Implementation {
+
+/* Common helper for the opt-in multithreaded code paths in MeshTools,
+   SceneTools, TextureTools and elsewhere. There's deliberately no persistent
+   thread pool, the threads are spawned for each call and joined before
+   returning, so the algorithms stay free of any global state.
+
+   If `threadCount` is 0, returns std::thread::hardware_concurrency(),
+   otherwise `threadCount`, in both cases clamped to `count` and to at least
+   one. On platforms without thread support (such as Emscripten builds without
+   -pthread) always returns 1. The result is the number of ranges the
+   `parallelFor()` below splits the work into, use it for sizing per-thread
+   scratch storage. */
+MAGNUM_EXPORT UnsignedInt parallelThreadCount(UnsignedInt threadCount, std::size_t count);
+
+/* Splits `[0, count)` into parallelThreadCount(threadCount, count)
+   contiguous ranges of (roughly) the same size and calls
+   `function(state, begin, end, thread)` for each. The first range is
+   executed on the calling thread, the function returns after all ranges
+   are done. The partitioning depends only on the `count` and the resolved
+   thread count, so per-range results can be combined deterministically. */
+MAGNUM_EXPORT void parallelFor(std::size_t count, UnsignedInt threadCount, void(*function)(void*, std::size_t, std::size_t, UnsignedInt), void* state);
+
+/* Convenience wrapper for lambdas. The functor is called as
+   `function(begin, end, thread)`. */
+template<class F> void parallelFor(const std::size_t count, const UnsignedInt threadCount, F&& function) {
+    typedef typename std::remove_reference<F>::type Function;
+    parallelFor(count, threadCount, [](void* state, std::size_t begin, std::size_t end, UnsignedInt thread) {
+        (*static_cast<Function*>(state))(begin, end, thread);
+    }, const_cast<void*>(static_cast<const void*>(&function)));
+}
+
+}}
+
+#endif
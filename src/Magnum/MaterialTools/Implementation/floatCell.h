@@ -0,0 +1,80 @@
+#ifndef Magnum_MaterialTools_Implementation_floatCell_h
+#define Magnum_MaterialTools_Implementation_floatCell_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/TypeTraits.h"
+
+/* Used by removeDuplicates*() and tested directly in RemoveDuplicatesTest, so
+   it's just a header and an anonymous namespace to avoid clashes */
+namespace Magnum { namespace MaterialTools { namespace Implementation { namespace {
+
+/* Float attributes are compared with TypeTraits<Float>::equals(), which isn't
+   transitive, so their bits can't be hashed directly. Instead, each value is
+   assigned a cell, with cells being contiguous monotonic ranges. Values below
+   1.03125 in magnitude, where the fuzzy compare uses an absolute epsilon, are
+   put on a linear grid with 64 cells per unit. Larger values, where it's
+   relative, on a logarithmic grid with 16 cells per power of two, made from
+   the exponent and four topmost mantissa bits. The two ranges don't overlap,
+   as the linear cells are at most 66 and the logarithmic cells all at least
+   2033 in magnitude.
+
+   Both grids are shifted by half a cell so round values such as 0, 0.25, 0.5,
+   1 or 2, which are the most common in materials, are in the middle of a cell
+   and not on its boundary, where they would be treated as unsafe by
+   floatCellSafe() below. For the same reason the switch between the two
+   grids is at 1.03125, which is a logarithmic cell boundary, and not at 1. */
+Long floatCell(const Float value) {
+    if(Math::abs(value) < 1.03125f)
+        return Long(Math::floor(value*64.0f + 0.5f));
+
+    UnsignedInt bits;
+    std::memcpy(&bits, &value, 4);
+    const Long cell = ((bits & 0x7fffffffu) + (1u << 18)) >> 19;
+    return bits & 0x80000000u ? -cell : cell;
+}
+
+/* Returns true if all values closer than `margin` fuzzy compare tolerances to
+   `value` are in the same cell as `value` itself. Two values that compare
+   equal are never further apart than two epsilons relative to the larger of 1
+   and the value magnitude, so one tolerance is that with some slack for
+   rounding errors. NaNs and infinities are never safe, they go through the
+   slow path. */
+bool floatCellSafe(const Float value, const Float margin) {
+    if(!(Math::abs(value) < Constants::inf()))
+        return false;
+
+    const Float tolerance = margin*4.0f*Math::TypeTraits<Float>::epsilon()*Math::max(1.0f, Math::abs(value));
+    return floatCell(value - tolerance) == floatCell(value + tolerance);
+}
+
+}}}}
+
+#endif
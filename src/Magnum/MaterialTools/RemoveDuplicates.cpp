@@ -26,11 +26,15 @@
 
 #include "RemoveDuplicates.h"
 
+#include <cstring>
+#include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/Iterable.h>
+#include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/StridedArrayView.h>
 
 #include "Magnum/MaterialTools/Implementation/attributesEqual.h"
+#include "Magnum/MaterialTools/Implementation/floatCell.h"
 #include "Magnum/Trade/MaterialData.h"
 
 namespace Magnum { namespace MaterialTools {
@@ -75,29 +79,236 @@ bool materialEqual(const Trade::MaterialData& a, const Trade::MaterialData& b) {
     return true;
 }
 
+/* FNV-1a, with the 64-bit variant on 64-bit platforms */
+#ifdef CORRADE_TARGET_32BIT
+constexpr std::size_t HashOffset = 2166136261u;
+constexpr std::size_t HashPrime = 16777619u;
+#else
+constexpr std::size_t HashOffset = 14695981039346656037ull;
+constexpr std::size_t HashPrime = 1099511628211ull;
+#endif
+
+void hashBytes(std::size_t& hash, const void* const data, const std::size_t size) {
+    const char* const bytes = static_cast<const char*>(data);
+    for(std::size_t i = 0; i != size; ++i) {
+        hash ^= UnsignedByte(bytes[i]);
+        hash *= HashPrime;
+    }
+}
+
+template<class T> void hashValue(std::size_t& hash, const T& value) {
+    hashBytes(hash, &value, sizeof(T));
+}
+
+/* Hash of a material consistent with materialEqual(), i.e. materials that
+   compare equal have the same hash. The `exact` hash includes everything
+   except float attribute values, the `full` hash additionally includes cells
+   of all float values. The full hash is usable for insertion if all float
+   values are at least one tolerance away from a cell boundary, and for lookup
+   if they're at least three tolerances away. In that case, all materials
+   that compare equal are guaranteed to be in the same cells and insertable,
+   thus having the same full hash. */
+struct MaterialHash {
+    UnsignedInt exact;
+    UnsignedInt full;
+    bool insertSafe;
+    bool lookupSafe;
+};
+
+MaterialHash materialHash(const Trade::MaterialData& material) {
+    std::size_t exact = HashOffset;
+    std::size_t full = HashOffset;
+    bool insertSafe = true;
+    bool lookupSafe = true;
+
+    hashValue(exact, UnsignedInt(material.types()));
+
+    /* If the layer data are implicit, they're equivalent to a single layer
+       containing all attributes, which is what materialEqual() treats as
+       equal as well */
+    const Containers::ArrayView<const UnsignedInt> layerData = material.layerData();
+    const std::size_t attributeCount = material.attributeData().size();
+    if(layerData.isEmpty()) {
+        hashValue(exact, std::size_t{1});
+        hashValue(exact, attributeCount);
+    } else {
+        hashValue(exact, layerData.size());
+        for(const UnsignedInt offset: layerData)
+            hashValue(exact, std::size_t{offset});
+    }
+
+    for(const Trade::MaterialAttributeData& attribute: material.attributeData()) {
+        const Containers::StringView name = attribute.name();
+        const Trade::MaterialAttributeType type = attribute.type();
+        hashValue(exact, name.size());
+        hashBytes(exact, name.data(), name.size());
+        hashValue(exact, type);
+
+        #ifdef CORRADE_TARGET_GCC
+        #pragma GCC diagnostic push
+        #pragma GCC diagnostic error "-Wswitch"
+        #endif
+        switch(type) {
+            case Trade::MaterialAttributeType::Float:
+            case Trade::MaterialAttributeType::Deg:
+            case Trade::MaterialAttributeType::Rad:
+            case Trade::MaterialAttributeType::Vector2:
+            case Trade::MaterialAttributeType::Vector3:
+            case Trade::MaterialAttributeType::Vector4:
+            case Trade::MaterialAttributeType::Matrix2x2:
+            case Trade::MaterialAttributeType::Matrix2x3:
+            case Trade::MaterialAttributeType::Matrix2x4:
+            case Trade::MaterialAttributeType::Matrix3x2:
+            case Trade::MaterialAttributeType::Matrix3x3:
+            case Trade::MaterialAttributeType::Matrix3x4:
+            case Trade::MaterialAttributeType::Matrix4x2:
+            case Trade::MaterialAttributeType::Matrix4x3: {
+                /* All float types are just packed floats, compared
+                   component-wise */
+                const char* const data = static_cast<const char*>(attribute.value());
+                for(std::size_t i = 0, count = Trade::materialAttributeTypeSize(type)/4; i != count; ++i) {
+                    Float value;
+                    std::memcpy(&value, data + i*4, 4);
+                    hashValue(full, Implementation::floatCell(value));
+                    insertSafe = insertSafe && Implementation::floatCellSafe(value, 1.0f);
+                    lookupSafe = lookupSafe && Implementation::floatCellSafe(value, 3.0f);
+                }
+            } break;
+            case Trade::MaterialAttributeType::Bool:
+                hashValue(exact, attribute.value<bool>());
+                break;
+            case Trade::MaterialAttributeType::UnsignedInt:
+            case Trade::MaterialAttributeType::Int:
+            case Trade::MaterialAttributeType::UnsignedLong:
+            case Trade::MaterialAttributeType::Long:
+            case Trade::MaterialAttributeType::Vector2ui:
+            case Trade::MaterialAttributeType::Vector2i:
+            case Trade::MaterialAttributeType::Vector3ui:
+            case Trade::MaterialAttributeType::Vector3i:
+            case Trade::MaterialAttributeType::Vector4ui:
+            case Trade::MaterialAttributeType::Vector4i:
+            case Trade::MaterialAttributeType::Pointer:
+            case Trade::MaterialAttributeType::MutablePointer:
+            case Trade::MaterialAttributeType::TextureSwizzle:
+                hashBytes(exact, attribute.value(), Trade::materialAttributeTypeSize(type));
+                break;
+            case Trade::MaterialAttributeType::String: {
+                const Containers::StringView value = attribute.value<Containers::StringView>();
+                hashValue(exact, value.size());
+                hashBytes(exact, value.data(), value.size());
+            } break;
+            case Trade::MaterialAttributeType::Buffer: {
+                const Containers::ArrayView<const void> value = attribute.value<Containers::ArrayView<const void>>();
+                hashValue(exact, value.size());
+                hashBytes(exact, value.data(), value.size());
+            } break;
+        }
+        #ifdef CORRADE_TARGET_GCC
+        #pragma GCC diagnostic pop
+        #endif
+    }
+
+    hashValue(full, exact);
+    return {UnsignedInt(exact), UnsignedInt(full), insertSafe, lookupSafe};
+}
+
+/* Open-addressed hash table storing material indices together with their
+   (truncated) hash, with linear probing and no deletions. Because of that,
+   entries with the same hash are always encountered in the order they were
+   inserted, which means the first matching material found is the same as
+   with a linear scan over all unique materials. The table is sized upfront
+   for the worst case of all materials being unique with a load factor of at
+   most 0.5. */
+class HashTable {
+    public:
+        explicit HashTable(const std::size_t capacity) {
+            std::size_t slotCount = 1;
+            while(slotCount < capacity*2) slotCount <<= 1;
+            _slots = Containers::Array<Slot>{NoInit, slotCount};
+            _mask = slotCount - 1;
+            /* Sets both the hash and the value to ~UnsignedInt{}, which marks
+               the slot as empty */
+            std::memset(_slots.data(), 0xff, _slots.size()*sizeof(Slot));
+        }
+
+        /* Goes through all entries with given hash in insertion order and
+           returns the first for which `equal` returns true */
+        template<class F> Containers::Optional<UnsignedInt> find(const UnsignedInt hash, F&& equal) const {
+            for(std::size_t i = hash & _mask; ; i = (i + 1) & _mask) {
+                const Slot& slot = _slots[i];
+                if(slot.value == ~UnsignedInt{})
+                    return {};
+                if(slot.hash == hash && equal(slot.value))
+                    return slot.value;
+            }
+
+            CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+        }
+
+        void insert(const UnsignedInt hash, const UnsignedInt value) {
+            std::size_t i = hash & _mask;
+            while(_slots[i].value != ~UnsignedInt{})
+                i = (i + 1) & _mask;
+            _slots[i].hash = hash;
+            _slots[i].value = value;
+        }
+
+    private:
+        struct Slot {
+            UnsignedInt hash;
+            UnsignedInt value;
+        };
+
+        Containers::Array<Slot> _slots;
+        std::size_t _mask;
+};
+
+/* Finds a unique material equal to `material` among the ones inserted so far
+   and if there's none, inserts it with `value`. All unique materials are
+   put into the exact table, only the ones with all float values safely inside
+   a cell into the full table. If the material is safe for lookup, any equal
+   material is guaranteed to be in the full table under the same hash, if
+   not, the exact table is searched, which may contain more false positives
+   but is still far from the worst case of comparing to all materials. */
+template<class F> Containers::Pair<UnsignedInt, bool> findOrInsert(HashTable& exactTable, HashTable& fullTable, const Trade::MaterialData& material, const UnsignedInt value, F&& materialAt) {
+    const MaterialHash hash = materialHash(material);
+    const auto equal = [&](UnsignedInt i) {
+        return materialEqual(material, materialAt(i));
+    };
+
+    const Containers::Optional<UnsignedInt> found = hash.lookupSafe ?
+        fullTable.find(hash.full, equal) :
+        exactTable.find(hash.exact, equal);
+    if(found)
+        return {*found, false};
+
+    exactTable.insert(hash.exact, value);
+    if(hash.insertSafe)
+        fullTable.insert(hash.full, value);
+    return {value, true};
+}
+
 }
 
 std::size_t removeDuplicatesInPlaceInto(const Containers::Iterable<Trade::MaterialData>& materials, const Containers::StridedArrayView1D<UnsignedInt>& mapping) {
     CORRADE_ASSERT(mapping.size() == materials.size(),
         "MaterialTools::removeDuplicatesInPlaceInto(): bad output size, expected" << materials.size() << "but got" << mapping.size(), {});
 
-    /* O(n^2). As there's a lot of early returns, should be fine for a moderate
-       count of materials that differ in a significant way. Won't work well for
-       materials that are all the same except one attribute value. */
+    /* Expected O(n) with the hash tables, with materialEqual() being called
+       only for candidates with a matching hash. The values stored in the
+       tables are indices of the unique materials after they're moved to the
+       front. */
+    HashTable exactTable{materials.size()};
+    HashTable fullTable{materials.size()};
     std::size_t uniqueCount = 0;
     for(std::size_t i = 0; i != materials.size(); ++i) {
-        /* Find a material that's already in the unique set */
-        Containers::Optional<UnsignedInt> found;
-        for(std::size_t j = 0; j != uniqueCount; ++j) {
-            if(materialEqual(materials[i], materials[j])) {
-                found = j;
-                break;
-            }
-        }
+        const Containers::Pair<UnsignedInt, bool> found = findOrInsert(exactTable, fullTable, materials[i], uniqueCount, [&](UnsignedInt j) -> const Trade::MaterialData& {
+            return materials[j];
+        });
 
         /* Material found, reference its ID */
-        if(found) {
-            mapping[i] = *found;
+        if(!found.second()) {
+            mapping[i] = found.first();
 
         /* Move the material into its new location, unless it's the same
            index, and increase the number of unique materials */
@@ -121,37 +332,23 @@ std::size_t removeDuplicatesInto(const Containers::Iterable<const Trade::Materia
     CORRADE_ASSERT(mapping.size() == materials.size(),
         "MaterialTools::removeDuplicatesInto(): bad output size, expected" << materials.size() << "but got" << mapping.size(), {});
 
-    /* O(n^2). Like removeDuplicatesInPlaceInto(), but as the input material
-       list is immutable, it has to go through the already-processed prefix
-       and compare only against materials that are unique, which may add some
-       extra overhead. Another option would be to allocate a temporary array
-       with (contiguous) references to the material data, but so far I think
-       the prefix iteration is efficient enough to not need that. */
+    /* Like removeDuplicatesInPlaceInto(), but as the input material list is
+       immutable, the values stored in the tables are the original indices of
+       the unique materials */
+    HashTable exactTable{materials.size()};
+    HashTable fullTable{materials.size()};
     std::size_t uniqueCount = 0;
     for(std::size_t i = 0; i != materials.size(); ++i) {
-        /* Find a material that's already in the unique set by going through
-           the already-processed prefix and comparing only against materials
-           that are unique, i.e. for which the output index is the same as the
-           input index. */
-        Containers::Optional<UnsignedInt> found;
-        for(std::size_t j = 0; j != i; ++j) {
-            if(mapping[j] == j && materialEqual(materials[i], materials[j])) {
-                found = j;
-                break;
-            }
-        }
-
-        /* Material found, reference its ID */
-        if(found) {
-            mapping[i] = *found;
+        const Containers::Pair<UnsignedInt, bool> found = findOrInsert(exactTable, fullTable, materials[i], i, [&](UnsignedInt j) -> const Trade::MaterialData& {
+            return materials[j];
+        });
 
-        /* Otherwise the output index the same as the input index. Also
-           increase the number of unique materials which isn't used for
-           anything here except the return value. */
-        } else {
-            mapping[i] = i;
-            uniqueCount++;
-        }
+        /* If the material is new, the output index is the same as the input
+           index. Also increase the number of unique materials which isn't
+           used for anything here except the return value. */
+        mapping[i] = found.first();
+        if(found.second())
+            ++uniqueCount;
     }
 
     return uniqueCount;
@@ -56,12 +56,17 @@ output. See @ref removeDuplicates() for a variant that doesn't modify the input
 list in any way but instead returns a mapping array pointing to original data
 locations.
 
-The operation is done in an @f$ \mathcal{O}(n^2 m) @f$ complexity with
+The operation is done in an expected @f$ \mathcal{O}(nm) @f$ complexity with
 @f$ n @f$ being the material list size and @f$ m @f$ the per-material attribute
-count --- every material in the list is compared to all unique materials
-collected so far. As attributes are sorted in @ref Trade::MaterialData,
-material comparison is just a linear operation. The function doesn't allocate
-any temporary memory.
+count. A hash is calculated for every material from its types, layer offsets,
+attribute names, types and values, with floating-point values quantized in a
+way that's consistent with the fuzzy comparison, and the material is then
+compared only to unique materials with a matching hash. As attributes are
+sorted in @ref Trade::MaterialData, material comparison is just a linear
+operation. Floating-point values that are very close to a quantization
+boundary make the lookup fall back to comparing with all unique materials that
+differ only in floating-point values, which is rare in practice. The function
+allocates a temporary hash table of @f$ \mathcal{O}(n) @f$ size.
 
 The output index array can be passed to @ref SceneTools::mapIndexField() to
 update a @ref Trade::SceneField::MeshMaterial field to reference only the
@@ -103,13 +108,10 @@ only unique materials in the input array. See @ref removeDuplicatesInPlace()
 for a variant that also shifts the unique materials to the front of the list
 and for a practical usage example.
 
-The operation is done in an @f$ \mathcal{O}(n^2 m) @f$ complexity with
+The operation is done in an expected @f$ \mathcal{O}(nm) @f$ complexity with
 @f$ n @f$ being the material list size and @f$ m @f$ the per-material attribute
-count --- every material in the list is compared to all unique materials
-collected so far, by iterating the filled prefix of the output index list and
-considering only index for which the index value is the same as the index. As
-attributes are sorted in @ref Trade::MaterialData, material comparison is just
-a linear operation. The function doesn't allocate any temporary memory.
+count, see @ref removeDuplicatesInPlace() for details. The function allocates
+a temporary hash table of @f$ \mathcal{O}(n) @f$ size.
 @see @ref removeDuplicatesInto()
 */
 MAGNUM_MATERIALTOOLS_EXPORT Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicates(const Containers::Iterable<const Trade::MaterialData>& materials);
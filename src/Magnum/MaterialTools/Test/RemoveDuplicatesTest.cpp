@@ -24,16 +24,20 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Iterable.h>
+#include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
 
 #include "Magnum/DebugTools/CompareMaterial.h"
 #include "Magnum/Math/Color.h"
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/MaterialTools/RemoveDuplicates.h"
+#include "Magnum/MaterialTools/Implementation/floatCell.h"
 #include "Magnum/Trade/MaterialData.h"
 
 namespace Magnum { namespace MaterialTools { namespace Test { namespace {
@@ -62,7 +66,15 @@ struct RemoveDuplicatesTest: TestSuite::Tester {
     void inPlace();
     void inPlaceAsArray();
 
+    void manyMaterials();
+    void manyMaterialsInPlace();
+
     void invalidSize();
+
+    void floatCellSafeTypicalValues();
+    void floatCellMonotonic();
+
+    void benchmark();
 };
 
 using namespace Math::Literals;
@@ -123,6 +135,17 @@ const struct {
             Matrix3::translation({5.0f, 9.0f + Math::TypeTraits<Float>::epsilon()*20.0f})}},
 };
 
+const struct {
+    const char* name;
+    std::size_t uniqueCount;
+    bool sameExceptFloat;
+} BenchmarkData[]{
+    {"all unique", 100000, false},
+    {"all unique, differing only in a float value", 100000, true},
+    {"1000 unique", 1000, false},
+    {"1000 unique, differing only in a float value", 1000, true},
+};
+
 RemoveDuplicatesTest::RemoveDuplicatesTest() {
     addTests({&RemoveDuplicatesTest::empty,
 
@@ -148,7 +171,16 @@ RemoveDuplicatesTest::RemoveDuplicatesTest() {
               &RemoveDuplicatesTest::inPlace,
               &RemoveDuplicatesTest::inPlaceAsArray,
 
-              &RemoveDuplicatesTest::invalidSize});
+              &RemoveDuplicatesTest::manyMaterials,
+              &RemoveDuplicatesTest::manyMaterialsInPlace,
+
+              &RemoveDuplicatesTest::invalidSize,
+
+              &RemoveDuplicatesTest::floatCellSafeTypicalValues,
+              &RemoveDuplicatesTest::floatCellMonotonic});
+
+    addInstancedBenchmarks({&RemoveDuplicatesTest::benchmark}, 5,
+        Containers::arraySize(BenchmarkData));
 }
 
 void RemoveDuplicatesTest::empty() {
@@ -638,6 +670,103 @@ void RemoveDuplicatesTest::inPlaceAsArray() {
     }}), DebugTools::CompareMaterial);
 }
 
+/* Materials made from 50 prototypes that differ from each other in various
+   ways, with float values placed exactly on and around the boundaries of the
+   cells used internally for hashing and perturbed in each copy by less than
+   the fuzzy compare epsilon. Every third prototype has its layer data
+   implicit in even copies and explicit in odd copies. */
+constexpr std::size_t ManyMaterialsPrototypeCount = 50;
+constexpr std::size_t ManyMaterialsCount = 1000;
+
+std::size_t manyMaterialsPrototype(std::size_t i) {
+    return (i*7 + i/ManyMaterialsPrototypeCount) % ManyMaterialsPrototypeCount;
+}
+
+Trade::MaterialData manyMaterialsMaterial(std::size_t i) {
+    const std::size_t prototype = manyMaterialsPrototype(i);
+    /* Alternating between -0.25, 0, 0.25 and 0.5 of the epsilon, scaled for
+       values larger than 1 */
+    const Float perturbation = Math::TypeTraits<Float>::epsilon()*0.25f*(Float(i % 4) - 1.0f);
+    const Float roughness = prototype/64.0f;
+    const Float baseColor = 1.0f + prototype/16.0f;
+
+    Trade::MaterialAttributeData attributes[]{
+        {Trade::MaterialAttribute::BaseColor, Color4{baseColor*(1.0f + perturbation), 0.5f + perturbation, 0.0f, 1.0f}},
+        {Trade::MaterialAttribute::BaseColorTexture, UnsignedInt(prototype % 5)},
+        {Trade::MaterialAttribute::Roughness, roughness + perturbation},
+        {"name", prototype % 2 ? "odd" : "even"},
+        {Trade::MaterialAttribute::LayerFactor, 0.25f},
+    };
+
+    Trade::MaterialTypes types = prototype % 4 ? Trade::MaterialType::PbrMetallicRoughness : Trade::MaterialType::Flat;
+
+    /* The last attribute is put into a second layer for some prototypes */
+    if(prototype % 3 == 1)
+        return Trade::MaterialData{types, Containers::array<Trade::MaterialAttributeData>({attributes[0], attributes[1], attributes[2], attributes[3], attributes[4]}), Containers::array<UnsignedInt>({4, 5})};
+    if(prototype % 3 == 0 && i % 2)
+        return Trade::MaterialData{types, Containers::array<Trade::MaterialAttributeData>({attributes[0], attributes[1], attributes[2], attributes[3]}), Containers::array<UnsignedInt>({4})};
+    return Trade::MaterialData{types, Containers::array<Trade::MaterialAttributeData>({attributes[0], attributes[1], attributes[2], attributes[3]}), nullptr};
+}
+
+void RemoveDuplicatesTest::manyMaterials() {
+    Containers::Array<Trade::MaterialData> materials;
+    for(std::size_t i = 0; i != ManyMaterialsCount; ++i)
+        arrayAppend(materials, manyMaterialsMaterial(i));
+
+    /* Each material should map to the first occurrence of its prototype */
+    UnsignedInt expected[ManyMaterialsCount];
+    UnsignedInt firstOccurrence[ManyMaterialsPrototypeCount];
+    for(UnsignedInt& i: firstOccurrence) i = ~UnsignedInt{};
+    for(std::size_t i = 0; i != ManyMaterialsCount; ++i) {
+        UnsignedInt& first = firstOccurrence[manyMaterialsPrototype(i)];
+        if(first == ~UnsignedInt{})
+            first = i;
+        expected[i] = first;
+    }
+
+    UnsignedInt mapping[ManyMaterialsCount];
+    CORRADE_COMPARE(removeDuplicatesInto(materials, mapping), ManyMaterialsPrototypeCount);
+    CORRADE_COMPARE_AS(Containers::arrayView(mapping),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void RemoveDuplicatesTest::manyMaterialsInPlace() {
+    Containers::Array<Trade::MaterialData> materials;
+    for(std::size_t i = 0; i != ManyMaterialsCount; ++i)
+        arrayAppend(materials, manyMaterialsMaterial(i));
+
+    /* Each material should map to the order in which its prototype first
+       occured */
+    UnsignedInt expected[ManyMaterialsCount];
+    UnsignedInt firstOccurrence[ManyMaterialsPrototypeCount];
+    UnsignedInt firstOccurrenceIndex[ManyMaterialsPrototypeCount];
+    for(UnsignedInt& i: firstOccurrence) i = ~UnsignedInt{};
+    UnsignedInt uniqueCount = 0;
+    for(std::size_t i = 0; i != ManyMaterialsCount; ++i) {
+        const std::size_t prototype = manyMaterialsPrototype(i);
+        if(firstOccurrence[prototype] == ~UnsignedInt{}) {
+            firstOccurrence[prototype] = uniqueCount++;
+            firstOccurrenceIndex[prototype] = i;
+        }
+        expected[i] = firstOccurrence[prototype];
+    }
+
+    UnsignedInt mapping[ManyMaterialsCount];
+    CORRADE_COMPARE(removeDuplicatesInPlaceInto(materials, mapping), ManyMaterialsPrototypeCount);
+    CORRADE_COMPARE_AS(Containers::arrayView(mapping),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+
+    /* The unique prefix should contain the first occurrences */
+    for(std::size_t prototype = 0; prototype != ManyMaterialsPrototypeCount; ++prototype) {
+        CORRADE_ITERATION(prototype);
+        CORRADE_COMPARE_AS(materials[firstOccurrence[prototype]],
+            manyMaterialsMaterial(firstOccurrenceIndex[prototype]),
+            DebugTools::CompareMaterial);
+    }
+}
+
 void RemoveDuplicatesTest::invalidSize() {
     CORRADE_SKIP_IF_NO_ASSERT();
 
@@ -656,6 +785,79 @@ void RemoveDuplicatesTest::invalidSize() {
         "MaterialTools::removeDuplicatesInPlaceInto(): bad output size, expected 2 but got 3\n");
 }
 
+void RemoveDuplicatesTest::floatCellSafeTypicalValues() {
+    /* Round values are the most common in materials, they should all take
+       the hash table fast path for both insertion and lookup and not fall
+       back to comparing with all materials of the same exact hash */
+    for(const Float value: {0.0f, 0.1f, 0.2f, 0.25f, 0.3f, 0.5f, 0.7f, 0.75f,
+                            0.8f, 0.9f, 1.0f, 1.5f, 2.0f, 3.0f, 4.0f, 5.0f,
+                            10.0f, 100.0f, 255.0f, 1000.0f, 1.0f/3.0f,
+                            2.0f/3.0f}) {
+        for(const Float signedValue: {value, -value}) {
+            CORRADE_ITERATION(signedValue);
+            CORRADE_VERIFY(Implementation::floatCellSafe(signedValue, 1.0f));
+            CORRADE_VERIFY(Implementation::floatCellSafe(signedValue, 3.0f));
+        }
+    }
+
+    /* Values that compare equal to round values are in the same cell */
+    CORRADE_COMPARE(Implementation::floatCell(1.0f - Math::TypeTraits<Float>::epsilon()*0.5f), Implementation::floatCell(1.0f));
+    CORRADE_COMPARE(Implementation::floatCell(0.0f - Math::TypeTraits<Float>::epsilon()*0.5f), Implementation::floatCell(0.0f));
+    CORRADE_COMPARE(Implementation::floatCell(2.0f - Math::TypeTraits<Float>::epsilon()), Implementation::floatCell(2.0f));
+
+    /* Non-finite values are never safe */
+    CORRADE_VERIFY(!Implementation::floatCellSafe(Constants::inf(), 1.0f));
+    CORRADE_VERIFY(!Implementation::floatCellSafe(Constants::nan(), 1.0f));
+}
+
+void RemoveDuplicatesTest::floatCellMonotonic() {
+    /* Cells are contiguous ranges, also around the switch from the linear to
+       the logarithmic grid */
+    Long previous = Implementation::floatCell(-10.0f);
+    for(Float value = -10.0f; value < 10.0f; value += 0.001f) {
+        CORRADE_ITERATION(value);
+        const Long cell = Implementation::floatCell(value);
+        CORRADE_COMPARE_AS(cell, previous, TestSuite::Compare::GreaterOrEqual);
+        previous = cell;
+    }
+
+    CORRADE_COMPARE(Implementation::floatCell(1.03124f), 66);
+    CORRADE_COMPARE(Implementation::floatCell(1.03125f), 2033);
+    CORRADE_COMPARE(Implementation::floatCell(-1.03124f), -66);
+    CORRADE_COMPARE(Implementation::floatCell(-1.03125f), -2033);
+}
+
+void RemoveDuplicatesTest::benchmark() {
+    auto&& data = BenchmarkData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* 100k materials with a typical set of attributes, either differing in a
+       texture ID, which affects the exact part of the hash, or in a base
+       color value, which is the worst case for a linear scan as all
+       attributes until the last one are the same */
+    Containers::Array<Trade::MaterialData> materials;
+    for(std::size_t i = 0; i != 100000; ++i) {
+        const std::size_t unique = i % data.uniqueCount;
+        arrayAppend(materials, Trade::MaterialData{Trade::MaterialType::PbrMetallicRoughness, {
+            {Trade::MaterialAttribute::BaseColor, data.sameExceptFloat ?
+                Color4{(unique % 256)/255.0f, (unique/256)/255.0f, 0.25f, 1.0f} :
+                0x3366ccff_rgbaf},
+            {Trade::MaterialAttribute::BaseColorTexture, data.sameExceptFloat ? 0u : UnsignedInt(unique)},
+            {Trade::MaterialAttribute::Metalness, 0.5f},
+            {Trade::MaterialAttribute::NormalTexture, 3u},
+            {Trade::MaterialAttribute::Roughness, 0.75f},
+        }});
+    }
+
+    Containers::Array<UnsignedInt> mapping{NoInit, materials.size()};
+    std::size_t uniqueCount = 0;
+    CORRADE_BENCHMARK(1) {
+        uniqueCount = removeDuplicatesInto(materials, mapping);
+    }
+
+    CORRADE_COMPARE(uniqueCount, data.uniqueCount);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::MaterialTools::Test::RemoveDuplicatesTest)
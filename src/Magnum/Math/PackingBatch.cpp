@@ -32,13 +32,379 @@
 #endif
 #include <Corrade/Utility/Assert.h>
 
+#include "Magnum/Math/Constants.h"
 #include "Magnum/Math/Packing.h"
 #include "Magnum/Math/Implementation/halfTables.hpp"
 
+#ifndef MAGNUM_SINGLES_NO_CPU_DISPATCH
+#include <cstring>
+#include <Corrade/Cpu.h>
+#ifdef CORRADE_ENABLE_SSE2
+#include <Corrade/Utility/IntrinsicsSse2.h>
+#endif
+#if defined(CORRADE_ENABLE_AVX2) || defined(CORRADE_ENABLE_AVX_F16C)
+#include <Corrade/Utility/IntrinsicsAvx.h>
+#endif
+/* The NEON variants need vdivq_f32(), which is only on AArch64 */
+#if defined(CORRADE_ENABLE_NEON) && !defined(CORRADE_TARGET_32BIT)
+#include <arm_neon.h>
+#define _MAGNUM_PACKING_BATCH_NEON
+#endif
+#endif
+
 namespace Magnum { namespace Math {
 
 namespace {
 
+/* Kernels operating on a contiguous range of values, used when both views
+   are contiguous in both dimensions. The variant is picked at runtime based
+   on CPU features, the scalar variant is used for the remaining values that
+   don't fill a whole vector. For the integer -> float direction the value is
+   divided and clamped, for the float -> integer direction multiplied and
+   optionally rounded, which covers both packInto() / unpackInto() and the
+   castInto() variants that have a SIMD counterpart. Division and rounding is
+   done in a way that gives the same results as the scalar code. */
+template<class T> using UnpackKernel = void(*)(const T*, Float*, std::size_t, Float, Float);
+template<class T> using PackKernel = void(*)(const Float*, T*, std::size_t, Float);
+typedef void(*PackHalfKernel)(const Float*, UnsignedShort*, std::size_t);
+typedef void(*UnpackHalfKernel)(const UnsignedShort*, Float*, std::size_t);
+
+template<class T> void unpackScalar(const T* src, Float* dst, const std::size_t count, const Float divisor, const Float min) {
+    for(std::size_t i = 0; i != count; ++i) {
+        const Float value = src[i]/divisor;
+        /* Avoiding a max() call in Debug */
+        dst[i] = value < min ? min : value;
+    }
+}
+
+template<class T, bool round> void packScalar(const Float* src, T* dst, const std::size_t count, const Float scale) {
+    for(std::size_t i = 0; i != count; ++i)
+        dst[i] = T(round ? std::round(src[i]*scale) : src[i]*scale);
+}
+
+#ifndef MAGNUM_SINGLES_NO_CPU_DISPATCH
+#ifdef CORRADE_ENABLE_SSE2
+/* Load four values and widen them to 32-bit integers */
+CORRADE_ENABLE_SSE2 inline __m128i loadSse2(const UnsignedByte* src) {
+    Int data;
+    std::memcpy(&data, src, 4);
+    const __m128i zero = _mm_setzero_si128();
+    return _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(data), zero), zero);
+}
+CORRADE_ENABLE_SSE2 inline __m128i loadSse2(const Byte* src) {
+    Int data;
+    std::memcpy(&data, src, 4);
+    /* Duplicate each byte into all four bytes of a 32-bit lane, then
+       arithmetic shift to sign-extend */
+    __m128i value = _mm_cvtsi32_si128(data);
+    value = _mm_unpacklo_epi8(value, value);
+    value = _mm_unpacklo_epi16(value, value);
+    return _mm_srai_epi32(value, 24);
+}
+CORRADE_ENABLE_SSE2 inline __m128i loadSse2(const UnsignedShort* src) {
+    return _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src)), _mm_setzero_si128());
+}
+CORRADE_ENABLE_SSE2 inline __m128i loadSse2(const Short* src) {
+    const __m128i value = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src));
+    return _mm_srai_epi32(_mm_unpacklo_epi16(value, value), 16);
+}
+CORRADE_ENABLE_SSE2 inline __m128i loadSse2(const Int* src) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+}
+
+/* Narrow eight 32-bit integers with saturation and store them */
+CORRADE_ENABLE_SSE2 inline void storeSse2(UnsignedByte* dst, const __m128i a, const __m128i b) {
+    const __m128i shorts = _mm_packs_epi32(a, b);
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(shorts, shorts));
+}
+CORRADE_ENABLE_SSE2 inline void storeSse2(Byte* dst, const __m128i a, const __m128i b) {
+    const __m128i shorts = _mm_packs_epi32(a, b);
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packs_epi16(shorts, shorts));
+}
+CORRADE_ENABLE_SSE2 inline void storeSse2(UnsignedShort* dst, const __m128i a, const __m128i b) {
+    /* There's no unsigned 32-to-16-bit saturation in SSE2, so bias the
+       values to the signed range, saturate and unbias back */
+    const __m128i bias32 = _mm_set1_epi32(32768);
+    const __m128i bias16 = _mm_set1_epi16(-32768);
+    const __m128i shorts = _mm_packs_epi32(_mm_sub_epi32(a, bias32), _mm_sub_epi32(b, bias32));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_add_epi16(shorts, bias16));
+}
+CORRADE_ENABLE_SSE2 inline void storeSse2(Short* dst, const __m128i a, const __m128i b) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_packs_epi32(a, b));
+}
+CORRADE_ENABLE_SSE2 inline void storeSse2(Int* dst, const __m128i a, const __m128i b) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), a);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst) + 1, b);
+}
+
+/* Rounding half away from zero like std::round() does. Adding a value just
+   below 0.5 and truncating gives the same result for all inputs, adding 0.5
+   would round up also values just below x.5. */
+template<bool round> CORRADE_ENABLE_SSE2 inline __m128i convertSse2(__m128 value) {
+    if(round) value = _mm_add_ps(value, _mm_or_ps(_mm_and_ps(value, _mm_set1_ps(-0.0f)), _mm_set1_ps(0.49999997f)));
+    return _mm_cvttps_epi32(value);
+}
+
+template<class T> CORRADE_ENABLE_SSE2 void unpackSse2(const T* src, Float* dst, const std::size_t count, const Float divisor, const Float min) {
+    const __m128 divisor4 = _mm_set1_ps(divisor);
+    const __m128 min4 = _mm_set1_ps(min);
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4) {
+        const __m128 value = _mm_div_ps(_mm_cvtepi32_ps(loadSse2(src + i)), divisor4);
+        _mm_storeu_ps(dst + i, _mm_max_ps(value, min4));
+    }
+    unpackScalar(src + i, dst + i, count - i, divisor, min);
+}
+
+template<class T, bool round> CORRADE_ENABLE_SSE2 void packSse2(const Float* src, T* dst, const std::size_t count, const Float scale) {
+    const __m128 scale4 = _mm_set1_ps(scale);
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        const __m128i a = convertSse2<round>(_mm_mul_ps(_mm_loadu_ps(src + i), scale4));
+        const __m128i b = convertSse2<round>(_mm_mul_ps(_mm_loadu_ps(src + i + 4), scale4));
+        storeSse2(dst + i, a, b);
+    }
+    packScalar<T, round>(src + i, dst + i, count - i, scale);
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX2
+/* Load eight values and widen them to 32-bit integers */
+CORRADE_ENABLE_AVX2 inline __m256i loadAvx2(const UnsignedByte* src) {
+    return _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src)));
+}
+CORRADE_ENABLE_AVX2 inline __m256i loadAvx2(const Byte* src) {
+    return _mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src)));
+}
+CORRADE_ENABLE_AVX2 inline __m256i loadAvx2(const UnsignedShort* src) {
+    return _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+}
+CORRADE_ENABLE_AVX2 inline __m256i loadAvx2(const Short* src) {
+    return _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+}
+CORRADE_ENABLE_AVX2 inline __m256i loadAvx2(const Int* src) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+}
+
+template<bool round> CORRADE_ENABLE_AVX2 inline __m256i convertAvx2(__m256 value) {
+    if(round) value = _mm256_add_ps(value, _mm256_or_ps(_mm256_and_ps(value, _mm256_set1_ps(-0.0f)), _mm256_set1_ps(0.49999997f)));
+    return _mm256_cvttps_epi32(value);
+}
+
+template<class T> CORRADE_ENABLE_AVX2 void unpackAvx2(const T* src, Float* dst, const std::size_t count, const Float divisor, const Float min) {
+    const __m256 divisor8 = _mm256_set1_ps(divisor);
+    const __m256 min8 = _mm256_set1_ps(min);
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        const __m256 value = _mm256_div_ps(_mm256_cvtepi32_ps(loadAvx2(src + i)), divisor8);
+        _mm256_storeu_ps(dst + i, _mm256_max_ps(value, min8));
+    }
+    unpackScalar(src + i, dst + i, count - i, divisor, min);
+}
+
+template<class T, bool round> CORRADE_ENABLE_AVX2 void packAvx2(const Float* src, T* dst, const std::size_t count, const Float scale) {
+    const __m256 scale8 = _mm256_set1_ps(scale);
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        const __m256i value = convertAvx2<round>(_mm256_mul_ps(_mm256_loadu_ps(src + i), scale8));
+        /* The AVX2 pack instructions operate on 128-bit lanes separately,
+           which would interleave the output. Narrow the two halves with SSE2
+           instead. */
+        storeSse2(dst + i, _mm256_castsi256_si128(value), _mm256_extracti128_si256(value, 1));
+    }
+    packScalar<T, round>(src + i, dst + i, count - i, scale);
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX_F16C
+CORRADE_ENABLE_AVX_F16C void unpackHalfF16c(const UnsignedShort* src, Float* dst, const std::size_t count) {
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4)
+        _mm_storeu_ps(dst + i, _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i))));
+    for(; i != count; ++i) {
+        const UnsignedShort h = src[i];
+        const UnsignedInt f = HalfMantissaTable[HalfOffsetTable[h >> 10] + (h & 0x3ff)] + HalfExponentTable[h >> 10];
+        std::memcpy(dst + i, &f, 4);
+    }
+}
+
+CORRADE_ENABLE_AVX_F16C void packHalfF16c(const Float* src, UnsignedShort* dst, const std::size_t count) {
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    const __m128 overflow = _mm_set1_ps(65536.0f);
+    const __m128i infinity = _mm_set1_epi16(0x7c00);
+    const __m128i halfSignMask = _mm_set1_epi16(-32768);
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4) {
+        const __m128 value = _mm_loadu_ps(src + i);
+        /* Rounding toward zero to match the truncation done by the tables */
+        const __m128i half = _mm_cvtps_ph(value, _MM_FROUND_TO_ZERO);
+        /* With rounding toward zero, values that are too large saturate to
+           the largest finite half instead of becoming an infinity like with
+           the tables. Patch those. */
+        const __m128 overflowed32 = _mm_cmpge_ps(_mm_andnot_ps(signMask, value), overflow);
+        const __m128i overflowed = _mm_packs_epi32(_mm_castps_si128(overflowed32), _mm_castps_si128(overflowed32));
+        const __m128i signedInfinity = _mm_or_si128(infinity, _mm_and_si128(half, halfSignMask));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + i), _mm_or_si128(
+            _mm_andnot_si128(overflowed, half),
+            _mm_and_si128(overflowed, signedInfinity)));
+    }
+    for(; i != count; ++i) {
+        UnsignedInt f;
+        std::memcpy(&f, src + i, 4);
+        dst[i] = HalfBaseTable[(f >> 23) & 0x1ff] + ((f & 0x007fffff) >> HalfShiftTable[(f >> 23) & 0x1ff]);
+    }
+}
+#endif
+
+#ifdef _MAGNUM_PACKING_BATCH_NEON
+/* Load eight values and widen them to two 32-bit float vectors */
+CORRADE_ENABLE_NEON inline void loadNeon(const UnsignedByte* src, float32x4_t& a, float32x4_t& b) {
+    const uint16x8_t value = vmovl_u8(vld1_u8(src));
+    a = vcvtq_f32_u32(vmovl_u16(vget_low_u16(value)));
+    b = vcvtq_f32_u32(vmovl_u16(vget_high_u16(value)));
+}
+CORRADE_ENABLE_NEON inline void loadNeon(const Byte* src, float32x4_t& a, float32x4_t& b) {
+    const int16x8_t value = vmovl_s8(vld1_s8(src));
+    a = vcvtq_f32_s32(vmovl_s16(vget_low_s16(value)));
+    b = vcvtq_f32_s32(vmovl_s16(vget_high_s16(value)));
+}
+CORRADE_ENABLE_NEON inline void loadNeon(const UnsignedShort* src, float32x4_t& a, float32x4_t& b) {
+    const uint16x8_t value = vld1q_u16(src);
+    a = vcvtq_f32_u32(vmovl_u16(vget_low_u16(value)));
+    b = vcvtq_f32_u32(vmovl_u16(vget_high_u16(value)));
+}
+CORRADE_ENABLE_NEON inline void loadNeon(const Short* src, float32x4_t& a, float32x4_t& b) {
+    const int16x8_t value = vld1q_s16(src);
+    a = vcvtq_f32_s32(vmovl_s16(vget_low_s16(value)));
+    b = vcvtq_f32_s32(vmovl_s16(vget_high_s16(value)));
+}
+CORRADE_ENABLE_NEON inline void loadNeon(const Int* src, float32x4_t& a, float32x4_t& b) {
+    a = vcvtq_f32_s32(vld1q_s32(src));
+    b = vcvtq_f32_s32(vld1q_s32(src + 4));
+}
+
+/* Narrow eight 32-bit integers with saturation and store them */
+CORRADE_ENABLE_NEON inline void storeNeon(UnsignedByte* dst, const int32x4_t a, const int32x4_t b) {
+    vst1_u8(dst, vqmovun_s16(vcombine_s16(vqmovn_s32(a), vqmovn_s32(b))));
+}
+CORRADE_ENABLE_NEON inline void storeNeon(Byte* dst, const int32x4_t a, const int32x4_t b) {
+    vst1_s8(dst, vqmovn_s16(vcombine_s16(vqmovn_s32(a), vqmovn_s32(b))));
+}
+CORRADE_ENABLE_NEON inline void storeNeon(UnsignedShort* dst, const int32x4_t a, const int32x4_t b) {
+    vst1q_u16(dst, vcombine_u16(vqmovun_s32(a), vqmovun_s32(b)));
+}
+CORRADE_ENABLE_NEON inline void storeNeon(Short* dst, const int32x4_t a, const int32x4_t b) {
+    vst1q_s16(dst, vcombine_s16(vqmovn_s32(a), vqmovn_s32(b)));
+}
+CORRADE_ENABLE_NEON inline void storeNeon(Int* dst, const int32x4_t a, const int32x4_t b) {
+    vst1q_s32(dst, a);
+    vst1q_s32(dst + 4, b);
+}
+
+/* Same rounding as in convertSse2() */
+template<bool round> CORRADE_ENABLE_NEON inline int32x4_t convertNeon(float32x4_t value) {
+    if(round) value = vaddq_f32(value, vbslq_f32(vdupq_n_u32(0x80000000u), value, vdupq_n_f32(0.49999997f)));
+    return vcvtq_s32_f32(value);
+}
+
+template<class T> CORRADE_ENABLE_NEON void unpackNeon(const T* src, Float* dst, const std::size_t count, const Float divisor, const Float min) {
+    const float32x4_t divisor4 = vdupq_n_f32(divisor);
+    const float32x4_t min4 = vdupq_n_f32(min);
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        float32x4_t a, b;
+        loadNeon(src + i, a, b);
+        vst1q_f32(dst + i, vmaxq_f32(vdivq_f32(a, divisor4), min4));
+        vst1q_f32(dst + i + 4, vmaxq_f32(vdivq_f32(b, divisor4), min4));
+    }
+    unpackScalar(src + i, dst + i, count - i, divisor, min);
+}
+
+template<class T, bool round> CORRADE_ENABLE_NEON void packNeon(const Float* src, T* dst, const std::size_t count, const Float scale) {
+    const float32x4_t scale4 = vdupq_n_f32(scale);
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        const int32x4_t a = convertNeon<round>(vmulq_f32(vld1q_f32(src + i), scale4));
+        const int32x4_t b = convertNeon<round>(vmulq_f32(vld1q_f32(src + i + 4), scale4));
+        storeNeon(dst + i, a, b);
+    }
+    packScalar<T, round>(src + i, dst + i, count - i, scale);
+}
+#endif
+#endif
+
+template<class T> UnpackKernel<T> unpackKernel() {
+    #ifndef MAGNUM_SINGLES_NO_CPU_DISPATCH
+    const Cpu::Features features = Cpu::runtimeFeatures();
+    #ifdef CORRADE_ENABLE_AVX2
+    if(features & Cpu::Avx2) return unpackAvx2<T>;
+    #endif
+    #ifdef CORRADE_ENABLE_SSE2
+    if(features & Cpu::Sse2) return unpackSse2<T>;
+    #endif
+    #ifdef _MAGNUM_PACKING_BATCH_NEON
+    if(features & Cpu::Neon) return unpackNeon<T>;
+    #endif
+    static_cast<void>(features);
+    #endif
+    return unpackScalar<T>;
+}
+
+template<class T, bool round> PackKernel<T> packKernel() {
+    #ifndef MAGNUM_SINGLES_NO_CPU_DISPATCH
+    const Cpu::Features features = Cpu::runtimeFeatures();
+    #ifdef CORRADE_ENABLE_AVX2
+    if(features & Cpu::Avx2) return packAvx2<T, round>;
+    #endif
+    #ifdef CORRADE_ENABLE_SSE2
+    if(features & Cpu::Sse2) return packSse2<T, round>;
+    #endif
+    #ifdef _MAGNUM_PACKING_BATCH_NEON
+    if(features & Cpu::Neon) return packNeon<T, round>;
+    #endif
+    static_cast<void>(features);
+    #endif
+    return packScalar<T, round>;
+}
+
+/* Returns nullptr if there's no SIMD variant, in which case the table-based
+   implementation is used directly */
+UnpackHalfKernel unpackHalfKernel() {
+    #if !defined(MAGNUM_SINGLES_NO_CPU_DISPATCH) && defined(CORRADE_ENABLE_AVX_F16C)
+    if(Cpu::runtimeFeatures() & Cpu::AvxF16c) return unpackHalfF16c;
+    #endif
+    return nullptr;
+}
+
+PackHalfKernel packHalfKernel() {
+    #if !defined(MAGNUM_SINGLES_NO_CPU_DISPATCH) && defined(CORRADE_ENABLE_AVX_F16C)
+    if(Cpu::runtimeFeatures() & Cpu::AvxF16c) return packHalfF16c;
+    #endif
+    return nullptr;
+}
+
+/* Whether the whole operation can be done with a single kernel call. If
+   not, the original code path is used, which also checks the assertions. */
+template<class T, class U> inline bool isContiguous(const Containers::StridedArrayView2D<T>& src, const Containers::StridedArrayView2D<U>& dst) {
+    return src.size() == dst.size() && src.isContiguous() && dst.isContiguous();
+}
+
+template<class T> inline void unpackContiguous(const Containers::StridedArrayView2D<const T>& src, const Containers::StridedArrayView2D<Float>& dst, const Float divisor, const Float min) {
+    /* Picked just once for each type */
+    static const UnpackKernel<T> kernel = unpackKernel<T>();
+    kernel(static_cast<const T*>(src.data()), static_cast<Float*>(dst.data()), src.size()[0]*src.size()[1], divisor, min);
+}
+
+template<class T, bool round> inline void packContiguous(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<T>& dst, const Float scale) {
+    /* Picked just once for each type */
+    static const PackKernel<T> kernel = packKernel<T, round>();
+    kernel(static_cast<const Float*>(src.data()), static_cast<T*>(dst.data()), src.size()[0]*src.size()[1], scale);
+}
+
+}
+
+namespace {
+
 template<class T> inline void unpackUnsignedIntoImplementation(const Containers::StridedArrayView2D<const T>& src, const Containers::StridedArrayView2D<Float>& dst) {
     CORRADE_ASSERT(src.size() == dst.size(),
         "Math::unpackInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
@@ -47,8 +413,8 @@ template<class T> inline void unpackUnsignedIntoImplementation(const Containers:
     CORRADE_ASSERT(dst.isContiguous<1>(),
         "Math::unpackInto(): second destination view dimension is not contiguous", );
 
-    /** @todo SSE/NEON implementations exploiting second dimension size/stride,
-        contiguity etc */
+    if(isContiguous(src, dst))
+        return unpackContiguous(src, dst, Implementation::bitMax<T>(), 0.0f);
 
     /* Caching values to avoid inline function calls in ebug builds */
     constexpr Float bitMax = Implementation::bitMax<T>();
@@ -88,8 +454,8 @@ template<class T> inline void unpackSignedIntoImplementation(const Containers::S
     CORRADE_ASSERT(dst.isContiguous<1>(),
         "Math::unpackInto(): second destination view dimension is not contiguous", );
 
-    /** @todo SSE/NEON implementations exploiting second dimension size/stride,
-        contiguity etc */
+    if(isContiguous(src, dst))
+        return unpackContiguous(src, dst, Implementation::bitMax<T>(), -1.0f);
 
     /* Caching values to avoid inline function calls in debug builds */
     constexpr Float bitMax = Implementation::bitMax<T>();
@@ -132,8 +498,8 @@ template<class T> inline void packIntoImplementation(const Containers::StridedAr
     CORRADE_ASSERT(dst.template isContiguous<1>(),
         "Math::packInto(): second destination view dimension is not contiguous", );
 
-    /** @todo SSE/NEON implementations exploiting second dimension size/stride,
-        contiguity etc */
+    if(isContiguous(src, dst))
+        return packContiguous<T, true>(src, dst, Implementation::bitMax<T>());
 
     /* Caching values to avoid inline function calls in debug builds */
     constexpr Float bitMax = Implementation::bitMax<T>();
@@ -182,9 +548,6 @@ template<class T, class U> inline void castIntoImplementation(const Containers::
     CORRADE_ASSERT(dst.template isContiguous<1>(),
         "Math::castInto(): second destination view dimension is not contiguous", );
 
-    /** @todo SSE/NEON implementations exploiting second dimension size/stride,
-        contiguity etc */
-
     /* Caching values to avoid inline function calls in debug buílds */
     const char* srcPtr = reinterpret_cast<const char*>(src.data());
     char* dstPtr = reinterpret_cast<char*>(dst.data());
@@ -202,22 +565,38 @@ template<class T, class U> inline void castIntoImplementation(const Containers::
     }
 }
 
+/* Variants with a SIMD fast path for contiguous views. The integer -> float
+   conversion is exact for all types except Int, where it rounds to nearest in
+   both the scalar and the SIMD code; the float -> integer conversion
+   truncates. */
+template<class T> inline void castIntoFloatImplementation(const Containers::StridedArrayView2D<const T>& src, const Containers::StridedArrayView2D<Float>& dst) {
+    if(isContiguous(src, dst))
+        return unpackContiguous(src, dst, 1.0f, -Constants<Float>::inf());
+    castIntoImplementation(src, dst);
+}
+
+template<class T> inline void castFromFloatImplementation(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<T>& dst) {
+    if(isContiguous(src, dst))
+        return packContiguous<T, false>(src, dst, 1.0f);
+    castIntoImplementation(src, dst);
+}
+
 }
 
 void castInto(const Containers::StridedArrayView2D<const UnsignedByte>& src, const Containers::StridedArrayView2D<Float>& dst) {
-    castIntoImplementation(src, dst);
+    castIntoFloatImplementation(src, dst);
 }
 
 void castInto(const Containers::StridedArrayView2D<const Byte>& src, const Containers::StridedArrayView2D<Float>& dst) {
-    castIntoImplementation(src, dst);
+    castIntoFloatImplementation(src, dst);
 }
 
 void castInto(const Containers::StridedArrayView2D<const UnsignedShort>& src, const Containers::StridedArrayView2D<Float>& dst) {
-    castIntoImplementation(src, dst);
+    castIntoFloatImplementation(src, dst);
 }
 
 void castInto(const Containers::StridedArrayView2D<const Short>& src, const Containers::StridedArrayView2D<Float>& dst) {
-    castIntoImplementation(src, dst);
+    castIntoFloatImplementation(src, dst);
 }
 
 void castInto(const Containers::StridedArrayView2D<const UnsignedInt>& src, const Containers::StridedArrayView2D<Float>& dst) {
@@ -225,7 +604,7 @@ void castInto(const Containers::StridedArrayView2D<const UnsignedInt>& src, cons
 }
 
 void castInto(const Containers::StridedArrayView2D<const Int>& src, const Containers::StridedArrayView2D<Float>& dst) {
-    castIntoImplementation(src, dst);
+    castIntoFloatImplementation(src, dst);
 }
 
 void castInto(const Containers::StridedArrayView2D<const UnsignedByte>& src, const Containers::StridedArrayView2D<Double>& dst) {
@@ -253,19 +632,19 @@ void castInto(const Containers::StridedArrayView2D<const Int>& src, const Contai
 }
 
 void castInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<UnsignedByte>& dst) {
-    castIntoImplementation(src, dst);
+    castFromFloatImplementation(src, dst);
 }
 
 void castInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<Byte>& dst) {
-    castIntoImplementation(src, dst);
+    castFromFloatImplementation(src, dst);
 }
 
 void castInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<UnsignedShort>& dst) {
-    castIntoImplementation(src, dst);
+    castFromFloatImplementation(src, dst);
 }
 
 void castInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<Short>& dst) {
-    castIntoImplementation(src, dst);
+    castFromFloatImplementation(src, dst);
 }
 
 void castInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<UnsignedInt>& dst) {
@@ -273,7 +652,7 @@ void castInto(const Containers::StridedArrayView2D<const Float>& src, const Cont
 }
 
 void castInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<Int>& dst) {
-    castIntoImplementation(src, dst);
+    castFromFloatImplementation(src, dst);
 }
 
 void castInto(const Containers::StridedArrayView2D<const Double>& src, const Containers::StridedArrayView2D<UnsignedByte>& dst) {
@@ -485,6 +864,11 @@ void unpackHalfInto(const Containers::StridedArrayView2D<const UnsignedShort>& s
     CORRADE_ASSERT(dst.isContiguous<1>(),
         "Math::unpackHalfInto(): second destination view dimension is not contiguous", );
 
+    /* Picked just once, null if there's no SIMD variant */
+    static const UnpackHalfKernel kernel = unpackHalfKernel();
+    if(kernel && isContiguous(src, dst))
+        return kernel(static_cast<const UnsignedShort*>(src.data()), static_cast<Float*>(dst.data()), src.size()[0]*src.size()[1]);
+
     /* Caching values to avoid inline function calls in debug builds */
     const char* srcPtr = reinterpret_cast<const char*>(src.data());
     char* dstPtr = reinterpret_cast<char*>(dst.data());
@@ -512,6 +896,11 @@ void packHalfInto(const Containers::StridedArrayView2D<const Float>& src, const
     CORRADE_ASSERT(dst.isContiguous<1>(),
         "Math::packHalfInto(): second destination view dimension is not contiguous", );
 
+    /* Picked just once, null if there's no SIMD variant */
+    static const PackHalfKernel kernel = packHalfKernel();
+    if(kernel && isContiguous(src, dst))
+        return kernel(static_cast<const Float*>(src.data()), static_cast<UnsignedShort*>(dst.data()), src.size()[0]*src.size()[1]);
+
     /* Caching values to avoid inline function calls in debug builds */
     const char* srcPtr = reinterpret_cast<const char*>(src.data());
     char* dstPtr = reinterpret_cast<char*>(dst.data());
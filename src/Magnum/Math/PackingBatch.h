@@ -78,6 +78,18 @@ Or call the function on the nested dimensions in a loop if not:
 
 @snippet Math.cpp unpackInto-slice-loop
 
+@section Math-unpackInto-simd SIMD code paths
+
+If both @p src and @p dst are contiguous in both dimensions, this function
+and the @ref packInto(), @ref packHalfInto(), @ref unpackHalfInto() and the
+@ref castInto() overloads between 8-, 16- and 32-bit integers and 32-bit floats
+process the whole range at once, using SSE2, AVX2, F16C or NEON instructions if
+the CPU supports them. The variant is picked at runtime based on
+@relativeref{Corrade,Cpu::runtimeFeatures()}. Results are the same as with the
+scalar code except for NaN payloads and out-of-range values, for which the
+conversion result is undefined anyway. Otherwise, and in the single-header
+version of the library, a scalar implementation is used.
+
 @see @ref packInto(), @ref castInto(),
     @relativeref{Corrade,Containers::StridedArrayView::isContiguous()}
 */
@@ -167,7 +179,10 @@ contiguous. See @ref unpackInto(const Containers::StridedArrayView2D<const Unsig
 for various examples of how to pass the arguments.
 
 Algorithm used: *Jeroen van der Zijp -- Fast Half Float Conversions, 2008,
-ftp://ftp.fox-toolkit.org/pub/fasthalffloatconversion.pdf*
+ftp://ftp.fox-toolkit.org/pub/fasthalffloatconversion.pdf*. If the views are
+contiguous and the CPU supports F16C, the conversion is done with
+@cpp _mm_cvtps_ph() @ce with rounding toward zero, giving the same results as
+the table-based implementation. See @ref Math-unpackInto-simd for more information.
 @see @ref Half
 */
 MAGNUM_EXPORT void packHalfInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<UnsignedShort>& dst);
@@ -187,7 +202,9 @@ contiguous. See @ref unpackInto(const Containers::StridedArrayView2D<const Unsig
 for various examples of how to pass the arguments.
 
 Algorithm used: *Jeroen van der Zijp -- Fast Half Float Conversions, 2008,
-ftp://ftp.fox-toolkit.org/pub/fasthalffloatconversion.pdf*
+ftp://ftp.fox-toolkit.org/pub/fasthalffloatconversion.pdf*. If the views are
+contiguous and the CPU supports F16C, the conversion is done with
+@cpp _mm_cvtph_ps() @ce. See @ref Math-unpackInto-simd for more information.
 @see @ref Half
 */
 MAGNUM_EXPORT void unpackHalfInto(const Containers::StridedArrayView2D<const UnsignedShort>& src, const Containers::StridedArrayView2D<Float>& dst);
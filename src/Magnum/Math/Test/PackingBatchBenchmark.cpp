@@ -0,0 +1,264 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Packing.h"
+#include "Magnum/Math/PackingBatch.h"
+
+namespace Magnum { namespace Math { namespace Test { namespace {
+
+struct PackingBatchBenchmark: TestSuite::Tester {
+    explicit PackingBatchBenchmark();
+
+    template<class T> void unpackContiguous();
+    template<class T> void unpackStrided();
+    template<class T> void packContiguous();
+    template<class T> void packStrided();
+
+    void unpackHalfContiguous();
+    void unpackHalfStrided();
+    void packHalfContiguous();
+    void packHalfStrided();
+
+    template<class T> void castIntoFloatContiguous();
+    template<class T> void castFromFloatContiguous();
+};
+
+PackingBatchBenchmark::PackingBatchBenchmark() {
+    addBenchmarks({
+        &PackingBatchBenchmark::unpackContiguous<UnsignedByte>,
+        &PackingBatchBenchmark::unpackStrided<UnsignedByte>,
+        &PackingBatchBenchmark::unpackContiguous<Byte>,
+        &PackingBatchBenchmark::unpackStrided<Byte>,
+        &PackingBatchBenchmark::unpackContiguous<UnsignedShort>,
+        &PackingBatchBenchmark::unpackStrided<UnsignedShort>,
+        &PackingBatchBenchmark::unpackContiguous<Short>,
+        &PackingBatchBenchmark::unpackStrided<Short>,
+        &PackingBatchBenchmark::packContiguous<UnsignedByte>,
+        &PackingBatchBenchmark::packStrided<UnsignedByte>,
+        &PackingBatchBenchmark::packContiguous<Byte>,
+        &PackingBatchBenchmark::packStrided<Byte>,
+        &PackingBatchBenchmark::packContiguous<UnsignedShort>,
+        &PackingBatchBenchmark::packStrided<UnsignedShort>,
+        &PackingBatchBenchmark::packContiguous<Short>,
+        &PackingBatchBenchmark::packStrided<Short>,
+
+        &PackingBatchBenchmark::unpackHalfContiguous,
+        &PackingBatchBenchmark::unpackHalfStrided,
+        &PackingBatchBenchmark::packHalfContiguous,
+        &PackingBatchBenchmark::packHalfStrided,
+
+        &PackingBatchBenchmark::castIntoFloatContiguous<UnsignedByte>,
+        &PackingBatchBenchmark::castIntoFloatContiguous<Short>,
+        &PackingBatchBenchmark::castIntoFloatContiguous<Int>,
+        &PackingBatchBenchmark::castFromFloatContiguous<UnsignedByte>,
+        &PackingBatchBenchmark::castFromFloatContiguous<Short>,
+        &PackingBatchBenchmark::castFromFloatContiguous<Int>}, 50);
+}
+
+/* Four-component vectors, so the strided variants process the same amount of
+   data in rows of four values */
+enum: std::size_t { Count = 4096, Components = 4, Repeats = 10 };
+
+template<class T> struct Vec4 {
+    T data[Components];
+};
+
+template<class T> void PackingBatchBenchmark::unpackContiguous() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    Vec4<T> src[Count];
+    for(std::size_t i = 0; i != Count; ++i)
+        for(std::size_t j = 0; j != Components; ++j)
+            src[i].data[j] = T(i*Components + j);
+
+    Vec4<Float> dst[Count];
+    CORRADE_BENCHMARK(Repeats)
+        unpackInto(Containers::arrayCast<2, T>(Containers::stridedArrayView(src)),
+                   Containers::arrayCast<2, Float>(Containers::stridedArrayView(dst)));
+
+    CORRADE_COMPARE(dst[Count - 1].data[Components - 1], Math::unpack<Float>(src[Count - 1].data[Components - 1]));
+}
+
+template<class T> void PackingBatchBenchmark::unpackStrided() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    /* The destination has a padding so the views aren't contiguous */
+    struct Data {
+        Vec4<T> src;
+        Vec4<Float> dst;
+        Float padding;
+    };
+    Containers::Array<Data> data{Count};
+    for(std::size_t i = 0; i != Count; ++i)
+        for(std::size_t j = 0; j != Components; ++j)
+            data[i].src.data[j] = T(i*Components + j);
+
+    CORRADE_BENCHMARK(Repeats)
+        unpackInto(Containers::arrayCast<2, T>(Containers::stridedArrayView(data).slice(&Data::src)),
+                   Containers::arrayCast<2, Float>(Containers::stridedArrayView(data).slice(&Data::dst)));
+
+    CORRADE_COMPARE(data[Count - 1].dst.data[Components - 1], Math::unpack<Float>(data[Count - 1].src.data[Components - 1]));
+}
+
+template<class T> void PackingBatchBenchmark::packContiguous() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    Vec4<Float> src[Count];
+    for(std::size_t i = 0; i != Count; ++i)
+        for(std::size_t j = 0; j != Components; ++j)
+            src[i].data[j] = Float(i*Components + j)/(Count*Components);
+
+    Vec4<T> dst[Count];
+    CORRADE_BENCHMARK(Repeats)
+        packInto(Containers::arrayCast<2, Float>(Containers::stridedArrayView(src)),
+                 Containers::arrayCast<2, T>(Containers::stridedArrayView(dst)));
+
+    CORRADE_COMPARE(dst[Count - 1].data[Components - 1], Math::pack<T>(src[Count - 1].data[Components - 1]));
+}
+
+template<class T> void PackingBatchBenchmark::packStrided() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    struct Data {
+        Vec4<Float> src;
+        Vec4<T> dst;
+        T padding;
+    };
+    Containers::Array<Data> data{Count};
+    for(std::size_t i = 0; i != Count; ++i)
+        for(std::size_t j = 0; j != Components; ++j)
+            data[i].src.data[j] = Float(i*Components + j)/(Count*Components);
+
+    CORRADE_BENCHMARK(Repeats)
+        packInto(Containers::arrayCast<2, Float>(Containers::stridedArrayView(data).slice(&Data::src)),
+                 Containers::arrayCast<2, T>(Containers::stridedArrayView(data).slice(&Data::dst)));
+
+    CORRADE_COMPARE(data[Count - 1].dst.data[Components - 1], Math::pack<T>(data[Count - 1].src.data[Components - 1]));
+}
+
+void PackingBatchBenchmark::unpackHalfContiguous() {
+    Vec4<UnsignedShort> src[Count];
+    for(std::size_t i = 0; i != Count; ++i)
+        for(std::size_t j = 0; j != Components; ++j)
+            src[i].data[j] = UnsignedShort(0x3c00 + i*Components + j);
+
+    Vec4<Float> dst[Count];
+    CORRADE_BENCHMARK(Repeats)
+        unpackHalfInto(Containers::arrayCast<2, UnsignedShort>(Containers::stridedArrayView(src)),
+                       Containers::arrayCast<2, Float>(Containers::stridedArrayView(dst)));
+
+    CORRADE_COMPARE(dst[Count - 1].data[Components - 1], Math::unpackHalf(src[Count - 1].data[Components - 1]));
+}
+
+void PackingBatchBenchmark::unpackHalfStrided() {
+    struct Data {
+        Vec4<UnsignedShort> src;
+        Vec4<Float> dst;
+        Float padding;
+    };
+    Containers::Array<Data> data{Count};
+    for(std::size_t i = 0; i != Count; ++i)
+        for(std::size_t j = 0; j != Components; ++j)
+            data[i].src.data[j] = UnsignedShort(0x3c00 + i*Components + j);
+
+    CORRADE_BENCHMARK(Repeats)
+        unpackHalfInto(Containers::arrayCast<2, UnsignedShort>(Containers::stridedArrayView(data).slice(&Data::src)),
+                       Containers::arrayCast<2, Float>(Containers::stridedArrayView(data).slice(&Data::dst)));
+
+    CORRADE_COMPARE(data[Count - 1].dst.data[Components - 1], Math::unpackHalf(data[Count - 1].src.data[Components - 1]));
+}
+
+void PackingBatchBenchmark::packHalfContiguous() {
+    Vec4<Float> src[Count];
+    for(std::size_t i = 0; i != Count; ++i)
+        for(std::size_t j = 0; j != Components; ++j)
+            src[i].data[j] = Float((i*Components + j) % 2048);
+
+    Vec4<UnsignedShort> dst[Count];
+    CORRADE_BENCHMARK(Repeats)
+        packHalfInto(Containers::arrayCast<2, Float>(Containers::stridedArrayView(src)),
+                     Containers::arrayCast<2, UnsignedShort>(Containers::stridedArrayView(dst)));
+
+    CORRADE_COMPARE(dst[Count - 1].data[Components - 1], Math::packHalf(src[Count - 1].data[Components - 1]));
+}
+
+void PackingBatchBenchmark::packHalfStrided() {
+    struct Data {
+        Vec4<Float> src;
+        Vec4<UnsignedShort> dst;
+        UnsignedShort padding;
+    };
+    Containers::Array<Data> data{Count};
+    for(std::size_t i = 0; i != Count; ++i)
+        for(std::size_t j = 0; j != Components; ++j)
+            data[i].src.data[j] = Float((i*Components + j) % 2048);
+
+    CORRADE_BENCHMARK(Repeats)
+        packHalfInto(Containers::arrayCast<2, Float>(Containers::stridedArrayView(data).slice(&Data::src)),
+                     Containers::arrayCast<2, UnsignedShort>(Containers::stridedArrayView(data).slice(&Data::dst)));
+
+    CORRADE_COMPARE(data[Count - 1].dst.data[Components - 1], Math::packHalf(data[Count - 1].src.data[Components - 1]));
+}
+
+template<class T> void PackingBatchBenchmark::castIntoFloatContiguous() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    Vec4<T> src[Count];
+    for(std::size_t i = 0; i != Count; ++i)
+        for(std::size_t j = 0; j != Components; ++j)
+            src[i].data[j] = T(i*Components + j);
+
+    Vec4<Float> dst[Count];
+    CORRADE_BENCHMARK(Repeats)
+        castInto(Containers::arrayCast<2, T>(Containers::stridedArrayView(src)),
+                 Containers::arrayCast<2, Float>(Containers::stridedArrayView(dst)));
+
+    CORRADE_COMPARE(dst[Count - 1].data[Components - 1], Float(src[Count - 1].data[Components - 1]));
+}
+
+template<class T> void PackingBatchBenchmark::castFromFloatContiguous() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    Vec4<Float> src[Count];
+    for(std::size_t i = 0; i != Count; ++i)
+        for(std::size_t j = 0; j != Components; ++j)
+            src[i].data[j] = Float((i*Components + j) % 100)*1.25f;
+
+    Vec4<T> dst[Count];
+    CORRADE_BENCHMARK(Repeats)
+        castInto(Containers::arrayCast<2, Float>(Containers::stridedArrayView(src)),
+                 Containers::arrayCast<2, T>(Containers::stridedArrayView(dst)));
+
+    CORRADE_COMPARE(dst[Count - 1].data[Components - 1], T(src[Count - 1].data[Components - 1]));
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::PackingBatchBenchmark)
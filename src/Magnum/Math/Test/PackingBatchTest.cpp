@@ -24,6 +24,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <limits>
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/TestSuite/Tester.h>
@@ -51,6 +52,12 @@ struct PackingBatchTest: TestSuite::Tester {
     void unpackHalf();
     void packHalf();
 
+    template<class T> void unpackContiguous();
+    template<class T> void packContiguous();
+    void unpackHalfContiguous();
+    void packHalfContiguous();
+    template<class T> void castContiguous();
+
     template<class FloatingPoint, class Integral> void castUnsignedFloatingPoint();
     template<class FloatingPoint, class Integral> void castSignedFloatingPoint();
 
@@ -76,6 +83,22 @@ PackingBatchTest::PackingBatchTest() {
               &PackingBatchTest::unpackHalf,
               &PackingBatchTest::packHalf,
 
+              &PackingBatchTest::unpackContiguous<UnsignedByte>,
+              &PackingBatchTest::unpackContiguous<Byte>,
+              &PackingBatchTest::unpackContiguous<UnsignedShort>,
+              &PackingBatchTest::unpackContiguous<Short>,
+              &PackingBatchTest::packContiguous<UnsignedByte>,
+              &PackingBatchTest::packContiguous<Byte>,
+              &PackingBatchTest::packContiguous<UnsignedShort>,
+              &PackingBatchTest::packContiguous<Short>,
+              &PackingBatchTest::unpackHalfContiguous,
+              &PackingBatchTest::packHalfContiguous,
+              &PackingBatchTest::castContiguous<UnsignedByte>,
+              &PackingBatchTest::castContiguous<Byte>,
+              &PackingBatchTest::castContiguous<UnsignedShort>,
+              &PackingBatchTest::castContiguous<Short>,
+              &PackingBatchTest::castContiguous<Int>,
+
               &PackingBatchTest::castUnsignedFloatingPoint<Float, UnsignedByte>,
               &PackingBatchTest::castUnsignedFloatingPoint<Float, UnsignedShort>,
               &PackingBatchTest::castUnsignedFloatingPoint<Float, UnsignedInt>,
@@ -484,6 +507,182 @@ void PackingBatchTest::packHalf() {
         CORRADE_COMPARE(Math::packHalf(data[i].src), data[i].dst);
 }
 
+/* The following use contiguous views, which go through the SIMD code paths if
+   the CPU supports them. The count isn't a multiple of any vector size in
+   order to test the remainder handling as well, and the output is compared
+   against the strided variant, which uses the scalar code. */
+enum: std::size_t { ContiguousCount = 37 };
+
+template<class T> void PackingBatchTest::unpackContiguous() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    struct Data {
+        T src;
+        Float dst;
+    } data[ContiguousCount];
+    T src[ContiguousCount];
+    for(std::size_t i = 0; i != ContiguousCount; ++i) {
+        /* Spanning the whole range, including the minimum */
+        const Long min = std::numeric_limits<T>::min();
+        const Long max = std::numeric_limits<T>::max();
+        data[i].src = src[i] = T(min + (max - min)*Long(i)/Long(ContiguousCount - 1));
+    }
+
+    Float dst[ContiguousCount];
+    unpackInto(Containers::stridedArrayView(src), Containers::stridedArrayView(dst));
+    unpackInto(
+        Containers::stridedArrayView(data).slice(&Data::src),
+        Containers::stridedArrayView(data).slice(&Data::dst));
+    CORRADE_COMPARE_AS(
+        Containers::stridedArrayView(dst),
+        Containers::stridedArrayView(data).slice(&Data::dst),
+        TestSuite::Compare::Container);
+
+    /* Ensure the results are consistent with non-batch APIs */
+    for(std::size_t i = 0; i != ContiguousCount; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(dst[i], Math::unpack<Float>(src[i]));
+    }
+}
+
+template<class T> void PackingBatchTest::packContiguous() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    struct Data {
+        Float src;
+        T dst;
+    } data[ContiguousCount];
+    Float src[ContiguousCount];
+    for(std::size_t i = 0; i != ContiguousCount; ++i) {
+        /* Spanning the whole range, with the values being mostly somewhere
+           between the integers to verify the rounding */
+        const Float value = Float(i)/(ContiguousCount - 1);
+        data[i].src = src[i] = std::is_signed<T>::value ? value*2.0f - 1.0f : value;
+    }
+    /* Values (nearly) halfway between two integers, to verify the rounding
+       direction */
+    data[3].src = src[3] = 2.5f/Implementation::bitMax<T>();
+    if(std::is_signed<T>::value)
+        data[4].src = src[4] = -2.5f/Implementation::bitMax<T>();
+
+    T dst[ContiguousCount];
+    packInto(Containers::stridedArrayView(src), Containers::stridedArrayView(dst));
+    packInto(
+        Containers::stridedArrayView(data).slice(&Data::src),
+        Containers::stridedArrayView(data).slice(&Data::dst));
+    CORRADE_COMPARE_AS(
+        Containers::stridedArrayView(dst),
+        Containers::stridedArrayView(data).slice(&Data::dst),
+        TestSuite::Compare::Container);
+
+    /* Ensure the results are consistent with non-batch APIs */
+    for(std::size_t i = 0; i != ContiguousCount; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(dst[i], Math::pack<T>(src[i]));
+    }
+}
+
+void PackingBatchTest::unpackHalfContiguous() {
+    struct Data {
+        UnsignedShort src;
+        Float dst;
+    } data[ContiguousCount];
+    UnsignedShort src[ContiguousCount];
+    /* Going through all exponents, both signs, including denormals,
+       infinities and zeros */
+    for(std::size_t i = 0; i != ContiguousCount; ++i)
+        data[i].src = src[i] = UnsignedShort(i*0xffff/(ContiguousCount - 1));
+    data[5].src = src[5] = 0x0000;
+    data[6].src = src[6] = 0x8000;
+    data[7].src = src[7] = 0x7c00;
+    data[8].src = src[8] = 0xfc00;
+    data[9].src = src[9] = 0x0001;
+
+    Float dst[ContiguousCount];
+    unpackHalfInto(Containers::stridedArrayView(src), Containers::stridedArrayView(dst));
+    unpackHalfInto(
+        Containers::stridedArrayView(data).slice(&Data::src),
+        Containers::stridedArrayView(data).slice(&Data::dst));
+    for(std::size_t i = 0; i != ContiguousCount; ++i) {
+        CORRADE_ITERATION(i);
+        /* NaN payloads can differ, compare just that it's a NaN in that
+           case */
+        if(data[i].dst != data[i].dst)
+            CORRADE_VERIFY(dst[i] != dst[i]);
+        else CORRADE_COMPARE(dst[i], data[i].dst);
+    }
+}
+
+void PackingBatchTest::packHalfContiguous() {
+    struct Data {
+        Float src;
+        UnsignedShort dst;
+    } data[ContiguousCount];
+    Float src[ContiguousCount];
+    /* Spanning the whole range, with values that need to be rounded */
+    for(std::size_t i = 0; i != ContiguousCount; ++i)
+        data[i].src = src[i] = (Float(i) - ContiguousCount/2)*1817.37f;
+    /* Zeros, denormals, the largest value and values that overflow to an
+       infinity */
+    data[0].src = src[0] = 0.0f;
+    data[1].src = src[1] = -0.0f;
+    data[2].src = src[2] = 3.7e-6f;
+    data[3].src = src[3] = -1.1e-7f;
+    data[4].src = src[4] = 65504.0f;
+    data[5].src = src[5] = 65535.0f;
+    data[6].src = src[6] = -65536.0f;
+    data[7].src = src[7] = 1.0e10f;
+    data[8].src = src[8] = Constants::inf();
+    data[9].src = src[9] = -Constants::inf();
+
+    UnsignedShort dst[ContiguousCount];
+    packHalfInto(Containers::stridedArrayView(src), Containers::stridedArrayView(dst));
+    packHalfInto(
+        Containers::stridedArrayView(data).slice(&Data::src),
+        Containers::stridedArrayView(data).slice(&Data::dst));
+    CORRADE_COMPARE_AS(
+        Containers::stridedArrayView(dst),
+        Containers::stridedArrayView(data).slice(&Data::dst),
+        TestSuite::Compare::Container);
+}
+
+template<class T> void PackingBatchTest::castContiguous() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    struct Data {
+        Float src;
+        T dst;
+        Float dstBack;
+    } data[ContiguousCount];
+    Float src[ContiguousCount];
+    for(std::size_t i = 0; i != ContiguousCount; ++i) {
+        /* Values that need to be truncated, in range of all types */
+        const Float value = Float(i)*3.25f;
+        data[i].src = src[i] = std::is_signed<T>::value && i % 2 ? -value : value;
+    }
+
+    T dst[ContiguousCount];
+    castInto(Containers::stridedArrayView(src), Containers::stridedArrayView(dst));
+    castInto(
+        Containers::stridedArrayView(data).slice(&Data::src),
+        Containers::stridedArrayView(data).slice(&Data::dst));
+    CORRADE_COMPARE_AS(
+        Containers::stridedArrayView(dst),
+        Containers::stridedArrayView(data).slice(&Data::dst),
+        TestSuite::Compare::Container);
+
+    /* Test the other way around as well */
+    Float dstBack[ContiguousCount];
+    castInto(Containers::stridedArrayView(dst), Containers::stridedArrayView(dstBack));
+    castInto(
+        Containers::stridedArrayView(data).slice(&Data::dst),
+        Containers::stridedArrayView(data).slice(&Data::dstBack));
+    CORRADE_COMPARE_AS(
+        Containers::stridedArrayView(dstBack),
+        Containers::stridedArrayView(data).slice(&Data::dstBack),
+        TestSuite::Compare::Container);
+}
+
 template<class FloatingPoint, class Integral> void PackingBatchTest::castUnsignedFloatingPoint() {
     setTestCaseTemplateName({TypeTraits<FloatingPoint>::name(), TypeTraits<Integral>::name()});
 
@@ -0,0 +1,272 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "GenerateMeshlets.h"
+
+#include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/MeshTools/BoundingVolume.h"
+#include "Magnum/MeshTools/GenerateIndices.h"
+#include "Magnum/MeshTools/Implementation/Tipsify.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+template<class T> Meshlets generateMeshletsImplementation(const Containers::StridedArrayView1D<const T>& indices, const UnsignedInt vertexCount, const UnsignedInt maxVertexCount, const UnsignedInt maxTriangleCount) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::generateMeshlets(): index count not divisible by 3", {});
+    CORRADE_ASSERT(maxVertexCount >= 3 && maxVertexCount <= 256,
+        "MeshTools::generateMeshlets(): expected max vertex count to be between 3 and 256 but got" << maxVertexCount, {});
+    CORRADE_ASSERT(maxTriangleCount,
+        "MeshTools::generateMeshlets(): expected non-zero max triangle count", {});
+    #ifndef CORRADE_NO_ASSERT
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        CORRADE_ASSERT(indices[i] < vertexCount,
+            "MeshTools::generateMeshlets(): index" << UnsignedInt(indices[i]) << "out of range for" << vertexCount << "vertices", {});
+    #endif
+
+    const std::size_t triangleCount = indices.size()/3;
+
+    /* Neighboring triangles for each vertex, per-vertex live triangle count */
+    Containers::Array<UnsignedInt> liveTriangleCount, neighborOffset, neighbors;
+    Implementation::buildAdjacency<T>(indices, vertexCount, liveTriangleCount, neighborOffset, neighbors);
+
+    /* Position of each vertex in the current meshlet, ~UnsignedInt{} if it's
+       not there */
+    Containers::Array<UnsignedInt> localIndex{DirectInit, vertexCount, ~UnsignedInt{}};
+    Containers::BitArray emitted{ValueInit, triangleCount};
+
+    /* Every index ends up in the output exactly once */
+    Meshlets out;
+    arrayReserve(out.triangles, indices.size());
+
+    const auto newVertexCount = [&](const std::size_t triangle) {
+        const UnsignedInt a = indices[triangle*3 + 0];
+        const UnsignedInt b = indices[triangle*3 + 1];
+        const UnsignedInt c = indices[triangle*3 + 2];
+        UnsignedInt count = 0;
+        if(localIndex[a] == ~UnsignedInt{})
+            ++count;
+        if(b != a && localIndex[b] == ~UnsignedInt{})
+            ++count;
+        if(c != a && c != b && localIndex[c] == ~UnsignedInt{})
+            ++count;
+        return count;
+    };
+
+    Meshlet current{0, 0, 0, 0};
+    const auto finishMeshlet = [&]() {
+        for(UnsignedInt i = 0; i != current.vertexCount; ++i)
+            localIndex[out.vertices[current.vertexOffset + i]] = ~UnsignedInt{};
+        arrayAppend(out.meshlets, current);
+        current.vertexOffset += current.vertexCount;
+        current.triangleOffset += current.triangleCount;
+        current.vertexCount = 0;
+        current.triangleCount = 0;
+    };
+
+    std::size_t cursor = 0;
+    for(std::size_t i = 0; i != triangleCount; ++i) {
+        /* Find an adjacent triangle that adds the least new vertices, stop
+           early if there's one that doesn't add any */
+        std::size_t triangle = ~std::size_t{};
+        UnsignedInt triangleNewVertexCount = 4;
+        for(UnsignedInt j = 0; j != current.vertexCount && triangleNewVertexCount; ++j) {
+            const UnsignedInt v = out.vertices[current.vertexOffset + j];
+            if(!liveTriangleCount[v]) continue;
+
+            for(UnsignedInt ti = neighborOffset[v]; ti != neighborOffset[v + 1]; ++ti) {
+                const UnsignedInt t = neighbors[ti];
+                if(emitted[t]) continue;
+
+                const UnsignedInt count = newVertexCount(t);
+                if(count < triangleNewVertexCount) {
+                    triangle = t;
+                    triangleNewVertexCount = count;
+                    if(!count) break;
+                }
+            }
+        }
+
+        /* If there's none, take the next unused triangle in the original
+           order */
+        if(triangle == ~std::size_t{}) {
+            while(emitted[cursor]) ++cursor;
+            triangle = cursor;
+            triangleNewVertexCount = newVertexCount(triangle);
+        }
+
+        /* If the triangle doesn't fit, start a new meshlet. The new vertex
+           count needs to be recalculated as it was relative to the previous
+           meshlet. If the triangle was an adjacent one, it's not guaranteed
+           to be the best candidate for starting a new meshlet but it's
+           likely a good one. */
+        if(current.triangleCount == maxTriangleCount || current.vertexCount + triangleNewVertexCount > maxVertexCount) {
+            finishMeshlet();
+            triangleNewVertexCount = newVertexCount(triangle);
+        }
+
+        /* Add the triangle */
+        emitted.set(triangle);
+        for(std::size_t j = 0; j != 3; ++j) {
+            const UnsignedInt v = indices[triangle*3 + j];
+            if(localIndex[v] == ~UnsignedInt{}) {
+                localIndex[v] = current.vertexCount++;
+                arrayAppend(out.vertices, v);
+            }
+            arrayAppend(out.triangles, UnsignedByte(localIndex[v]));
+            --liveTriangleCount[v];
+        }
+        ++current.triangleCount;
+    }
+
+    if(current.triangleCount) finishMeshlet();
+
+    return out;
+}
+
+}
+
+Meshlets generateMeshlets(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const UnsignedInt vertexCount, const UnsignedInt maxVertexCount, const UnsignedInt maxTriangleCount) {
+    return generateMeshletsImplementation(indices, vertexCount, maxVertexCount, maxTriangleCount);
+}
+
+Meshlets generateMeshlets(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const UnsignedInt vertexCount, const UnsignedInt maxVertexCount, const UnsignedInt maxTriangleCount) {
+    return generateMeshletsImplementation(indices, vertexCount, maxVertexCount, maxTriangleCount);
+}
+
+Meshlets generateMeshlets(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const UnsignedInt vertexCount, const UnsignedInt maxVertexCount, const UnsignedInt maxTriangleCount) {
+    return generateMeshletsImplementation(indices, vertexCount, maxVertexCount, maxTriangleCount);
+}
+
+Meshlets generateMeshlets(const Trade::MeshData& mesh, const UnsignedInt maxVertexCount, const UnsignedInt maxTriangleCount) {
+    CORRADE_ASSERT(mesh.primitive() == MeshPrimitive::Triangles,
+        "MeshTools::generateMeshlets(): expected a" << MeshPrimitive::Triangles << "mesh, got" << mesh.primitive(), {});
+    CORRADE_ASSERT(!mesh.isIndexed() || !isMeshIndexTypeImplementationSpecific(mesh.indexType()),
+        "MeshTools::generateMeshlets(): mesh has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()), {});
+
+    const Containers::Array<UnsignedInt> indices = mesh.isIndexed() ?
+        mesh.indicesAsArray() : generateTrivialIndices(mesh.vertexCount());
+    return generateMeshletsImplementation(Containers::stridedArrayView(indices), mesh.vertexCount(), maxVertexCount, maxTriangleCount);
+}
+
+Containers::Array<MeshletBounds> generateMeshletBounds(const Meshlets& meshlets, const Containers::StridedArrayView1D<const Vector3>& positions) {
+    Containers::Array<MeshletBounds> out{NoInit, meshlets.meshlets.size()};
+    generateMeshletBoundsInto(meshlets, positions, out);
+    return out;
+}
+
+void generateMeshletBoundsInto(const Meshlets& meshlets, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<MeshletBounds>& bounds) {
+    CORRADE_ASSERT(bounds.size() == meshlets.meshlets.size(),
+        "MeshTools::generateMeshletBoundsInto(): expected" << meshlets.meshlets.size() << "items but got" << bounds.size(), );
+
+    /* Meshlet vertex positions and triangle normals, reused across meshlets */
+    Containers::Array<Vector3> meshletPositions;
+    Containers::Array<Vector3> normals;
+
+    for(std::size_t i = 0; i != meshlets.meshlets.size(); ++i) {
+        const Meshlet& meshlet = meshlets.meshlets[i];
+        MeshletBounds& out = bounds[i];
+
+        arrayResize(meshletPositions, NoInit, meshlet.vertexCount);
+        for(UnsignedInt j = 0; j != meshlet.vertexCount; ++j) {
+            const UnsignedInt vertex = meshlets.vertices[meshlet.vertexOffset + j];
+            CORRADE_ASSERT(vertex < positions.size(),
+                "MeshTools::generateMeshletBoundsInto(): vertex" << vertex << "out of range for" << positions.size() << "positions", );
+            meshletPositions[j] = positions[vertex];
+        }
+
+        const Containers::Pair<Vector3, Float> sphere = boundingSphereBouncingBubble(meshletPositions);
+        out.center = sphere.first();
+        out.radius = sphere.second();
+
+        /* Normalized triangle normals, zero for degenerate triangles. The
+           axis is their average. */
+        const Containers::ArrayView<const UnsignedByte> triangles = meshlets.triangles.sliceSize(meshlet.triangleOffset*3, meshlet.triangleCount*3);
+        arrayResize(normals, NoInit, meshlet.triangleCount);
+        Vector3 axis;
+        for(UnsignedInt j = 0; j != meshlet.triangleCount; ++j) {
+            const Vector3 a = meshletPositions[triangles[j*3 + 0]];
+            const Vector3 b = meshletPositions[triangles[j*3 + 1]];
+            const Vector3 c = meshletPositions[triangles[j*3 + 2]];
+            const Vector3 normal = Math::cross(b - a, c - a);
+            const Float length = normal.length();
+            normals[j] = length > 0.0f ? normal/length : Vector3{};
+            axis += normals[j];
+        }
+
+        /* If all triangles are degenerate or the normals cancel out, there's
+           no cone that could be used for culling */
+        const Float axisLength = axis.length();
+        if(axisLength == 0.0f) {
+            out.coneApex = out.center;
+            out.coneAxis = {};
+            out.coneCutoff = 1.0f;
+            continue;
+        }
+        axis /= axisLength;
+        out.coneAxis = axis;
+
+        /* Find the largest angle from the axis. If it's close to or over 90°,
+           the normals span a hemisphere or more and the cone can't be used
+           for culling. */
+        Float minDot = 1.0f;
+        for(const Vector3& normal: normals)
+            if(!normal.isZero())
+                minDot = Math::min(minDot, Math::dot(normal, axis));
+        if(minDot <= 0.1f) {
+            out.coneApex = out.center;
+            out.coneCutoff = 1.0f;
+            continue;
+        }
+
+        /* Place the apex along the axis behind all triangle planes so the
+           cone test is conservative for the whole meshlet. For each triangle
+           it's the distance at which a ray from the center in the direction
+           opposite to the axis intersects the triangle plane, which is in
+           front of the center for concave meshlets. The dot product of the
+           normal and the axis is always above the threshold checked above,
+           so the division is safe. */
+        Float maxDistance = 0.0f;
+        for(UnsignedInt j = 0; j != meshlet.triangleCount; ++j) {
+            if(normals[j].isZero()) continue;
+
+            const Vector3 vertex = meshletPositions[triangles[j*3 + 0]];
+            maxDistance = Math::max(maxDistance, Math::dot(out.center - vertex, normals[j])/Math::dot(axis, normals[j]));
+        }
+
+        out.coneApex = out.center - axis*maxDistance;
+        out.coneCutoff = Math::sqrt(1.0f - minDot*minDot);
+    }
+}
+
+}}
@@ -0,0 +1,228 @@
+#ifndef Magnum_MeshTools_GenerateMeshlets_h
+#define Magnum_MeshTools_GenerateMeshlets_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Struct @ref Magnum::MeshTools::Meshlet, @ref Magnum::MeshTools::Meshlets, @ref Magnum::MeshTools::MeshletBounds, function @ref Magnum::MeshTools::generateMeshlets(), @ref Magnum::MeshTools::generateMeshletBounds(), @ref Magnum::MeshTools::generateMeshletBoundsInto()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Meshlet
+@m_since_latest
+
+A single cluster of triangles produced by @ref generateMeshlets().
+@see @ref Meshlets
+*/
+struct Meshlet {
+    /**
+     * @brief Offset of the first vertex
+     *
+     * Offset into the @ref Meshlets::vertices array.
+     */
+    UnsignedInt vertexOffset;
+
+    /**
+     * @brief Offset of the first triangle
+     *
+     * Offset into the @ref Meshlets::triangles array, in triangles, i.e. the
+     * first index is at @cpp 3*triangleOffset @ce.
+     */
+    UnsignedInt triangleOffset;
+
+    /** @brief Vertex count */
+    UnsignedInt vertexCount;
+
+    /** @brief Triangle count */
+    UnsignedInt triangleCount;
+};
+
+/**
+@brief Meshlets
+@m_since_latest
+
+Output of @ref generateMeshlets(). Each @ref Meshlet references a contiguous
+range of @ref vertices, which are indices into the original vertex data, and a
+contiguous range of @ref triangles, which are triplets of indices into the
+meshlet vertex range. The layout matches what mesh shaders usually expect and
+the arrays can be uploaded to the GPU directly.
+*/
+struct Meshlets {
+    /** @brief Meshlets */
+    Containers::Array<Meshlet> meshlets;
+
+    /**
+     * @brief Meshlet vertices
+     *
+     * Indices into the original vertex data, referenced by
+     * @ref Meshlet::vertexOffset and @ref Meshlet::vertexCount.
+     */
+    Containers::Array<UnsignedInt> vertices;
+
+    /**
+     * @brief Meshlet triangles
+     *
+     * Three indices for each triangle, relative to the
+     * @ref Meshlet::vertexOffset of the meshlet they belong to. Referenced by
+     * @ref Meshlet::triangleOffset and @ref Meshlet::triangleCount.
+     */
+    Containers::Array<UnsignedByte> triangles;
+};
+
+/**
+@brief Generate meshlets from a triangle mesh
+@param indices          Triangle mesh indices
+@param vertexCount      Vertex count
+@param maxVertexCount   Max vertex count in a single meshlet
+@param maxTriangleCount Max triangle count in a single meshlet
+@m_since_latest
+
+Greedily partitions the triangles into meshlets with at most
+@p maxVertexCount vertices and @p maxTriangleCount triangles. A meshlet grows
+by always adding the not yet used triangle that's adjacent to the meshlet
+vertices and adds the least amount of new vertices. If no adjacent triangle is
+left, the next unused triangle in the index buffer order is added. A new
+meshlet is started once the next triangle doesn't fit anymore. The defaults
+are values commonly used for mesh shaders, the output is however also suited
+for per-cluster culling on the CPU, see @ref generateMeshletBounds() for more
+information.
+
+The triangle order in the index buffer affects the result --- optimizing it
+with @ref optimizeVertexCacheInPlace() first makes the meshlets more compact.
+Expects that the index count is divisible by @cpp 3 @ce, all indices are less
+than @p vertexCount, @p maxVertexCount is at least @cpp 3 @ce and at most
+@cpp 256 @ce and @p maxTriangleCount is not zero.
+*/
+MAGNUM_MESHTOOLS_EXPORT Meshlets generateMeshlets(const Containers::StridedArrayView1D<const UnsignedInt>& indices, UnsignedInt vertexCount, UnsignedInt maxVertexCount = 64, UnsignedInt maxTriangleCount = 124);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT Meshlets generateMeshlets(const Containers::StridedArrayView1D<const UnsignedShort>& indices, UnsignedInt vertexCount, UnsignedInt maxVertexCount = 64, UnsignedInt maxTriangleCount = 124);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT Meshlets generateMeshlets(const Containers::StridedArrayView1D<const UnsignedByte>& indices, UnsignedInt vertexCount, UnsignedInt maxVertexCount = 64, UnsignedInt maxTriangleCount = 124);
+
+/**
+@brief Generate meshlets from a triangle mesh
+@m_since_latest
+
+Expects that the mesh is a @ref MeshPrimitive::Triangles. If the mesh is
+indexed, calls @ref generateMeshlets(const Containers::StridedArrayView1D<const UnsignedInt>&, UnsignedInt, UnsignedInt, UnsignedInt)
+with @ref Trade::MeshData::indicesAsArray(), otherwise with trivial indices.
+The index buffer is expected to not have an implementation-specific type.
+*/
+MAGNUM_MESHTOOLS_EXPORT Meshlets generateMeshlets(const Trade::MeshData& mesh, UnsignedInt maxVertexCount = 64, UnsignedInt maxTriangleCount = 124);
+
+/**
+@brief Meshlet bounds
+@m_since_latest
+
+@see @ref generateMeshletBounds()
+*/
+struct MeshletBounds {
+    /** @brief Bounding sphere center */
+    Vector3 center;
+
+    /** @brief Bounding sphere radius */
+    Float radius;
+
+    /** @brief Normal cone apex */
+    Vector3 coneApex;
+
+    /**
+     * @brief Normal cone axis
+     *
+     * Normalized average of all triangle normals in the meshlet. Zero if all
+     * triangles are degenerate.
+     */
+    Vector3 coneAxis;
+
+    /**
+     * @brief Normal cone cutoff
+     *
+     * Sine of the cone half-angle. Set to @cpp 1.0f @ce if the normals span
+     * an approximate hemisphere or more, in which case the meshlet can't be
+     * culled based on the normal cone.
+     */
+    Float coneCutoff;
+};
+
+/**
+@brief Generate meshlet bounds
+@param meshlets     Meshlets
+@param positions    Vertex positions
+@m_since_latest
+
+Calculates a bounding sphere for each meshlet using
+@ref boundingSphereBouncingBubble() and a cone enclosing normals of all its
+triangles. The sphere can be used for frustum and occlusion culling, for
+example with @ref Math::Intersection::sphereFrustum(). The meshlet is
+entirely backfacing when viewed from @cpp cameraPosition @ce and can be culled
+if the following condition holds:
+
+@code{.cpp}
+Math::dot((bounds.coneApex - cameraPosition).normalized(), bounds.coneAxis)
+    > bounds.coneCutoff
+@endcode
+
+Expects that all @ref Meshlets::vertices are less than @p positions size.
+Algorithm for the normal cone is based on *Arseny Kapoulkine --- meshoptimizer,
+https://github.com/zeux/meshoptimizer*.
+@see @ref generateMeshletBoundsInto()
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<MeshletBounds> generateMeshletBounds(const Meshlets& meshlets, const Containers::StridedArrayView1D<const Vector3>& positions);
+
+/**
+@brief Generate meshlet bounds into an existing array
+@param[in] meshlets     Meshlets
+@param[in] positions    Vertex positions
+@param[out] bounds      Where to put the calculated bounds
+@m_since_latest
+
+A variant of @ref generateMeshletBounds() that fills existing memory instead
+of allocating a new array. The @p bounds array is expected to have the same
+size as @ref Meshlets::meshlets.
+*/
+MAGNUM_MESHTOOLS_EXPORT void generateMeshletBoundsInto(const Meshlets& meshlets, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<MeshletBounds>& bounds);
+
+}}
+
+#endif
@@ -26,10 +26,13 @@
 
 #include "GenerateNormals.h"
 
+#include <algorithm> /* std::sort() */
+#include <atomic>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/StridedArrayView.h>
 
+#include "Magnum/Implementation/parallel.h"
 #include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Vector3.h"
 
@@ -55,6 +58,92 @@ Containers::Array<Vector3> generateFlatNormals(const Containers::StridedArrayVie
 
 namespace {
 
+/* Builds a vertex -> triangle corner mapping. For vertex i,
+   corners[offsets[i]] until corners[offsets[i + 1]] contains positions in the
+   index array (i.e., triangle ID times 3 plus the corner) referencing it, in
+   an ascending order. The indices are expected to be validated by the
+   caller. */
+template<class T> void buildAdjacency(const Containers::StridedArrayView1D<const T>& indices, const std::size_t vertexCount, const Containers::ArrayView<UnsignedInt> offsets, const Containers::ArrayView<UnsignedInt> corners, const UnsignedInt threadCount) {
+    CORRADE_INTERNAL_ASSERT(offsets.size() == vertexCount + 1 && corners.size() == indices.size());
+
+    /* Serial variant is a plain counting sort */
+    if(Magnum::Implementation::parallelThreadCount(threadCount, indices.size()) == 1) {
+        /* Gather count of triangles for every vertex, shifted by one */
+        for(UnsignedInt& i: offsets) i = 0;
+        for(const T index: indices)
+            ++offsets[index + 1];
+
+        /* Turn that into a running offset array:
+           offsets[i + 1] - offsets[i] is triangle count for vertex i
+           offsets[i] is offset into the corner array for vertex i */
+        for(std::size_t i = 0; i != vertexCount; ++i)
+            offsets[i + 1] += offsets[i];
+        CORRADE_INTERNAL_ASSERT(offsets[vertexCount] == indices.size());
+
+        /* Gather corners for every vertex, using offsets[i] as a write cursor
+           for vertex i. Going through the indices in order so the corners end
+           up sorted. */
+        for(std::size_t i = 0; i != indices.size(); ++i)
+            corners[offsets[indices[i]]++] = UnsignedInt(i);
+
+        /* Now offsets[i] points to the end of vertex i, which is the begin of
+           vertex i + 1. Shift them back. */
+        for(std::size_t i = vertexCount; i != 0; --i)
+            offsets[i] = offsets[i - 1];
+        offsets[0] = 0;
+        return;
+    }
+
+    /* The parallel variant counts the triangles with atomics, calculates the
+       offsets with a parallel prefix sum and then puts the corners to their
+       place with atomics again. That makes the order of corners for each
+       vertex nondeterministic, so they're sorted afterwards, which gives the
+       same output as the serial variant. */
+    Containers::Array<std::atomic<UnsignedInt>> counts{ValueInit, vertexCount};
+    Magnum::Implementation::parallelFor(indices.size(), threadCount, [&](const std::size_t begin, const std::size_t end, UnsignedInt) {
+        for(std::size_t i = begin; i != end; ++i)
+            counts[indices[i]].fetch_add(1, std::memory_order_relaxed);
+    });
+
+    /* The partitioning is the same for both passes, so the per-range sums can
+       be used as offsets in the second */
+    Containers::Array<UnsignedInt> rangeOffsets{ValueInit, Magnum::Implementation::parallelThreadCount(threadCount, vertexCount)};
+    Magnum::Implementation::parallelFor(vertexCount, threadCount, [&](const std::size_t begin, const std::size_t end, const UnsignedInt thread) {
+        UnsignedInt sum = 0;
+        for(std::size_t i = begin; i != end; ++i)
+            sum += counts[i].load(std::memory_order_relaxed);
+        rangeOffsets[thread] = sum;
+    });
+    UnsignedInt rangeOffset = 0;
+    for(UnsignedInt& i: rangeOffsets) {
+        const UnsignedInt sum = i;
+        i = rangeOffset;
+        rangeOffset += sum;
+    }
+    CORRADE_INTERNAL_ASSERT(rangeOffset == indices.size());
+    Magnum::Implementation::parallelFor(vertexCount, threadCount, [&](const std::size_t begin, const std::size_t end, const UnsignedInt thread) {
+        UnsignedInt offset = rangeOffsets[thread];
+        for(std::size_t i = begin; i != end; ++i) {
+            const UnsignedInt count = counts[i].load(std::memory_order_relaxed);
+            offsets[i] = offset;
+            /* Reusing the counts as write cursors for the next step */
+            counts[i].store(offset, std::memory_order_relaxed);
+            offset += count;
+        }
+    });
+    offsets[vertexCount] = UnsignedInt(indices.size());
+
+    Magnum::Implementation::parallelFor(indices.size(), threadCount, [&](const std::size_t begin, const std::size_t end, UnsignedInt) {
+        for(std::size_t i = begin; i != end; ++i)
+            corners[counts[indices[i]].fetch_add(1, std::memory_order_relaxed)] = UnsignedInt(i);
+    });
+
+    Magnum::Implementation::parallelFor(vertexCount, threadCount, [&](const std::size_t begin, const std::size_t end, UnsignedInt) {
+        for(std::size_t i = begin; i != end; ++i)
+            std::sort(corners.data() + offsets[i], corners.data() + offsets[i + 1]);
+    });
+}
+
 #if defined(CORRADE_TARGET_MSVC) && !defined(CORRADE_MSVC_COMPATIBILITY) && _MSC_VER >= 1920 && _MSC_VER < 1930
 /* When using /permissive- with MSVC2019, using namespace inside the function
    below FOR SOME REASON gets lost when instantiating the template. That's
@@ -63,57 +152,9 @@ namespace {
 using namespace Math::Literals;
 #endif
 
-template<class T> inline void generateSmoothNormalsIntoImplementation(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals) {
-    CORRADE_ASSERT(indices.size() % 3 == 0,
-        "MeshTools::generateSmoothNormalsInto(): index count not divisible by 3", );
-    CORRADE_ASSERT(normals.size() == positions.size(),
-        "MeshTools::generateSmoothNormalsInto(): bad output size, expected" << positions.size() << "but got" << normals.size(), );
-
-    if(indices.isEmpty()) return;
-
-    /* Gather count of triangles for every vertex. This abuses the output
-       storage to avoid extra allocations, zero-initialize it first to avoid
-       random memory getting used. */
-    Containers::StridedArrayView1D<UnsignedInt> triangleCount =
-        Containers::arrayCast<UnsignedInt>(normals);
-    for(UnsignedInt& i: triangleCount) i = 0;
-    for(const T index: indices) {
-        CORRADE_ASSERT(index < positions.size(), "MeshTools::generateSmoothNormalsInto(): index" << index << "out of range for" << positions.size() << "elements", );
-        ++triangleCount[index];
-    }
-
-    /* Turn that into a running offset array:
-       triangleOffset[i + 1] - triangleOffset[i] is triangle count for vertex i
-       triangleOffset[i] is offset into an triangle ID array for vertex i */
-    Containers::Array<UnsignedInt> triangleOffset{NoInit, positions.size() + 1};
-    triangleOffset[0] = 0;
-    for(std::size_t i = 0; i != triangleCount.size(); ++i)
-        triangleOffset[i + 1] = triangleOffset[i] + triangleCount[i];
-
-    CORRADE_INTERNAL_ASSERT(triangleOffset.back() == indices.size());
-
-    /* Gather triangle IDs for every vertex. For vertex i,
-       triangleIds[triangleOffset[i]] until triangleIds[triangleOffset[i + 1]]
-       contains IDs of triangles that contain it. */
-    Containers::Array<T> triangleIds{NoInit, indices.size()};
-    for(std::size_t i = 0; i != indices.size(); ++i) {
-        const T triangleId = i/3;
-        const T vertexId = indices[i];
-
-        /* How many triangle IDs is still left to be written, which also means
-           the offset where we put the ID. Decrement that for the next run. */
-        const std::size_t triangleIdsLeftForVertex = triangleCount[vertexId]--;
-        triangleIds[triangleOffset[vertexId + 1] - triangleIdsLeftForVertex] = triangleId;
-    }
-
-    /* Now, triangleCount should be all zeros, we don't need it anymore and the
-       underlying `normals` array is ready to get filled with real output. */
-
-    /* Precalculate cross product and interior angles of each face --- the loop
-       below would otherwise calculate it for every vertex, which is at least
-       3x as much work */
-    Containers::Array<Containers::Pair<Vector3, Math::Vector3<Rad>>> crossAngles{NoInit, indices.size()/3};
-    for(std::size_t i = 0; i != crossAngles.size(); ++i) {
+/* Cross product and interior angles of a range of faces */
+template<class T> void crossAnglesInto(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::ArrayView<Containers::Pair<Vector3, Math::Vector3<Rad>>> crossAngles, const std::size_t begin, const std::size_t end) {
+    for(std::size_t i = begin; i != end; ++i) {
         const Vector3 v0 = positions[indices[i*3 + 0]];
         const Vector3 v1 = positions[indices[i*3 + 1]];
         const Vector3 v2 = positions[indices[i*3 + 2]];
@@ -147,46 +188,71 @@ template<class T> inline void generateSmoothNormalsIntoImplementation(const Cont
         crossAngles[i].second()[2] = Rad(180.0_degf)
             - crossAngles[i].second()[0] - crossAngles[i].second()[1];
     }
+}
+
+template<class T> void generateSmoothNormalsIntoImplementation(const Containers::StridedArrayView1D<const T>& indices, const Containers::ArrayView<const UnsignedInt> offsets, const Containers::ArrayView<const UnsignedInt> corners, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const UnsignedInt threadCount) {
+    /* Precalculate cross product and interior angles of each face --- the loop
+       below would otherwise calculate it for every vertex, which is at least
+       3x as much work */
+    Containers::Array<Containers::Pair<Vector3, Math::Vector3<Rad>>> crossAngles{NoInit, indices.size()/3};
+    Magnum::Implementation::parallelFor(crossAngles.size(), threadCount, [&](const std::size_t begin, const std::size_t end, UnsignedInt) {
+        crossAnglesInto(indices, positions, crossAngles, begin, end);
+    });
 
     /* For every vertex v, calculate normals from all faces it belongs to and
-       average them */
-    for(std::size_t v = 0; v != positions.size(); ++v) {
-        /* normals are an external memory, ensure we accumulate from zero */
-        normals[v] = Vector3{Math::ZeroInit};
-
-        /* Go through all triangles sharing this vertex */
-        for(std::size_t t = triangleOffset[v]; t != triangleOffset[v + 1]; ++t) {
-            const std::size_t baseIndex = triangleIds[t]*3;
-            const T v0i = indices[baseIndex + 0];
-            const T v1i = indices[baseIndex + 1];
-            const T v2i = indices[baseIndex + 2];
-
-            /* Cross product is a vector in direction of the normal with length
-               equal to size of the parallelogram */
-            const Containers::Pair<Vector3, Math::Vector3<Rad>>& crossAngle = crossAngles[triangleIds[t]];
-
-            /* Angle between two sides of the triangle that share vertex `v`.
-               The shared vertex can be one of the three. */
-            Rad angle;
-            if(v == v0i) angle = crossAngle.second()[0];
-            else if(v == v1i) angle = crossAngle.second()[1];
-            else if(v == v2i) angle = crossAngle.second()[2];
-            else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
-
-            /* The normal is cross.normalized(), we need to multiply it it by
-               surface area which is cross.length()/2. Since normalization is
-               division by length, multiplying it by length again will be a
-               no-op. Then, since all normals are divided by 2, it doesn't
-               change their ratio for the final normalization so we can omit
-               that as well. Finally we need to weight by the angle, and in
-               that case only the ratio is important as well, so it doesn't
-               matter if degrees or radians. */
-            normals[v] += crossAngle.first()*Float(angle);
+       average them. The faces are always gone through in the same order, so
+       the result doesn't depend on how the vertices are split among
+       threads. */
+    Magnum::Implementation::parallelFor(positions.size(), threadCount, [&](const std::size_t begin, const std::size_t end, UnsignedInt) {
+        for(std::size_t v = begin; v != end; ++v) {
+            /* normals are an external memory, ensure we accumulate from zero */
+            Vector3 normal{Math::ZeroInit};
+
+            /* Go through all triangle corners referencing this vertex */
+            for(std::size_t t = offsets[v]; t != offsets[v + 1]; ++t) {
+                const UnsignedInt corner = corners[t];
+
+                /* Cross product is a vector in direction of the normal with
+                   length equal to size of the parallelogram */
+                const Containers::Pair<Vector3, Math::Vector3<Rad>>& crossAngle = crossAngles[corner/3];
+
+                /* The normal is cross.normalized(), we need to multiply it it
+                   by surface area which is cross.length()/2. Since
+                   normalization is division by length, multiplying it by
+                   length again will be a no-op. Then, since all normals are
+                   divided by 2, it doesn't change their ratio for the final
+                   normalization so we can omit that as well. Finally we need
+                   to weight by the angle between the two sides of the triangle
+                   that share vertex `v`, and in that case only the ratio is
+                   important as well, so it doesn't matter if degrees or
+                   radians. */
+                normal += crossAngle.first()*Float(crossAngle.second()[corner % 3]);
+            }
+
+            /* Normalize the accumulated direction */
+            normals[v] = normal.normalized();
         }
+    });
+}
 
-        /* Normalize the accumulated direction */
-        normals[v] = normals[v].normalized();
-    }
+template<class T> inline void generateSmoothNormalsIntoImplementation(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::generateSmoothNormalsInto(): index count not divisible by 3", );
+    CORRADE_ASSERT(normals.size() == positions.size(),
+        "MeshTools::generateSmoothNormalsInto(): bad output size, expected" << positions.size() << "but got" << normals.size(), );
+    #ifndef CORRADE_NO_ASSERT
+    for(const T index: indices)
+        CORRADE_ASSERT(index < positions.size(), "MeshTools::generateSmoothNormalsInto(): index" << index << "out of range for" << positions.size() << "elements", );
+    #endif
+
+    if(indices.isEmpty()) return;
+
+    /* Gather triangle corners for every vertex */
+    Containers::Array<UnsignedInt> offsets{NoInit, positions.size() + 1};
+    Containers::Array<UnsignedInt> corners{NoInit, indices.size()};
+    buildAdjacency(indices, positions.size(), offsets, corners, threadCount);
+
+    generateSmoothNormalsIntoImplementation(indices, offsets, corners, positions, normals, threadCount);
 }
 
 }
@@ -194,33 +260,33 @@ template<class T> inline void generateSmoothNormalsIntoImplementation(const Cont
 /* If not done this way but with templates instead, C++ wouldn't be able to
    figure out on its own which overload to use when indices are not already a
    strided arrray view */
-void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals) {
-    generateSmoothNormalsIntoImplementation(indices, positions, normals);
+void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const UnsignedInt threadCount) {
+    generateSmoothNormalsIntoImplementation(indices, positions, normals, threadCount);
 }
-void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals) {
-    generateSmoothNormalsIntoImplementation(indices, positions, normals);
+void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const UnsignedInt threadCount) {
+    generateSmoothNormalsIntoImplementation(indices, positions, normals, threadCount);
 }
-void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals) {
-    generateSmoothNormalsIntoImplementation(indices, positions, normals);
+void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const UnsignedInt threadCount) {
+    generateSmoothNormalsIntoImplementation(indices, positions, normals, threadCount);
 }
 
-void generateSmoothNormalsInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals) {
+void generateSmoothNormalsInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const UnsignedInt threadCount) {
     CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::generateSmoothNormalsInto(): second index view dimension is not contiguous", );
     if(indices.size()[1] == 4)
-        return generateSmoothNormalsIntoImplementation(Containers::arrayCast<1, const UnsignedInt>(indices), positions, normals);
+        return generateSmoothNormalsIntoImplementation(Containers::arrayCast<1, const UnsignedInt>(indices), positions, normals, threadCount);
     else if(indices.size()[1] == 2)
-        return generateSmoothNormalsIntoImplementation(Containers::arrayCast<1, const UnsignedShort>(indices), positions, normals);
+        return generateSmoothNormalsIntoImplementation(Containers::arrayCast<1, const UnsignedShort>(indices), positions, normals, threadCount);
     else {
         CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::generateSmoothNormalsInto(): expected index type size 1, 2 or 4 but got" << indices.size()[1], );
-        return generateSmoothNormalsIntoImplementation(Containers::arrayCast<1, const UnsignedByte>(indices), positions, normals);
+        return generateSmoothNormalsIntoImplementation(Containers::arrayCast<1, const UnsignedByte>(indices), positions, normals, threadCount);
     }
 }
 
 namespace {
 
-template<class T> inline Containers::Array<Vector3> generateSmoothNormalsImplementation(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions) {
+template<class T> inline Containers::Array<Vector3> generateSmoothNormalsImplementation(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt threadCount) {
     Containers::Array<Vector3> out{NoInit, positions.size()};
-    generateSmoothNormalsInto(indices, positions, out);
+    generateSmoothNormalsInto(indices, positions, out, threadCount);
     return out;
 }
 
@@ -229,19 +295,89 @@ template<class T> inline Containers::Array<Vector3> generateSmoothNormalsImpleme
 /* If not done this way but with templates instead, C++ wouldn't be able to
    figure out on its own which overload to use when indices are not already a
    strided arrray view */
-Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions) {
-    return generateSmoothNormalsImplementation(indices, positions);
+Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt threadCount) {
+    return generateSmoothNormalsImplementation(indices, positions, threadCount);
+}
+Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt threadCount) {
+    return generateSmoothNormalsImplementation(indices, positions, threadCount);
+}
+Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt threadCount) {
+    return generateSmoothNormalsImplementation(indices, positions, threadCount);
+}
+
+Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt threadCount) {
+    Containers::Array<Vector3> out{NoInit, positions.size()};
+    generateSmoothNormalsInto(indices, positions, out, threadCount);
+    return out;
+}
+
+namespace {
+
+template<class T> void smoothNormalsAdjacencyImplementation(const Containers::StridedArrayView1D<const T>& indices, const std::size_t vertexCount, Containers::Array<UnsignedInt>& outIndices, Containers::Array<UnsignedInt>& outOffsets, Containers::Array<UnsignedInt>& outCorners, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::SmoothNormalsAdjacency: index count not divisible by 3", );
+    #ifndef CORRADE_NO_ASSERT
+    for(const T index: indices)
+        CORRADE_ASSERT(index < vertexCount, "MeshTools::SmoothNormalsAdjacency: index" << index << "out of range for" << vertexCount << "vertices", );
+    #endif
+
+    outIndices = Containers::Array<UnsignedInt>{NoInit, indices.size()};
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        outIndices[i] = indices[i];
+
+    outOffsets = Containers::Array<UnsignedInt>{NoInit, vertexCount + 1};
+    outCorners = Containers::Array<UnsignedInt>{NoInit, indices.size()};
+    buildAdjacency(indices, vertexCount, outOffsets, outCorners, threadCount);
+}
+
+}
+
+SmoothNormalsAdjacency::SmoothNormalsAdjacency(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const std::size_t vertexCount, const UnsignedInt threadCount): _vertexCount{vertexCount} {
+    smoothNormalsAdjacencyImplementation(indices, vertexCount, _indices, _offsets, _corners, threadCount);
 }
-Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions) {
-    return generateSmoothNormalsImplementation(indices, positions);
+
+SmoothNormalsAdjacency::SmoothNormalsAdjacency(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const std::size_t vertexCount, const UnsignedInt threadCount): _vertexCount{vertexCount} {
+    smoothNormalsAdjacencyImplementation(indices, vertexCount, _indices, _offsets, _corners, threadCount);
+}
+
+SmoothNormalsAdjacency::SmoothNormalsAdjacency(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const std::size_t vertexCount, const UnsignedInt threadCount): _vertexCount{vertexCount} {
+    smoothNormalsAdjacencyImplementation(indices, vertexCount, _indices, _offsets, _corners, threadCount);
+}
+
+SmoothNormalsAdjacency::SmoothNormalsAdjacency(const Containers::StridedArrayView2D<const char>& indices, const std::size_t vertexCount, const UnsignedInt threadCount): _vertexCount{vertexCount} {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::SmoothNormalsAdjacency: second index view dimension is not contiguous", );
+    if(indices.size()[1] == 4)
+        smoothNormalsAdjacencyImplementation(Containers::arrayCast<1, const UnsignedInt>(indices), vertexCount, _indices, _offsets, _corners, threadCount);
+    else if(indices.size()[1] == 2)
+        smoothNormalsAdjacencyImplementation(Containers::arrayCast<1, const UnsignedShort>(indices), vertexCount, _indices, _offsets, _corners, threadCount);
+    else {
+        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::SmoothNormalsAdjacency: expected index type size 1, 2 or 4 but got" << indices.size()[1], );
+        smoothNormalsAdjacencyImplementation(Containers::arrayCast<1, const UnsignedByte>(indices), vertexCount, _indices, _offsets, _corners, threadCount);
+    }
 }
-Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions) {
-    return generateSmoothNormalsImplementation(indices, positions);
+
+SmoothNormalsAdjacency::SmoothNormalsAdjacency(NoCreateT) noexcept: _vertexCount{} {}
+
+SmoothNormalsAdjacency::SmoothNormalsAdjacency(SmoothNormalsAdjacency&&) noexcept = default;
+
+SmoothNormalsAdjacency::~SmoothNormalsAdjacency() = default;
+
+SmoothNormalsAdjacency& SmoothNormalsAdjacency::operator=(SmoothNormalsAdjacency&&) noexcept = default;
+
+void generateSmoothNormalsInto(const SmoothNormalsAdjacency& adjacency, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(positions.size() == adjacency.vertexCount(),
+        "MeshTools::generateSmoothNormalsInto(): expected" << adjacency.vertexCount() << "positions but got" << positions.size(), );
+    CORRADE_ASSERT(normals.size() == positions.size(),
+        "MeshTools::generateSmoothNormalsInto(): bad output size, expected" << positions.size() << "but got" << normals.size(), );
+
+    if(adjacency.indices().isEmpty()) return;
+
+    generateSmoothNormalsIntoImplementation(Containers::stridedArrayView(adjacency.indices()), adjacency.offsets(), adjacency.corners(), positions, normals, threadCount);
 }
 
-Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions) {
+Containers::Array<Vector3> generateSmoothNormals(const SmoothNormalsAdjacency& adjacency, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt threadCount) {
     Containers::Array<Vector3> out{NoInit, positions.size()};
-    generateSmoothNormalsInto(indices, positions, out);
+    generateSmoothNormalsInto(adjacency, positions, out, threadCount);
     return out;
 }
 
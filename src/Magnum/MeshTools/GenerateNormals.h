@@ -27,10 +27,13 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::MeshTools::generateFlatNormals(), @ref Magnum::MeshTools::generateFlatNormalsInto(), @ref Magnum::MeshTools::generateSmoothNormals(), @ref Magnum::MeshTools::generateSmoothNormalsInto()
+ * @brief Class @ref Magnum::MeshTools::SmoothNormalsAdjacency, function @ref Magnum::MeshTools::generateFlatNormals(), @ref Magnum::MeshTools::generateFlatNormalsInto(), @ref Magnum::MeshTools::generateSmoothNormals(), @ref Magnum::MeshTools::generateSmoothNormalsInto()
  */
 
+#include <Corrade/Containers/Array.h>
+
 #include "Magnum/Magnum.h"
+#include "Magnum/Tags.h"
 #include "Magnum/MeshTools/visibility.h"
 
 namespace Magnum { namespace MeshTools {
@@ -79,6 +82,10 @@ MAGNUM_MESHTOOLS_EXPORT void generateFlatNormalsInto(const Containers::StridedAr
 @brief Generate smooth normals
 @param indices      Triangle face indices
 @param positions    Triangle vertex positions
+@param threadCount  Number of threads to use. If @cpp 1 @ce, the operation
+    is done serially on the calling thread, @cpp 0 @ce means all hardware
+    threads. See @ref MeshTools-generateSmoothNormals-multithreading for
+    details.
 @return Per-vertex normals
 @m_since{2019,10}
 
@@ -92,22 +99,39 @@ contribute to calculated vertex normals.
 Implementation is based on the article
 [Weighted Vertex Normals](http://www.bytehazard.com/articles/vertnorm.html) by
 Martijn Buijs.
+
+@section MeshTools-generateSmoothNormals-multithreading Multithreaded operation
+
+If @p threadCount is not @cpp 1 @ce, the work is split among given number of
+threads, @cpp 0 @ce means all hardware threads. The vertex-to-triangle
+adjacency is built with a parallel counting sort, cross products and angles
+are calculated in parallel on ranges of triangles and the final accumulation
+is done in parallel on ranges of vertices. Each vertex accumulates the
+contributions of its triangles in the same order as in the serial operation,
+which means the output is exactly the same regardless of the thread count.
+See @ref features-multithreading for more information.
+
+If the mesh topology doesn't change between calls and only the positions do,
+such as with cloth simulation or morph targets, create a
+@ref SmoothNormalsAdjacency instance once and pass it to
+@ref generateSmoothNormals(const SmoothNormalsAdjacency&, const Containers::StridedArrayView1D<const Vector3>&, UnsignedInt)
+instead, which avoids rebuilding the adjacency every time.
 @see @ref generateSmoothNormalsInto(), @ref generateFlatNormals(),
     @ref MeshTools::CompileFlag::GenerateSmoothNormals
 */
-MAGNUM_MESHTOOLS_EXPORT Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions);
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, UnsignedInt threadCount = 1);
 
 /**
  * @overload
  * @m_since{2019,10}
  */
-MAGNUM_MESHTOOLS_EXPORT Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions);
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, UnsignedInt threadCount = 1);
 
 /**
  * @overload
  * @m_since{2019,10}
  */
-MAGNUM_MESHTOOLS_EXPORT Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions);
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, UnsignedInt threadCount = 1);
 
 /**
 @brief Generate smooth normals using a type-erased index array
@@ -115,23 +139,28 @@ MAGNUM_MESHTOOLS_EXPORT Containers::Array<Vector3> generateSmoothNormals(const C
 
 Expects that the second dimension of @p indices is contiguous and represents
 the actual 1/2/4-byte index type. Based on its size then calls one of the
-@ref generateSmoothNormals(const Containers::StridedArrayView1D<const UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&)
+@ref generateSmoothNormals(const Containers::StridedArrayView1D<const UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&, UnsignedInt)
 etc. overloads.
 */
-MAGNUM_MESHTOOLS_EXPORT Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions);
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, UnsignedInt threadCount = 1);
 
 /**
 @brief Generate smooth normals into an existing array
 @param[in] indices      Triangle face indices
 @param[in] positions    Triangle vertex positions
 @param[out] normals     Where to put the generated normals
+@param[in] threadCount  Number of threads to use. See
+    @ref MeshTools-generateSmoothNormals-multithreading for details.
 @m_since{2019,10}
 
 A variant of @ref generateSmoothNormals() that fills existing memory instead of
 allocating a new array. The @p normals array is expected to have the same size
 as @p positions. Note that even with the output array this function isn't fully
 allocation-free --- it still allocates three additional internal arrays for
-adjacent face calculation.
+adjacent face calculation. Use
+@ref generateSmoothNormalsInto(const SmoothNormalsAdjacency&, const Containers::StridedArrayView1D<const Vector3>&, const Containers::StridedArrayView1D<Vector3>&, UnsignedInt)
+to avoid the adjacency calculation if the mesh topology doesn't change between
+calls.
 
 Useful when you need to interface for example with STL containers --- in that
 case @cpp #include @ce @ref Corrade/Containers/ArrayViewStl.h to get implicit
@@ -141,19 +170,19 @@ conversions:
 
 @see @ref generateFlatNormalsInto()
 */
-MAGNUM_MESHTOOLS_EXPORT void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals);
+MAGNUM_MESHTOOLS_EXPORT void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, UnsignedInt threadCount = 1);
 
 /**
  * @overload
  * @m_since{2019,10}
  */
-MAGNUM_MESHTOOLS_EXPORT void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals);
+MAGNUM_MESHTOOLS_EXPORT void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, UnsignedInt threadCount = 1);
 
 /**
  * @overload
  * @m_since{2019,10}
  */
-MAGNUM_MESHTOOLS_EXPORT void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals);
+MAGNUM_MESHTOOLS_EXPORT void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, UnsignedInt threadCount = 1);
 
 /**
 @brief Generate smooth normals into an existing array using a type-erased index array
@@ -162,10 +191,152 @@ MAGNUM_MESHTOOLS_EXPORT void generateSmoothNormalsInto(const Containers::Strided
 Expects that @p normals has the same size as @p positions and that the second
 dimension of @p indices is contiguous and represents the actual 1/2/4-byte
 index type. Based on its size then calls one of the
-@ref generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&, const Containers::StridedArrayView1D<Vector3>&)
+@ref generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&, const Containers::StridedArrayView1D<Vector3>&, UnsignedInt)
 etc. overloads.
 */
-MAGNUM_MESHTOOLS_EXPORT void generateSmoothNormalsInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals);
+MAGNUM_MESHTOOLS_EXPORT void generateSmoothNormalsInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, UnsignedInt threadCount = 1);
+
+/**
+@brief Vertex-to-triangle adjacency for smooth normal generation
+@m_since_latest
+
+Stores a copy of triangle indices together with a list of triangle corners
+referencing each vertex, which is what
+@ref generateSmoothNormals(const Containers::StridedArrayView1D<const UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&, UnsignedInt)
+calculates internally on every call. If the mesh topology stays the same and
+only the positions change, such as with cloth simulation or morph targets, the
+adjacency can be calculated just once and then passed to
+@ref generateSmoothNormals(const SmoothNormalsAdjacency&, const Containers::StridedArrayView1D<const Vector3>&, UnsignedInt)
+or @ref generateSmoothNormalsInto(const SmoothNormalsAdjacency&, const Containers::StridedArrayView1D<const Vector3>&, const Containers::StridedArrayView1D<Vector3>&, UnsignedInt),
+which then only calculate per-triangle cross products and accumulate them to
+the vertices:
+
+@snippet MeshTools.cpp SmoothNormalsAdjacency
+
+The output is exactly the same as with the variants taking an index array.
+*/
+class MAGNUM_MESHTOOLS_EXPORT SmoothNormalsAdjacency {
+    public:
+        /**
+         * @brief Constructor
+         * @param indices       Triangle face indices
+         * @param vertexCount   Vertex count
+         * @param threadCount   Number of threads to use. See
+         *      @ref MeshTools-generateSmoothNormals-multithreading for
+         *      details.
+         *
+         * Expects that the index count is divisible by 3 and that all
+         * indices are less than @p vertexCount.
+         */
+        explicit SmoothNormalsAdjacency(const Containers::StridedArrayView1D<const UnsignedInt>& indices, std::size_t vertexCount, UnsignedInt threadCount = 1);
+
+        /** @overload */
+        explicit SmoothNormalsAdjacency(const Containers::StridedArrayView1D<const UnsignedShort>& indices, std::size_t vertexCount, UnsignedInt threadCount = 1);
+
+        /** @overload */
+        explicit SmoothNormalsAdjacency(const Containers::StridedArrayView1D<const UnsignedByte>& indices, std::size_t vertexCount, UnsignedInt threadCount = 1);
+
+        /**
+         * @brief Construct with a type-erased index array
+         *
+         * Expects that the second dimension of @p indices is contiguous and
+         * represents the actual 1/2/4-byte index type. Based on its size
+         * then delegates to one of the
+         * @ref SmoothNormalsAdjacency(const Containers::StridedArrayView1D<const UnsignedInt>&, std::size_t, UnsignedInt)
+         * etc. constructors.
+         */
+        explicit SmoothNormalsAdjacency(const Containers::StridedArrayView2D<const char>& indices, std::size_t vertexCount, UnsignedInt threadCount = 1);
+
+        /**
+         * @brief Construct without populating the contents
+         *
+         * Equivalent to an adjacency of an empty mesh with no vertices.
+         */
+        explicit SmoothNormalsAdjacency(NoCreateT) noexcept;
+
+        /** @brief Copying is not allowed */
+        SmoothNormalsAdjacency(const SmoothNormalsAdjacency&) = delete;
+
+        /** @brief Move constructor */
+        SmoothNormalsAdjacency(SmoothNormalsAdjacency&&) noexcept;
+
+        ~SmoothNormalsAdjacency();
+
+        /** @brief Copying is not allowed */
+        SmoothNormalsAdjacency& operator=(const SmoothNormalsAdjacency&) = delete;
+
+        /** @brief Move assignment */
+        SmoothNormalsAdjacency& operator=(SmoothNormalsAdjacency&&) noexcept;
+
+        /** @brief Vertex count */
+        std::size_t vertexCount() const { return _vertexCount; }
+
+        /**
+         * @brief Triangle indices
+         *
+         * A copy of the indices passed in the constructor, expanded to 32
+         * bits.
+         */
+        Containers::ArrayView<const UnsignedInt> indices() const { return _indices; }
+
+        /**
+         * @brief Corner offsets
+         *
+         * Has @ref vertexCount() plus one items. For vertex @cpp i @ce,
+         * @cpp corners()[offsets()[i]] @ce until
+         * @cpp corners()[offsets()[i + 1]] @ce is a list of triangle corners
+         * referencing it.
+         */
+        Containers::ArrayView<const UnsignedInt> offsets() const { return _offsets; }
+
+        /**
+         * @brief Triangle corners
+         *
+         * Positions in the @ref indices() array referencing given vertex,
+         * i.e. a triangle ID multiplied by 3 plus the corner index in given
+         * triangle. Sorted in an ascending order for each vertex. See
+         * @ref offsets() for how to get the corners for a particular vertex.
+         */
+        Containers::ArrayView<const UnsignedInt> corners() const { return _corners; }
+
+    private:
+        std::size_t _vertexCount;
+        Containers::Array<UnsignedInt> _indices, _offsets, _corners;
+};
+
+/**
+@brief Generate smooth normals using a precalculated adjacency
+@param adjacency    Vertex-to-triangle adjacency
+@param positions    Triangle vertex positions
+@param threadCount  Number of threads to use. See
+    @ref MeshTools-generateSmoothNormals-multithreading for details.
+@return Per-vertex normals
+@m_since_latest
+
+Like @ref generateSmoothNormals(const Containers::StridedArrayView1D<const UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&, UnsignedInt)
+but reusing the adjacency instead of calculating it from an index array. The
+@p positions array is expected to have @ref SmoothNormalsAdjacency::vertexCount()
+items.
+@see @ref generateSmoothNormalsInto(const SmoothNormalsAdjacency&, const Containers::StridedArrayView1D<const Vector3>&, const Containers::StridedArrayView1D<Vector3>&, UnsignedInt)
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<Vector3> generateSmoothNormals(const SmoothNormalsAdjacency& adjacency, const Containers::StridedArrayView1D<const Vector3>& positions, UnsignedInt threadCount = 1);
+
+/**
+@brief Generate smooth normals into an existing array using a precalculated adjacency
+@param[in] adjacency    Vertex-to-triangle adjacency
+@param[in] positions    Triangle vertex positions
+@param[out] normals     Where to put the generated normals
+@param[in] threadCount  Number of threads to use. See
+    @ref MeshTools-generateSmoothNormals-multithreading for details.
+@m_since_latest
+
+A variant of @ref generateSmoothNormals(const SmoothNormalsAdjacency&, const Containers::StridedArrayView1D<const Vector3>&, UnsignedInt)
+that fills existing memory instead of allocating a new array. The @p positions
+and @p normals arrays are expected to have
+@ref SmoothNormalsAdjacency::vertexCount() items. The function still allocates
+one internal array for per-triangle cross products.
+*/
+MAGNUM_MESHTOOLS_EXPORT void generateSmoothNormalsInto(const SmoothNormalsAdjacency& adjacency, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, UnsignedInt threadCount = 1);
 
 }}
 
@@ -34,7 +34,8 @@
 namespace Magnum { namespace MeshTools { namespace Implementation { namespace {
 
 /* Vertex-triangle adjacency. Computes count and indices of adjacent triangles
-   for each vertex (used internally by tipsify()) */
+   for each vertex (used internally by tipsifyInPlace() and
+   optimizeVertexCacheInPlace()) */
 template<class T> void buildAdjacency(const Containers::StridedArrayView1D<const T>& indices, const UnsignedInt vertexCount, Containers::Array<UnsignedInt>& liveTriangleCount, Containers::Array<UnsignedInt>& neighborOffset, Containers::Array<UnsignedInt>& neighbors) {
     /* How many times is each vertex referenced == count of neighboring
        triangles for each vertex */
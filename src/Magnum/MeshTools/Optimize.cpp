@@ -0,0 +1,493 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Optimize.h"
+
+#include <algorithm> /* std::stable_sort() */
+#include <cmath>
+#include <cstring>
+#include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Implementation/Tipsify.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Scoring parameters from the paper */
+constexpr Float CacheDecayPower = 1.5f;
+constexpr Float LastTriangleScore = 0.75f;
+constexpr Float ValenceBoostScale = 2.0f;
+constexpr Float ValenceBoostPower = 0.5f;
+
+Float vertexScore(const Int cachePosition, const UnsignedInt liveTriangleCount, const std::size_t cacheSize) {
+    /* The vertex isn't used by any triangle anymore, its score doesn't
+       matter */
+    if(!liveTriangleCount) return 0.0f;
+
+    Float score = 0.0f;
+    if(cachePosition >= 0) {
+        /* Vertices of the last emitted triangle get a fixed score in order to
+           not depend on the winding in which they were added */
+        if(cachePosition < 3)
+            score = LastTriangleScore;
+        else
+            score = std::pow(1.0f - Float(cachePosition - 3)/Float(cacheSize - 3), CacheDecayPower);
+    }
+
+    /* Boost vertices with only a few triangles left so they get finished
+       early and don't leave lone triangles behind */
+    return score + ValenceBoostScale*std::pow(Float(liveTriangleCount), -ValenceBoostPower);
+}
+
+template<class T> void optimizeVertexCacheInPlaceImplementation(const Containers::StridedArrayView1D<T>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::optimizeVertexCacheInPlace(): index count not divisible by 3", );
+    CORRADE_ASSERT(cacheSize > 3,
+        "MeshTools::optimizeVertexCacheInPlace(): expected cache size larger than 3 but got" << cacheSize, );
+    #ifndef CORRADE_NO_ASSERT
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        CORRADE_ASSERT(indices[i] < vertexCount,
+            "MeshTools::optimizeVertexCacheInPlace(): index" << UnsignedInt(indices[i]) << "out of range for" << vertexCount << "vertices", );
+    #endif
+
+    const std::size_t triangleCount = indices.size()/3;
+
+    /* Neighboring triangles for each vertex, per-vertex live triangle count */
+    Containers::Array<UnsignedInt> liveTriangleCount, neighborOffset, neighbors;
+    Implementation::buildAdjacency<T>(indices, vertexCount, liveTriangleCount, neighborOffset, neighbors);
+
+    /* Per-vertex position in the simulated cache and score, per-triangle
+       emitted flag */
+    Containers::Array<Int> cachePosition{DirectInit, vertexCount, -1};
+    Containers::Array<Float> scores{NoInit, vertexCount};
+    for(UnsignedInt i = 0; i != vertexCount; ++i)
+        scores[i] = vertexScore(-1, liveTriangleCount[i], cacheSize);
+    Containers::BitArray emitted{ValueInit, triangleCount};
+
+    /* Start with the triangle of highest score */
+    std::size_t bestTriangle = ~std::size_t{};
+    {
+        Float bestScore = -1.0f;
+        for(std::size_t i = 0; i != triangleCount; ++i) {
+            const Float score = scores[indices[i*3 + 0]] + scores[indices[i*3 + 1]] + scores[indices[i*3 + 2]];
+            if(score > bestScore) {
+                bestScore = score;
+                bestTriangle = i;
+            }
+        }
+    }
+
+    /* Current and next cache contents. The next cache can temporarily hold
+       up to three more vertices than the cache size, those get evicted. */
+    Containers::Array<UnsignedInt> cacheStorage{NoInit, 2*(cacheSize + 3)};
+    Containers::ArrayView<UnsignedInt> cache = cacheStorage.prefix(cacheSize + 3);
+    Containers::ArrayView<UnsignedInt> nextCache = cacheStorage.exceptPrefix(cacheSize + 3);
+    std::size_t cacheCount = 0;
+
+    /* Output index buffer, cursor for picking the next triangle on a dead
+       end */
+    Containers::Array<T> outputIndices{NoInit, indices.size()};
+    std::size_t cursor = 0;
+    for(std::size_t outputTriangle = 0; outputTriangle != triangleCount; ++outputTriangle) {
+        /* On a dead end, where no triangle is adjacent to the cached
+           vertices anymore, take the next not yet emitted triangle */
+        if(bestTriangle == ~std::size_t{}) {
+            while(emitted[cursor]) ++cursor;
+            bestTriangle = cursor;
+        }
+
+        /* Emit the triangle, put its vertices to the front of the cache */
+        const std::size_t t = bestTriangle;
+        const UnsignedInt a = indices[t*3 + 0];
+        const UnsignedInt b = indices[t*3 + 1];
+        const UnsignedInt c = indices[t*3 + 2];
+        emitted.set(t);
+        outputIndices[outputTriangle*3 + 0] = a;
+        outputIndices[outputTriangle*3 + 1] = b;
+        outputIndices[outputTriangle*3 + 2] = c;
+        --liveTriangleCount[a];
+        --liveTriangleCount[b];
+        --liveTriangleCount[c];
+
+        std::size_t nextCacheCount = 0;
+        nextCache[nextCacheCount++] = a;
+        if(b != a)
+            nextCache[nextCacheCount++] = b;
+        if(c != a && c != b)
+            nextCache[nextCacheCount++] = c;
+
+        /* Followed by the previous contents in the same order */
+        for(std::size_t i = 0; i != cacheCount; ++i) {
+            const UnsignedInt v = cache[i];
+            if(v != a && v != b && v != c)
+                nextCache[nextCacheCount++] = v;
+        }
+
+        /* Update the cache positions and scores, including vertices that
+           got evicted */
+        for(std::size_t i = 0; i != nextCacheCount; ++i) {
+            const UnsignedInt v = nextCache[i];
+            cachePosition[v] = i < cacheSize ? Int(i) : -1;
+            scores[v] = vertexScore(cachePosition[v], liveTriangleCount[v], cacheSize);
+        }
+
+        /* Pick the best of the not yet emitted triangles that reference the
+           updated vertices */
+        bestTriangle = ~std::size_t{};
+        Float bestScore = -1.0f;
+        for(std::size_t i = 0; i != nextCacheCount; ++i) {
+            const UnsignedInt v = nextCache[i];
+            for(UnsignedInt ti = neighborOffset[v]; ti != neighborOffset[v + 1]; ++ti) {
+                const UnsignedInt nt = neighbors[ti];
+                if(emitted[nt]) continue;
+
+                const Float score = scores[indices[nt*3 + 0]] + scores[indices[nt*3 + 1]] + scores[indices[nt*3 + 2]];
+                if(score > bestScore) {
+                    bestScore = score;
+                    bestTriangle = nt;
+                }
+            }
+        }
+
+        /* Swap the caches, drop the evicted vertices */
+        const Containers::ArrayView<UnsignedInt> previousCache = cache;
+        cache = nextCache;
+        nextCache = previousCache;
+        cacheCount = Math::min(nextCacheCount, cacheSize);
+    }
+
+    /* Swap original index buffer with optimized */
+    Utility::copy(outputIndices, indices);
+}
+
+template<class T> void optimizeOverdrawInPlaceImplementation(const Containers::StridedArrayView1D<T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t cacheSize, const Float threshold) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::optimizeOverdrawInPlace(): index count not divisible by 3", );
+    #ifndef CORRADE_NO_ASSERT
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        CORRADE_ASSERT(indices[i] < positions.size(),
+            "MeshTools::optimizeOverdrawInPlace(): index" << UnsignedInt(indices[i]) << "out of range for" << positions.size() << "vertices", );
+    #endif
+
+    const std::size_t triangleCount = indices.size()/3;
+    if(!triangleCount) return;
+
+    /* Simulated FIFO cache with per-vertex timestamps. Advancing the time by
+       more than the cache size flushes it. */
+    Containers::Array<UnsignedInt> timestamp{ValueInit, positions.size()};
+    UnsignedInt time = UnsignedInt(cacheSize + 1);
+    const auto cacheMisses = [&](const std::size_t triangle) {
+        UnsignedInt misses = 0;
+        for(std::size_t i = 0; i != 3; ++i) {
+            const UnsignedInt v = indices[triangle*3 + i];
+            if(time - timestamp[v] > cacheSize) {
+                timestamp[v] = time++;
+                ++misses;
+            }
+        }
+        return misses;
+    };
+
+    /* Hard cluster boundaries are at triangles where all three vertices miss
+       the cache, i.e. where the vertex cache optimizer hit a dead end.
+       Reordering those doesn't affect the cache efficiency in any way. */
+    Containers::Array<UnsignedInt> hardBoundaries;
+    for(std::size_t i = 0; i != triangleCount; ++i)
+        if(cacheMisses(i) == 3 || i == 0)
+            arrayAppend(hardBoundaries, UnsignedInt(i));
+    arrayAppend(hardBoundaries, UnsignedInt(triangleCount));
+
+    /* Split the hard clusters further into soft clusters at points where
+       the running ACMR of the new cluster is below the threshold relative to
+       the ACMR of the whole hard cluster */
+    Containers::Array<UnsignedInt> clusters;
+    for(std::size_t hard = 0; hard != hardBoundaries.size() - 1; ++hard) {
+        const UnsignedInt begin = hardBoundaries[hard];
+        const UnsignedInt end = hardBoundaries[hard + 1];
+
+        time += cacheSize + 1;
+        UnsignedInt clusterMisses = 0;
+        for(UnsignedInt i = begin; i != end; ++i)
+            clusterMisses += cacheMisses(i);
+        const Float clusterThreshold = threshold*Float(clusterMisses)/Float(end - begin);
+
+        time += cacheSize + 1;
+        arrayAppend(clusters, begin);
+        UnsignedInt runningMisses = 0;
+        UnsignedInt runningTriangles = 0;
+        for(UnsignedInt i = begin; i != end; ++i) {
+            runningMisses += cacheMisses(i);
+            ++runningTriangles;
+
+            /* Start a new cluster on the next triangle, flush the cache as
+               the cluster can end up anywhere */
+            if(i + 1 != end && Float(runningMisses)/Float(runningTriangles) <= clusterThreshold) {
+                arrayAppend(clusters, i + 1);
+                time += cacheSize + 1;
+                runningMisses = 0;
+                runningTriangles = 0;
+            }
+        }
+    }
+    arrayAppend(clusters, UnsignedInt(triangleCount));
+
+    /* Centroid of the whole mesh */
+    Vector3 meshCentroid;
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        meshCentroid += positions[indices[i]];
+    meshCentroid /= Float(indices.size());
+
+    /* Sort the clusters by how much they're facing away from the mesh
+       centroid, the most outwards-facing first. Clusters with zero area have
+       the key zero, the sort is stable to keep the original order for equal
+       keys. */
+    const std::size_t clusterCount = clusters.size() - 1;
+    Containers::Array<Containers::Pair<Float, UnsignedInt>> sortKeys{NoInit, clusterCount};
+    for(std::size_t cluster = 0; cluster != clusterCount; ++cluster) {
+        Vector3 centroid;
+        Vector3 normal;
+        Float area = 0.0f;
+        for(UnsignedInt i = clusters[cluster]; i != clusters[cluster + 1]; ++i) {
+            const Vector3 a = positions[indices[i*3 + 0]];
+            const Vector3 b = positions[indices[i*3 + 1]];
+            const Vector3 c = positions[indices[i*3 + 2]];
+            const Vector3 triangleNormal = Math::cross(b - a, c - a);
+            const Float triangleArea = triangleNormal.length();
+            centroid += (a + b + c)*(triangleArea/3.0f);
+            normal += triangleNormal;
+            area += triangleArea;
+        }
+
+        const Float normalLength = normal.length();
+        sortKeys[cluster] = {
+            area > 0.0f && normalLength > 0.0f ?
+                Math::dot(centroid/area - meshCentroid, normal/normalLength) : 0.0f,
+            UnsignedInt(cluster)};
+    }
+    std::stable_sort(sortKeys.begin(), sortKeys.end(), [](const Containers::Pair<Float, UnsignedInt>& a, const Containers::Pair<Float, UnsignedInt>& b) {
+        return a.first() > b.first();
+    });
+
+    /* Put the clusters to the output in the sorted order */
+    Containers::Array<T> outputIndices{NoInit, indices.size()};
+    std::size_t outputIndex = 0;
+    for(const Containers::Pair<Float, UnsignedInt>& key: sortKeys)
+        for(std::size_t i = clusters[key.second()]*3, end = clusters[key.second() + 1]*3; i != end; ++i)
+            outputIndices[outputIndex++] = indices[i];
+    CORRADE_INTERNAL_ASSERT(outputIndex == indices.size());
+
+    /* Swap original index buffer with optimized */
+    Utility::copy(outputIndices, indices);
+}
+
+template<class T> std::size_t optimizeVertexFetchIndexedInPlaceImplementation(const Containers::StridedArrayView1D<T>& indices, const Containers::StridedArrayView2D<char>& data) {
+    CORRADE_ASSERT(data.isContiguous<1>(),
+        "MeshTools::optimizeVertexFetchIndexedInPlace(): second data view dimension is not contiguous", {});
+
+    /* New location of each vertex in the order of first use, ~UnsignedInt{}
+       for vertices that aren't used (yet) */
+    Containers::Array<UnsignedInt> remapping{DirectInit, data.size()[0], ~UnsignedInt{}};
+    UnsignedInt count = 0;
+    for(std::size_t i = 0; i != indices.size(); ++i) {
+        const UnsignedInt index = indices[i];
+        CORRADE_ASSERT(index < data.size()[0],
+            "MeshTools::optimizeVertexFetchIndexedInPlace(): index" << index << "out of range for" << data.size()[0] << "elements", {});
+        if(remapping[index] == ~UnsignedInt{})
+            remapping[index] = count++;
+    }
+
+    /* Remap the indices */
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        indices[i] = remapping[indices[i]];
+
+    /* Move the used vertices to their new locations through a temporary
+       copy */
+    const std::size_t size = data.size()[1];
+    Containers::Array<char> original{NoInit, data.size()[0]*size};
+    const Containers::StridedArrayView2D<char> originalView{original, {data.size()[0], size}};
+    Utility::copy(data, originalView);
+    for(std::size_t i = 0; i != remapping.size(); ++i)
+        if(remapping[i] != ~UnsignedInt{})
+            std::memcpy(data[remapping[i]].data(), originalView[i].data(), size);
+
+    return count;
+}
+
+template<class T> VertexCacheStatistics analyzeVertexCacheImplementation(const Containers::StridedArrayView1D<const T>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::analyzeVertexCache(): index count not divisible by 3", {});
+
+    /* Simulated FIFO cache with per-vertex timestamps, same as in
+       optimizeOverdrawInPlace() */
+    Containers::Array<UnsignedInt> timestamp{ValueInit, vertexCount};
+    Containers::BitArray referenced{ValueInit, vertexCount};
+    UnsignedInt time = UnsignedInt(cacheSize + 1);
+    UnsignedInt misses = 0;
+    UnsignedInt uniqueCount = 0;
+    for(std::size_t i = 0; i != indices.size(); ++i) {
+        const UnsignedInt v = indices[i];
+        CORRADE_ASSERT(v < vertexCount,
+            "MeshTools::analyzeVertexCache(): index" << v << "out of range for" << vertexCount << "vertices", {});
+
+        if(!referenced[v]) {
+            referenced.set(v);
+            ++uniqueCount;
+        }
+
+        if(time - timestamp[v] > cacheSize) {
+            timestamp[v] = time++;
+            ++misses;
+        }
+    }
+
+    VertexCacheStatistics out;
+    out.vertexTransformCount = misses;
+    out.acmr = indices.isEmpty() ? 0.0f : Float(misses)/Float(indices.size()/3);
+    out.atvr = uniqueCount ? Float(misses)/Float(uniqueCount) : 0.0f;
+    return out;
+}
+
+/* Parameters of the simulated memory cache */
+constexpr std::size_t CacheLineSize = 64;
+constexpr std::size_t CacheLineCount = 16*1024/CacheLineSize;
+
+template<class T> VertexFetchStatistics analyzeVertexFetchImplementation(const Containers::StridedArrayView1D<const T>& indices, const UnsignedInt vertexCount, const std::size_t vertexSize) {
+    CORRADE_ASSERT(vertexSize,
+        "MeshTools::analyzeVertexFetch(): expected non-zero vertex size", {});
+
+    /* Simulated FIFO cache with per-cache-line timestamps */
+    Containers::Array<UnsignedInt> timestamp{ValueInit, (vertexCount*vertexSize + CacheLineSize - 1)/CacheLineSize};
+    Containers::BitArray referenced{ValueInit, vertexCount};
+    UnsignedInt time = UnsignedInt(CacheLineCount + 1);
+    std::size_t bytesFetched = 0;
+    std::size_t uniqueCount = 0;
+    for(std::size_t i = 0; i != indices.size(); ++i) {
+        const UnsignedInt v = indices[i];
+        CORRADE_ASSERT(v < vertexCount,
+            "MeshTools::analyzeVertexFetch(): index" << v << "out of range for" << vertexCount << "vertices", {});
+
+        if(!referenced[v]) {
+            referenced.set(v);
+            ++uniqueCount;
+        }
+
+        /* Fetch all cache lines the vertex spans that aren't cached */
+        for(std::size_t line = v*vertexSize/CacheLineSize, lineEnd = ((v + 1)*vertexSize - 1)/CacheLineSize + 1; line != lineEnd; ++line) {
+            if(time - timestamp[line] > CacheLineCount) {
+                timestamp[line] = time++;
+                bytesFetched += CacheLineSize;
+            }
+        }
+    }
+
+    VertexFetchStatistics out;
+    out.bytesFetched = bytesFetched;
+    out.overfetch = uniqueCount ? Float(bytesFetched)/Float(uniqueCount*vertexSize) : 0.0f;
+    return out;
+}
+
+}
+
+void optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    optimizeVertexCacheInPlaceImplementation(indices, vertexCount, cacheSize);
+}
+
+void optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    optimizeVertexCacheInPlaceImplementation(indices, vertexCount, cacheSize);
+}
+
+void optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    optimizeVertexCacheInPlaceImplementation(indices, vertexCount, cacheSize);
+}
+
+void optimizeOverdrawInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t cacheSize, const Float threshold) {
+    optimizeOverdrawInPlaceImplementation(indices, positions, cacheSize, threshold);
+}
+
+void optimizeOverdrawInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t cacheSize, const Float threshold) {
+    optimizeOverdrawInPlaceImplementation(indices, positions, cacheSize, threshold);
+}
+
+void optimizeOverdrawInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t cacheSize, const Float threshold) {
+    optimizeOverdrawInPlaceImplementation(indices, positions, cacheSize, threshold);
+}
+
+std::size_t optimizeVertexFetchIndexedInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView2D<char>& data) {
+    return optimizeVertexFetchIndexedInPlaceImplementation(indices, data);
+}
+
+std::size_t optimizeVertexFetchIndexedInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView2D<char>& data) {
+    return optimizeVertexFetchIndexedInPlaceImplementation(indices, data);
+}
+
+std::size_t optimizeVertexFetchIndexedInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView2D<char>& data) {
+    return optimizeVertexFetchIndexedInPlaceImplementation(indices, data);
+}
+
+std::size_t optimizeVertexFetchIndexedInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView2D<char>& data) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::optimizeVertexFetchIndexedInPlace(): second index view dimension is not contiguous", {});
+    if(indices.size()[1] == 4)
+        return optimizeVertexFetchIndexedInPlaceImplementation(Containers::arrayCast<1, UnsignedInt>(indices), data);
+    else if(indices.size()[1] == 2)
+        return optimizeVertexFetchIndexedInPlaceImplementation(Containers::arrayCast<1, UnsignedShort>(indices), data);
+    else {
+        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::optimizeVertexFetchIndexedInPlace(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
+        return optimizeVertexFetchIndexedInPlaceImplementation(Containers::arrayCast<1, UnsignedByte>(indices), data);
+    }
+}
+
+VertexCacheStatistics analyzeVertexCache(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    return analyzeVertexCacheImplementation(indices, vertexCount, cacheSize);
+}
+
+VertexCacheStatistics analyzeVertexCache(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    return analyzeVertexCacheImplementation(indices, vertexCount, cacheSize);
+}
+
+VertexCacheStatistics analyzeVertexCache(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    return analyzeVertexCacheImplementation(indices, vertexCount, cacheSize);
+}
+
+VertexFetchStatistics analyzeVertexFetch(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const UnsignedInt vertexCount, const std::size_t vertexSize) {
+    return analyzeVertexFetchImplementation(indices, vertexCount, vertexSize);
+}
+
+VertexFetchStatistics analyzeVertexFetch(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const UnsignedInt vertexCount, const std::size_t vertexSize) {
+    return analyzeVertexFetchImplementation(indices, vertexCount, vertexSize);
+}
+
+VertexFetchStatistics analyzeVertexFetch(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const UnsignedInt vertexCount, const std::size_t vertexSize) {
+    return analyzeVertexFetchImplementation(indices, vertexCount, vertexSize);
+}
+
+}}
@@ -0,0 +1,273 @@
+#ifndef Magnum_MeshTools_Optimize_h
+#define Magnum_MeshTools_Optimize_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::optimizeVertexCacheInPlace(), @ref Magnum::MeshTools::optimizeOverdrawInPlace(), @ref Magnum::MeshTools::optimizeVertexFetchIndexedInPlace(), @ref Magnum::MeshTools::analyzeVertexCache(), @ref Magnum::MeshTools::analyzeVertexFetch(), struct @ref Magnum::MeshTools::VertexCacheStatistics, @ref Magnum::MeshTools::VertexFetchStatistics
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Optimize a triangle mesh for post-transform vertex cache in-place
+@param[in,out] indices  Index array to operate on
+@param[in] vertexCount  Vertex count
+@param[in] cacheSize    Size of the simulated LRU cache
+@m_since_latest
+
+Reorders triangles in @p indices to make better use of the post-transform
+vertex cache. Compared to @ref tipsifyInPlace(), which fans around vertices and
+depends on the @p cacheSize matching the actual hardware, this function greedily
+emits the triangle with the highest score based on vertex positions in a
+simulated LRU cache and the count of not-yet-emitted triangles each vertex is
+referenced from. It generally produces lower @ref VertexCacheStatistics::acmr
+values and degrades gracefully if the actual cache size differs. Algorithm
+used: *Tom Forsyth --- Linear-Speed Vertex Cache Optimisation, 2006,
+https://tomforsyth1000.github.io/papers/fast_vert_cache_opt.html*.
+
+Expects that the index count is divisible by @cpp 3 @ce, all indices are less
+than @p vertexCount and @p cacheSize is larger than @cpp 3 @ce. The vertex
+data are not touched, use @ref optimizeVertexFetchIndexedInPlace() afterwards
+to reorder them for better memory locality.
+@see @ref analyzeVertexCache(), @ref optimizeOverdrawInPlace()
+*/
+MAGNUM_MESHTOOLS_EXPORT void optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, UnsignedInt vertexCount, std::size_t cacheSize = 32);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT void optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, UnsignedInt vertexCount, std::size_t cacheSize = 32);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT void optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, UnsignedInt vertexCount, std::size_t cacheSize = 32);
+
+/**
+@brief Optimize a triangle mesh for overdraw in-place
+@param[in,out] indices  Index array to operate on
+@param[in] positions    Vertex positions
+@param[in] cacheSize    Size of the simulated FIFO cache
+@param[in] threshold    Allowed vertex cache efficiency degradation
+@m_since_latest
+
+Splits the index buffer into clusters and reorders them so the clusters facing
+outwards from the mesh center are drawn first, which reduces the amount of
+occluded fragments being shaded. To not throw away the vertex cache
+efficiency, the @p indices are expected to be optimized with
+@ref optimizeVertexCacheInPlace() or @ref tipsifyInPlace() first. Clusters are
+then formed at points where the simulated FIFO cache of @p cacheSize gets fully
+flushed and further split into smaller ones as long as the
+@ref VertexCacheStatistics::acmr of each part stays within @p threshold times
+the ACMR of the original cluster. Setting the @p threshold to @cpp 1.0f @ce
+keeps the vertex cache efficiency intact, higher values trade it for less
+overdraw. Algorithm used: *Pedro V. Sander, Diego Nehab, and Joshua Barczak ---
+Fast Triangle Reordering for Vertex Locality and Reduced Overdraw, SIGGRAPH
+2007, https://gfx.cs.princeton.edu/pubs/Sander_2007_%3eTR/tipsy.pdf*.
+
+Expects that the index count is divisible by @cpp 3 @ce and all indices are
+less than @p positions size.
+@see @ref analyzeVertexCache()
+*/
+MAGNUM_MESHTOOLS_EXPORT void optimizeOverdrawInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, std::size_t cacheSize = 16, Float threshold = 1.05f);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT void optimizeOverdrawInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, std::size_t cacheSize = 16, Float threshold = 1.05f);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT void optimizeOverdrawInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, std::size_t cacheSize = 16, Float threshold = 1.05f);
+
+/**
+@brief Optimize indexed data for vertex fetch in-place
+@param[in,out] indices  Index array, which will get remapped to the new vertex
+    order
+@param[in,out] data     Data array, which will get reordered in the order of
+    first use in @p indices. Vertices not referenced by any index are cut away.
+@return Size of the used prefix in the reordered @p data array
+@m_since_latest
+
+Makes the vertices referenced by consecutive indices also consecutive in
+memory, which improves memory locality when fetching them on the GPU. Should be
+called after optimizing the index order with @ref optimizeVertexCacheInPlace()
+and @ref optimizeOverdrawInPlace(). Works for any primitive type. Expects that
+all indices are less than @p data size and that the second dimension of
+@p data is contiguous. The function allocates a temporary copy of @p data.
+@see @ref analyzeVertexFetch(),
+    @ref removeDuplicatesIndexedInPlace(const Containers::StridedArrayView1D<UnsignedInt>&, const Containers::StridedArrayView2D<char>&)
+*/
+MAGNUM_MESHTOOLS_EXPORT std::size_t optimizeVertexFetchIndexedInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView2D<char>& data);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT std::size_t optimizeVertexFetchIndexedInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView2D<char>& data);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT std::size_t optimizeVertexFetchIndexedInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView2D<char>& data);
+
+/**
+@brief Optimize indexed data for vertex fetch in-place on a type-erased index array
+@m_since_latest
+
+Expects that the second dimension of @p indices is contiguous and represents
+the actual 1/2/4-byte index type. Based on its size then calls one of the
+@ref optimizeVertexFetchIndexedInPlace(const Containers::StridedArrayView1D<UnsignedInt>&, const Containers::StridedArrayView2D<char>&)
+etc. overloads.
+*/
+MAGNUM_MESHTOOLS_EXPORT std::size_t optimizeVertexFetchIndexedInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView2D<char>& data);
+
+/**
+@brief Vertex cache statistics
+@m_since_latest
+
+@see @ref analyzeVertexCache()
+*/
+struct VertexCacheStatistics {
+    /**
+     * @brief Vertex shader invocation count
+     *
+     * Count of cache misses in the simulated FIFO cache.
+     */
+    UnsignedInt vertexTransformCount;
+
+    /**
+     * @brief Average cache miss ratio
+     *
+     * Vertex shader invocations per triangle. Ranges from @cpp 3.0f @ce in
+     * the worst case down to about @cpp 0.5f @ce for large regular grids.
+     */
+    Float acmr;
+
+    /**
+     * @brief Average transform to vertex ratio
+     *
+     * Vertex shader invocations per unique referenced vertex. Is
+     * @cpp 1.0f @ce in the optimal case, independently of mesh topology.
+     */
+    Float atvr;
+};
+
+/**
+@brief Analyze post-transform vertex cache efficiency of a triangle mesh
+@param indices      Index array
+@param vertexCount  Vertex count
+@param cacheSize    Size of the simulated FIFO cache
+@m_since_latest
+
+Simulates a FIFO post-transform vertex cache of given size, as implemented by
+most GPUs, and calculates the amount of vertex shader invocations when drawing
+@p indices. Useful for measuring the effect of @ref tipsifyInPlace(),
+@ref optimizeVertexCacheInPlace() and @ref optimizeOverdrawInPlace(). Expects
+that the index count is divisible by @cpp 3 @ce and all indices are less than
+@p vertexCount.
+*/
+MAGNUM_MESHTOOLS_EXPORT VertexCacheStatistics analyzeVertexCache(const Containers::StridedArrayView1D<const UnsignedInt>& indices, UnsignedInt vertexCount, std::size_t cacheSize = 16);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT VertexCacheStatistics analyzeVertexCache(const Containers::StridedArrayView1D<const UnsignedShort>& indices, UnsignedInt vertexCount, std::size_t cacheSize = 16);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT VertexCacheStatistics analyzeVertexCache(const Containers::StridedArrayView1D<const UnsignedByte>& indices, UnsignedInt vertexCount, std::size_t cacheSize = 16);
+
+/**
+@brief Vertex fetch statistics
+@m_since_latest
+
+@see @ref analyzeVertexFetch()
+*/
+struct VertexFetchStatistics {
+    /**
+     * @brief Fetched byte count
+     *
+     * Count of bytes fetched from the vertex buffer, in whole cache lines.
+     */
+    std::size_t bytesFetched;
+
+    /**
+     * @brief Overfetch ratio
+     *
+     * Fetched byte count divided by the size of all unique referenced
+     * vertices. Is @cpp 1.0f @ce in the optimal case.
+     */
+    Float overfetch;
+};
+
+/**
+@brief Analyze vertex fetch efficiency of indexed data
+@param indices      Index array
+@param vertexCount  Vertex count
+@param vertexSize   Vertex stride in bytes
+@m_since_latest
+
+Simulates a 16 kB FIFO memory cache with 64-byte lines in front of an
+interleaved vertex buffer with @p vertexSize stride and calculates the amount
+of memory fetched when drawing @p indices. Useful for measuring the effect of
+@ref optimizeVertexFetchIndexedInPlace(). Works for any primitive type.
+Expects that all indices are less than @p vertexCount and @p vertexSize is not
+zero.
+*/
+MAGNUM_MESHTOOLS_EXPORT VertexFetchStatistics analyzeVertexFetch(const Containers::StridedArrayView1D<const UnsignedInt>& indices, UnsignedInt vertexCount, std::size_t vertexSize);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT VertexFetchStatistics analyzeVertexFetch(const Containers::StridedArrayView1D<const UnsignedShort>& indices, UnsignedInt vertexCount, std::size_t vertexSize);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT VertexFetchStatistics analyzeVertexFetch(const Containers::StridedArrayView1D<const UnsignedByte>& indices, UnsignedInt vertexCount, std::size_t vertexSize);
+
+}}
+
+#endif
@@ -28,13 +28,14 @@
 
 #include <cstring>
 #include <limits>
-#include <unordered_map>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/MurmurHash2.h>
 
+#include "Magnum/Implementation/parallel.h"
+#include "Magnum/Math/Constants.h"
 #include "Magnum/Math/FunctionsBatch.h"
 #include "Magnum/Math/Range.h"
 #include "Magnum/MeshTools/Copy.h"
@@ -45,26 +46,86 @@
 
 namespace Magnum { namespace MeshTools {
 
-struct ArrayEqual {
-    explicit ArrayEqual(std::size_t size): _size{size} {}
+namespace {
 
-    bool operator()(const void* a, const void* b) const {
-        return std::memcmp(a, b, _size) == 0;
-    }
+UnsignedInt hashKey(const char* const key, const std::size_t keySize) {
+    return UnsignedInt(*reinterpret_cast<const std::size_t*>(Utility::MurmurHash2{}(key, keySize).byteArray()));
+}
 
-    private: std::size_t _size;
-};
+/* Open-addressed hash table mapping runtime-sized keys to a 32-bit value,
+   used by all removeDuplicates*() variants. Compared to an
+   std::unordered_map it doesn't allocate a node per unique entry and it
+   doesn't store the keys --- instead, key for given value is always found at
+   `keyData + value*keyStride`, which is true for all uses below. Each slot
+   stores the (truncated) hash inline next to the value, so a key comparison
+   is done only if the hashes match. The table is sized upfront for the worst
+   case of all entries being unique with a load factor of at most 0.5, which
+   together with linear probing keeps the probe sequences short. */
+class HashTable {
+    public:
+        explicit HashTable(const std::size_t capacity, const std::size_t keySize): _keySize{keySize} {
+            /* The value ~UnsignedInt{} is reserved as an empty slot marker */
+            CORRADE_INTERNAL_ASSERT(capacity < ~UnsignedInt{});
+
+            std::size_t slotCount = 1;
+            while(slotCount < capacity*2) slotCount <<= 1;
+            _slots = Containers::Array<Slot>{NoInit, slotCount};
+            _mask = slotCount - 1;
+            clear();
+        }
 
-struct ArrayHash {
-    explicit ArrayHash(std::size_t size): _size{size} {}
+        std::size_t size() const { return _size; }
 
-    std::size_t operator()(const void* a) const {
-        return *reinterpret_cast<const std::size_t*>(Utility::MurmurHash2{}(static_cast<const char*>(a), _size).byteArray());
-    }
+        void clear() {
+            /* Sets both the hash and the value to ~UnsignedInt{}, which marks
+               the slot as empty */
+            std::memset(_slots.data(), 0xff, _slots.size()*sizeof(Slot));
+            _size = 0;
+        }
+
+        /* Looks for `key`, the already inserted keys are expected to be at
+           `keyData + value*keyStride`. If found, returns the value associated
+           with it and `false`. If not found, inserts `value` and returns it
+           along with `true`. The caller is responsible for ensuring `key`
+           (and the memory it points to) stays unchanged for the lifetime of
+           the table if the insertion succeeded. */
+        Containers::Pair<UnsignedInt, bool> insert(const char* const key, const UnsignedInt value, const char* const keyData, const std::ptrdiff_t keyStride) {
+            return insert(hashKey(key, _keySize), key, value, keyData, keyStride);
+        }
+
+        /* Same as above but with a hash that was calculated upfront with
+           hashKey() */
+        Containers::Pair<UnsignedInt, bool> insert(const UnsignedInt hash, const char* const key, const UnsignedInt value, const char* const keyData, const std::ptrdiff_t keyStride) {
+            for(std::size_t i = hash & _mask; ; i = (i + 1) & _mask) {
+                Slot& slot = _slots[i];
+                if(slot.value == ~UnsignedInt{}) {
+                    slot.hash = hash;
+                    slot.value = value;
+                    ++_size;
+                    return {value, true};
+                }
+
+                if(slot.hash == hash && std::memcmp(keyData + std::ptrdiff_t(slot.value)*keyStride, key, _keySize) == 0)
+                    return {slot.value, false};
+            }
+
+            CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+        }
+
+    private:
+        struct Slot {
+            UnsignedInt hash;
+            UnsignedInt value;
+        };
 
-    private: std::size_t _size;
+        Containers::Array<Slot> _slots;
+        std::size_t _mask;
+        std::size_t _keySize;
+        std::size_t _size;
 };
 
+}
+
 std::size_t removeDuplicatesInto(const Containers::StridedArrayView2D<const char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices) {
     /* Assuming the second dimension is contiguous so we can calculate the
        hashes easily */
@@ -75,24 +136,23 @@ std::size_t removeDuplicatesInto(const Containers::StridedArrayView2D<const char
     CORRADE_ASSERT(indices.size() == dataSize,
         "MeshTools::removeDuplicatesInto(): output index array has" << indices.size() << "elements but expected" << dataSize, {});
 
-    /* Table containing index of first occurrence for each unique entry.
-       Reserving more buckets than necessary (i.e. as if each entry was
-       unique). */
-    std::unordered_map<const void*, UnsignedInt, ArrayHash, ArrayEqual> table{
-        dataSize,
-        ArrayHash{data.size()[1]},
-        ArrayEqual{data.size()[1]}};
+    /* Table containing index of first occurrence for each unique entry. Sized
+       as if each entry was unique. The value is index of the first occurence,
+       so the key is always found at data[value]. */
+    HashTable table{dataSize, data.size()[1]};
+    const char* const keyData = static_cast<const char*>(data.data());
+    const std::ptrdiff_t keyStride = data.stride()[0];
 
     /* Go through all entries */
     for(std::size_t i = 0; i != dataSize; ++i) {
         /* Try to insert new entry into the table. The inserted index points
            into the original unchanged data array. */
         const Containers::ArrayView<const char> entry = data[i].asContiguous();
-        const auto result = table.emplace(entry, i);
+        const Containers::Pair<UnsignedInt, bool> result = table.insert(entry.data(), i, keyData, keyStride);
 
         /* Put the (either new or already existing) index into the output
            index array */
-        indices[i] = result.first->second;
+        indices[i] = result.first();
     }
 
     CORRADE_INTERNAL_ASSERT(dataSize >= table.size());
@@ -115,13 +175,13 @@ std::size_t removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<cha
     CORRADE_ASSERT(indices.size() == dataSize,
         "MeshTools::removeDuplicatesInPlaceInto(): output index array has" << indices.size() << "elements but expected" << dataSize, {});
 
-    /* Table containing index of first occurrence for each unique entry.
-       Reserving more buckets than necessary (i.e. as if each entry was
-       unique). */
-    std::unordered_map<const void*, UnsignedInt, ArrayHash, ArrayEqual> table{
-        dataSize,
-        ArrayHash{data.size()[1]},
-        ArrayEqual{data.size()[1]}};
+    /* Table containing index of first occurrence for each unique entry. Sized
+       as if each entry was unique. The value is index of the unique entry in
+       the output, which is also where the key is copied to, so the key is
+       always found at data[value]. */
+    HashTable table{dataSize, data.size()[1]};
+    const char* const keyData = static_cast<const char*>(data.data());
+    const std::ptrdiff_t keyStride = data.stride()[0];
 
     /* Go through all entries and insert them into the table. Because the keys
        have runtime size, the table doesn't store a copy of the keys, only a
@@ -137,20 +197,20 @@ std::size_t removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<cha
            it fails the location isn't used as a key anywhere and so it can be
            reused next time for a different key.
 
-           Alternatively we could first call find() and only then conditionally
-           do a copy() and emplace(), but that means the hash & search would be
-           performed twice, which is never faster than a plain memory copy. */
+           Alternatively we could first do a lookup and only then conditionally
+           do a copy() and an insertion, but that means the hash & search would
+           be performed twice, which is never faster than a plain memory copy. */
         const Containers::ArrayView<char> dst = data[table.size()].asContiguous();
         if(i != table.size())
             Utility::copy(data[i].asContiguous(), dst);
 
         /* Insert the new entry into the table. If it succeeds, dst is
            guaranteed to not change anymore. */
-        const auto result = table.emplace(dst, table.size());
+        const Containers::Pair<UnsignedInt, bool> result = table.insert(dst.data(), table.size(), keyData, keyStride);
 
         /* Put the (either new or already existing) index into the output index
            array */
-        indices[i] = result.first->second;
+        indices[i] = result.first();
     }
 
     CORRADE_INTERNAL_ASSERT(dataSize >= table.size());
@@ -209,50 +269,24 @@ std::size_t removeDuplicatesIndexedInPlace(const Containers::StridedArrayView2D<
 
 namespace {
 
-template<class IndexType, class T> std::size_t removeDuplicatesFuzzyIndexedInPlaceImplementation(const Containers::StridedArrayView1D<IndexType>& indices, const Containers::StridedArrayView2D<T>& data, T epsilon) {
-    /* Compared to the discrete version, we don't require the second dimension
-       to be contiguous, as we calculate the hash from a discretized contiguous
-       copy */
-
-    /* Somehow ~IndexType{} doesn't work for < 4byte types, as the result is
-       int(-1) instead of the type I want */
-    CORRADE_ASSERT(data.size()[0] <= IndexType(-1),
-        "MeshTools::removeDuplicatesFuzzyIndexedInPlace(): a" << sizeof(IndexType) << Debug::nospace << "-byte index type is too small for" << data.size()[0] << "vertices", {});
-
-    /* Get bounds across all dimensions. When NaNs appear, those will get
-       collapsed together when you're lucky, or cause the whole data to
-       disappear when you're not -- it needs a much more specialized handling
-       to be robust. */
+/* Serial variant of the fuzzy deduplication passes, operates with a single
+   table and discretizes the data into position of the next unique vector */
+template<class IndexType, class T> std::size_t removeDuplicatesFuzzyIndexedInPlaceSerial(const Containers::StridedArrayView1D<IndexType>& indices, const Containers::StridedArrayView2D<T>& data, const Containers::Array<T>& offsets, const T epsilon) {
+    /* Table containing unique vector index for each discretized vector. Sized
+       as if each vector was unique. */
     const std::size_t vectorSize = data.size()[1];
-    T range = T(0.0);
-    Containers::Array<T> offsets{NoInit, vectorSize};
-    {
-        /** @todo this isn't really cache-efficient, do differently */
-        std::size_t i = 0;
-        for(Containers::StridedArrayView1D<T> dimension: data.template transposed<0, 1>()) {
-            const Math::Range1D<T> minmax = Math::minmax(dimension);
-            range = Math::max(minmax.size(), range);
-            offsets[i++] = minmax.min();
-        }
-    }
-
-    /* Make epsilon so large that std::size_t can index all vectors inside the
-       bounds. */
-    epsilon = Math::max(epsilon, range/T(~std::size_t{}));
-
-    /* Table containing original vector index for each discretized vector.
-       Reserving more buckets than necessary (i.e. as if each vector was
-       unique). */
     std::size_t dataSize = data.size()[0];
-    std::unordered_map<const void*, UnsignedInt, ArrayHash, ArrayEqual> table{
-        dataSize,
-        ArrayHash{data.size()[1]*sizeof(std::size_t)},
-        ArrayEqual{data.size()[1]*sizeof(std::size_t)}};
+    HashTable table{dataSize, vectorSize*sizeof(std::size_t)};
 
     /* Index array that'll be filled in each pass and then used for remapping
-       the `indices`; discretized storage for all map keys. */
+       the `indices`; discretized storage for all table keys. Similarly to
+       removeDuplicatesInPlaceInto(), each vector is discretized into the
+       position of the next unique vector, so a key for given value is always
+       found at discretized[value*vectorSize]. */
     Containers::Array<UnsignedInt> remapping{NoInit, dataSize};
     Containers::Array<std::size_t> discretized{NoInit, dataSize*vectorSize};
+    const char* const keyData = reinterpret_cast<const char*>(discretized.data());
+    const std::ptrdiff_t keyStride = vectorSize*sizeof(std::size_t);
 
     /* First go with original coordinates, then move them by epsilon/2 in each
        dimension. */
@@ -261,9 +295,12 @@ template<class IndexType, class T> std::size_t removeDuplicatesFuzzyIndexedInPla
         for(std::size_t i = 0; i != dataSize; ++i) {
             /* Take the original vector and discretize it -- append the move
                amount to given dimension, subtract the minmal offset and divide
-               by epsilon. */
+               by epsilon. Data in [table.size(), i) are already present in
+               the [0, table.size()) range so we aren't overwriting any key
+               that's still referenced. */
             const Containers::StridedArrayView1D<T> entry = data[i];
-            const Containers::ArrayView<std::size_t> discretizedEntry = discretized.slice(i*vectorSize, (i + 1)*vectorSize);
+            const std::size_t unique = table.size();
+            const Containers::ArrayView<std::size_t> discretizedEntry = discretized.slice(unique*vectorSize, (unique + 1)*vectorSize);
             for(std::size_t vi = 0; vi != vectorSize; ++vi) {
                 T c = entry[vi];
                 /* In iteration `0` we're not moving in any dimension, in
@@ -278,17 +315,17 @@ template<class IndexType, class T> std::size_t removeDuplicatesFuzzyIndexedInPla
                This is a similar workflow to removeDuplicatesInPlaceInto() with
                the only difference that we're remapping an existing index array
                several times over instead of creating a new one */
-            const auto result = table.emplace(discretizedEntry, table.size());
+            const Containers::Pair<UnsignedInt, bool> result = table.insert(reinterpret_cast<const char*>(discretizedEntry.data()), unique, keyData, keyStride);
 
             /* Add the (either new or already existing) index into the array */
-            remapping[i] = result.first->second;
+            remapping[i] = result.first();
 
             /* If this is a new combination, copy the data to new (earlier)
-               position in the array. Data in [table.size()-1, i) are already
-               present in the [0, table.size()-1) range from previous
-               iterations so we aren't overwriting anything. */
-            if(result.second && i != table.size() - 1)
-                Utility::copy(entry, data[table.size() - 1]);
+               position in the array. Data in [unique, i) are already present
+               in the [0, unique) range from previous iterations so we aren't
+               overwriting anything. */
+            if(result.second() && i != unique)
+                Utility::copy(entry, data[unique]);
         }
 
         /* Remap the resulting index array */
@@ -304,6 +341,196 @@ template<class IndexType, class T> std::size_t removeDuplicatesFuzzyIndexedInPla
         table.clear();
     }
 
+    return dataSize;
+}
+
+/* Multithreaded variant of the above, producing the exact same output. Each
+   pass is split into these steps:
+
+   1. All vectors are discretized and hashed in parallel, each to its own
+      position in the `discretized` array
+   2. Each thread owns a shard of the hash space and goes through all vectors
+      in order, inserting only those from its shard into its own table. Since
+      equal keys have equal hashes, they always end up in the same shard. The
+      result for each vector is the index of the first occurence of its key.
+   3. Unique IDs are assigned to the first occurences in their original order
+      with a parallel prefix sum, which gives the same numbering as the serial
+      variant. Then each vector gets the unique ID of its first occurence.
+   4. Unique vectors are moved to the front (serially, as the ranges overlap
+      and it's just a memory copy) and the index array is remapped in
+      parallel. */
+template<class IndexType, class T> std::size_t removeDuplicatesFuzzyIndexedInPlaceParallel(const Containers::StridedArrayView1D<IndexType>& indices, const Containers::StridedArrayView2D<T>& data, const Containers::Array<T>& offsets, const T epsilon, const UnsignedInt threadCount) {
+    const std::size_t vectorSize = data.size()[1];
+    const std::size_t keySize = vectorSize*sizeof(std::size_t);
+    std::size_t dataSize = data.size()[0];
+
+    Containers::Array<std::size_t> discretized{NoInit, dataSize*vectorSize};
+    Containers::Array<UnsignedInt> hashes{NoInit, dataSize};
+    Containers::Array<UnsignedInt> remapping{NoInit, dataSize};
+    Containers::Array<UnsignedInt> unique{NoInit, dataSize};
+    Containers::Array<std::size_t> uniqueCountPerThread{NoInit, threadCount};
+    const char* const keyData = reinterpret_cast<const char*>(discretized.data());
+
+    T moveAmount = T(0.0);
+    for(std::size_t moving = 0; moving <= vectorSize; ++moving) {
+        /* 1. Discretize and hash */
+        Magnum::Implementation::parallelFor(dataSize, threadCount, [&](const std::size_t begin, const std::size_t end, UnsignedInt) {
+            for(std::size_t i = begin; i != end; ++i) {
+                const Containers::StridedArrayView1D<const T> entry = data[i];
+                std::size_t* const discretizedEntry = discretized.data() + i*vectorSize;
+                for(std::size_t vi = 0; vi != vectorSize; ++vi) {
+                    T c = entry[vi];
+                    if(vi + 1 == moving) c += moveAmount;
+                    discretizedEntry[vi] = (c - offsets[vi])/epsilon;
+                }
+                hashes[i] = hashKey(reinterpret_cast<const char*>(discretizedEntry), keySize);
+            }
+        });
+
+        /* 2. Find the first occurence of each key, each thread processing its
+           own shard. Using the high hash bits for picking the shard, as the
+           table uses the low bits for picking the slot. */
+        Magnum::Implementation::parallelFor(threadCount, threadCount, [&](const std::size_t shard, std::size_t, UnsignedInt) {
+            const auto inShard = [&](const UnsignedInt hash) {
+                return (UnsignedLong(hash)*threadCount) >> 32 == shard;
+            };
+
+            std::size_t count = 0;
+            for(std::size_t i = 0; i != dataSize; ++i)
+                if(inShard(hashes[i])) ++count;
+
+            HashTable table{count, keySize};
+            for(std::size_t i = 0; i != dataSize; ++i) {
+                if(!inShard(hashes[i])) continue;
+                remapping[i] = table.insert(hashes[i], reinterpret_cast<const char*>(discretized.data() + i*vectorSize), i, keyData, keySize).first();
+            }
+        });
+
+        /* 3. Assign unique IDs to first occurences in order. In later passes
+           the data can be smaller than the thread count, in which case the
+           work is split into fewer ranges and only those get summed. */
+        const Containers::ArrayView<std::size_t> passUniqueCountPerThread = uniqueCountPerThread.prefix(Magnum::Implementation::parallelThreadCount(threadCount, dataSize));
+        Magnum::Implementation::parallelFor(dataSize, threadCount, [&](const std::size_t begin, const std::size_t end, const UnsignedInt thread) {
+            std::size_t count = 0;
+            for(std::size_t i = begin; i != end; ++i)
+                if(remapping[i] == i) ++count;
+            uniqueCountPerThread[thread] = count;
+        });
+        std::size_t uniqueCount = 0;
+        for(std::size_t& i: passUniqueCountPerThread) {
+            const std::size_t count = i;
+            i = uniqueCount;
+            uniqueCount += count;
+        }
+        Magnum::Implementation::parallelFor(dataSize, threadCount, [&](const std::size_t begin, const std::size_t end, const UnsignedInt thread) {
+            std::size_t id = uniqueCountPerThread[thread];
+            for(std::size_t i = begin; i != end; ++i)
+                if(remapping[i] == i) unique[i] = id++;
+        });
+
+        /* 4. Move the unique vectors to the front. Has to be done before
+           `remapping` gets overwritten with the unique IDs below. */
+        for(std::size_t i = 0; i != dataSize; ++i)
+            if(remapping[i] == i && unique[i] != i)
+                Utility::copy(data[i], data[unique[i]]);
+
+        /* Only `unique` is read and only own items in `remapping` are written,
+           so this is safe to do in parallel */
+        Magnum::Implementation::parallelFor(dataSize, threadCount, [&](const std::size_t begin, const std::size_t end, UnsignedInt) {
+            for(std::size_t i = begin; i != end; ++i)
+                remapping[i] = unique[remapping[i]];
+        });
+        Magnum::Implementation::parallelFor(indices.size(), threadCount, [&](const std::size_t begin, const std::size_t end, UnsignedInt) {
+            for(std::size_t i = begin; i != end; ++i)
+                indices[i] = remapping[indices[i]];
+        });
+
+        moveAmount = epsilon/2;
+        dataSize = uniqueCount;
+    }
+
+    return dataSize;
+}
+
+template<class IndexType, class T> std::size_t removeDuplicatesFuzzyIndexedInPlaceImplementation(const Containers::StridedArrayView1D<IndexType>& indices, const Containers::StridedArrayView2D<T>& data, T epsilon, const UnsignedInt threadCount) {
+    /* Compared to the discrete version, we don't require the second dimension
+       to be contiguous, as we calculate the hash from a discretized contiguous
+       copy */
+
+    /* Somehow ~IndexType{} doesn't work for < 4byte types, as the result is
+       int(-1) instead of the type I want */
+    CORRADE_ASSERT(data.size()[0] <= IndexType(-1),
+        "MeshTools::removeDuplicatesFuzzyIndexedInPlace(): a" << sizeof(IndexType) << Debug::nospace << "-byte index type is too small for" << data.size()[0] << "vertices", {});
+
+    const UnsignedInt actualThreadCount = Magnum::Implementation::parallelThreadCount(threadCount, data.size()[0]);
+
+    /* Get bounds across all dimensions. When NaNs appear, those will get
+       collapsed together when you're lucky, or cause the whole data to
+       disappear when you're not -- it needs a much more specialized handling
+       to be robust. */
+    const std::size_t vectorSize = data.size()[1];
+    T range = T(0.0);
+    Containers::Array<T> offsets{NoInit, vectorSize};
+    if(actualThreadCount == 1) {
+        /** @todo this isn't really cache-efficient, do differently */
+        std::size_t i = 0;
+        for(Containers::StridedArrayView1D<T> dimension: data.template transposed<0, 1>()) {
+            const Math::Range1D<T> minmax = Math::minmax(dimension);
+            range = Math::max(minmax.size(), range);
+            offsets[i++] = minmax.min();
+        }
+
+    /* In the parallel case each thread goes through its range of vectors,
+       which is also more cache-efficient, and the per-thread bounds are then
+       combined together. NaNs are treated the same as in Math::minmax(), i.e.
+       ignored unless the whole dimension is NaN. */
+    } else {
+        Containers::Array<T> mins{DirectInit, actualThreadCount*vectorSize, Math::Constants<T>::nan()};
+        Containers::Array<T> maxs{DirectInit, actualThreadCount*vectorSize, Math::Constants<T>::nan()};
+        Magnum::Implementation::parallelFor(data.size()[0], actualThreadCount, [&](const std::size_t begin, const std::size_t end, const UnsignedInt thread) {
+            T* const threadMin = mins.data() + thread*vectorSize;
+            T* const threadMax = maxs.data() + thread*vectorSize;
+            for(std::size_t i = begin; i != end; ++i) {
+                const Containers::StridedArrayView1D<const T> entry = data[i];
+                for(std::size_t vi = 0; vi != vectorSize; ++vi) {
+                    const T c = entry[vi];
+                    if(Math::isNan(c)) continue;
+                    if(Math::isNan(threadMin[vi])) {
+                        threadMin[vi] = threadMax[vi] = c;
+                    } else {
+                        threadMin[vi] = Math::min(threadMin[vi], c);
+                        threadMax[vi] = Math::max(threadMax[vi], c);
+                    }
+                }
+            }
+        });
+
+        for(std::size_t vi = 0; vi != vectorSize; ++vi) {
+            Math::Range1D<T> minmax{Math::Constants<T>::nan(), Math::Constants<T>::nan()};
+            for(std::size_t thread = 0; thread != actualThreadCount; ++thread) {
+                const T threadMin = mins[thread*vectorSize + vi];
+                const T threadMax = maxs[thread*vectorSize + vi];
+                if(Math::isNan(threadMin)) continue;
+                if(Math::isNan(minmax.min())) {
+                    minmax = Math::Range1D<T>{threadMin, threadMax};
+                } else {
+                    minmax.min() = Math::min(minmax.min(), threadMin);
+                    minmax.max() = Math::max(minmax.max(), threadMax);
+                }
+            }
+            range = Math::max(minmax.size(), range);
+            offsets[vi] = minmax.min();
+        }
+    }
+
+    /* Make epsilon so large that std::size_t can index all vectors inside the
+       bounds. */
+    epsilon = Math::max(epsilon, range/T(~std::size_t{}));
+
+    const std::size_t dataSize = actualThreadCount == 1 ?
+        removeDuplicatesFuzzyIndexedInPlaceSerial(indices, data, offsets, epsilon) :
+        removeDuplicatesFuzzyIndexedInPlaceParallel(indices, data, offsets, epsilon, actualThreadCount);
+
     CORRADE_INTERNAL_ASSERT(data.size()[0] >= dataSize);
     return dataSize;
 }
@@ -311,32 +538,56 @@ template<class IndexType, class T> std::size_t removeDuplicatesFuzzyIndexedInPla
 }
 
 std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView2D<Float>& data, const Float epsilon) {
-    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon);
+    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon, 1);
+}
+
+std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView2D<Float>& data, const Float epsilon, const UnsignedInt threadCount) {
+    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon, threadCount);
 }
 
 std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView2D<Float>& data, const Float epsilon) {
-    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon);
+    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon, 1);
+}
+
+std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView2D<Float>& data, const Float epsilon, const UnsignedInt threadCount) {
+    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon, threadCount);
 }
 
 std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView2D<Float>& data, const Float epsilon) {
-    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon);
+    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon, 1);
+}
+
+std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView2D<Float>& data, const Float epsilon, const UnsignedInt threadCount) {
+    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon, threadCount);
 }
 
 std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView2D<Double>& data, const Double epsilon) {
-    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon);
+    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon, 1);
+}
+
+std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView2D<Double>& data, const Double epsilon, const UnsignedInt threadCount) {
+    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon, threadCount);
 }
 
 std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView2D<Double>& data, const Double epsilon) {
-    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon);
+    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon, 1);
+}
+
+std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView2D<Double>& data, const Double epsilon, const UnsignedInt threadCount) {
+    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon, threadCount);
 }
 
 std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView2D<Double>& data, const Double epsilon) {
-    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon);
+    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon, 1);
+}
+
+std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView2D<Double>& data, const Double epsilon, const UnsignedInt threadCount) {
+    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon, threadCount);
 }
 
 namespace {
 
-template<class T> std::size_t removeDuplicatesFuzzyInPlaceIntoImplementation(const Containers::StridedArrayView2D<T>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const T epsilon) {
+template<class T> std::size_t removeDuplicatesFuzzyInPlaceIntoImplementation(const Containers::StridedArrayView2D<T>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const T epsilon, const UnsignedInt threadCount) {
     CORRADE_ASSERT(indices.size() == data.size()[0],
         "MeshTools::removeDuplicatesFuzzyInPlaceInto(): output index array has" << indices.size() << "elements but expected" << data.size()[0], {});
 
@@ -346,56 +597,80 @@ template<class T> std::size_t removeDuplicatesFuzzyInPlaceIntoImplementation(con
     UnsignedInt i = 0;
     for(UnsignedInt& index: indices) index = i++;
 
-    const std::size_t size = removeDuplicatesFuzzyIndexedInPlaceImplementation(Containers::stridedArrayView(indices), data, epsilon);
+    const std::size_t size = removeDuplicatesFuzzyIndexedInPlaceImplementation(Containers::stridedArrayView(indices), data, epsilon, threadCount);
     return size;
 }
 
-template<class T> Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesFuzzyInPlaceImplementation(const Containers::StridedArrayView2D<T>& data, const T epsilon) {
+template<class T> Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesFuzzyInPlaceImplementation(const Containers::StridedArrayView2D<T>& data, const T epsilon, const UnsignedInt threadCount) {
     Containers::Array<UnsignedInt> indices{NoInit, data.size()[0]};
-    const std::size_t size = removeDuplicatesFuzzyInPlaceIntoImplementation(data, indices, epsilon);
+    const std::size_t size = removeDuplicatesFuzzyInPlaceIntoImplementation(data, indices, epsilon, threadCount);
     return {Utility::move(indices), size};
 }
 
 }
 
 Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesFuzzyInPlace(const Containers::StridedArrayView2D<Float>& data, const Float epsilon) {
-    return removeDuplicatesFuzzyInPlaceImplementation(data, epsilon);
+    return removeDuplicatesFuzzyInPlaceImplementation(data, epsilon, 1);
+}
+
+Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesFuzzyInPlace(const Containers::StridedArrayView2D<Float>& data, const Float epsilon, const UnsignedInt threadCount) {
+    return removeDuplicatesFuzzyInPlaceImplementation(data, epsilon, threadCount);
 }
 
 Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesFuzzyInPlace(const Containers::StridedArrayView2D<Double>& data, const Double epsilon) {
-    return removeDuplicatesFuzzyInPlaceImplementation(data, epsilon);
+    return removeDuplicatesFuzzyInPlaceImplementation(data, epsilon, 1);
+}
+
+Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesFuzzyInPlace(const Containers::StridedArrayView2D<Double>& data, const Double epsilon, const UnsignedInt threadCount) {
+    return removeDuplicatesFuzzyInPlaceImplementation(data, epsilon, threadCount);
 }
 
 std::size_t removeDuplicatesFuzzyInPlaceInto(const Containers::StridedArrayView2D<Float>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const Float epsilon) {
-    return removeDuplicatesFuzzyInPlaceIntoImplementation(data, indices, epsilon);
+    return removeDuplicatesFuzzyInPlaceIntoImplementation(data, indices, epsilon, 1);
+}
+
+std::size_t removeDuplicatesFuzzyInPlaceInto(const Containers::StridedArrayView2D<Float>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const Float epsilon, const UnsignedInt threadCount) {
+    return removeDuplicatesFuzzyInPlaceIntoImplementation(data, indices, epsilon, threadCount);
 }
 
 std::size_t removeDuplicatesFuzzyInPlaceInto(const Containers::StridedArrayView2D<Double>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const Double epsilon) {
-    return removeDuplicatesFuzzyInPlaceIntoImplementation(data, indices, epsilon);
+    return removeDuplicatesFuzzyInPlaceIntoImplementation(data, indices, epsilon, 1);
+}
+
+std::size_t removeDuplicatesFuzzyInPlaceInto(const Containers::StridedArrayView2D<Double>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const Double epsilon, const UnsignedInt threadCount) {
+    return removeDuplicatesFuzzyInPlaceIntoImplementation(data, indices, epsilon, threadCount);
 }
 
 namespace {
 
-template<class T> std::size_t removeDuplicatesFuzzyIndexedInPlaceImplementation(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView2D<T>& data, const T epsilon) {
+template<class T> std::size_t removeDuplicatesFuzzyIndexedInPlaceImplementation(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView2D<T>& data, const T epsilon, const UnsignedInt threadCount) {
     CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::removeDuplicatesFuzzyIndexedInPlace(): second index view dimension is not contiguous", {});
     if(indices.size()[1] == 4)
-        return removeDuplicatesFuzzyIndexedInPlaceImplementation(Containers::arrayCast<1, UnsignedInt>(indices), data, epsilon);
+        return removeDuplicatesFuzzyIndexedInPlaceImplementation(Containers::arrayCast<1, UnsignedInt>(indices), data, epsilon, threadCount);
     else if(indices.size()[1] == 2)
-        return removeDuplicatesFuzzyIndexedInPlaceImplementation(Containers::arrayCast<1, UnsignedShort>(indices), data, epsilon);
+        return removeDuplicatesFuzzyIndexedInPlaceImplementation(Containers::arrayCast<1, UnsignedShort>(indices), data, epsilon, threadCount);
     else {
         CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::removeDuplicatesFuzzyIndexedInPlace(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
-        return removeDuplicatesFuzzyIndexedInPlaceImplementation(Containers::arrayCast<1, UnsignedByte>(indices), data, epsilon);
+        return removeDuplicatesFuzzyIndexedInPlaceImplementation(Containers::arrayCast<1, UnsignedByte>(indices), data, epsilon, threadCount);
     }
 }
 
 }
 
 std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView2D<Float>& data, const Float epsilon) {
-    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon);
+    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon, 1);
+}
+
+std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView2D<Float>& data, const Float epsilon, const UnsignedInt threadCount) {
+    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon, threadCount);
 }
 
 std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView2D<Double>& data, const Double epsilon) {
-    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon);
+    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon, 1);
+}
+
+std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView2D<Double>& data, const Double epsilon, const UnsignedInt threadCount) {
+    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon, threadCount);
 }
 
 Trade::MeshData removeDuplicates(const Trade::MeshData& mesh) {
@@ -467,6 +742,10 @@ Trade::MeshData removeDuplicates(const Trade::MeshData& mesh) {
 }
 
 Trade::MeshData removeDuplicatesFuzzy(const Trade::MeshData& mesh, const Float floatEpsilon, const Double doubleEpsilon) {
+    return removeDuplicatesFuzzy(mesh, floatEpsilon, doubleEpsilon, 1);
+}
+
+Trade::MeshData removeDuplicatesFuzzy(const Trade::MeshData& mesh, const Float floatEpsilon, const Double doubleEpsilon, const UnsignedInt threadCount) {
     CORRADE_ASSERT(mesh.attributeCount(),
         "MeshTools::removeDuplicatesFuzzy(): can't remove duplicates in an attributeless mesh",
         (Trade::MeshData{MeshPrimitive::Points, 0}));
@@ -539,7 +818,7 @@ Trade::MeshData removeDuplicatesFuzzy(const Trade::MeshData& mesh, const Float f
                 attributeEpsilon = floatEpsilon*range;
             }
 
-            removeDuplicatesFuzzyInPlaceIntoImplementation(attribute, perAttributeIndices[i], attributeEpsilon);
+            removeDuplicatesFuzzyInPlaceIntoImplementation(attribute, perAttributeIndices[i], attributeEpsilon, threadCount);
 
         /* Doubles. No builtin attributes support those at the moment, so
            there's just the epsilon scaling based on attribute value range */
@@ -550,7 +829,7 @@ Trade::MeshData removeDuplicatesFuzzy(const Trade::MeshData& mesh, const Float f
             for(Containers::StridedArrayView1D<const Double> component: attribute.transposed<0, 1>())
                 range = Math::max(Range1Dd{Math::minmax(component)}.size(), range);
 
-            removeDuplicatesFuzzyInPlaceIntoImplementation(attribute, perAttributeIndices[i], doubleEpsilon*range);
+            removeDuplicatesFuzzyInPlaceIntoImplementation(attribute, perAttributeIndices[i], doubleEpsilon*range, threadCount);
 
         /* Other attributes (integer, packed, half floats). No fuzzy
            comparison */
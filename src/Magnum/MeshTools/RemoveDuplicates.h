@@ -235,16 +235,49 @@ then convertible to a 2D view:
 If you want to remove duplicates in multiple incidental arrays, first remove
 duplicates in each array separately and then combine the resulting index arrays
 back into a single one using @ref combineIndexedAttributes().
+
+@section MeshTools-removeDuplicatesFuzzyInPlace-multithreading Multithreaded operation
+
+The @ref removeDuplicatesFuzzyInPlace(const Containers::StridedArrayView2D<Float>&, Float, UnsignedInt)
+and other overloads taking a @p threadCount split each deduplication pass
+among given number of threads. If @p threadCount is @cpp 1 @ce, the operation
+is done serially on the calling thread, @cpp 0 @ce means all hardware threads.
+The bounds calculation and vector discretization is done in parallel on ranges
+of the input data, the discretized vectors are then sharded by their hash into
+per-thread tables and unique items are numbered with a parallel prefix sum in
+their original order, which means the output is exactly the same as with the
+serial operation, regardless of the thread count.
+Because of the additional passes, it's beneficial only for large inputs, for
+example in the order of hundreds of thousands of items and more. See
+@ref features-multithreading for more information.
 @see @ref meshtools-duplicates
 */
 MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesFuzzyInPlace(const Containers::StridedArrayView2D<Float>& data, Float epsilon = Math::TypeTraits<Float>::epsilon());
 
+/**
+ * @overload
+ * @m_since_latest
+ *
+ * Splits the work among @p threadCount threads, see
+ * @ref MeshTools-removeDuplicatesFuzzyInPlace-multithreading for details.
+ */
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesFuzzyInPlace(const Containers::StridedArrayView2D<Float>& data, Float epsilon, UnsignedInt threadCount);
+
 /**
  * @overload
  * @m_since{2020,06}
  */
 MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesFuzzyInPlace(const Containers::StridedArrayView2D<Double>& data, Double epsilon = Math::TypeTraits<Double>::epsilon());
 
+/**
+ * @overload
+ * @m_since_latest
+ *
+ * Splits the work among @p threadCount threads, see
+ * @ref MeshTools-removeDuplicatesFuzzyInPlace-multithreading for details.
+ */
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesFuzzyInPlace(const Containers::StridedArrayView2D<Double>& data, Double epsilon, UnsignedInt threadCount);
+
 /**
 @brief Remove duplicate data from given array using fuzzy comparison in-place into given output index array
 @param[in,out] data Data array to process. Unique items get moved to the front,
@@ -261,12 +294,30 @@ size as @p data.
 */
 MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyInPlaceInto(const Containers::StridedArrayView2D<Float>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, Float epsilon = Math::TypeTraits<Float>::epsilon());
 
+/**
+ * @overload
+ * @m_since_latest
+ *
+ * Splits the work among @p threadCount threads, see
+ * @ref MeshTools-removeDuplicatesFuzzyInPlace-multithreading for details.
+ */
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyInPlaceInto(const Containers::StridedArrayView2D<Float>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, Float epsilon, UnsignedInt threadCount);
+
 /**
  * @overload
  * @m_since{2020,06}
  */
 MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyInPlaceInto(const Containers::StridedArrayView2D<Double>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, Double epsilon = Math::TypeTraits<Double>::epsilon());
 
+/**
+ * @overload
+ * @m_since_latest
+ *
+ * Splits the work among @p threadCount threads, see
+ * @ref MeshTools-removeDuplicatesFuzzyInPlace-multithreading for details.
+ */
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyInPlaceInto(const Containers::StridedArrayView2D<Double>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, Double epsilon, UnsignedInt threadCount);
+
 #ifdef MAGNUM_BUILD_DEPRECATED
 /**
 @brief Remove duplicate data from a STL vector using fuzzy comparison in-place
@@ -306,36 +357,90 @@ the existing index array instead of allocating a new one.
 */
 MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView2D<Float>& data, Float epsilon = Math::TypeTraits<Float>::epsilon());
 
+/**
+ * @overload
+ * @m_since_latest
+ *
+ * Splits the work among @p threadCount threads, see
+ * @ref MeshTools-removeDuplicatesFuzzyInPlace-multithreading for details.
+ */
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView2D<Float>& data, Float epsilon, UnsignedInt threadCount);
+
 /**
  * @overload
  * @m_since{2020,06}
  */
 MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView2D<Float>& data, Float epsilon = Math::TypeTraits<Float>::epsilon());
 
+/**
+ * @overload
+ * @m_since_latest
+ *
+ * Splits the work among @p threadCount threads, see
+ * @ref MeshTools-removeDuplicatesFuzzyInPlace-multithreading for details.
+ */
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView2D<Float>& data, Float epsilon, UnsignedInt threadCount);
+
 /**
  * @overload
  * @m_since{2020,06}
  */
 MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView2D<Float>& data, Float epsilon = Math::TypeTraits<Float>::epsilon());
 
+/**
+ * @overload
+ * @m_since_latest
+ *
+ * Splits the work among @p threadCount threads, see
+ * @ref MeshTools-removeDuplicatesFuzzyInPlace-multithreading for details.
+ */
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView2D<Float>& data, Float epsilon, UnsignedInt threadCount);
+
 /**
  * @overload
  * @m_since{2020,06}
  */
 MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView2D<Double>& data, Double epsilon = Math::TypeTraits<Double>::epsilon());
 
+/**
+ * @overload
+ * @m_since_latest
+ *
+ * Splits the work among @p threadCount threads, see
+ * @ref MeshTools-removeDuplicatesFuzzyInPlace-multithreading for details.
+ */
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView2D<Double>& data, Double epsilon, UnsignedInt threadCount);
+
 /**
  * @overload
  * @m_since{2020,06}
  */
 MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView2D<Double>& data, Double epsilon = Math::TypeTraits<Double>::epsilon());
 
+/**
+ * @overload
+ * @m_since_latest
+ *
+ * Splits the work among @p threadCount threads, see
+ * @ref MeshTools-removeDuplicatesFuzzyInPlace-multithreading for details.
+ */
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView2D<Double>& data, Double epsilon, UnsignedInt threadCount);
+
 /**
  * @overload
  * @m_since{2020,06}
  */
 MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView2D<Double>& data, Double epsilon = Math::TypeTraits<Double>::epsilon());
 
+/**
+ * @overload
+ * @m_since_latest
+ *
+ * Splits the work among @p threadCount threads, see
+ * @ref MeshTools-removeDuplicatesFuzzyInPlace-multithreading for details.
+ */
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView2D<Double>& data, Double epsilon, UnsignedInt threadCount);
+
 /**
 @brief Remove duplicates from indexed data using fuzzy comparison in-place on a type-erased index array
 @m_since{2020,06}
@@ -347,12 +452,30 @@ Expects that the second dimension is contiguous and represents the actual
 */
 MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView2D<Float>& data, Float epsilon = Math::TypeTraits<Float>::epsilon());
 
+/**
+ * @overload
+ * @m_since_latest
+ *
+ * Splits the work among @p threadCount threads, see
+ * @ref MeshTools-removeDuplicatesFuzzyInPlace-multithreading for details.
+ */
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView2D<Float>& data, Float epsilon, UnsignedInt threadCount);
+
 /**
  * @overload
  * @m_since{2020,06}
  */
 MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView2D<Double>& data, Double epsilon = Math::TypeTraits<Double>::epsilon());
 
+/**
+ * @overload
+ * @m_since_latest
+ *
+ * Splits the work among @p threadCount threads, see
+ * @ref MeshTools-removeDuplicatesFuzzyInPlace-multithreading for details.
+ */
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView2D<Double>& data, Double epsilon, UnsignedInt threadCount);
+
 /**
 @brief Remove mesh data duplicates
 @m_since{2020,06}
@@ -390,6 +513,16 @@ otherwise it's scaled to calculated value range.
 */
 MAGNUM_MESHTOOLS_EXPORT Trade::MeshData removeDuplicatesFuzzy(const Trade::MeshData& mesh, Float floatEpsilon = Math::TypeTraits<Float>::epsilon(), Double doubleEpsilon = Math::TypeTraits<Double>::epsilon());
 
+/**
+ * @overload
+ * @m_since_latest
+ *
+ * The @p threadCount is passed through to the fuzzy deduplication of each
+ * attribute, see @ref MeshTools-removeDuplicatesFuzzyInPlace-multithreading
+ * for details.
+ */
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData removeDuplicatesFuzzy(const Trade::MeshData& mesh, Float floatEpsilon, Double doubleEpsilon, UnsignedInt threadCount);
+
 #ifdef MAGNUM_BUILD_DEPRECATED
 template<class Vector> std::vector<UnsignedInt> removeDuplicates(std::vector<Vector>& data, typename Vector::Type epsilon) {
     /* A trivial index array that'll be remapped and returned after */
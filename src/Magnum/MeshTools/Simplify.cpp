@@ -0,0 +1,426 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Simplify.h"
+
+#include <algorithm> /* std::sort(), std::unique(), std::binary_search() */
+#include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Reference.h"
+#include "Magnum/MeshTools/Implementation/remapAttributeData.h"
+#include "Magnum/MeshTools/Implementation/Tipsify.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Upper triangle of a symmetric 4x4 plane quadric matrix, weighted by the
+   area of triangles it was calculated from. The weight is kept to calculate
+   an average squared distance from all planes instead of a sum. */
+struct Quadric {
+    Double a00, a01, a02, a11, a12, a22, b0, b1, b2, c, weight;
+};
+
+Quadric& operator+=(Quadric& a, const Quadric& b) {
+    a.a00 += b.a00;
+    a.a01 += b.a01;
+    a.a02 += b.a02;
+    a.a11 += b.a11;
+    a.a12 += b.a12;
+    a.a22 += b.a22;
+    a.b0 += b.b0;
+    a.b1 += b.b1;
+    a.b2 += b.b2;
+    a.c += b.c;
+    a.weight += b.weight;
+    return a;
+}
+
+Double quadricError(const Quadric& q, const Vector3& position) {
+    if(q.weight == 0.0) return 0.0;
+
+    const Double x = position.x();
+    const Double y = position.y();
+    const Double z = position.z();
+    const Double error =
+        q.a00*x*x + 2.0*q.a01*x*y + 2.0*q.a02*x*z +
+        q.a11*y*y + 2.0*q.a12*y*z +
+        q.a22*z*z +
+        2.0*(q.b0*x + q.b1*y + q.b2*z) + q.c;
+    /* Can get slightly negative due to precision issues */
+    return Math::max(error, 0.0)/q.weight;
+}
+
+inline UnsignedLong edgeKey(const UnsignedInt a, const UnsignedInt b) {
+    return UnsignedLong(a) << 32 | b;
+}
+
+/* Collapsing the `from` vertex into `to`. The edge is used just for a
+   deterministic ordering of collapses with the same cost. */
+struct Collapse {
+    Double cost;
+    UnsignedLong edge;
+    UnsignedInt from, to;
+};
+
+template<class T> Containers::Pair<std::size_t, Float> simplifyInPlaceImplementation(const Containers::StridedArrayView1D<T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t targetIndexCount, const Float targetError) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::simplifyInPlace(): index count not divisible by 3", {});
+    CORRADE_ASSERT(targetError >= 0.0f,
+        "MeshTools::simplifyInPlace(): expected a non-negative target error but got" << targetError, {});
+    const UnsignedInt vertexCount = positions.size();
+    #ifndef CORRADE_NO_ASSERT
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        CORRADE_ASSERT(indices[i] < vertexCount,
+            "MeshTools::simplifyInPlace(): index" << UnsignedInt(indices[i]) << "out of range for" << vertexCount << "vertices", {});
+    #endif
+
+    if(indices.size() <= targetIndexCount)
+        return {indices.size(), 0.0f};
+
+    /* Copy the indices to a working array, dropping degenerate triangles.
+       Calculate the mesh extent, which the error is relative to, and per-vertex
+       quadrics. */
+    Containers::Array<UnsignedInt> work{NoInit, indices.size()};
+    Containers::Array<Quadric> quadrics{ValueInit, vertexCount};
+    Vector3 min{Constants::inf()};
+    Vector3 max{-Constants::inf()};
+    std::size_t workSize = 0;
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        const UnsignedInt a = indices[i + 0];
+        const UnsignedInt b = indices[i + 1];
+        const UnsignedInt c = indices[i + 2];
+        for(const UnsignedInt vertex: {a, b, c}) {
+            min = Math::min(min, positions[vertex]);
+            max = Math::max(max, positions[vertex]);
+        }
+        if(a == b || b == c || a == c) continue;
+
+        work[workSize++] = a;
+        work[workSize++] = b;
+        work[workSize++] = c;
+
+        /* Zero-area triangles don't contribute to the quadrics */
+        Vector3 normal = Math::cross(positions[b] - positions[a], positions[c] - positions[a]);
+        const Float length = normal.length();
+        if(length == 0.0f) continue;
+        normal /= length;
+
+        const Double nx = normal.x();
+        const Double ny = normal.y();
+        const Double nz = normal.z();
+        const Double d = -Math::dot(normal, positions[a]);
+        const Double weight = length*0.5;
+        const Quadric quadric{
+            nx*nx*weight, nx*ny*weight, nx*nz*weight,
+            ny*ny*weight, ny*nz*weight,
+            nz*nz*weight,
+            d*nx*weight, d*ny*weight, d*nz*weight,
+            d*d*weight, weight};
+        quadrics[a] += quadric;
+        quadrics[b] += quadric;
+        quadrics[c] += quadric;
+    }
+    Float extent = (max - min).max();
+    if(extent == 0.0f) extent = 1.0f;
+
+    /* Lock vertices on edges that don't have a neighbor with an opposite
+       winding. That catches both open borders and attribute seams, where the
+       vertices on both sides of the edge have different indices. Collapsing
+       those would either shrink the mesh boundary or open holes at the
+       seam. */
+    Containers::BitArray locked{ValueInit, vertexCount};
+    {
+        Containers::Array<UnsignedLong> directedEdges{NoInit, workSize};
+        for(std::size_t i = 0; i != workSize; i += 3) {
+            directedEdges[i + 0] = edgeKey(work[i + 0], work[i + 1]);
+            directedEdges[i + 1] = edgeKey(work[i + 1], work[i + 2]);
+            directedEdges[i + 2] = edgeKey(work[i + 2], work[i + 0]);
+        }
+        std::sort(directedEdges.begin(), directedEdges.end());
+        for(const UnsignedLong edge: directedEdges) {
+            const UnsignedInt a = edge >> 32;
+            const UnsignedInt b = edge & 0xffffffffu;
+            if(!std::binary_search(directedEdges.begin(), directedEdges.end(), edgeKey(b, a))) {
+                locked.set(a);
+                locked.set(b);
+            }
+        }
+    }
+
+    const Double maxDistance = Double(targetError)*extent;
+    const Double maxCost = maxDistance*maxDistance;
+    const std::size_t targetTriangleCount = targetIndexCount/3;
+    Double appliedCost = 0.0;
+
+    /* Each pass collapses a set of independent edges in the order of
+       increasing cost. After collapsing an edge, both its vertices are left
+       untouched for the rest of the pass, as the costs of edges around them
+       are no longer valid. */
+    Containers::Array<UnsignedInt> liveTriangleCount, neighborOffset, neighbors;
+    Containers::Array<UnsignedLong> edges;
+    Containers::Array<Collapse> collapses;
+    Containers::Array<UnsignedInt> remap{NoInit, vertexCount};
+    while(workSize > targetIndexCount) {
+        const std::size_t triangleCount = workSize/3;
+        Implementation::buildAdjacency<UnsignedInt>(work.prefix(workSize), vertexCount, liveTriangleCount, neighborOffset, neighbors);
+
+        /* Gather unique undirected edges */
+        arrayResize(edges, NoInit, workSize);
+        for(std::size_t i = 0; i != workSize; i += 3) {
+            for(std::size_t j = 0; j != 3; ++j) {
+                const UnsignedInt a = work[i + j];
+                const UnsignedInt b = work[i + (j + 1) % 3];
+                edges[i + j] = a < b ? edgeKey(a, b) : edgeKey(b, a);
+            }
+        }
+        std::sort(edges.begin(), edges.end());
+        arrayResize(edges, std::unique(edges.begin(), edges.end()) - edges.begin());
+
+        /* Pick the cheaper collapse direction for each edge */
+        arrayResize(collapses, NoInit, 0);
+        for(const UnsignedLong edge: edges) {
+            const UnsignedInt a = edge >> 32;
+            const UnsignedInt b = edge & 0xffffffffu;
+            if(locked[a] && locked[b]) continue;
+
+            const Double costAB = locked[a] ? Constantsd::inf() : quadricError(quadrics[a], positions[b]);
+            const Double costBA = locked[b] ? Constantsd::inf() : quadricError(quadrics[b], positions[a]);
+            if(costBA < costAB)
+                arrayAppend(collapses, Collapse{costBA, edge, b, a});
+            else
+                arrayAppend(collapses, Collapse{costAB, edge, a, b});
+        }
+        std::sort(collapses.begin(), collapses.end(), [](const Collapse& a, const Collapse& b) {
+            return a.cost < b.cost || (a.cost == b.cost && a.edge < b.edge);
+        });
+
+        for(UnsignedInt i = 0; i != vertexCount; ++i) remap[i] = i;
+        Containers::BitArray touched{ValueInit, vertexCount};
+        const std::size_t trianglesToRemove = triangleCount - targetTriangleCount;
+        std::size_t removedTriangleCount = 0;
+        std::size_t collapseCount = 0;
+        for(const Collapse& collapse: collapses) {
+            if(collapse.cost > maxCost) break;
+            if(touched[collapse.from] || touched[collapse.to]) continue;
+
+            /* Check that no triangle around the collapsed vertex flips or
+               rotates too much. The triangles may reference vertices
+               collapsed earlier in this pass, so go through the remapping.
+               Triangles containing both vertices of the edge become
+               degenerate and get removed. */
+            bool valid = true;
+            std::size_t collapseRemovedTriangleCount = 0;
+            for(UnsignedInt j = neighborOffset[collapse.from]; j != neighborOffset[collapse.from + 1]; ++j) {
+                const std::size_t triangle = neighbors[j]*3;
+                const UnsignedInt a = remap[work[triangle + 0]];
+                const UnsignedInt b = remap[work[triangle + 1]];
+                const UnsignedInt c = remap[work[triangle + 2]];
+                if(a == collapse.to || b == collapse.to || c == collapse.to) {
+                    ++collapseRemovedTriangleCount;
+                    continue;
+                }
+
+                const Vector3 normal = Math::cross(positions[b] - positions[a], positions[c] - positions[a]);
+                if(normal.isZero()) continue;
+
+                const Vector3& newA = positions[a == collapse.from ? collapse.to : a];
+                const Vector3& newB = positions[b == collapse.from ? collapse.to : b];
+                const Vector3& newC = positions[c == collapse.from ? collapse.to : c];
+                const Vector3 newNormal = Math::cross(newB - newA, newC - newA);
+                if(Math::dot(normal, newNormal) <= 0.25f*normal.length()*newNormal.length()) {
+                    valid = false;
+                    break;
+                }
+            }
+            if(!valid) continue;
+
+            remap[collapse.from] = collapse.to;
+            touched.set(collapse.from);
+            touched.set(collapse.to);
+            quadrics[collapse.to] += quadrics[collapse.from];
+            appliedCost = Math::max(appliedCost, collapse.cost);
+            ++collapseCount;
+            removedTriangleCount += collapseRemovedTriangleCount;
+            if(removedTriangleCount >= trianglesToRemove) break;
+        }
+
+        /* Nothing more can be collapsed without exceeding the error or
+           damaging the mesh */
+        if(!collapseCount) break;
+
+        /* Apply the collapses and remove triangles that became degenerate */
+        std::size_t newWorkSize = 0;
+        for(std::size_t i = 0; i != workSize; i += 3) {
+            const UnsignedInt a = remap[work[i + 0]];
+            const UnsignedInt b = remap[work[i + 1]];
+            const UnsignedInt c = remap[work[i + 2]];
+            if(a == b || b == c || a == c) continue;
+
+            work[newWorkSize++] = a;
+            work[newWorkSize++] = b;
+            work[newWorkSize++] = c;
+        }
+        workSize = newWorkSize;
+    }
+
+    for(std::size_t i = 0; i != workSize; ++i)
+        indices[i] = T(work[i]);
+
+    return {workSize, Float(Math::sqrt(appliedCost)/extent)};
+}
+
+}
+
+Containers::Pair<std::size_t, Float> simplifyInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t targetIndexCount, const Float targetError) {
+    return simplifyInPlaceImplementation(indices, positions, targetIndexCount, targetError);
+}
+
+Containers::Pair<std::size_t, Float> simplifyInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t targetIndexCount, const Float targetError) {
+    return simplifyInPlaceImplementation(indices, positions, targetIndexCount, targetError);
+}
+
+Containers::Pair<std::size_t, Float> simplifyInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t targetIndexCount, const Float targetError) {
+    return simplifyInPlaceImplementation(indices, positions, targetIndexCount, targetError);
+}
+
+Containers::Pair<std::size_t, Float> simplifyInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t targetIndexCount, const Float targetError) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::simplifyInPlace(): second index view dimension is not contiguous", {});
+    if(indices.size()[1] == 4)
+        return simplifyInPlaceImplementation(Containers::arrayCast<1, UnsignedInt>(indices), positions, targetIndexCount, targetError);
+    else if(indices.size()[1] == 2)
+        return simplifyInPlaceImplementation(Containers::arrayCast<1, UnsignedShort>(indices), positions, targetIndexCount, targetError);
+    else {
+        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::simplifyInPlace(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
+        return simplifyInPlaceImplementation(Containers::arrayCast<1, UnsignedByte>(indices), positions, targetIndexCount, targetError);
+    }
+}
+
+namespace {
+
+/* Transfers the vertex data as-is, releasing them if possible, and puts the
+   passed indices next to them */
+Trade::MeshData meshWithIndices(Trade::MeshData&& mesh, Containers::Array<char>&& indexData, const Containers::ArrayView<const UnsignedInt> indices) {
+    const Containers::ArrayView<const char> originalVertexData = mesh.vertexData();
+    Containers::Array<char> vertexData;
+    const UnsignedInt vertexCount = mesh.vertexCount();
+    if(mesh.vertexDataFlags() & Trade::DataFlag::Owned)
+        vertexData = mesh.releaseVertexData();
+    else {
+        vertexData = Containers::Array<char>{NoInit, originalVertexData.size()};
+        Utility::copy(originalVertexData, vertexData);
+    }
+
+    Containers::Array<Trade::MeshAttributeData> attributeData{mesh.attributeCount()};
+    for(UnsignedInt i = 0; i != attributeData.size(); ++i)
+        attributeData[i] = Implementation::remapAttributeData(mesh.attributeData(i), vertexCount, originalVertexData, vertexData);
+
+    const Trade::MeshIndexData indexView{indices};
+    return Trade::MeshData{mesh.primitive(), Utility::move(indexData), indexView,
+        Utility::move(vertexData), Utility::move(attributeData), vertexCount};
+}
+
+}
+
+Trade::MeshData simplify(Trade::MeshData&& mesh, const std::size_t targetIndexCount, const Float targetError) {
+    CORRADE_ASSERT(mesh.primitive() == MeshPrimitive::Triangles,
+        "MeshTools::simplify(): expected a" << MeshPrimitive::Triangles << "mesh, got" << mesh.primitive(), (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+    CORRADE_ASSERT(mesh.isIndexed(),
+        "MeshTools::simplify(): mesh data not indexed", (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+    CORRADE_ASSERT(!isMeshIndexTypeImplementationSpecific(mesh.indexType()),
+        "MeshTools::simplify(): mesh has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()), (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+    CORRADE_ASSERT(mesh.hasAttribute(Trade::MeshAttribute::Position),
+        "MeshTools::simplify(): the mesh has no positions", (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+
+    const Containers::Array<Vector3> positions = mesh.positions3DAsArray();
+    Containers::Array<char> indexData{NoInit, mesh.indexCount()*sizeof(UnsignedInt)};
+    const Containers::ArrayView<UnsignedInt> indices = Containers::arrayCast<UnsignedInt>(indexData);
+    mesh.indicesInto(indices);
+
+    const std::size_t indexCount = simplifyInPlace(Containers::stridedArrayView(indices), positions, targetIndexCount, targetError).first();
+    return meshWithIndices(Utility::move(mesh), Utility::move(indexData), indices.prefix(indexCount));
+}
+
+Trade::MeshData simplify(const Trade::MeshData& mesh, const std::size_t targetIndexCount, const Float targetError) {
+    /* Pass through to the && overload, which then decides whether to reuse
+       anything based on the DataFlags */
+    return simplify(reference(mesh), targetIndexCount, targetError);
+}
+
+Containers::Pair<Trade::MeshData, Containers::Array<MeshLod>> generateLodChain(const Trade::MeshData& mesh, const Containers::ArrayView<const Float> indexCountRatios, const Float targetError) {
+    CORRADE_ASSERT(mesh.primitive() == MeshPrimitive::Triangles,
+        "MeshTools::generateLodChain(): expected a" << MeshPrimitive::Triangles << "mesh, got" << mesh.primitive(), (Containers::Pair<Trade::MeshData, Containers::Array<MeshLod>>{Trade::MeshData{MeshPrimitive::Triangles, 0}, {}}));
+    CORRADE_ASSERT(mesh.isIndexed(),
+        "MeshTools::generateLodChain(): mesh data not indexed", (Containers::Pair<Trade::MeshData, Containers::Array<MeshLod>>{Trade::MeshData{MeshPrimitive::Triangles, 0}, {}}));
+    CORRADE_ASSERT(!isMeshIndexTypeImplementationSpecific(mesh.indexType()),
+        "MeshTools::generateLodChain(): mesh has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()), (Containers::Pair<Trade::MeshData, Containers::Array<MeshLod>>{Trade::MeshData{MeshPrimitive::Triangles, 0}, {}}));
+    CORRADE_ASSERT(mesh.hasAttribute(Trade::MeshAttribute::Position),
+        "MeshTools::generateLodChain(): the mesh has no positions", (Containers::Pair<Trade::MeshData, Containers::Array<MeshLod>>{Trade::MeshData{MeshPrimitive::Triangles, 0}, {}}));
+    #ifndef CORRADE_NO_ASSERT
+    for(std::size_t i = 0; i != indexCountRatios.size(); ++i)
+        CORRADE_ASSERT(indexCountRatios[i] >= 0.0f && indexCountRatios[i] <= 1.0f,
+            "MeshTools::generateLodChain(): expected index count ratio" << i << "to be in range [0, 1] but got" << indexCountRatios[i], (Containers::Pair<Trade::MeshData, Containers::Array<MeshLod>>{Trade::MeshData{MeshPrimitive::Triangles, 0}, {}}));
+    #endif
+
+    const Containers::Array<Vector3> positions = mesh.positions3DAsArray();
+    const UnsignedInt indexCount = mesh.indexCount();
+
+    /* Each level is simplified from a copy of the previous one, which is at
+       most as large as the previous, so the size of the original index
+       buffer multiplied by the level count is an upper bound. Copy the
+       original indices to the first level. */
+    Containers::Array<UnsignedInt> indices{NoInit, indexCount*(indexCountRatios.size() + 1)};
+    mesh.indicesInto(indices.prefix(indexCount));
+
+    Containers::Array<MeshLod> lods{NoInit, indexCountRatios.size() + 1};
+    lods[0] = {0, indexCount, 0.0f};
+    for(std::size_t i = 0; i != indexCountRatios.size(); ++i) {
+        const MeshLod& previous = lods[i];
+        const UnsignedInt offset = previous.indexOffset + previous.indexCount;
+        const Containers::ArrayView<UnsignedInt> levelIndices = indices.sliceSize(offset, previous.indexCount);
+        Utility::copy(indices.sliceSize(previous.indexOffset, previous.indexCount), levelIndices);
+
+        const Containers::Pair<std::size_t, Float> result = simplifyInPlace(Containers::stridedArrayView(levelIndices), positions, std::size_t(indexCountRatios[i]*indexCount), targetError);
+        lods[i + 1] = {offset, UnsignedInt(result.first()), previous.error + result.second()};
+    }
+
+    /* Copy just the used prefix to the output index buffer */
+    const MeshLod& last = lods[lods.size() - 1];
+    Containers::Array<char> indexData{NoInit, (last.indexOffset + last.indexCount)*sizeof(UnsignedInt)};
+    Utility::copy(Containers::arrayCast<const char>(indices.prefix(last.indexOffset + last.indexCount)), indexData);
+
+    const Containers::ArrayView<const UnsignedInt> firstLevelIndices = Containers::arrayCast<const UnsignedInt>(indexData).prefix(indexCount);
+    return {meshWithIndices(reference(mesh), Utility::move(indexData), firstLevelIndices), Utility::move(lods)};
+}
+
+}}
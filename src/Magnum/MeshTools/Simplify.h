@@ -0,0 +1,193 @@
+#ifndef Magnum_MeshTools_Simplify_h
+#define Magnum_MeshTools_Simplify_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::simplifyInPlace(), @ref Magnum::MeshTools::simplify(), @ref Magnum::MeshTools::generateLodChain(), struct @ref Magnum::MeshTools::MeshLod
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Constants.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Simplify a triangle mesh in-place
+@param[in,out] indices      Index array to operate on
+@param[in] positions        Vertex positions
+@param[in] targetIndexCount Target index count
+@param[in] targetError      Max allowed error, relative to the mesh extent
+@return Size of the used prefix in @p indices and the resulting error relative
+    to the mesh extent
+@m_since_latest
+
+Repeatedly collapses mesh edges, picking the ones that introduce the least
+error first, until the index count gets to @p targetIndexCount or until the
+next collapse would introduce an error larger than @p targetError. The error
+is measured as a distance from the original surface using quadric error
+metrics and is relative to the largest dimension of the mesh bounding box,
+i.e. a value of @cpp 0.01f @ce means the simplified surface deviates at most
+by 1% of the mesh size. Algorithm used: *Michael Garland, Paul S. Heckbert
+--- Surface Simplification Using Quadric Error Metrics, SIGGRAPH 1997,
+https://www.cs.cmu.edu/~garland/Papers/quadrics.pdf*.
+
+A vertex is always collapsed into another existing vertex, so the vertex data
+don't need to be modified and the result references a subset of the original
+vertices. Collapses that would flip or excessively rotate a triangle are
+rejected. Vertices on edges that are referenced by just one triangle are never
+removed --- that includes both open mesh borders and attribute seams, where
+vertices at the same position are duplicated with for example a different
+texture coordinate or normal. Because of that the result may have
+considerably more indices than @p targetIndexCount for meshes that consist
+of many disconnected pieces. Non-indexed meshes should be converted with
+@ref removeDuplicates(const Trade::MeshData&) first.
+
+Expects that the index count is divisible by @cpp 3 @ce, all indices are less
+than @p positions size and @p targetError is not negative. Triangle order in
+the output is preserved, the index array isn't reallocated but only its
+prefix is overwritten. Use @ref optimizeVertexCacheInPlace() and
+@ref optimizeVertexFetchIndexedInPlace() afterwards to optimize the result for
+rendering.
+@see @ref simplify(), @ref generateLodChain()
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<std::size_t, Float> simplifyInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, std::size_t targetIndexCount, Float targetError = Constants::inf());
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<std::size_t, Float> simplifyInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, std::size_t targetIndexCount, Float targetError = Constants::inf());
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<std::size_t, Float> simplifyInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, std::size_t targetIndexCount, Float targetError = Constants::inf());
+
+/**
+@brief Simplify a triangle mesh in-place on a type-erased index array
+@m_since_latest
+
+Expects that the second dimension of @p indices is contiguous and represents
+the actual 1/2/4-byte index type. Based on its size then calls one of the
+@ref simplifyInPlace(const Containers::StridedArrayView1D<UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&, std::size_t, Float)
+etc. overloads.
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<std::size_t, Float> simplifyInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, std::size_t targetIndexCount, Float targetError = Constants::inf());
+
+/**
+@brief Simplify a triangle mesh
+@param mesh             Input mesh
+@param targetIndexCount Target index count
+@param targetError      Max allowed error, relative to the mesh extent
+@m_since_latest
+
+Expects that the mesh is indexed, is @ref MeshPrimitive::Triangles and has a
+@ref Trade::MeshAttribute::Position attribute. Calls
+@ref simplifyInPlace(const Containers::StridedArrayView1D<UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&, std::size_t, Float)
+on a copy of its indices and returns a mesh with the same vertex data and the
+simplified indices in a @ref MeshIndexType::UnsignedInt. If @p mesh vertex
+data are owned, they're transferred to the output instead of being copied.
+Vertices that are no longer referenced are kept, use
+@ref optimizeVertexFetchIndexedInPlace() to remove them.
+@see @ref generateLodChain(), @ref isMeshIndexTypeImplementationSpecific()
+*/
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData simplify(Trade::MeshData&& mesh, std::size_t targetIndexCount, Float targetError = Constants::inf());
+
+/**
+ * @overload
+ * @m_since_latest
+ *
+ * Compared to @ref simplify(Trade::MeshData&&, std::size_t, Float) always
+ * copies the vertex data.
+ */
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData simplify(const Trade::MeshData& mesh, std::size_t targetIndexCount, Float targetError = Constants::inf());
+
+/**
+@brief Mesh level of detail
+@m_since_latest
+
+@see @ref generateLodChain()
+*/
+struct MeshLod {
+    /**
+     * @brief Index offset
+     *
+     * Offset of the first index of given level in the index buffer, in
+     * indices. Multiply by @cpp 4 @ce to get an offset in bytes.
+     */
+    UnsignedInt indexOffset;
+
+    /** @brief Index count */
+    UnsignedInt indexCount;
+
+    /**
+     * @brief Error relative to the mesh extent
+     *
+     * Upper bound of the error accumulated over all previous levels. Is
+     * @cpp 0.0f @ce for the first level.
+     */
+    Float error;
+};
+
+/**
+@brief Generate a LOD chain from a triangle mesh
+@param mesh                 Input mesh
+@param indexCountRatios     Target index count for each generated level,
+    relative to the @p mesh index count
+@param targetError          Max allowed error of each level relative to the
+    previous one, relative to the mesh extent
+@m_since_latest
+
+Returns a mesh with the same vertex data as @p mesh and with all levels of
+detail concatenated into a single @ref MeshIndexType::UnsignedInt index
+buffer, together with a list of index ranges for each level. The first level
+is always the original @p mesh indices and is what the returned mesh index
+view references, it's followed by one level for each item in
+@p indexCountRatios. Each level is simplified from the previous one with
+@ref simplifyInPlace(const Containers::StridedArrayView1D<UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&, std::size_t, Float),
+which means all levels share the same vertices and can be drawn from the
+same vertex and index buffer just by changing the index offset and count:
+
+@snippet MeshTools-gl.cpp generateLodChain
+
+Expects that the mesh is indexed, is @ref MeshPrimitive::Triangles, has a
+@ref Trade::MeshAttribute::Position attribute and that all
+@p indexCountRatios are in range @f$ [0, 1] @f$. For best results the ratios
+should be in a decreasing order.
+@see @ref simplify(), @ref isMeshIndexTypeImplementationSpecific()
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Trade::MeshData, Containers::Array<MeshLod>> generateLodChain(const Trade::MeshData& mesh, Containers::ArrayView<const Float> indexCountRatios, Float targetError = Constants::inf());
+
+}}
+
+#endif
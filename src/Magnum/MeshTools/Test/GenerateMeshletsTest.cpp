@@ -0,0 +1,547 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+
+#include "Magnum/Math/TypeTraits.h"
+#include "Magnum/MeshTools/GenerateMeshlets.h"
+#include "Magnum/Primitives/Grid.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct GenerateMeshletsTest: TestSuite::Tester {
+    explicit GenerateMeshletsTest();
+
+    template<class T> void generateMeshlets();
+    void generateMeshletsSmallLimits();
+    void generateMeshletsSingleTriangle();
+    void generateMeshletsLarger();
+    void generateMeshletsDegenerate();
+    void generateMeshletsEmpty();
+    void generateMeshletsInvalid();
+    void generateMeshletsMeshData();
+    void generateMeshletsMeshDataNotIndexed();
+    void generateMeshletsMeshDataInvalidPrimitive();
+
+    void generateMeshletBounds();
+    void generateMeshletBoundsCone();
+    void generateMeshletBoundsConeConcave();
+    void generateMeshletBoundsConeHemisphere();
+    void generateMeshletBoundsConeOpposite();
+    void generateMeshletBoundsDegenerate();
+    void generateMeshletBoundsInvalid();
+
+    void benchmarkGenerateMeshlets();
+    void benchmarkGenerateMeshletBounds();
+};
+
+GenerateMeshletsTest::GenerateMeshletsTest() {
+    addTests({&GenerateMeshletsTest::generateMeshlets<UnsignedByte>,
+              &GenerateMeshletsTest::generateMeshlets<UnsignedShort>,
+              &GenerateMeshletsTest::generateMeshlets<UnsignedInt>,
+              &GenerateMeshletsTest::generateMeshletsSmallLimits,
+              &GenerateMeshletsTest::generateMeshletsSingleTriangle,
+              &GenerateMeshletsTest::generateMeshletsLarger,
+              &GenerateMeshletsTest::generateMeshletsDegenerate,
+              &GenerateMeshletsTest::generateMeshletsEmpty,
+              &GenerateMeshletsTest::generateMeshletsInvalid,
+              &GenerateMeshletsTest::generateMeshletsMeshData,
+              &GenerateMeshletsTest::generateMeshletsMeshDataNotIndexed,
+              &GenerateMeshletsTest::generateMeshletsMeshDataInvalidPrimitive,
+
+              &GenerateMeshletsTest::generateMeshletBounds,
+              &GenerateMeshletsTest::generateMeshletBoundsCone,
+              &GenerateMeshletsTest::generateMeshletBoundsConeConcave,
+              &GenerateMeshletsTest::generateMeshletBoundsConeHemisphere,
+              &GenerateMeshletsTest::generateMeshletBoundsConeOpposite,
+              &GenerateMeshletsTest::generateMeshletBoundsDegenerate,
+              &GenerateMeshletsTest::generateMeshletBoundsInvalid});
+
+    addBenchmarks({&GenerateMeshletsTest::benchmarkGenerateMeshlets,
+                   &GenerateMeshletsTest::benchmarkGenerateMeshletBounds}, 10);
+}
+
+/*
+    6---7---8
+    | / | / |
+    3---4---5
+    | / | / |
+    0---1---2
+*/
+constexpr UnsignedInt GridIndices[]{
+    0, 4, 3, 0, 1, 4,
+    1, 5, 4, 1, 2, 5,
+    3, 7, 6, 3, 4, 7,
+    4, 8, 7, 4, 5, 8
+};
+
+template<class T> void GenerateMeshletsTest::generateMeshlets() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    T indices[Containers::arraySize(GridIndices)];
+    for(std::size_t i = 0; i != Containers::arraySize(GridIndices); ++i)
+        indices[i] = GridIndices[i];
+
+    /* Everything fits into a single meshlet */
+    Meshlets meshlets = MeshTools::generateMeshlets(Containers::stridedArrayView(indices), 9);
+    CORRADE_COMPARE(meshlets.meshlets.size(), 1);
+    CORRADE_COMPARE(meshlets.meshlets[0].vertexOffset, 0);
+    CORRADE_COMPARE(meshlets.meshlets[0].triangleOffset, 0);
+    CORRADE_COMPARE(meshlets.meshlets[0].vertexCount, 9);
+    CORRADE_COMPARE(meshlets.meshlets[0].triangleCount, 8);
+
+    /* Vertices are in the order of first use, triangles in the order in
+       which they were added, which is the ones adding the least vertices
+       first */
+    CORRADE_COMPARE_AS(meshlets.vertices, Containers::arrayView<UnsignedInt>({
+        0, 4, 3, 1, 5, 7, 8, 6, 2
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(meshlets.triangles, Containers::arrayView<UnsignedByte>({
+        0, 1, 2,    /* 0, 4, 3 */
+        0, 3, 1,    /* 0, 1, 4 */
+        3, 4, 1,    /* 1, 5, 4 */
+        2, 1, 5,    /* 3, 4, 7 */
+        1, 6, 5,    /* 4, 8, 7 */
+        1, 4, 6,    /* 4, 5, 8 */
+        2, 5, 7,    /* 3, 7, 6 */
+        3, 8, 4     /* 1, 2, 5 */
+    }), TestSuite::Compare::Container);
+}
+
+void GenerateMeshletsTest::generateMeshletsSmallLimits() {
+    /* At most four vertices, which results in pairs of triangles */
+    Meshlets meshlets = MeshTools::generateMeshlets(Containers::stridedArrayView(GridIndices), 9, 4);
+    CORRADE_COMPARE(meshlets.meshlets.size(), 4);
+    for(std::size_t i = 0; i != 4; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(meshlets.meshlets[i].vertexOffset, i*4);
+        CORRADE_COMPARE(meshlets.meshlets[i].triangleOffset, i*2);
+        CORRADE_COMPARE(meshlets.meshlets[i].vertexCount, 4);
+        CORRADE_COMPARE(meshlets.meshlets[i].triangleCount, 2);
+    }
+    CORRADE_COMPARE_AS(meshlets.vertices, Containers::arrayView<UnsignedInt>({
+        0, 4, 3, 1,
+        1, 5, 4, 2,
+        4, 5, 8, 7,
+        3, 4, 7, 6
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(meshlets.triangles, Containers::arrayView<UnsignedByte>({
+        0, 1, 2, 0, 3, 1,
+        0, 1, 2, 0, 3, 1,
+        0, 1, 2, 0, 2, 3,
+        0, 1, 2, 0, 2, 3
+    }), TestSuite::Compare::Container);
+}
+
+void GenerateMeshletsTest::generateMeshletsSingleTriangle() {
+    /* At most one triangle, which results in a meshlet per triangle in the
+       original order */
+    Meshlets meshlets = MeshTools::generateMeshlets(Containers::stridedArrayView(GridIndices), 9, 64, 1);
+    CORRADE_COMPARE(meshlets.meshlets.size(), 8);
+    CORRADE_COMPARE_AS(meshlets.vertices, Containers::arrayView(GridIndices),
+        TestSuite::Compare::Container);
+    for(std::size_t i = 0; i != 8; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(meshlets.meshlets[i].vertexOffset, i*3);
+        CORRADE_COMPARE(meshlets.meshlets[i].triangleOffset, i);
+        CORRADE_COMPARE(meshlets.meshlets[i].vertexCount, 3);
+        CORRADE_COMPARE(meshlets.meshlets[i].triangleCount, 1);
+        CORRADE_COMPARE_AS(meshlets.triangles.sliceSize(i*3, 3),
+            Containers::arrayView<UnsignedByte>({0, 1, 2}),
+            TestSuite::Compare::Container);
+    }
+}
+
+void GenerateMeshletsTest::generateMeshletsLarger() {
+    /* 392 triangles, 225 vertices */
+    const Trade::MeshData grid = Primitives::grid3DSolid({13, 13}, {});
+    const Containers::Array<UnsignedInt> indices = grid.indicesAsArray();
+    Meshlets meshlets = MeshTools::generateMeshlets(Containers::stridedArrayView(indices), grid.vertexCount());
+
+    /* The first four meshlets are limited by the vertex count, the last one
+       is the remainder */
+    CORRADE_COMPARE(meshlets.meshlets.size(), 5);
+
+    /* Every original triangle is in exactly one meshlet, in the same
+       winding, and no meshlet references a vertex twice */
+    Containers::BitArray triangleUsed{ValueInit, indices.size()/3};
+    std::size_t triangleCount = 0;
+    for(const Meshlet& meshlet: meshlets.meshlets) {
+        CORRADE_ITERATION(triangleCount);
+        CORRADE_COMPARE_AS(meshlet.vertexCount, 64, TestSuite::Compare::LessOrEqual);
+        CORRADE_COMPARE_AS(meshlet.triangleCount, 124, TestSuite::Compare::LessOrEqual);
+
+        Containers::BitArray vertexUsed{ValueInit, grid.vertexCount()};
+        for(UnsignedInt i = 0; i != meshlet.vertexCount; ++i) {
+            const UnsignedInt vertex = meshlets.vertices[meshlet.vertexOffset + i];
+            CORRADE_VERIFY(!vertexUsed[vertex]);
+            vertexUsed.set(vertex);
+        }
+
+        for(UnsignedInt i = 0; i != meshlet.triangleCount; ++i) {
+            UnsignedInt triangle[3];
+            for(UnsignedInt j = 0; j != 3; ++j) {
+                const UnsignedByte index = meshlets.triangles[(meshlet.triangleOffset + i)*3 + j];
+                CORRADE_COMPARE_AS(index, meshlet.vertexCount, TestSuite::Compare::Less);
+                triangle[j] = meshlets.vertices[meshlet.vertexOffset + index];
+            }
+
+            /* The grid has no duplicate triangles, so a linear search is
+               enough */
+            std::size_t found = ~std::size_t{};
+            for(std::size_t j = 0; j != indices.size()/3; ++j) {
+                if(indices[j*3 + 0] == triangle[0] &&
+                   indices[j*3 + 1] == triangle[1] &&
+                   indices[j*3 + 2] == triangle[2]) {
+                    found = j;
+                    break;
+                }
+            }
+            CORRADE_VERIFY(found != ~std::size_t{});
+            CORRADE_VERIFY(!triangleUsed[found]);
+            triangleUsed.set(found);
+            ++triangleCount;
+        }
+    }
+    CORRADE_COMPARE(triangleCount, indices.size()/3);
+}
+
+void GenerateMeshletsTest::generateMeshletsDegenerate() {
+    const UnsignedInt indices[]{
+        0, 0, 0,
+        0, 1, 1,
+        1, 2, 3
+    };
+    Meshlets meshlets = MeshTools::generateMeshlets(Containers::stridedArrayView(indices), 4);
+    CORRADE_COMPARE(meshlets.meshlets.size(), 1);
+    CORRADE_COMPARE(meshlets.meshlets[0].vertexCount, 4);
+    CORRADE_COMPARE(meshlets.meshlets[0].triangleCount, 3);
+    CORRADE_COMPARE_AS(meshlets.vertices, Containers::arrayView<UnsignedInt>({
+        0, 1, 2, 3
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(meshlets.triangles, Containers::arrayView<UnsignedByte>({
+        0, 0, 0,
+        0, 1, 1,
+        1, 2, 3
+    }), TestSuite::Compare::Container);
+}
+
+void GenerateMeshletsTest::generateMeshletsEmpty() {
+    Meshlets meshlets = MeshTools::generateMeshlets(Containers::StridedArrayView1D<const UnsignedInt>{}, 5);
+    CORRADE_VERIFY(meshlets.meshlets.isEmpty());
+    CORRADE_VERIFY(meshlets.vertices.isEmpty());
+    CORRADE_VERIFY(meshlets.triangles.isEmpty());
+}
+
+void GenerateMeshletsTest::generateMeshletsInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const UnsignedInt indices[]{0, 1, 2, 2, 1, 3};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::generateMeshlets(Containers::stridedArrayView(indices).exceptSuffix(1), 4);
+    MeshTools::generateMeshlets(Containers::stridedArrayView(indices), 4, 2);
+    MeshTools::generateMeshlets(Containers::stridedArrayView(indices), 4, 257);
+    MeshTools::generateMeshlets(Containers::stridedArrayView(indices), 4, 64, 0);
+    MeshTools::generateMeshlets(Containers::stridedArrayView(indices), 3);
+    CORRADE_COMPARE_AS(out,
+        "MeshTools::generateMeshlets(): index count not divisible by 3\n"
+        "MeshTools::generateMeshlets(): expected max vertex count to be between 3 and 256 but got 2\n"
+        "MeshTools::generateMeshlets(): expected max vertex count to be between 3 and 256 but got 257\n"
+        "MeshTools::generateMeshlets(): expected non-zero max triangle count\n"
+        "MeshTools::generateMeshlets(): index 3 out of range for 3 vertices\n",
+        TestSuite::Compare::String);
+}
+
+void GenerateMeshletsTest::generateMeshletsMeshData() {
+    const Trade::MeshData grid = Primitives::grid3DSolid({1, 1}, {});
+
+    /* Same as generateMeshletsSmallLimits() */
+    Meshlets meshlets = MeshTools::generateMeshlets(grid, 4);
+    CORRADE_COMPARE(meshlets.meshlets.size(), 4);
+    CORRADE_COMPARE_AS(meshlets.vertices, Containers::arrayView<UnsignedInt>({
+        0, 4, 3, 1,
+        1, 5, 4, 2,
+        4, 5, 8, 7,
+        3, 4, 7, 6
+    }), TestSuite::Compare::Container);
+}
+
+void GenerateMeshletsTest::generateMeshletsMeshDataNotIndexed() {
+    const Vector3 positions[6]{};
+    const Trade::MeshData mesh{MeshPrimitive::Triangles, {}, positions, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(positions)}
+    }};
+
+    Meshlets meshlets = MeshTools::generateMeshlets(mesh);
+    CORRADE_COMPARE(meshlets.meshlets.size(), 1);
+    CORRADE_COMPARE(meshlets.meshlets[0].triangleCount, 2);
+    CORRADE_COMPARE_AS(meshlets.vertices, Containers::arrayView<UnsignedInt>({
+        0, 1, 2, 3, 4, 5
+    }), TestSuite::Compare::Container);
+}
+
+void GenerateMeshletsTest::generateMeshletsMeshDataInvalidPrimitive() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Trade::MeshData mesh{MeshPrimitive::TriangleStrip, 3};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::generateMeshlets(mesh);
+    CORRADE_COMPARE(out,
+        "MeshTools::generateMeshlets(): expected a MeshPrimitive::Triangles mesh, got MeshPrimitive::TriangleStrip\n");
+}
+
+void GenerateMeshletsTest::generateMeshletBounds() {
+    /* A single triangle facing +Z, with the vertices referenced from the
+       middle of a larger position array */
+    const Vector3 positions[]{
+        {},
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f},
+        {}
+    };
+    const UnsignedInt indices[]{1, 2, 3};
+    Meshlets meshlets = MeshTools::generateMeshlets(Containers::stridedArrayView(indices), 5);
+
+    Containers::Array<MeshletBounds> bounds = MeshTools::generateMeshletBounds(meshlets, positions);
+    CORRADE_COMPARE(bounds.size(), 1);
+
+    /* The sphere contains all vertices */
+    for(std::size_t i = 1; i != 4; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE_AS((positions[i] - bounds[0].center).length(),
+            bounds[0].radius*1.0001f,
+            TestSuite::Compare::LessOrEqual);
+    }
+
+    /* The cone has zero angle, and the apex is at the center as the
+       triangle is planar */
+    CORRADE_COMPARE(bounds[0].coneAxis, Vector3::zAxis());
+    CORRADE_COMPARE(bounds[0].coneCutoff, 0.0f);
+    CORRADE_COMPARE(bounds[0].coneApex, bounds[0].center);
+
+    /* Culled when looking from below, not culled when looking from above */
+    CORRADE_COMPARE_AS(Math::dot((bounds[0].coneApex - Vector3{0.25f, 0.25f, -5.0f}).normalized(), bounds[0].coneAxis),
+        bounds[0].coneCutoff,
+        TestSuite::Compare::Greater);
+    CORRADE_COMPARE_AS(Math::dot((bounds[0].coneApex - Vector3{0.25f, 0.25f, 5.0f}).normalized(), bounds[0].coneAxis),
+        bounds[0].coneCutoff,
+        TestSuite::Compare::LessOrEqual);
+}
+
+void GenerateMeshletsTest::generateMeshletBoundsCone() {
+    /* Two triangles forming a roof, with normals at 45° from +Z */
+    const Vector3 positions[]{
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 1.0f},
+        {1.0f, 1.0f, 1.0f},
+        {0.0f, 2.0f, 0.0f}
+    };
+    const UnsignedInt indices[]{
+        0, 1, 2,
+        2, 3, 4
+    };
+    Meshlets meshlets = MeshTools::generateMeshlets(Containers::stridedArrayView(indices), 5);
+    CORRADE_COMPARE(meshlets.meshlets.size(), 1);
+
+    Containers::Array<MeshletBounds> bounds = MeshTools::generateMeshletBounds(meshlets, positions);
+    CORRADE_COMPARE(bounds[0].coneAxis, Vector3::zAxis());
+    CORRADE_COMPARE(bounds[0].coneCutoff, Constants::sqrtHalf());
+
+    /* Culled when looking from far below, as both triangles face up */
+    CORRADE_COMPARE_AS(Math::dot((bounds[0].coneApex - Vector3{0.5f, 1.0f, -10.0f}).normalized(), bounds[0].coneAxis),
+        bounds[0].coneCutoff,
+        TestSuite::Compare::Greater);
+
+    /* Not culled when looking from the side where the first triangle is
+       front-facing */
+    CORRADE_COMPARE_AS(Math::dot((bounds[0].coneApex - Vector3{0.5f, -10.0f, 0.5f}).normalized(), bounds[0].coneAxis),
+        bounds[0].coneCutoff,
+        TestSuite::Compare::LessOrEqual);
+}
+
+void GenerateMeshletsTest::generateMeshletBoundsConeConcave() {
+    /* Two triangles forming a valley, with normals at 45° from +Z pointing
+       towards each other */
+    const Vector3 positions[]{
+        {0.0f, 0.0f, 1.0f},
+        {1.0f, 0.0f, 1.0f},
+        {0.0f, 1.0f, 0.0f},
+        {1.0f, 1.0f, 0.0f},
+        {0.0f, 2.0f, 1.0f}
+    };
+    const UnsignedInt indices[]{
+        0, 1, 2,
+        2, 3, 4
+    };
+    Meshlets meshlets = MeshTools::generateMeshlets(Containers::stridedArrayView(indices), 5);
+    CORRADE_COMPARE(meshlets.meshlets.size(), 1);
+
+    Containers::Array<MeshletBounds> bounds = MeshTools::generateMeshletBounds(meshlets, positions);
+    CORRADE_COMPARE(bounds[0].coneAxis, Vector3::zAxis());
+    CORRADE_COMPARE(bounds[0].coneCutoff, Constants::sqrtHalf());
+
+    /* The apex is behind or on both triangle planes, which for a valley is
+       at the bottom of it or below */
+    const Vector3 normals[]{
+        Vector3{0.0f, 1.0f, 1.0f}.normalized(),
+        Vector3{0.0f, -1.0f, 1.0f}.normalized()
+    };
+    CORRADE_COMPARE_AS(Math::dot(bounds[0].coneApex - positions[0], normals[0]),
+        1.0e-5f,
+        TestSuite::Compare::LessOrEqual);
+    CORRADE_COMPARE_AS(Math::dot(bounds[0].coneApex - positions[4], normals[1]),
+        1.0e-5f,
+        TestSuite::Compare::LessOrEqual);
+
+    /* Culled when looking from far below */
+    CORRADE_COMPARE_AS(Math::dot((bounds[0].coneApex - Vector3{0.5f, 1.0f, -10.0f}).normalized(), bounds[0].coneAxis),
+        bounds[0].coneCutoff,
+        TestSuite::Compare::Greater);
+
+    /* Not culled when looking from just above the bottom of the valley,
+       where both triangles are front-facing. With the apex placed in front of
+       the triangle planes this would be culled. */
+    CORRADE_COMPARE_AS(Math::dot((bounds[0].coneApex - Vector3{0.5f, 1.0f, 0.05f}).normalized(), bounds[0].coneAxis),
+        bounds[0].coneCutoff,
+        TestSuite::Compare::LessOrEqual);
+}
+
+void GenerateMeshletsTest::generateMeshletBoundsConeHemisphere() {
+    /* Triangles facing +X, -X and +Z, the cone would be a hemisphere */
+    const Vector3 positions[]{
+        {0.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f},
+        {0.0f, 0.0f, 1.0f},
+        {1.0f, 0.0f, 0.0f},
+    };
+    const UnsignedInt indices[]{
+        0, 1, 2, /* +X */
+        0, 2, 1, /* -X */
+        0, 3, 1  /* +Z */
+    };
+    Meshlets meshlets = MeshTools::generateMeshlets(Containers::stridedArrayView(indices), 4);
+    CORRADE_COMPARE(meshlets.meshlets.size(), 1);
+
+    Containers::Array<MeshletBounds> bounds = MeshTools::generateMeshletBounds(meshlets, positions);
+    CORRADE_COMPARE(bounds[0].coneAxis, Vector3::zAxis());
+    CORRADE_COMPARE(bounds[0].coneCutoff, 1.0f);
+    CORRADE_COMPARE(bounds[0].coneApex, bounds[0].center);
+}
+
+void GenerateMeshletsTest::generateMeshletBoundsConeOpposite() {
+    /* Two triangles facing opposite directions, the normals cancel out */
+    const Vector3 positions[]{
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f},
+    };
+    const UnsignedInt indices[]{
+        0, 1, 2,
+        0, 2, 1
+    };
+    Meshlets meshlets = MeshTools::generateMeshlets(Containers::stridedArrayView(indices), 3);
+
+    Containers::Array<MeshletBounds> bounds = MeshTools::generateMeshletBounds(meshlets, positions);
+    CORRADE_COMPARE(bounds[0].coneAxis, Vector3{});
+    CORRADE_COMPARE(bounds[0].coneCutoff, 1.0f);
+    CORRADE_COMPARE(bounds[0].coneApex, bounds[0].center);
+}
+
+void GenerateMeshletsTest::generateMeshletBoundsDegenerate() {
+    const Vector3 positions[]{
+        {1.0f, 2.0f, 3.0f},
+        {1.0f, 2.0f, 3.0f},
+    };
+    const UnsignedInt indices[]{0, 0, 1};
+    Meshlets meshlets = MeshTools::generateMeshlets(Containers::stridedArrayView(indices), 2);
+
+    Containers::Array<MeshletBounds> bounds = MeshTools::generateMeshletBounds(meshlets, positions);
+    CORRADE_COMPARE(bounds[0].center, (Vector3{1.0f, 2.0f, 3.0f}));
+    CORRADE_COMPARE(bounds[0].coneAxis, Vector3{});
+    CORRADE_COMPARE(bounds[0].coneCutoff, 1.0f);
+    CORRADE_COMPARE(bounds[0].coneApex, bounds[0].center);
+}
+
+void GenerateMeshletsTest::generateMeshletBoundsInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Vector3 positions[3]{};
+    const UnsignedInt indices[]{0, 1, 3};
+    Meshlets meshlets = MeshTools::generateMeshlets(Containers::stridedArrayView(indices), 4);
+    MeshletBounds bounds[2];
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::generateMeshletBoundsInto(meshlets, positions, bounds);
+    MeshTools::generateMeshletBounds(meshlets, positions);
+    CORRADE_COMPARE_AS(out,
+        "MeshTools::generateMeshletBoundsInto(): expected 1 items but got 2\n"
+        "MeshTools::generateMeshletBoundsInto(): vertex 3 out of range for 3 positions\n",
+        TestSuite::Compare::String);
+}
+
+void GenerateMeshletsTest::benchmarkGenerateMeshlets() {
+    /* About 130k triangles */
+    const Trade::MeshData grid = Primitives::grid3DSolid({255, 255}, {});
+    const Containers::Array<UnsignedInt> indices = grid.indicesAsArray();
+
+    Meshlets meshlets;
+    CORRADE_BENCHMARK(1)
+        meshlets = MeshTools::generateMeshlets(Containers::stridedArrayView(indices), grid.vertexCount());
+
+    CORRADE_COMPARE_AS(meshlets.meshlets.size(), indices.size()/3/124,
+        TestSuite::Compare::Greater);
+}
+
+void GenerateMeshletsTest::benchmarkGenerateMeshletBounds() {
+    const Trade::MeshData grid = Primitives::grid3DSolid({255, 255}, {});
+    const Containers::Array<UnsignedInt> indices = grid.indicesAsArray();
+    const Containers::Array<Vector3> positions = grid.positions3DAsArray();
+    const Meshlets meshlets = MeshTools::generateMeshlets(Containers::stridedArrayView(indices), grid.vertexCount());
+
+    Containers::Array<MeshletBounds> bounds{NoInit, meshlets.meshlets.size()};
+    CORRADE_BENCHMARK(1)
+        MeshTools::generateMeshletBoundsInto(meshlets, positions, bounds);
+
+    /* The grid is flat, facing +Z */
+    CORRADE_COMPARE(bounds[0].coneAxis, Vector3::zAxis());
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::GenerateMeshletsTest)
@@ -24,6 +24,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <type_traits>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/ArrayViewStl.h>
 #include <Corrade/Containers/StridedArrayView.h>
@@ -61,8 +62,36 @@ struct GenerateNormalsTest: TestSuite::Tester {
     void smoothErasedNonContiguous();
     void smoothErasedWrongIndexSize();
 
+    void smoothMultithreaded();
+
+    template<class T> void smoothAdjacency();
+    void smoothAdjacencyDeformed();
+    void smoothAdjacencyMultithreaded();
+    template<class T> void smoothAdjacencyErased();
+    void smoothAdjacencyNoCreate();
+    void smoothAdjacencyWrongCount();
+    void smoothAdjacencyOutOfRange();
+    void smoothAdjacencyErasedNonContiguous();
+    void smoothAdjacencyErasedWrongIndexSize();
+    void smoothAdjacencyWrongPositionCount();
+    void smoothAdjacencyIntoWrongSize();
+
     void benchmarkFlat();
     void benchmarkSmooth();
+    void benchmarkSmoothLarge();
+    void benchmarkSmoothLargeMultithreaded();
+    void benchmarkSmoothLargeAdjacency();
+    void benchmarkSmoothLargeAdjacencyMultithreaded();
+};
+
+const struct {
+    const char* name;
+    UnsignedInt threadCount;
+} MultithreadedData[] {
+    {"2 threads", 2},
+    {"3 threads", 3},
+    {"7 threads", 7},
+    {"all hardware threads", 0}
 };
 
 GenerateNormalsTest::GenerateNormalsTest() {
@@ -88,8 +117,35 @@ GenerateNormalsTest::GenerateNormalsTest() {
               &GenerateNormalsTest::smoothErasedNonContiguous,
               &GenerateNormalsTest::smoothErasedWrongIndexSize});
 
+    addInstancedTests({&GenerateNormalsTest::smoothMultithreaded},
+        Containers::arraySize(MultithreadedData));
+
+    addTests({&GenerateNormalsTest::smoothAdjacency<UnsignedByte>,
+              &GenerateNormalsTest::smoothAdjacency<UnsignedShort>,
+              &GenerateNormalsTest::smoothAdjacency<UnsignedInt>,
+              &GenerateNormalsTest::smoothAdjacencyDeformed});
+
+    addInstancedTests({&GenerateNormalsTest::smoothAdjacencyMultithreaded},
+        Containers::arraySize(MultithreadedData));
+
+    addTests({&GenerateNormalsTest::smoothAdjacencyErased<UnsignedByte>,
+              &GenerateNormalsTest::smoothAdjacencyErased<UnsignedShort>,
+              &GenerateNormalsTest::smoothAdjacencyErased<UnsignedInt>,
+              &GenerateNormalsTest::smoothAdjacencyNoCreate,
+              &GenerateNormalsTest::smoothAdjacencyWrongCount,
+              &GenerateNormalsTest::smoothAdjacencyOutOfRange,
+              &GenerateNormalsTest::smoothAdjacencyErasedNonContiguous,
+              &GenerateNormalsTest::smoothAdjacencyErasedWrongIndexSize,
+              &GenerateNormalsTest::smoothAdjacencyWrongPositionCount,
+              &GenerateNormalsTest::smoothAdjacencyIntoWrongSize});
+
     addBenchmarks({&GenerateNormalsTest::benchmarkFlat,
                    &GenerateNormalsTest::benchmarkSmooth}, 150);
+
+    addBenchmarks({&GenerateNormalsTest::benchmarkSmoothLarge,
+                   &GenerateNormalsTest::benchmarkSmoothLargeMultithreaded,
+                   &GenerateNormalsTest::benchmarkSmoothLargeAdjacency,
+                   &GenerateNormalsTest::benchmarkSmoothLargeAdjacencyMultithreaded}, 10);
 }
 
 /* Two vertices connected by one edge, each wound in another direction */
@@ -454,6 +510,279 @@ void GenerateNormalsTest::smoothErasedWrongIndexSize() {
         "MeshTools::generateSmoothNormalsInto(): expected index type size 1, 2 or 4 but got 3\n");
 }
 
+void GenerateNormalsTest::smoothMultithreaded() {
+    auto&& data = MultithreadedData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* The cap center vertices are shared by many triangles, so their
+       corners get scattered among threads when building the adjacency. The
+       output has to be exactly the same as with the serial variant
+       regardless of the thread count. */
+    const Trade::MeshData mesh = Primitives::cylinderSolid(7, 61, 1.0f, Primitives::CylinderFlag::CapEnds);
+    Containers::Array<Vector3> positions = mesh.positions3DAsArray();
+    /* Make it not a perfect cylinder */
+    for(std::size_t i = 0; i != positions.size(); ++i)
+        positions[i] += Vector3{0.01f}*Float(i % 5);
+
+    Containers::Array<Vector3> expected = generateSmoothNormals(mesh.indices(), positions);
+    Containers::Array<Vector3> actual = generateSmoothNormals(mesh.indices(), positions, data.threadCount);
+    CORRADE_COMPARE_AS(actual, expected,
+        TestSuite::Compare::Container);
+}
+
+template<class T> void GenerateNormalsTest::smoothAdjacency() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* Two triangles sharing an edge, with vertex 3 unused */
+    const T indices[]{0, 1, 2, 2, 1, 4};
+
+    SmoothNormalsAdjacency adjacency{indices, 5};
+    CORRADE_COMPARE(adjacency.vertexCount(), 5);
+    CORRADE_COMPARE_AS(adjacency.indices(), Containers::arrayView<UnsignedInt>({
+        0, 1, 2, 2, 1, 4
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(adjacency.offsets(), Containers::arrayView<UnsignedInt>({
+        0, 1, 3, 5, 5, 6
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(adjacency.corners(), Containers::arrayView<UnsignedInt>({
+        0,      /* vertex 0 */
+        1, 4,   /* vertex 1 */
+        2, 3,   /* vertex 2 */
+                /* vertex 3 */
+        5       /* vertex 4 */
+    }), TestSuite::Compare::Container);
+
+    const Vector3 positions[]{
+        {-1.0f, 0.0f, 0.0f},
+        {0.0f, -1.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f},
+        {},
+        {1.0f, 0.0f, 1.0f}
+    };
+    Containers::Array<Vector3> normals = generateSmoothNormals(adjacency, positions);
+    Containers::Array<Vector3> expected = generateSmoothNormals(indices, positions);
+    CORRADE_COMPARE(normals.size(), 5);
+    /* The unused vertex is a NaN in both cases, compare the rest */
+    CORRADE_VERIFY(Math::isNan(normals[3]).all());
+    CORRADE_VERIFY(Math::isNan(expected[3]).all());
+    CORRADE_COMPARE_AS(normals.prefix(3), expected.prefix(3),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(normals[4], expected[4]);
+}
+
+void GenerateNormalsTest::smoothAdjacencyDeformed() {
+    const Trade::MeshData mesh = Primitives::cylinderSolid(3, 17, 1.0f);
+    Containers::Array<Vector3> positions = mesh.positions3DAsArray();
+
+    SmoothNormalsAdjacency adjacency{mesh.indices(), positions.size()};
+
+    /* The same adjacency should give the same output as the variant taking
+       indices for every deformation of the mesh */
+    Containers::Array<Vector3> normals{NoInit, positions.size()};
+    for(Float amount: {0.0f, 0.5f, 1.0f}) {
+        CORRADE_ITERATION(amount);
+
+        Containers::Array<Vector3> deformed{NoInit, positions.size()};
+        for(std::size_t i = 0; i != positions.size(); ++i)
+            deformed[i] = positions[i]*Vector3{1.0f + amount*positions[i].y(), 1.0f, 1.0f};
+
+        generateSmoothNormalsInto(adjacency, deformed, normals);
+        CORRADE_COMPARE_AS(normals,
+            generateSmoothNormals(mesh.indices(), deformed),
+            TestSuite::Compare::Container);
+    }
+}
+
+void GenerateNormalsTest::smoothAdjacencyMultithreaded() {
+    auto&& data = MultithreadedData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Trade::MeshData mesh = Primitives::cylinderSolid(7, 61, 1.0f, Primitives::CylinderFlag::CapEnds);
+    Containers::Array<Vector3> positions = mesh.positions3DAsArray();
+
+    /* The adjacency built in parallel should be exactly the same */
+    SmoothNormalsAdjacency expected{mesh.indices(), positions.size()};
+    SmoothNormalsAdjacency actual{mesh.indices(), positions.size(), data.threadCount};
+    CORRADE_COMPARE(actual.vertexCount(), expected.vertexCount());
+    CORRADE_COMPARE_AS(actual.indices(), expected.indices(),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(actual.offsets(), expected.offsets(),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(actual.corners(), expected.corners(),
+        TestSuite::Compare::Container);
+
+    CORRADE_COMPARE_AS(generateSmoothNormals(actual, positions, data.threadCount),
+        generateSmoothNormals(mesh.indices(), positions),
+        TestSuite::Compare::Container);
+}
+
+template<class T> void GenerateNormalsTest::smoothAdjacencyErased() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    const T indices[]{0, 1, 2, 3, 4, 5};
+
+    SmoothNormalsAdjacency adjacency{Containers::arrayCast<2, const char>(Containers::stridedArrayView(indices)), 6};
+    CORRADE_COMPARE_AS(adjacency.indices(), Containers::arrayView<UnsignedInt>({
+        0, 1, 2, 3, 4, 5
+    }), TestSuite::Compare::Container);
+
+    /* Should generate the same output as flat normals */
+    CORRADE_COMPARE_AS(generateSmoothNormals(adjacency, TwoTriangles),
+        Containers::arrayView<Vector3>({
+            Vector3::zAxis(),
+            Vector3::zAxis(),
+            Vector3::zAxis(),
+            -Vector3::zAxis(),
+            -Vector3::zAxis(),
+            -Vector3::zAxis()
+        }), TestSuite::Compare::Container);
+}
+
+void GenerateNormalsTest::smoothAdjacencyNoCreate() {
+    SmoothNormalsAdjacency adjacency{NoCreate};
+    CORRADE_COMPARE(adjacency.vertexCount(), 0);
+    CORRADE_VERIFY(adjacency.indices().isEmpty());
+    CORRADE_VERIFY(adjacency.offsets().isEmpty());
+    CORRADE_VERIFY(adjacency.corners().isEmpty());
+
+    /* It should be usable, producing no output */
+    CORRADE_VERIFY(generateSmoothNormals(adjacency, nullptr).isEmpty());
+
+    /* Not copyable, only movable */
+    CORRADE_VERIFY(!std::is_copy_constructible<SmoothNormalsAdjacency>::value);
+    CORRADE_VERIFY(!std::is_copy_assignable<SmoothNormalsAdjacency>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<SmoothNormalsAdjacency>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<SmoothNormalsAdjacency>::value);
+}
+
+void GenerateNormalsTest::smoothAdjacencyWrongCount() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Containers::String out;
+    Error redirectError{&out};
+
+    const UnsignedByte indices[7]{};
+    SmoothNormalsAdjacency{indices, 1};
+    CORRADE_COMPARE(out, "MeshTools::SmoothNormalsAdjacency: index count not divisible by 3\n");
+}
+
+void GenerateNormalsTest::smoothAdjacencyOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Containers::String out;
+    Error redirectError{&out};
+
+    const UnsignedInt indices[] { 0, 1, 2 };
+    SmoothNormalsAdjacency{indices, 2};
+    CORRADE_COMPARE(out, "MeshTools::SmoothNormalsAdjacency: index 2 out of range for 2 vertices\n");
+}
+
+void GenerateNormalsTest::smoothAdjacencyErasedNonContiguous() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const char indices[6*4]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    SmoothNormalsAdjacency{Containers::StridedArrayView2D<const char>{indices, {6, 2}, {4, 2}}, 3};
+    CORRADE_COMPARE(out,
+        "MeshTools::SmoothNormalsAdjacency: second index view dimension is not contiguous\n");
+}
+
+void GenerateNormalsTest::smoothAdjacencyErasedWrongIndexSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const char indices[6*3]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    SmoothNormalsAdjacency{Containers::StridedArrayView2D<const char>{indices, {6, 3}}.every(2), 3};
+    CORRADE_COMPARE(out,
+        "MeshTools::SmoothNormalsAdjacency: expected index type size 1, 2 or 4 but got 3\n");
+}
+
+void GenerateNormalsTest::smoothAdjacencyWrongPositionCount() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const UnsignedByte indices[]{0, 1, 2};
+    SmoothNormalsAdjacency adjacency{indices, 3};
+
+    Containers::String out;
+    Error redirectError{&out};
+    const Vector3 positions[4];
+    generateSmoothNormals(adjacency, positions);
+    CORRADE_COMPARE(out, "MeshTools::generateSmoothNormalsInto(): expected 3 positions but got 4\n");
+}
+
+void GenerateNormalsTest::smoothAdjacencyIntoWrongSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const UnsignedByte indices[]{0, 1, 2};
+    SmoothNormalsAdjacency adjacency{indices, 3};
+
+    Containers::String out;
+    Error redirectError{&out};
+    const Vector3 positions[3];
+    Vector3 normals[4];
+    generateSmoothNormalsInto(adjacency, positions, normals);
+    CORRADE_COMPARE(out, "MeshTools::generateSmoothNormalsInto(): bad output size, expected 3 but got 4\n");
+}
+
+/* About 100k vertices, with the cap centers shared by a thousand triangles */
+Trade::MeshData largeMesh() {
+    return Primitives::cylinderSolid(100, 1000, 1.0f, Primitives::CylinderFlag::CapEnds);
+}
+
+void GenerateNormalsTest::benchmarkSmoothLarge() {
+    const Trade::MeshData mesh = largeMesh();
+    Containers::Array<Vector3> positions = mesh.positions3DAsArray();
+
+    Containers::Array<Vector3> normals{NoInit, positions.size()};
+    CORRADE_BENCHMARK(1) {
+        generateSmoothNormalsInto(mesh.indices(), positions, normals);
+    }
+
+    CORRADE_COMPARE(normals[0], mesh.attribute<Vector3>(Trade::MeshAttribute::Normal)[0]);
+}
+
+void GenerateNormalsTest::benchmarkSmoothLargeMultithreaded() {
+    const Trade::MeshData mesh = largeMesh();
+    Containers::Array<Vector3> positions = mesh.positions3DAsArray();
+
+    Containers::Array<Vector3> normals{NoInit, positions.size()};
+    CORRADE_BENCHMARK(1) {
+        generateSmoothNormalsInto(mesh.indices(), positions, normals, 0);
+    }
+
+    CORRADE_COMPARE(normals[0], mesh.attribute<Vector3>(Trade::MeshAttribute::Normal)[0]);
+}
+
+void GenerateNormalsTest::benchmarkSmoothLargeAdjacency() {
+    const Trade::MeshData mesh = largeMesh();
+    Containers::Array<Vector3> positions = mesh.positions3DAsArray();
+    SmoothNormalsAdjacency adjacency{mesh.indices(), positions.size()};
+
+    Containers::Array<Vector3> normals{NoInit, positions.size()};
+    CORRADE_BENCHMARK(1) {
+        generateSmoothNormalsInto(adjacency, positions, normals);
+    }
+
+    CORRADE_COMPARE(normals[0], mesh.attribute<Vector3>(Trade::MeshAttribute::Normal)[0]);
+}
+
+void GenerateNormalsTest::benchmarkSmoothLargeAdjacencyMultithreaded() {
+    const Trade::MeshData mesh = largeMesh();
+    Containers::Array<Vector3> positions = mesh.positions3DAsArray();
+    SmoothNormalsAdjacency adjacency{mesh.indices(), positions.size(), 0};
+
+    Containers::Array<Vector3> normals{NoInit, positions.size()};
+    CORRADE_BENCHMARK(1) {
+        generateSmoothNormalsInto(adjacency, positions, normals, 0);
+    }
+
+    CORRADE_COMPARE(normals[0], mesh.attribute<Vector3>(Trade::MeshAttribute::Normal)[0]);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::GenerateNormalsTest)
@@ -0,0 +1,504 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm> /* std::sort() */
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/TestSuite/Compare/String.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Math/TypeTraits.h"
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/MeshTools/Optimize.h"
+#include "Magnum/Primitives/Grid.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct OptimizeTest: TestSuite::Tester {
+    explicit OptimizeTest();
+
+    template<class T> void optimizeVertexCache();
+    void optimizeVertexCacheEmpty();
+    void optimizeVertexCacheDegenerate();
+    void optimizeVertexCacheInvalid();
+
+    template<class T> void optimizeOverdraw();
+    void optimizeOverdrawFlat();
+    void optimizeOverdrawEmpty();
+    void optimizeOverdrawInvalid();
+
+    template<class T> void optimizeVertexFetch();
+    template<class T> void optimizeVertexFetchErased();
+    void optimizeVertexFetchShuffled();
+    void optimizeVertexFetchNonContiguous();
+    void optimizeVertexFetchIndexOutOfRange();
+    void optimizeVertexFetchErasedNonContiguous();
+    void optimizeVertexFetchErasedWrongIndexSize();
+
+    template<class T> void analyzeVertexCache();
+    void analyzeVertexCacheEmpty();
+    void analyzeVertexCacheInvalid();
+
+    template<class T> void analyzeVertexFetch();
+    void analyzeVertexFetchEmpty();
+    void analyzeVertexFetchInvalid();
+};
+
+OptimizeTest::OptimizeTest() {
+    addTests({&OptimizeTest::optimizeVertexCache<UnsignedByte>,
+              &OptimizeTest::optimizeVertexCache<UnsignedShort>,
+              &OptimizeTest::optimizeVertexCache<UnsignedInt>,
+              &OptimizeTest::optimizeVertexCacheEmpty,
+              &OptimizeTest::optimizeVertexCacheDegenerate,
+              &OptimizeTest::optimizeVertexCacheInvalid,
+
+              &OptimizeTest::optimizeOverdraw<UnsignedByte>,
+              &OptimizeTest::optimizeOverdraw<UnsignedShort>,
+              &OptimizeTest::optimizeOverdraw<UnsignedInt>,
+              &OptimizeTest::optimizeOverdrawFlat,
+              &OptimizeTest::optimizeOverdrawEmpty,
+              &OptimizeTest::optimizeOverdrawInvalid,
+
+              &OptimizeTest::optimizeVertexFetch<UnsignedByte>,
+              &OptimizeTest::optimizeVertexFetch<UnsignedShort>,
+              &OptimizeTest::optimizeVertexFetch<UnsignedInt>,
+              &OptimizeTest::optimizeVertexFetchErased<UnsignedByte>,
+              &OptimizeTest::optimizeVertexFetchErased<UnsignedShort>,
+              &OptimizeTest::optimizeVertexFetchErased<UnsignedInt>,
+              &OptimizeTest::optimizeVertexFetchShuffled,
+              &OptimizeTest::optimizeVertexFetchNonContiguous,
+              &OptimizeTest::optimizeVertexFetchIndexOutOfRange,
+              &OptimizeTest::optimizeVertexFetchErasedNonContiguous,
+              &OptimizeTest::optimizeVertexFetchErasedWrongIndexSize,
+
+              &OptimizeTest::analyzeVertexCache<UnsignedByte>,
+              &OptimizeTest::analyzeVertexCache<UnsignedShort>,
+              &OptimizeTest::analyzeVertexCache<UnsignedInt>,
+              &OptimizeTest::analyzeVertexCacheEmpty,
+              &OptimizeTest::analyzeVertexCacheInvalid,
+
+              &OptimizeTest::analyzeVertexFetch<UnsignedByte>,
+              &OptimizeTest::analyzeVertexFetch<UnsignedShort>,
+              &OptimizeTest::analyzeVertexFetch<UnsignedInt>,
+              &OptimizeTest::analyzeVertexFetchEmpty,
+              &OptimizeTest::analyzeVertexFetchInvalid});
+}
+
+/* A grid with triangles and optionally also vertices shuffled in a
+   deterministic way. The primes are expected to be coprime with the triangle
+   and vertex count. */
+template<class T> Containers::Array<T> shuffledGrid(const Vector2i& subdivisions, const UnsignedInt trianglePrime, const UnsignedInt vertexPrime, UnsignedInt& vertexCount) {
+    const Trade::MeshData grid = Primitives::grid3DSolid(subdivisions, {});
+    const Containers::Array<UnsignedInt> indices = grid.indicesAsArray();
+    vertexCount = grid.vertexCount();
+
+    const std::size_t triangleCount = indices.size()/3;
+    Containers::Array<T> out{NoInit, indices.size()};
+    for(std::size_t i = 0; i != triangleCount; ++i) {
+        const std::size_t triangle = (i*trianglePrime) % triangleCount;
+        for(std::size_t j = 0; j != 3; ++j)
+            out[triangle*3 + j] = T((std::size_t(indices[i*3 + j])*vertexPrime) % vertexCount);
+    }
+
+    return out;
+}
+
+/* Triangles sorted lexicographically, for checking that the optimizations
+   only reorder the triangles */
+template<class T> Containers::Array<Vector3ui> sortedTriangles(const Containers::ArrayView<const T> indices) {
+    Containers::Array<Vector3ui> out{NoInit, indices.size()/3};
+    for(std::size_t i = 0; i != out.size(); ++i)
+        out[i] = {indices[i*3 + 0], indices[i*3 + 1], indices[i*3 + 2]};
+    std::sort(out.begin(), out.end(), [](const Vector3ui& a, const Vector3ui& b) {
+        if(a.x() != b.x()) return a.x() < b.x();
+        if(a.y() != b.y()) return a.y() < b.y();
+        return a.z() < b.z();
+    });
+    return out;
+}
+
+template<class T> void OptimizeTest::optimizeVertexCache() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* 392 triangles, 225 vertices, so it fits into 8-bit indices */
+    UnsignedInt vertexCount;
+    Containers::Array<T> indices = shuffledGrid<T>({13, 13}, 97, 1, vertexCount);
+    const Containers::Array<Vector3ui> triangles = sortedTriangles<T>(indices);
+
+    /* Each triangle is a cache miss in the shuffled input */
+    VertexCacheStatistics before = MeshTools::analyzeVertexCache(Containers::stridedArrayView(indices), vertexCount, 16);
+    CORRADE_COMPARE(before.acmr, 3.0f);
+
+    MeshTools::optimizeVertexCacheInPlace(Containers::stridedArrayView(indices), vertexCount);
+
+    /* The triangles are only reordered */
+    CORRADE_COMPARE_AS(sortedTriangles<T>(indices), triangles,
+        TestSuite::Compare::Container);
+
+    /* The result is close to the lower bound, which is about 0.57 for this
+       grid, and slightly better than what tipsifyInPlace() gives, which is
+       about 0.70 */
+    VertexCacheStatistics after = MeshTools::analyzeVertexCache(Containers::stridedArrayView(indices), vertexCount, 16);
+    CORRADE_COMPARE_AS(after.acmr, 0.75f, TestSuite::Compare::Less);
+    CORRADE_COMPARE_AS(after.atvr, 1.3f, TestSuite::Compare::Less);
+}
+
+void OptimizeTest::optimizeVertexCacheEmpty() {
+    /* Shouldn't crash or do anything weird */
+    MeshTools::optimizeVertexCacheInPlace(Containers::StridedArrayView1D<UnsignedInt>{}, 0);
+    CORRADE_VERIFY(true);
+}
+
+void OptimizeTest::optimizeVertexCacheDegenerate() {
+    UnsignedInt indices[]{
+        0, 0, 0,
+        1, 2, 2,
+        2, 1, 3
+    };
+    MeshTools::optimizeVertexCacheInPlace(Containers::stridedArrayView(indices), 4);
+
+    /* The degenerate triangles are preserved. The last triangle has the
+       highest score because vertex 3 isn't used anywhere else, the second
+       shares vertices with it and the first is disconnected. */
+    CORRADE_COMPARE_AS(Containers::arrayView(indices), Containers::arrayView<UnsignedInt>({
+        2, 1, 3,
+        1, 2, 2,
+        0, 0, 0
+    }), TestSuite::Compare::Container);
+}
+
+void OptimizeTest::optimizeVertexCacheInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    UnsignedInt indices[]{0, 1, 2, 2, 1, 3};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::optimizeVertexCacheInPlace(Containers::stridedArrayView(indices).exceptSuffix(1), 4);
+    MeshTools::optimizeVertexCacheInPlace(Containers::stridedArrayView(indices), 4, 3);
+    MeshTools::optimizeVertexCacheInPlace(Containers::stridedArrayView(indices), 3);
+    CORRADE_COMPARE_AS(out,
+        "MeshTools::optimizeVertexCacheInPlace(): index count not divisible by 3\n"
+        "MeshTools::optimizeVertexCacheInPlace(): expected cache size larger than 3 but got 3\n"
+        "MeshTools::optimizeVertexCacheInPlace(): index 3 out of range for 3 vertices\n",
+        TestSuite::Compare::String);
+}
+
+template<class T> void OptimizeTest::optimizeOverdraw() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* Two triangles with a normal pointing to -Z, the first one in front of
+       the second when looking from -Z. As the first triangle is facing
+       inwards from the mesh center and the second outwards, the second should
+       be drawn first. */
+    const Vector3 positions[]{
+        {0.0f, 0.0f, 1.0f},
+        {0.0f, 1.0f, 1.0f},
+        {1.0f, 0.0f, 1.0f},
+        {0.0f, 0.0f, -1.0f},
+        {0.0f, 1.0f, -1.0f},
+        {1.0f, 0.0f, -1.0f},
+    };
+    T indices[]{
+        0, 1, 2,
+        3, 4, 5
+    };
+    MeshTools::optimizeOverdrawInPlace(Containers::stridedArrayView(indices), positions);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices), Containers::arrayView<T>({
+        3, 4, 5,
+        0, 1, 2
+    }), TestSuite::Compare::Container);
+}
+
+void OptimizeTest::optimizeOverdrawFlat() {
+    const Trade::MeshData grid = Primitives::grid3DSolid({13, 13}, {});
+    const Containers::Array<Vector3> positions = grid.positions3DAsArray();
+    Containers::Array<UnsignedInt> indices = grid.indicesAsArray();
+    MeshTools::optimizeVertexCacheInPlace(Containers::stridedArrayView(indices), grid.vertexCount());
+
+    /* All clusters in a flat mesh have the same sort key, so the order
+       should stay the same */
+    Containers::Array<UnsignedInt> expected{NoInit, indices.size()};
+    Utility::copy(indices, expected);
+    MeshTools::optimizeOverdrawInPlace(Containers::stridedArrayView(indices), positions);
+    CORRADE_COMPARE_AS(indices, expected, TestSuite::Compare::Container);
+}
+
+void OptimizeTest::optimizeOverdrawEmpty() {
+    /* Shouldn't crash or do anything weird */
+    MeshTools::optimizeOverdrawInPlace(Containers::StridedArrayView1D<UnsignedInt>{}, nullptr);
+    CORRADE_VERIFY(true);
+}
+
+void OptimizeTest::optimizeOverdrawInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    UnsignedInt indices[]{0, 1, 2, 2, 1, 3};
+    const Vector3 positions[3]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::optimizeOverdrawInPlace(Containers::stridedArrayView(indices).exceptSuffix(1), positions);
+    MeshTools::optimizeOverdrawInPlace(Containers::stridedArrayView(indices), positions);
+    CORRADE_COMPARE_AS(out,
+        "MeshTools::optimizeOverdrawInPlace(): index count not divisible by 3\n"
+        "MeshTools::optimizeOverdrawInPlace(): index 3 out of range for 3 vertices\n",
+        TestSuite::Compare::String);
+}
+
+template<class T> void OptimizeTest::optimizeVertexFetch() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* Vertex 2 is not used */
+    T indices[]{3, 1, 3, 0, 1, 4};
+    Int data[]{10, 11, 12, 13, 14};
+
+    CORRADE_COMPARE(MeshTools::optimizeVertexFetchIndexedInPlace(
+        Containers::stridedArrayView(indices),
+        Containers::arrayCast<2, char>(Containers::stridedArrayView(data))), 4);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices), Containers::arrayView<T>({
+        0, 1, 0, 2, 1, 3
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(data).prefix(4), Containers::arrayView<Int>({
+        13, 11, 10, 14
+    }), TestSuite::Compare::Container);
+}
+
+template<class T> void OptimizeTest::optimizeVertexFetchErased() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    T indices[]{3, 1, 3, 0, 1, 4};
+    Int data[]{10, 11, 12, 13, 14};
+
+    CORRADE_COMPARE(MeshTools::optimizeVertexFetchIndexedInPlace(
+        Containers::arrayCast<2, char>(Containers::stridedArrayView(indices)),
+        Containers::arrayCast<2, char>(Containers::stridedArrayView(data))), 4);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices), Containers::arrayView<T>({
+        0, 1, 0, 2, 1, 3
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(data).prefix(4), Containers::arrayView<Int>({
+        13, 11, 10, 14
+    }), TestSuite::Compare::Container);
+}
+
+void OptimizeTest::optimizeVertexFetchShuffled() {
+    /* Large enough grid with shuffled vertices to not fit into the simulated
+       cache */
+    UnsignedInt vertexCount;
+    Containers::Array<UnsignedInt> indices = shuffledGrid<UnsignedInt>({63, 63}, 1009, 1013, vertexCount);
+    MeshTools::optimizeVertexCacheInPlace(Containers::stridedArrayView(indices), vertexCount);
+
+    Containers::Array<Vector4d> data{NoInit, vertexCount};
+    for(std::size_t i = 0; i != data.size(); ++i)
+        data[i] = Vector4d{Double(i)};
+
+    const VertexCacheStatistics cacheBefore = MeshTools::analyzeVertexCache(Containers::stridedArrayView(indices), vertexCount, 16);
+    const VertexFetchStatistics fetchBefore = MeshTools::analyzeVertexFetch(Containers::stridedArrayView(indices), vertexCount, sizeof(Vector4d));
+    CORRADE_COMPARE_AS(fetchBefore.overfetch, 2.0f, TestSuite::Compare::Greater);
+
+    /* Every vertex is used, remember the original vertex for each index */
+    Containers::Array<Double> original{NoInit, indices.size()};
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        original[i] = data[indices[i]].x();
+
+    CORRADE_COMPARE(MeshTools::optimizeVertexFetchIndexedInPlace(
+        Containers::stridedArrayView(indices),
+        Containers::arrayCast<2, char>(Containers::stridedArrayView(data))), vertexCount);
+
+    /* The indices still reference the same data */
+    for(std::size_t i = 0; i != indices.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(data[indices[i]].x(), original[i]);
+    }
+
+    /* Cache efficiency stays the same, overfetch gets significantly lower */
+    const VertexCacheStatistics cacheAfter = MeshTools::analyzeVertexCache(Containers::stridedArrayView(indices), vertexCount, 16);
+    const VertexFetchStatistics fetchAfter = MeshTools::analyzeVertexFetch(Containers::stridedArrayView(indices), vertexCount, sizeof(Vector4d));
+    CORRADE_COMPARE(cacheAfter.vertexTransformCount, cacheBefore.vertexTransformCount);
+    CORRADE_COMPARE_AS(fetchAfter.overfetch, 1.5f, TestSuite::Compare::Less);
+}
+
+void OptimizeTest::optimizeVertexFetchNonContiguous() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    UnsignedInt indices[]{0, 1, 2};
+    Int data[8]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::optimizeVertexFetchIndexedInPlace(
+        Containers::stridedArrayView(indices),
+        Containers::arrayCast<2, char>(Containers::arrayView(data)).every({1, 2}));
+    CORRADE_COMPARE(out,
+        "MeshTools::optimizeVertexFetchIndexedInPlace(): second data view dimension is not contiguous\n");
+}
+
+void OptimizeTest::optimizeVertexFetchIndexOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    UnsignedInt indices[]{0, 1, 5};
+    Int data[5]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::optimizeVertexFetchIndexedInPlace(
+        Containers::stridedArrayView(indices),
+        Containers::arrayCast<2, char>(Containers::stridedArrayView(data)));
+    CORRADE_COMPARE(out,
+        "MeshTools::optimizeVertexFetchIndexedInPlace(): index 5 out of range for 5 elements\n");
+
+    /* The indices should stay untouched on failure */
+    CORRADE_COMPARE_AS(Containers::arrayView(indices), Containers::arrayView<UnsignedInt>({
+        0, 1, 5
+    }), TestSuite::Compare::Container);
+}
+
+void OptimizeTest::optimizeVertexFetchErasedNonContiguous() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char indices[6*4]{};
+    Int data[1]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::optimizeVertexFetchIndexedInPlace(
+        Containers::StridedArrayView2D<char>{indices, {6, 2}, {4, 2}},
+        Containers::arrayCast<2, char>(Containers::stridedArrayView(data)));
+    CORRADE_COMPARE(out,
+        "MeshTools::optimizeVertexFetchIndexedInPlace(): second index view dimension is not contiguous\n");
+}
+
+void OptimizeTest::optimizeVertexFetchErasedWrongIndexSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char indices[6*3]{};
+    Int data[1]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::optimizeVertexFetchIndexedInPlace(
+        Containers::StridedArrayView2D<char>{indices, {6, 3}},
+        Containers::arrayCast<2, char>(Containers::stridedArrayView(data)));
+    CORRADE_COMPARE(out,
+        "MeshTools::optimizeVertexFetchIndexedInPlace(): expected index type size 1, 2 or 4 but got 3\n");
+}
+
+template<class T> void OptimizeTest::analyzeVertexCache() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    const T indices[]{
+        0, 1, 2,
+        3, 4, 5,
+        0, 1, 2
+    };
+
+    /* With a cache of three the first triangle gets evicted by the second */
+    VertexCacheStatistics small = MeshTools::analyzeVertexCache(Containers::stridedArrayView(indices), 7, 3);
+    CORRADE_COMPARE(small.vertexTransformCount, 9);
+    CORRADE_COMPARE(small.acmr, 3.0f);
+    CORRADE_COMPARE(small.atvr, 1.5f);
+
+    /* With a larger cache it's still there. Vertex 6 is not referenced and
+       thus doesn't count. */
+    VertexCacheStatistics large = MeshTools::analyzeVertexCache(Containers::stridedArrayView(indices), 7, 16);
+    CORRADE_COMPARE(large.vertexTransformCount, 6);
+    CORRADE_COMPARE(large.acmr, 2.0f);
+    CORRADE_COMPARE(large.atvr, 1.0f);
+}
+
+void OptimizeTest::analyzeVertexCacheEmpty() {
+    VertexCacheStatistics out = MeshTools::analyzeVertexCache(Containers::StridedArrayView1D<const UnsignedInt>{}, 5);
+    CORRADE_COMPARE(out.vertexTransformCount, 0);
+    CORRADE_COMPARE(out.acmr, 0.0f);
+    CORRADE_COMPARE(out.atvr, 0.0f);
+}
+
+void OptimizeTest::analyzeVertexCacheInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const UnsignedInt indices[]{0, 1, 2, 2, 1, 3};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::analyzeVertexCache(Containers::stridedArrayView(indices).exceptSuffix(1), 4);
+    MeshTools::analyzeVertexCache(Containers::stridedArrayView(indices), 3);
+    CORRADE_COMPARE_AS(out,
+        "MeshTools::analyzeVertexCache(): index count not divisible by 3\n"
+        "MeshTools::analyzeVertexCache(): index 3 out of range for 3 vertices\n",
+        TestSuite::Compare::String);
+}
+
+template<class T> void OptimizeTest::analyzeVertexFetch() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* 16-byte vertices, so four of them fit into a single cache line */
+    const T linear[]{0, 1, 2, 3, 4, 5, 6, 7, 0};
+    VertexFetchStatistics linearStatistics = MeshTools::analyzeVertexFetch(Containers::stridedArrayView(linear), 8, 16);
+    CORRADE_COMPARE(linearStatistics.bytesFetched, 128);
+    CORRADE_COMPARE(linearStatistics.overfetch, 1.0f);
+
+    /* Two vertices in different cache lines, each fetched just once */
+    const T sparse[]{0, 7, 0};
+    VertexFetchStatistics sparseStatistics = MeshTools::analyzeVertexFetch(Containers::stridedArrayView(sparse), 8, 16);
+    CORRADE_COMPARE(sparseStatistics.bytesFetched, 128);
+    CORRADE_COMPARE(sparseStatistics.overfetch, 4.0f);
+
+    /* A vertex spanning two cache lines */
+    const T spanning[]{1};
+    VertexFetchStatistics spanningStatistics = MeshTools::analyzeVertexFetch(Containers::stridedArrayView(spanning), 2, 48);
+    CORRADE_COMPARE(spanningStatistics.bytesFetched, 128);
+    CORRADE_COMPARE(spanningStatistics.overfetch, 128.0f/48.0f);
+}
+
+void OptimizeTest::analyzeVertexFetchEmpty() {
+    VertexFetchStatistics out = MeshTools::analyzeVertexFetch(Containers::StridedArrayView1D<const UnsignedInt>{}, 5, 16);
+    CORRADE_COMPARE(out.bytesFetched, 0);
+    CORRADE_COMPARE(out.overfetch, 0.0f);
+}
+
+void OptimizeTest::analyzeVertexFetchInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const UnsignedInt indices[]{0, 1, 2};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::analyzeVertexFetch(Containers::stridedArrayView(indices), 3, 0);
+    MeshTools::analyzeVertexFetch(Containers::stridedArrayView(indices), 2, 16);
+    CORRADE_COMPARE_AS(out,
+        "MeshTools::analyzeVertexFetch(): expected non-zero vertex size\n"
+        "MeshTools::analyzeVertexFetch(): index 2 out of range for 2 vertices\n",
+        TestSuite::Compare::String);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::OptimizeTest)
@@ -25,12 +25,17 @@
 */
 
 #include <algorithm> /* std::shuffle() */
+#include <cstring>
 #include <random> /* random device for std::shuffle() */
+#include <unordered_map>
 #include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/MurmurHash2.h>
 
 #include "Magnum/Math/Vector3.h"
 #include "Magnum/MeshTools/RemoveDuplicates.h"
@@ -68,6 +73,8 @@ struct RemoveDuplicatesTest: TestSuite::Tester {
     template<class IndexType, class T> void removeDuplicatesFuzzyIndexedInPlaceErased();
     void removeDuplicatesFuzzyIndexedInPlaceErasedNonContiguous();
     void removeDuplicatesFuzzyIndexedInPlaceErasedWrongIndexSize();
+    template<class T> void removeDuplicatesFuzzyIndexedInPlaceMultithreaded();
+    template<class T> void removeDuplicatesFuzzyIndexedInPlaceMultithreadedFewUnique();
 
     /* this is additionally regression-tested in PrimitivesIcosphereTest */
 
@@ -88,6 +95,20 @@ struct RemoveDuplicatesTest: TestSuite::Tester {
 
     void benchmark();
     void benchmarkFuzzy();
+    void benchmarkManyUnique();
+    void benchmarkManyUniqueStl();
+    void benchmarkManyUniqueFuzzy();
+    void benchmarkManyUniqueFuzzyMultithreaded();
+};
+
+const struct {
+    const char* name;
+    UnsignedInt threadCount;
+} MultithreadedData[] {
+    {"2 threads", 2},
+    {"3 threads", 3},
+    {"7 threads", 7},
+    {"all hardware threads", 0}
 };
 
 const struct {
@@ -239,6 +260,13 @@ RemoveDuplicatesTest::RemoveDuplicatesTest() {
               &RemoveDuplicatesTest::removeDuplicatesFuzzyIndexedInPlaceErasedNonContiguous,
               &RemoveDuplicatesTest::removeDuplicatesFuzzyIndexedInPlaceErasedWrongIndexSize});
 
+    addInstancedTests<RemoveDuplicatesTest>({
+        &RemoveDuplicatesTest::removeDuplicatesFuzzyIndexedInPlaceMultithreaded<Float>,
+        &RemoveDuplicatesTest::removeDuplicatesFuzzyIndexedInPlaceMultithreaded<Double>,
+        &RemoveDuplicatesTest::removeDuplicatesFuzzyIndexedInPlaceMultithreadedFewUnique<Float>,
+        &RemoveDuplicatesTest::removeDuplicatesFuzzyIndexedInPlaceMultithreadedFewUnique<Double>},
+        Containers::arraySize(MultithreadedData));
+
     addInstancedTests({&RemoveDuplicatesTest::removeDuplicatesMeshData},
         Containers::arraySize(RemoveDuplicatesMeshDataData));
 
@@ -261,7 +289,11 @@ RemoveDuplicatesTest::RemoveDuplicatesTest() {
                       &RemoveDuplicatesTest::soakTestFuzzy}, 10);
 
     addBenchmarks({&RemoveDuplicatesTest::benchmark,
-                   &RemoveDuplicatesTest::benchmarkFuzzy}, 10);
+                   &RemoveDuplicatesTest::benchmarkFuzzy,
+                   &RemoveDuplicatesTest::benchmarkManyUnique,
+                   &RemoveDuplicatesTest::benchmarkManyUniqueStl,
+                   &RemoveDuplicatesTest::benchmarkManyUniqueFuzzy,
+                   &RemoveDuplicatesTest::benchmarkManyUniqueFuzzyMultithreaded}, 10);
 }
 
 void RemoveDuplicatesTest::removeDuplicates() {
@@ -632,6 +664,73 @@ void RemoveDuplicatesTest::removeDuplicatesFuzzyIndexedInPlaceErasedWrongIndexSi
         "MeshTools::removeDuplicatesFuzzyIndexedInPlace(): expected index type size 1, 2 or 4 but got 3\n");
 }
 
+template<class T> void RemoveDuplicatesTest::removeDuplicatesFuzzyIndexedInPlaceMultithreaded() {
+    auto&& data = MultithreadedData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* A grid of points with a bit of noise so there's a lot of points sharing
+       the same bucket in some passes but not in others. The output has to be
+       the same as with the serial variant regardless of the thread count. */
+    Containers::Array<Math::Vector3<T>> vertices{NoInit, 10000};
+    for(std::size_t i = 0; i != vertices.size(); ++i) {
+        vertices[i] = {T(i%17), T((i*7)%23), T((i*13)%5)};
+        vertices[i] += Math::Vector3<T>{T(0.001)}*T(i%3);
+    }
+    Containers::Array<UnsignedInt> indices{NoInit, vertices.size()*2};
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        indices[i] = (i*31)%vertices.size();
+
+    Containers::Array<Math::Vector3<T>> expectedVertices{NoInit, vertices.size()};
+    Containers::Array<UnsignedInt> expectedIndices{NoInit, indices.size()};
+    Utility::copy(vertices, expectedVertices);
+    Utility::copy(indices, expectedIndices);
+    std::size_t expectedCount = MeshTools::removeDuplicatesFuzzyIndexedInPlace(
+        Containers::stridedArrayView(expectedIndices),
+        Containers::arrayCast<2, T>(Containers::stridedArrayView(expectedVertices)),
+        T(0.01));
+    /* Verify the data are actually interesting */
+    CORRADE_COMPARE_AS(expectedCount, std::size_t{5000},
+        TestSuite::Compare::Less);
+    CORRADE_COMPARE_AS(expectedCount, std::size_t{1000},
+        TestSuite::Compare::Greater);
+
+    std::size_t count = MeshTools::removeDuplicatesFuzzyIndexedInPlace(
+        Containers::stridedArrayView(indices),
+        Containers::arrayCast<2, T>(Containers::stridedArrayView(vertices)),
+        T(0.01), data.threadCount);
+    CORRADE_COMPARE(count, expectedCount);
+    CORRADE_COMPARE_AS(indices,
+        expectedIndices,
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(vertices.prefix(count),
+        expectedVertices.prefix(count),
+        TestSuite::Compare::Container);
+}
+
+template<class T> void RemoveDuplicatesTest::removeDuplicatesFuzzyIndexedInPlaceMultithreadedFewUnique() {
+    auto&& data = MultithreadedData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* Near-identical vertices collapse into a single one in the first pass,
+       so the following passes have less data than there are threads */
+    Math::Vector3<T> vertices[10];
+    for(std::size_t i = 0; i != Containers::arraySize(vertices); ++i)
+        vertices[i] = Math::Vector3<T>{T(1.0)} + Math::Vector3<T>{T(0.0001)}*T(i%2);
+    UnsignedInt indices[]{9, 3, 0, 5, 8, 1};
+
+    std::size_t count = MeshTools::removeDuplicatesFuzzyIndexedInPlace(
+        Containers::stridedArrayView(indices),
+        Containers::arrayCast<2, T>(Containers::stridedArrayView(vertices)),
+        T(0.01), data.threadCount);
+    CORRADE_COMPARE(count, 1);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices),
+        Containers::arrayView<UnsignedInt>({0, 0, 0, 0, 0, 0}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(vertices[0], Math::Vector3<T>{T(1.0)});
+}
+
 void RemoveDuplicatesTest::removeDuplicatesMeshData() {
     auto&& data = RemoveDuplicatesMeshDataData[testCaseInstanceId()];
     setTestCaseDescription(data.name);
@@ -1270,6 +1369,93 @@ void RemoveDuplicatesTest::benchmarkFuzzy() {
     CORRADE_COMPARE(count, 100);
 }
 
+/* Array of 50000 unique items with 2 duplicates each, shuffled. Compared to
+   the above this is closer to what real meshes look like, stressing the
+   table insertion instead of just lookup. */
+Containers::Array<Vector3i> manyUniqueData() {
+    Containers::Array<Vector3i> data{ValueInit, 100000};
+    for(std::size_t i = 0; i != data.size(); ++i)
+        data[i] = {Int(i/2), Int(i/4), 0};
+    std::shuffle(data.begin(), data.end(), std::minstd_rand{std::random_device{}()});
+    return data;
+}
+
+void RemoveDuplicatesTest::benchmarkManyUnique() {
+    Containers::Array<Vector3i> data = manyUniqueData();
+
+    std::size_t count = 0;
+    Containers::Array<UnsignedInt> indices{NoInit, data.size()};
+    CORRADE_BENCHMARK(1)
+        count = MeshTools::removeDuplicatesInPlaceInto(
+            Containers::arrayCast<2, char>(Containers::stridedArrayView(data)),
+            indices);
+
+    CORRADE_COMPARE(count, 50000);
+}
+
+void RemoveDuplicatesTest::benchmarkManyUniqueStl() {
+    Containers::Array<Vector3i> data = manyUniqueData();
+
+    /* The original std::unordered_map-based implementation of
+       removeDuplicatesInPlaceInto(), for comparison */
+    struct ArrayEqual {
+        bool operator()(const void* a, const void* b) const {
+            return std::memcmp(a, b, sizeof(Vector3i)) == 0;
+        }
+    };
+    struct ArrayHash {
+        std::size_t operator()(const void* a) const {
+            return *reinterpret_cast<const std::size_t*>(Utility::MurmurHash2{}(static_cast<const char*>(a), sizeof(Vector3i)).byteArray());
+        }
+    };
+
+    std::size_t count = 0;
+    Containers::Array<UnsignedInt> indices{NoInit, data.size()};
+    CORRADE_BENCHMARK(1) {
+        std::unordered_map<const void*, UnsignedInt, ArrayHash, ArrayEqual> table{data.size()};
+        for(std::size_t i = 0; i != data.size(); ++i) {
+            Vector3i& dst = data[table.size()];
+            if(i != table.size()) dst = data[i];
+            indices[i] = table.emplace(&dst, table.size()).first->second;
+        }
+        count = table.size();
+    }
+
+    CORRADE_COMPARE(count, 50000);
+}
+
+void RemoveDuplicatesTest::benchmarkManyUniqueFuzzy() {
+    Containers::Array<Vector3i> dataInt = manyUniqueData();
+    Containers::Array<Vector3> data{NoInit, dataInt.size()};
+    for(std::size_t i = 0; i != data.size(); ++i)
+        data[i] = Vector3{dataInt[i]};
+
+    std::size_t count = 0;
+    Containers::Array<UnsignedInt> indices{NoInit, data.size()};
+    CORRADE_BENCHMARK(1)
+        count = MeshTools::removeDuplicatesFuzzyInPlaceInto(
+            Containers::arrayCast<2, Float>(Containers::stridedArrayView(data)),
+            indices);
+
+    CORRADE_COMPARE(count, 50000);
+}
+
+void RemoveDuplicatesTest::benchmarkManyUniqueFuzzyMultithreaded() {
+    Containers::Array<Vector3i> dataInt = manyUniqueData();
+    Containers::Array<Vector3> data{NoInit, dataInt.size()};
+    for(std::size_t i = 0; i != data.size(); ++i)
+        data[i] = Vector3{dataInt[i]};
+
+    std::size_t count = 0;
+    Containers::Array<UnsignedInt> indices{NoInit, data.size()};
+    CORRADE_BENCHMARK(1)
+        count = MeshTools::removeDuplicatesFuzzyInPlaceInto(
+            Containers::arrayCast<2, Float>(Containers::stridedArrayView(data)),
+            indices, Math::TypeTraits<Float>::epsilon(), 0);
+
+    CORRADE_COMPARE(count, 50000);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::RemoveDuplicatesTest)
@@ -0,0 +1,511 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Math/TypeTraits.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Simplify.h"
+#include "Magnum/Primitives/Grid.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct SimplifyTest: TestSuite::Tester {
+    explicit SimplifyTest();
+
+    template<class T> void simplify();
+    void simplifyTargetIndexCount();
+    void simplifyTargetIndexCountCurved();
+    void simplifyTargetError();
+    void simplifySeam();
+    void simplifyDegenerate();
+    void simplifyNothingToDo();
+    void simplifyInvalid();
+    void simplifyErased();
+    void simplifyErasedNotContiguous();
+    void simplifyErasedWrongIndexSize();
+
+    void simplifyMeshData();
+    void simplifyMeshDataRvalue();
+    void simplifyMeshDataInvalid();
+
+    void generateLodChain();
+    void generateLodChainInvalid();
+
+    void benchmark();
+};
+
+SimplifyTest::SimplifyTest() {
+    addTests({&SimplifyTest::simplify<UnsignedByte>,
+              &SimplifyTest::simplify<UnsignedShort>,
+              &SimplifyTest::simplify<UnsignedInt>,
+              &SimplifyTest::simplifyTargetIndexCount,
+              &SimplifyTest::simplifyTargetIndexCountCurved,
+              &SimplifyTest::simplifyTargetError,
+              &SimplifyTest::simplifySeam,
+              &SimplifyTest::simplifyDegenerate,
+              &SimplifyTest::simplifyNothingToDo,
+              &SimplifyTest::simplifyInvalid,
+              &SimplifyTest::simplifyErased,
+              &SimplifyTest::simplifyErasedNotContiguous,
+              &SimplifyTest::simplifyErasedWrongIndexSize,
+
+              &SimplifyTest::simplifyMeshData,
+              &SimplifyTest::simplifyMeshDataRvalue,
+              &SimplifyTest::simplifyMeshDataInvalid,
+
+              &SimplifyTest::generateLodChain,
+              &SimplifyTest::generateLodChainInvalid});
+
+    addBenchmarks({&SimplifyTest::benchmark}, 10);
+}
+
+/* A flat 11x11 vertex grid, 200 triangles in total. With the 40 border
+   vertices locked, all 81 inner vertices can be collapsed, leaving 38
+   triangles. */
+Trade::MeshData flatGrid() {
+    return Primitives::grid3DSolid({9, 9}, {});
+}
+
+/* A 17x17 vertex paraboloid, 512 triangles in total */
+Trade::MeshData curvedGrid(const Vector2i& subdivisions = {15, 15}) {
+    Trade::MeshData grid = Primitives::grid3DSolid(subdivisions, {});
+    for(Vector3& position: grid.mutableAttribute<Vector3>(Trade::MeshAttribute::Position))
+        position.z() = (position.x()*position.x() + position.y()*position.y())*0.5f;
+    return grid;
+}
+
+Float area(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions) {
+    Float area = 0.0f;
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        const Vector3 a = positions[indices[i + 0]];
+        const Vector3 b = positions[indices[i + 1]];
+        const Vector3 c = positions[indices[i + 2]];
+        area += Math::cross(b - a, c - a).z()*0.5f;
+    }
+    return area;
+}
+
+template<class T> void SimplifyTest::simplify() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    const Trade::MeshData grid = flatGrid();
+    const Containers::Array<UnsignedInt> gridIndices = grid.indicesAsArray();
+    Containers::Array<T> indices{NoInit, gridIndices.size()};
+    for(std::size_t i = 0; i != gridIndices.size(); ++i)
+        indices[i] = gridIndices[i];
+    const Containers::Array<Vector3> positions = grid.positions3DAsArray();
+
+    Containers::Pair<std::size_t, Float> result = MeshTools::simplifyInPlace(Containers::stridedArrayView(indices), positions, 0);
+    CORRADE_COMPARE(result.first(), 38*3);
+    /* The grid is flat, so there's no error */
+    CORRADE_COMPARE(result.second(), 0.0f);
+
+    Containers::Array<UnsignedInt> simplified{NoInit, result.first()};
+    Containers::BitArray used{ValueInit, positions.size()};
+    for(std::size_t i = 0; i != result.first(); ++i) {
+        simplified[i] = indices[i];
+        used.set(indices[i]);
+    }
+
+    /* No triangle got flipped, so the area stays the same */
+    CORRADE_COMPARE(area(simplified, positions), 4.0f);
+
+    /* All border vertices are kept, the inner ones are removed */
+    for(std::size_t i = 0; i != positions.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(used[i], Math::abs(positions[i].x()) == 1.0f || Math::abs(positions[i].y()) == 1.0f);
+    }
+}
+
+void SimplifyTest::simplifyTargetIndexCount() {
+    const Trade::MeshData grid = flatGrid();
+    Containers::Array<UnsignedInt> indices = grid.indicesAsArray();
+    const Containers::Array<Vector3> positions = grid.positions3DAsArray();
+
+    /* Every collapse removes two triangles, so it can get exactly half */
+    Containers::Pair<std::size_t, Float> result = MeshTools::simplifyInPlace(Containers::stridedArrayView(indices), positions, 300);
+    CORRADE_COMPARE(result.first(), 300);
+    CORRADE_COMPARE(result.second(), 0.0f);
+    CORRADE_COMPARE(area(indices.prefix(result.first()), positions), 4.0f);
+}
+
+void SimplifyTest::simplifyTargetIndexCountCurved() {
+    const Trade::MeshData grid = curvedGrid();
+    Containers::Array<UnsignedInt> indices = grid.indicesAsArray();
+    const Containers::Array<Vector3> positions = grid.positions3DAsArray();
+
+    Containers::Pair<std::size_t, Float> half = MeshTools::simplifyInPlace(Containers::stridedArrayView(indices), positions, 768);
+    CORRADE_COMPARE_AS(half.first(), 768,
+        TestSuite::Compare::LessOrEqual);
+    CORRADE_COMPARE_AS(half.first(), 750,
+        TestSuite::Compare::Greater);
+    CORRADE_COMPARE_AS(half.second(), 0.0f,
+        TestSuite::Compare::Greater);
+
+    /* Simplifying further results in a larger error */
+    Containers::Pair<std::size_t, Float> quarter = MeshTools::simplifyInPlace(Containers::stridedArrayView(indices).prefix(half.first()), positions, 384);
+    CORRADE_COMPARE_AS(quarter.first(), 384,
+        TestSuite::Compare::LessOrEqual);
+    CORRADE_COMPARE_AS(quarter.first(), 370,
+        TestSuite::Compare::Greater);
+    CORRADE_COMPARE_AS(quarter.second(), half.second(),
+        TestSuite::Compare::Greater);
+}
+
+void SimplifyTest::simplifyTargetError() {
+    const Trade::MeshData grid = curvedGrid();
+    const Containers::Array<UnsignedInt> indices = grid.indicesAsArray();
+    const Containers::Array<Vector3> positions = grid.positions3DAsArray();
+
+    /* Every collapse on a curved surface introduces some error, so with a
+       zero target error nothing gets simplified */
+    {
+        Containers::Array<UnsignedInt> simplified{NoInit, indices.size()};
+        Utility::copy(indices, simplified);
+        Containers::Pair<std::size_t, Float> result = MeshTools::simplifyInPlace(Containers::stridedArrayView(simplified), positions, 0, 0.0f);
+        CORRADE_COMPARE(result.first(), indices.size());
+        CORRADE_COMPARE(result.second(), 0.0f);
+        CORRADE_COMPARE_AS(simplified, indices,
+            TestSuite::Compare::Container);
+    }
+
+    /* A 5% error bound stops way before the target index count */
+    std::size_t boundedCount;
+    {
+        Containers::Array<UnsignedInt> simplified{NoInit, indices.size()};
+        Utility::copy(indices, simplified);
+        Containers::Pair<std::size_t, Float> result = MeshTools::simplifyInPlace(Containers::stridedArrayView(simplified), positions, 0, 0.05f);
+        CORRADE_COMPARE_AS(result.first(), indices.size()/2,
+            TestSuite::Compare::Less);
+        CORRADE_COMPARE_AS(result.second(), 0.0f,
+            TestSuite::Compare::Greater);
+        CORRADE_COMPARE_AS(result.second(), 0.05f,
+            TestSuite::Compare::LessOrEqual);
+        boundedCount = result.first();
+    }
+
+    /* An unbounded error goes further */
+    {
+        Containers::Array<UnsignedInt> simplified{NoInit, indices.size()};
+        Utility::copy(indices, simplified);
+        Containers::Pair<std::size_t, Float> result = MeshTools::simplifyInPlace(Containers::stridedArrayView(simplified), positions, 0);
+        CORRADE_COMPARE_AS(result.first(), boundedCount,
+            TestSuite::Compare::Less);
+        CORRADE_COMPARE_AS(result.second(), 0.05f,
+            TestSuite::Compare::Greater);
+    }
+}
+
+void SimplifyTest::simplifySeam() {
+    /* Duplicate the vertices in one column for triangles on the right
+       side, as if they had a different texture coordinate there */
+    const Trade::MeshData grid = flatGrid();
+    Containers::Array<UnsignedInt> indices = grid.indicesAsArray();
+    const Containers::Array<Vector3> gridPositions = grid.positions3DAsArray();
+    Containers::Array<Vector3> positions{NoInit, gridPositions.size() + 11};
+    Utility::copy(gridPositions, positions.prefix(gridPositions.size()));
+
+    Containers::Array<UnsignedInt> duplicate{DirectInit, gridPositions.size(), ~UnsignedInt{}};
+    UnsignedInt next = gridPositions.size();
+    for(std::size_t i = 0; i != gridPositions.size(); ++i) {
+        /* The grid has 10 faces in each direction, pick the seventh column */
+        if(Math::abs(gridPositions[i].x() - 0.2f) > 0.001f) continue;
+        positions[next] = gridPositions[i];
+        duplicate[i] = next++;
+    }
+    CORRADE_COMPARE(next, positions.size());
+
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        const Float centroidX = gridPositions[indices[i + 0]].x() +
+                                gridPositions[indices[i + 1]].x() +
+                                gridPositions[indices[i + 2]].x();
+        if(centroidX < 0.6f) continue;
+        for(std::size_t j = 0; j != 3; ++j)
+            if(duplicate[indices[i + j]] != ~UnsignedInt{})
+                indices[i + j] = duplicate[indices[i + j]];
+    }
+
+    Containers::Pair<std::size_t, Float> result = MeshTools::simplifyInPlace(Containers::stridedArrayView(indices), positions, 0);
+    CORRADE_COMPARE_AS(result.first(), 38*3,
+        TestSuite::Compare::Greater);
+    CORRADE_COMPARE(result.second(), 0.0f);
+    CORRADE_COMPARE(area(indices.prefix(result.first()), positions), 4.0f);
+
+    /* All vertices on both sides of the seam are kept */
+    Containers::BitArray used{ValueInit, positions.size()};
+    for(const UnsignedInt i: indices.prefix(result.first()))
+        used.set(i);
+    for(std::size_t i = 0; i != gridPositions.size(); ++i) {
+        if(duplicate[i] == ~UnsignedInt{}) continue;
+        CORRADE_ITERATION(i);
+        CORRADE_VERIFY(used[i]);
+        CORRADE_VERIFY(used[duplicate[i]]);
+    }
+}
+
+void SimplifyTest::simplifyDegenerate() {
+    const Vector3 positions[]{
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f},
+        {1.0f, 1.0f, 0.0f}
+    };
+    UnsignedInt indices[]{
+        0, 1, 2,
+        2, 2, 1,
+        2, 1, 3
+    };
+
+    /* All vertices are on the border so nothing can be collapsed, but the
+       degenerate triangle gets removed */
+    Containers::Pair<std::size_t, Float> result = MeshTools::simplifyInPlace(Containers::stridedArrayView(indices), positions, 0);
+    CORRADE_COMPARE(result.first(), 6);
+    CORRADE_COMPARE(result.second(), 0.0f);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices).prefix(6), Containers::arrayView<UnsignedInt>({
+        0, 1, 2,
+        2, 1, 3
+    }), TestSuite::Compare::Container);
+}
+
+void SimplifyTest::simplifyNothingToDo() {
+    const Trade::MeshData grid = curvedGrid();
+    const Containers::Array<UnsignedInt> indices = grid.indicesAsArray();
+    const Containers::Array<Vector3> positions = grid.positions3DAsArray();
+
+    Containers::Array<UnsignedInt> simplified{NoInit, indices.size()};
+    Utility::copy(indices, simplified);
+    Containers::Pair<std::size_t, Float> result = MeshTools::simplifyInPlace(Containers::stridedArrayView(simplified), positions, indices.size());
+    CORRADE_COMPARE(result.first(), indices.size());
+    CORRADE_COMPARE(result.second(), 0.0f);
+    CORRADE_COMPARE_AS(simplified, indices,
+        TestSuite::Compare::Container);
+}
+
+void SimplifyTest::simplifyInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Vector3 positions[3]{};
+    UnsignedInt indices[]{0, 1, 2, 2, 1, 3};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::simplifyInPlace(Containers::stridedArrayView(indices).exceptSuffix(1), positions, 0);
+    MeshTools::simplifyInPlace(Containers::stridedArrayView(indices), positions, 0, -0.1f);
+    MeshTools::simplifyInPlace(Containers::stridedArrayView(indices), positions, 0);
+    CORRADE_COMPARE_AS(out,
+        "MeshTools::simplifyInPlace(): index count not divisible by 3\n"
+        "MeshTools::simplifyInPlace(): expected a non-negative target error but got -0.1\n"
+        "MeshTools::simplifyInPlace(): index 3 out of range for 3 vertices\n",
+        TestSuite::Compare::String);
+}
+
+void SimplifyTest::simplifyErased() {
+    const Trade::MeshData grid = flatGrid();
+    const Containers::Array<UnsignedInt> gridIndices = grid.indicesAsArray();
+    Containers::Array<UnsignedShort> indices{NoInit, gridIndices.size()};
+    for(std::size_t i = 0; i != gridIndices.size(); ++i)
+        indices[i] = gridIndices[i];
+    const Containers::Array<Vector3> positions = grid.positions3DAsArray();
+
+    Containers::Pair<std::size_t, Float> result = MeshTools::simplifyInPlace(Containers::arrayCast<2, char>(Containers::stridedArrayView(indices)), positions, 0);
+    CORRADE_COMPARE(result.first(), 38*3);
+    CORRADE_COMPARE(result.second(), 0.0f);
+}
+
+void SimplifyTest::simplifyErasedNotContiguous() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char indices[6*4]{};
+    Containers::StridedArrayView2D<char> indicesView{indices, {6, 2}, {4, 2}};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::simplifyInPlace(indicesView, nullptr, 0);
+    CORRADE_COMPARE(out, "MeshTools::simplifyInPlace(): second index view dimension is not contiguous\n");
+}
+
+void SimplifyTest::simplifyErasedWrongIndexSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char indices[6*3]{};
+    Containers::StridedArrayView2D<char> indicesView{indices, {6, 3}};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::simplifyInPlace(indicesView, nullptr, 0);
+    CORRADE_COMPARE(out, "MeshTools::simplifyInPlace(): expected index type size 1, 2 or 4 but got 3\n");
+}
+
+void SimplifyTest::simplifyMeshData() {
+    const Trade::MeshData grid = Primitives::grid3DSolid({9, 9}, Primitives::GridFlag::Normals);
+
+    Trade::MeshData simplified = MeshTools::simplify(grid, 0);
+    CORRADE_COMPARE(simplified.primitive(), MeshPrimitive::Triangles);
+    CORRADE_VERIFY(simplified.isIndexed());
+    CORRADE_COMPARE(simplified.indexType(), MeshIndexType::UnsignedInt);
+    CORRADE_COMPARE(simplified.indexCount(), 38*3);
+
+    /* Vertex data are copied unchanged */
+    CORRADE_COMPARE(simplified.vertexCount(), grid.vertexCount());
+    CORRADE_VERIFY(simplified.vertexData().data() != grid.vertexData().data());
+    CORRADE_COMPARE(simplified.attributeCount(), 2);
+    CORRADE_COMPARE_AS(simplified.attribute<Vector3>(Trade::MeshAttribute::Position),
+        grid.attribute<Vector3>(Trade::MeshAttribute::Position),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(simplified.attribute<Vector3>(Trade::MeshAttribute::Normal),
+        grid.attribute<Vector3>(Trade::MeshAttribute::Normal),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(area(simplified.indices<UnsignedInt>(), simplified.attribute<Vector3>(Trade::MeshAttribute::Position)), 4.0f);
+}
+
+void SimplifyTest::simplifyMeshDataRvalue() {
+    Trade::MeshData grid = flatGrid();
+    const void* vertexData = grid.vertexData().data();
+
+    /* The vertex data get transferred */
+    Trade::MeshData simplified = MeshTools::simplify(Utility::move(grid), 300);
+    CORRADE_COMPARE(simplified.indexCount(), 300);
+    CORRADE_COMPARE(simplified.vertexCount(), 121);
+    CORRADE_COMPARE(simplified.vertexData().data(), vertexData);
+}
+
+void SimplifyTest::simplifyMeshDataInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Vector3 positions[3]{};
+    const UnsignedInt indices[3]{};
+    const Trade::MeshData strip{MeshPrimitive::TriangleStrip, 3};
+    const Trade::MeshData notIndexed{MeshPrimitive::Triangles, {}, positions, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(positions)}
+    }};
+    const Trade::MeshData noPositions{MeshPrimitive::Triangles, {}, indices, Trade::MeshIndexData{indices}, 3};
+    const Float ratios[]{0.5f, 1.1f};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::simplify(strip, 0);
+    MeshTools::simplify(notIndexed, 0);
+    MeshTools::simplify(noPositions, 0);
+    MeshTools::generateLodChain(strip, ratios);
+    MeshTools::generateLodChain(notIndexed, ratios);
+    MeshTools::generateLodChain(noPositions, ratios);
+    CORRADE_COMPARE_AS(out,
+        "MeshTools::simplify(): expected a MeshPrimitive::Triangles mesh, got MeshPrimitive::TriangleStrip\n"
+        "MeshTools::simplify(): mesh data not indexed\n"
+        "MeshTools::simplify(): the mesh has no positions\n"
+        "MeshTools::generateLodChain(): expected a MeshPrimitive::Triangles mesh, got MeshPrimitive::TriangleStrip\n"
+        "MeshTools::generateLodChain(): mesh data not indexed\n"
+        "MeshTools::generateLodChain(): the mesh has no positions\n",
+        TestSuite::Compare::String);
+}
+
+void SimplifyTest::generateLodChain() {
+    const Trade::MeshData grid = Primitives::grid3DSolid({9, 9}, Primitives::GridFlag::Normals);
+
+    Containers::Pair<Trade::MeshData, Containers::Array<MeshLod>> out = MeshTools::generateLodChain(grid, Containers::arrayView({0.5f, 0.25f, 0.0f}));
+
+    /* The mesh references the first level, which is the original mesh */
+    const Trade::MeshData& mesh = out.first();
+    CORRADE_COMPARE(mesh.primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(mesh.indexType(), MeshIndexType::UnsignedInt);
+    CORRADE_COMPARE(mesh.indexCount(), 600);
+    CORRADE_COMPARE(mesh.indexOffset(), 0);
+    CORRADE_COMPARE_AS(mesh.indices<UnsignedInt>(),
+        grid.indices<UnsignedInt>(),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(mesh.vertexCount(), grid.vertexCount());
+    CORRADE_COMPARE(mesh.attributeCount(), 2);
+    CORRADE_COMPARE_AS(mesh.attribute<Vector3>(Trade::MeshAttribute::Position),
+        grid.attribute<Vector3>(Trade::MeshAttribute::Position),
+        TestSuite::Compare::Container);
+
+    /* All levels are in a single index buffer */
+    const Containers::ArrayView<const MeshLod> lods = out.second();
+    CORRADE_COMPARE(lods.size(), 4);
+    CORRADE_COMPARE(lods[0].indexOffset, 0);
+    CORRADE_COMPARE(lods[0].indexCount, 600);
+    CORRADE_COMPARE(lods[1].indexOffset, 600);
+    CORRADE_COMPARE(lods[1].indexCount, 300);
+    CORRADE_COMPARE(lods[2].indexOffset, 900);
+    CORRADE_COMPARE(lods[2].indexCount, 150);
+    CORRADE_COMPARE(lods[3].indexOffset, 1050);
+    CORRADE_COMPARE(lods[3].indexCount, 114);
+    CORRADE_COMPARE(mesh.indexData().size(), 1164*4);
+
+    /* The mesh is flat, so there's no error and each level covers the same
+       area */
+    const Containers::ArrayView<const UnsignedInt> indices = Containers::arrayCast<const UnsignedInt>(mesh.indexData());
+    for(std::size_t i = 0; i != lods.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(lods[i].error, 0.0f);
+        CORRADE_COMPARE(area(indices.sliceSize(lods[i].indexOffset, lods[i].indexCount), mesh.attribute<Vector3>(Trade::MeshAttribute::Position)), 4.0f);
+    }
+}
+
+void SimplifyTest::generateLodChainInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Trade::MeshData grid = flatGrid();
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::generateLodChain(grid, Containers::arrayView({0.5f, 1.1f}));
+    MeshTools::generateLodChain(grid, Containers::arrayView({-0.1f}));
+    CORRADE_COMPARE_AS(out,
+        "MeshTools::generateLodChain(): expected index count ratio 1 to be in range [0, 1] but got 1.1\n"
+        "MeshTools::generateLodChain(): expected index count ratio 0 to be in range [0, 1] but got -0.1\n",
+        TestSuite::Compare::String);
+}
+
+void SimplifyTest::benchmark() {
+    /* About 32k triangles */
+    const Trade::MeshData grid = curvedGrid({127, 127});
+    const Containers::Array<UnsignedInt> indices = grid.indicesAsArray();
+    const Containers::Array<Vector3> positions = grid.positions3DAsArray();
+
+    Containers::Array<UnsignedInt> simplified{NoInit, indices.size()};
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1) {
+        Utility::copy(indices, simplified);
+        count = MeshTools::simplifyInPlace(Containers::stridedArrayView(simplified), positions, indices.size()/10).first();
+    }
+
+    CORRADE_COMPARE_AS(count, indices.size()/10,
+        TestSuite::Compare::LessOrEqual);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::SimplifyTest)
@@ -32,6 +32,7 @@
 
 #include <functional>
 #include <vector>
+#include <Corrade/Containers/Iterable.h>
 #include <Corrade/Containers/LinkedList.h>
 
 #include "Magnum/DimensionTraits.h"
@@ -40,6 +41,23 @@
 
 namespace Magnum { namespace SceneGraph {
 
+namespace Implementation {
+    /* Iterable views on a list of reference wrappers or pointers, casting the
+       items to given type. Used to implement the std::vector APIs and the
+       AbstractObject interface on top of the Iterable ones without having to
+       allocate a temporary list of cast objects. */
+    template<class T, class U, class Allocator> Containers::Iterable<T> iterableReferenceWrappers(const std::vector<std::reference_wrapper<U>, Allocator>& objects) {
+        return Containers::Iterable<T>{objects.data(), objects.size(), sizeof(std::reference_wrapper<U>), [](const void* data) -> T& {
+            return static_cast<T&>(static_cast<const std::reference_wrapper<U>*>(data)->get());
+        }};
+    }
+    template<class T, class U> Containers::Iterable<T> iterablePointers(U* const* objects, std::size_t size) {
+        return Containers::Iterable<T>{objects, size, sizeof(U*), [](const void* data) -> T& {
+            return static_cast<T&>(**static_cast<U* const*>(data));
+        }};
+    }
+}
+
 /**
 @brief Base for objects
 
@@ -186,6 +204,23 @@ template<UnsignedInt dimensions, class T> class AbstractObject
             return doTransformationMatrices(objects, finalTransformationMatrix);
         }
 
+        /**
+         * @brief Put transformation matrices of given set of objects relative to this object into a view
+         * @m_since_latest
+         *
+         * Like @ref transformationMatrices(), but puts the result into
+         * @p out instead of allocating a new array. Expects that @p out has
+         * the same size as @p objects. The @ref Object implementation reuses
+         * memory for temporary data across calls, so once it's warmed up,
+         * this function doesn't allocate.
+         * @warning This function cannot check if all objects are of the same
+         *      @ref Object type, use typesafe @ref Object::transformationMatricesInto()
+         *      when possible.
+         */
+        void transformationMatricesInto(const Containers::Iterable<AbstractObject<dimensions, T>>& objects, const Containers::StridedArrayView1D<MatrixType>& out, const MatrixType& finalTransformationMatrix = MatrixType()) const {
+            doTransformationMatricesInto(objects, out, finalTransformationMatrix);
+        }
+
         /* Since 1.8.17, the original short-hand group closing doesn't work
            anymore. FFS. */
         /**
@@ -271,6 +306,9 @@ template<UnsignedInt dimensions, class T> class AbstractObject
         virtual MatrixType doTransformationMatrix() const = 0;
         virtual MatrixType doAbsoluteTransformationMatrix() const = 0;
         virtual std::vector<MatrixType> doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects, const MatrixType& finalTransformationMatrix) const = 0;
+        /* Not pure virtual to not break existing subclasses, the default
+           implementation delegates to doTransformationMatrices() */
+        virtual void doTransformationMatricesInto(const Containers::Iterable<AbstractObject<dimensions, T>>& objects, const Containers::StridedArrayView1D<MatrixType>& out, const MatrixType& finalTransformationMatrix) const;
 
         virtual bool doIsDirty() const = 0;
         virtual void doSetDirty() = 0;
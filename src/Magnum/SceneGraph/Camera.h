@@ -30,6 +30,8 @@
  * @brief Class @ref Magnum::SceneGraph::Camera, enum @ref Magnum::SceneGraph::AspectRatioPolicy, alias @ref Magnum::SceneGraph::BasicCamera2D, @ref Magnum::SceneGraph::BasicCamera3D, typedef @ref Magnum::SceneGraph::Camera2D, @ref Magnum::SceneGraph::Camera3D
  */
 
+#include <Corrade/Containers/Array.h>
+
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/SceneGraph/AbstractFeature.h"
@@ -200,7 +202,11 @@ template<UnsignedInt dimensions, class T> class Camera: public AbstractFeature<d
         /**
          * @brief Draw
          *
-         * Draws given group of drawables.
+         * Draws given group of drawables. Memory for the transformations is
+         * owned by the camera and reused across calls, so if the object
+         * transformation implementation supports it (which is the case for
+         * both @ref Object and @ref FlatScene), drawing doesn't allocate once
+         * the memory is large enough for the group.
          * @see @ref draw(const std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>>&)
          */
         void draw(DrawableGroup<dimensions, T>& group);
@@ -214,6 +220,76 @@ template<UnsignedInt dimensions, class T> class Camera: public AbstractFeature<d
          */
         void draw(const std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>>& drawableTransformations);
 
+        /**
+         * @brief Culled drawable transformations
+         * @m_since_latest
+         *
+         * Like @ref drawableTransformations(), but returns just drawables
+         * whose @ref Drawable::setBoundingSphere() "bounding sphere" is at
+         * least partially inside the camera projection, i.e. the
+         * @ref Math::Frustum::fromMatrix() "frustum" in 3D and an equivalent
+         * set of four lines in 2D, in the order they were added to the group.
+         * Note that the transformations are still calculated for all
+         * drawables in the group before the culling is done, the culling only
+         * saves the @ref Drawable::draw() calls. See
+         * @ref SceneGraph-Drawable-culling-builtin for more information.
+         * @see @ref visibleDrawableTransformations(DrawableGroup<dimensions, T>&, SortKey&&),
+         *      @ref drawVisible()
+         */
+        std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>> visibleDrawableTransformations(DrawableGroup<dimensions, T>& group);
+
+        /**
+         * @brief Culled and sorted drawable transformations
+         * @param group     Group of drawables
+         * @param sortKey   Function object calculating a sort key from a
+         *      drawable and its camera-relative transformation
+         * @m_since_latest
+         *
+         * Like @ref visibleDrawableTransformations(DrawableGroup<dimensions, T>&),
+         * but the visible drawables are additionally sorted by the key
+         * returned by @p sortKey in an ascending order, drawables with the
+         * same key staying in the order they were added to the group. The
+         * @p sortKey is expected to be callable as
+         * @cpp Key(Drawable<dimensions, T>&, const MatrixTypeFor<dimensions, T>&) @ce
+         * and is called exactly once for each visible drawable. Can be any
+         * function object including a capturing lambda. The @cpp Key @ce can
+         * be any type comparable with @cpp operator< @ce, such as a depth, an
+         * integer material ID or a shader pointer, with pointers compared
+         * using @ref std::less to give a consistent order.
+         * @see @ref drawVisible(DrawableGroup<dimensions, T>&, SortKey&&)
+         */
+        template<class SortKey> std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>> visibleDrawableTransformations(DrawableGroup<dimensions, T>& group, SortKey&& sortKey) {
+            std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>> visible = visibleDrawableTransformations(group);
+            typedef typename std::decay<decltype(sortKey(visible[0].first.get(), visible[0].second))>::type Key;
+            std::vector<Key> keys;
+            keys.reserve(visible.size());
+            for(const std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>& drawableTransformation: visible)
+                keys.push_back(sortKey(drawableTransformation.first.get(), drawableTransformation.second));
+            return sortByKeys(visible, keys.data(), [](const void* keys, std::size_t a, std::size_t b) {
+                return std::less<Key>{}(static_cast<const Key*>(keys)[a], static_cast<const Key*>(keys)[b]);
+            });
+        }
+
+        /**
+         * @brief Draw visible drawables
+         * @m_since_latest
+         *
+         * Equivalent to calling @ref draw(const std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>>&)
+         * with the output of @ref visibleDrawableTransformations(DrawableGroup<dimensions, T>&).
+         */
+        void drawVisible(DrawableGroup<dimensions, T>& group);
+
+        /**
+         * @brief Draw visible drawables sorted by a key
+         * @m_since_latest
+         *
+         * Equivalent to calling @ref draw(const std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>>&)
+         * with the output of @ref visibleDrawableTransformations(DrawableGroup<dimensions, T>&, SortKey&&).
+         */
+        template<class SortKey> void drawVisible(DrawableGroup<dimensions, T>& group, SortKey&& sortKey) {
+            draw(visibleDrawableTransformations(group, sortKey));
+        }
+
     private:
         /** Recalculates camera matrix */
         void cleanInverted(const MatrixTypeFor<dimensions, T>& invertedAbsoluteTransformationMatrix) override {
@@ -222,6 +298,12 @@ template<UnsignedInt dimensions, class T> class Camera: public AbstractFeature<d
 
         void fixAspectRatio();
 
+        /* Stable-sorts drawableTransformations by type-erased keys, with
+           `less(keys, a, b)` comparing keys at indices `a` and `b`. Used by
+           the templated visibleDrawableTransformations() so the sorting
+           itself doesn't need to be in the header. */
+        std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>> sortByKeys(const std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>>& drawableTransformations, const void* keys, bool(*less)(const void*, std::size_t, std::size_t));
+
         MatrixTypeFor<dimensions, T> _rawProjectionMatrix;
         AspectRatioPolicy _aspectRatioPolicy;
 
@@ -229,6 +311,10 @@ template<UnsignedInt dimensions, class T> class Camera: public AbstractFeature<d
         MatrixTypeFor<dimensions, T> _cameraMatrix;
 
         Vector2i _viewport;
+
+        /* Temporary memory for draw(), reused across calls */
+        Containers::Array<AbstractObject<dimensions, T>*> _drawObjects;
+        Containers::Array<MatrixTypeFor<dimensions, T>> _drawTransformations;
 };
 
 /**
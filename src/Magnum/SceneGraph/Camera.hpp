@@ -30,6 +30,11 @@
  * @brief @ref compilation-speedup-hpp "Template implementation" for @ref Camera.h
  */
 
+#include <algorithm> /* std::stable_sort() */
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Math/Distance.h"
+#include "Magnum/Math/Frustum.h"
 #include "Magnum/Math/Functions.h"
 #include "Magnum/SceneGraph/Camera.h"
 #include "Magnum/SceneGraph/Drawable.h"
@@ -54,6 +59,49 @@ template<UnsignedInt dimensions, class T> MatrixTypeFor<dimensions, T> aspectRat
         Math::Vector2<T>(T(1), relativeAspectRatio.x()/relativeAspectRatio.y()), T(1)));
 }
 
+/* Tests a camera-relative bounding sphere against the projection. The clip
+   planes (or lines in 2D) are extracted from the projection matrix the same
+   way as Math::Frustum::fromMatrix() does, but normalized upfront so the
+   signed distance can be compared directly to the radius.
+   Math::Intersection::sphereFrustum() isn't used as it compares the
+   unnormalized distance to a squared radius, which is only approximate. */
+template<UnsignedInt dimensions, class T> struct ProjectionCulling;
+template<class T> struct ProjectionCulling<2, T> {
+    explicit ProjectionCulling(const Math::Matrix3<T>& projection): lines{
+        projection.row(2) + projection.row(0),
+        projection.row(2) - projection.row(0),
+        projection.row(2) + projection.row(1),
+        projection.row(2) - projection.row(1)}
+    {
+        for(Math::Vector3<T>& line: lines) line /= line.xy().length();
+    }
+
+    bool isVisible(const Math::Vector2<T>& center, const T radius) const {
+        for(const Math::Vector3<T>& line: lines)
+            if(Math::dot(line.xy(), center) + line.z() < -radius)
+                return false;
+        return true;
+    }
+
+    Math::Vector3<T> lines[4];
+};
+template<class T> struct ProjectionCulling<3, T> {
+    explicit ProjectionCulling(const Math::Matrix4<T>& projection) {
+        const Math::Frustum<T> frustum = Math::Frustum<T>::fromMatrix(projection);
+        for(std::size_t i = 0; i != 6; ++i)
+            planes[i] = frustum[i]/frustum[i].xyz().length();
+    }
+
+    bool isVisible(const Math::Vector3<T>& center, const T radius) const {
+        for(const Math::Vector4<T>& plane: planes)
+            if(Math::Distance::pointPlaneNormalized(center, plane) < -radius)
+                return false;
+        return true;
+    }
+
+    Math::Vector4<T> planes[6];
+};
+
 }
 
 template<UnsignedInt dimensions, class T> Camera<dimensions, T>::Camera(AbstractObject<dimensions, T>& object): AbstractFeature<dimensions, T>(object), _aspectRatioPolicy(AspectRatioPolicy::NotPreserved) {
@@ -107,6 +155,58 @@ template<UnsignedInt dimensions, class T> std::vector<std::pair<std::reference_w
     return combined;
 }
 
+template<UnsignedInt dimensions, class T> std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>> Camera<dimensions, T>::visibleDrawableTransformations(DrawableGroup<dimensions, T>& group) {
+    std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>> combined = drawableTransformations(group);
+
+    /* Remove drawables that are outside of the projection, keeping the order
+       of the rest. The bounding sphere is transformed to be relative to the
+       camera, with the radius scaled by the largest axis scale. Infinite
+       radius means the drawable is never culled, checking that explicitly to
+       avoid getting a NaN when multiplying it by a zero scale. */
+    const Implementation::ProjectionCulling<dimensions, T> culling{_projectionMatrix};
+    std::size_t visibleCount = 0;
+    for(std::size_t i = 0; i != combined.size(); ++i) {
+        const Drawable<dimensions, T>& drawable = combined[i].first;
+        const MatrixTypeFor<dimensions, T>& transformation = combined[i].second;
+        const T radius = drawable.boundingSphereRadius();
+        if(radius != Math::Constants<T>::inf()) {
+            const auto rotationScaling = transformation.rotationScaling();
+            T maxScaleSquared{};
+            for(std::size_t j = 0; j != dimensions; ++j)
+                maxScaleSquared = Math::max(maxScaleSquared, rotationScaling[j].dot());
+            if(!culling.isVisible(transformation.transformPoint(drawable.boundingSphereCenter()), radius*Math::sqrt(maxScaleSquared)))
+                continue;
+        }
+
+        if(visibleCount != i) combined[visibleCount] = combined[i];
+        ++visibleCount;
+    }
+    combined.erase(combined.begin() + visibleCount, combined.end());
+
+    return combined;
+}
+
+template<UnsignedInt dimensions, class T> std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>> Camera<dimensions, T>::sortByKeys(const std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>>& drawableTransformations, const void* const keys, bool(*const less)(const void*, std::size_t, std::size_t)) {
+    /* Sort indices by the keys, stable to keep drawables with the same key in
+       the original order */
+    std::vector<std::size_t> indices(drawableTransformations.size());
+    for(std::size_t i = 0; i != indices.size(); ++i) indices[i] = i;
+    std::stable_sort(indices.begin(), indices.end(), [keys, less](std::size_t a, std::size_t b) {
+        return less(keys, a, b);
+    });
+
+    std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>> sorted;
+    sorted.reserve(drawableTransformations.size());
+    for(const std::size_t index: indices)
+        sorted.push_back(drawableTransformations[index]);
+
+    return sorted;
+}
+
+template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::drawVisible(DrawableGroup<dimensions, T>& group) {
+    draw(visibleDrawableTransformations(group));
+}
+
 template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::draw(DrawableGroup<dimensions, T>& group) {
     AbstractObject<dimensions, T>* scene = AbstractFeature<dimensions, T>::object().scene();
     CORRADE_ASSERT(scene, "SceneGraph::Camera::draw(): cannot draw when camera is not part of any scene", );
@@ -114,17 +214,29 @@ template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::draw(Drawa
     /* Compute camera matrix */
     AbstractFeature<dimensions, T>::object().setClean();
 
+    /* Temporary memory for the object list and their transformations, reused
+       across calls so drawing doesn't allocate once it's large enough. Taken
+       out of the camera for the duration of the call in case a drawable
+       calls draw() recursively. */
+    const std::size_t count = group.size();
+    Containers::Array<AbstractObject<dimensions, T>*> objects = std::move(_drawObjects);
+    Containers::Array<MatrixTypeFor<dimensions, T>> transformations = std::move(_drawTransformations);
+    if(objects.size() < count) {
+        objects = Containers::Array<AbstractObject<dimensions, T>*>{NoInit, Math::max(count, 2*objects.size())};
+        transformations = Containers::Array<MatrixTypeFor<dimensions, T>>{NoInit, objects.size()};
+    }
+
     /* Compute transformations of all objects in the group relative to the camera */
-    std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>> objects;
-    objects.reserve(group.size());
-    for(std::size_t i = 0; i != group.size(); ++i)
-        objects.push_back(group[i].object());
-    std::vector<MatrixTypeFor<dimensions, T>> transformations =
-        scene->transformationMatrices(objects, _cameraMatrix);
+    for(std::size_t i = 0; i != count; ++i)
+        objects[i] = &group[i].object();
+    scene->transformationMatricesInto(Implementation::iterablePointers<AbstractObject<dimensions, T>>(objects.data(), count), transformations.prefix(count), _cameraMatrix);
 
     /* Perform the drawing */
-    for(std::size_t i = 0; i != transformations.size(); ++i)
+    for(std::size_t i = 0; i != count; ++i)
         group[i].draw(transformations[i], *this);
+
+    _drawObjects = std::move(objects);
+    _drawTransformations = std::move(transformations);
 }
 
 template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::draw(const std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>>& drawableTransformations) {
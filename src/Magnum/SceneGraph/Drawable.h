@@ -30,6 +30,9 @@
  * @brief Class @ref Magnum::SceneGraph::Drawable, @ref Magnum::SceneGraph::DrawableGroup, alias @ref Magnum::SceneGraph::BasicDrawable2D, @ref Magnum::SceneGraph::BasicDrawable3D, @ref Magnum::SceneGraph::BasicDrawableGroup2D, @ref Magnum::SceneGraph::BasicDrawableGroup3D, typedef @ref Magnum::SceneGraph::Drawable2D, @ref Magnum::SceneGraph::Drawable3D, @ref Magnum::SceneGraph::DrawableGroup2D, @ref Magnum::SceneGraph::DrawableGroup3D
  */
 
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Vector3.h"
 #include "Magnum/SceneGraph/AbstractGroupedFeature.h"
 
 namespace Magnum { namespace SceneGraph {
@@ -134,6 +137,23 @@ get used in any way except being passed to the draw function:
 
 @snippet SceneGraph.cpp Drawable-culling
 
+@section SceneGraph-Drawable-culling-builtin Built-in culling and sorting
+
+Alternatively, each drawable can be given a bounding sphere relative to the
+object it's attached to using @ref setBoundingSphere(). Then
+@ref Camera::drawVisible() or @ref Camera::visibleDrawableTransformations()
+culls the drawables against the camera projection, and optionally sorts the
+visible ones by a key calculated from each drawable and its camera-relative
+transformation --- for example to minimize shader or material switches, or to
+draw front-to-back:
+
+@snippet SceneGraph.cpp Drawable-culling-builtin
+
+Drawables that don't have any bounding sphere set are never culled. The
+transformations are still calculated for all drawables in the group, as they're
+needed for the culling, but only the visible drawables get their @ref draw()
+called.
+
 @section SceneGraph-Drawable-explicit-specializations Explicit template specializations
 
 The following specializations are explicitly compiled into @ref SceneGraph
@@ -179,6 +199,45 @@ template<UnsignedInt dimensions, class T> class Drawable: public AbstractGrouped
             return AbstractGroupedFeature<dimensions, Drawable<dimensions, T>, T>::group();
         }
 
+        /**
+         * @brief Bounding sphere center
+         * @m_since_latest
+         *
+         * Relative to the object the drawable is attached to. Default is a
+         * zero vector.
+         * @see @ref boundingSphereRadius(), @ref Camera::drawVisible()
+         */
+        VectorTypeFor<dimensions, T> boundingSphereCenter() const {
+            return _boundingSphereCenter;
+        }
+
+        /**
+         * @brief Bounding sphere radius
+         * @m_since_latest
+         *
+         * Relative to the object the drawable is attached to. Default is an
+         * infinity, which means the drawable is never culled.
+         * @see @ref boundingSphereCenter(), @ref Camera::drawVisible()
+         */
+        T boundingSphereRadius() const { return _boundingSphereRadius; }
+
+        /**
+         * @brief Set bounding sphere
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * The sphere is relative to the object the drawable is attached to
+         * and is used for culling in @ref Camera::drawVisible() and
+         * @ref Camera::visibleDrawableTransformations(). Pass an infinite
+         * @p radius to make the drawable never culled. See
+         * @ref SceneGraph-Drawable-culling-builtin for more information.
+         */
+        Drawable<dimensions, T>& setBoundingSphere(const VectorTypeFor<dimensions, T>& center, T radius) {
+            _boundingSphereCenter = center;
+            _boundingSphereRadius = radius;
+            return *this;
+        }
+
         /**
          * @brief Draw the object using given camera
          * @param transformationMatrix  Object transformation relative to camera
@@ -188,6 +247,10 @@ template<UnsignedInt dimensions, class T> class Drawable: public AbstractGrouped
          * @ref SceneGraph::Camera::projectionMatrix() "Camera::projectionMatrix()".
          */
         virtual void draw(const MatrixTypeFor<dimensions, T>& transformationMatrix, Camera<dimensions, T>& camera) = 0;
+
+    private:
+        VectorTypeFor<dimensions, T> _boundingSphereCenter;
+        T _boundingSphereRadius{Math::Constants<T>::inf()};
 };
 
 /**
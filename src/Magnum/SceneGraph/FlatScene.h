@@ -0,0 +1,521 @@
+#ifndef Magnum_SceneGraph_FlatScene_h
+#define Magnum_SceneGraph_FlatScene_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::FlatScene, @ref Magnum::SceneGraph::FlatObject, alias @ref Magnum::SceneGraph::BasicFlatScene2D, @ref Magnum::SceneGraph::BasicFlatScene3D, @ref Magnum::SceneGraph::BasicFlatObject2D, @ref Magnum::SceneGraph::BasicFlatObject3D, typedef @ref Magnum::SceneGraph::FlatScene2D, @ref Magnum::SceneGraph::FlatScene3D, @ref Magnum::SceneGraph::FlatObject2D, @ref Magnum::SceneGraph::FlatObject3D
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/EnumSet.h>
+#include <Corrade/Containers/Pointer.h>
+
+#include "Magnum/SceneGraph/AbstractFeature.h"
+#include "Magnum/SceneGraph/AbstractObject.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+namespace Implementation {
+    enum class FlatObjectFlag: UnsignedByte {
+        /* Absolute transformation needs to be recalculated */
+        TransformationDirty = 1 << 0,
+        /* Same meaning as ObjectFlag::Dirty, features need to be cleaned */
+        Dirty = 1 << 1,
+        /* Hierarchy order is being rebuilt, mark the object and all its
+           children dirty after */
+        Propagate = 1 << 2
+    };
+
+    typedef Containers::EnumSet<FlatObjectFlag> FlatObjectFlags;
+
+    CORRADE_ENUMSET_OPERATORS(FlatObjectFlags)
+}
+
+/**
+@brief Object in a flat scene
+@m_since_latest
+
+@m_keywords{FlatObject2D FlatObject3D}
+
+A lightweight handle to an object stored in a @ref FlatScene. Instances are
+created with @ref FlatScene::addObject() and owned by the scene, the
+transformation and hierarchy data are stored in the scene itself. Similarly to
+@ref Object it can have features attached, and thus can be used with
+@ref Camera, @ref Drawable and other features through the @ref AbstractObject
+interface. See the @ref FlatScene documentation for more information.
+
+@section SceneGraph-FlatObject-explicit-specializations Explicit template specializations
+
+The following specializations are explicitly compiled into the @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type) you have to use the @ref FlatScene.hpp implementation file to avoid
+linker errors. See also @ref compilation-speedup-hpp for more information.
+
+-   @ref FlatObject2D
+-   @ref FlatObject3D
+
+@see @ref BasicFlatObject2D, @ref BasicFlatObject3D
+*/
+template<UnsignedInt dimensions, class T> class FlatObject: public AbstractObject<dimensions, T> {
+    public:
+        /** @brief Matrix type */
+        typedef MatrixTypeFor<dimensions, T> MatrixType;
+
+        /** @brief Copying is not allowed */
+        FlatObject(const FlatObject<dimensions, T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        FlatObject(FlatObject<dimensions, T>&&) = delete;
+
+        /** @brief Copying is not allowed */
+        FlatObject<dimensions, T>& operator=(const FlatObject<dimensions, T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        FlatObject<dimensions, T>& operator=(FlatObject<dimensions, T>&&) = delete;
+
+        /**
+         * @brief Object ID
+         *
+         * Index of the object in the order it was added to the scene. Stays
+         * the same for the whole object lifetime, unlike the position in the
+         * data returned by @ref FlatScene::transformations() and related
+         * views, which changes when the hierarchy is modified.
+         * @see @ref FlatScene::object(), @ref FlatScene::objectIds()
+         */
+        UnsignedInt id() const { return _id; }
+
+        /** @brief Scene the object belongs to */
+        FlatScene<dimensions, T>* scene() { return &_scene; }
+        const FlatScene<dimensions, T>* scene() const { return &_scene; } /**< @overload */
+
+        /** @{ @name Scene hierarchy */
+
+        /**
+         * @brief Parent object
+         *
+         * Returns @cpp nullptr @ce if the object is directly a child of the
+         * scene. Note that @ref AbstractObject::parent() returns the
+         * @ref FlatScene instead in that case, consistently with @ref Object.
+         */
+        FlatObject<dimensions, T>* parent();
+        const FlatObject<dimensions, T>* parent() const; /**< @overload */
+
+        /**
+         * @brief Set parent object
+         * @return Reference to self (for method chaining)
+         *
+         * Pass @cpp nullptr @ce to make the object a direct child of the
+         * scene. The @p parent is expected to be in the same scene and not be
+         * this object or any of its children. The object and all its children
+         * are marked as dirty. As the change invalidates the hierarchy order,
+         * the order is rebuilt and @ref AbstractFeature::markDirty() called
+         * only on the next query of the scene data or transformation of any
+         * object.
+         * @see @ref SceneGraph-FlatScene-hierarchy-order
+         */
+        FlatObject<dimensions, T>& setParent(FlatObject<dimensions, T>* parent);
+
+        /**
+         * @}
+         */
+
+        /** @{ @name Object transformation */
+
+        /** @brief Transformation relative to the parent */
+        MatrixType transformation() const;
+
+        /**
+         * @brief Set transformation relative to the parent
+         * @return Reference to self (for method chaining)
+         *
+         * Marks the object and all its children as dirty. The absolute
+         * transformation is recalculated lazily on the next query.
+         * @see @ref FlatScene::update()
+         */
+        FlatObject<dimensions, T>& setTransformation(const MatrixType& transformation);
+
+        /**
+         * @brief Transformation relative to the scene
+         *
+         * Calls @ref FlatScene::update() in order to have up-to-date data.
+         */
+        MatrixType absoluteTransformation() const;
+
+        /**
+         * @}
+         */
+
+        /**
+         * @{ @name Transformation caching
+         * See @ref scenegraph-features-caching for more information.
+         */
+
+        /** @copydoc AbstractObject::isDirty() */
+        bool isDirty() const;
+
+        /** @copydoc AbstractObject::setDirty() */
+        void setDirty();
+
+        /** @copydoc AbstractObject::setClean() */
+        void setClean();
+
+        /**
+         * @}
+         */
+
+    private:
+        friend FlatScene<dimensions, T>;
+
+        explicit FlatObject(FlatScene<dimensions, T>& scene, UnsignedInt id);
+
+        AbstractObject<dimensions, T>* doScene() override final;
+        const AbstractObject<dimensions, T>* doScene() const override final;
+
+        AbstractObject<dimensions, T>* doParent() override final;
+        const AbstractObject<dimensions, T>* doParent() const override final;
+
+        MatrixType MAGNUM_SCENEGRAPH_LOCAL doTransformationMatrix() const override final {
+            return transformation();
+        }
+        MatrixType MAGNUM_SCENEGRAPH_LOCAL doAbsoluteTransformationMatrix() const override final {
+            return absoluteTransformation();
+        }
+        std::vector<MatrixType> doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects, const MatrixType& finalTransformationMatrix) const override final;
+        void doTransformationMatricesInto(const Containers::Iterable<AbstractObject<dimensions, T>>& objects, const Containers::StridedArrayView1D<MatrixType>& out, const MatrixType& finalTransformationMatrix) const override final;
+
+        bool MAGNUM_SCENEGRAPH_LOCAL doIsDirty() const override final { return isDirty(); }
+        void MAGNUM_SCENEGRAPH_LOCAL doSetDirty() override final { setDirty(); }
+        void MAGNUM_SCENEGRAPH_LOCAL doSetClean() override final { setClean(); }
+        void doSetClean(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects) override final;
+
+        FlatScene<dimensions, T>& _scene;
+        UnsignedInt _id;
+};
+
+/**
+@brief Flat scene
+@m_since_latest
+
+@m_keywords{FlatScene2D FlatScene3D}
+
+An alternative to @ref Scene and @ref Object suited for large scenes. Instead
+of each object being a separate allocation with its transformation and
+parent/children links stored inside, the hierarchy as well as relative and
+absolute transformations of all objects are stored in contiguous arrays in the
+scene. Objects are represented by @ref FlatObject instances, which are created
+with @ref addObject() and owned by the scene:
+
+@snippet SceneGraph.cpp FlatScene-usage
+
+The objects can have features attached in the same way as @ref Object and
+because both the scene and the objects implement the @ref AbstractObject
+interface, @ref Camera, @ref Drawable and other features work with them
+without any changes. Compared to @ref Object, the transformation is always
+stored as a matrix, there's no equivalent to the various transformation
+implementations.
+
+@section SceneGraph-FlatScene-hierarchy-order Hierarchy order and transformation updates
+
+The data are stored in a depth-first order, i.e. every object is preceded by
+its parent and directly followed by all its children, recursively, with
+children of each parent kept in the order they were added. Thanks to that,
+an object together with all its children forms a contiguous range, which makes
+it possible to mark a whole subtree as dirty in a single pass, and all absolute
+transformations can be recalculated in a single linear sweep where each parent
+is processed before its children. The sweep is done by @ref update(), which is
+called implicitly every time an absolute transformation is queried, and covers
+just the range of objects that were marked as dirty since the last update.
+
+Adding an object at the scene root or as a child of the object that was added
+last (or any of its parents) preserves the order. Otherwise, and when
+@ref FlatObject::setParent() is called, the order is rebuilt from scratch on
+the next query, with the same complexity as a single full transformation
+update. The rebuild changes the positions of the objects in the data, so
+access the data through @ref FlatObject::id() and @ref objectIds() instead of
+caching the positions. To make best use of the data layout, build the
+hierarchy depth-first or add all objects upfront, and avoid reparenting
+objects in every frame.
+
+Objects can't be removed individually, they're all destroyed together with the
+scene.
+
+@section SceneGraph-FlatScene-explicit-specializations Explicit template specializations
+
+The following specializations are explicitly compiled into the @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type) you have to use the @ref FlatScene.hpp implementation file to avoid
+linker errors. See also @ref compilation-speedup-hpp for more information.
+
+-   @ref FlatScene2D
+-   @ref FlatScene3D
+
+@see @ref BasicFlatScene2D, @ref BasicFlatScene3D
+*/
+template<UnsignedInt dimensions, class T> class FlatScene: public AbstractObject<dimensions, T> {
+    public:
+        /** @brief Matrix type */
+        typedef MatrixTypeFor<dimensions, T> MatrixType;
+
+        /** @brief Constructor */
+        explicit FlatScene();
+
+        /** @brief Copying is not allowed */
+        FlatScene(const FlatScene<dimensions, T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        FlatScene(FlatScene<dimensions, T>&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Destroys all objects, features of each object are deleted in the
+         * @ref AbstractObject destructor.
+         */
+        ~FlatScene();
+
+        /** @brief Copying is not allowed */
+        FlatScene<dimensions, T>& operator=(const FlatScene<dimensions, T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        FlatScene<dimensions, T>& operator=(FlatScene<dimensions, T>&&) = delete;
+
+        /** @brief Object count */
+        std::size_t objectCount() const { return _objects.size(); }
+
+        /**
+         * @brief Object with given ID
+         *
+         * Expects that @p id is less than @ref objectCount().
+         */
+        FlatObject<dimensions, T>& object(UnsignedInt id);
+        const FlatObject<dimensions, T>& object(UnsignedInt id) const; /**< @overload */
+
+        /**
+         * @brief Reserve memory for given object count
+         *
+         * Useful when adding a lot of objects at once to avoid repeated
+         * reallocations.
+         */
+        void reserve(std::size_t capacity);
+
+        /**
+         * @brief Add an object
+         * @param parent    Parent object or @cpp nullptr @ce for an object
+         *      directly in the scene
+         *
+         * The object has an identity transformation and is marked as dirty.
+         * Its @ref FlatObject::id() is equal to @ref objectCount() before the
+         * call. The @p parent is expected to be in this scene.
+         * @see @ref SceneGraph-FlatScene-hierarchy-order
+         */
+        FlatObject<dimensions, T>& addObject(FlatObject<dimensions, T>* parent = nullptr);
+
+        /**
+         * @brief Object IDs in the hierarchy order
+         *
+         * Maps positions in @ref transformations() and
+         * @ref absoluteTransformations() to @ref FlatObject::id(). Rebuilds
+         * the hierarchy order if needed.
+         * @see @ref SceneGraph-FlatScene-hierarchy-order
+         */
+        Containers::ArrayView<const UnsignedInt> objectIds();
+
+        /**
+         * @brief Parent positions in the hierarchy order
+         *
+         * Position of the parent of each object, or @cpp -1 @ce for objects
+         * directly in the scene. The parent position is always less than the
+         * object position. Rebuilds the hierarchy order if needed.
+         */
+        Containers::ArrayView<const Int> parents();
+
+        /**
+         * @brief Relative transformations in the hierarchy order
+         *
+         * Rebuilds the hierarchy order if needed.
+         * @see @ref objectIds()
+         */
+        Containers::ArrayView<const MatrixType> transformations();
+
+        /**
+         * @brief Absolute transformations in the hierarchy order
+         *
+         * Calls @ref update() in order to have up-to-date data.
+         * @see @ref objectIds()
+         */
+        Containers::ArrayView<const MatrixType> absoluteTransformations();
+
+        /**
+         * @brief Update absolute transformations
+         *
+         * Rebuilds the hierarchy order if needed and recalculates absolute
+         * transformations of all objects that were marked as dirty since the
+         * last call in a single linear sweep. Called implicitly by all
+         * functions that query absolute transformations, calling it
+         * explicitly is only useful to control when the work is done.
+         * @see @ref SceneGraph-FlatScene-hierarchy-order
+         */
+        void update();
+
+    private:
+        friend FlatObject<dimensions, T>;
+
+        typedef Implementation::FlatObjectFlag Flag;
+        typedef Implementation::FlatObjectFlags Flags;
+
+        AbstractObject<dimensions, T>* doScene() override final { return this; }
+        const AbstractObject<dimensions, T>* doScene() const override final { return this; }
+
+        AbstractObject<dimensions, T>* doParent() override final { return nullptr; }
+        const AbstractObject<dimensions, T>* doParent() const override final { return nullptr; }
+
+        MatrixType MAGNUM_SCENEGRAPH_LOCAL doTransformationMatrix() const override final { return {}; }
+        MatrixType MAGNUM_SCENEGRAPH_LOCAL doAbsoluteTransformationMatrix() const override final { return {}; }
+        std::vector<MatrixType> doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects, const MatrixType& finalTransformationMatrix) const override final;
+        void doTransformationMatricesInto(const Containers::Iterable<AbstractObject<dimensions, T>>& objects, const Containers::StridedArrayView1D<MatrixType>& out, const MatrixType& finalTransformationMatrix) const override final;
+        void MAGNUM_SCENEGRAPH_LOCAL transformationMatricesIntoInternal(const char* messagePrefix, const Containers::Iterable<AbstractObject<dimensions, T>>& objects, const Containers::StridedArrayView1D<MatrixType>& out, const MatrixType& finalTransformationMatrix) const;
+
+        bool MAGNUM_SCENEGRAPH_LOCAL doIsDirty() const override final { return _dirty; }
+        void doSetDirty() override final;
+        void doSetClean() override final;
+        void doSetClean(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects) override final;
+
+        void MAGNUM_SCENEGRAPH_LOCAL setDirtyInternal(UnsignedInt position);
+        void MAGNUM_SCENEGRAPH_LOCAL setCleanInternal(UnsignedInt position);
+        void MAGNUM_SCENEGRAPH_LOCAL rebuildOrder();
+        static void MAGNUM_SCENEGRAPH_LOCAL cleanFeatures(AbstractObject<dimensions, T>& object, const MatrixType& absoluteTransformationMatrix);
+
+        /* All indexed by position in the hierarchy order, except for
+           _objects and _positions, which are indexed by ID */
+        Containers::Array<Containers::Pointer<FlatObject<dimensions, T>>> _objects;
+        Containers::Array<UnsignedInt> _positions;
+        Containers::Array<UnsignedInt> _ids;
+        Containers::Array<Int> _parents;
+        Containers::Array<UnsignedInt> _subtreeSizes;
+        Containers::Array<MatrixType> _transformations;
+        Containers::Array<MatrixType> _absoluteTransformations;
+        Containers::Array<Flags> _flags;
+        /* Range that contains all objects with Flag::TransformationDirty */
+        std::size_t _dirtyBegin{}, _dirtyEnd{};
+        /* If set, the data aren't in the hierarchy order and _subtreeSizes
+           aren't valid */
+        bool _orderDirty{};
+        /* Dirty flag of the scene itself, for features attached to it */
+        bool _dirty{true};
+};
+
+/**
+@brief Two-dimensional flat scene
+@m_since_latest
+
+Convenience alternative to @cpp FlatScene<2, T> @ce. See @ref FlatScene for
+more information.
+@see @ref FlatScene2D, @ref BasicFlatScene3D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicFlatScene2D = FlatScene<2, T>;
+#endif
+
+/**
+@brief Two-dimensional float flat scene
+@m_since_latest
+
+@see @ref FlatScene3D
+*/
+typedef BasicFlatScene2D<Float> FlatScene2D;
+
+/**
+@brief Three-dimensional flat scene
+@m_since_latest
+
+Convenience alternative to @cpp FlatScene<3, T> @ce. See @ref FlatScene for
+more information.
+@see @ref FlatScene3D, @ref BasicFlatScene2D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicFlatScene3D = FlatScene<3, T>;
+#endif
+
+/**
+@brief Three-dimensional float flat scene
+@m_since_latest
+
+@see @ref FlatScene2D
+*/
+typedef BasicFlatScene3D<Float> FlatScene3D;
+
+/**
+@brief Object in a two-dimensional flat scene
+@m_since_latest
+
+Convenience alternative to @cpp FlatObject<2, T> @ce. See @ref FlatObject
+for more information.
+@see @ref FlatObject2D, @ref BasicFlatObject3D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicFlatObject2D = FlatObject<2, T>;
+#endif
+
+/**
+@brief Object in a two-dimensional float flat scene
+@m_since_latest
+
+@see @ref FlatObject3D
+*/
+typedef BasicFlatObject2D<Float> FlatObject2D;
+
+/**
+@brief Object in a three-dimensional flat scene
+@m_since_latest
+
+Convenience alternative to @cpp FlatObject<3, T> @ce. See @ref FlatObject
+for more information.
+@see @ref FlatObject3D, @ref BasicFlatObject2D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicFlatObject3D = FlatObject<3, T>;
+#endif
+
+/**
+@brief Object in a three-dimensional float flat scene
+@m_since_latest
+
+@see @ref FlatObject2D
+*/
+typedef BasicFlatObject3D<Float> FlatObject3D;
+
+#if defined(CORRADE_TARGET_WINDOWS) && !(defined(CORRADE_TARGET_MINGW) && !defined(CORRADE_TARGET_CLANG))
+extern template class MAGNUM_SCENEGRAPH_EXPORT FlatObject<2, Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT FlatObject<3, Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT FlatScene<2, Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT FlatScene<3, Float>;
+#endif
+
+}}
+
+#endif
@@ -0,0 +1,480 @@
+#ifndef Magnum_SceneGraph_FlatScene_hpp
+#define Magnum_SceneGraph_FlatScene_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref FlatScene.h
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/SceneGraph/FlatScene.h"
+
+namespace Magnum { namespace SceneGraph {
+
+template<UnsignedInt dimensions, class T> FlatObject<dimensions, T>::FlatObject(FlatScene<dimensions, T>& scene, const UnsignedInt id): _scene(scene), _id{id} {}
+
+template<UnsignedInt dimensions, class T> FlatObject<dimensions, T>* FlatObject<dimensions, T>::parent() {
+    /* Positions are consistent even if the order is dirty, so no need to
+       rebuild it here */
+    const Int parent = _scene._parents[_scene._positions[_id]];
+    return parent == -1 ? nullptr : _scene._objects[_scene._ids[parent]].get();
+}
+
+template<UnsignedInt dimensions, class T> const FlatObject<dimensions, T>* FlatObject<dimensions, T>::parent() const {
+    return const_cast<FlatObject<dimensions, T>&>(*this).parent();
+}
+
+template<UnsignedInt dimensions, class T> AbstractObject<dimensions, T>* FlatObject<dimensions, T>::doScene() {
+    return &_scene;
+}
+
+template<UnsignedInt dimensions, class T> const AbstractObject<dimensions, T>* FlatObject<dimensions, T>::doScene() const {
+    return &_scene;
+}
+
+template<UnsignedInt dimensions, class T> AbstractObject<dimensions, T>* FlatObject<dimensions, T>::doParent() {
+    FlatObject<dimensions, T>* const parent = this->parent();
+    if(!parent) return &_scene;
+    return parent;
+}
+
+template<UnsignedInt dimensions, class T> const AbstractObject<dimensions, T>* FlatObject<dimensions, T>::doParent() const {
+    return const_cast<FlatObject<dimensions, T>&>(*this).doParent();
+}
+
+template<UnsignedInt dimensions, class T> FlatObject<dimensions, T>& FlatObject<dimensions, T>::setParent(FlatObject<dimensions, T>* const parent) {
+    CORRADE_ASSERT(!parent || &parent->_scene == &_scene,
+        "SceneGraph::FlatObject::setParent(): the parent is from a different scene", *this);
+
+    /* Positions are consistent even if the order is dirty, so no need to
+       rebuild it here */
+    const UnsignedInt position = _scene._positions[_id];
+    const Int parentPosition = parent ? Int(_scene._positions[parent->_id]) : -1;
+    if(_scene._parents[position] == parentPosition) return *this;
+
+    /* Object cannot be parented to itself or its child */
+    #ifndef CORRADE_NO_ASSERT
+    for(Int p = parentPosition; p != -1; p = _scene._parents[p])
+        CORRADE_ASSERT(p != Int(position),
+            "SceneGraph::FlatObject::setParent(): can't parent an object to itself or its child", *this);
+    #endif
+
+    /* The whole subtree gets marked as dirty once the order is rebuilt */
+    _scene._parents[position] = parentPosition;
+    _scene._flags[position] |= Implementation::FlatObjectFlag::Propagate;
+    _scene._orderDirty = true;
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> auto FlatObject<dimensions, T>::transformation() const -> MatrixType {
+    return _scene._transformations[_scene._positions[_id]];
+}
+
+template<UnsignedInt dimensions, class T> FlatObject<dimensions, T>& FlatObject<dimensions, T>::setTransformation(const MatrixType& transformation) {
+    const UnsignedInt position = _scene._positions[_id];
+    _scene._transformations[position] = transformation;
+    _scene.setDirtyInternal(position);
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> auto FlatObject<dimensions, T>::absoluteTransformation() const -> MatrixType {
+    _scene.update();
+    return _scene._absoluteTransformations[_scene._positions[_id]];
+}
+
+template<UnsignedInt dimensions, class T> bool FlatObject<dimensions, T>::isDirty() const {
+    /* Objects that got reparented get marked as dirty only when the order is
+       rebuilt */
+    if(_scene._orderDirty) _scene.rebuildOrder();
+    return !!(_scene._flags[_scene._positions[_id]] & Implementation::FlatObjectFlag::Dirty);
+}
+
+template<UnsignedInt dimensions, class T> void FlatObject<dimensions, T>::setDirty() {
+    _scene.setDirtyInternal(_scene._positions[_id]);
+}
+
+template<UnsignedInt dimensions, class T> void FlatObject<dimensions, T>::setClean() {
+    /* Rebuilds the order if needed, so the position has to be queried only
+       after */
+    _scene.update();
+    _scene.setCleanInternal(_scene._positions[_id]);
+}
+
+template<UnsignedInt dimensions, class T> auto FlatObject<dimensions, T>::doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects, const MatrixType& finalTransformationMatrix) const -> std::vector<MatrixType> {
+    return _scene.transformationMatrices(objects, finalTransformationMatrix);
+}
+
+template<UnsignedInt dimensions, class T> void FlatObject<dimensions, T>::doTransformationMatricesInto(const Containers::Iterable<AbstractObject<dimensions, T>>& objects, const Containers::StridedArrayView1D<MatrixType>& out, const MatrixType& finalTransformationMatrix) const {
+    _scene.transformationMatricesInto(objects, out, finalTransformationMatrix);
+}
+
+template<UnsignedInt dimensions, class T> void FlatObject<dimensions, T>::doSetClean(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects) {
+    _scene.doSetClean(objects);
+}
+
+template<UnsignedInt dimensions, class T> FlatScene<dimensions, T>::FlatScene() = default;
+
+template<UnsignedInt dimensions, class T> FlatScene<dimensions, T>::~FlatScene() = default;
+
+template<UnsignedInt dimensions, class T> FlatObject<dimensions, T>& FlatScene<dimensions, T>::object(const UnsignedInt id) {
+    CORRADE_ASSERT(id < _objects.size(),
+        "SceneGraph::FlatScene::object(): index" << id << "out of range for" << _objects.size() << "objects", *_objects[0]);
+    return *_objects[id];
+}
+
+template<UnsignedInt dimensions, class T> const FlatObject<dimensions, T>& FlatScene<dimensions, T>::object(const UnsignedInt id) const {
+    return const_cast<FlatScene<dimensions, T>&>(*this).object(id);
+}
+
+template<UnsignedInt dimensions, class T> void FlatScene<dimensions, T>::reserve(const std::size_t capacity) {
+    arrayReserve(_objects, capacity);
+    arrayReserve(_positions, capacity);
+    arrayReserve(_ids, capacity);
+    arrayReserve(_parents, capacity);
+    arrayReserve(_subtreeSizes, capacity);
+    arrayReserve(_transformations, capacity);
+    arrayReserve(_absoluteTransformations, capacity);
+    arrayReserve(_flags, capacity);
+}
+
+template<UnsignedInt dimensions, class T> FlatObject<dimensions, T>& FlatScene<dimensions, T>::addObject(FlatObject<dimensions, T>* const parent) {
+    CORRADE_ASSERT(!parent || &parent->_scene == this,
+        "SceneGraph::FlatScene::addObject(): the parent is from a different scene", *parent);
+    CORRADE_ASSERT(_objects.size() < 0x7fffffffu,
+        "SceneGraph::FlatScene::addObject(): too large scene", *_objects.back());
+
+    /* The new object is always put at the end */
+    const UnsignedInt id = _objects.size();
+    const Int parentPosition = parent ? Int(_positions[parent->_id]) : -1;
+    arrayAppend(_objects, Containers::Pointer<FlatObject<dimensions, T>>{new FlatObject<dimensions, T>{*this, id}});
+    arrayAppend(_positions, id);
+    arrayAppend(_ids, id);
+    arrayAppend(_parents, parentPosition);
+    arrayAppend(_subtreeSizes, 1u);
+    arrayAppend(_transformations, MatrixType{});
+    arrayAppend(_absoluteTransformations, MatrixType{});
+    arrayAppend(_flags, Flag::TransformationDirty|Flag::Dirty);
+
+    /* If the order is already dirty, nothing else to do */
+    if(_orderDirty) return *_objects.back();
+
+    /* If the object is at the root or the parent subtree ends right before
+       the new object, the order stays valid. The subtree of each grandparent
+       then ends right before the new object as well, so they all just get
+       enlarged by one. */
+    if(parentPosition == -1 || parentPosition + _subtreeSizes[parentPosition] == id) {
+        for(Int p = parentPosition; p != -1; p = _parents[p])
+            ++_subtreeSizes[p];
+        if(_dirtyBegin == _dirtyEnd) _dirtyBegin = id;
+        _dirtyEnd = id + 1;
+
+    /* Otherwise the order needs to be rebuilt */
+    } else _orderDirty = true;
+
+    return *_objects.back();
+}
+
+template<UnsignedInt dimensions, class T> Containers::ArrayView<const UnsignedInt> FlatScene<dimensions, T>::objectIds() {
+    if(_orderDirty) rebuildOrder();
+    return _ids;
+}
+
+template<UnsignedInt dimensions, class T> Containers::ArrayView<const Int> FlatScene<dimensions, T>::parents() {
+    if(_orderDirty) rebuildOrder();
+    return _parents;
+}
+
+template<UnsignedInt dimensions, class T> auto FlatScene<dimensions, T>::transformations() -> Containers::ArrayView<const MatrixType> {
+    if(_orderDirty) rebuildOrder();
+    return _transformations;
+}
+
+template<UnsignedInt dimensions, class T> auto FlatScene<dimensions, T>::absoluteTransformations() -> Containers::ArrayView<const MatrixType> {
+    update();
+    return _absoluteTransformations;
+}
+
+template<UnsignedInt dimensions, class T> void FlatScene<dimensions, T>::update() {
+    if(_orderDirty) rebuildOrder();
+
+    /* Parents are always before children, so by the time a child is reached,
+       the parent absolute transformation is already up-to-date. Whole
+       subtrees get marked as dirty at once, so there's no need to propagate
+       the dirty flag from parents here. */
+    for(std::size_t i = _dirtyBegin; i != _dirtyEnd; ++i) {
+        if(!(_flags[i] & Flag::TransformationDirty)) continue;
+
+        const Int parent = _parents[i];
+        _absoluteTransformations[i] = parent == -1 ? _transformations[i] :
+            _absoluteTransformations[parent]*_transformations[i];
+        _flags[i] &= ~Flag::TransformationDirty;
+    }
+
+    _dirtyBegin = _dirtyEnd = 0;
+}
+
+template<UnsignedInt dimensions, class T> void FlatScene<dimensions, T>::setDirtyInternal(const UnsignedInt position) {
+    /* If the order is dirty, subtree sizes aren't known. Mark just the object
+       itself, its children get marked once the order is rebuilt. */
+    if(_orderDirty) {
+        _flags[position] |= Flag::TransformationDirty|Flag::Propagate;
+        return;
+    }
+
+    /* Each object is directly followed by all its children, so mark the whole
+       range. If an object is dirty, all its children are dirty as well, so
+       if the object already has given flag set, the range doesn't need to be
+       marked again. */
+    const std::size_t end = position + _subtreeSizes[position];
+    if(!(_flags[position] & Flag::TransformationDirty)) {
+        for(std::size_t i = position; i != end; ++i)
+            _flags[i] |= Flag::TransformationDirty;
+
+        if(_dirtyBegin == _dirtyEnd) {
+            _dirtyBegin = position;
+            _dirtyEnd = end;
+        } else {
+            _dirtyBegin = Math::min(_dirtyBegin, std::size_t(position));
+            _dirtyEnd = Math::max(_dirtyEnd, end);
+        }
+    }
+
+    if(!(_flags[position] & Flag::Dirty)) for(std::size_t i = position; i != end; ++i) {
+        if(_flags[i] & Flag::Dirty) continue;
+
+        for(AbstractFeature<dimensions, T>& feature: _objects[_ids[i]]->features())
+            feature.markDirty();
+        _flags[i] |= Flag::Dirty;
+    }
+}
+
+template<UnsignedInt dimensions, class T> void FlatScene<dimensions, T>::setCleanInternal(const UnsignedInt position) {
+    /* If a parent is clean, all its parents are clean as well, so go up only
+       until a clean object is found. Expects that update() was called
+       before. */
+    for(Int i = position; i != -1 && (_flags[i] & Flag::Dirty); i = _parents[i]) {
+        cleanFeatures(*_objects[_ids[i]], _absoluteTransformations[i]);
+        _flags[i] &= ~Flag::Dirty;
+    }
+}
+
+template<UnsignedInt dimensions, class T> void FlatScene<dimensions, T>::cleanFeatures(AbstractObject<dimensions, T>& object, const MatrixType& absoluteTransformationMatrix) {
+    /* Same as Object::setCleanInternal(), calculating the inverse lazily */
+    bool invertedCalculated = false;
+    MatrixType invertedAbsoluteTransformationMatrix;
+    for(AbstractFeature<dimensions, T>& feature: object.features()) {
+        if(feature.cachedTransformations() & CachedTransformation::Absolute)
+            feature.clean(absoluteTransformationMatrix);
+
+        if(feature.cachedTransformations() & CachedTransformation::InvertedAbsolute) {
+            if(!invertedCalculated) {
+                invertedCalculated = true;
+                invertedAbsoluteTransformationMatrix = absoluteTransformationMatrix.inverted();
+            }
+
+            feature.cleanInverted(invertedAbsoluteTransformationMatrix);
+        }
+    }
+}
+
+template<UnsignedInt dimensions, class T> void FlatScene<dimensions, T>::rebuildOrder() {
+    const std::size_t count = _objects.size();
+
+    /* Gather children of each object, preserving their relative order, with
+       index 0 being objects directly in the scene. The counts are shifted by
+       two so that after the prefix sum the slot one after each bucket holds
+       its start, and after placing the children there it holds the start of
+       the next bucket. Children of object at position i are thus in the
+       [childOffsets[i + 1], childOffsets[i + 2]) range of the children
+       array. */
+    Containers::Array<UnsignedInt> childOffsets{ValueInit, count + 3};
+    for(std::size_t i = 0; i != count; ++i)
+        ++childOffsets[_parents[i] + 3];
+    for(std::size_t i = 1; i != childOffsets.size(); ++i)
+        childOffsets[i] += childOffsets[i - 1];
+    Containers::Array<UnsignedInt> children{NoInit, count};
+    for(std::size_t i = 0; i != count; ++i)
+        children[childOffsets[_parents[i] + 2]++] = UnsignedInt(i);
+
+    /* Go breadth-first through the hierarchy to have parents ordered before
+       children. The same is done by SceneTools::orderClusterParents(). */
+    Containers::Array<UnsignedInt> breadthFirst{NoInit, count};
+    std::size_t breadthFirstCount = 0;
+    for(std::size_t i = childOffsets[0]; i != childOffsets[1]; ++i)
+        breadthFirst[breadthFirstCount++] = children[i];
+    for(std::size_t i = 0; i != breadthFirstCount; ++i)
+        for(std::size_t j = childOffsets[breadthFirst[i] + 1], end = childOffsets[breadthFirst[i] + 2]; j != end; ++j)
+            breadthFirst[breadthFirstCount++] = children[j];
+    CORRADE_INTERNAL_ASSERT(breadthFirstCount == count);
+
+    /* Calculate subtree sizes from the leafs up */
+    for(UnsignedInt& i: _subtreeSizes) i = 1;
+    for(std::size_t i = count; i != 0; --i) {
+        const UnsignedInt object = breadthFirst[i - 1];
+        if(_parents[object] != -1)
+            _subtreeSizes[_parents[object]] += _subtreeSizes[object];
+    }
+
+    /* Assign depth-first positions from the root down. Each object is
+       directly followed by its first child, then by the rest of the first
+       child subtree, then by the second child etc. */
+    Containers::Array<UnsignedInt> newPositions{NoInit, count};
+    {
+        UnsignedInt next = 0;
+        for(std::size_t i = childOffsets[0]; i != childOffsets[1]; ++i) {
+            newPositions[children[i]] = next;
+            next += _subtreeSizes[children[i]];
+        }
+    }
+    for(const UnsignedInt object: breadthFirst) {
+        UnsignedInt next = newPositions[object] + 1;
+        for(std::size_t j = childOffsets[object + 1], end = childOffsets[object + 2]; j != end; ++j) {
+            newPositions[children[j]] = next;
+            next += _subtreeSizes[children[j]];
+        }
+    }
+
+    /* Permute the data. Absolute transformations get all recalculated below,
+       so they don't need to be moved. */
+    {
+        Containers::Array<UnsignedInt> ids{NoInit, count};
+        Containers::Array<Int> parents{NoInit, count};
+        Containers::Array<UnsignedInt> subtreeSizes{NoInit, count};
+        Containers::Array<MatrixType> transformations{NoInit, count};
+        Containers::Array<Flags> flags{NoInit, count};
+        for(std::size_t i = 0; i != count; ++i) {
+            const UnsignedInt position = newPositions[i];
+            ids[position] = _ids[i];
+            parents[position] = _parents[i] == -1 ? -1 : Int(newPositions[_parents[i]]);
+            subtreeSizes[position] = _subtreeSizes[i];
+            transformations[position] = _transformations[i];
+            flags[position] = _flags[i];
+            _positions[_ids[i]] = position;
+        }
+        Utility::copy(ids, _ids);
+        Utility::copy(parents, _parents);
+        Utility::copy(subtreeSizes, _subtreeSizes);
+        Utility::copy(transformations, _transformations);
+        Utility::copy(flags, _flags);
+    }
+
+    /* Propagate the dirty flag from reparented and changed objects to all
+       their children, notify the features */
+    for(std::size_t i = 0; i != count; ++i) {
+        if(_parents[i] != -1 && (_flags[_parents[i]] & Flag::Propagate))
+            _flags[i] |= Flag::Propagate;
+    }
+    for(std::size_t i = 0; i != count; ++i) {
+        if(!(_flags[i] & Flag::Propagate)) continue;
+
+        _flags[i] &= ~Flag::Propagate;
+        if(_flags[i] & Flag::Dirty) continue;
+
+        for(AbstractFeature<dimensions, T>& feature: _objects[_ids[i]]->features())
+            feature.markDirty();
+        _flags[i] |= Flag::Dirty;
+    }
+
+    /* Recalculate all absolute transformations, as that has the same
+       complexity as figuring out which are the dirty ones */
+    for(Flags& i: _flags) i |= Flag::TransformationDirty;
+    _dirtyBegin = 0;
+    _dirtyEnd = count;
+    _orderDirty = false;
+}
+
+template<UnsignedInt dimensions, class T> auto FlatScene<dimensions, T>::doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects, const MatrixType& finalTransformationMatrix) const -> std::vector<MatrixType> {
+    std::vector<MatrixType> transformationMatrices(objects.size());
+    transformationMatricesIntoInternal("SceneGraph::FlatScene::transformationMatrices():", Implementation::iterableReferenceWrappers<AbstractObject<dimensions, T>>(objects), Containers::stridedArrayView(transformationMatrices.data(), transformationMatrices.size()), finalTransformationMatrix);
+    return transformationMatrices;
+}
+
+template<UnsignedInt dimensions, class T> void FlatScene<dimensions, T>::doTransformationMatricesInto(const Containers::Iterable<AbstractObject<dimensions, T>>& objects, const Containers::StridedArrayView1D<MatrixType>& out, const MatrixType& finalTransformationMatrix) const {
+    transformationMatricesIntoInternal("SceneGraph::FlatScene::transformationMatricesInto():", objects, out, finalTransformationMatrix);
+}
+
+template<UnsignedInt dimensions, class T> void FlatScene<dimensions, T>::transformationMatricesIntoInternal(const char* const messagePrefix, const Containers::Iterable<AbstractObject<dimensions, T>>& objects, const Containers::StridedArrayView1D<MatrixType>& out, const MatrixType& finalTransformationMatrix) const {
+    CORRADE_ASSERT(out.size() == objects.size(),
+        messagePrefix << "expected" << objects.size() << "output items but got" << out.size(), );
+
+    FlatScene<dimensions, T>& self = const_cast<FlatScene<dimensions, T>&>(*this);
+    self.update();
+
+    /* With all absolute transformations being up-to-date, it's just a lookup
+       for each object */
+    for(std::size_t i = 0; i != objects.size(); ++i) {
+        AbstractObject<dimensions, T>& object = objects[i];
+        if(&object == this) {
+            out[i] = finalTransformationMatrix;
+            continue;
+        }
+
+        CORRADE_ASSERT(object.scene() == this,
+            messagePrefix << "the objects are not part of the same scene", );
+        const UnsignedInt id = static_cast<FlatObject<dimensions, T>&>(object)._id;
+        out[i] = finalTransformationMatrix*_absoluteTransformations[_positions[id]];
+    }
+}
+
+template<UnsignedInt dimensions, class T> void FlatScene<dimensions, T>::doSetDirty() {
+    if(_dirty) return;
+
+    for(AbstractFeature<dimensions, T>& feature: this->features())
+        feature.markDirty();
+    _dirty = true;
+}
+
+template<UnsignedInt dimensions, class T> void FlatScene<dimensions, T>::doSetClean() {
+    if(!_dirty) return;
+
+    cleanFeatures(*this, MatrixType{});
+    _dirty = false;
+}
+
+template<UnsignedInt dimensions, class T> void FlatScene<dimensions, T>::doSetClean(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects) {
+    /* Update all absolute transformations at once, after that cleaning each
+       object is just going through its features */
+    update();
+    for(AbstractObject<dimensions, T>& object: objects) {
+        if(&object == this) {
+            doSetClean();
+            continue;
+        }
+
+        CORRADE_ASSERT(object.scene() == this,
+            "SceneGraph::FlatScene::setClean(): the objects are not part of the same scene", );
+        setCleanInternal(_positions[static_cast<FlatObject<dimensions, T>&>(object)._id]);
+    }
+}
+
+}}
+
+#endif
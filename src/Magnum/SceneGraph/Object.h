@@ -294,10 +294,21 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
          * @p finalTransformationMatrix, if specified (it gets applied on the
          * left-most side, suitable for example for an inverse camera
          * transformation or a projection matrix).
-         * @see @ref transformations()
+         * @see @ref transformations(), @ref transformationMatricesInto()
          */
         std::vector<MatrixType> transformationMatrices(const std::vector<std::reference_wrapper<Object<Transformation>>>& objects, const MatrixType& finalTransformationMatrix = MatrixType()) const;
 
+        /**
+         * @brief Put transformation matrices of given set of objects relative to this object into a view
+         * @m_since_latest
+         *
+         * Like @ref transformationMatrices(), but puts the result into
+         * @p out instead of allocating a new array. Expects that @p out has
+         * the same size as @p objects. See @ref transformationsInto() for
+         * details about memory use.
+         */
+        void transformationMatricesInto(const Containers::Iterable<Object<Transformation>>& objects, const Containers::StridedArrayView1D<MatrixType>& out, const MatrixType& finalTransformationMatrix = MatrixType()) const;
+
         /**
          * @brief Transformations of given group of objects relative to this object
          *
@@ -305,11 +316,9 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
          * @p finalTransformation, if specified (it gets applied on the
          * left-most side, suitable for example for an inverse camera
          * transformation).
-         * @see @ref transformationMatrices()
+         * @see @ref transformationMatrices(), @ref transformationsInto()
          */
-        /* `objects` passed by copy intentionally (to allow move from
-           transformationMatrices() and avoid copy in the function itself) */
-        std::vector<typename Transformation::DataType> transformations(std::vector<std::reference_wrapper<Object<Transformation>>> objects, const typename Transformation::DataType& finalTransformation =
+        std::vector<typename Transformation::DataType> transformations(const std::vector<std::reference_wrapper<Object<Transformation>>>& objects, const typename Transformation::DataType& finalTransformation =
             #ifndef CORRADE_MSVC2015_COMPATIBILITY /* I hate this inconsistency */
             typename Transformation::DataType()
             #else
@@ -317,6 +326,28 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
             #endif
             ) const;
 
+        /**
+         * @brief Put transformations of given group of objects relative to this object into a view
+         * @m_since_latest
+         *
+         * Like @ref transformations(), but puts the result into @p out
+         * instead of allocating a new array. Expects that @p out has the same
+         * size as @p objects. Memory for temporary data is owned by the
+         * @ref Scene and reused across calls, so once it's large enough for
+         * given object count, this function doesn't allocate. Compared to
+         * calling @ref absoluteTransformation() on each object, the
+         * transformation of every object in the hierarchy is composed only
+         * once.
+         * @see @ref transformationMatricesInto()
+         */
+        void transformationsInto(const Containers::Iterable<Object<Transformation>>& objects, const Containers::StridedArrayView1D<typename Transformation::DataType>& out, const typename Transformation::DataType& finalTransformation =
+            #ifndef CORRADE_MSVC2015_COMPATIBILITY
+            typename Transformation::DataType()
+            #else
+            Transformation::DataType()
+            #endif
+            ) const;
+
         /* Since 1.8.17, the original short-hand group closing doesn't work
            anymore. FFS. */
         /**
@@ -332,11 +363,25 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
         /**
          * @brief Clean absolute transformations of given set of objects
          *
-         * Only dirty objects in the list are cleaned.
+         * Only dirty objects in the list are cleaned. Memory for temporary
+         * data is owned by the @ref Scene and reused across calls, so once
+         * it's large enough for given object count, this function doesn't
+         * allocate.
          * @see @ref setClean()
          */
-        /* `objects` passed by copy intentionally (to avoid copy internally) */
-        static void setClean(std::vector<std::reference_wrapper<Object<Transformation>>> objects);
+        static void setClean(const Containers::Iterable<Object<Transformation>>& objects);
+
+        /**
+         * @brief Clean absolute transformations of given set of objects
+         *
+         * Equivalent to calling @ref setClean(const Containers::Iterable<Object<Transformation>>&)
+         * with the same list.
+         */
+        /* A template in order to make braced initializer lists pick the
+           Iterable overload instead of being ambiguous */
+        template<class Allocator> static void setClean(const std::vector<std::reference_wrapper<Object<Transformation>>, Allocator>& objects) {
+            setClean(Implementation::iterableReferenceWrappers<Object<Transformation>>(objects));
+        }
 
         /** @copydoc AbstractObject::isDirty() */
         bool isDirty() const { return !!(flags & Flag::Dirty); }
@@ -352,7 +397,7 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
          * calls @ref setClean() on every parent which is not already clean. If
          * the object is already clean, the function does nothing.
          *
-         * See also @ref setClean(std::vector<std::reference_wrapper<Object<Transformation>>>),
+         * See also @ref setClean(const Containers::Iterable<Object<Transformation>>&),
          * which cleans given set of objects more efficiently than when calling
          * @ref setClean() on each object individually.
          * @see @ref scenegraph-features-caching, @ref setDirty(),
@@ -401,8 +446,13 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
         }
 
         std::vector<MatrixType> doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects, const MatrixType& finalTransformationMatrix) const override final;
+        void doTransformationMatricesInto(const Containers::Iterable<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>& objects, const Containers::StridedArrayView1D<MatrixType>& out, const MatrixType& finalTransformationMatrix) const override final;
+
+        /* U is either Object or AbstractObject, Convert converts the
+           transformation to the output type */
+        template<class U, class V, class Convert> void MAGNUM_SCENEGRAPH_LOCAL transformationsIntoInternal(const char* messagePrefix, const Containers::Iterable<U>& objects, const Containers::StridedArrayView1D<V>& out, const typename Transformation::DataType& finalTransformation, Convert convert) const;
 
-        typename Transformation::DataType MAGNUM_SCENEGRAPH_LOCAL computeJointTransformation(const std::vector<std::reference_wrapper<Object<Transformation>>>& jointObjects, std::vector<typename Transformation::DataType>& jointTransformations, const std::size_t joint, const typename Transformation::DataType& finalTransformation) const;
+        typename Transformation::DataType MAGNUM_SCENEGRAPH_LOCAL computeJointTransformation(Object<Transformation>* const* jointObjects, typename Transformation::DataType* jointTransformations, const std::size_t joint, const typename Transformation::DataType& finalTransformation) const;
 
         bool MAGNUM_SCENEGRAPH_LOCAL doIsDirty() const override final { return isDirty(); }
         void MAGNUM_SCENEGRAPH_LOCAL doSetDirty() override final { setDirty(); }
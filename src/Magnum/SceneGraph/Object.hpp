@@ -30,18 +30,51 @@
  * @brief @ref compilation-speedup-hpp "Template implementation" for @ref AbstractObject.h, @ref AbstractTransformation.h and @ref Object.h
  */
 
-#include <algorithm> /* std::remove_if() */
-#include <stack>
+#include <Corrade/Containers/StridedArrayView.h>
 
+#include "Magnum/Math/Functions.h"
 #include "Magnum/SceneGraph/AbstractTransformation.h"
 #include "Magnum/SceneGraph/Object.h"
 #include "Magnum/SceneGraph/Scene.h"
 
 namespace Magnum { namespace SceneGraph {
 
+namespace Implementation {
+    /* Makes the array at least `size` items large, discarding its previous
+       contents. Grows by at least a factor of two to amortize the
+       allocations, never shrinks. */
+    template<class T> void growScratchArray(Containers::Array<T>& array, const std::size_t size) {
+        if(array.size() < size)
+            array = Containers::Array<T>{NoInit, Math::max(size, 2*array.size())};
+    }
+
+    /* Enlarges the array by at least a factor of two, preserving the first
+       `count` items. Used when the final size isn't known upfront. */
+    template<class T> void enlargeScratchArray(Containers::Array<T>& array, const std::size_t count) {
+        Containers::Array<T> enlarged{NoInit, Math::max(std::size_t{16}, 2*array.size())};
+        for(std::size_t i = 0; i != count; ++i)
+            enlarged[i] = array[i];
+        array = std::move(enlarged);
+    }
+}
+
 template<UnsignedInt dimensions, class T> AbstractObject<dimensions, T>::AbstractObject() {}
 template<UnsignedInt dimensions, class T> AbstractObject<dimensions, T>::~AbstractObject() {}
 
+template<UnsignedInt dimensions, class T> void AbstractObject<dimensions, T>::doTransformationMatricesInto(const Containers::Iterable<AbstractObject<dimensions, T>>& objects, const Containers::StridedArrayView1D<MatrixType>& out, const MatrixType& finalTransformationMatrix) const {
+    CORRADE_ASSERT(out.size() == objects.size(),
+        "SceneGraph::AbstractObject::transformationMatricesInto(): expected" << objects.size() << "output items but got" << out.size(), );
+
+    std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>> objectList;
+    objectList.reserve(objects.size());
+    for(AbstractObject<dimensions, T>& object: objects)
+        objectList.push_back(object);
+
+    const std::vector<MatrixType> transformationMatrices = doTransformationMatrices(objectList, finalTransformationMatrix);
+    for(std::size_t i = 0; i != transformationMatrices.size(); ++i)
+        out[i] = transformationMatrices[i];
+}
+
 template<UnsignedInt dimensions, class T> AbstractTransformation<dimensions, T>::AbstractTransformation() {}
 
 template<class Transformation> Object<Transformation>::Object(Object<Transformation>* parent): counter{~UnsignedInt{}}, flags{Flag::Dirty} {
@@ -138,57 +171,73 @@ template<class Transformation> void Object<Transformation>::setClean() {
     /* The object (and all its parents) are already clean, nothing to do */
     if(!(flags & Flag::Dirty)) return;
 
-    /* Collect all parents, compute base transformation */
-    std::stack<Object<Transformation>*> objects;
-    typename Transformation::DataType absoluteTransformation;
-    Object<Transformation>* p = static_cast<Object<Transformation>*>(this);
-    for(;;) {
-        objects.push(p);
-
-        p = p->parent();
-
-        /* On root object, base transformation is identity */
-        if(!p) break;
-
-        /* Parent object is clean, base transformation is its absolute
-           transformation */
-        if(!p->isDirty()) {
-            absoluteTransformation = p->absoluteTransformation();
-            break;
-        }
+    /* Collect the object and all its dirty parents, going up until a clean
+       object or the root is reached. Reusing the scene temporary memory as an
+       explicit stack in order to avoid an allocation and stack usage
+       proportional to the hierarchy depth. Objects that aren't part of any
+       scene have to allocate. The memory is taken out of the scene for the
+       duration of the call in case a feature calls setClean() recursively
+       from its clean() or cleanInverted(). */
+    Scene<Transformation>* const scene = this->scene();
+    Containers::Array<Object<Transformation>*> cleanObjects;
+    if(scene) cleanObjects = std::move(scene->_cleanObjects);
+    std::size_t cleanObjectCount = 0;
+    for(Object<Transformation>* o = this; o && o->isDirty(); o = o->parent()) {
+        if(cleanObjectCount == cleanObjects.size())
+            Implementation::enlargeScratchArray(cleanObjects, cleanObjectCount);
+        cleanObjects[cleanObjectCount++] = o;
     }
 
-    /* Clean features on every collected object, going down from root object */
-    while(!objects.empty()) {
-        Object<Transformation>* o = objects.top();
-        objects.pop();
-
-        /* Compose transformation and clean object */
+    /* Base transformation is identity on the root object and absolute
+       transformation of the clean parent otherwise. Then clean the collected
+       objects from the topmost down, each composing its transformation with
+       the parent one. */
+    Object<Transformation>* const parent = cleanObjects[cleanObjectCount - 1]->parent();
+    typename Transformation::DataType absoluteTransformation = parent ?
+        parent->absoluteTransformation() : typename Transformation::DataType{};
+    for(std::size_t i = cleanObjectCount; i != 0; --i) {
+        Object<Transformation>* const o = cleanObjects[i - 1];
         absoluteTransformation = Implementation::Transformation<Transformation>::compose(absoluteTransformation, o->transformation());
         CORRADE_INTERNAL_ASSERT(o->isDirty());
         o->setCleanInternal(absoluteTransformation);
         CORRADE_ASSERT(!o->isDirty(), "SceneGraph::Object::setClean(): original implementation was not called", );
     }
+
+    if(scene) scene->_cleanObjects = std::move(cleanObjects);
 }
 
 template<class Transformation> auto Object<Transformation>::doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects, const MatrixType& finalTransformationMatrix) const -> std::vector<MatrixType> {
-    std::vector<std::reference_wrapper<Object<Transformation>>> castObjects;
-    castObjects.reserve(objects.size());
+    std::vector<MatrixType> transformationMatrices(objects.size());
     /** @todo Ensure this doesn't crash, somehow */
-    for(auto o: objects) castObjects.push_back(static_cast<Object<Transformation>&>(o.get()));
+    transformationsIntoInternal("SceneGraph::Object::transformationMatrices():", Implementation::iterableReferenceWrappers<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>(objects), Containers::stridedArrayView(transformationMatrices.data(), transformationMatrices.size()), Implementation::Transformation<Transformation>::fromMatrix(finalTransformationMatrix), Implementation::Transformation<Transformation>::toMatrix);
+    return transformationMatrices;
+}
 
-    return transformationMatrices(std::move(castObjects), finalTransformationMatrix);
+template<class Transformation> void Object<Transformation>::doTransformationMatricesInto(const Containers::Iterable<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>& objects, const Containers::StridedArrayView1D<MatrixType>& out, const MatrixType& finalTransformationMatrix) const {
+    /** @todo Ensure this doesn't crash, somehow */
+    transformationsIntoInternal("SceneGraph::Object::transformationMatricesInto():", objects, out, Implementation::Transformation<Transformation>::fromMatrix(finalTransformationMatrix), Implementation::Transformation<Transformation>::toMatrix);
 }
 
 template<class Transformation> auto Object<Transformation>::transformationMatrices(const std::vector<std::reference_wrapper<Object<Transformation>>>& objects, const MatrixType& finalTransformationMatrix) const -> std::vector<MatrixType> {
-    std::vector<typename Transformation::DataType> transformations = this->transformations(std::move(objects), Implementation::Transformation<Transformation>::fromMatrix(finalTransformationMatrix));
-    std::vector<MatrixType> transformationMatrices(transformations.size());
-    for(std::size_t i = 0; i != objects.size(); ++i)
-        transformationMatrices[i] = Implementation::Transformation<Transformation>::toMatrix(transformations[i]);
-
+    std::vector<MatrixType> transformationMatrices(objects.size());
+    transformationsIntoInternal("SceneGraph::Object::transformationMatrices():", Implementation::iterableReferenceWrappers<Object<Transformation>>(objects), Containers::stridedArrayView(transformationMatrices.data(), transformationMatrices.size()), Implementation::Transformation<Transformation>::fromMatrix(finalTransformationMatrix), Implementation::Transformation<Transformation>::toMatrix);
     return transformationMatrices;
 }
 
+template<class Transformation> void Object<Transformation>::transformationMatricesInto(const Containers::Iterable<Object<Transformation>>& objects, const Containers::StridedArrayView1D<MatrixType>& out, const MatrixType& finalTransformationMatrix) const {
+    transformationsIntoInternal("SceneGraph::Object::transformationMatricesInto():", objects, out, Implementation::Transformation<Transformation>::fromMatrix(finalTransformationMatrix), Implementation::Transformation<Transformation>::toMatrix);
+}
+
+template<class Transformation> std::vector<typename Transformation::DataType> Object<Transformation>::transformations(const std::vector<std::reference_wrapper<Object<Transformation>>>& objects, const typename Transformation::DataType& finalTransformation) const {
+    std::vector<typename Transformation::DataType> transformations(objects.size());
+    transformationsIntoInternal("SceneGraph::Object::transformations():", Implementation::iterableReferenceWrappers<Object<Transformation>>(objects), Containers::stridedArrayView(transformations.data(), transformations.size()), finalTransformation, [](const typename Transformation::DataType& transformation) { return transformation; });
+    return transformations;
+}
+
+template<class Transformation> void Object<Transformation>::transformationsInto(const Containers::Iterable<Object<Transformation>>& objects, const Containers::StridedArrayView1D<typename Transformation::DataType>& out, const typename Transformation::DataType& finalTransformation) const {
+    transformationsIntoInternal("SceneGraph::Object::transformationsInto():", objects, out, finalTransformation, [](const typename Transformation::DataType& transformation) { return transformation; });
+}
+
 /*
 Computing absolute transformations for given list of objects
 
@@ -202,104 +251,108 @@ divided into two groups:
 Then for all joints their transformation (relative to parent joint) is
 computed and recursively concatenated together. Resulting transformations for
 joints which were originally in `object` list is then returned.
-*/
-template<class Transformation> std::vector<typename Transformation::DataType> Object<Transformation>::transformations(std::vector<std::reference_wrapper<Object<Transformation>>> objects, const typename Transformation::DataType& finalTransformation) const {
-    CORRADE_ASSERT(objects.size() < ~UnsignedInt{}, "SceneGraph::Object::transformations(): too large scene", {});
 
-    /* Remember object count for later */
-    std::size_t objectCount = objects.size();
+Each object in the list walks up the hierarchy, marking the objects as visited,
+until it reaches the root or an already visited object, which then becomes a
+joint. Every walk thus adds at most one joint, which means there's at most
+twice as many joints as there are objects in the list and the temporary memory
+can be preallocated upfront.
+*/
+template<class Transformation> template<class U, class V, class Convert> void Object<Transformation>::transformationsIntoInternal(const char* const messagePrefix, const Containers::Iterable<U>& objects, const Containers::StridedArrayView1D<V>& out, const typename Transformation::DataType& finalTransformation, Convert convert) const {
+    CORRADE_ASSERT(out.size() == objects.size(),
+        messagePrefix << "expected" << objects.size() << "output items but got" << out.size(), );
+    CORRADE_ASSERT(objects.size() < ~UnsignedInt{}/2,
+        messagePrefix << "too large scene", );
+
+    /* Scene object. Nearest common ancestor not yet implemented - assert this
+       is done on scene */
+    const Scene<Transformation>* const scene = this->scene();
+    CORRADE_ASSERT(scene == this,
+        messagePrefix << "currently implemented only for Scene", );
+
+    /* Temporary memory for joint objects and their transformations */
+    const std::size_t objectCount = objects.size();
+    Implementation::growScratchArray(scene->_jointObjects, 2*objectCount);
+    Implementation::growScratchArray(scene->_jointTransformations, 2*objectCount);
+    Object<Transformation>** const jointObjects = scene->_jointObjects.data();
+    typename Transformation::DataType* const jointTransformations = scene->_jointTransformations.data();
 
     /* Mark all original objects as joints and create initial list of joints
        from them */
-    for(std::size_t i = 0; i != objects.size(); ++i) {
+    for(std::size_t i = 0; i != objectCount; ++i) {
+        /** @todo Ensure this doesn't crash, somehow */
+        Object<Transformation>& object = static_cast<Object<Transformation>&>(objects[i]);
+        jointObjects[i] = &object;
+
         /* Multiple occurrences of one object in the array, don't overwrite it
            with different counter */
-        if(objects[i].get().counter != ~UnsignedInt{}) continue;
+        if(object.counter != ~UnsignedInt{}) continue;
 
-        objects[i].get().counter = UnsignedInt(i);
-        objects[i].get().flags |= Flag::Joint;
+        object.counter = UnsignedInt(i);
+        object.flags |= Flag::Joint;
     }
-    std::vector<std::reference_wrapper<Object<Transformation>>> jointObjects(objects);
-
-    #ifndef CORRADE_NO_ASSERT
-    /* Scene object */
-    const Scene<Transformation>* scene = this->scene();
-    #endif
-
-    /* Nearest common ancestor not yet implemented - assert this is done on scene */
-    CORRADE_ASSERT(scene == this, "SceneGraph::Object::transformationMatrices(): currently implemented only for Scene", {});
 
     /* Mark all objects up the hierarchy as visited */
-    auto it = objects.begin();
-    while(!objects.empty()) {
-        /* Already visited, remove and continue to next (duplicate occurrence) */
-        if(it->get().flags & Flag::Visited) {
-            it = objects.erase(it);
-            continue;
-        }
+    std::size_t jointCount = objectCount;
+    for(std::size_t i = 0; i != objectCount; ++i) {
+        Object<Transformation>* o = jointObjects[i];
 
-        /* Mark the object as visited */
-        it->get().flags |= Flag::Visited;
+        /* Already visited, nothing to do (duplicate occurrence) */
+        if(o->flags & Flag::Visited) continue;
 
-        Object<Transformation>* parent = it->get().parent();
+        for(;;) {
+            /* Mark the object as visited */
+            o->flags |= Flag::Visited;
 
-        /* If this is root object, remove from list */
-        if(!parent) {
-            CORRADE_ASSERT(&it->get() == scene, "SceneGraph::Object::transformations(): the objects are not part of the same tree", {});
-            it = objects.erase(it);
-
-        /* Parent is an joint or already visited - remove current from list */
-        } else if(parent->flags & (Flag::Visited|Flag::Joint)) {
-            it = objects.erase(it);
-
-            /* If not already marked as joint, mark it as such and add it to
-               list of joint objects */
-            if(!(parent->flags & Flag::Joint)) {
-                CORRADE_ASSERT(jointObjects.size() < ~UnsignedInt{},
-                               "SceneGraph::Object::transformations(): too large scene", {});
-                CORRADE_INTERNAL_ASSERT(parent->counter == ~UnsignedInt{});
-                parent->counter = UnsignedInt(jointObjects.size());
-                parent->flags |= Flag::Joint;
-                jointObjects.push_back(*parent);
+            Object<Transformation>* parent = o->parent();
+
+            /* If this is root object, done */
+            if(!parent) {
+                CORRADE_ASSERT(o == scene,
+                    messagePrefix << "the objects are not part of the same tree", );
+                break;
             }
 
-        /* Else go up the hierarchy */
-        } else *it = *parent;
+            /* Parent is a joint or already visited, done. If not already
+               marked as joint, mark it as such and add it to list of joint
+               objects */
+            if(parent->flags & (Flag::Visited|Flag::Joint)) {
+                if(!(parent->flags & Flag::Joint)) {
+                    CORRADE_INTERNAL_ASSERT(parent->counter == ~UnsignedInt{} && jointCount < 2*objectCount);
+                    parent->counter = UnsignedInt(jointCount);
+                    parent->flags |= Flag::Joint;
+                    jointObjects[jointCount++] = parent;
+                }
+                break;
+            }
 
-        /* Cycle if reached end */
-        if(it == objects.end()) it = objects.begin();
+            /* Else go up the hierarchy */
+            o = parent;
+        }
     }
 
-    /* Array of absolute transformations in joints */
-    std::vector<typename Transformation::DataType> jointTransformations(jointObjects.size());
-
     /* Compute transformations for all joints */
-    for(std::size_t i = 0; i != jointTransformations.size(); ++i)
+    for(std::size_t i = 0; i != jointCount; ++i)
         computeJointTransformation(jointObjects, jointTransformations, i, finalTransformation);
 
-    /* Copy transformation for second or next occurrences from first occurrence
-       of duplicate object */
-    for(std::size_t i = 0; i != objectCount; ++i) {
-        if(jointObjects[i].get().counter != i)
-            jointTransformations[i] = jointTransformations[jointObjects[i].get().counter];
-    }
+    /* Copy the transformations of requested objects to the output, taking
+       the first occurrence for duplicate objects */
+    for(std::size_t i = 0; i != objectCount; ++i)
+        out[i] = convert(jointTransformations[jointObjects[i]->counter]);
 
     /* All visited marks are now cleaned, clean joint marks and counters */
-    for(auto i: jointObjects) {
+    for(std::size_t i = 0; i != jointCount; ++i) {
+        Object<Transformation>& o = *jointObjects[i];
         /* All not-already cleaned objects (...duplicate occurrences) should
            have joint mark */
-        CORRADE_INTERNAL_ASSERT(i.get().counter == ~UnsignedInt{} || i.get().flags & Flag::Joint);
-        i.get().flags &= ~Flag::Joint;
-        i.get().counter = ~UnsignedInt{};
+        CORRADE_INTERNAL_ASSERT(o.counter == ~UnsignedInt{} || o.flags & Flag::Joint);
+        o.flags &= ~Flag::Joint;
+        o.counter = ~UnsignedInt{};
     }
-
-    /* Shrink the array to contain only transformations of requested objects and return */
-    jointTransformations.resize(objectCount);
-    return jointTransformations;
 }
 
-template<class Transformation> typename Transformation::DataType Object<Transformation>::computeJointTransformation(const std::vector<std::reference_wrapper<Object<Transformation>>>& jointObjects, std::vector<typename Transformation::DataType>& jointTransformations, const std::size_t joint, const typename Transformation::DataType& finalTransformation) const {
-    std::reference_wrapper<Object<Transformation>> o = jointObjects[joint];
+template<class Transformation> typename Transformation::DataType Object<Transformation>::computeJointTransformation(Object<Transformation>* const* const jointObjects, typename Transformation::DataType* const jointTransformations, const std::size_t joint, const typename Transformation::DataType& finalTransformation) const {
+    std::reference_wrapper<Object<Transformation>> o = *jointObjects[joint];
 
     /* Transformation already computed ("unvisited" by this function before
        either due to recursion or duplicate object occurrences), done */
@@ -336,51 +389,56 @@ template<class Transformation> typename Transformation::DataType Object<Transfor
 }
 
 template<class Transformation> void Object<Transformation>::doSetClean(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects) {
-    std::vector<std::reference_wrapper<Object<Transformation>>> castObjects;
-    castObjects.reserve(objects.size());
     /** @todo Ensure this doesn't crash, somehow */
-    for(auto o: objects) castObjects.push_back(static_cast<Object<Transformation>&>(o.get()));
-
-    setClean(std::move(castObjects));
+    setClean(Implementation::iterableReferenceWrappers<Object<Transformation>>(objects));
 }
 
-template<class Transformation> void Object<Transformation>::setClean(std::vector<std::reference_wrapper<Object<Transformation>>> objects) {
-    /* Remove all clean objects from the list */
-    auto firstClean = std::remove_if(objects.begin(), objects.end(), [](Object<Transformation>& o) { return !o.isDirty(); });
-    objects.erase(firstClean, objects.end());
-
-    /* No dirty objects left, done */
-    if(objects.empty()) return;
+template<class Transformation> void Object<Transformation>::setClean(const Containers::Iterable<Object<Transformation>>& objects) {
+    /* Find the first dirty object. If there's none, done. */
+    std::size_t firstDirty = 0;
+    while(firstDirty != objects.size() && !objects[firstDirty].isDirty())
+        ++firstDirty;
+    if(firstDirty == objects.size()) return;
 
-    /* Add non-clean parents to the list. Mark each added object as visited, so
-       they aren't added more than once */
-    for(std::size_t end = objects.size(), i = 0; i != end; ++i) {
-        Object<Transformation>& o = objects[i];
-        o.flags |= Flag::Visited;
+    Scene<Transformation>* scene = objects[firstDirty].scene();
+    CORRADE_ASSERT(scene, "Object::setClean(): objects must be part of some scene", );
 
-        Object<Transformation>* parent = o.parent();
-        while(parent && !(parent->flags & Flag::Visited) && parent->isDirty()) {
-            objects.push_back(*parent);
-            parent = parent->parent();
+    /* Collect dirty objects and their dirty parents. Mark each added object
+       as visited, so they aren't added more than once. There's at most as
+       many objects as is the depth of the hierarchy times the list size, so
+       the temporary list has to be enlarged on the go. The memory is taken
+       out of the scene for the duration of the call in case a feature calls
+       setClean() recursively from its clean() or cleanInverted(). */
+    Containers::Array<Object<Transformation>*> cleanObjects = std::move(scene->_cleanObjects);
+    std::size_t cleanObjectCount = 0;
+    for(std::size_t i = firstDirty; i != objects.size(); ++i) {
+        for(Object<Transformation>* o = &objects[i]; o && !(o->flags & Flag::Visited) && o->isDirty(); o = o->parent()) {
+            if(cleanObjectCount == cleanObjects.size())
+                Implementation::enlargeScratchArray(cleanObjects, cleanObjectCount);
+
+            o->flags |= Flag::Visited;
+            cleanObjects[cleanObjectCount++] = o;
         }
     }
 
     /* Cleanup all marks */
-    for(auto o: objects) o.get().flags &= ~Flag::Visited;
+    for(std::size_t i = 0; i != cleanObjectCount; ++i)
+        cleanObjects[i]->flags &= ~Flag::Visited;
 
     /* Compute absolute transformations */
-    Scene<Transformation>* scene = objects[0].get().scene();
-    CORRADE_ASSERT(scene, "Object::setClean(): objects must be part of some scene", );
-    std::vector<typename Transformation::DataType> transformations(scene->transformations(objects));
+    Containers::Array<typename Transformation::DataType> cleanTransformations = std::move(scene->_cleanTransformations);
+    Implementation::growScratchArray(cleanTransformations, cleanObjectCount);
+    const Containers::StridedArrayView1D<typename Transformation::DataType> transformations = Containers::stridedArrayView(cleanTransformations.data(), cleanObjectCount);
+    scene->transformationsIntoInternal("SceneGraph::Object::setClean():", Implementation::iterablePointers<Object<Transformation>>(cleanObjects.data(), cleanObjectCount), transformations, typename Transformation::DataType{}, [](const typename Transformation::DataType& transformation) { return transformation; });
 
     /* Go through all objects and clean them */
-    for(std::size_t i = 0; i != objects.size(); ++i) {
-        /* The object might be duplicated in the list, don't clean it more than once */
-        if(!objects[i].get().isDirty()) continue;
-
-        objects[i].get().setCleanInternal(transformations[i]);
-        CORRADE_ASSERT(!objects[i].get().isDirty(), "SceneGraph::Object::setClean(): original implementation was not called", );
+    for(std::size_t i = 0; i != cleanObjectCount; ++i) {
+        cleanObjects[i]->setCleanInternal(transformations[i]);
+        CORRADE_ASSERT(!cleanObjects[i]->isDirty(), "SceneGraph::Object::setClean(): original implementation was not called", );
     }
+
+    scene->_cleanObjects = std::move(cleanObjects);
+    scene->_cleanTransformations = std::move(cleanTransformations);
 }
 
 template<class Transformation> void Object<Transformation>::setCleanInternal(const typename Transformation::DataType& absoluteTransformation) {
@@ -30,6 +30,8 @@
  * @brief Class @ref Magnum::SceneGraph::Scene
  */
 
+#include <Corrade/Containers/Array.h>
+
 #include "Magnum/SceneGraph/Object.h"
 
 namespace Magnum { namespace SceneGraph {
@@ -53,7 +55,19 @@ template<class Transformation> class Scene: public Object<Transformation> {
         explicit Scene() = default;
 
     private:
+        #ifndef DOXYGEN_GENERATING_OUTPUT /* https://bugzilla.gnome.org/show_bug.cgi?id=776986 */
+        friend Object<Transformation>;
+        #endif
+
         bool isScene() const override final { return true; }
+
+        /* Temporary memory for Object::transformationsInto() and both
+           Object::setClean() variants, reused across calls. Only ever
+           grows. */
+        mutable Containers::Array<Object<Transformation>*> _jointObjects;
+        mutable Containers::Array<typename Transformation::DataType> _jointTransformations;
+        Containers::Array<Object<Transformation>*> _cleanObjects;
+        Containers::Array<typename Transformation::DataType> _cleanTransformations;
 };
 
 }}
@@ -112,6 +112,18 @@ template<class> class BasicDualQuaternionTransformation;
 typedef BasicDualComplexTransformation<Float> DualComplexTransformation;
 typedef BasicDualQuaternionTransformation<Float> DualQuaternionTransformation;
 
+template<UnsignedInt, class> class FlatObject;
+template<class T> using BasicFlatObject2D = FlatObject<2, T>;
+template<class T> using BasicFlatObject3D = FlatObject<3, T>;
+typedef BasicFlatObject2D<Float> FlatObject2D;
+typedef BasicFlatObject3D<Float> FlatObject3D;
+
+template<UnsignedInt, class> class FlatScene;
+template<class T> using BasicFlatScene2D = FlatScene<2, T>;
+template<class T> using BasicFlatScene3D = FlatScene<3, T>;
+typedef BasicFlatScene2D<Float> FlatScene2D;
+typedef BasicFlatScene3D<Float> FlatScene3D;
+
 template<UnsignedInt, class, class> class FeatureGroup;
 template<class Feature, class T> using BasicFeatureGroup2D = FeatureGroup<2, Feature, T>;
 template<class Feature, class T> using BasicFeatureGroup3D = FeatureGroup<3, Feature, T>;
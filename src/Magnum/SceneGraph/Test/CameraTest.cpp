@@ -54,6 +54,8 @@ struct CameraTest: TestSuite::Tester {
 
     template<class T> void draw();
     template<class T> void drawOrdered();
+    template<class T> void drawVisible2D();
+    template<class T> void drawVisible3D();
 };
 
 CameraTest::CameraTest() {
@@ -78,11 +80,16 @@ CameraTest::CameraTest() {
         &CameraTest::draw<Float>,
         &CameraTest::draw<Double>,
         &CameraTest::drawOrdered<Float>,
-        &CameraTest::drawOrdered<Double>});
+        &CameraTest::drawOrdered<Double>,
+        &CameraTest::drawVisible2D<Float>,
+        &CameraTest::drawVisible2D<Double>,
+        &CameraTest::drawVisible3D<Float>,
+        &CameraTest::drawVisible3D<Double>});
 }
 
 template<class T> using Object2D = SceneGraph::Object<SceneGraph::BasicMatrixTransformation2D<T>>;
 template<class T> using Object3D = SceneGraph::Object<SceneGraph::BasicMatrixTransformation3D<T>>;
+template<class T> using Scene2D = SceneGraph::Scene<SceneGraph::BasicMatrixTransformation2D<T>>;
 template<class T> using Scene3D = SceneGraph::Scene<SceneGraph::BasicMatrixTransformation3D<T>>;
 
 template<class T> void CameraTest::fixAspectRatio() {
@@ -303,6 +310,181 @@ template<class T> void CameraTest::drawOrdered() {
     }), TestSuite::Compare::Container);
 }
 
+template<class T> void CameraTest::drawVisible2D() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    class Drawable: public SceneGraph::BasicDrawable2D<T> {
+        public:
+            Drawable(AbstractBasicObject2D<T>& object, BasicDrawableGroup2D<T>* group, std::vector<Math::Matrix3<T>>& result): SceneGraph::BasicDrawable2D<T>{object, group}, _result(result) {}
+
+        protected:
+            void draw(const Math::Matrix3<T>& transformationMatrix, BasicCamera2D<T>&) override {
+                _result.push_back(transformationMatrix);
+            }
+
+        private:
+            std::vector<Math::Matrix3<T>>& _result;
+    };
+
+    BasicDrawableGroup2D<T> group;
+    Scene2D<T> scene;
+
+    std::vector<Math::Matrix3<T>> transformations;
+
+    /* Outside of the projection, culled */
+    Object2D<T> first{&scene};
+    first.translate({T(3.0), T(0.0)});
+    (new Drawable{first, &group, transformations})
+        ->setBoundingSphere({}, T(0.5));
+
+    /* Center outside of the projection, but the circle overlaps it */
+    Object2D<T> second{&scene};
+    second.translate({T(0.0), T(-3.0)});
+    (new Drawable{second, &group, transformations})
+        ->setBoundingSphere({}, T(1.5));
+
+    /* Inside of the projection */
+    Object2D<T> third{&scene};
+    (new Drawable{third, &group, transformations})
+        ->setBoundingSphere({}, T(0.1));
+
+    /* Bounding circle offset from the object origin, culled */
+    Object2D<T> fourth{&scene};
+    (new Drawable{fourth, &group, transformations})
+        ->setBoundingSphere({T(-3.0), T(0.0)}, T(0.5));
+
+    Object2D<T> cameraObject{&scene};
+    BasicCamera2D<T> camera{cameraObject};
+    camera.setProjectionMatrix(Math::Matrix3<T>::projection({T(4.0), T(4.0)}));
+    camera.drawVisible(group);
+
+    CORRADE_COMPARE_AS(transformations, (std::vector<Math::Matrix3<T>>{
+        Math::Matrix3<T>::translation({T(0.0), T(-3.0)}), /* second */
+        Math::Matrix3<T>{} /* third */
+    }), TestSuite::Compare::Container);
+}
+
+template<class T> void CameraTest::drawVisible3D() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    class Drawable: public SceneGraph::BasicDrawable3D<T> {
+        public:
+            Drawable(AbstractBasicObject3D<T>& object, BasicDrawableGroup3D<T>* group, std::vector<Math::Matrix4<T>>& result): SceneGraph::BasicDrawable3D<T>{object, group}, _result(result) {}
+
+        protected:
+            void draw(const Math::Matrix4<T>& transformationMatrix, BasicCamera3D<T>&) override {
+                _result.push_back(transformationMatrix);
+            }
+
+        private:
+            std::vector<Math::Matrix4<T>>& _result;
+    };
+
+    BasicDrawableGroup3D<T> group;
+    Scene3D<T> scene;
+
+    std::vector<Math::Matrix4<T>> transformations;
+
+    /* In front of the camera */
+    Object3D<T> first{&scene};
+    first.translate(Math::Vector3<T>::zAxis(T(-10.0)));
+    (new Drawable{first, &group, transformations})
+        ->setBoundingSphere({}, T(1.0));
+
+    /* Outside of the right frustum plane, culled */
+    Object3D<T> second{&scene};
+    second.translate({T(20.0), T(0.0), T(-10.0)});
+    (new Drawable{second, &group, transformations})
+        ->setBoundingSphere({}, T(1.0));
+
+    /* Same, but scaled so the sphere reaches into the frustum */
+    Object3D<T> third{&scene};
+    third.scale(Math::Vector3<T>{T(8.0)})
+        .translate({T(20.0), T(0.0), T(-10.0)});
+    (new Drawable{third, &group, transformations})
+        ->setBoundingSphere({}, T(1.0));
+
+    /* Behind the camera, culled */
+    Object3D<T> fourth{&scene};
+    fourth.translate(Math::Vector3<T>::zAxis(T(10.0)));
+    (new Drawable{fourth, &group, transformations})
+        ->setBoundingSphere({}, T(1.0));
+
+    /* Behind the camera, but without a bounding sphere so never culled */
+    Object3D<T> fifth{&scene};
+    fifth.translate(Math::Vector3<T>::zAxis(T(10.0)));
+    new Drawable{fifth, &group, transformations};
+
+    Object3D<T> cameraObject{&scene};
+    BasicCamera3D<T> camera{cameraObject};
+    camera.setProjectionMatrix(Math::Matrix4<T>::perspectiveProjection(Math::Deg<T>(T(90.0)), T(1.0), T(1.0), T(100.0)));
+
+    /* Without a sort key the visible drawables are in the original order */
+    {
+        std::vector<std::pair<std::reference_wrapper<SceneGraph::BasicDrawable3D<T>>, Math::Matrix4<T>>> visible = camera.visibleDrawableTransformations(group);
+        CORRADE_COMPARE(visible.size(), 3);
+        CORRADE_COMPARE(&visible[0].first.get(), &group[0]);
+        CORRADE_COMPARE(&visible[1].first.get(), &group[2]);
+        CORRADE_COMPARE(&visible[2].first.get(), &group[4]);
+    }
+
+    /* A capturing function object is accepted as well, and it's called just
+       once for each visible drawable */
+    {
+        std::size_t called = 0;
+        std::vector<std::pair<std::reference_wrapper<SceneGraph::BasicDrawable3D<T>>, Math::Matrix4<T>>> visible = camera.visibleDrawableTransformations(group, [&called](SceneGraph::BasicDrawable3D<T>&, const Math::Matrix4<T>& transformation) {
+            ++called;
+            return transformation.translation().x();
+        });
+        CORRADE_COMPARE(called, 3);
+        CORRADE_COMPARE(visible.size(), 3);
+        CORRADE_COMPARE(&visible[0].first.get(), &group[0]);
+        CORRADE_COMPARE(&visible[1].first.get(), &group[4]);
+        CORRADE_COMPARE(&visible[2].first.get(), &group[2]);
+    }
+
+    /* The key type is deduced, so integer keys aren't converted to T and
+       don't lose precision. These would collide if they were floats. */
+    {
+        std::vector<std::pair<std::reference_wrapper<SceneGraph::BasicDrawable3D<T>>, Math::Matrix4<T>>> visible = camera.visibleDrawableTransformations(group, [&group](SceneGraph::BasicDrawable3D<T>& drawable, const Math::Matrix4<T>&) -> UnsignedInt {
+            if(&drawable == &group[0]) return 16777217;
+            if(&drawable == &group[2]) return 16777216;
+            return 16777218;
+        });
+        CORRADE_COMPARE(visible.size(), 3);
+        CORRADE_COMPARE(&visible[0].first.get(), &group[2]);
+        CORRADE_COMPARE(&visible[1].first.get(), &group[0]);
+        CORRADE_COMPARE(&visible[2].first.get(), &group[4]);
+    }
+
+    /* Pointers can be used as keys as well, for example to sort by a
+       material */
+    {
+        const Int materials[3]{};
+        std::vector<std::pair<std::reference_wrapper<SceneGraph::BasicDrawable3D<T>>, Math::Matrix4<T>>> visible = camera.visibleDrawableTransformations(group, [&group, &materials](SceneGraph::BasicDrawable3D<T>& drawable, const Math::Matrix4<T>&) {
+            if(&drawable == &group[0]) return &materials[2];
+            if(&drawable == &group[2]) return &materials[0];
+            return &materials[1];
+        });
+        CORRADE_COMPARE(visible.size(), 3);
+        CORRADE_COMPARE(&visible[0].first.get(), &group[2]);
+        CORRADE_COMPARE(&visible[1].first.get(), &group[4]);
+        CORRADE_COMPARE(&visible[2].first.get(), &group[0]);
+    }
+
+    /* Sorted front to back, the first and third have the same key and thus
+       should stay in the original order */
+    camera.drawVisible(group, [](SceneGraph::BasicDrawable3D<T>&, const Math::Matrix4<T>& transformation) {
+        return -transformation.translation().z();
+    });
+
+    CORRADE_COMPARE_AS(transformations, (std::vector<Math::Matrix4<T>>{
+        Math::Matrix4<T>::translation(Math::Vector3<T>::zAxis(T(10.0))), /* fifth */
+        Math::Matrix4<T>::translation(Math::Vector3<T>::zAxis(T(-10.0))), /* first */
+        Math::Matrix4<T>::translation({T(20.0), T(0.0), T(-10.0)})*Math::Matrix4<T>::scaling(Math::Vector3<T>{T(8.0)}) /* third */
+    }), TestSuite::Compare::Container);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::CameraTest)
@@ -0,0 +1,612 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Iterable.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneGraph/AbstractFeature.hpp"
+#include "Magnum/SceneGraph/Camera.hpp"
+#include "Magnum/SceneGraph/Drawable.hpp"
+#include "Magnum/SceneGraph/FeatureGroup.hpp"
+#include "Magnum/SceneGraph/FlatScene.hpp"
+
+namespace Magnum { namespace SceneGraph { namespace Test { namespace {
+
+struct FlatSceneTest: TestSuite::Tester {
+    explicit FlatSceneTest();
+
+    void construct();
+
+    void addObject();
+    void addObjectReorder();
+    void addObjectDifferentScene();
+    void objectOutOfRange();
+
+    void setParent();
+    void setParentDifferentScene();
+    void setParentCycle();
+
+    template<class T> void absoluteTransformation();
+    template<class T> void absoluteTransformationUpdateRange();
+    template<class T> void transformationMatrices();
+    template<class T> void transformationMatricesInto();
+    void transformationMatricesDifferentScene();
+    void transformationMatricesIntoWrongSize();
+
+    template<class T> void setClean();
+    void setCleanList();
+    void setDirtyReparented();
+
+    void camera();
+};
+
+FlatSceneTest::FlatSceneTest() {
+    addTests({&FlatSceneTest::construct,
+
+              &FlatSceneTest::addObject,
+              &FlatSceneTest::addObjectReorder,
+              &FlatSceneTest::addObjectDifferentScene,
+              &FlatSceneTest::objectOutOfRange,
+
+              &FlatSceneTest::setParent,
+              &FlatSceneTest::setParentDifferentScene,
+              &FlatSceneTest::setParentCycle});
+
+    addTests<FlatSceneTest>({
+        &FlatSceneTest::absoluteTransformation<Float>,
+        &FlatSceneTest::absoluteTransformation<Double>,
+        &FlatSceneTest::absoluteTransformationUpdateRange<Float>,
+        &FlatSceneTest::absoluteTransformationUpdateRange<Double>,
+        &FlatSceneTest::transformationMatrices<Float>,
+        &FlatSceneTest::transformationMatrices<Double>,
+        &FlatSceneTest::transformationMatricesInto<Float>,
+        &FlatSceneTest::transformationMatricesInto<Double>});
+
+    addTests({&FlatSceneTest::transformationMatricesDifferentScene,
+              &FlatSceneTest::transformationMatricesIntoWrongSize});
+
+    addTests<FlatSceneTest>({
+        &FlatSceneTest::setClean<Float>,
+        &FlatSceneTest::setClean<Double>});
+
+    addTests({&FlatSceneTest::setCleanList,
+              &FlatSceneTest::setDirtyReparented,
+
+              &FlatSceneTest::camera});
+}
+
+void FlatSceneTest::construct() {
+    FlatScene3D scene;
+    CORRADE_COMPARE(scene.objectCount(), 0);
+    CORRADE_VERIFY(scene.objectIds().isEmpty());
+    CORRADE_VERIFY(scene.absoluteTransformations().isEmpty());
+
+    /* The scene is the root of itself */
+    AbstractObject3D& abstractScene = scene;
+    CORRADE_COMPARE(abstractScene.scene(), &scene);
+    CORRADE_COMPARE(abstractScene.parent(), nullptr);
+    CORRADE_COMPARE(abstractScene.transformationMatrix(), Matrix4{});
+    CORRADE_COMPARE(abstractScene.absoluteTransformationMatrix(), Matrix4{});
+}
+
+void FlatSceneTest::addObject() {
+    FlatScene3D scene;
+
+    /* Adding depth-first, which doesn't need any reordering */
+    FlatObject3D& a = scene.addObject();
+    FlatObject3D& b = scene.addObject(&a);
+    FlatObject3D& c = scene.addObject(&b);
+    FlatObject3D& d = scene.addObject(&a);
+    FlatObject3D& e = scene.addObject();
+    CORRADE_COMPARE(scene.objectCount(), 5);
+    CORRADE_COMPARE(a.id(), 0);
+    CORRADE_COMPARE(b.id(), 1);
+    CORRADE_COMPARE(c.id(), 2);
+    CORRADE_COMPARE(d.id(), 3);
+    CORRADE_COMPARE(e.id(), 4);
+    CORRADE_COMPARE(&scene.object(3), &d);
+
+    CORRADE_COMPARE(a.scene(), &scene);
+    CORRADE_COMPARE(a.parent(), nullptr);
+    CORRADE_COMPARE(b.parent(), &a);
+    CORRADE_COMPARE(c.parent(), &b);
+    CORRADE_COMPARE(d.parent(), &a);
+    CORRADE_COMPARE(e.parent(), nullptr);
+
+    /* The abstract interface returns the scene for top-level objects,
+       consistently with Object */
+    CORRADE_COMPARE(static_cast<AbstractObject3D&>(a).parent(), &scene);
+    CORRADE_COMPARE(static_cast<AbstractObject3D&>(c).parent(), &b);
+
+    CORRADE_COMPARE_AS(scene.objectIds(), Containers::arrayView<UnsignedInt>({
+        0, 1, 2, 3, 4
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.parents(), Containers::arrayView<Int>({
+        -1, 0, 1, 0, -1
+    }), TestSuite::Compare::Container);
+}
+
+void FlatSceneTest::addObjectReorder() {
+    FlatScene3D scene;
+
+    FlatObject3D& a = scene.addObject();
+    FlatObject3D& b = scene.addObject();
+    FlatObject3D& c = scene.addObject(&b);
+    /* This one isn't added after the last subtree, so the order has to be
+       rebuilt */
+    FlatObject3D& d = scene.addObject(&a);
+    FlatObject3D& e = scene.addObject(&d);
+    FlatObject3D& f = scene.addObject(&a);
+
+    /* Children are kept in the order they were added */
+    CORRADE_COMPARE_AS(scene.objectIds(), Containers::arrayView<UnsignedInt>({
+        0, 3, 4, 5, 1, 2
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.parents(), Containers::arrayView<Int>({
+        -1, 0, 1, 0, -1, 4
+    }), TestSuite::Compare::Container);
+
+    /* IDs and parents stay the same */
+    CORRADE_COMPARE(d.id(), 3);
+    CORRADE_COMPARE(a.parent(), nullptr);
+    CORRADE_COMPARE(b.parent(), nullptr);
+    CORRADE_COMPARE(c.parent(), &b);
+    CORRADE_COMPARE(d.parent(), &a);
+    CORRADE_COMPARE(e.parent(), &d);
+    CORRADE_COMPARE(f.parent(), &a);
+}
+
+void FlatSceneTest::addObjectDifferentScene() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    FlatScene3D scene, another;
+    FlatObject3D& object = another.addObject();
+
+    Containers::String out;
+    Error redirectError{&out};
+    scene.addObject(&object);
+    CORRADE_COMPARE(out, "SceneGraph::FlatScene::addObject(): the parent is from a different scene\n");
+}
+
+void FlatSceneTest::objectOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    FlatScene3D scene;
+    scene.addObject();
+    scene.addObject();
+
+    Containers::String out;
+    Error redirectError{&out};
+    scene.object(2);
+    CORRADE_COMPARE(out, "SceneGraph::FlatScene::object(): index 2 out of range for 2 objects\n");
+}
+
+void FlatSceneTest::setParent() {
+    FlatScene3D scene;
+
+    FlatObject3D& a = scene.addObject();
+    FlatObject3D& b = scene.addObject(&a);
+    FlatObject3D& c = scene.addObject(&b);
+    FlatObject3D& d = scene.addObject();
+    a.setTransformation(Matrix4::translation(Vector3::xAxis(1.0f)));
+    b.setTransformation(Matrix4::translation(Vector3::yAxis(2.0f)));
+    d.setTransformation(Matrix4::scaling(Vector3{3.0f}));
+    CORRADE_COMPARE(c.absoluteTransformation(), Matrix4::translation({1.0f, 2.0f, 0.0f}));
+
+    /* Setting the same parent is a no-op */
+    b.setParent(&a);
+    CORRADE_COMPARE_AS(scene.objectIds(), Containers::arrayView<UnsignedInt>({
+        0, 1, 2, 3
+    }), TestSuite::Compare::Container);
+
+    /* Moving a subtree to another parent */
+    b.setParent(&d);
+    CORRADE_COMPARE(b.parent(), &d);
+    CORRADE_COMPARE(c.parent(), &b);
+    CORRADE_COMPARE_AS(scene.objectIds(), Containers::arrayView<UnsignedInt>({
+        0, 3, 1, 2
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.parents(), Containers::arrayView<Int>({
+        -1, -1, 1, 2
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(c.absoluteTransformation(), Matrix4::scaling(Vector3{3.0f})*Matrix4::translation(Vector3::yAxis(2.0f)));
+
+    /* Moving to the scene root */
+    b.setParent(nullptr);
+    CORRADE_COMPARE(b.parent(), nullptr);
+    CORRADE_COMPARE(c.absoluteTransformation(), Matrix4::translation(Vector3::yAxis(2.0f)));
+}
+
+void FlatSceneTest::setParentDifferentScene() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    FlatScene3D scene, another;
+    FlatObject3D& object = scene.addObject();
+    FlatObject3D& parent = another.addObject();
+
+    Containers::String out;
+    Error redirectError{&out};
+    object.setParent(&parent);
+    CORRADE_COMPARE(out, "SceneGraph::FlatObject::setParent(): the parent is from a different scene\n");
+}
+
+void FlatSceneTest::setParentCycle() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    FlatScene3D scene;
+    FlatObject3D& a = scene.addObject();
+    FlatObject3D& b = scene.addObject(&a);
+    FlatObject3D& c = scene.addObject(&b);
+
+    Containers::String out;
+    Error redirectError{&out};
+    a.setParent(&a);
+    a.setParent(&c);
+    CORRADE_COMPARE(out,
+        "SceneGraph::FlatObject::setParent(): can't parent an object to itself or its child\n"
+        "SceneGraph::FlatObject::setParent(): can't parent an object to itself or its child\n");
+}
+
+template<class T> void FlatSceneTest::absoluteTransformation() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    FlatScene<3, T> scene;
+    FlatObject<3, T>& a = scene.addObject();
+    FlatObject<3, T>& b = scene.addObject(&a);
+    FlatObject<3, T>& c = scene.addObject(&b);
+
+    const Math::Matrix4<T> ta = Math::Matrix4<T>::rotationZ(Math::Deg<T>{T(35.0)});
+    const Math::Matrix4<T> tb = Math::Matrix4<T>::translation(Math::Vector3<T>::xAxis(T(2.0)));
+    const Math::Matrix4<T> tc = Math::Matrix4<T>::scaling(Math::Vector3<T>{T(1.5)});
+    a.setTransformation(ta);
+    b.setTransformation(tb);
+    c.setTransformation(tc);
+    CORRADE_COMPARE(b.transformation(), tb);
+    CORRADE_COMPARE(b.transformationMatrix(), tb);
+    CORRADE_COMPARE(c.absoluteTransformation(), ta*tb*tc);
+    CORRADE_COMPARE(c.absoluteTransformationMatrix(), ta*tb*tc);
+
+    CORRADE_COMPARE_AS(scene.transformations(), Containers::arrayView({
+        ta, tb, tc
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.absoluteTransformations(), Containers::arrayView({
+        ta, ta*tb, ta*tb*tc
+    }), TestSuite::Compare::Container);
+
+    /* Changing a parent updates children as well */
+    a.setTransformation({});
+    CORRADE_COMPARE(c.absoluteTransformation(), tb*tc);
+}
+
+template<class T> void FlatSceneTest::absoluteTransformationUpdateRange() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    FlatScene<3, T> scene;
+    FlatObject<3, T>& a = scene.addObject();
+    FlatObject<3, T>& b = scene.addObject(&a);
+    FlatObject<3, T>& c = scene.addObject();
+    FlatObject<3, T>& d = scene.addObject(&c);
+    FlatObject<3, T>& e = scene.addObject();
+    const Math::Matrix4<T> t = Math::Matrix4<T>::translation(Math::Vector3<T>::zAxis(T(1.0)));
+    for(FlatObject<3, T>* i: {&a, &b, &c, &d, &e})
+        i->setTransformation(t);
+    scene.update();
+    CORRADE_COMPARE_AS(scene.absoluteTransformations(), Containers::arrayView({
+        t, t*t, t, t*t, t
+    }), TestSuite::Compare::Container);
+
+    /* Updating just the middle subtree should leave the rest untouched */
+    c.setTransformation(t*t);
+    CORRADE_COMPARE_AS(scene.absoluteTransformations(), Containers::arrayView({
+        t, t*t, t*t, t*t*t, t
+    }), TestSuite::Compare::Container);
+
+    /* Two disjoint subtrees, the range covers also the clean objects between
+       but they shouldn't be affected */
+    a.setTransformation({});
+    e.setTransformation({});
+    CORRADE_COMPARE_AS(scene.absoluteTransformations(), Containers::arrayView({
+        Math::Matrix4<T>{}, t, t*t, t*t*t, Math::Matrix4<T>{}
+    }), TestSuite::Compare::Container);
+}
+
+template<class T> void FlatSceneTest::transformationMatrices() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    FlatScene<3, T> scene;
+    FlatObject<3, T>& a = scene.addObject();
+    FlatObject<3, T>& b = scene.addObject(&a);
+    FlatObject<3, T>& c = scene.addObject();
+    a.setTransformation(Math::Matrix4<T>::translation(Math::Vector3<T>::xAxis(T(1.0))));
+    b.setTransformation(Math::Matrix4<T>::translation(Math::Vector3<T>::yAxis(T(2.0))));
+    c.setTransformation(Math::Matrix4<T>::translation(Math::Vector3<T>::zAxis(T(3.0))));
+
+    /* Objects in arbitrary order, duplicates and the scene itself */
+    const Math::Matrix4<T> final = Math::Matrix4<T>::scaling(Math::Vector3<T>{T(2.0)});
+    CORRADE_COMPARE_AS(scene.transformationMatrices({c, b, scene, b}, final), (std::vector<Math::Matrix4<T>>{
+        final*Math::Matrix4<T>::translation(Math::Vector3<T>::zAxis(T(3.0))),
+        final*Math::Matrix4<T>::translation({T(1.0), T(2.0), T(0.0)}),
+        final,
+        final*Math::Matrix4<T>::translation({T(1.0), T(2.0), T(0.0)})
+    }), TestSuite::Compare::Container);
+
+    /* Calling it on an object delegates to the scene */
+    CORRADE_COMPARE_AS(a.transformationMatrices({b}), (std::vector<Math::Matrix4<T>>{
+        Math::Matrix4<T>::translation({T(1.0), T(2.0), T(0.0)})
+    }), TestSuite::Compare::Container);
+}
+
+template<class T> void FlatSceneTest::transformationMatricesInto() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    FlatScene<3, T> scene;
+    FlatObject<3, T>& a = scene.addObject();
+    FlatObject<3, T>& b = scene.addObject(&a);
+    FlatObject<3, T>& c = scene.addObject();
+    a.setTransformation(Math::Matrix4<T>::translation(Math::Vector3<T>::xAxis(T(1.0))));
+    b.setTransformation(Math::Matrix4<T>::translation(Math::Vector3<T>::yAxis(T(2.0))));
+    c.setTransformation(Math::Matrix4<T>::translation(Math::Vector3<T>::zAxis(T(3.0))));
+
+    /* Same as transformationMatrices(), but through the view-based API */
+    AbstractBasicObject3D<T>* objects[]{&c, &b, &scene, &b};
+    Containers::Iterable<AbstractBasicObject3D<T>> objectsIterable{objects, 4, sizeof(AbstractBasicObject3D<T>*), [](const void* data) -> AbstractBasicObject3D<T>& {
+        return **static_cast<AbstractBasicObject3D<T>* const*>(data);
+    }};
+    const Math::Matrix4<T> final = Math::Matrix4<T>::scaling(Math::Vector3<T>{T(2.0)});
+    Math::Matrix4<T> out[4];
+    scene.transformationMatricesInto(objectsIterable, out, final);
+    CORRADE_COMPARE_AS(Containers::arrayView(out), Containers::arrayView({
+        final*Math::Matrix4<T>::translation(Math::Vector3<T>::zAxis(T(3.0))),
+        final*Math::Matrix4<T>::translation({T(1.0), T(2.0), T(0.0)}),
+        final,
+        final*Math::Matrix4<T>::translation({T(1.0), T(2.0), T(0.0)})
+    }), TestSuite::Compare::Container);
+
+    /* Changing a transformation is reflected in the next call */
+    a.setTransformation(Math::Matrix4<T>::translation(Math::Vector3<T>::xAxis(T(-1.0))));
+    scene.transformationMatricesInto(objectsIterable, out, final);
+    CORRADE_COMPARE(out[1], final*Math::Matrix4<T>::translation({T(-1.0), T(2.0), T(0.0)}));
+
+    /* Calling it on an object delegates to the scene */
+    Math::Matrix4<T> outObject[1];
+    a.transformationMatricesInto(objectsIterable.prefix(1), outObject);
+    CORRADE_COMPARE(outObject[0], Math::Matrix4<T>::translation(Math::Vector3<T>::zAxis(T(3.0))));
+}
+
+void FlatSceneTest::transformationMatricesDifferentScene() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    FlatScene3D scene, another;
+    FlatObject3D& object = another.addObject();
+
+    Containers::String out;
+    Error redirectError{&out};
+    scene.transformationMatrices({object});
+    CORRADE_COMPARE(out, "SceneGraph::FlatScene::transformationMatrices(): the objects are not part of the same scene\n");
+}
+
+void FlatSceneTest::transformationMatricesIntoWrongSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    FlatScene3D scene;
+    FlatObject3D& object = scene.addObject();
+    AbstractObject3D* objects[]{&object, &object};
+    Containers::Iterable<AbstractObject3D> objectsIterable{objects, 2, sizeof(AbstractObject3D*), [](const void* data) -> AbstractObject3D& {
+        return **static_cast<AbstractObject3D* const*>(data);
+    }};
+    Matrix4 matrices[3];
+
+    Containers::String out;
+    Error redirectError{&out};
+    scene.transformationMatricesInto(objectsIterable, matrices);
+    CORRADE_COMPARE(out, "SceneGraph::FlatScene::transformationMatricesInto(): expected 2 output items but got 3\n");
+}
+
+template<class T> class CachingFeature: public AbstractBasicFeature3D<T> {
+    public:
+        explicit CachingFeature(AbstractBasicObject3D<T>& object): AbstractBasicFeature3D<T>{object} {
+            this->setCachedTransformations(CachedTransformation::Absolute|CachedTransformation::InvertedAbsolute);
+        }
+
+        Int dirtyCount = 0, cleanCount = 0;
+        Math::Matrix4<T> cleanedAbsoluteTransformation{Math::ZeroInit};
+        Math::Matrix4<T> cleanedInvertedAbsoluteTransformation{Math::ZeroInit};
+
+    private:
+        void markDirty() override {
+            ++dirtyCount;
+        }
+
+        void clean(const Math::Matrix4<T>& absoluteTransformation) override {
+            ++cleanCount;
+            cleanedAbsoluteTransformation = absoluteTransformation;
+        }
+
+        void cleanInverted(const Math::Matrix4<T>& invertedAbsoluteTransformation) override {
+            cleanedInvertedAbsoluteTransformation = invertedAbsoluteTransformation;
+        }
+};
+
+template<class T> void FlatSceneTest::setClean() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    FlatScene<3, T> scene;
+    FlatObject<3, T>& a = scene.addObject();
+    FlatObject<3, T>& b = scene.addObject(&a);
+    FlatObject<3, T>& c = scene.addObject(&b);
+    a.setTransformation(Math::Matrix4<T>::scaling(Math::Vector3<T>{T(2.0)}));
+    b.setTransformation(Math::Matrix4<T>::translation(Math::Vector3<T>::xAxis(T(1.0))));
+    CachingFeature<T>& aFeature = a.template addFeature<CachingFeature<T>>();
+    CachingFeature<T>& bFeature = b.template addFeature<CachingFeature<T>>();
+    CachingFeature<T>& cFeature = c.template addFeature<CachingFeature<T>>();
+
+    /* Objects are dirty at the beginning */
+    CORRADE_VERIFY(scene.isDirty());
+    CORRADE_VERIFY(a.isDirty());
+    CORRADE_VERIFY(b.isDirty());
+    CORRADE_VERIFY(c.isDirty());
+
+    /* Clean the object and all its dirty parents (but not children) */
+    b.setClean();
+    CORRADE_VERIFY(scene.isDirty());
+    CORRADE_VERIFY(!a.isDirty());
+    CORRADE_VERIFY(!b.isDirty());
+    CORRADE_VERIFY(c.isDirty());
+    CORRADE_COMPARE(aFeature.cleanCount, 1);
+    CORRADE_COMPARE(bFeature.cleanCount, 1);
+    CORRADE_COMPARE(cFeature.cleanCount, 0);
+    CORRADE_COMPARE(bFeature.cleanedAbsoluteTransformation, b.absoluteTransformation());
+    CORRADE_COMPARE(bFeature.cleanedInvertedAbsoluteTransformation, b.absoluteTransformation().inverted());
+
+    /* Cleaning again does nothing */
+    b.setClean();
+    CORRADE_COMPARE(bFeature.cleanCount, 1);
+
+    /* Marking the object dirty marks its children too, but not parents.
+       Features of already dirty objects aren't notified again. */
+    b.setTransformation(Math::Matrix4<T>::translation(Math::Vector3<T>::yAxis(T(1.0))));
+    CORRADE_VERIFY(!a.isDirty());
+    CORRADE_VERIFY(b.isDirty());
+    CORRADE_VERIFY(c.isDirty());
+    CORRADE_COMPARE(aFeature.dirtyCount, 0);
+    CORRADE_COMPARE(bFeature.dirtyCount, 1);
+    CORRADE_COMPARE(cFeature.dirtyCount, 0);
+
+    c.setClean();
+    CORRADE_VERIFY(!b.isDirty());
+    CORRADE_VERIFY(!c.isDirty());
+    CORRADE_COMPARE(aFeature.cleanCount, 1);
+    CORRADE_COMPARE(bFeature.cleanCount, 2);
+    CORRADE_COMPARE(cFeature.cleanCount, 1);
+    CORRADE_COMPARE(bFeature.cleanedAbsoluteTransformation, Math::Matrix4<T>::scaling(Math::Vector3<T>{T(2.0)})*Math::Matrix4<T>::translation(Math::Vector3<T>::yAxis(T(1.0))));
+    CORRADE_COMPARE(cFeature.cleanedAbsoluteTransformation, bFeature.cleanedAbsoluteTransformation);
+
+    /* Setting the parent dirty explicitly notifies all features in the
+       subtree */
+    a.setDirty();
+    CORRADE_COMPARE(aFeature.dirtyCount, 1);
+    CORRADE_COMPARE(bFeature.dirtyCount, 2);
+    CORRADE_COMPARE(cFeature.dirtyCount, 1);
+}
+
+void FlatSceneTest::setCleanList() {
+    FlatScene3D scene;
+    FlatObject3D& a = scene.addObject();
+    FlatObject3D& b = scene.addObject(&a);
+    FlatObject3D& c = scene.addObject();
+    a.setTransformation(Matrix4::translation(Vector3::xAxis(1.0f)));
+    b.setTransformation(Matrix4::translation(Vector3::yAxis(1.0f)));
+    CachingFeature<Float>& bFeature = b.addFeature<CachingFeature<Float>>();
+    CachingFeature<Float>& cFeature = c.addFeature<CachingFeature<Float>>();
+
+    AbstractObject3D::setClean({b, c, b});
+    CORRADE_VERIFY(!a.isDirty());
+    CORRADE_VERIFY(!b.isDirty());
+    CORRADE_VERIFY(!c.isDirty());
+    CORRADE_COMPARE(bFeature.cleanCount, 1);
+    CORRADE_COMPARE(cFeature.cleanCount, 1);
+    CORRADE_COMPARE(bFeature.cleanedAbsoluteTransformation, Matrix4::translation({1.0f, 1.0f, 0.0f}));
+    CORRADE_COMPARE(cFeature.cleanedAbsoluteTransformation, Matrix4{});
+}
+
+void FlatSceneTest::setDirtyReparented() {
+    FlatScene3D scene;
+    FlatObject3D& a = scene.addObject();
+    FlatObject3D& b = scene.addObject();
+    FlatObject3D& c = scene.addObject(&b);
+    a.setTransformation(Matrix4::translation(Vector3::xAxis(1.0f)));
+    CachingFeature<Float>& bFeature = b.addFeature<CachingFeature<Float>>();
+    CachingFeature<Float>& cFeature = c.addFeature<CachingFeature<Float>>();
+
+    c.setClean();
+    CORRADE_VERIFY(!b.isDirty());
+    CORRADE_VERIFY(!c.isDirty());
+
+    /* Reparenting marks the subtree dirty once the order is rebuilt, which
+       happens on the next query */
+    b.setParent(&a);
+    CORRADE_COMPARE(bFeature.dirtyCount, 0);
+    CORRADE_VERIFY(b.isDirty());
+    CORRADE_VERIFY(c.isDirty());
+    CORRADE_COMPARE(bFeature.dirtyCount, 1);
+    CORRADE_COMPARE(cFeature.dirtyCount, 1);
+
+    c.setClean();
+    CORRADE_COMPARE(cFeature.cleanedAbsoluteTransformation, Matrix4::translation(Vector3::xAxis(1.0f)));
+}
+
+void FlatSceneTest::camera() {
+    struct Drawable: SceneGraph::Drawable3D {
+        explicit Drawable(AbstractObject3D& object, DrawableGroup3D& group, std::vector<Matrix4>& result): SceneGraph::Drawable3D{object, &group}, result(result) {}
+
+        void draw(const Matrix4& transformationMatrix, Camera3D&) override {
+            result.push_back(transformationMatrix);
+        }
+
+        std::vector<Matrix4>& result;
+    };
+
+    FlatScene3D scene;
+    DrawableGroup3D group;
+    std::vector<Matrix4> transformations;
+
+    FlatObject3D& first = scene.addObject();
+    first.setTransformation(Matrix4::scaling(Vector3{5.0f}));
+    first.addFeature<Drawable>(group, transformations);
+
+    FlatObject3D& second = scene.addObject();
+    second.setTransformation(Matrix4::translation(Vector3::yAxis(3.0f)));
+    second.addFeature<Drawable>(group, transformations);
+
+    FlatObject3D& third = scene.addObject(&second);
+    third.setTransformation(Matrix4::translation(Vector3::zAxis(-1.5f)));
+    third.addFeature<Drawable>(group, transformations);
+
+    Camera3D& camera = third.addFeature<Camera3D>();
+    camera.draw(group);
+    CORRADE_COMPARE_AS(transformations, (std::vector<Matrix4>{
+        Matrix4::translation({0.0f, -3.0f, 1.5f})*Matrix4::scaling(Vector3{5.0f}),
+        Matrix4::translation(Vector3::zAxis(1.5f)),
+        Matrix4{}
+    }), TestSuite::Compare::Container);
+
+    /* Moving the camera updates its cached matrix on next draw */
+    transformations.clear();
+    third.setTransformation(Matrix4::translation(Vector3::zAxis(-2.5f)));
+    camera.draw(group);
+    CORRADE_COMPARE_AS(transformations, (std::vector<Matrix4>{
+        Matrix4::translation({0.0f, -3.0f, 2.5f})*Matrix4::scaling(Vector3{5.0f}),
+        Matrix4::translation(Vector3::zAxis(2.5f)),
+        Matrix4{}
+    }), TestSuite::Compare::Container);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::FlatSceneTest)
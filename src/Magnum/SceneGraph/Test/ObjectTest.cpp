@@ -24,9 +24,13 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <cstdlib>
+#include <new>
 #include <Corrade/Containers/Pointer.h>
 #include <Corrade/Containers/String.h>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
 #include <Corrade/Utility/Format.h>
 
 #include "Magnum/SceneGraph/AbstractFeature.hpp"
@@ -34,6 +38,27 @@
 #include "Magnum/SceneGraph/Object.hpp"
 #include "Magnum/SceneGraph/Scene.h"
 
+/* Counting all allocations done through operator new in order to verify the
+   batch APIs don't allocate. Doesn't see allocations done directly through
+   malloc(), but none of the code under test does that. */
+namespace {
+    std::size_t allocationCount = 0;
+}
+
+void* operator new(std::size_t size) {
+    ++allocationCount;
+    if(void* const data = std::malloc(size ? size : 1)) return data;
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* data) noexcept {
+    std::free(data);
+}
+
+void operator delete(void* data, std::size_t) noexcept {
+    std::free(data);
+}
+
 namespace Magnum { namespace SceneGraph { namespace Test { namespace {
 
 struct ObjectTest: TestSuite::Tester {
@@ -53,9 +78,14 @@ struct ObjectTest: TestSuite::Tester {
     template<class T> void transformationsRelative();
     template<class T> void transformationsOrphan();
     template<class T> void transformationsDuplicate();
+    template<class T> void transformationsInto();
+    template<class T> void transformationsIntoInvalidSize();
+    template<class T> void transformationMatricesInto();
     template<class T> void setClean();
     template<class T> void setCleanListHierarchy();
     template<class T> void setCleanListBulk();
+    template<class T> void setCleanRecursive();
+    template<class T> void noAllocations();
 
     template<class T> void rangeBasedForChildren();
     template<class T> void rangeBasedForFeatures();
@@ -92,12 +122,22 @@ ObjectTest::ObjectTest() {
         &ObjectTest::transformationsOrphan<Double>,
         &ObjectTest::transformationsDuplicate<Float>,
         &ObjectTest::transformationsDuplicate<Double>,
+        &ObjectTest::transformationsInto<Float>,
+        &ObjectTest::transformationsInto<Double>,
+        &ObjectTest::transformationsIntoInvalidSize<Float>,
+        &ObjectTest::transformationsIntoInvalidSize<Double>,
+        &ObjectTest::transformationMatricesInto<Float>,
+        &ObjectTest::transformationMatricesInto<Double>,
         &ObjectTest::setClean<Float>,
         &ObjectTest::setClean<Double>,
         &ObjectTest::setCleanListHierarchy<Float>,
         &ObjectTest::setCleanListHierarchy<Double>,
         &ObjectTest::setCleanListBulk<Float>,
         &ObjectTest::setCleanListBulk<Double>,
+        &ObjectTest::setCleanRecursive<Float>,
+        &ObjectTest::setCleanRecursive<Double>,
+        &ObjectTest::noAllocations<Float>,
+        &ObjectTest::noAllocations<Double>,
 
         &ObjectTest::rangeBasedForChildren<Float>,
         &ObjectTest::rangeBasedForChildren<Double>,
@@ -417,6 +457,92 @@ template<class T> void ObjectTest::transformationsDuplicate() {
     }));
 }
 
+template<class T> void ObjectTest::transformationsInto() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    Scene3D<T> s;
+    Object3D<T> first(&s);
+    first.rotateZ(Math::Deg<T>{T(30.0)});
+    Object3D<T> second(&first);
+    second.scale(Math::Vector3<T>(T(0.5)));
+    Object3D<T> third(&first);
+    third.translate(Math::Vector3<T>::xAxis(T(5.0)));
+
+    Math::Matrix4<T> initial = Math::Matrix4<T>::rotationX(Math::Deg<T>{90.0}).inverted();
+    Math::Matrix4<T> firstExpected = initial*Math::Matrix4<T>::rotationZ(Math::Deg<T>{30.0});
+    Math::Matrix4<T> secondExpected = firstExpected*Math::Matrix4<T>::scaling(Math::Vector3<T>(T(0.5)));
+    Math::Matrix4<T> thirdExpected = firstExpected*Math::Matrix4<T>::translation(Math::Vector3<T>::xAxis(T(5.0)));
+
+    /* Same as transformations() and transformationsDuplicate() combined, but
+       with output into a view */
+    Math::Matrix4<T> out[6];
+    s.transformationsInto({second, third, second, s, first, third}, out, initial);
+    CORRADE_COMPARE_AS(Containers::arrayView(out), Containers::arrayView({
+        secondExpected, thirdExpected, secondExpected, initial, firstExpected, thirdExpected
+    }), TestSuite::Compare::Container);
+
+    /* Calling it again should produce the same result with the marks and
+       counters cleaned up properly */
+    Math::Matrix4<T> out2[2];
+    s.transformationsInto({third, first}, out2, initial);
+    CORRADE_COMPARE_AS(Containers::arrayView(out2), Containers::arrayView({
+        thirdExpected, firstExpected
+    }), TestSuite::Compare::Container);
+
+    /* Empty list */
+    s.transformationsInto({}, nullptr, initial);
+}
+
+template<class T> void ObjectTest::transformationsIntoInvalidSize() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Scene3D<T> s;
+    Object3D<T> a{&s};
+    Math::Matrix4<T> transformations[1];
+
+    Containers::String out;
+    Error redirectError{&out};
+    s.transformationsInto({a, s}, transformations);
+    s.transformationMatricesInto({a, s}, transformations);
+    static_cast<AbstractBasicObject3D<T>&>(s).transformationMatricesInto({a, s}, transformations);
+    CORRADE_COMPARE(out,
+        "SceneGraph::Object::transformationsInto(): expected 2 output items but got 1\n"
+        "SceneGraph::Object::transformationMatricesInto(): expected 2 output items but got 1\n"
+        "SceneGraph::Object::transformationMatricesInto(): expected 2 output items but got 1\n");
+}
+
+template<class T> void ObjectTest::transformationMatricesInto() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    Scene3D<T> s;
+    Object3D<T> first(&s);
+    first.rotateZ(Math::Deg<T>{T(30.0)});
+    Object3D<T> second(&first);
+    second.scale(Math::Vector3<T>(T(0.5)));
+
+    Math::Matrix4<T> initial = Math::Matrix4<T>::translation(Math::Vector3<T>::yAxis(T(3.0)));
+    Math::Matrix4<T> firstExpected = initial*Math::Matrix4<T>::rotationZ(Math::Deg<T>{30.0});
+    Math::Matrix4<T> secondExpected = firstExpected*Math::Matrix4<T>::scaling(Math::Vector3<T>(T(0.5)));
+
+    /* Typed interface */
+    Math::Matrix4<T> out[2];
+    s.transformationMatricesInto({second, first}, out, initial);
+    CORRADE_COMPARE_AS(Containers::arrayView(out), Containers::arrayView({
+        secondExpected, firstExpected
+    }), TestSuite::Compare::Container);
+
+    /* Through the abstract interface, into a strided view */
+    struct Item {
+        Math::Matrix4<T> matrix;
+        Int other;
+    } outStrided[2]{};
+    static_cast<AbstractBasicObject3D<T>&>(s).transformationMatricesInto({first, second}, Containers::stridedArrayView(outStrided).slice(&Item::matrix), initial);
+    CORRADE_COMPARE(outStrided[0].matrix, firstExpected);
+    CORRADE_COMPARE(outStrided[1].matrix, secondExpected);
+}
+
 template<class T> void ObjectTest::setClean() {
     setTestCaseTemplateName(Math::TypeTraits<T>::name());
 
@@ -603,6 +729,135 @@ template<class T> void ObjectTest::setCleanListBulk() {
     CORRADE_COMPARE(d.cleanedAbsoluteTransformation, Math::Matrix4<T>::translation(Math::Vector3<T>::zAxis(T(3.0)))*Math::Matrix4<T>::scaling(Math::Vector3<T>(T(-2.0))));
 }
 
+template<class T> void ObjectTest::setCleanRecursive() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* A feature that cleans another object while being cleaned itself */
+    class CleaningFeature: public AbstractBasicFeature3D<T> {
+        public:
+            explicit CleaningFeature(AbstractBasicObject3D<T>& object, Object3D<T>& sibling): AbstractBasicFeature3D<T>{object}, _sibling(sibling) {
+                this->setCachedTransformations(CachedTransformation::Absolute);
+            }
+
+            void clean(const Math::Matrix4<T>&) override {
+                _sibling.setClean();
+            }
+
+        private:
+            Object3D<T>& _sibling;
+    };
+
+    Scene3D<T> scene;
+    Object3D<T>* a = new Object3D<T>{&scene};
+    a->translate(Math::Vector3<T>::zAxis(T(3.0)));
+
+    /* The sibling is deep enough in the hierarchy for the nested setClean()
+       to need more temporary memory than the outer one */
+    Object3D<T>* parent = a;
+    for(std::size_t i = 0; i != 19; ++i) {
+        parent = new Object3D<T>{parent};
+        parent->translate(Math::Vector3<T>::xAxis(T(1.0)));
+    }
+    CachingObject<T>* sibling = new CachingObject<T>{parent};
+
+    Object3D<T>* b = new Object3D<T>{a};
+    b->scale(Math::Vector3<T>{T(2.0)});
+    new CleaningFeature{*b, *sibling};
+    CachingObject<T>* c = new CachingObject<T>{b};
+    c->translate(Math::Vector3<T>::yAxis(T(1.0)));
+    CachingObject<T>* d = new CachingObject<T>{&scene};
+    d->translate(Math::Vector3<T>::yAxis(T(-1.0)));
+
+    const Math::Matrix4<T> siblingExpected = Math::Matrix4<T>::translation({T(19.0), T(0.0), T(3.0)});
+    const Math::Matrix4<T> cExpected = Math::Matrix4<T>::translation(Math::Vector3<T>::zAxis(T(3.0)))*Math::Matrix4<T>::scaling(Math::Vector3<T>{T(2.0)})*Math::Matrix4<T>::translation(Math::Vector3<T>::yAxis(T(1.0)));
+    const Math::Matrix4<T> dExpected = Math::Matrix4<T>::translation(Math::Vector3<T>::yAxis(T(-1.0)));
+
+    /* Cleaning a single object */
+    c->setClean();
+    CORRADE_VERIFY(!a->isDirty());
+    CORRADE_VERIFY(!b->isDirty());
+    CORRADE_VERIFY(!c->isDirty());
+    CORRADE_VERIFY(!sibling->isDirty());
+    CORRADE_COMPARE(c->cleanedAbsoluteTransformation, cExpected);
+    CORRADE_COMPARE(sibling->cleanedAbsoluteTransformation, siblingExpected);
+
+    /* Cleaning a list of objects */
+    a->setDirty();
+    c->cleanedAbsoluteTransformation = {};
+    sibling->cleanedAbsoluteTransformation = {};
+    Object3D<T>::setClean({*c, *d});
+    CORRADE_VERIFY(!a->isDirty());
+    CORRADE_VERIFY(!b->isDirty());
+    CORRADE_VERIFY(!c->isDirty());
+    CORRADE_VERIFY(!d->isDirty());
+    CORRADE_VERIFY(!sibling->isDirty());
+    CORRADE_COMPARE(c->cleanedAbsoluteTransformation, cExpected);
+    CORRADE_COMPARE(d->cleanedAbsoluteTransformation, dExpected);
+    CORRADE_COMPARE(sibling->cleanedAbsoluteTransformation, siblingExpected);
+}
+
+template<class T> void ObjectTest::noAllocations() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    Scene3D<T> scene;
+    Object3D<T> a{&scene};
+    a.translate(Math::Vector3<T>::zAxis(T(3.0)));
+    CachingObject<T> b{&a};
+    b.scale(Math::Vector3<T>(T(-2.0)));
+    CachingObject<T> c{&a};
+    CachingObject<T> d{&c};
+    d.rotateX(Math::Deg<T>{T(90.0)});
+    CachingObject<T> e{&scene};
+
+    const Math::Matrix4<T> aExpected = Math::Matrix4<T>::translation(Math::Vector3<T>::zAxis(T(3.0)));
+    const Math::Matrix4<T> bExpected = aExpected*Math::Matrix4<T>::scaling(Math::Vector3<T>(T(-2.0)));
+    const Math::Matrix4<T> dExpected = aExpected*Math::Matrix4<T>::rotationX(Math::Deg<T>{T(90.0)});
+
+    Object3D<T>* objects[]{&b, &d, &c, &e};
+    Containers::Iterable<Object3D<T>> objectsIterable{objects, 4, sizeof(Object3D<T>*), [](const void* data) -> Object3D<T>& {
+        return **static_cast<Object3D<T>* const*>(data);
+    }};
+    Containers::Iterable<AbstractBasicObject3D<T>> abstractObjectsIterable{objects, 4, sizeof(Object3D<T>*), [](const void* data) -> AbstractBasicObject3D<T>& {
+        return **static_cast<Object3D<T>* const*>(data);
+    }};
+    Math::Matrix4<T> out[4];
+
+    /* The first calls allocate the temporary memory */
+    Object3D<T>::setClean(objectsIterable);
+    scene.transformationsInto(objectsIterable, out);
+    scene.transformationMatricesInto(objectsIterable, out);
+    static_cast<AbstractBasicObject3D<T>&>(scene).transformationMatricesInto(abstractObjectsIterable, out);
+
+    /* The next calls should reuse the memory. Results are checked only after
+       to not have the test macros affect the allocation count. */
+    b.cleanedAbsoluteTransformation = {};
+    d.cleanedAbsoluteTransformation = {};
+    Math::Matrix4<T> matrices[4];
+    Math::Matrix4<T> abstractMatrices[4];
+    const std::size_t allocationCountBefore = allocationCount;
+
+    a.setDirty();
+    Object3D<T>::setClean(objectsIterable);
+    const Math::Matrix4<T> bCleaned = b.cleanedAbsoluteTransformation;
+    a.setDirty();
+    d.setClean();
+    scene.transformationsInto(objectsIterable, out);
+    scene.transformationMatricesInto(objectsIterable, matrices);
+    static_cast<AbstractBasicObject3D<T>&>(scene).transformationMatricesInto(abstractObjectsIterable, abstractMatrices);
+
+    const std::size_t allocationCountAfter = allocationCount;
+
+    CORRADE_COMPARE(bCleaned, bExpected);
+    CORRADE_VERIFY(b.isDirty());
+    CORRADE_VERIFY(!d.isDirty());
+    CORRADE_COMPARE(d.cleanedAbsoluteTransformation, dExpected);
+    CORRADE_COMPARE(out[0], bExpected);
+    CORRADE_COMPARE(out[1], dExpected);
+    CORRADE_COMPARE(matrices[1], dExpected);
+    CORRADE_COMPARE(abstractMatrices[1], dExpected);
+    CORRADE_COMPARE(allocationCountAfter - allocationCountBefore, 0);
+}
+
 template<class T> void ObjectTest::rangeBasedForChildren() {
     setTestCaseTemplateName(Math::TypeTraits<T>::name());
 
@@ -34,6 +34,8 @@
 #include <Corrade/Containers/Triple.h>
 
 #include "Magnum/DimensionTraits.h"
+#include "Magnum/Implementation/parallel.h"
+#include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/Trade/SceneData.h"
@@ -268,6 +270,9 @@ template<> struct SceneDataDimensionTraits<2> {
     static void transformationsInto(const Trade::SceneData& scene, const Containers::StridedArrayView1D<UnsignedInt>& mappingDestination, const Containers::StridedArrayView1D<Matrix3>& transformationDestination) {
         return scene.transformations2DInto(mappingDestination, transformationDestination);
     }
+    static void transformationInto(const Trade::SceneData& scene, const std::size_t offset, Matrix3& transformationDestination) {
+        scene.transformations2DInto(offset, nullptr, Containers::arrayView(&transformationDestination, 1));
+    }
 };
 template<> struct SceneDataDimensionTraits<3> {
     static bool isDimensions(const Trade::SceneData& scene) {
@@ -276,9 +281,69 @@ template<> struct SceneDataDimensionTraits<3> {
     static void transformationsInto(const Trade::SceneData& scene, const Containers::StridedArrayView1D<UnsignedInt>& mappingDestination, const Containers::StridedArrayView1D<Matrix4>& transformationDestination) {
         return scene.transformations3DInto(mappingDestination, transformationDestination);
     }
+    static void transformationInto(const Trade::SceneData& scene, const std::size_t offset, Matrix4& transformationDestination) {
+        scene.transformations3DInto(offset, nullptr, Containers::arrayView(&transformationDestination, 1));
+    }
 };
 
-template<UnsignedInt dimensions> void absoluteFieldTransformationsIntoImplementation(const Trade::SceneData& scene, const UnsignedInt fieldId, const Containers::StridedArrayView1D<MatrixTypeFor<dimensions, Float>>& outputTransformations, const MatrixTypeFor<dimensions, Float>& globalTransformation) {
+/* Levels smaller than this many objects per thread are propagated serially,
+   as the cost of spawning the threads would outweigh the matrix
+   multiplications */
+constexpr std::size_t MinObjectsPerThread = 4096;
+
+/* Calculates offsets of depth levels in a breadth-first order returned from
+   parentsBreadthFirstInto(). Since a parent is always before its children,
+   the depth of each object can be calculated in a single pass, and because
+   the order is breadth-first, the depths are monotonically increasing. The
+   `depths` view is scratch memory indexed by object ID + 1. */
+Containers::Array<UnsignedInt> levelOffsets(const Containers::StridedArrayView1D<const UnsignedInt>& objects, const Containers::StridedArrayView1D<const Int>& parents, const Containers::ArrayView<UnsignedInt>& depths) {
+    Containers::Array<UnsignedInt> out;
+    arrayAppend(out, 0u);
+    depths[0] = 0;
+    for(std::size_t i = 0; i != objects.size(); ++i) {
+        const UnsignedInt depth = depths[parents[i] + 1] + 1;
+        depths[objects[i] + 1] = depth;
+        if(i && depth != depths[objects[i - 1] + 1])
+            arrayAppend(out, UnsignedInt(i));
+    }
+    arrayAppend(out, UnsignedInt(objects.size()));
+    return out;
+}
+
+/* Turns transformations indexed by object ID + 1 into absolute, in given
+   breadth-first order. If there's more than one thread, objects in each level
+   of the hierarchy are processed in parallel, as their parents are all in the
+   previous levels. */
+template<class T> void propagateTransformations(const Containers::StridedArrayView1D<const UnsignedInt>& objects, const Containers::StridedArrayView1D<const Int>& parents, const Containers::ArrayView<const UnsignedInt>& levelOffsets, const Containers::ArrayView<T>& absoluteTransformations, const UnsignedInt threadCount) {
+    const auto propagate = [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i) {
+            absoluteTransformations[objects[i] + 1] =
+                absoluteTransformations[parents[i] + 1]*
+                absoluteTransformations[objects[i] + 1];
+        }
+    };
+
+    if(threadCount <= 1 || levelOffsets.isEmpty()) {
+        propagate(0, objects.size());
+        return;
+    }
+
+    for(std::size_t level = 0; level + 1 < levelOffsets.size(); ++level) {
+        const std::size_t begin = levelOffsets[level];
+        const std::size_t size = levelOffsets[level + 1] - begin;
+        const UnsignedInt levelThreadCount = Math::min(threadCount, UnsignedInt(size/MinObjectsPerThread));
+        if(levelThreadCount < 2) {
+            propagate(begin, begin + size);
+            continue;
+        }
+
+        Implementation::parallelFor(size, levelThreadCount, [&](const std::size_t threadBegin, const std::size_t threadEnd, UnsignedInt) {
+            propagate(begin + threadBegin, begin + threadEnd);
+        });
+    }
+}
+
+template<UnsignedInt dimensions> void absoluteFieldTransformationsIntoImplementation(const Trade::SceneData& scene, const UnsignedInt fieldId, const Containers::StridedArrayView1D<MatrixTypeFor<dimensions, Float>>& outputTransformations, const MatrixTypeFor<dimensions, Float>& globalTransformation, const UnsignedInt threadCount) {
     CORRADE_ASSERT(SceneDataDimensionTraits<dimensions>::isDimensions(scene),
         "SceneTools::absoluteFieldTransformations(): the scene is not" << dimensions << Debug::nospace << "D", );
     CORRADE_ASSERT(fieldId < scene.fieldCount(),
@@ -289,21 +354,30 @@ template<UnsignedInt dimensions> void absoluteFieldTransformationsIntoImplementa
     CORRADE_ASSERT(outputTransformations.size() == scene.fieldSize(fieldId),
         "SceneTools::absoluteFieldTransformationsInto(): bad output size, expected" << scene.fieldSize(fieldId) << "but got" << outputTransformations.size(), );
 
+    /* Resolve the thread count. With a single thread the depth levels don't
+       need to be calculated at all. */
+    const std::size_t parentFieldSize = scene.fieldSize(*parentFieldId);
+    const UnsignedInt actualThreadCount = Implementation::parallelThreadCount(threadCount, Math::max(parentFieldSize, outputTransformations.size()));
+
     /* Allocate a single storage for all temporary data */
     Containers::ArrayView<Containers::Pair<UnsignedInt, Int>> orderedClusteredParents;
     Containers::ArrayView<Containers::Pair<UnsignedInt, MatrixTypeFor<dimensions, Float>>> transformations;
     Containers::ArrayView<MatrixTypeFor<dimensions, Float>> absoluteTransformations;
+    Containers::ArrayView<UnsignedInt> depths;
     Containers::ArrayTuple storage{
         /* Output of parentsBreadthFirstInto() */
-        {NoInit, scene.fieldSize(*parentFieldId), orderedClusteredParents},
+        {NoInit, parentFieldSize, orderedClusteredParents},
         /* Output of scene.transformationsXDInto() */
         {NoInit, scene.transformationFieldSize(), transformations},
         /* Above transformations but indexed by object ID */
-        {ValueInit, std::size_t(scene.mappingBound() + 1), absoluteTransformations}
+        {ValueInit, std::size_t(scene.mappingBound() + 1), absoluteTransformations},
+        /* Depth of each object for calculating level offsets, needed only if
+           multithreaded */
+        {NoInit, actualThreadCount > 1 ? std::size_t(scene.mappingBound() + 1) : 0, depths}
     };
-    parentsBreadthFirstInto(scene,
-        stridedArrayView(orderedClusteredParents).slice(&decltype(orderedClusteredParents)::Type::first),
-        stridedArrayView(orderedClusteredParents).slice(&decltype(orderedClusteredParents)::Type::second));
+    const Containers::StridedArrayView1D<UnsignedInt> orderedObjects = stridedArrayView(orderedClusteredParents).slice(&decltype(orderedClusteredParents)::Type::first);
+    const Containers::StridedArrayView1D<Int> orderedParents = stridedArrayView(orderedClusteredParents).slice(&decltype(orderedClusteredParents)::Type::second);
+    parentsBreadthFirstInto(scene, orderedObjects, orderedParents);
     SceneDataDimensionTraits<dimensions>::transformationsInto(scene,
         stridedArrayView(transformations).slice(&decltype(transformations)::Type::first),
         stridedArrayView(transformations).slice(&decltype(transformations)::Type::second));
@@ -319,115 +393,328 @@ template<UnsignedInt dimensions> void absoluteFieldTransformationsIntoImplementa
     }
 
     /* Turn the transformations into absolute */
-    for(const Containers::Pair<UnsignedInt, Int>& parentOffset: orderedClusteredParents) {
-        absoluteTransformations[parentOffset.first() + 1] =
-            absoluteTransformations[parentOffset.second() + 1]*
-            absoluteTransformations[parentOffset.first() + 1];
-    }
-
-    /* Allocate the output array, retrieve mesh & material IDs and assign
-       absolute transformations to each. The matrix location is abused for
-       object mapping, which is subsequently replaced by the absolute object
-       transformation for given mesh. */
+    Containers::Array<UnsignedInt> orderedLevelOffsets;
+    if(actualThreadCount > 1)
+        orderedLevelOffsets = levelOffsets(orderedObjects, orderedParents, depths);
+    propagateTransformations<MatrixTypeFor<dimensions, Float>>(orderedObjects, orderedParents, orderedLevelOffsets, absoluteTransformations, actualThreadCount);
+
+    /* Retrieve the field mapping and assign absolute transformations to each
+       entry. The matrix location is abused for object mapping, which is
+       subsequently replaced by the absolute object transformation for given
+       entry. Each entry reads and writes only its own memory, so this can be
+       split across threads without any synchronization. */
     const auto mapping = Containers::arrayCast<UnsignedInt>(outputTransformations);
     scene.mappingInto(fieldId, mapping);
-    for(std::size_t i = 0; i != mapping.size(); ++i) {
-        CORRADE_INTERNAL_ASSERT(mapping[i] < scene.mappingBound());
-        outputTransformations[i] = absoluteTransformations[mapping[i] + 1];
-    }
+    Implementation::parallelFor(mapping.size(), mapping.size() >= 2*MinObjectsPerThread ? actualThreadCount : 1, [&](const std::size_t begin, const std::size_t end, UnsignedInt) {
+        for(std::size_t i = begin; i != end; ++i) {
+            CORRADE_INTERNAL_ASSERT(mapping[i] < scene.mappingBound());
+            outputTransformations[i] = absoluteTransformations[mapping[i] + 1];
+        }
+    });
 }
 
-template<UnsignedInt dimensions> void absoluteFieldTransformationsIntoImplementation(const Trade::SceneData& scene, const Trade::SceneField field, const Containers::StridedArrayView1D<MatrixTypeFor<dimensions, Float>>& outputTransformations, const MatrixTypeFor<dimensions, Float>& globalTransformation) {
+template<UnsignedInt dimensions> void absoluteFieldTransformationsIntoImplementation(const Trade::SceneData& scene, const Trade::SceneField field, const Containers::StridedArrayView1D<MatrixTypeFor<dimensions, Float>>& outputTransformations, const MatrixTypeFor<dimensions, Float>& globalTransformation, const UnsignedInt threadCount) {
     const Containers::Optional<UnsignedInt> fieldId = scene.findFieldId(field);
     CORRADE_ASSERT(fieldId,
         "SceneTools::absoluteFieldTransformationsInto(): field" << field << "not found", );
 
-    absoluteFieldTransformationsIntoImplementation<dimensions>(scene, *fieldId, outputTransformations, globalTransformation);
+    absoluteFieldTransformationsIntoImplementation<dimensions>(scene, *fieldId, outputTransformations, globalTransformation, threadCount);
 }
 
-template<UnsignedInt dimensions> Containers::Array<MatrixTypeFor<dimensions, Float>> absoluteFieldTransformationsImplementation(const Trade::SceneData& scene, const UnsignedInt fieldId, const MatrixTypeFor<dimensions, Float>& globalTransformation) {
+template<UnsignedInt dimensions> Containers::Array<MatrixTypeFor<dimensions, Float>> absoluteFieldTransformationsImplementation(const Trade::SceneData& scene, const UnsignedInt fieldId, const MatrixTypeFor<dimensions, Float>& globalTransformation, const UnsignedInt threadCount) {
     CORRADE_ASSERT(fieldId < scene.fieldCount(),
         "SceneTools::absoluteFieldTransformations(): index" << fieldId << "out of range for" << scene.fieldCount() << "fields", {});
 
     Containers::Array<MatrixTypeFor<dimensions, Float>> out{NoInit, scene.fieldSize(fieldId)};
-    absoluteFieldTransformationsIntoImplementation<dimensions>(scene, fieldId, out, globalTransformation);
+    absoluteFieldTransformationsIntoImplementation<dimensions>(scene, fieldId, out, globalTransformation, threadCount);
     return out;
 }
 
-template<UnsignedInt dimensions> Containers::Array<MatrixTypeFor<dimensions, Float>> absoluteFieldTransformationsImplementation(const Trade::SceneData& scene, const Trade::SceneField field, const MatrixTypeFor<dimensions, Float>& globalTransformation) {
+template<UnsignedInt dimensions> Containers::Array<MatrixTypeFor<dimensions, Float>> absoluteFieldTransformationsImplementation(const Trade::SceneData& scene, const Trade::SceneField field, const MatrixTypeFor<dimensions, Float>& globalTransformation, const UnsignedInt threadCount) {
     const Containers::Optional<UnsignedInt> fieldId = scene.findFieldId(field);
     CORRADE_ASSERT(fieldId,
         "SceneTools::absoluteFieldTransformations(): field" << field << "not found", {});
 
     Containers::Array<MatrixTypeFor<dimensions, Float>> out{NoInit, scene.fieldSize(*fieldId)};
-    absoluteFieldTransformationsIntoImplementation<dimensions>(scene, *fieldId, out, globalTransformation);
+    absoluteFieldTransformationsIntoImplementation<dimensions>(scene, *fieldId, out, globalTransformation, threadCount);
     return out;
 }
 
 }
 
-Containers::Array<Matrix3> absoluteFieldTransformations2D(const Trade::SceneData& scene, const Trade::SceneField field, const Matrix3& globalTransformation) {
-    return absoluteFieldTransformationsImplementation<2>(scene, field, globalTransformation);
+Containers::Array<Matrix3> absoluteFieldTransformations2D(const Trade::SceneData& scene, const Trade::SceneField field, const Matrix3& globalTransformation, const UnsignedInt threadCount) {
+    return absoluteFieldTransformationsImplementation<2>(scene, field, globalTransformation, threadCount);
 }
 
 Containers::Array<Matrix3> absoluteFieldTransformations2D(const Trade::SceneData& scene, const Trade::SceneField field) {
-    return absoluteFieldTransformationsImplementation<2>(scene, field, {});
+    return absoluteFieldTransformationsImplementation<2>(scene, field, {}, 1);
 }
 
-Containers::Array<Matrix3> absoluteFieldTransformations2D(const Trade::SceneData& scene, const UnsignedInt fieldId, const Matrix3& globalTransformation) {
-    return absoluteFieldTransformationsImplementation<2>(scene, fieldId, globalTransformation);
+Containers::Array<Matrix3> absoluteFieldTransformations2D(const Trade::SceneData& scene, const UnsignedInt fieldId, const Matrix3& globalTransformation, const UnsignedInt threadCount) {
+    return absoluteFieldTransformationsImplementation<2>(scene, fieldId, globalTransformation, threadCount);
 }
 
 Containers::Array<Matrix3> absoluteFieldTransformations2D(const Trade::SceneData& scene, const UnsignedInt fieldId) {
-    return absoluteFieldTransformationsImplementation<2>(scene, fieldId, {});
+    return absoluteFieldTransformationsImplementation<2>(scene, fieldId, {}, 1);
 }
 
-void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, const Trade::SceneField field, const Containers::StridedArrayView1D<Matrix3>& transformations, const Matrix3& globalTransformation) {
-    return absoluteFieldTransformationsIntoImplementation<2>(scene, field, transformations, globalTransformation);
+void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, const Trade::SceneField field, const Containers::StridedArrayView1D<Matrix3>& transformations, const Matrix3& globalTransformation, const UnsignedInt threadCount) {
+    return absoluteFieldTransformationsIntoImplementation<2>(scene, field, transformations, globalTransformation, threadCount);
 }
 
 void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, const Trade::SceneField field, const Containers::StridedArrayView1D<Matrix3>& transformations) {
-    return absoluteFieldTransformationsIntoImplementation<2>(scene, field, transformations, {});
+    return absoluteFieldTransformationsIntoImplementation<2>(scene, field, transformations, {}, 1);
 }
 
-void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, const UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix3>& transformations, const Matrix3& globalTransformation) {
-    return absoluteFieldTransformationsIntoImplementation<2>(scene, fieldId, transformations, globalTransformation);
+void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, const UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix3>& transformations, const Matrix3& globalTransformation, const UnsignedInt threadCount) {
+    return absoluteFieldTransformationsIntoImplementation<2>(scene, fieldId, transformations, globalTransformation, threadCount);
 }
 
 void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, const UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix3>& transformations) {
-    return absoluteFieldTransformationsIntoImplementation<2>(scene, fieldId, transformations, {});
+    return absoluteFieldTransformationsIntoImplementation<2>(scene, fieldId, transformations, {}, 1);
 }
 
-Containers::Array<Matrix4> absoluteFieldTransformations3D(const Trade::SceneData& scene, const Trade::SceneField field, const Matrix4& globalTransformation) {
-    return absoluteFieldTransformationsImplementation<3>(scene, field, globalTransformation);
+Containers::Array<Matrix4> absoluteFieldTransformations3D(const Trade::SceneData& scene, const Trade::SceneField field, const Matrix4& globalTransformation, const UnsignedInt threadCount) {
+    return absoluteFieldTransformationsImplementation<3>(scene, field, globalTransformation, threadCount);
 }
 
 Containers::Array<Matrix4> absoluteFieldTransformations3D(const Trade::SceneData& scene, const Trade::SceneField field) {
-    return absoluteFieldTransformationsImplementation<3>(scene, field, {});
+    return absoluteFieldTransformationsImplementation<3>(scene, field, {}, 1);
 }
 
-Containers::Array<Matrix4> absoluteFieldTransformations3D(const Trade::SceneData& scene, const UnsignedInt fieldId, const Matrix4& globalTransformation) {
-    return absoluteFieldTransformationsImplementation<3>(scene, fieldId, globalTransformation);
+Containers::Array<Matrix4> absoluteFieldTransformations3D(const Trade::SceneData& scene, const UnsignedInt fieldId, const Matrix4& globalTransformation, const UnsignedInt threadCount) {
+    return absoluteFieldTransformationsImplementation<3>(scene, fieldId, globalTransformation, threadCount);
 }
 
 Containers::Array<Matrix4> absoluteFieldTransformations3D(const Trade::SceneData& scene, const UnsignedInt fieldId) {
-    return absoluteFieldTransformationsImplementation<3>(scene, fieldId, {});
+    return absoluteFieldTransformationsImplementation<3>(scene, fieldId, {}, 1);
 }
 
-void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, const Trade::SceneField field, const Containers::StridedArrayView1D<Matrix4>& transformations, const Matrix4& globalTransformation) {
-    return absoluteFieldTransformationsIntoImplementation<3>(scene, field, transformations, globalTransformation);
+void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, const Trade::SceneField field, const Containers::StridedArrayView1D<Matrix4>& transformations, const Matrix4& globalTransformation, const UnsignedInt threadCount) {
+    return absoluteFieldTransformationsIntoImplementation<3>(scene, field, transformations, globalTransformation, threadCount);
 }
 
 void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, const Trade::SceneField field, const Containers::StridedArrayView1D<Matrix4>& transformations) {
-    return absoluteFieldTransformationsIntoImplementation<3>(scene, field, transformations, {});
+    return absoluteFieldTransformationsIntoImplementation<3>(scene, field, transformations, {}, 1);
 }
 
-void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, const UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix4>& transformations, const Matrix4& globalTransformation) {
-    return absoluteFieldTransformationsIntoImplementation<3>(scene, fieldId, transformations, globalTransformation);
+void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, const UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix4>& transformations, const Matrix4& globalTransformation, const UnsignedInt threadCount) {
+    return absoluteFieldTransformationsIntoImplementation<3>(scene, fieldId, transformations, globalTransformation, threadCount);
 }
 
 void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, const UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix4>& transformations) {
-    return absoluteFieldTransformationsIntoImplementation<3>(scene, fieldId, transformations, {});
+    return absoluteFieldTransformationsIntoImplementation<3>(scene, fieldId, transformations, {}, 1);
+}
+
+template<UnsignedInt dimensions> TransformationHierarchy<dimensions>::TransformationHierarchy(const Trade::SceneData& scene, const UnsignedInt fieldId): _fieldId{fieldId}, _updated{}, _mappingBound{scene.mappingBound()} {
+    CORRADE_ASSERT(SceneDataDimensionTraits<dimensions>::isDimensions(scene),
+        "SceneTools::TransformationHierarchy: the scene is not" << dimensions << Debug::nospace << "D", );
+    CORRADE_ASSERT(fieldId < scene.fieldCount(),
+        "SceneTools::TransformationHierarchy: index" << fieldId << "out of range for" << scene.fieldCount() << "fields", );
+    const Containers::Optional<UnsignedInt> parentFieldId = scene.findFieldId(Trade::SceneField::Parent);
+    CORRADE_ASSERT(parentFieldId,
+        "SceneTools::TransformationHierarchy: the scene has no hierarchy", );
+
+    /* Breadth-first order and offsets of depth levels in it. The depths are
+       temporarily put into the _transformationOffsets array, which gets
+       filled with actual data below. */
+    const std::size_t parentFieldSize = scene.fieldSize(*parentFieldId);
+    const std::size_t objectCount = _mappingBound;
+    _orderedObjects = Containers::Array<UnsignedInt>{NoInit, parentFieldSize};
+    _orderedParents = Containers::Array<Int>{NoInit, parentFieldSize};
+    _transformationOffsets = Containers::Array<UnsignedInt>{NoInit, objectCount + 1};
+    parentsBreadthFirstInto(scene, _orderedObjects, _orderedParents);
+    _levelOffsets = levelOffsets(_orderedObjects, _orderedParents, _transformationOffsets);
+
+    /* Parent of each object, and a range of its children in the breadth-first
+       order. As children sharing the same parent are clustered together, a
+       [begin, end) pair is enough. Objects that aren't in the hierarchy have
+       the parent set to -2, objects without children have an empty range. The
+       root, i.e. -1, is at index 0. */
+    _objectParents = Containers::Array<Int>{DirectInit, objectCount, -2};
+    _childrenBegin = Containers::Array<UnsignedInt>{ValueInit, objectCount + 1};
+    _childrenEnd = Containers::Array<UnsignedInt>{ValueInit, objectCount + 1};
+    for(std::size_t i = 0; i != _orderedObjects.size(); ++i) {
+        const Int parent = _orderedParents[i];
+        _objectParents[_orderedObjects[i]] = parent;
+        if(!i || parent != _orderedParents[i - 1])
+            _childrenBegin[parent + 1] = i;
+        _childrenEnd[parent + 1] = i + 1;
+    }
+
+    /* Offset of a transformation for each object. If an object has more than
+       one, the last one is used, consistently with
+       absoluteFieldTransformationsInto(). */
+    Containers::Array<UnsignedInt> transformationMapping{NoInit, scene.transformationFieldSize()};
+    SceneDataDimensionTraits<dimensions>::transformationsInto(scene, transformationMapping, nullptr);
+    for(UnsignedInt& i: _transformationOffsets)
+        i = ~UnsignedInt{};
+    for(std::size_t i = 0; i != transformationMapping.size(); ++i) {
+        CORRADE_INTERNAL_ASSERT(transformationMapping[i] < objectCount);
+        _transformationOffsets[transformationMapping[i]] = i;
+    }
+
+    /* Field mapping, and a list of entries for each object. First count the
+       entries for each object, skipping the first element, then convert to a
+       running offset, and then fill the entries, which shifts the offsets by
+       one element back. Now `[_fieldEntryOffsets[i], _fieldEntryOffsets[i + 1])`
+       contains a range in which `_fieldEntries` contains a list of entries
+       for object `i`, and the last element is unused. */
+    _fieldObjects = Containers::Array<UnsignedInt>{NoInit, scene.fieldSize(fieldId)};
+    scene.mappingInto(fieldId, _fieldObjects);
+    _fieldEntryOffsets = Containers::Array<UnsignedInt>{ValueInit, objectCount + 2};
+    for(const UnsignedInt object: _fieldObjects) {
+        CORRADE_INTERNAL_ASSERT(object < objectCount);
+        ++_fieldEntryOffsets[object + 2];
+    }
+    UnsignedInt offset = 0;
+    for(UnsignedInt& i: _fieldEntryOffsets) {
+        const UnsignedInt nextOffset = offset + i;
+        i = offset;
+        offset = nextOffset;
+    }
+    _fieldEntries = Containers::Array<UnsignedInt>{NoInit, _fieldObjects.size()};
+    for(std::size_t i = 0; i != _fieldObjects.size(); ++i)
+        _fieldEntries[_fieldEntryOffsets[_fieldObjects[i] + 1]++] = i;
+
+    _absoluteTransformations = Containers::Array<MatrixType>{ValueInit, objectCount + 1};
+    _dirty = Containers::BitArray{ValueInit, objectCount};
+    /* Objects in the hierarchy, plus one for objects outside of it */
+    _stack = Containers::Array<UnsignedInt>{NoInit, parentFieldSize + 1};
+}
+
+template<UnsignedInt dimensions> TransformationHierarchy<dimensions>::TransformationHierarchy(const Trade::SceneData& scene, const Trade::SceneField field): TransformationHierarchy{NoCreate} {
+    const Containers::Optional<UnsignedInt> fieldId = scene.findFieldId(field);
+    CORRADE_ASSERT(fieldId,
+        "SceneTools::TransformationHierarchy: field" << field << "not found", );
+    *this = TransformationHierarchy<dimensions>{scene, *fieldId};
+}
+
+template<UnsignedInt dimensions> TransformationHierarchy<dimensions>::TransformationHierarchy(NoCreateT) noexcept: _fieldId{}, _updated{}, _mappingBound{} {}
+
+template<UnsignedInt dimensions> TransformationHierarchy<dimensions>::TransformationHierarchy(TransformationHierarchy<dimensions>&&) noexcept = default;
+
+template<UnsignedInt dimensions> TransformationHierarchy<dimensions>::~TransformationHierarchy() = default;
+
+template<UnsignedInt dimensions> TransformationHierarchy<dimensions>& TransformationHierarchy<dimensions>::operator=(TransformationHierarchy<dimensions>&&) noexcept = default;
+
+template<UnsignedInt dimensions> void TransformationHierarchy<dimensions>::updateInto(const Trade::SceneData& scene, const Containers::StridedArrayView1D<MatrixType>& transformations, const MatrixType& globalTransformation, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(scene.mappingBound() == _mappingBound && scene.fieldCount() > _fieldId && scene.fieldSize(_fieldId) == _fieldObjects.size(),
+        "SceneTools::TransformationHierarchy::updateInto(): expected a scene with" << _mappingBound << "objects and" << _fieldObjects.size() << "entries in field" << _fieldId, );
+    CORRADE_ASSERT(transformations.size() == _fieldObjects.size(),
+        "SceneTools::TransformationHierarchy::updateInto(): bad output size, expected" << _fieldObjects.size() << "but got" << transformations.size(), );
+
+    const UnsignedInt actualThreadCount = Implementation::parallelThreadCount(threadCount, Math::max(_orderedObjects.size(), _fieldObjects.size()));
+
+    /* Retrieve transformations of all objects, indexed by object ID, same as
+       in absoluteFieldTransformationsInto(). The output is used as a
+       temporary storage for the mapping, as it's not needed anymore. */
+    _absoluteTransformations[0] = globalTransformation;
+    for(std::size_t i = 1; i != _absoluteTransformations.size(); ++i)
+        _absoluteTransformations[i] = MatrixType{};
+    {
+        Containers::Array<Containers::Pair<UnsignedInt, MatrixType>> localTransformations{NoInit, scene.transformationFieldSize()};
+        SceneDataDimensionTraits<dimensions>::transformationsInto(scene,
+            stridedArrayView(localTransformations).slice(&decltype(localTransformations)::Type::first),
+            stridedArrayView(localTransformations).slice(&decltype(localTransformations)::Type::second));
+        for(const Containers::Pair<UnsignedInt, MatrixType>& transformation: localTransformations) {
+            CORRADE_INTERNAL_ASSERT(transformation.first() < _mappingBound);
+            _absoluteTransformations[transformation.first() + 1] = transformation.second();
+        }
+    }
+
+    propagateTransformations<MatrixType>(_orderedObjects, _orderedParents, _levelOffsets, _absoluteTransformations, actualThreadCount);
+
+    Implementation::parallelFor(_fieldObjects.size(), _fieldObjects.size() >= 2*MinObjectsPerThread ? actualThreadCount : 1, [&](const std::size_t begin, const std::size_t end, UnsignedInt) {
+        for(std::size_t i = begin; i != end; ++i)
+            transformations[i] = _absoluteTransformations[_fieldObjects[i] + 1];
+    });
+
+    _updated = true;
+}
+
+template<UnsignedInt dimensions> void TransformationHierarchy<dimensions>::updateInto(const Trade::SceneData& scene, const Containers::StridedArrayView1D<MatrixType>& transformations) {
+    updateInto(scene, transformations, MatrixType{}, 1);
+}
+
+template<UnsignedInt dimensions> void TransformationHierarchy<dimensions>::updateInto(const Trade::SceneData& scene, const Containers::StridedArrayView1D<const UnsignedInt>& objects, const Containers::StridedArrayView1D<MatrixType>& transformations) {
+    CORRADE_ASSERT(_updated,
+        "SceneTools::TransformationHierarchy::updateInto(): no full update done yet", );
+    CORRADE_ASSERT(scene.mappingBound() == _mappingBound && scene.fieldCount() > _fieldId && scene.fieldSize(_fieldId) == _fieldObjects.size(),
+        "SceneTools::TransformationHierarchy::updateInto(): expected a scene with" << _mappingBound << "objects and" << _fieldObjects.size() << "entries in field" << _fieldId, );
+    CORRADE_ASSERT(transformations.size() == _fieldObjects.size(),
+        "SceneTools::TransformationHierarchy::updateInto(): bad output size, expected" << _fieldObjects.size() << "but got" << transformations.size(), );
+
+    #ifndef CORRADE_NO_ASSERT
+    for(const UnsignedInt object: objects) {
+        CORRADE_ASSERT(object < _mappingBound,
+            "SceneTools::TransformationHierarchy::updateInto(): object" << object << "out of range for" << _mappingBound << "objects", );
+    }
+    #endif
+
+    /* Mark all changed objects */
+    for(const UnsignedInt object: objects)
+        _dirty.set(object);
+
+    const auto localTransformation = [&](const UnsignedInt object) {
+        MatrixType out;
+        if(_transformationOffsets[object] != ~UnsignedInt{})
+            SceneDataDimensionTraits<dimensions>::transformationInto(scene, _transformationOffsets[object], out);
+        return out;
+    };
+
+    /* Process subtrees of all marked objects that don't have any marked
+       ancestor, the rest gets processed as a part of those. Every visited
+       object gets unmarked, which means duplicates and objects that were
+       processed as a part of a subtree already are skipped, and the bit array
+       is all zeros again at the end. */
+    for(const UnsignedInt object: objects) {
+        if(!_dirty[object]) continue;
+
+        /* Objects that aren't in the hierarchy have just their own
+           transformation, consistently with the full update */
+        Int parent = _objectParents[object];
+        if(parent == -2) {
+            _absoluteTransformations[object + 1] = localTransformation(object);
+        } else {
+            /* If any ancestor is marked, the object will be processed as a
+               part of its subtree */
+            bool hasDirtyAncestor = false;
+            for(Int ancestor = parent; ancestor != -1; ancestor = _objectParents[ancestor]) {
+                if(_dirty[ancestor]) {
+                    hasDirtyAncestor = true;
+                    break;
+                }
+            }
+            if(hasDirtyAncestor) continue;
+
+            _absoluteTransformations[object + 1] =
+                _absoluteTransformations[parent + 1]*localTransformation(object);
+        }
+
+        /* Go through the subtree depth-first, calculating absolute
+           transformation of each child from its parent, which is already
+           calculated, and updating the output */
+        std::size_t stackSize = 0;
+        _stack[stackSize++] = object;
+        _dirty.reset(object);
+        while(stackSize) {
+            const UnsignedInt current = _stack[--stackSize];
+            for(std::size_t i = _fieldEntryOffsets[current], iMax = _fieldEntryOffsets[current + 1]; i != iMax; ++i)
+                transformations[_fieldEntries[i]] = _absoluteTransformations[current + 1];
+
+            for(std::size_t i = _childrenBegin[current + 1], iMax = _childrenEnd[current + 1]; i != iMax; ++i) {
+                const UnsignedInt child = _orderedObjects[i];
+                _absoluteTransformations[child + 1] =
+                    _absoluteTransformations[current + 1]*localTransformation(child);
+                _dirty.reset(child);
+                CORRADE_INTERNAL_DEBUG_ASSERT(stackSize < _stack.size());
+                _stack[stackSize++] = child;
+            }
+        }
+    }
 }
 
+template class MAGNUM_SCENETOOLS_EXPORT TransformationHierarchy<2>;
+template class MAGNUM_SCENETOOLS_EXPORT TransformationHierarchy<3>;
 }}
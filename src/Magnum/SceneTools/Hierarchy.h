@@ -27,11 +27,16 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::SceneTools::parentsBreadthFirst(), @ref Magnum::SceneTools::parentsBreadthFirstInto(), @ref Magnum::SceneTools::childrenDepthFirst(), @ref Magnum::SceneTools::childrenDepthFirstInto(), @ref Magnum::SceneTools::absoluteFieldTransformations2D(), @ref Magnum::SceneTools::absoluteFieldTransformations2DInto(), @ref Magnum::SceneTools::absoluteFieldTransformations3D(), @ref Magnum::SceneTools::absoluteFieldTransformations3DInto()
+ * @brief Class @ref Magnum::SceneTools::TransformationHierarchy, typedef @ref Magnum::SceneTools::TransformationHierarchy2D, @ref Magnum::SceneTools::TransformationHierarchy3D, function @ref Magnum::SceneTools::parentsBreadthFirst(), @ref Magnum::SceneTools::parentsBreadthFirstInto(), @ref Magnum::SceneTools::childrenDepthFirst(), @ref Magnum::SceneTools::childrenDepthFirstInto(), @ref Magnum::SceneTools::absoluteFieldTransformations2D(), @ref Magnum::SceneTools::absoluteFieldTransformations2DInto(), @ref Magnum::SceneTools::absoluteFieldTransformations3D(), @ref Magnum::SceneTools::absoluteFieldTransformations3DInto()
  * @m_since_latest
  */
 
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/BitArray.h>
+
+#include "Magnum/DimensionTraits.h"
 #include "Magnum/Magnum.h"
+#include "Magnum/Tags.h"
 #include "Magnum/SceneTools/visibility.h"
 #include "Magnum/Trade/Trade.h"
 
@@ -147,6 +152,18 @@ memory complexity, with @f$ m @f$ being size of @p fieldId and @f$ n @f$ being
 @ref Trade::SceneData::mappingBound(). The function calls
 @ref parentsBreadthFirst() internally.
 
+If @p threadCount is not @cpp 1 @ce, the transformations are propagated one
+level of the breadth-first order at a time, with objects in each level being
+processed in parallel, and the output is then filled in parallel as well. A
+value of @cpp 0 @ce uses all hardware threads. Levels with too few objects to
+benefit from multithreading are processed serially. The result is the same as
+with a serial operation. See @ref features-multithreading for more
+information.
+
+If only a small part of the scene changes between calls, use
+@ref TransformationHierarchy2D instead, which allows recalculating only
+subtrees of objects that changed.
+
 The returned data are in the same order as object mapping entries in
 @p fieldId. Fields attached to objects without a @ref Trade::SceneField::Parent
 or to objects in loose hierarchy subtrees will have their transformation set to
@@ -166,10 +183,10 @@ single mesh:
     @ref Trade::SceneData::is2D()
 */
 #ifdef DOXYGEN_GENERATING_OUTPUT
-MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix3> absoluteFieldTransformations2D(const Trade::SceneData& scene, UnsignedInt fieldId, const Matrix3& globalTransformation = {});
+MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix3> absoluteFieldTransformations2D(const Trade::SceneData& scene, UnsignedInt fieldId, const Matrix3& globalTransformation = {}, UnsignedInt threadCount = 1);
 #else
 /* To avoid including Matrix3 */
-MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix3> absoluteFieldTransformations2D(const Trade::SceneData& scene, UnsignedInt fieldId, const Matrix3& globalTransformation);
+MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix3> absoluteFieldTransformations2D(const Trade::SceneData& scene, UnsignedInt fieldId, const Matrix3& globalTransformation, UnsignedInt threadCount = 1);
 MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix3> absoluteFieldTransformations2D(const Trade::SceneData& scene, UnsignedInt fieldId);
 #endif
 
@@ -183,10 +200,10 @@ The @p field is expected to exist in @p scene.
 @experimental
 */
 #ifdef DOXYGEN_GENERATING_OUTPUT
-MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix3> absoluteFieldTransformations2D(const Trade::SceneData& scene, Trade::SceneField field, const Matrix3& globalTransformation = {});
+MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix3> absoluteFieldTransformations2D(const Trade::SceneData& scene, Trade::SceneField field, const Matrix3& globalTransformation = {}, UnsignedInt threadCount = 1);
 #else
 /* To avoid including Matrix3 */
-MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix3> absoluteFieldTransformations2D(const Trade::SceneData& scene, Trade::SceneField field, const Matrix3& globalTransformation);
+MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix3> absoluteFieldTransformations2D(const Trade::SceneData& scene, Trade::SceneField field, const Matrix3& globalTransformation, UnsignedInt threadCount = 1);
 MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix3> absoluteFieldTransformations2D(const Trade::SceneData& scene, Trade::SceneField field);
 #endif
 
@@ -196,6 +213,8 @@ MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix3> absoluteFieldTransformations
 @param[in]  fieldId         Field to calculate the transformations for
 @param[out] transformations Where to put the calculated transformations
 @param[in]  globalTransformation Global transformation to prepend
+@param[in]  threadCount     Number of threads to use, @cpp 0 @ce for all
+    hardware threads
 @m_since_latest
 
 A variant of @ref absoluteFieldTransformations2D(const Trade::SceneData&, UnsignedInt, const Matrix3&)
@@ -205,10 +224,10 @@ that fills existing memory instead of allocating a new array. The
 @experimental
 */
 #ifdef DOXYGEN_GENERATING_OUTPUT
-MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix3>& transformations, const Matrix3& globalTransformation = {});
+MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix3>& transformations, const Matrix3& globalTransformation = {}, UnsignedInt threadCount = 1);
 #else
 /* To avoid including Matrix3 */
-MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix3>& transformations, const Matrix3& globalTransformation);
+MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix3>& transformations, const Matrix3& globalTransformation, UnsignedInt threadCount = 1);
 MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix3>& transformations);
 #endif
 
@@ -222,10 +241,10 @@ The @p field is expected to exist in @p scene.
 @experimental
 */
 #ifdef DOXYGEN_GENERATING_OUTPUT
-MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, Trade::SceneField field, const Containers::StridedArrayView1D<Matrix3>& transformations, const Matrix3& globalTransformation = {});
+MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, Trade::SceneField field, const Containers::StridedArrayView1D<Matrix3>& transformations, const Matrix3& globalTransformation = {}, UnsignedInt threadCount = 1);
 #else
 /* To avoid including Matrix3 */
-MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, Trade::SceneField field, const Containers::StridedArrayView1D<Matrix3>& transformations, const Matrix3& globalTransformation);
+MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, Trade::SceneField field, const Containers::StridedArrayView1D<Matrix3>& transformations, const Matrix3& globalTransformation, UnsignedInt threadCount = 1);
 MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, Trade::SceneField field, const Containers::StridedArrayView1D<Matrix3>& transformations);
 #endif
 
@@ -245,6 +264,17 @@ memory complexity, with @f$ m @f$ being size of @p fieldId and @f$ n @f$ being
 @ref Trade::SceneData::mappingBound(). The function calls
 @ref parentsBreadthFirst() internally.
 
+If @p threadCount is not @cpp 1 @ce, the transformations are propagated one
+level of the breadth-first order at a time, with objects in each level being
+processed in parallel, and the output is then filled in parallel as well. A
+value of @cpp 0 @ce uses all hardware threads. Levels with too few objects to
+benefit from multithreading are processed serially. The result is the same as
+with a serial operation.
+
+If only a small part of the scene changes between calls, use
+@ref TransformationHierarchy3D instead, which allows recalculating only
+subtrees of objects that changed.
+
 The returned data are in the same order as object mapping entries in
 @p fieldId. Fields attached to objects without a @ref Trade::SceneField::Parent
 or to objects in loose hierarchy subtrees will have their transformation set to
@@ -264,10 +294,10 @@ single mesh:
     @ref Trade::SceneData::is3D()
 */
 #ifdef DOXYGEN_GENERATING_OUTPUT
-MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix4> absoluteFieldTransformations3D(const Trade::SceneData& scene, UnsignedInt fieldId, const Matrix4& globalTransformation = {});
+MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix4> absoluteFieldTransformations3D(const Trade::SceneData& scene, UnsignedInt fieldId, const Matrix4& globalTransformation = {}, UnsignedInt threadCount = 1);
 #else
 /* To avoid including Matrix4 */
-MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix4> absoluteFieldTransformations3D(const Trade::SceneData& scene, UnsignedInt fieldId, const Matrix4& globalTransformation);
+MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix4> absoluteFieldTransformations3D(const Trade::SceneData& scene, UnsignedInt fieldId, const Matrix4& globalTransformation, UnsignedInt threadCount = 1);
 MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix4> absoluteFieldTransformations3D(const Trade::SceneData& scene, UnsignedInt fieldId);
 #endif
 
@@ -281,10 +311,10 @@ The @p field is expected to exist in @p scene.
 @experimental
 */
 #ifdef DOXYGEN_GENERATING_OUTPUT
-MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix4> absoluteFieldTransformations3D(const Trade::SceneData& scene, Trade::SceneField field, const Matrix4& globalTransformation = {});
+MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix4> absoluteFieldTransformations3D(const Trade::SceneData& scene, Trade::SceneField field, const Matrix4& globalTransformation = {}, UnsignedInt threadCount = 1);
 #else
 /* To avoid including Matrix4 */
-MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix4> absoluteFieldTransformations3D(const Trade::SceneData& scene, Trade::SceneField field, const Matrix4& globalTransformation);
+MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix4> absoluteFieldTransformations3D(const Trade::SceneData& scene, Trade::SceneField field, const Matrix4& globalTransformation, UnsignedInt threadCount = 1);
 MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix4> absoluteFieldTransformations3D(const Trade::SceneData& scene, Trade::SceneField field);
 #endif
 
@@ -294,6 +324,8 @@ MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix4> absoluteFieldTransformations
 @param[in]  fieldId         Field to calculate the transformations for
 @param[out] transformations Where to put the calculated transformations
 @param[in]  globalTransformation Global transformation to prepend
+@param[in]  threadCount     Number of threads to use, @cpp 0 @ce for all
+    hardware threads
 @m_since_latest
 
 A variant of @ref absoluteFieldTransformations3D(const Trade::SceneData&, UnsignedInt, const Matrix4&)
@@ -303,10 +335,10 @@ that fills existing memory instead of allocating a new array. The
 @experimental
 */
 #ifdef DOXYGEN_GENERATING_OUTPUT
-MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix4>& transformations, const Matrix4& globalTransformation = {});
+MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix4>& transformations, const Matrix4& globalTransformation = {}, UnsignedInt threadCount = 1);
 #else
 /* To avoid including Matrix4 */
-MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix4>& transformations, const Matrix4& globalTransformation);
+MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix4>& transformations, const Matrix4& globalTransformation, UnsignedInt threadCount = 1);
 MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix4>& transformations);
 #endif
 
@@ -320,13 +352,208 @@ The @p field is expected to exist in @p scene.
 @experimental
 */
 #ifdef DOXYGEN_GENERATING_OUTPUT
-MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, Trade::SceneField field, const Containers::StridedArrayView1D<Matrix4>& transformations, const Matrix4& globalTransformation = {});
+MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, Trade::SceneField field, const Containers::StridedArrayView1D<Matrix4>& transformations, const Matrix4& globalTransformation = {}, UnsignedInt threadCount = 1);
 #else
 /* To avoid including Matrix4 */
-MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, Trade::SceneField field, const Containers::StridedArrayView1D<Matrix4>& transformations, const Matrix4& globalTransformation);
+MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, Trade::SceneField field, const Containers::StridedArrayView1D<Matrix4>& transformations, const Matrix4& globalTransformation, UnsignedInt threadCount = 1);
 MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, Trade::SceneField field, const Containers::StridedArrayView1D<Matrix4>& transformations);
 #endif
 
+/**
+@brief Precalculated transformation hierarchy for incremental updates
+@m_since_latest
+
+Stores the breadth-first parent order, per-object children ranges and a
+mapping of objects to entries of given field, which is what
+@ref absoluteFieldTransformations2DInto() and
+@ref absoluteFieldTransformations3DInto() calculate internally on every call,
+together with absolute transformations of all objects from the last update.
+If the hierarchy stays the same and only transformations of a few objects
+change between frames, the transformations can be first calculated for the
+whole scene with @ref updateInto(const Trade::SceneData&, const Containers::StridedArrayView1D<MatrixType>&, const MatrixType&, UnsignedInt)
+and then recalculated only for subtrees of the changed objects with
+@ref updateInto(const Trade::SceneData&, const Containers::StridedArrayView1D<const UnsignedInt>&, const Containers::StridedArrayView1D<MatrixType>&).
+The cost of the incremental update is then proportional to the size of the
+changed subtrees and not to the size of the whole scene:
+
+@snippet SceneTools.cpp TransformationHierarchy
+
+The result is exactly the same as if @ref absoluteFieldTransformations3DInto()
+would be called with the updated scene. The scene passed to both
+@ref updateInto() variants is expected to have the same hierarchy and the same
+mapping of given field as the scene passed to the constructor, with only the
+transformation values being different.
+
+@experimental
+
+@see @ref TransformationHierarchy2D, @ref TransformationHierarchy3D
+*/
+template<UnsignedInt dimensions> class TransformationHierarchy {
+    public:
+        /** @brief Transformation matrix type */
+        typedef MatrixTypeFor<dimensions, Float> MatrixType;
+
+        /**
+         * @brief Constructor
+         *
+         * The @ref Trade::SceneField::Parent field is expected to be
+         * contained in the scene, having no cycles or duplicates, the scene
+         * is expected to be 2D or 3D, based on @p dimensions, and @p fieldId
+         * is expected to be less than @ref Trade::SceneData::fieldCount().
+         * The operation is done in an @f$ \mathcal{O}(m + n) @f$ execution
+         * time and memory complexity, with @f$ m @f$ being size of
+         * @p fieldId and @f$ n @f$ being
+         * @ref Trade::SceneData::mappingBound().
+         */
+        explicit TransformationHierarchy(const Trade::SceneData& scene, UnsignedInt fieldId);
+
+        /**
+         * @brief Construct for a named field
+         *
+         * Translates @p field to a field ID using
+         * @ref Trade::SceneData::fieldId() and delegates to
+         * @ref TransformationHierarchy(const Trade::SceneData&, UnsignedInt).
+         * The @p field is expected to exist in @p scene.
+         */
+        explicit TransformationHierarchy(const Trade::SceneData& scene, Trade::SceneField field);
+
+        /**
+         * @brief Construct without populating the contents
+         *
+         * Equivalent to a moved-from state. Useful in cases where you will
+         * overwrite the instance later anyway. Move another object over it to
+         * make it useful.
+         */
+        explicit TransformationHierarchy(NoCreateT) noexcept;
+
+        /** @brief Copying is not allowed */
+        TransformationHierarchy(const TransformationHierarchy<dimensions>&) = delete;
+
+        /** @brief Move constructor */
+        TransformationHierarchy(TransformationHierarchy<dimensions>&&) noexcept;
+
+        ~TransformationHierarchy();
+
+        /** @brief Copying is not allowed */
+        TransformationHierarchy<dimensions>& operator=(const TransformationHierarchy<dimensions>&) = delete;
+
+        /** @brief Move assignment */
+        TransformationHierarchy<dimensions>& operator=(TransformationHierarchy<dimensions>&&) noexcept;
+
+        /** @brief Field ID the transformations are calculated for */
+        UnsignedInt fieldId() const { return _fieldId; }
+
+        /**
+         * @brief Field size
+         *
+         * Size of the output view expected by @ref updateInto().
+         */
+        std::size_t fieldSize() const { return _fieldObjects.size(); }
+
+        /**
+         * @brief Whether the transformations were calculated already
+         *
+         * Returns @cpp true @ce after the first call to
+         * @ref updateInto(const Trade::SceneData&, const Containers::StridedArrayView1D<MatrixType>&, const MatrixType&, UnsignedInt),
+         * @cpp false @ce before.
+         */
+        bool isUpdated() const { return _updated; }
+
+        /**
+         * @brief Calculate transformations for all objects
+         * @param[in]  scene           Input scene
+         * @param[out] transformations Where to put the calculated
+         *      transformations
+         * @param[in]  globalTransformation Global transformation to prepend
+         * @param[in]  threadCount     Number of threads to use, @cpp 0 @ce
+         *      for all hardware threads
+         *
+         * Equivalent to calling @ref absoluteFieldTransformations2DInto() or
+         * @ref absoluteFieldTransformations3DInto() with @ref fieldId(),
+         * except that the hierarchy isn't calculated again. The
+         * @p transformations view is expected to have @ref fieldSize()
+         * elements. The @p globalTransformation is remembered and used by
+         * subsequent incremental updates.
+         */
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        void updateInto(const Trade::SceneData& scene, const Containers::StridedArrayView1D<MatrixType>& transformations, const MatrixType& globalTransformation = {}, UnsignedInt threadCount = 1);
+        #else
+        /* To avoid including Matrix3 / Matrix4 */
+        void updateInto(const Trade::SceneData& scene, const Containers::StridedArrayView1D<MatrixType>& transformations, const MatrixType& globalTransformation, UnsignedInt threadCount = 1);
+        void updateInto(const Trade::SceneData& scene, const Containers::StridedArrayView1D<MatrixType>& transformations);
+        #endif
+
+        /**
+         * @brief Recalculate transformations for subtrees of given objects
+         * @param[in]  scene           Input scene
+         * @param[in]  objects         Objects whose transformation changed
+         * @param[in,out] transformations Transformations to update
+         *
+         * Recalculates absolute transformations of @p objects and all their
+         * children and updates corresponding entries in @p transformations,
+         * other entries are left untouched. Expects that
+         * @ref updateInto(const Trade::SceneData&, const Containers::StridedArrayView1D<MatrixType>&, const MatrixType&, UnsignedInt)
+         * was called before, that @p transformations is the same view as
+         * was passed to it, and that all @p objects are less than
+         * @ref Trade::SceneData::mappingBound(). The @p objects can be in
+         * any order and may contain duplicates or objects that are
+         * descendants of other objects in the list, each subtree is
+         * processed just once.
+         *
+         * The operation is done in an @f$ \mathcal{O}(k + d) @f$ execution
+         * time, with @f$ k @f$ being the count of objects in the changed
+         * subtrees together with their field entries and @f$ d @f$ being the
+         * sum of depths of @p objects in the hierarchy, and doesn't allocate.
+         */
+        void updateInto(const Trade::SceneData& scene, const Containers::StridedArrayView1D<const UnsignedInt>& objects, const Containers::StridedArrayView1D<MatrixType>& transformations);
+
+    private:
+        UnsignedInt _fieldId;
+        bool _updated;
+        UnsignedLong _mappingBound;
+        /* Object IDs and their parents in a breadth-first order, offsets of
+           levels in it. The last offset is the size. */
+        Containers::Array<UnsignedInt> _orderedObjects;
+        Containers::Array<Int> _orderedParents;
+        Containers::Array<UnsignedInt> _levelOffsets;
+        /* Indexed by object ID. Parent is -2 for objects not in the
+           hierarchy, children are a [begin, end) range in _orderedObjects,
+           transformation offset is ~UnsignedInt{} for objects without a
+           transformation. */
+        Containers::Array<Int> _objectParents;
+        Containers::Array<UnsignedInt> _childrenBegin;
+        Containers::Array<UnsignedInt> _childrenEnd;
+        Containers::Array<UnsignedInt> _transformationOffsets;
+        /* Field mapping, and entries of it for each object. The
+           _fieldEntryOffsets array is indexed by object ID, with the range
+           for object i being [_fieldEntryOffsets[i], _fieldEntryOffsets[i + 1]). */
+        Containers::Array<UnsignedInt> _fieldObjects;
+        Containers::Array<UnsignedInt> _fieldEntryOffsets;
+        Containers::Array<UnsignedInt> _fieldEntries;
+        /* Absolute transformations indexed by object ID + 1, the first item
+           is the global transformation. */
+        Containers::Array<MatrixType> _absoluteTransformations;
+        /* Scratch storage for the incremental update */
+        Containers::BitArray _dirty;
+        Containers::Array<UnsignedInt> _stack;
+};
+
+/**
+@brief Precalculated 2D transformation hierarchy
+@m_since_latest
+
+@experimental
+*/
+typedef TransformationHierarchy<2> TransformationHierarchy2D;
+
+/**
+@brief Precalculated 3D transformation hierarchy
+@m_since_latest
+
+@experimental
+*/
+typedef TransformationHierarchy<3> TransformationHierarchy3D;
+
 }}
 
 #endif
@@ -24,11 +24,15 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <type_traits>
+
+#include <Corrade/Containers/ArrayTuple.h>
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/Containers/Triple.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/Move.h>
 
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
@@ -64,6 +68,17 @@ struct HierarchyTest: TestSuite::Tester {
     void absoluteFieldTransformationsInto2D();
     void absoluteFieldTransformationsInto3D();
     void absoluteFieldTransformationsIntoInvalidSize();
+
+    void absoluteFieldTransformationsMultithreaded();
+
+    void transformationHierarchy2D();
+    void transformationHierarchy3D();
+    void transformationHierarchyIncremental2D();
+    void transformationHierarchyIncremental3D();
+    void transformationHierarchyIncrementalMultithreaded();
+    void transformationHierarchyNoCreate();
+    void transformationHierarchyInvalid();
+    void transformationHierarchyUpdateInvalid();
 };
 
 using namespace Math::Literals;
@@ -117,6 +132,16 @@ const struct {
         5},
 };
 
+const struct {
+    const char* name;
+    UnsignedInt threadCount;
+} MultithreadedData[]{
+    {"2 threads", 2},
+    {"3 threads", 3},
+    {"7 threads", 7},
+    {"all hardware threads", 0}
+};
+
 HierarchyTest::HierarchyTest() {
     addTests({&HierarchyTest::parentsBreadthFirstChildrenDepthFirst,
               &HierarchyTest::parentsBreadthFirstChildrenDepthFirstSingleBranch,
@@ -145,6 +170,23 @@ HierarchyTest::HierarchyTest() {
         Containers::arraySize(IntoData));
 
     addTests({&HierarchyTest::absoluteFieldTransformationsIntoInvalidSize});
+
+    addInstancedTests({&HierarchyTest::absoluteFieldTransformationsMultithreaded},
+        Containers::arraySize(MultithreadedData));
+
+    addInstancedTests({&HierarchyTest::transformationHierarchy2D,
+                       &HierarchyTest::transformationHierarchy3D},
+        Containers::arraySize(IntoData));
+
+    addTests({&HierarchyTest::transformationHierarchyIncremental2D,
+              &HierarchyTest::transformationHierarchyIncremental3D});
+
+    addInstancedTests({&HierarchyTest::transformationHierarchyIncrementalMultithreaded},
+        Containers::arraySize(MultithreadedData));
+
+    addTests({&HierarchyTest::transformationHierarchyNoCreate,
+              &HierarchyTest::transformationHierarchyInvalid,
+              &HierarchyTest::transformationHierarchyUpdateInvalid});
 }
 
 void HierarchyTest::parentsBreadthFirstChildrenDepthFirst() {
@@ -889,6 +931,409 @@ void HierarchyTest::absoluteFieldTransformationsIntoInvalidSize() {
         "SceneTools::absoluteFieldTransformationsInto(): bad output size, expected 5 but got 4\n");
 }
 
+/* A tree with a branching factor of 8 and ~100k objects, so the last levels
+   are large enough to be processed on multiple threads. The parent field is
+   in a shuffled order, not all objects have a transformation and some have
+   more than one mesh. */
+Trade::SceneData largeScene() {
+    constexpr UnsignedInt ObjectCount = 100000;
+    constexpr UnsignedInt TransformationCount = ObjectCount - ObjectCount/5;
+    constexpr UnsignedInt MeshCount = ObjectCount/3 + ObjectCount/7 + 2;
+
+    Containers::ArrayView<UnsignedInt> parentMapping;
+    Containers::ArrayView<Int> parents;
+    Containers::ArrayView<UnsignedInt> transformationMapping;
+    Containers::ArrayView<Matrix4> transformations;
+    Containers::ArrayView<UnsignedInt> meshMapping;
+    Containers::ArrayView<UnsignedInt> meshes;
+    Containers::ArrayTuple data{
+        {NoInit, ObjectCount, parentMapping},
+        {NoInit, ObjectCount, parents},
+        {NoInit, TransformationCount, transformationMapping},
+        {NoInit, TransformationCount, transformations},
+        {NoInit, MeshCount, meshMapping},
+        {ValueInit, MeshCount, meshes},
+    };
+
+    for(UnsignedInt i = 0; i != ObjectCount; ++i) {
+        const UnsignedInt object = UnsignedInt((i*7919ull) % ObjectCount);
+        parentMapping[i] = object;
+        parents[i] = object ? Int((object - 1)/8) : -1;
+    }
+
+    std::size_t transformationOffset = 0;
+    for(UnsignedInt i = 0; i != ObjectCount; ++i) {
+        if(i % 5 == 4) continue;
+        transformationMapping[transformationOffset] = i;
+        transformations[transformationOffset] =
+            Matrix4::translation({0.01f*Float(i % 13), -0.02f*Float(i % 7), 0.5f})*
+            Matrix4::rotationZ(Deg(Float(i % 11)))*
+            Matrix4::scaling(Vector3{0.99f});
+        ++transformationOffset;
+    }
+    CORRADE_INTERNAL_ASSERT(transformationOffset == TransformationCount);
+
+    std::size_t meshOffset = 0;
+    for(UnsignedInt i = 0; i < ObjectCount; i += 3)
+        meshMapping[meshOffset++] = i;
+    for(UnsignedInt i = 0; i < ObjectCount; i += 7)
+        meshMapping[meshOffset++] = i;
+    CORRADE_INTERNAL_ASSERT(meshOffset == MeshCount);
+
+    return Trade::SceneData{Trade::SceneMappingType::UnsignedInt, ObjectCount, Utility::move(data), {
+        Trade::SceneFieldData{Trade::SceneField::Parent, parentMapping, parents},
+        Trade::SceneFieldData{Trade::SceneField::Transformation, transformationMapping, transformations},
+        Trade::SceneFieldData{Trade::SceneField::Mesh, meshMapping, meshes},
+    }};
+}
+
+void HierarchyTest::absoluteFieldTransformationsMultithreaded() {
+    auto&& data = MultithreadedData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Trade::SceneData scene = largeScene();
+    const Matrix4 globalTransformation = Matrix4::scaling(Vector3{0.5f});
+
+    /* The result should be exactly the same as with the serial variant */
+    Containers::Array<Matrix4> expected = absoluteFieldTransformations3D(scene, Trade::SceneField::Mesh, globalTransformation);
+    Containers::Array<Matrix4> actual = absoluteFieldTransformations3D(scene, Trade::SceneField::Mesh, globalTransformation, data.threadCount);
+    CORRADE_COMPARE_AS(actual, expected, TestSuite::Compare::Container);
+
+    Containers::Array<Matrix4> actualInto{NoInit, scene.fieldSize(Trade::SceneField::Mesh)};
+    absoluteFieldTransformations3DInto(scene, 2, actualInto, globalTransformation, data.threadCount);
+    CORRADE_COMPARE_AS(actualInto, expected, TestSuite::Compare::Container);
+}
+
+void HierarchyTest::transformationHierarchy2D() {
+    auto&& data = IntoData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedShort, 33, {}, Data, {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::stridedArrayView(Data->parents)
+                .slice(&Scene::Parent::object),
+            Containers::stridedArrayView(Data->parents)
+                .slice(&Scene::Parent::parent)},
+        Trade::SceneFieldData{Trade::SceneField::Transformation,
+            Containers::stridedArrayView(Data->transforms)
+                .slice(&Scene::Transformation::object),
+            Containers::stridedArrayView(Data->transforms)
+                .slice(&Scene::Transformation::transformation2D)},
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::stridedArrayView(Data->meshes)
+                .slice(&Scene::Mesh::object),
+            Containers::stridedArrayView(Data->meshes)
+                .slice(&Scene::Mesh::mesh)}
+    }};
+
+    TransformationHierarchy2D hierarchy = data.fieldIdInsteadOfName ?
+        TransformationHierarchy2D{scene, 2} :
+        TransformationHierarchy2D{scene, Trade::SceneField::Mesh};
+    CORRADE_COMPARE(hierarchy.fieldId(), 2);
+    CORRADE_COMPARE(hierarchy.fieldSize(), 5);
+    CORRADE_VERIFY(!hierarchy.isUpdated());
+
+    Containers::Array<Matrix3> out{NoInit, hierarchy.fieldSize()};
+    /* To test both overloads */
+    if(data.globalTransformation2D != Matrix3{})
+        hierarchy.updateInto(scene, out, data.globalTransformation2D);
+    else
+        hierarchy.updateInto(scene, out);
+    CORRADE_VERIFY(hierarchy.isUpdated());
+
+    CORRADE_COMPARE_AS(out, Containers::arrayView<Matrix3>({
+        data.globalTransformation2D*
+            Matrix3::translation({1.0f, -1.5f})*
+            Matrix3::scaling({3.0f, 5.0f}),
+        data.globalTransformation2D*
+            Matrix3::translation({1.0f, -1.5f})*
+            Matrix3::rotation(35.0_degf),
+        data.globalTransformation2D,
+        data.globalTransformation2D*
+            Matrix3::translation({1.0f, -1.5f})*
+            Matrix3::rotation(35.0_degf),
+        data.globalTransformation2D*
+            Matrix3::translation({1.0f, -1.5f})*
+            Matrix3::scaling({3.0f, 5.0f})
+    }), TestSuite::Compare::Container);
+}
+
+void HierarchyTest::transformationHierarchy3D() {
+    auto&& data = IntoData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedShort, 33, {}, Data, {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::stridedArrayView(Data->parents)
+                .slice(&Scene::Parent::object),
+            Containers::stridedArrayView(Data->parents)
+                .slice(&Scene::Parent::parent)},
+        Trade::SceneFieldData{Trade::SceneField::Transformation,
+            Containers::stridedArrayView(Data->transforms)
+                .slice(&Scene::Transformation::object),
+            Containers::stridedArrayView(Data->transforms)
+                .slice(&Scene::Transformation::transformation3D)},
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::stridedArrayView(Data->meshes)
+                .slice(&Scene::Mesh::object),
+            Containers::stridedArrayView(Data->meshes)
+                .slice(&Scene::Mesh::mesh)}
+    }};
+
+    TransformationHierarchy3D hierarchy = data.fieldIdInsteadOfName ?
+        TransformationHierarchy3D{scene, 2} :
+        TransformationHierarchy3D{scene, Trade::SceneField::Mesh};
+    CORRADE_COMPARE(hierarchy.fieldId(), 2);
+    CORRADE_COMPARE(hierarchy.fieldSize(), 5);
+    CORRADE_VERIFY(!hierarchy.isUpdated());
+
+    Containers::Array<Matrix4> out{NoInit, hierarchy.fieldSize()};
+    /* To test both overloads */
+    if(data.globalTransformation3D != Matrix4{})
+        hierarchy.updateInto(scene, out, data.globalTransformation3D);
+    else
+        hierarchy.updateInto(scene, out);
+    CORRADE_VERIFY(hierarchy.isUpdated());
+
+    CORRADE_COMPARE_AS(out, Containers::arrayView<Matrix4>({
+        data.globalTransformation3D*
+            Matrix4::translation({1.0f, -1.5f, 0.5f})*
+            Matrix4::scaling({3.0f, 5.0f, 2.0f}),
+        data.globalTransformation3D*
+            Matrix4::translation({1.0f, -1.5f, 0.5f})*
+            Matrix4::rotationZ(35.0_degf),
+        data.globalTransformation3D,
+        data.globalTransformation3D*
+            Matrix4::translation({1.0f, -1.5f, 0.5f})*
+            Matrix4::rotationZ(35.0_degf),
+        data.globalTransformation3D*
+            Matrix4::translation({1.0f, -1.5f, 0.5f})*
+            Matrix4::scaling({3.0f, 5.0f, 2.0f})
+    }), TestSuite::Compare::Container);
+}
+
+void HierarchyTest::transformationHierarchyIncremental2D() {
+    /* A mutable copy of the data, modified after the first update */
+    Scene sceneData = *Data;
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedShort, 33, {}, Containers::arrayView(&sceneData, 1), {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::stridedArrayView(sceneData.parents)
+                .slice(&Scene::Parent::object),
+            Containers::stridedArrayView(sceneData.parents)
+                .slice(&Scene::Parent::parent)},
+        Trade::SceneFieldData{Trade::SceneField::Transformation,
+            Containers::stridedArrayView(sceneData.transforms)
+                .slice(&Scene::Transformation::object),
+            Containers::stridedArrayView(sceneData.transforms)
+                .slice(&Scene::Transformation::transformation2D)},
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::stridedArrayView(sceneData.meshes)
+                .slice(&Scene::Mesh::object),
+            Containers::stridedArrayView(sceneData.meshes)
+                .slice(&Scene::Mesh::mesh)}
+    }};
+
+    const Matrix3 globalTransformation = Matrix3::scaling(Vector2{0.5f});
+    TransformationHierarchy2D hierarchy{scene, Trade::SceneField::Mesh};
+    Containers::Array<Matrix3> out{NoInit, hierarchy.fieldSize()};
+    hierarchy.updateInto(scene, out, globalTransformation);
+    CORRADE_COMPARE_AS(out,
+        absoluteFieldTransformations2D(scene, Trade::SceneField::Mesh, globalTransformation),
+        TestSuite::Compare::Container);
+
+    /* Change the transformation of object 1, which is a parent of everything
+       except the 4 subtree, and of object 16, which is in the 4 subtree. */
+    sceneData.transforms[1].transformation2D = Matrix3::translation({-2.0f, 0.5f});
+    sceneData.transforms[2].transformation2D = Matrix3::rotation(15.0_degf);
+
+    /* Updating just object 1 updates everything except the entry for object
+       16. Object 4 has no transformation, so its entry stays the same. */
+    Containers::Array<Matrix3> expected = absoluteFieldTransformations2D(scene, Trade::SceneField::Mesh, globalTransformation);
+    hierarchy.updateInto(scene, Containers::arrayView({1u}), out);
+    CORRADE_COMPARE(out[0], expected[0]);
+    CORRADE_COMPARE(out[1], expected[1]);
+    CORRADE_COMPARE(out[2], expected[2]);
+    CORRADE_COMPARE(out[3], expected[3]);
+    CORRADE_VERIFY(out[4] != expected[4]);
+
+    /* Updating object 16 updates the rest. Object 5 is a child of 1 and thus
+       processed as a part of it, object 16 is listed twice, and object 32 isn't
+       part of the hierarchy. The result should be the same as if everything
+       was calculated from scratch. */
+    hierarchy.updateInto(scene, Containers::arrayView({5u, 16u, 32u, 1u, 16u}), out);
+    CORRADE_COMPARE_AS(out, expected, TestSuite::Compare::Container);
+}
+
+void HierarchyTest::transformationHierarchyIncremental3D() {
+    /* A mutable copy of the data, modified after the first update */
+    Scene sceneData = *Data;
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedShort, 33, {}, Containers::arrayView(&sceneData, 1), {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::stridedArrayView(sceneData.parents)
+                .slice(&Scene::Parent::object),
+            Containers::stridedArrayView(sceneData.parents)
+                .slice(&Scene::Parent::parent)},
+        Trade::SceneFieldData{Trade::SceneField::Transformation,
+            Containers::stridedArrayView(sceneData.transforms)
+                .slice(&Scene::Transformation::object),
+            Containers::stridedArrayView(sceneData.transforms)
+                .slice(&Scene::Transformation::transformation3D)},
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::stridedArrayView(sceneData.meshes)
+                .slice(&Scene::Mesh::object),
+            Containers::stridedArrayView(sceneData.meshes)
+                .slice(&Scene::Mesh::mesh)}
+    }};
+
+    const Matrix4 globalTransformation = Matrix4::scaling(Vector3{0.5f});
+    TransformationHierarchy3D hierarchy{scene, Trade::SceneField::Mesh};
+    Containers::Array<Matrix4> out{NoInit, hierarchy.fieldSize()};
+    hierarchy.updateInto(scene, out, globalTransformation);
+    CORRADE_COMPARE_AS(out,
+        absoluteFieldTransformations3D(scene, Trade::SceneField::Mesh, globalTransformation),
+        TestSuite::Compare::Container);
+
+    /* Change the transformation of object 1, which is a parent of everything
+       except the 4 subtree, and of object 16, which is in the 4 subtree. */
+    sceneData.transforms[1].transformation3D = Matrix4::translation({-2.0f, 0.5f, 1.0f});
+    sceneData.transforms[2].transformation3D = Matrix4::rotationX(15.0_degf);
+
+    /* Updating just object 1 updates everything except the entry for object
+       16. Object 4 has no transformation, so its entry stays the same. */
+    Containers::Array<Matrix4> expected = absoluteFieldTransformations3D(scene, Trade::SceneField::Mesh, globalTransformation);
+    hierarchy.updateInto(scene, Containers::arrayView({1u}), out);
+    CORRADE_COMPARE(out[0], expected[0]);
+    CORRADE_COMPARE(out[1], expected[1]);
+    CORRADE_COMPARE(out[2], expected[2]);
+    CORRADE_COMPARE(out[3], expected[3]);
+    CORRADE_VERIFY(out[4] != expected[4]);
+
+    /* Updating object 16 updates the rest. Object 5 is a child of 1 and thus
+       processed as a part of it, object 16 is listed twice, and object 32 isn't
+       part of the hierarchy. The result should be the same as if everything
+       was calculated from scratch. */
+    hierarchy.updateInto(scene, Containers::arrayView({5u, 16u, 32u, 1u, 16u}), out);
+    CORRADE_COMPARE_AS(out, expected, TestSuite::Compare::Container);
+}
+
+void HierarchyTest::transformationHierarchyIncrementalMultithreaded() {
+    auto&& data = MultithreadedData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Trade::SceneData scene = largeScene();
+    const Matrix4 globalTransformation = Matrix4::scaling(Vector3{0.5f});
+
+    TransformationHierarchy3D hierarchy{scene, Trade::SceneField::Mesh};
+    Containers::Array<Matrix4> out{NoInit, hierarchy.fieldSize()};
+    hierarchy.updateInto(scene, out, globalTransformation, data.threadCount);
+    CORRADE_COMPARE_AS(out,
+        absoluteFieldTransformations3D(scene, Trade::SceneField::Mesh, globalTransformation),
+        TestSuite::Compare::Container);
+
+    /* Modify transformations of a few objects at various depths, including
+       a parent and a child of it */
+    const UnsignedInt changed[]{2, 19, 12345, 99999, 17};
+    Containers::StridedArrayView1D<const UnsignedInt> transformationMapping = scene.mapping<UnsignedInt>(Trade::SceneField::Transformation);
+    Containers::StridedArrayView1D<Matrix4> transformations = scene.mutableField<Matrix4>(Trade::SceneField::Transformation);
+    for(std::size_t i = 0; i != transformationMapping.size(); ++i) {
+        for(const UnsignedInt object: changed) {
+            if(transformationMapping[i] == object)
+                transformations[i] = Matrix4::rotationY(Deg(Float(object % 90)))*transformations[i];
+        }
+    }
+
+    hierarchy.updateInto(scene, changed, out);
+    CORRADE_COMPARE_AS(out,
+        absoluteFieldTransformations3D(scene, Trade::SceneField::Mesh, globalTransformation),
+        TestSuite::Compare::Container);
+}
+
+void HierarchyTest::transformationHierarchyNoCreate() {
+    TransformationHierarchy3D hierarchy{NoCreate};
+    CORRADE_COMPARE(hierarchy.fieldId(), 0);
+    CORRADE_COMPARE(hierarchy.fieldSize(), 0);
+    CORRADE_VERIFY(!hierarchy.isUpdated());
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<TransformationHierarchy3D>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<TransformationHierarchy3D>::value);
+    CORRADE_VERIFY(!std::is_copy_constructible<TransformationHierarchy3D>::value);
+    CORRADE_VERIFY(!std::is_copy_assignable<TransformationHierarchy3D>::value);
+}
+
+void HierarchyTest::transformationHierarchyInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::SceneData scene2D{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {
+        Trade::SceneFieldData{Trade::SceneField::Parent, Trade::SceneMappingType::UnsignedInt, nullptr, Trade::SceneFieldType::Int, nullptr},
+        Trade::SceneFieldData{Trade::SceneField::Transformation, Trade::SceneMappingType::UnsignedInt, nullptr, Trade::SceneFieldType::Matrix3x3, nullptr}
+    }};
+    Trade::SceneData noHierarchy{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {
+        Trade::SceneFieldData{Trade::SceneField::Transformation, Trade::SceneMappingType::UnsignedInt, nullptr, Trade::SceneFieldType::Matrix4x4, nullptr}
+    }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    TransformationHierarchy3D{scene2D, 0};
+    TransformationHierarchy2D{scene2D, 2};
+    TransformationHierarchy2D{scene2D, Trade::SceneField::Mesh};
+    TransformationHierarchy3D{noHierarchy, 0};
+    CORRADE_COMPARE(out,
+        "SceneTools::TransformationHierarchy: the scene is not 3D\n"
+        "SceneTools::TransformationHierarchy: index 2 out of range for 2 fields\n"
+        "SceneTools::TransformationHierarchy: field Trade::SceneField::Mesh not found\n"
+        "SceneTools::TransformationHierarchy: the scene has no hierarchy\n");
+}
+
+void HierarchyTest::transformationHierarchyUpdateInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedShort, 33, {}, Data, {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::stridedArrayView(Data->parents)
+                .slice(&Scene::Parent::object),
+            Containers::stridedArrayView(Data->parents)
+                .slice(&Scene::Parent::parent)},
+        Trade::SceneFieldData{Trade::SceneField::Transformation,
+            Containers::stridedArrayView(Data->transforms)
+                .slice(&Scene::Transformation::object),
+            Containers::stridedArrayView(Data->transforms)
+                .slice(&Scene::Transformation::transformation3D)},
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::stridedArrayView(Data->meshes)
+                .slice(&Scene::Mesh::object),
+            Containers::stridedArrayView(Data->meshes)
+                .slice(&Scene::Mesh::mesh)}
+    }};
+    Trade::SceneData different{Trade::SceneMappingType::UnsignedShort, 32, {}, Data, {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::stridedArrayView(Data->parents)
+                .slice(&Scene::Parent::object),
+            Containers::stridedArrayView(Data->parents)
+                .slice(&Scene::Parent::parent)},
+    }};
+
+    TransformationHierarchy3D hierarchy{scene, Trade::SceneField::Mesh};
+    Matrix4 transformations[5];
+    Matrix4 transformationsInvalid[4];
+
+    Containers::String out;
+    Error redirectError{&out};
+    hierarchy.updateInto(scene, Containers::arrayView({1u}), transformations);
+    hierarchy.updateInto(different, transformations);
+    hierarchy.updateInto(scene, transformationsInvalid);
+    hierarchy.updateInto(scene, transformations);
+    hierarchy.updateInto(different, Containers::arrayView({1u}), transformations);
+    hierarchy.updateInto(scene, Containers::arrayView({1u}), transformationsInvalid);
+    hierarchy.updateInto(scene, Containers::arrayView({1u, 33u}), transformations);
+    CORRADE_COMPARE(out,
+        "SceneTools::TransformationHierarchy::updateInto(): no full update done yet\n"
+        "SceneTools::TransformationHierarchy::updateInto(): expected a scene with 33 objects and 5 entries in field 2\n"
+        "SceneTools::TransformationHierarchy::updateInto(): bad output size, expected 5 but got 4\n"
+        "SceneTools::TransformationHierarchy::updateInto(): expected a scene with 33 objects and 5 entries in field 2\n"
+        "SceneTools::TransformationHierarchy::updateInto(): bad output size, expected 5 but got 4\n"
+        "SceneTools::TransformationHierarchy::updateInto(): object 33 out of range for 33 objects\n");
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::SceneTools::Test::HierarchyTest)
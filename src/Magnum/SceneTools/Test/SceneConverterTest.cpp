@@ -1094,7 +1094,7 @@ const struct {
             Utility::Path::join(SCENETOOLS_TEST_OUTPUT_DIR, "SceneConverterTestFiles/whatever.ply")
         }},
         "AnySceneImporter", nullptr, nullptr, nullptr,
-        "Utility::Path::mapRead(): can't open nonexistent.ffs: error 2 (No such file or directory)\n"
+        "Trade::AnySceneImporter::openFile(): cannot determine the format of nonexistent.ffs\n"
         "Cannot memory-map file nonexistent.ffs\n"},
     {"no meshes found for concatenation", {InPlaceInit, {
             "--concatenate-meshes",
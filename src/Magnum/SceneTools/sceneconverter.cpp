@@ -217,8 +217,8 @@ Arguments:
 -   `--prefer alias:plugin1,plugin2,…` --- prefer particular plugins for given
     alias(es)
 -   `--set plugin:key=val,key2=val2,…` ---  set global plugin(s) option
--   `--map` --- memory-map the input for zero-copy import (works only for
-    standalone files)
+-   `--map` --- memory-map the input and all files it references for
+    zero-copy import
 -   `--only-mesh-attributes N1,N2-N3…` --- include only mesh attributes of
     given IDs in the output. See
     @relativeref{Corrade,Utility::String::parseNumberSequence()} for syntax
@@ -432,7 +432,7 @@ int main(int argc, char** argv) {
         .addArrayOption("prefer").setHelp("prefer", "prefer particular plugins for given alias(es)", "alias:plugin1,plugin2,…")
         .addArrayOption("set").setHelp("set", "set global plugin(s) options", "plugin:key=val,key2=val2,…")
         #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
-        .addBooleanOption("map").setHelp("map", "memory-map the input for zero-copy import (works only for standalone files)")
+        .addBooleanOption("map").setHelp("map", "memory-map the input and all files it references for zero-copy import")
         #endif
         .addOption("only-mesh-attributes").setHelp("only-mesh-attributes", "include only mesh attributes of given IDs in the output", "N1,N2-N3…")
         .addBooleanOption("remove-duplicate-vertices").setHelp("remove-duplicate-vertices", "remove duplicate vertices in all meshes after import")
@@ -760,21 +760,14 @@ well, the IDs reference attributes of the first mesh.)")
        conversion are measured separately. */
     std::chrono::high_resolution_clock::duration importConversionTime{};
 
-    /* Open the file or map it if requested */
-    #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
-    Containers::Optional<Containers::Array<const char, Utility::Path::MapDeleter>> mapped;
-    if(args.isSet("map")) {
-        Trade::Implementation::Duration d{importConversionTime};
-        if(!(mapped = Utility::Path::mapRead(args.value("input"))) || !importer->openMemory(*mapped)) {
-            Error() << "Cannot memory-map file" << args.value("input");
-            return 3;
-        }
-    } else
-    #endif
+    /* Open the file, mapping it and all files it references if requested.
+       The mapping is managed by the importer and stays alive until it's
+       closed. */
+    if(args.isSet("map")) importer->addFlags(Trade::ImporterFlag::MapFiles);
     {
         Trade::Implementation::Duration d{importConversionTime};
         if(!importer->openFile(args.value("input"))) {
-            Error() << "Cannot open file" << args.value("input");
+            Error() << (args.isSet("map") ? "Cannot memory-map file" : "Cannot open file") << args.value("input");
             return 3;
         }
     }
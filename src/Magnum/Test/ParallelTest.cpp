@@ -0,0 +1,161 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <atomic>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+
+#include "Magnum/Implementation/parallel.h"
+
+namespace Magnum { namespace Test { namespace {
+
+struct ParallelTest: TestSuite::Tester {
+    explicit ParallelTest();
+
+    void threadCount();
+    void threadCountHardware();
+
+    void parallelFor();
+    void parallelForEmpty();
+    void parallelForLessItemsThanThreads();
+};
+
+const struct {
+    const char* name;
+    UnsignedInt threadCount;
+    std::size_t count;
+} ParallelForData[]{
+    {"single thread", 1, 1000},
+    {"two threads", 2, 1000},
+    {"seven threads", 7, 1000},
+    {"all hardware threads", 0, 1000},
+    {"seven threads, uneven", 7, 13},
+};
+
+ParallelTest::ParallelTest() {
+    addTests({&ParallelTest::threadCount,
+              &ParallelTest::threadCountHardware});
+
+    addInstancedTests({&ParallelTest::parallelFor},
+        Containers::arraySize(ParallelForData));
+
+    addTests({&ParallelTest::parallelForEmpty,
+              &ParallelTest::parallelForLessItemsThanThreads});
+}
+
+void ParallelTest::threadCount() {
+    CORRADE_COMPARE(Implementation::parallelThreadCount(1, 1000), 1);
+    /* Zero items still result in one (empty) range */
+    CORRADE_COMPARE(Implementation::parallelThreadCount(1, 0), 1);
+    CORRADE_COMPARE(Implementation::parallelThreadCount(5, 0), 1);
+
+    #if !defined(CORRADE_TARGET_EMSCRIPTEN) || defined(__EMSCRIPTEN_PTHREADS__)
+    CORRADE_COMPARE(Implementation::parallelThreadCount(5, 1000), 5);
+    /* Clamped to the item count */
+    CORRADE_COMPARE(Implementation::parallelThreadCount(5, 3), 3);
+    #else
+    CORRADE_COMPARE(Implementation::parallelThreadCount(5, 1000), 1);
+    #endif
+}
+
+void ParallelTest::threadCountHardware() {
+    const UnsignedInt count = Implementation::parallelThreadCount(0, 1000000);
+    CORRADE_INFO("Hardware thread count:" << count);
+    CORRADE_COMPARE_AS(count, 0u,
+        TestSuite::Compare::Greater);
+}
+
+void ParallelTest::parallelFor() {
+    auto&& data = ParallelForData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const UnsignedInt threadCount = Implementation::parallelThreadCount(data.threadCount, data.count);
+
+    /* Each item should be visited exactly once and the ranges should be
+       contiguous in the order of thread IDs */
+    Containers::Array<UnsignedInt> visited{ValueInit, data.count};
+    Containers::Array<std::size_t> begins{DirectInit, threadCount, ~std::size_t{}};
+    Containers::Array<std::size_t> ends{DirectInit, threadCount, ~std::size_t{}};
+    std::atomic<UnsignedInt> calls{0};
+    Implementation::parallelFor(data.count, data.threadCount, [&](std::size_t begin, std::size_t end, UnsignedInt thread) {
+        ++calls;
+        begins[thread] = begin;
+        ends[thread] = end;
+        for(std::size_t i = begin; i != end; ++i) ++visited[i];
+    });
+
+    CORRADE_COMPARE(calls.load(), threadCount);
+    for(std::size_t i = 0; i != data.count; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(visited[i], 1);
+    }
+    CORRADE_COMPARE(begins[0], 0);
+    CORRADE_COMPARE(ends[threadCount - 1], data.count);
+    for(std::size_t i = 1; i != threadCount; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(begins[i], ends[i - 1]);
+        /* The ranges should be balanced */
+        CORRADE_COMPARE_AS(ends[i] - begins[i], data.count/threadCount,
+            TestSuite::Compare::GreaterOrEqual);
+        CORRADE_COMPARE_AS(ends[i] - begins[i], data.count/threadCount + 1,
+            TestSuite::Compare::LessOrEqual);
+    }
+}
+
+void ParallelTest::parallelForEmpty() {
+    UnsignedInt calls = 0;
+    Implementation::parallelFor(0, 4, [&](std::size_t begin, std::size_t end, UnsignedInt thread) {
+        ++calls;
+        CORRADE_COMPARE(begin, 0);
+        CORRADE_COMPARE(end, 0);
+        CORRADE_COMPARE(thread, 0);
+    });
+    CORRADE_COMPARE(calls, 1);
+}
+
+void ParallelTest::parallelForLessItemsThanThreads() {
+    /* Each thread should get exactly one item, with no empty ranges. Not
+       checking inside the function as the test macros aren't thread-safe. */
+    std::size_t sizes[16]{};
+    std::atomic<UnsignedInt> calls{0};
+    Implementation::parallelFor(2, 16, [&](std::size_t begin, std::size_t end, UnsignedInt thread) {
+        ++calls;
+        sizes[thread] = end - begin;
+    });
+    #if !defined(CORRADE_TARGET_EMSCRIPTEN) || defined(__EMSCRIPTEN_PTHREADS__)
+    CORRADE_COMPARE(calls.load(), 2);
+    CORRADE_COMPARE(sizes[0], 1);
+    CORRADE_COMPARE(sizes[1], 1);
+    #else
+    CORRADE_COMPARE(calls.load(), 1);
+    CORRADE_COMPARE(sizes[0], 2);
+    #endif
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Test::ParallelTest)
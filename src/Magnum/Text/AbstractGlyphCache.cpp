@@ -26,16 +26,21 @@
 
 #include "AbstractGlyphCache.h"
 
+#include <algorithm> /* std::partial_sort() */
 #include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/BitArray.h>
 #include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/EnumSet.hpp>
 #include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/Triple.h>
 #include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Move.h>
 
 #include "Magnum/Image.h"
 #include "Magnum/ImageView.h"
 #include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Range.h"
 #include "Magnum/TextureTools/Atlas.h"
 
@@ -70,6 +75,37 @@ Debug& operator<<(Debug& debug, const GlyphCacheFeatures value) {
     });
 }
 
+namespace {
+
+/* Each page of the font glyph mapping covers 64 consecutive glyph IDs */
+constexpr UnsignedInt GlyphPageBits = 6;
+constexpr UnsignedInt GlyphPageSize = 1 << GlyphPageBits;
+
+inline Vector2i atlasOffsetXY(const Vector2i& offset) { return offset; }
+inline Vector2i atlasOffsetXY(const Vector3i& offset) { return offset.xy(); }
+inline Int atlasOffsetLayer(const Vector2i&) { return 0; }
+inline Int atlasOffsetLayer(const Vector3i& offset) { return offset.z(); }
+
+inline Range3Di atlasRange(const Range2Di& range) {
+    return {{range.min(), 0}, {range.max(), 1}};
+}
+inline Range3Di atlasRange(const Range3Di& range) { return range; }
+
+inline Vector2i atlasOffset(const Vector3i& offset, Vector2i) { return offset.xy(); }
+inline Vector3i atlasOffset(const Vector3i& offset, Vector3i) { return offset; }
+
+/* Upper bound on the count of ranges accumulated for flushImage(). Beyond
+   that, the pair that results in the least area being uploaded redundantly
+   gets merged. */
+constexpr std::size_t MaxDirtyRanges = 16;
+
+inline Long rangeVolume(const Range3Di& range) {
+    const Vector3i size = range.size();
+    return Long(size.x())*size.y()*size.z();
+}
+
+}
+
 struct AbstractGlyphCache::State {
     explicit State(PixelFormat format, const Vector3i& size, PixelFormat processedFormat, const Vector2i& processedSize, const Vector2i& padding): image{format, size, Containers::Array<char>{ValueInit, 4*((pixelFormatSize(format)*size.x() + 3)/4)*size.y()*size.z()}}, atlas{size}, processedFormat{processedFormat}, processedSize{processedSize}, padding{padding} {
         /* Flags are currently cleared as well, will be enabled back in a later
@@ -95,33 +131,328 @@ struct AbstractGlyphCache::State {
        from the fontGlyphMapping array. Index 0 is reserved for an invalid
        glyph. */
     Containers::Array<Containers::Triple<Vector2i, Int, Range2Di>> glyphs;
-    /* `fontRanges[i]` to `fontRanges[i + 1]` is the range in
-       `fontGlyphMapping` containing a mapping for glyphs from font `i`,
-       `fontGlyphMapping[fontRanges[i]] + j` is then mapping from glyph ID `j`
-       from font `i` to index in the `glyphs` array, or is 0 if given
-       glyph isn't present in the cache (which then maps to the invalid
-       glyph). */
+    /* `fonts[i].offset` to `fonts[i + 1].offset` is the range in
+       `fontGlyphPages` containing page indices for glyphs from font `i`,
+       `fonts[i].glyphCount` is the glyph count passed to addFont(). Glyph ID
+       `j` from font `i` is then at
+       `fontGlyphPages[fonts[i].offset + (j >> GlyphPageBits)]` page of
+       `fontGlyphMapping`, at position `j & (GlyphPageSize - 1)` in it. The
+       value is an index in the `glyphs` array, or is 0 if given glyph isn't
+       present in the cache (which then maps to the invalid glyph). */
     struct Font {
         UnsignedInt offset;
-        /* 4 bytes free on 64b, but not so critical I think */
+        UnsignedInt glyphCount;
         const AbstractFont* pointer;
     };
     Containers::Array<Font> fonts;
-    /* With an assumption that majority of font glyphs get put into a cache,
-       this achieves O(1) mapping from a font ID + font-specific glyph ID pair
+    /* This achieves O(1) mapping from a font ID + font-specific glyph ID pair
        to a cache-global glyph ID with far less overhead than a hashmap would,
        and much less memory used as well compared to storing a key, value and a
-       hash for each mapping entry.
+       hash for each mapping entry. To not need a mapping entry for every
+       glyph of every font, which would be wasteful for fonts with large
+       alphabets such as CJK where usually only a small subset of glyphs gets
+       put into the cache, the mapping is split into pages of GlyphPageSize
+       entries that get allocated only once a glyph from given page is added.
+       Page 0 is always zero-filled and all pages with no glyphs added point
+       to it, so the lookup doesn't need to branch.
 
        Another assumption is that there's no more than 64k glyphs in total,
        which makes the mapping save half memory compared to storing 32-bit
        ints. 64K glyphs is enough to fill a 4K texture with 16x16 glyphs, which
        seems enough for now. It however might get reached at some point in
        practice, in which case the type would simply get changed to a 32-bit
-       one (and the assertion in addGlyph() then removed). */
+       one (and the assertion in addGlyph() then removed). As every added
+       glyph allocates at most one page, this also means the page indices fit
+       into 16 bits. */
+    Containers::Array<UnsignedShort> fontGlyphPages;
     Containers::Array<UnsignedShort> fontGlyphMapping;
+
+    /* Font ID and font-specific glyph ID for each item in `glyphs`, used for
+       clearing the fontGlyphMapping entry when the glyph gets evicted. The
+       font ID is ~UnsignedInt{} for the invalid glyph at index 0 and for
+       slots of evicted glyphs. The slots are listed in `freeGlyphIds` and get
+       reused by subsequently added glyphs. */
+    Containers::Array<Containers::Pair<UnsignedInt, UnsignedInt>> glyphFontGlyphIds;
+    Containers::Array<UnsignedInt> freeGlyphIds;
+    /* Value of `usage` at the time given glyph was added or last passed to
+       markGlyphsUsed(), which increments `usage` on every call */
+    Containers::Array<UnsignedInt> glyphLastUsed;
+    UnsignedInt usage = 0;
+    /* Padded atlas areas of evicted glyphs that are free to be reused by
+       addGlyphs(). The Z coordinate is the layer. */
+    Containers::Array<Range3Di> freeRanges;
+    /* Image areas without padding that were updated since the last
+       flushImage() call */
+    Containers::Array<Range3Di> dirtyRanges;
+
+    UnsignedInt glyphId(const UnsignedInt fontId, const UnsignedInt fontGlyphId) const {
+        const UnsignedInt page = fontGlyphPages[fonts[fontId].offset + (fontGlyphId >> GlyphPageBits)];
+        return fontGlyphMapping[(page << GlyphPageBits)|(fontGlyphId & (GlyphPageSize - 1))];
+    }
+
+    /* Allocates a new page if the glyph is in a page that has no glyphs yet */
+    UnsignedShort& glyphIdForAdding(const UnsignedInt fontId, const UnsignedInt fontGlyphId) {
+        UnsignedShort& page = fontGlyphPages[fonts[fontId].offset + (fontGlyphId >> GlyphPageBits)];
+        if(!page) {
+            page = UnsignedShort(fontGlyphMapping.size() >> GlyphPageBits);
+            arrayResize(fontGlyphMapping, fontGlyphMapping.size() + GlyphPageSize);
+        }
+        return fontGlyphMapping[(UnsignedInt(page) << GlyphPageBits)|(fontGlyphId & (GlyphPageSize - 1))];
+    }
+
+    UnsignedInt addGlyph(UnsignedInt fontId, UnsignedInt fontGlyphId, const Vector2i& offset, Int layer, const Range2Di& rectangle);
+    void removeGlyph(UnsignedInt glyphId);
+
+    /* Finds the smallest free range the padded size fits into, writes the
+       unpadded offset and puts the unused remainder back into `ranges` */
+    bool placeInFreeRange(Containers::Array<Range3Di>& ranges, const Vector2i& size, Vector3i& offset) const;
+    void addFreeRange(Range3Di range);
+    void addDirtyRange(const Range3Di& range);
+
+    #ifndef CORRADE_NO_ASSERT
+    bool checkAddGlyphs(UnsignedInt fontId, const Containers::StridedArrayView1D<const UnsignedInt>& fontGlyphIds, std::size_t offsetCount, std::size_t sizeCount, std::size_t atlasOffsetCount) const;
+    #endif
+
+    template<class T> Containers::Optional<Range3Di> addGlyphs(UnsignedInt fontId, const Containers::StridedArrayView1D<const UnsignedInt>& fontGlyphIds, const Containers::StridedArrayView1D<const Vector2i>& offsets, const Containers::StridedArrayView1D<const Vector2i>& sizes, const Containers::StridedArrayView1D<T>& atlasOffsets);
 };
 
+#ifndef CORRADE_NO_ASSERT
+bool AbstractGlyphCache::State::checkAddGlyphs(const UnsignedInt fontId, const Containers::StridedArrayView1D<const UnsignedInt>& fontGlyphIds, const std::size_t offsetCount, const std::size_t sizeCount, const std::size_t atlasOffsetCount) const {
+    CORRADE_ASSERT(offsetCount == fontGlyphIds.size() && sizeCount == fontGlyphIds.size() && atlasOffsetCount == fontGlyphIds.size(),
+        "Text::AbstractGlyphCache::addGlyphs(): expected fontGlyphIds, offsets, sizes and atlasOffsets views to have the same size but got" << fontGlyphIds.size() << Debug::nospace << "," << offsetCount << Debug::nospace << "," << sizeCount << "and" << atlasOffsetCount, false);
+    CORRADE_ASSERT(fontId < fonts.size() - 1,
+        "Text::AbstractGlyphCache::addGlyphs(): index" << fontId << "out of range for" << fonts.size() - 1 << "fonts", false);
+    const UnsignedInt fontGlyphCount = fonts[fontId].glyphCount;
+    Containers::BitArray listed{ValueInit, fontGlyphCount};
+    for(std::size_t i = 0; i != fontGlyphIds.size(); ++i) {
+        const UnsignedInt fontGlyphId = fontGlyphIds[i];
+        CORRADE_ASSERT(fontGlyphId < fontGlyphCount,
+            "Text::AbstractGlyphCache::addGlyphs(): glyph" << i << "index" << fontGlyphId << "out of range for" << fontGlyphCount << "glyphs in font" << fontId, false);
+        CORRADE_ASSERT(!glyphId(fontId, fontGlyphId),
+            "Text::AbstractGlyphCache::addGlyphs(): glyph" << fontGlyphId << "in font" << fontId << "already added at index" << glyphId(fontId, fontGlyphId), false);
+        CORRADE_ASSERT(!listed[fontGlyphId],
+            "Text::AbstractGlyphCache::addGlyphs(): glyph" << fontGlyphId << "in font" << fontId << "listed more than once", false);
+        listed.set(fontGlyphId);
+    }
+    /* The fontGlyphMapping entries are 16-bit to save memory, can't have IDs
+       beyond that. See its documentation for more reasoning. */
+    CORRADE_ASSERT(glyphs.size() - freeGlyphIds.size() + fontGlyphIds.size() <= 65536,
+        "Text::AbstractGlyphCache::addGlyphs(): only at most 65536 glyphs can be added, got" << fontGlyphIds.size() << "with" << glyphs.size() - freeGlyphIds.size() << "already present", false);
+    return true;
+}
+#endif
+
+UnsignedInt AbstractGlyphCache::State::addGlyph(const UnsignedInt fontId, const UnsignedInt fontGlyphId, const Vector2i& offset, const Int layer, const Range2Di& rectangle) {
+    /* Reuse a slot of an evicted glyph, if there's any */
+    UnsignedInt glyphId;
+    if(freeGlyphIds.isEmpty()) {
+        glyphId = glyphs.size();
+        arrayAppend(glyphs, NoInit, 1);
+        arrayAppend(glyphFontGlyphIds, NoInit, 1);
+        arrayAppend(glyphLastUsed, NoInit, 1);
+    } else {
+        glyphId = freeGlyphIds.back();
+        arrayRemoveSuffix(freeGlyphIds);
+    }
+
+    glyphIdForAdding(fontId, fontGlyphId) = glyphId;
+    glyphs[glyphId] = {offset - padding, layer, rectangle.padded(padding)};
+    glyphFontGlyphIds[glyphId] = {fontId, fontGlyphId};
+    glyphLastUsed[glyphId] = usage;
+    addDirtyRange({{rectangle.min(), layer}, {rectangle.max(), layer + 1}});
+    return glyphId;
+}
+
+void AbstractGlyphCache::State::removeGlyph(const UnsignedInt glyphId) {
+    const Containers::Pair<UnsignedInt, UnsignedInt> fontGlyphId = glyphFontGlyphIds[glyphId];
+    /* The page is guaranteed to be allocated already, so this doesn't
+       allocate anything */
+    glyphIdForAdding(fontGlyphId.first(), fontGlyphId.second()) = 0;
+
+    /* Clear the glyph data including padding so a glyph put into the same
+       area later doesn't have leftovers of this one in its padding. The area
+       doesn't need to be uploaded, that happens once it's reused. */
+    const Int layer = glyphs[glyphId].second();
+    const Range2Di& rectangle = glyphs[glyphId].third();
+    const Containers::StridedArrayView3D<char> pixels = image.pixels()[layer];
+    for(const Containers::StridedArrayView2D<char> row: pixels.sliceSize(
+        {std::size_t(rectangle.min().y()),
+         std::size_t(rectangle.min().x()), 0},
+        {std::size_t(rectangle.sizeY()),
+         std::size_t(rectangle.sizeX()), pixels.size()[2]}))
+        for(const Containers::StridedArrayView1D<char> pixel: row)
+            for(char& i: pixel) i = 0;
+
+    addFreeRange({{rectangle.min(), layer}, {rectangle.max(), layer + 1}});
+
+    glyphs[glyphId] = {};
+    glyphFontGlyphIds[glyphId] = {~UnsignedInt{}, 0u};
+    arrayAppend(freeGlyphIds, glyphId);
+}
+
+bool AbstractGlyphCache::State::placeInFreeRange(Containers::Array<Range3Di>& ranges, const Vector2i& size, Vector3i& offset) const {
+    const Vector2i paddedSize = size + 2*padding;
+
+    /* Pick the smallest range the glyph fits into */
+    std::size_t best = ~std::size_t{};
+    Long bestArea{};
+    for(std::size_t i = 0; i != ranges.size(); ++i) {
+        const Vector2i rangeSize = ranges[i].size().xy();
+        if((rangeSize < paddedSize).any())
+            continue;
+        const Long area = Long(rangeSize.x())*rangeSize.y();
+        if(best == ~std::size_t{} || area < bestArea) {
+            best = i;
+            bestArea = area;
+        }
+    }
+    if(best == ~std::size_t{})
+        return false;
+
+    const Range3Di range = ranges[best];
+    offset = {range.min().xy() + padding, range.min().z()};
+
+    /* Split the remaining space into two ranges, with the cut going along the
+       side with a larger leftover so the bigger of the two pieces stays as
+       large as possible */
+    const Vector2i cut = range.min().xy() + paddedSize;
+    Range3Di right, top;
+    if(range.max().x() - cut.x() > range.max().y() - cut.y()) {
+        right = {{cut.x(), range.min().y(), range.min().z()}, range.max()};
+        top = {{range.min().x(), cut.y(), range.min().z()},
+               {cut.x(), range.max().y(), range.max().z()}};
+    } else {
+        right = {{cut.x(), range.min().y(), range.min().z()},
+                 {range.max().x(), cut.y(), range.max().z()}};
+        top = {{range.min().x(), cut.y(), range.min().z()}, range.max()};
+    }
+
+    ranges[best] = ranges.back();
+    arrayRemoveSuffix(ranges);
+    if(rangeVolume(right))
+        arrayAppend(ranges, right);
+    if(rangeVolume(top))
+        arrayAppend(ranges, top);
+    return true;
+}
+
+void AbstractGlyphCache::State::addFreeRange(Range3Di range) {
+    if(!rangeVolume(range))
+        return;
+
+    /* Merge with neighbors in the same layer sharing a whole edge, which
+       undoes the splitting in placeInFreeRange() if all glyphs that were put
+       into given range get evicted */
+    for(std::size_t i = 0; i != freeRanges.size(); ++i) {
+        const Range3Di& other = freeRanges[i];
+        if(other.min().z() != range.min().z())
+            continue;
+        if((other.min().y() == range.min().y() &&
+            other.max().y() == range.max().y() &&
+           (other.max().x() == range.min().x() ||
+            other.min().x() == range.max().x())) ||
+           (other.min().x() == range.min().x() &&
+            other.max().x() == range.max().x() &&
+           (other.max().y() == range.min().y() ||
+            other.min().y() == range.max().y())))
+        {
+            range = Math::join(range, other);
+            freeRanges[i] = freeRanges.back();
+            arrayRemoveSuffix(freeRanges);
+            /* Start over as the merged range may now neighbor with ranges
+               that were already checked */
+            i = ~std::size_t{};
+        }
+    }
+
+    arrayAppend(freeRanges, range);
+}
+
+void AbstractGlyphCache::State::addDirtyRange(const Range3Di& range) {
+    /* If the range overlaps or is adjacent to an existing one such that
+       joining them doesn't result in any extra area, merge them */
+    for(Range3Di& i: dirtyRanges) {
+        const Range3Di joined = Math::join(i, range);
+        if(rangeVolume(joined) <= rangeVolume(i) + rangeVolume(range)) {
+            i = joined;
+            return;
+        }
+    }
+
+    arrayAppend(dirtyRanges, range);
+
+    /* If there's too many ranges, merge the pair that results in the least
+       extra area being uploaded */
+    if(dirtyRanges.size() > MaxDirtyRanges) {
+        std::size_t bestA = 0, bestB = 1;
+        Long bestWaste{};
+        for(std::size_t a = 0; a != dirtyRanges.size(); ++a) {
+            for(std::size_t b = a + 1; b != dirtyRanges.size(); ++b) {
+                const Long waste = rangeVolume(Math::join(dirtyRanges[a], dirtyRanges[b])) - rangeVolume(dirtyRanges[a]) - rangeVolume(dirtyRanges[b]);
+                if((a == 0 && b == 1) || waste < bestWaste) {
+                    bestA = a;
+                    bestB = b;
+                    bestWaste = waste;
+                }
+            }
+        }
+
+        dirtyRanges[bestA] = Math::join(dirtyRanges[bestA], dirtyRanges[bestB]);
+        dirtyRanges[bestB] = dirtyRanges.back();
+        arrayRemoveSuffix(dirtyRanges);
+    }
+}
+
+template<class T> Containers::Optional<Range3Di> AbstractGlyphCache::State::addGlyphs(const UnsignedInt fontId, const Containers::StridedArrayView1D<const UnsignedInt>& fontGlyphIds, const Containers::StridedArrayView1D<const Vector2i>& offsets, const Containers::StridedArrayView1D<const Vector2i>& sizes, const Containers::StridedArrayView1D<T>& atlasOffsets) {
+    /* First try to put the glyphs into space freed by evicted glyphs. Working
+       on a copy of the free range list so nothing needs to be undone if the
+       rest doesn't fit into the atlas. */
+    Containers::BitArray placed{ValueInit, fontGlyphIds.size()};
+    Containers::Array<Range3Di> remainingFreeRanges;
+    Range3Di range;
+    if(!freeRanges.isEmpty()) {
+        arrayAppend(remainingFreeRanges, freeRanges);
+        for(std::size_t i = 0; i != fontGlyphIds.size(); ++i) {
+            Vector3i offset;
+            if(!placeInFreeRange(remainingFreeRanges, sizes[i], offset))
+                continue;
+            atlasOffsets[i] = atlasOffset(offset, T{});
+            range = Math::join(range, Range3Di::fromSize(offset, {sizes[i], 1}).padded({padding, 0}));
+            placed.set(i);
+        }
+    }
+
+    /* Pack the rest with the atlas packer. If nothing got placed above, pass
+       the views directly. */
+    const std::size_t placedCount = placed.count();
+    if(placedCount != fontGlyphIds.size()) {
+        Containers::Optional<Range3Di> packedRange;
+        if(!placedCount) {
+            const auto added = atlas.add(sizes, atlasOffsets);
+            if(added) packedRange = atlasRange(*added);
+        } else {
+            Containers::Array<Vector2i> remainingSizes{NoInit, fontGlyphIds.size() - placedCount};
+            Containers::Array<T> remainingAtlasOffsets{NoInit, remainingSizes.size()};
+            for(std::size_t i = 0, j = 0; i != fontGlyphIds.size(); ++i)
+                if(!placed[i]) remainingSizes[j++] = sizes[i];
+            const auto added = atlas.add(remainingSizes, remainingAtlasOffsets);
+            if(added) {
+                packedRange = atlasRange(*added);
+                for(std::size_t i = 0, j = 0; i != fontGlyphIds.size(); ++i)
+                    if(!placed[i]) atlasOffsets[i] = remainingAtlasOffsets[j++];
+            }
+        }
+        if(!packedRange)
+            return {};
+        range = Math::join(range, *packedRange);
+    }
+
+    freeRanges = Utility::move(remainingFreeRanges);
+    for(std::size_t i = 0; i != fontGlyphIds.size(); ++i)
+        addGlyph(fontId, fontGlyphIds[i], offsets[i], atlasOffsetLayer(atlasOffsets[i]), Range2Di::fromSize(atlasOffsetXY(atlasOffsets[i]), sizes[i]));
+    return range;
+}
+
 AbstractGlyphCache::AbstractGlyphCache(const PixelFormat format, const Vector3i& size, const PixelFormat processedFormat, const Vector2i& processedSize, const Vector2i& padding) {
     CORRADE_ASSERT(size.product(),
         "Text::AbstractGlyphCache: expected non-zero size, got" << Debug::packed << size, );
@@ -132,11 +463,17 @@ AbstractGlyphCache::AbstractGlyphCache(const PixelFormat format, const Vector3i&
        assert on zero size as well */
     _state.emplace(format, size, processedFormat, processedSize, padding);
 
-    /* Default invalid glyph -- empty / zero-area */
+    /* Default invalid glyph -- empty / zero-area, never evicted */
     arrayAppend(_state->glyphs, InPlaceInit);
+    arrayAppend(_state->glyphFontGlyphIds, InPlaceInit, ~UnsignedInt{}, 0u);
+    arrayAppend(_state->glyphLastUsed, 0u);
 
     /* There are no fonts yet */
-    arrayAppend(_state->fonts, InPlaceInit, 0u, nullptr);
+    arrayAppend(_state->fonts, InPlaceInit, 0u, 0u, nullptr);
+
+    /* Page 0 of the glyph mapping is the zero-filled one that all pages
+       without any glyphs added point to */
+    arrayResize(_state->fontGlyphMapping, GlyphPageSize);
 }
 
 AbstractGlyphCache::AbstractGlyphCache(const PixelFormat format, const Vector3i& size, const PixelFormat processedFormat, const Vector2i& processedSize): AbstractGlyphCache{format, size, processedFormat, processedSize, Vector2i{1}} {}
@@ -242,18 +579,21 @@ UnsignedInt AbstractGlyphCache::addFont(const UnsignedInt glyphCount, const Abst
     #endif
 
     /* The last item in the font array now becomes the new font (and its offset
-       should be the size of the fontGlyphMapping array), assign the pointer to
-       it. Add a new item after which is the end offset sentinel. */
-    CORRADE_INTERNAL_ASSERT(state.fontGlyphMapping.size() == state.fonts.back().offset);
+       should be the size of the fontGlyphPages array), assign the glyph count
+       and pointer to it. Add a new item after which is the end offset
+       sentinel. */
+    CORRADE_INTERNAL_ASSERT(state.fontGlyphPages.size() == state.fonts.back().offset);
+    const UnsignedInt pageCount = (glyphCount + GlyphPageSize - 1) >> GlyphPageBits;
+    state.fonts.back().glyphCount = glyphCount;
     state.fonts.back().pointer = pointer;
     arrayAppend(state.fonts, InPlaceInit,
-        state.fonts.back().offset + glyphCount,
+        state.fonts.back().offset + pageCount,
+        0u,
         nullptr);
 
-    /** @todo er, some arrayAppend with ValueInit + count? there's already
-        arrayResize() with the same signature */
-    for(UnsignedShort& i: arrayAppend(state.fontGlyphMapping, NoInit, glyphCount))
-        i = 0;
+    /* All pages initially point to the zero-filled page 0, they get allocated
+       only once glyphs are added to them */
+    arrayResize(state.fontGlyphPages, state.fontGlyphPages.size() + pageCount);
     return state.fonts.size() - 2;
 }
 
@@ -261,7 +601,7 @@ UnsignedInt AbstractGlyphCache::fontGlyphCount(const UnsignedInt fontId) const {
     const State& state = *_state;
     CORRADE_ASSERT(fontId < state.fonts.size() - 1,
         "Text::AbstractGlyphCache::fontGlyphCount(): index" << fontId << "out of range for" << state.fonts.size() - 1 << "fonts", {});
-    return state.fonts[fontId + 1].offset - state.fonts[fontId].offset;
+    return state.fonts[fontId].glyphCount;
 }
 
 const AbstractFont* AbstractGlyphCache::fontPointer(const UnsignedInt fontId) const {
@@ -290,7 +630,7 @@ std::vector<Range2Di> AbstractGlyphCache::reserve(const std::vector<Vector2i>& s
 
     /* Append an empty font range just to prevent reserve() from being called
        again */
-    arrayAppend(state.fonts, InPlaceInit, 0u, nullptr);
+    arrayAppend(state.fonts, InPlaceInit, 0u, 0u, nullptr);
 
     /* Disable rotations in the atlas as the old API doesn't expect them */
     const TextureTools::AtlasLandfillFlags previousFlags = state.atlas.flags();
@@ -330,11 +670,10 @@ UnsignedInt AbstractGlyphCache::addGlyph(const UnsignedInt fontId, const Unsigne
     State& state = *_state;
     CORRADE_ASSERT(fontId < state.fonts.size() - 1,
         "Text::AbstractGlyphCache::addGlyph(): index" << fontId << "out of range for" << state.fonts.size() - 1 << "fonts", {});
-    const UnsignedInt fontOffset = state.fonts[fontId].offset;
-    CORRADE_ASSERT(fontGlyphId < state.fonts[fontId + 1].offset - fontOffset,
-        "Text::AbstractGlyphCache::addGlyph(): index" << fontGlyphId << "out of range for" << state.fonts[fontId + 1].offset - fontOffset << "glyphs in font" << fontId, {});
-    CORRADE_ASSERT(!state.fontGlyphMapping[fontOffset + fontGlyphId],
-        "Text::AbstractGlyphCache::addGlyph(): glyph" << fontGlyphId << "in font" << fontId << "already added at index" << state.fontGlyphMapping[fontOffset + fontGlyphId], {});
+    CORRADE_ASSERT(fontGlyphId < state.fonts[fontId].glyphCount,
+        "Text::AbstractGlyphCache::addGlyph(): index" << fontGlyphId << "out of range for" << state.fonts[fontId].glyphCount << "glyphs in font" << fontId, {});
+    CORRADE_ASSERT(!state.glyphId(fontId, fontGlyphId),
+        "Text::AbstractGlyphCache::addGlyph(): glyph" << fontGlyphId << "in font" << fontId << "already added at index" << state.glyphId(fontId, fontGlyphId), {});
     /** @todo expand once rotations (and thus negative rectangle sizes) are
         supported */
     #ifndef CORRADE_NO_ASSERT
@@ -344,14 +683,11 @@ UnsignedInt AbstractGlyphCache::addGlyph(const UnsignedInt fontId, const Unsigne
     CORRADE_ASSERT(UnsignedInt(layer) < UnsignedInt(state.image.size().z()) && (rectangleu.min() <= rectangleu.max()).all() && (rectanglePaddedu.min() <= Vector2ui{state.image.size().xy()}).all() && (rectanglePaddedu.max() <= Vector2ui{state.image.size().xy()}).all(),
         "Text::AbstractGlyphCache::addGlyph(): layer" << layer << "and rectangle" << Debug::packed << rectangle << "out of range for size" << Debug::packed << state.image.size() << "and padding" << Debug::packed << state.padding, {});
 
-    const UnsignedInt glyphId = state.glyphs.size();
     /* The fontGlyphMapping entries are 16-bit to save memory, can't have IDs
        beyond that. See its documentation for more reasoning. */
-    CORRADE_ASSERT(glyphId < 65536,
+    CORRADE_ASSERT(!state.freeGlyphIds.isEmpty() || state.glyphs.size() < 65536,
         "Text::AbstractGlyphCache::addGlyph(): only at most 65536 glyphs can be added", {});
-    state.fontGlyphMapping[fontOffset + fontGlyphId] = glyphId;
-    arrayAppend(state.glyphs, InPlaceInit, offset - _state->padding, layer, rectangle.padded(_state->padding));
-    return glyphId;
+    return state.addGlyph(fontId, fontGlyphId, offset, layer, rectangle);
 }
 
 UnsignedInt AbstractGlyphCache::addGlyph(const UnsignedInt fontId, const UnsignedInt fontGlyphId, const Vector2i& offset, const Range2Di& rectangle) {
@@ -360,6 +696,31 @@ UnsignedInt AbstractGlyphCache::addGlyph(const UnsignedInt fontId, const Unsigne
     return addGlyph(fontId, fontGlyphId, offset, 0, rectangle);
 }
 
+Containers::Optional<Range3Di> AbstractGlyphCache::addGlyphs(const UnsignedInt fontId, const Containers::StridedArrayView1D<const UnsignedInt>& fontGlyphIds, const Containers::StridedArrayView1D<const Vector2i>& offsets, const Containers::StridedArrayView1D<const Vector2i>& sizes, const Containers::StridedArrayView1D<Vector3i>& atlasOffsets) {
+    State& state = *_state;
+    #ifndef CORRADE_NO_ASSERT
+    if(!state.checkAddGlyphs(fontId, fontGlyphIds, offsets.size(), sizes.size(), atlasOffsets.size()))
+        return {};
+    #endif
+
+    return state.addGlyphs(fontId, fontGlyphIds, offsets, sizes, atlasOffsets);
+}
+
+Containers::Optional<Range2Di> AbstractGlyphCache::addGlyphs(const UnsignedInt fontId, const Containers::StridedArrayView1D<const UnsignedInt>& fontGlyphIds, const Containers::StridedArrayView1D<const Vector2i>& offsets, const Containers::StridedArrayView1D<const Vector2i>& sizes, const Containers::StridedArrayView1D<Vector2i>& atlasOffsets) {
+    State& state = *_state;
+    CORRADE_ASSERT(state.image.size().z() == 1,
+        "Text::AbstractGlyphCache::addGlyphs(): use the 3D overload for an array glyph cache", {});
+    #ifndef CORRADE_NO_ASSERT
+    if(!state.checkAddGlyphs(fontId, fontGlyphIds, offsets.size(), sizes.size(), atlasOffsets.size()))
+        return {};
+    #endif
+
+    const Containers::Optional<Range3Di> range = state.addGlyphs(fontId, fontGlyphIds, offsets, sizes, atlasOffsets);
+    if(!range)
+        return {};
+    return range->xy();
+}
+
 #ifdef MAGNUM_BUILD_DEPRECATED
 void AbstractGlyphCache::insert(const UnsignedInt glyph, const Vector2i& offset, const Range2Di& rectangle) {
     State& state = *_state;
@@ -376,10 +737,13 @@ void AbstractGlyphCache::insert(const UnsignedInt glyph, const Vector2i& offset,
        needed. */
     } else {
         if(state.fonts.size() == 1)
-            arrayAppend(_state->fonts, InPlaceInit, 0u, nullptr);
-        if(glyph >= state.fonts[1].offset) {
-            arrayResize(state.fontGlyphMapping, glyph + 1);
-            state.fonts[1].offset = glyph + 1;
+            arrayAppend(_state->fonts, InPlaceInit, 0u, 0u, nullptr);
+        /* There's just one font, so its pages span the whole fontGlyphPages
+           array */
+        if(glyph >= state.fonts[0].glyphCount) {
+            state.fonts[0].glyphCount = glyph + 1;
+            state.fonts[1].offset = (glyph + GlyphPageSize) >> GlyphPageBits;
+            arrayResize(state.fontGlyphPages, state.fonts[1].offset);
         }
 
         addGlyph(0, glyph, offset, rectangle);
@@ -423,6 +787,15 @@ void AbstractGlyphCache::flushImage(const Range3Di& range) {
         state.image.format(),
         paddedMax - paddedMin,
         state.image.data()});
+
+    /* Discard accumulated ranges that are contained in what was just
+       uploaded */
+    for(std::size_t i = 0; i != state.dirtyRanges.size(); ) {
+        if(range.contains(state.dirtyRanges[i])) {
+            state.dirtyRanges[i] = state.dirtyRanges.back();
+            arrayRemoveSuffix(state.dirtyRanges);
+        } else ++i;
+    }
 }
 
 void AbstractGlyphCache::flushImage(Int layer, const Range2Di& range) {
@@ -436,6 +809,19 @@ void AbstractGlyphCache::flushImage(const Range2Di& range) {
     flushImage(0, range);
 }
 
+void AbstractGlyphCache::flushImage() {
+    State& state = *_state;
+    /* Each flushImage() call removes the range it uploaded, which in
+       combination with the removal being a swap with the last item means
+       always taking the first item until there's none left */
+    while(!state.dirtyRanges.isEmpty())
+        flushImage(Range3Di{state.dirtyRanges.front()});
+}
+
+Containers::ArrayView<const Range3Di> AbstractGlyphCache::dirtyImageRanges() const {
+    return _state->dirtyRanges;
+}
+
 void AbstractGlyphCache::doSetImage(const Vector3i& offset, const ImageView3D& image) {
     if(_state->image.size().z() == 1)
         /** @todo ugh have slicing on images directly already */
@@ -512,10 +898,9 @@ UnsignedInt AbstractGlyphCache::glyphId(const UnsignedInt fontId, const Unsigned
     const State& state = *_state;
     CORRADE_DEBUG_ASSERT(fontId < state.fonts.size() - 1,
         "Text::AbstractGlyphCache::glyphId(): index" << fontId << "out of range for" << state.fonts.size() - 1 << "fonts", {});
-    const UnsignedInt fontOffset = state.fonts[fontId].offset;
-    CORRADE_DEBUG_ASSERT(fontGlyphId < state.fonts[fontId + 1].offset - fontOffset,
-        "Text::AbstractGlyphCache::glyphId(): index" << fontGlyphId << "out of range for" << state.fonts[fontId + 1].offset - fontOffset << "glyphs in font" << fontId, {});
-    return state.fontGlyphMapping[fontOffset + fontGlyphId];
+    CORRADE_DEBUG_ASSERT(fontGlyphId < state.fonts[fontId].glyphCount,
+        "Text::AbstractGlyphCache::glyphId(): index" << fontGlyphId << "out of range for" << state.fonts[fontId].glyphCount << "glyphs in font" << fontId, {});
+    return state.glyphId(fontId, fontGlyphId);
 }
 
 void AbstractGlyphCache::glyphIdsInto(const UnsignedInt fontId, const Containers::StridedArrayView1D<const UnsignedInt>& fontGlyphIds, const Containers::StridedArrayView1D<UnsignedInt>& glyphIds) const {
@@ -524,16 +909,18 @@ void AbstractGlyphCache::glyphIdsInto(const UnsignedInt fontId, const Containers
     const State& state = *_state;
     CORRADE_ASSERT(fontId < state.fonts.size() - 1,
         "Text::AbstractGlyphCache::glyphIdsInto(): index" << fontId << "out of range for" << state.fonts.size() - 1 << "fonts", );
-    const UnsignedInt fontOffset = state.fonts[fontId].offset;
+    const UnsignedShort* const fontGlyphPages = state.fontGlyphPages.data() + state.fonts[fontId].offset;
+    const UnsignedShort* const fontGlyphMapping = state.fontGlyphMapping.data();
     #ifndef CORRADE_NO_DEBUG_ASSERT
-    const UnsignedInt fontGlyphCount = state.fonts[fontId + 1].offset - fontOffset;
+    const UnsignedInt fontGlyphCount = state.fonts[fontId].glyphCount;
     #endif
 
     for(std::size_t i = 0; i != fontGlyphIds.size(); ++i) {
         const UnsignedInt fontGlyphId = fontGlyphIds[i];
         CORRADE_DEBUG_ASSERT(fontGlyphId < fontGlyphCount,
             "Text::AbstractGlyphCache::glyphIdsInto(): glyph" << i << "index" << fontGlyphId << "out of range for" << fontGlyphCount << "glyphs in font" << fontId, );
-        glyphIds[i] = state.fontGlyphMapping[fontOffset + fontGlyphId];
+        const UnsignedInt page = fontGlyphPages[fontGlyphId >> GlyphPageBits];
+        glyphIds[i] = fontGlyphMapping[(page << GlyphPageBits)|(fontGlyphId & (GlyphPageSize - 1))];
     }
 }
 
@@ -553,14 +940,53 @@ Containers::StridedArrayView1D<const Range2Di> AbstractGlyphCache::glyphRectangl
     return stridedArrayView(_state->glyphs).slice(&Containers::Triple<Vector2i, Int, Range2Di>::third);
 }
 
+Containers::StridedArrayView1D<const UnsignedInt> AbstractGlyphCache::glyphLastUsed() const {
+    return _state->glyphLastUsed;
+}
+
+void AbstractGlyphCache::markGlyphsUsed(const Containers::StridedArrayView1D<const UnsignedInt>& glyphIds) {
+    State& state = *_state;
+    const UnsignedInt usage = ++state.usage;
+    for(std::size_t i = 0; i != glyphIds.size(); ++i) {
+        const UnsignedInt glyphId = glyphIds[i];
+        CORRADE_DEBUG_ASSERT(glyphId < state.glyphs.size(),
+            "Text::AbstractGlyphCache::markGlyphsUsed(): glyph" << i << "index" << glyphId << "out of range for" << state.glyphs.size() << "glyphs", );
+        state.glyphLastUsed[glyphId] = usage;
+    }
+}
+
+void AbstractGlyphCache::markGlyphsUsed(const std::initializer_list<UnsignedInt> glyphIds) {
+    markGlyphsUsed(Containers::arrayView(glyphIds));
+}
+
+UnsignedInt AbstractGlyphCache::evictGlyphs(const UnsignedInt count) {
+    State& state = *_state;
+
+    /* Gather all glyphs that are present, except for the invalid glyph, and
+       pick the least recently used ones. If two glyphs were used at the same
+       time, the one with a lower ID gets evicted first. */
+    Containers::Array<Containers::Pair<UnsignedInt, UnsignedInt>> candidates;
+    arrayReserve(candidates, state.glyphs.size() - state.freeGlyphIds.size() - 1);
+    for(UnsignedInt i = 1; i != state.glyphs.size(); ++i)
+        if(state.glyphFontGlyphIds[i].first() != ~UnsignedInt{})
+            arrayAppend(candidates, InPlaceInit, state.glyphLastUsed[i], i);
+    const std::size_t evictCount = Math::min(std::size_t(count), candidates.size());
+    std::partial_sort(candidates.begin(), candidates.begin() + evictCount, candidates.end(), [](const Containers::Pair<UnsignedInt, UnsignedInt>& a, const Containers::Pair<UnsignedInt, UnsignedInt>& b) {
+        return a.first() < b.first() || (a.first() == b.first() && a.second() < b.second());
+    });
+
+    for(std::size_t i = 0; i != evictCount; ++i)
+        state.removeGlyph(candidates[i].second());
+    return evictCount;
+}
+
 Containers::Triple<Vector2i, Int, Range2Di> AbstractGlyphCache::glyph(const UnsignedInt fontId, const UnsignedInt fontGlyphId) const {
     const State& state = *_state;
     CORRADE_DEBUG_ASSERT(fontId < state.fonts.size() - 1,
         "Text::AbstractGlyphCache::glyph(): index" << fontId << "out of range for" << state.fonts.size() - 1 << "fonts", {});
-    const UnsignedInt fontOffset = state.fonts[fontId].offset;
-    CORRADE_DEBUG_ASSERT(fontGlyphId < state.fonts[fontId + 1].offset - fontOffset,
-        "Text::AbstractGlyphCache::glyph(): index" << fontGlyphId << "out of range for" << state.fonts[fontId + 1].offset - fontOffset << "glyphs in font" << fontId, {});
-    return state.glyphs[state.fontGlyphMapping[fontOffset + fontGlyphId]];
+    CORRADE_DEBUG_ASSERT(fontGlyphId < state.fonts[fontId].glyphCount,
+        "Text::AbstractGlyphCache::glyph(): index" << fontGlyphId << "out of range for" << state.fonts[fontId].glyphCount << "glyphs in font" << fontId, {});
+    return state.glyphs[state.glyphId(fontId, fontGlyphId)];
 }
 
 Containers::Triple<Vector2i, Int, Range2Di> AbstractGlyphCache::glyph(const UnsignedInt glyphId) const {
@@ -576,7 +1002,7 @@ std::pair<Vector2i, Range2Di> AbstractGlyphCache::operator[](const UnsignedInt g
     CORRADE_ASSERT(state.image.size().z() == 1,
         "Text::AbstractGlyphCache::operator[](): can't be used on an array glyph cache", {});
     const Containers::Triple<Vector2i, Int, Range2Di> out =
-        glyphId && glyphId < state.fonts[1].offset ? glyph(0, glyphId) : glyph(0);
+        glyphId && glyphId < state.fonts[0].glyphCount ? glyph(0, glyphId) : glyph(0);
     return {out.first(), out.third()};
 }
 #endif
@@ -207,6 +207,15 @@ update its actual GPU-side texture based on what area of the image was updated.
 In case of @ref DistanceFieldGlyphCacheGL for example it also triggers distance
 field generation for given area.
 
+For large glyph sets, such as when filling the cache with thousands of glyphs
+from CJK fonts, the atlas reservation and glyph addition can be done in a
+single step with @ref addGlyphs(). It packs all glyph sizes in a single
+@ref TextureTools::AtlasLandfill::add() call, fills the offsets for copying
+the glyph data and adds all glyphs at once. The glyphs get consecutive IDs in
+the order they were passed in:
+
+@snippet Text.cpp AbstractGlyphCache-filling-bulk
+
 If the images put into the cache are meant to be used with general meshes, the
 @ref TextureTools::atlasTextureCoordinateTransformation() function can be used
 to create an appropriate texture coordinate transformation matrix. See its
@@ -241,6 +250,24 @@ a special one or you can make it alias some other font-specific invalid glyph,
 by calling @ref setInvalidGlyph() with the same arguments as @ref addGlyph()
 for a font-specific glyph ID @cpp 0 @ce.
 
+@subsection Text-AbstractGlyphCache-filling-eviction Evicting unused glyphs
+
+If the cache is filled incrementally with glyphs from arbitrary text, such as
+in a long-running application displaying user input, it'd eventually run out
+of space. To keep the memory use bounded, glyphs that weren't used for a while
+can be evicted from the cache and their space reused for new glyphs. Call
+@ref markGlyphsUsed() with IDs of glyphs in all text that's displayed, and
+when @ref addGlyphs() fails, call @ref evictGlyphs() to remove the least
+recently used glyphs and try again. The glyphs are added to areas freed by the
+evicted glyphs, and as these can be scattered across the whole atlas, calling
+@ref flushImage() without arguments uploads just the updated areas instead of
+a range spanning all of them:
+
+@snippet Text.cpp AbstractGlyphCache-filling-eviction
+
+As the cache-global IDs of evicted glyphs get reused, all text that used them
+has to be rendered again.
+
 @section Text-AbstractGlyphCache-querying Querying glyph properties and glyph data
 
 A glyph cache can be queried for ID of a particular font with @ref findFont(),
@@ -539,7 +566,9 @@ class MAGNUM_TEXT_EXPORT AbstractGlyphCache {
          * The returned count is a sum across all fonts present in the cache.
          * It's not possible to query count of added glyphs for a just single
          * font, the @ref fontGlyphCount() query returns an upper bound for a
-         * font-specific glyph ID.
+         * font-specific glyph ID. Glyphs removed with @ref evictGlyphs() are
+         * still included in the count, their IDs get reused by subsequently
+         * added glyphs.
          * @see @ref addGlyph(), @ref fontCount()
          */
         UnsignedInt glyphCount() const;
@@ -617,6 +646,11 @@ class MAGNUM_TEXT_EXPORT AbstractGlyphCache {
          * @ref addGlyph() and @ref glyph(). The @p pointer is expected to be
          * either @cpp nullptr @ce or unique across all added fonts but apart
          * from that isn't accessed in any way.
+         *
+         * The per-font glyph ID mapping is allocated lazily in blocks of 64
+         * glyphs as glyphs get added, so adding a font with a large
+         * @p glyphCount of which only a small subset gets actually used
+         * doesn't allocate a mapping entry for each of its glyphs.
          */
         UnsignedInt addFont(UnsignedInt glyphCount, const AbstractFont* pointer = nullptr);
 
@@ -693,9 +727,14 @@ class MAGNUM_TEXT_EXPORT AbstractGlyphCache {
          *
          * The returned glyph ID can be passed directly to @ref glyph() to
          * retrieve its properties, the same ID can be also queried by passing
-         * the @p fontId and @p fontGlyphId to @ref glyphId(). Due to how the
-         * internal glyph ID mapping is implemented, there can be at most 65536
-         * glyphs added including the implicit invalid one.
+         * the @p fontId and @p fontGlyphId to @ref glyphId(). If there are
+         * glyphs removed by @ref evictGlyphs(), the ID of the most recently
+         * evicted one is reused, otherwise the ID is @ref glyphCount(). Due
+         * to how the internal glyph ID mapping is implemented, there can be
+         * at most 65536 glyphs added including the implicit invalid one.
+         *
+         * The @p rectangle is remembered for a subsequent @ref flushImage()
+         * call without arguments.
          */
         UnsignedInt addGlyph(UnsignedInt fontId, UnsignedInt fontGlyphId, const Vector2i& offset, Int layer, const Range2Di& rectangle);
 
@@ -708,6 +747,55 @@ class MAGNUM_TEXT_EXPORT AbstractGlyphCache {
          */
         UnsignedInt addGlyph(UnsignedInt fontId, UnsignedInt fontGlyphId, const Vector2i& offset, const Range2Di& rectangle);
 
+        /**
+         * @brief Pack and add a set of glyphs
+         * @param[in]  fontId       Font ID returned by @ref addFont()
+         * @param[in]  fontGlyphIds Glyph IDs in given font
+         * @param[in]  offsets      Offsets of the rendered glyphs relative to
+         *      a point on the baseline
+         * @param[in]  sizes        Glyph sizes without padding applied
+         * @param[out] atlasOffsets Where to put offsets of the glyphs in the
+         *      atlas
+         * @return Range spanning all added glyphs including padding or
+         *      @relativeref{Corrade,Containers::NullOpt} if they didn't fit
+         * @m_since_latest
+         *
+         * Packs all @p sizes in a single @ref TextureTools::AtlasLandfill::add()
+         * call on @ref atlas() and then adds all glyphs at once, which is
+         * considerably more efficient than calling @ref addGlyph() for each
+         * glyph separately. The @p fontGlyphIds, @p offsets, @p sizes and
+         * @p atlasOffsets views are expected to have the same size, the
+         * @p fontId is expected to be less than @ref fontCount() and
+         * @p fontGlyphIds unique, less than the glyph count passed in the
+         * @ref addFont() call and not added yet. The atlas is expected to have
+         * rotations disabled, which is the default.
+         *
+         * If there are no glyphs removed by @ref evictGlyphs(), the glyphs
+         * get consecutive cache-global IDs, starting at @ref glyphCount()
+         * queried before the call, in the order they're listed in
+         * @p fontGlyphIds. Otherwise the glyphs first reuse IDs of the evicted
+         * glyphs and, if they fit, also their space in the atlas, with only
+         * the remaining glyphs being packed by the atlas packer. Copy the
+         * corresponding glyph data to @p atlasOffsets in @ref image() and then
+         * call @ref flushImage() either with the returned range or without
+         * arguments to upload only the areas that actually changed. If the
+         * glyphs don't fit, no glyphs are added and the atlas packer is left
+         * in an undefined state, same as in case of
+         * @ref TextureTools::AtlasLandfill::add(). The same limit of at most
+         * 65536 glyphs in total as with @ref addGlyph() applies.
+         */
+        Containers::Optional<Range3Di> addGlyphs(UnsignedInt fontId, const Containers::StridedArrayView1D<const UnsignedInt>& fontGlyphIds, const Containers::StridedArrayView1D<const Vector2i>& offsets, const Containers::StridedArrayView1D<const Vector2i>& sizes, const Containers::StridedArrayView1D<Vector3i>& atlasOffsets);
+
+        /**
+         * @brief Pack and add a set of glyphs to a 2D glyph cache
+         * @m_since_latest
+         *
+         * Like @ref addGlyphs(UnsignedInt, const Containers::StridedArrayView1D<const UnsignedInt>&, const Containers::StridedArrayView1D<const Vector2i>&, const Containers::StridedArrayView1D<const Vector2i>&, const Containers::StridedArrayView1D<Vector3i>&)
+         * but omitting the third dimension. Can be called only if @ref size()
+         * depth is @cpp 1 @ce.
+         */
+        Containers::Optional<Range2Di> addGlyphs(UnsignedInt fontId, const Containers::StridedArrayView1D<const UnsignedInt>& fontGlyphIds, const Containers::StridedArrayView1D<const Vector2i>& offsets, const Containers::StridedArrayView1D<const Vector2i>& sizes, const Containers::StridedArrayView1D<Vector2i>& atlasOffsets);
+
         #ifdef MAGNUM_BUILD_DEPRECATED
         /**
          * @brief Add a glyph
@@ -762,7 +850,9 @@ class MAGNUM_TEXT_EXPORT AbstractGlyphCache {
          * The function assumes the @p range excludes @ref padding(). The image
          * data get copied to the GPU including the padding to make sure the
          * padded glyph area doesn't contain leftovers of uninitialized GPU
-         * memory.
+         * memory. Ranges in @ref dirtyImageRanges() that are fully contained
+         * in @p range are discarded.
+         * @see @ref flushImage()
          */
         void flushImage(const Range3Di& range);
 
@@ -782,6 +872,37 @@ class MAGNUM_TEXT_EXPORT AbstractGlyphCache {
          */
         void flushImage(const Range2Di& range);
 
+        /**
+         * @brief Flush all glyph cache image updates
+         * @m_since_latest
+         *
+         * Calls @ref flushImage(const Range3Di&) for each range in
+         * @ref dirtyImageRanges(), which is then empty afterwards. Compared to
+         * flushing a range spanning all glyphs that were added, this uploads
+         * only the areas that actually changed, which is useful especially
+         * when glyphs get added to space freed by @ref evictGlyphs() in
+         * various places of the atlas.
+         */
+        void flushImage();
+
+        /**
+         * @brief Image ranges updated since the last flush
+         * @m_since_latest
+         *
+         * Rectangles of glyphs passed to @ref addGlyph() or added by
+         * @ref addGlyphs(), excluding @ref padding(), with the layer in the
+         * third dimension. Ranges that overlap or are adjacent such that
+         * joining them doesn't enlarge the total area are merged. To keep
+         * the per-frame bookkeeping bounded, at most 16 ranges are maintained,
+         * beyond that the two ranges which can be joined with the least area
+         * being uploaded redundantly are merged. Ranges get removed by
+         * @ref flushImage() calls.
+         *
+         * The returned view is only guaranteed to be valid until the next
+         * @ref addGlyph(), @ref addGlyphs() or @ref flushImage() call.
+         */
+        Containers::ArrayView<const Range3Di> dirtyImageRanges() const;
+
         #ifdef MAGNUM_BUILD_DEPRECATED
         /**
          * @brief Set cache image
@@ -939,6 +1060,79 @@ class MAGNUM_TEXT_EXPORT AbstractGlyphCache {
          */
         Containers::StridedArrayView1D<const Range2Di> glyphRectangles() const;
 
+        /**
+         * @brief When were glyphs in the cache last used
+         * @m_since_latest
+         *
+         * Size of the returned view is the same as @ref glyphCount(). Each
+         * item contains the value of an internal counter that gets
+         * incremented on every @ref markGlyphsUsed() call at the time given
+         * glyph was last passed to it, or the counter value at the time the
+         * glyph was added if it wasn't passed to it yet. The items are thus
+         * only meaningful relative to each other, with a lower value meaning
+         * the glyph was used less recently. Items for glyphs removed by
+         * @ref evictGlyphs() are unspecified.
+         *
+         * The returned view is only guaranteed to be valid until the next
+         * @ref addGlyph() call.
+         */
+        Containers::StridedArrayView1D<const UnsignedInt> glyphLastUsed() const;
+
+        /**
+         * @brief Mark glyphs as used
+         * @param glyphIds      Cache-global glyph IDs
+         * @m_since_latest
+         *
+         * Increments an internal counter and records its value for all
+         * @p glyphIds in @ref glyphLastUsed(), making them the most recently
+         * used glyphs for @ref evictGlyphs(). Usually you'd call this
+         * function with glyph IDs of all text visible in a frame, such as
+         * with @ref RendererCore::glyphIds(). Expects that all @p glyphIds
+         * are less than @ref glyphCount(). The lookup is done with an
+         * @f$ \mathcal{O}(1) @f$ complexity for each glyph.
+         */
+        void markGlyphsUsed(const Containers::StridedArrayView1D<const UnsignedInt>& glyphIds);
+
+        /**
+         * @overload
+         * @m_since_latest
+         */
+        void markGlyphsUsed(std::initializer_list<UnsignedInt> glyphIds);
+
+        /**
+         * @brief Evict least recently used glyphs
+         * @param count         Count of glyphs to evict
+         * @return Count of glyphs that were actually evicted
+         * @m_since_latest
+         *
+         * Removes at most @p count glyphs with the lowest values in
+         * @ref glyphLastUsed(), except for the cache-global invalid glyph.
+         * If two glyphs were last used at the same time, the one with a
+         * lower ID gets evicted first. If there's less glyphs than @p count,
+         * all glyphs are evicted.
+         *
+         * Evicted glyphs get their font-specific mapping reset, so
+         * @ref glyphId() for them returns @cpp 0 @ce again and they can be
+         * added again later. Their @ref glyphRectangles() become zero-area
+         * and their area in @ref image() including @ref padding() gets
+         * cleared to zeros. The area isn't returned to the @ref atlas()
+         * packer, as @ref TextureTools::AtlasLandfill can only fill space
+         * incrementally, but is remembered and reused by subsequent
+         * @ref addGlyphs() calls for glyphs that fit into it. Areas of
+         * neighboring evicted glyphs get merged back together where possible,
+         * nevertheless the free space may fragment over time, which is why
+         * it's advised to evict glyphs in larger batches. IDs of evicted
+         * glyphs get reused by subsequent @ref addGlyph() and
+         * @ref addGlyphs() calls.
+         *
+         * It's the caller responsibility to not use the IDs of evicted glyphs
+         * afterwards, i.e. any text that used them needs to be rendered
+         * again. Calling this function while the glyphs are still referenced
+         * by rendered text would make the text show either the invalid glyph
+         * or, once the ID gets reused, a different glyph.
+         */
+        UnsignedInt evictGlyphs(UnsignedInt count);
+
         /**
          * @brief Properties of given glyph ID in given font
          * @param fontId        Font ID returned by @ref addFont()
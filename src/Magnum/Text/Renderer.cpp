@@ -26,12 +26,14 @@
 
 #include "Renderer.h"
 
+#include <Corrade/Containers/BitArrayView.h>
 #include <Corrade/Containers/EnumSet.hpp>
 #include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Containers/StringView.h>
 
+#include "Magnum/Implementation/parallel.h"
 #include "Magnum/Math/Functions.h"
 #include "Magnum/Math/FunctionsBatch.h"
 #include "Magnum/Math/Range.h"
@@ -1577,6 +1579,142 @@ Range2D alignRenderedBlock(const Range2D& blockRectangle, const LayoutDirection
 
 namespace {
 
+void renderLinesInto(const Containers::ArrayView<AbstractShaper* const> shapers, const Float size, const AbstractGlyphCache& cache, const LayoutDirection direction, const Alignment alignment, const Containers::StridedArrayView1D<const Containers::StringView>& texts, const Containers::StridedArrayView1D<const Vector2>& origins, const Containers::StridedArrayView1D<const Range1Dui>& glyphRanges, const Containers::BitArrayView textsToUpdate, const Containers::StridedArrayView1D<Vector2>& vertexPositions, const Containers::StridedArrayView1D<Vector2>& vertexTextureCoordinates, const Containers::StridedArrayView1D<Float>& vertexTextureLayers, const Containers::StridedArrayView1D<UnsignedInt>& glyphCounts, const Containers::StridedArrayView1D<Range2D>& rectangles) {
+    CORRADE_ASSERT(!shapers.isEmpty(),
+        "Text::renderLinesInto(): expected at least one shaper", );
+    #ifndef CORRADE_NO_ASSERT
+    for(std::size_t i = 0; i != shapers.size(); ++i) {
+        CORRADE_ASSERT(shapers[i],
+            "Text::renderLinesInto(): shaper" << i << "is null", );
+        CORRADE_ASSERT(&shapers[i]->font() == &shapers[0]->font(),
+            "Text::renderLinesInto(): shaper" << i << "is from a different font than shaper 0", );
+    }
+    #endif
+    const AbstractFont& font = shapers[0]->font();
+    CORRADE_ASSERT(font.isOpened(),
+        "Text::renderLinesInto(): no font opened", );
+    CORRADE_ASSERT(direction == LayoutDirection::HorizontalTopToBottom,
+        "Text::renderLinesInto(): only" << LayoutDirection::HorizontalTopToBottom << "is supported right now, got" << direction, );
+    CORRADE_ASSERT(origins.size() == texts.size() &&
+                   glyphRanges.size() == texts.size() &&
+                   textsToUpdate.size() == texts.size() &&
+                   glyphCounts.size() == texts.size() &&
+                   rectangles.size() == texts.size(),
+        "Text::renderLinesInto(): expected texts, origins, glyphRanges, textsToUpdate, glyphCounts and rectangles views to have the same size, got" << texts.size() << Debug::nospace << "," << origins.size() << Debug::nospace << "," << glyphRanges.size() << Debug::nospace << "," << textsToUpdate.size() << Debug::nospace << "," << glyphCounts.size() << "and" << rectangles.size(), );
+    CORRADE_ASSERT(vertexTextureCoordinates.size() == vertexPositions.size(),
+        "Text::renderLinesInto(): expected vertexPositions and vertexTextureCoordinates views to have the same size, got" << vertexPositions.size() << "and" << vertexTextureCoordinates.size(), );
+    /* Should be ensured by the callers below */
+    CORRADE_INTERNAL_ASSERT(!vertexTextureLayers || vertexTextureLayers.size() == vertexTextureCoordinates.size());
+
+    /* Query ID of the font in the cache for performing glyph ID mapping */
+    const Containers::Optional<UnsignedInt> glyphCacheFontId = cache.findFont(font);
+    CORRADE_ASSERT(glyphCacheFontId,
+        "Text::renderLinesInto(): shaper font not found among" << cache.fontCount() << "fonts in passed glyph cache", );
+
+    /* Gather the texts to update, so the threads get balanced work even if
+       the updated texts are all clustered together. Check the glyph ranges
+       upfront as well to not have to assert in the worker threads. */
+    Containers::Array<UnsignedInt> textIds;
+    arrayReserve(textIds, textsToUpdate.count());
+    for(std::size_t i = 0; i != texts.size(); ++i) {
+        if(!textsToUpdate[i]) continue;
+        CORRADE_ASSERT(glyphRanges[i].min() <= glyphRanges[i].max() && glyphRanges[i].max()*4 <= vertexPositions.size(),
+            "Text::renderLinesInto(): glyph range" << Debug::packed << glyphRanges[i] << "for text" << i << "out of range for" << vertexPositions.size()/4 << "glyphs", );
+        arrayAppend(textIds, UnsignedInt(i));
+    }
+
+    /* Per-thread scratch memory for shaped glyph data, glyph positions are
+       aliasing the offsets like in RendererCore::add() */
+    struct Scratch {
+        Containers::Array<Vector2> glyphOffsetsPositions;
+        Containers::Array<Vector2> glyphAdvances;
+        Containers::Array<UnsignedInt> glyphIds;
+    };
+    Containers::Array<Scratch> scratch{Magnum::Implementation::parallelThreadCount(UnsignedInt(shapers.size()), textIds.size())};
+
+    const Float scale = size/font.size();
+    const UnsignedInt fontId = *glyphCacheFontId;
+    Magnum::Implementation::parallelFor(textIds.size(), UnsignedInt(shapers.size()), [&](const std::size_t begin, const std::size_t end, const UnsignedInt thread) {
+        AbstractShaper& shaper = *shapers[thread];
+        Scratch& threadScratch = scratch[thread];
+
+        for(std::size_t i = begin; i != end; ++i) {
+            const UnsignedInt textId = textIds[i];
+            const Containers::StringView text = texts[textId];
+            const Range1Dui glyphRange = glyphRanges[textId];
+
+            /* If the text doesn't fit into its range, report the count and
+               leave everything else untouched */
+            const UnsignedInt glyphCount = text ? shaper.shape(text) : 0;
+            glyphCounts[textId] = glyphCount;
+            if(glyphCount > glyphRange.size())
+                continue;
+
+            if(threadScratch.glyphIds.size() < glyphCount) {
+                arrayResize(threadScratch.glyphOffsetsPositions, NoInit, glyphCount);
+                arrayResize(threadScratch.glyphAdvances, NoInit, glyphCount);
+                arrayResize(threadScratch.glyphIds, NoInit, glyphCount);
+            }
+            const Containers::StridedArrayView1D<Vector2> glyphOffsetsPositions = threadScratch.glyphOffsetsPositions.prefix(glyphCount);
+            const Containers::StridedArrayView1D<Vector2> glyphAdvances = threadScratch.glyphAdvances.prefix(glyphCount);
+            const Containers::StridedArrayView1D<UnsignedInt> glyphIds = threadScratch.glyphIds.prefix(glyphCount);
+
+            /* Same as in RendererCore::add(), a line without any glyphs
+               doesn't contribute to the rectangle */
+            Range2D rectangle;
+            if(glyphCount) {
+                shaper.glyphOffsetsAdvancesInto(glyphOffsetsPositions, glyphAdvances);
+                Vector2 cursor;
+                rectangle = renderLineGlyphPositionsInto(font, size, direction, glyphOffsetsPositions, glyphAdvances, cursor, glyphOffsetsPositions);
+                shaper.glyphIdsInto(glyphIds);
+                cache.glyphIdsInto(fontId, glyphIds, glyphIds);
+                if(UnsignedByte(alignment) & Implementation::AlignmentGlyphBounds)
+                    rectangle = glyphQuadBounds(cache, scale, glyphOffsetsPositions, glyphIds);
+            }
+
+            /* Align the line and then the single-line block, the same as
+               RendererCore::render() does, and move it to the origin */
+            const Alignment resolvedAlignment = alignmentForDirection(alignment, direction, text ? shaper.direction() : ShapeDirection::Unspecified);
+            rectangle = alignRenderedLine(rectangle, direction, resolvedAlignment, glyphOffsetsPositions);
+            rectangle = alignRenderedBlock(rectangle, direction, resolvedAlignment, glyphOffsetsPositions);
+            const Vector2 origin = origins[textId];
+            for(Vector2& position: glyphOffsetsPositions)
+                position += origin;
+            rectangles[textId] = rectangle.translated(origin);
+
+            /* Render the quads to the beginning of the range, make the rest
+               degenerate */
+            const std::size_t vertexBegin = std::size_t(glyphRange.min())*4;
+            const std::size_t vertexEnd = std::size_t(glyphRange.max())*4;
+            const std::size_t vertexGlyphEnd = vertexBegin + std::size_t(glyphCount)*4;
+            renderGlyphQuadsInto(cache, scale, glyphOffsetsPositions, glyphIds,
+                vertexPositions.slice(vertexBegin, vertexGlyphEnd),
+                vertexTextureCoordinates.slice(vertexBegin, vertexGlyphEnd),
+                vertexTextureLayers ? vertexTextureLayers.slice(vertexBegin, vertexGlyphEnd) : nullptr);
+            for(std::size_t j = vertexGlyphEnd; j != vertexEnd; ++j) {
+                vertexPositions[j] = {};
+                vertexTextureCoordinates[j] = {};
+            }
+            if(vertexTextureLayers) for(std::size_t j = vertexGlyphEnd; j != vertexEnd; ++j)
+                vertexTextureLayers[j] = 0.0f;
+        }
+    });
+}
+
+}
+
+void renderLinesInto(const Containers::ArrayView<AbstractShaper* const> shapers, const Float size, const AbstractGlyphCache& cache, const LayoutDirection direction, const Alignment alignment, const Containers::StridedArrayView1D<const Containers::StringView>& texts, const Containers::StridedArrayView1D<const Vector2>& origins, const Containers::StridedArrayView1D<const Range1Dui>& glyphRanges, const Containers::BitArrayView textsToUpdate, const Containers::StridedArrayView1D<Vector2>& vertexPositions, const Containers::StridedArrayView1D<Vector3>& vertexTextureCoordinates, const Containers::StridedArrayView1D<UnsignedInt>& glyphCounts, const Containers::StridedArrayView1D<Range2D>& rectangles) {
+    renderLinesInto(shapers, size, cache, direction, alignment, texts, origins, glyphRanges, textsToUpdate, vertexPositions, vertexTextureCoordinates.slice(&Vector3::xy), vertexTextureCoordinates.slice(&Vector3::z), glyphCounts, rectangles);
+}
+
+void renderLinesInto(const Containers::ArrayView<AbstractShaper* const> shapers, const Float size, const AbstractGlyphCache& cache, const LayoutDirection direction, const Alignment alignment, const Containers::StridedArrayView1D<const Containers::StringView>& texts, const Containers::StridedArrayView1D<const Vector2>& origins, const Containers::StridedArrayView1D<const Range1Dui>& glyphRanges, const Containers::BitArrayView textsToUpdate, const Containers::StridedArrayView1D<Vector2>& vertexPositions, const Containers::StridedArrayView1D<Vector2>& vertexTextureCoordinates, const Containers::StridedArrayView1D<UnsignedInt>& glyphCounts, const Containers::StridedArrayView1D<Range2D>& rectangles) {
+    CORRADE_ASSERT(cache.size().z() == 1,
+        "Text::renderLinesInto(): can't use this overload with an array glyph cache", );
+    renderLinesInto(shapers, size, cache, direction, alignment, texts, origins, glyphRanges, textsToUpdate, vertexPositions, vertexTextureCoordinates, nullptr, glyphCounts, rectangles);
+}
+
+namespace {
+
 template<class T> void renderGlyphQuadIndicesIntoInternal(const UnsignedInt glyphOffset, const Containers::StridedArrayView1D<T>& indices) {
     CORRADE_ASSERT(indices.size() % 6 == 0,
         "Text::renderGlyphQuadIndicesInto(): expected the indices view size to be divisible by 6, got" << indices.size(), );
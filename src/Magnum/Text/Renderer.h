@@ -27,7 +27,7 @@
 */
 
 /** @file
- * @brief Class @ref Magnum::Text::RendererCore, @ref Magnum::Text::Renderer, @ref Magnum::Text::AbstractRenderer, typedef @ref Magnum::Text::Renderer2D, @ref Magnum::Text::Renderer3D, function @ref Magnum::Text::renderLineGlyphPositionsInto(), @ref Magnum::Text::renderGlyphQuadsInto(), @ref Magnum::Text::glyphQuadBounds(), @ref Magnum::Text::alignRenderedLine(), @ref Magnum::Text::alignRenderedBlock(), @ref Magnum::Text::renderGlyphQuadIndicesInto(), @ref Magnum::Text::glyphRangeForBytes()
+ * @brief Class @ref Magnum::Text::RendererCore, @ref Magnum::Text::Renderer, @ref Magnum::Text::AbstractRenderer, typedef @ref Magnum::Text::Renderer2D, @ref Magnum::Text::Renderer3D, function @ref Magnum::Text::renderLineGlyphPositionsInto(), @ref Magnum::Text::renderGlyphQuadsInto(), @ref Magnum::Text::glyphQuadBounds(), @ref Magnum::Text::alignRenderedLine(), @ref Magnum::Text::alignRenderedBlock(), @ref Magnum::Text::renderLinesInto(), @ref Magnum::Text::renderGlyphQuadIndicesInto(), @ref Magnum::Text::glyphRangeForBytes()
  */
 
 #include <initializer_list>
@@ -123,6 +123,16 @@ needing textured quads at all.
 
 @snippet Text.cpp RendererCore-usage-quads
 
+@section Text-RendererCore-batch Rendering many independent lines at once
+
+The renderer processes the added text serially. If there's many independent
+single-line texts such as labels, each placed at a different position, and
+only some of them change at a time, the @ref renderLinesInto() function can be
+used instead. It shapes the texts on multiple threads, using a dedicated
+@ref AbstractShaper instance for each thread, and writes the glyph quads
+directly to preallocated ranges of a shared vertex buffer, updating only the
+texts that changed.
+
 @section Text-RendererCore-clusters Mapping between input text and shaped glyphs
 
 For implementing text selection or editing, if
@@ -1659,6 +1669,73 @@ the part of @p alignment matching layout advance in @p direction. Values of the
 */
 MAGNUM_TEXT_EXPORT Range2D alignRenderedBlock(const Range2D& blockRectangle, LayoutDirection direction, Alignment alignment, const Containers::StridedArrayView1D<Vector2>& positions);
 
+/**
+@brief Shape and render glyph quads for many independent single-line texts
+@param[in] shapers          Shapers to use, one for each thread
+@param[in] size             Size to render the glyphs at
+@param[in] cache            Glyph cache to query for glyph rectangles
+@param[in] direction        Layout direction. Currently expected to always be
+    @ref LayoutDirection::HorizontalTopToBottom.
+@param[in] alignment        Alignment of each text relative to its origin
+@param[in] texts            Texts to render
+@param[in] origins          Origin of each text
+@param[in] glyphRanges      Range of glyphs reserved for each text in the
+    output vertex data
+@param[in] textsToUpdate    Which texts to shape and render
+@param[out] vertexPositions Where to put output vertex positions
+@param[out] vertexTextureCoordinates Where to put output texture coordinates
+@param[out] glyphCounts     Where to put the count of glyphs in each text
+@param[out] rectangles      Where to put the rectangle spanning each text
+@m_since_latest
+
+Equivalent to calling @ref RendererCore::render() followed by
+@ref renderGlyphQuadsInto() for each text that has a corresponding bit set in
+@p textsToUpdate, with @ref RendererCore::setCursor() set to given item of
+@p origins and @ref RendererCore::setAlignment() set to @p alignment. Texts
+with the bit not set aren't processed in any way and their output isn't
+touched, so the cost of updating a large set of texts is proportional only to
+the count of texts that changed.
+
+The @p texts, @p origins, @p glyphRanges, @p glyphCounts, @p rectangles and
+@p textsToUpdate views are expected to have the same size, the
+@p vertexPositions and @p vertexTextureCoordinates views the same size as
+well. Each item of @p glyphRanges specifies a range of glyphs the text is
+allowed to occupy, with vertices for glyph @f$ i @f$ being at
+@f$ [4i, 4i + 4) @f$ in @p vertexPositions and @p vertexTextureCoordinates
+same as with @ref renderGlyphQuadsInto(). The ranges are expected to be in
+bounds for the vertex views and shouldn't overlap. If the text produces less
+glyphs than the range size, vertices for the remaining glyphs are set to zero,
+making them degenerate quads, so the whole vertex buffer can be drawn at once
+with indices from @ref renderGlyphQuadIndicesInto(). If the text produces
+more glyphs than the range size, only the corresponding @p glyphCounts item is
+updated and the rest is left untouched, the caller can then detect this case by
+comparing the count with the range size, enlarge the range and call this
+function again with just the affected texts.
+
+The texts are treated as single lines, i.e. no special handling of
+@cpp '\n' @ce is done. The work is split across as many threads as there are
+@p shapers, with each thread using only its own shaper. The shapers are
+expected to be non-null, coming from the same font, which is expected to be
+contained in @p cache, and are used with whatever script, language and
+direction was set on them before. The font plugin is expected to support
+shaping with multiple shapers concurrently, if it doesn't, pass just a single
+shaper. Glyph IDs not found in the cache are replaced with the cache-global
+invalid glyph.
+@see @ref renderLineGlyphPositionsInto(), @ref alignRenderedLine(),
+    @ref alignRenderedBlock()
+*/
+MAGNUM_TEXT_EXPORT void renderLinesInto(Containers::ArrayView<AbstractShaper* const> shapers, Float size, const AbstractGlyphCache& cache, LayoutDirection direction, Alignment alignment, const Containers::StridedArrayView1D<const Containers::StringView>& texts, const Containers::StridedArrayView1D<const Vector2>& origins, const Containers::StridedArrayView1D<const Range1Dui>& glyphRanges, Containers::BitArrayView textsToUpdate, const Containers::StridedArrayView1D<Vector2>& vertexPositions, const Containers::StridedArrayView1D<Vector3>& vertexTextureCoordinates, const Containers::StridedArrayView1D<UnsignedInt>& glyphCounts, const Containers::StridedArrayView1D<Range2D>& rectangles);
+
+/**
+@brief Shape and render glyph quads for many independent single-line texts with a 2D glyph cache
+@m_since_latest
+
+Same as @ref renderLinesInto(Containers::ArrayView<AbstractShaper* const>, Float, const AbstractGlyphCache&, LayoutDirection, Alignment, const Containers::StridedArrayView1D<const Containers::StringView>&, const Containers::StridedArrayView1D<const Vector2>&, const Containers::StridedArrayView1D<const Range1Dui>&, Containers::BitArrayView, const Containers::StridedArrayView1D<Vector2>&, const Containers::StridedArrayView1D<Vector3>&, const Containers::StridedArrayView1D<UnsignedInt>&, const Containers::StridedArrayView1D<Range2D>&),
+but outputs just 2D texture coordinates. Can be used only if
+@ref AbstractGlyphCache::size() depth is @cpp 1 @ce.
+*/
+MAGNUM_TEXT_EXPORT void renderLinesInto(Containers::ArrayView<AbstractShaper* const> shapers, Float size, const AbstractGlyphCache& cache, LayoutDirection direction, Alignment alignment, const Containers::StridedArrayView1D<const Containers::StringView>& texts, const Containers::StridedArrayView1D<const Vector2>& origins, const Containers::StridedArrayView1D<const Range1Dui>& glyphRanges, Containers::BitArrayView textsToUpdate, const Containers::StridedArrayView1D<Vector2>& vertexPositions, const Containers::StridedArrayView1D<Vector2>& vertexTextureCoordinates, const Containers::StridedArrayView1D<UnsignedInt>& glyphCounts, const Containers::StridedArrayView1D<Range2D>& rectangles);
+
 /**
 @brief Render 32-bit glyph quad indices
 @param[in]  glyphOffset     Offset of the first glyph to generate indices for
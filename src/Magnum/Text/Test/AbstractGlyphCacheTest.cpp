@@ -24,6 +24,8 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Containers/String.h>
@@ -106,6 +108,21 @@ struct AbstractGlyphCacheTest: TestSuite::Tester {
     void addGlyphOutOfRangePadded();
     void addGlyphTooMany();
     void addGlyph2DNot2D();
+    void addGlyphSparse();
+
+    void addGlyphs();
+    void addGlyphs2D();
+    void addGlyphsIncremental();
+    void addGlyphsDoesNotFit();
+    void addGlyphsInvalid();
+    void addGlyphsTooMany();
+    void addGlyphs2DNot2D();
+
+    void markGlyphsUsed();
+    void markGlyphsUsedOutOfRange();
+    void evictGlyphs();
+    void evictGlyphsReuseSpace();
+    void evictGlyphsReuseSpaceDoesNotFit();
 
     #ifdef MAGNUM_BUILD_DEPRECATED
     void insert();
@@ -122,6 +139,8 @@ struct AbstractGlyphCacheTest: TestSuite::Tester {
     void flushImagePassthrough2DNotImplemented();
     void flushImageOutOfRange();
     void flushImage2DNot2D();
+    void flushImageDirty();
+    void flushImageDirtyTooManyRanges();
 
     #ifdef MAGNUM_BUILD_DEPRECATED
     void setImage();
@@ -234,6 +253,21 @@ AbstractGlyphCacheTest::AbstractGlyphCacheTest() {
               &AbstractGlyphCacheTest::addGlyphOutOfRangePadded,
               &AbstractGlyphCacheTest::addGlyphTooMany,
               &AbstractGlyphCacheTest::addGlyph2DNot2D,
+              &AbstractGlyphCacheTest::addGlyphSparse,
+
+              &AbstractGlyphCacheTest::addGlyphs,
+              &AbstractGlyphCacheTest::addGlyphs2D,
+              &AbstractGlyphCacheTest::addGlyphsIncremental,
+              &AbstractGlyphCacheTest::addGlyphsDoesNotFit,
+              &AbstractGlyphCacheTest::addGlyphsInvalid,
+              &AbstractGlyphCacheTest::addGlyphsTooMany,
+              &AbstractGlyphCacheTest::addGlyphs2DNot2D,
+
+              &AbstractGlyphCacheTest::markGlyphsUsed,
+              &AbstractGlyphCacheTest::markGlyphsUsedOutOfRange,
+              &AbstractGlyphCacheTest::evictGlyphs,
+              &AbstractGlyphCacheTest::evictGlyphsReuseSpace,
+              &AbstractGlyphCacheTest::evictGlyphsReuseSpaceDoesNotFit,
 
               #ifdef MAGNUM_BUILD_DEPRECATED
               &AbstractGlyphCacheTest::insert,
@@ -255,7 +289,9 @@ AbstractGlyphCacheTest::AbstractGlyphCacheTest() {
     addInstancedTests({&AbstractGlyphCacheTest::flushImageOutOfRange},
         Containers::arraySize(FlushImageData));
 
-    addTests({&AbstractGlyphCacheTest::flushImage2DNot2D});
+    addTests({&AbstractGlyphCacheTest::flushImage2DNot2D,
+              &AbstractGlyphCacheTest::flushImageDirty,
+              &AbstractGlyphCacheTest::flushImageDirtyTooManyRanges});
 
     #ifdef MAGNUM_BUILD_DEPRECATED
     addInstancedTests({&AbstractGlyphCacheTest::setImage},
@@ -1080,6 +1116,399 @@ void AbstractGlyphCacheTest::addGlyph2DNot2D() {
     CORRADE_COMPARE(out, "Text::AbstractGlyphCache::addGlyph(): use the layer overload for an array glyph cache\n");
 }
 
+void AbstractGlyphCacheTest::addGlyphSparse() {
+    /* Padding tested well enough in addGlyph(), resetting it back to 0 here */
+    DummyGlyphCache cache{PixelFormat::R32F, {1024, 512}, {}};
+
+    /* Glyphs scattered over a large font, with neighbors on both sides of
+       internal mapping page boundaries, and a small font after to verify the
+       fonts don't interfere with each other */
+    UnsignedInt fontLarge = cache.addFont(100000);
+    UnsignedInt fontSmall = cache.addFont(5);
+    CORRADE_COMPARE(cache.fontGlyphCount(fontLarge), 100000);
+    CORRADE_COMPARE(cache.fontGlyphCount(fontSmall), 5);
+
+    CORRADE_COMPARE(cache.addGlyph(fontLarge, 99999, {}, {{10, 20}, {30, 40}}), 1);
+    CORRADE_COMPARE(cache.addGlyph(fontSmall, 4, {}, {{1, 2}, {3, 4}}), 2);
+    CORRADE_COMPARE(cache.addGlyph(fontLarge, 64, {}, {{5, 6}, {7, 8}}), 3);
+    CORRADE_COMPARE(cache.addGlyph(fontLarge, 63, {}, {{9, 10}, {11, 12}}), 4);
+    CORRADE_COMPARE(cache.addGlyph(fontLarge, 0, {}, {{13, 14}, {15, 16}}), 5);
+    CORRADE_COMPARE(cache.glyphCount(), 6);
+
+    UnsignedInt glyphIds[]{~0u, ~0u, ~0u, ~0u, ~0u, ~0u, ~0u, ~0u};
+    cache.glyphIdsInto(fontLarge, {0, 1, 62, 63, 64, 65, 99998, 99999}, glyphIds);
+    CORRADE_COMPARE_AS(Containers::arrayView(glyphIds), Containers::arrayView({
+        5u, 0u, 0u, 4u, 3u, 0u, 0u, 1u
+    }), TestSuite::Compare::Container);
+
+    UnsignedInt glyphIdsSmall[]{~0u, ~0u, ~0u, ~0u, ~0u};
+    cache.glyphIdsInto(fontSmall, {0, 1, 2, 3, 4}, glyphIdsSmall);
+    CORRADE_COMPARE_AS(Containers::arrayView(glyphIdsSmall), Containers::arrayView({
+        0u, 0u, 0u, 0u, 2u
+    }), TestSuite::Compare::Container);
+
+    CORRADE_COMPARE(cache.glyphId(fontLarge, 50000), 0);
+    CORRADE_COMPARE(cache.glyphId(fontLarge, 99999), 1);
+    CORRADE_COMPARE(cache.glyph(fontLarge, 64), Containers::triple(
+        Vector2i{},
+        0,
+        Range2Di{{5, 6}, {7, 8}}));
+    CORRADE_COMPARE(cache.glyph(fontLarge, 65), Containers::triple(
+        Vector2i{},
+        0,
+        Range2Di{}));
+}
+
+void AbstractGlyphCacheTest::addGlyphs() {
+    DummyGlyphCache cache{PixelFormat::R32F, {64, 32, 3}, {2, 3}};
+
+    /* A glyph added before to verify the IDs are assigned after it */
+    UnsignedInt font3 = cache.addFont(3);
+    UnsignedInt font9 = cache.addFont(9);
+    cache.addGlyph(font3, 1, {}, 0, {{5, 6}, {7, 8}});
+
+    const UnsignedInt fontGlyphIds[]{6, 2, 8, 0};
+    const Vector2i offsets[]{{3, 4}, {5, 6}, {7, 8}, {9, 10}};
+    const Vector2i sizes[]{{30, 10}, {20, 20}, {40, 15}, {10, 5}};
+    Vector3i atlasOffsets[4];
+    Containers::Optional<Range3Di> range = cache.addGlyphs(font9, fontGlyphIds, offsets, sizes, atlasOffsets);
+    CORRADE_VERIFY(range);
+    CORRADE_COMPARE(cache.glyphCount(), 6);
+
+    /* The glyphs get consecutive IDs in the order they were passed */
+    UnsignedInt glyphIds[]{~0u, ~0u, ~0u, ~0u, ~0u, ~0u, ~0u, ~0u, ~0u};
+    cache.glyphIdsInto(font9, {0, 1, 2, 3, 4, 5, 6, 7, 8}, glyphIds);
+    CORRADE_COMPARE_AS(Containers::arrayView(glyphIds), Containers::arrayView({
+        5u, 0u, 3u, 0u, 0u, 0u, 2u, 0u, 4u
+    }), TestSuite::Compare::Container);
+
+    /* The glyph properties are with padding applied, the placement matches
+       what the atlas packer picked and it's all within the returned range */
+    for(std::size_t i = 0; i != 4; ++i) {
+        CORRADE_ITERATION(i);
+        Containers::Triple<Vector2i, Int, Range2Di> glyph = cache.glyph(2 + i);
+        CORRADE_COMPARE(glyph.first(), offsets[i] - Vector2i{2, 3});
+        CORRADE_COMPARE(glyph.second(), atlasOffsets[i].z());
+        CORRADE_COMPARE(glyph.third(), Range2Di::fromSize(atlasOffsets[i].xy(), sizes[i]).padded({2, 3}));
+        CORRADE_VERIFY(range->contains({glyph.third().min(), glyph.second()}));
+        CORRADE_VERIFY(range->contains({glyph.third().max() - Vector2i{1}, glyph.second()}));
+    }
+}
+
+void AbstractGlyphCacheTest::addGlyphs2D() {
+    DummyGlyphCache cache{PixelFormat::R32F, {64, 64}, {2, 3}};
+
+    cache.addFont(9);
+    UnsignedInt fontId = cache.addFont(3);
+
+    const UnsignedInt fontGlyphIds[]{2, 0};
+    const Vector2i offsets[]{{3, 5}, {4, 6}};
+    const Vector2i sizes[]{{30, 5}, {20, 10}};
+    Vector2i atlasOffsets[2];
+    Containers::Optional<Range2Di> range = cache.addGlyphs(fontId, fontGlyphIds, offsets, sizes, atlasOffsets);
+    CORRADE_VERIFY(range);
+    CORRADE_COMPARE(cache.glyphCount(), 3);
+    CORRADE_COMPARE(cache.glyphId(fontId, 2), 1);
+    CORRADE_COMPARE(cache.glyphId(fontId, 0), 2);
+    CORRADE_COMPARE(cache.glyph(1), Containers::triple(
+        Vector2i{1, 2},
+        0,
+        Range2Di::fromSize(atlasOffsets[0], {30, 5}).padded({2, 3})));
+    CORRADE_COMPARE(cache.glyph(2), Containers::triple(
+        Vector2i{2, 3},
+        0,
+        Range2Di::fromSize(atlasOffsets[1], {20, 10}).padded({2, 3})));
+    CORRADE_VERIFY(range->contains(cache.glyph(1).third().min()));
+    CORRADE_VERIFY(range->contains(cache.glyph(2).third().min()));
+}
+
+void AbstractGlyphCacheTest::addGlyphsIncremental() {
+    DummyGlyphCache cache{PixelFormat::R32F, {64, 64}};
+
+    UnsignedInt fontId = cache.addFont(200);
+    cache.addGlyph(fontId, 100, {}, {{1, 1}, {2, 2}});
+
+    /* Adding glyphs in subsequent batches should skip the already present
+       ones and not overwrite them */
+    Vector2i atlasOffsets[3];
+    CORRADE_VERIFY(cache.addGlyphs(fontId,
+        Containers::arrayView({99u, 101u, 0u}),
+        Containers::arrayView<Vector2i>({{}, {}, {}}),
+        Containers::arrayView<Vector2i>({{5, 5}, {5, 5}, {5, 5}}),
+        atlasOffsets));
+    CORRADE_VERIFY(cache.addGlyphs(fontId,
+        Containers::arrayView({199u, 1u}),
+        Containers::arrayView<Vector2i>({{}, {}}),
+        Containers::arrayView<Vector2i>({{5, 5}, {5, 5}}),
+        Containers::arrayView(atlasOffsets).prefix(2)));
+    CORRADE_COMPARE(cache.glyphCount(), 7);
+
+    UnsignedInt glyphIds[7];
+    cache.glyphIdsInto(fontId, {100, 99, 101, 0, 199, 1, 2}, glyphIds);
+    CORRADE_COMPARE_AS(Containers::arrayView(glyphIds), Containers::arrayView({
+        1u, 2u, 3u, 4u, 5u, 6u, 0u
+    }), TestSuite::Compare::Container);
+}
+
+void AbstractGlyphCacheTest::addGlyphsDoesNotFit() {
+    DummyGlyphCache cache{PixelFormat::R32F, {32, 32}};
+
+    UnsignedInt fontId = cache.addFont(3);
+
+    Vector2i atlasOffsets[2];
+    CORRADE_VERIFY(!cache.addGlyphs(fontId,
+        Containers::arrayView({0u, 2u}),
+        Containers::arrayView<Vector2i>({{}, {}}),
+        Containers::arrayView<Vector2i>({{16, 16}, {64, 8}}),
+        atlasOffsets));
+
+    /* No glyphs got added */
+    CORRADE_COMPARE(cache.glyphCount(), 1);
+    CORRADE_COMPARE(cache.glyphId(fontId, 0), 0);
+    CORRADE_COMPARE(cache.glyphId(fontId, 2), 0);
+}
+
+void AbstractGlyphCacheTest::addGlyphsInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    DummyGlyphCache cache{PixelFormat::R32F, {64, 64, 3}, {}};
+
+    cache.addFont(9);
+    UnsignedInt fontId = cache.addFont(3);
+    cache.addGlyph(fontId, 1, {}, 0, {});
+
+    const UnsignedInt fontGlyphIds[3]{};
+    const Vector2i offsets[3]{};
+    const Vector2i sizes[3]{};
+    Vector3i atlasOffsets[3];
+
+    Containers::String out;
+    Error redirectError{&out};
+    cache.addGlyphs(fontId, fontGlyphIds, Containers::arrayView(offsets).prefix(2), sizes, atlasOffsets);
+    cache.addGlyphs(fontId, fontGlyphIds, offsets, Containers::arrayView(sizes).prefix(2), atlasOffsets);
+    cache.addGlyphs(fontId, fontGlyphIds, offsets, sizes, Containers::arrayView(atlasOffsets).prefix(2));
+    cache.addGlyphs(cache.fontCount(), fontGlyphIds, offsets, sizes, atlasOffsets);
+    cache.addGlyphs(fontId, Containers::arrayView({0u, 2u, 3u}), offsets, sizes, atlasOffsets);
+    cache.addGlyphs(fontId, Containers::arrayView({0u, 1u, 2u}), offsets, sizes, atlasOffsets);
+    cache.addGlyphs(fontId, Containers::arrayView({2u, 0u, 2u}), offsets, sizes, atlasOffsets);
+    CORRADE_COMPARE_AS(out,
+        "Text::AbstractGlyphCache::addGlyphs(): expected fontGlyphIds, offsets, sizes and atlasOffsets views to have the same size but got 3, 2, 3 and 3\n"
+        "Text::AbstractGlyphCache::addGlyphs(): expected fontGlyphIds, offsets, sizes and atlasOffsets views to have the same size but got 3, 3, 2 and 3\n"
+        "Text::AbstractGlyphCache::addGlyphs(): expected fontGlyphIds, offsets, sizes and atlasOffsets views to have the same size but got 3, 3, 3 and 2\n"
+        "Text::AbstractGlyphCache::addGlyphs(): index 2 out of range for 2 fonts\n"
+        "Text::AbstractGlyphCache::addGlyphs(): glyph 2 index 3 out of range for 3 glyphs in font 1\n"
+        "Text::AbstractGlyphCache::addGlyphs(): glyph 1 in font 1 already added at index 1\n"
+        "Text::AbstractGlyphCache::addGlyphs(): glyph 2 in font 1 listed more than once\n",
+        TestSuite::Compare::String);
+
+    /* Nothing got added in any of the above */
+    CORRADE_COMPARE(cache.glyphCount(), 2);
+}
+
+void AbstractGlyphCacheTest::addGlyphsTooMany() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    DummyGlyphCache cache{PixelFormat::R32F, {1024, 512}, {}};
+
+    /* Adding a font with over 65k potential glyphs is okay */
+    UnsignedInt fontId = cache.addFont(100000);
+
+    /* Zero-sized glyphs with zero padding don't occupy any space in the
+       atlas, so they all fit */
+    Containers::Array<UnsignedInt> fontGlyphIds{NoInit, 65535};
+    for(UnsignedInt i = 0; i != fontGlyphIds.size(); ++i)
+        fontGlyphIds[i] = i;
+    Containers::Array<Vector2i> offsetsSizes{ValueInit, 65535};
+    Containers::Array<Vector2i> atlasOffsets{NoInit, 65535};
+    CORRADE_VERIFY(cache.addGlyphs(fontId, fontGlyphIds, offsetsSizes, offsetsSizes, atlasOffsets));
+    CORRADE_COMPARE(cache.glyphCount(), 65536);
+
+    /* But adding 65k actual glyphs isn't */
+    Containers::String out;
+    Error redirectError{&out};
+    cache.addGlyphs(fontId,
+        Containers::arrayView({65535u, 65536u}),
+        offsetsSizes.prefix(2),
+        offsetsSizes.prefix(2),
+        atlasOffsets.prefix(2));
+    CORRADE_COMPARE(out, "Text::AbstractGlyphCache::addGlyphs(): only at most 65536 glyphs can be added, got 2 with 65536 already present\n");
+}
+
+void AbstractGlyphCacheTest::addGlyphs2DNot2D() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    DummyGlyphCache cache{PixelFormat::R32F, {1024, 512, 3}};
+
+    Containers::String out;
+    Error redirectError{&out};
+    cache.addGlyphs(0, nullptr, nullptr, nullptr, Containers::StridedArrayView1D<Vector2i>{});
+    CORRADE_COMPARE(out, "Text::AbstractGlyphCache::addGlyphs(): use the 3D overload for an array glyph cache\n");
+}
+
+void AbstractGlyphCacheTest::markGlyphsUsed() {
+    DummyGlyphCache cache{PixelFormat::R8Unorm, {16, 16}};
+
+    UnsignedInt fontId = cache.addFont(10);
+    cache.addGlyph(fontId, 3, {}, {{1, 1}, {3, 3}});
+    cache.addGlyph(fontId, 5, {}, {{5, 1}, {7, 3}});
+
+    /* Initially all glyphs are at the same usage */
+    CORRADE_COMPARE_AS(cache.glyphLastUsed(), Containers::arrayView({
+        0u, 0u, 0u
+    }), TestSuite::Compare::Container);
+
+    /* Each call increments the counter */
+    cache.markGlyphsUsed({2});
+    cache.markGlyphsUsed({1, 2});
+    CORRADE_COMPARE_AS(cache.glyphLastUsed(), Containers::arrayView({
+        0u, 2u, 2u
+    }), TestSuite::Compare::Container);
+
+    /* A newly added glyph gets the current counter value */
+    cache.markGlyphsUsed({2});
+    cache.addGlyph(fontId, 7, {}, {{9, 1}, {11, 3}});
+    CORRADE_COMPARE_AS(cache.glyphLastUsed(), Containers::arrayView({
+        0u, 2u, 3u, 3u
+    }), TestSuite::Compare::Container);
+}
+
+void AbstractGlyphCacheTest::markGlyphsUsedOutOfRange() {
+    CORRADE_SKIP_IF_NO_DEBUG_ASSERT();
+
+    DummyGlyphCache cache{PixelFormat::R8Unorm, {16, 16}};
+
+    UnsignedInt fontId = cache.addFont(10);
+    cache.addGlyph(fontId, 3, {}, {{1, 1}, {3, 3}});
+
+    Containers::String out;
+    Error redirectError{&out};
+    cache.markGlyphsUsed({1, 0, 2});
+    CORRADE_COMPARE(out, "Text::AbstractGlyphCache::markGlyphsUsed(): glyph 2 index 2 out of range for 2 glyphs\n");
+}
+
+void AbstractGlyphCacheTest::evictGlyphs() {
+    DummyGlyphCache cache{PixelFormat::R8Unorm, {16, 16}, {1, 1}};
+
+    /* Fill the image with non-zero data to verify evicted glyph areas get
+       cleared */
+    for(char& i: cache.image().data())
+        i = 'x';
+
+    UnsignedInt fontId = cache.addFont(10);
+    CORRADE_COMPARE(cache.addGlyph(fontId, 3, {1, 2}, {{1, 1}, {3, 3}}), 1);
+    CORRADE_COMPARE(cache.addGlyph(fontId, 5, {3, 4}, {{5, 1}, {7, 3}}), 2);
+    CORRADE_COMPARE(cache.addGlyph(fontId, 7, {5, 6}, {{9, 1}, {11, 3}}), 3);
+
+    cache.markGlyphsUsed({1, 3});
+    cache.markGlyphsUsed({3});
+
+    /* Glyph 2 is the least recently used */
+    CORRADE_COMPARE(cache.evictGlyphs(1), 1);
+    CORRADE_COMPARE(cache.glyphCount(), 4);
+    CORRADE_COMPARE(cache.glyphId(fontId, 3), 1);
+    CORRADE_COMPARE(cache.glyphId(fontId, 5), 0);
+    CORRADE_COMPARE(cache.glyphId(fontId, 7), 3);
+    CORRADE_COMPARE(cache.glyph(2), (Containers::Triple<Vector2i, Int, Range2Di>{}));
+    CORRADE_COMPARE(cache.glyph(3), Containers::triple(Vector2i{4, 5}, 0, Range2Di{{8, 0}, {12, 4}}));
+
+    /* The padded area of the evicted glyph is cleared, the surroundings are
+       not */
+    Containers::StridedArrayView2D<const char> pixels = cache.image().pixels<char>()[0];
+    CORRADE_COMPARE(pixels[0][3], 'x');
+    CORRADE_COMPARE(pixels[0][4], '\0');
+    CORRADE_COMPARE(pixels[3][7], '\0');
+    CORRADE_COMPARE(pixels[0][8], 'x');
+    CORRADE_COMPARE(pixels[4][4], 'x');
+
+    /* Evicting more than there is evicts just what's left, glyph 1 first as
+       it was used less recently. The invalid glyph stays. */
+    CORRADE_COMPARE(cache.evictGlyphs(5), 2);
+    CORRADE_COMPARE(cache.glyphId(fontId, 3), 0);
+    CORRADE_COMPARE(cache.glyphId(fontId, 7), 0);
+    CORRADE_COMPARE(cache.evictGlyphs(5), 0);
+    CORRADE_COMPARE(cache.glyphCount(), 4);
+
+    /* Adding glyphs again reuses the IDs, most recently evicted first */
+    CORRADE_COMPARE(cache.addGlyph(fontId, 5, {}, {{1, 5}, {2, 6}}), 3);
+    CORRADE_COMPARE(cache.addGlyph(fontId, 9, {}, {{3, 5}, {4, 6}}), 1);
+    CORRADE_COMPARE(cache.addGlyph(fontId, 0, {}, {{5, 5}, {6, 6}}), 2);
+    CORRADE_COMPARE(cache.addGlyph(fontId, 1, {}, {{7, 5}, {8, 6}}), 4);
+    CORRADE_COMPARE(cache.glyphCount(), 5);
+    CORRADE_COMPARE(cache.glyphId(fontId, 5), 3);
+    CORRADE_COMPARE(cache.glyph(3), Containers::triple(Vector2i{-1, -1}, 0, Range2Di{{0, 4}, {3, 7}}));
+}
+
+void AbstractGlyphCacheTest::evictGlyphsReuseSpace() {
+    DummyGlyphCache cache{PixelFormat::R8Unorm, {32, 32}, {1, 1}};
+
+    UnsignedInt fontId = cache.addFont(10);
+    const UnsignedInt fontGlyphIds[]{0, 1, 2};
+    const Vector2i offsets[3]{};
+    const Vector2i sizes[]{{6, 6}, {6, 6}, {6, 6}};
+    Vector2i atlasOffsets[3];
+    CORRADE_VERIFY(cache.addGlyphs(fontId, fontGlyphIds, offsets, sizes, atlasOffsets));
+
+    /* Evict the middle glyph, its padded area is what's free now */
+    cache.markGlyphsUsed({1, 3});
+    CORRADE_COMPARE(cache.evictGlyphs(1), 1);
+    CORRADE_COMPARE(cache.glyphId(fontId, 1), 0);
+    const Range2Di freed = Range2Di::fromSize(atlasOffsets[1], {6, 6}).padded({1, 1});
+
+    /* The first glyph fits into the freed area, the second into what remains
+       after, the third doesn't fit and goes to the atlas */
+    const UnsignedInt fontGlyphIds2[]{3, 4, 5};
+    const Vector2i sizes2[]{{4, 6}, {0, 6}, {7, 7}};
+    Vector2i atlasOffsets2[3];
+    Containers::Optional<Range2Di> range = cache.addGlyphs(fontId, fontGlyphIds2, offsets, sizes2, atlasOffsets2);
+    CORRADE_VERIFY(range);
+    CORRADE_COMPARE(atlasOffsets2[0], freed.min() + Vector2i{1, 1});
+    CORRADE_COMPARE(atlasOffsets2[1], freed.min() + Vector2i{7, 1});
+    CORRADE_VERIFY(!Math::intersects(freed, Range2Di::fromSize(atlasOffsets2[2], {7, 7})));
+    CORRADE_VERIFY(range->contains(freed));
+    CORRADE_VERIFY(range->contains(Range2Di::fromSize(atlasOffsets2[2], {7, 7})));
+
+    /* The first glyph reuses the evicted ID, the others get new ones */
+    CORRADE_COMPARE(cache.glyphCount(), 6);
+    CORRADE_COMPARE(cache.glyphId(fontId, 3), 2);
+    CORRADE_COMPARE(cache.glyphId(fontId, 4), 4);
+    CORRADE_COMPARE(cache.glyphId(fontId, 5), 5);
+    CORRADE_COMPARE(cache.glyph(2).third(), Range2Di::fromSize(atlasOffsets2[0], {4, 6}).padded({1, 1}));
+}
+
+void AbstractGlyphCacheTest::evictGlyphsReuseSpaceDoesNotFit() {
+    DummyGlyphCache cache{PixelFormat::R8Unorm, {16, 16}, {}};
+
+    /* Two glyphs filling the whole cache */
+    UnsignedInt fontId = cache.addFont(10);
+    const UnsignedInt fontGlyphIds[]{0, 1};
+    const Vector2i offsets[2]{};
+    const Vector2i sizes[]{{8, 16}, {8, 16}};
+    Vector2i atlasOffsets[2];
+    CORRADE_VERIFY(cache.addGlyphs(fontId, fontGlyphIds, offsets, sizes, atlasOffsets));
+
+    /* Both were used at the same time, the one with a lower ID gets evicted */
+    CORRADE_COMPARE(cache.evictGlyphs(1), 1);
+    CORRADE_COMPARE(cache.glyphId(fontId, 0), 0);
+    CORRADE_COMPARE(cache.glyphId(fontId, 1), 2);
+
+    /* The first glyph fits into the freed area but the second doesn't fit
+       anywhere, so nothing gets added */
+    const UnsignedInt fontGlyphIds2[]{2, 3};
+    const Vector2i sizes2[]{{8, 8}, {16, 1}};
+    Vector2i atlasOffsets2[2];
+    CORRADE_VERIFY(!cache.addGlyphs(fontId, fontGlyphIds2, offsets, sizes2, atlasOffsets2));
+    CORRADE_COMPARE(cache.glyphId(fontId, 2), 0);
+    CORRADE_COMPARE(cache.glyphId(fontId, 3), 0);
+
+    /* The freed area is still available in full */
+    const UnsignedInt fontGlyphIds3[]{4};
+    const Vector2i sizes3[]{{8, 16}};
+    Vector2i atlasOffsets3[1];
+    CORRADE_VERIFY(cache.addGlyphs(fontId, fontGlyphIds3, Containers::arrayView(offsets).prefix(1), sizes3, atlasOffsets3));
+    CORRADE_COMPARE(atlasOffsets3[0], atlasOffsets[0]);
+    CORRADE_COMPARE(cache.glyphId(fontId, 4), 1);
+}
+
 #ifdef MAGNUM_BUILD_DEPRECATED
 void AbstractGlyphCacheTest::insert() {
     DummyGlyphCache cache{PixelFormat::R8Unorm, {100, 200}, {2, 3}};
@@ -1598,6 +2027,76 @@ void AbstractGlyphCacheTest::flushImage2DNot2D() {
     CORRADE_COMPARE(out, "Text::AbstractGlyphCache::flushImage(): use the 3D or layer overload for an array glyph cache\n");
 }
 
+void AbstractGlyphCacheTest::flushImageDirty() {
+    struct Cache: AbstractGlyphCache {
+        using AbstractGlyphCache::AbstractGlyphCache;
+
+        GlyphCacheFeatures doFeatures() const override { return {}; }
+        void doSetImage(const Vector3i& offset, const ImageView3D& image) override {
+            arrayAppend(ranges, InPlaceInit, offset, offset + image.size());
+        }
+
+        Containers::Array<Range3Di> ranges;
+    } cache{PixelFormat::R8Unorm, {32, 32, 2}, {}};
+
+    UnsignedInt fontId = cache.addFont(10);
+    CORRADE_COMPARE_AS(cache.dirtyImageRanges(),
+        Containers::ArrayView<const Range3Di>{},
+        TestSuite::Compare::Container);
+
+    /* Adjacent glyphs in the same layer get merged, in a different layer or
+       further away not */
+    cache.addGlyph(fontId, 0, {}, 0, {{0, 0}, {4, 4}});
+    cache.addGlyph(fontId, 1, {}, 0, {{4, 0}, {8, 4}});
+    cache.addGlyph(fontId, 2, {}, 1, {{0, 0}, {4, 4}});
+    cache.addGlyph(fontId, 3, {}, 0, {{20, 20}, {24, 24}});
+    CORRADE_COMPARE_AS(cache.dirtyImageRanges(), Containers::arrayView<Range3Di>({
+        {{0, 0, 0}, {8, 4, 1}},
+        {{0, 0, 1}, {4, 4, 2}},
+        {{20, 20, 0}, {24, 24, 1}},
+    }), TestSuite::Compare::Container);
+
+    /* Flushing a range discards the dirty ranges contained in it */
+    cache.flushImage(0, {{}, {10, 10}});
+    CORRADE_COMPARE_AS(cache.dirtyImageRanges(), Containers::arrayView<Range3Di>({
+        {{20, 20, 0}, {24, 24, 1}},
+        {{0, 0, 1}, {4, 4, 2}},
+    }), TestSuite::Compare::Container);
+
+    /* Flushing without arguments uploads exactly the remaining dirty
+       ranges */
+    cache.flushImage();
+    CORRADE_COMPARE_AS(cache.dirtyImageRanges(),
+        Containers::ArrayView<const Range3Di>{},
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(cache.ranges, Containers::arrayView<Range3Di>({
+        {{0, 0, 0}, {10, 10, 1}},
+        {{20, 20, 0}, {24, 24, 1}},
+        {{0, 0, 1}, {4, 4, 2}},
+    }), TestSuite::Compare::Container);
+
+    /* Flushing again does nothing */
+    cache.flushImage();
+    CORRADE_COMPARE(cache.ranges.size(), 3);
+}
+
+void AbstractGlyphCacheTest::flushImageDirtyTooManyRanges() {
+    DummyGlyphCache cache{PixelFormat::R8Unorm, {32, 32}, {}};
+
+    /* 17 glyphs with a gap between each, so they don't get merged */
+    UnsignedInt fontId = cache.addFont(17);
+    for(UnsignedInt i = 0; i != 16; ++i)
+        cache.addGlyph(fontId, i, {}, Range2Di::fromSize({Int(i%8)*2, Int(i/8)*2}, {1, 1}));
+    CORRADE_COMPARE(cache.dirtyImageRanges().size(), 16);
+
+    /* Adding one more merges the pair with the least extra area, which is
+       the first two glyphs */
+    cache.addGlyph(fontId, 16, {}, Range2Di::fromSize({0, 4}, {1, 1}));
+    CORRADE_COMPARE(cache.dirtyImageRanges().size(), 16);
+    CORRADE_COMPARE(cache.dirtyImageRanges()[0], (Range3Di{{0, 0, 0}, {3, 1, 1}}));
+    CORRADE_COMPARE(cache.dirtyImageRanges()[1], (Range3Di{{0, 4, 0}, {1, 5, 1}}));
+}
+
 #ifdef MAGNUM_BUILD_DEPRECATED
 void AbstractGlyphCacheTest::setImage() {
     auto&& data = FlushImageData[testCaseInstanceId()];
@@ -25,6 +25,7 @@
 */
 
 #include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/BitArray.h>
 #include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/StaticArray.h>
@@ -87,6 +88,11 @@ struct RendererTest: TestSuite::Tester {
     void alignBlock();
     void alignBlockInvalidDirection();
 
+    void renderLines();
+    void renderLines2D();
+    void renderLinesInvalid();
+    void renderLines2DArrayGlyphCache();
+
     template<class T> void glyphQuadIndices();
     void glyphQuadIndicesTypeTooSmall();
 
@@ -198,6 +204,19 @@ const struct {
     {"middle, integral", Alignment::MiddleLeftIntegral, -15.0f}
 };
 
+const struct {
+    const char* name;
+    UnsignedInt shaperCount;
+    Alignment alignment;
+    ShapeDirection shapeDirection;
+} RenderLinesData[]{
+    {"one shaper", 1, Alignment::LineLeft, ShapeDirection::Unspecified},
+    {"three shapers", 3, Alignment::LineLeft, ShapeDirection::Unspecified},
+    {"three shapers, top right", 3, Alignment::TopRight, ShapeDirection::Unspecified},
+    {"three shapers, middle center, glyph bounds", 3, Alignment::MiddleCenterGlyphBounds, ShapeDirection::Unspecified},
+    {"two shapers, line begin, RTL", 2, Alignment::LineBegin, ShapeDirection::RightToLeft},
+};
+
 const struct {
     const char* name;
     bool ascending;
@@ -1684,7 +1703,14 @@ RendererTest::RendererTest() {
     addInstancedTests({&RendererTest::alignBlock},
         Containers::arraySize(AlignBlockData));
 
-    addTests({&RendererTest::alignBlockInvalidDirection,
+    addTests({&RendererTest::alignBlockInvalidDirection});
+
+    addInstancedTests({&RendererTest::renderLines},
+        Containers::arraySize(RenderLinesData));
+
+    addTests({&RendererTest::renderLines2D,
+              &RendererTest::renderLinesInvalid,
+              &RendererTest::renderLines2DArrayGlyphCache,
 
               &RendererTest::glyphQuadIndices<UnsignedInt>,
               &RendererTest::glyphQuadIndices<UnsignedShort>,
@@ -2429,6 +2455,266 @@ void RendererTest::alignBlockInvalidDirection() {
         TestSuite::Compare::String);
 }
 
+void RendererTest::renderLines() {
+    auto&& data = RenderLinesData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    TestFont font;
+    font.direction = data.shapeDirection;
+    font.openFile({}, 2.5f);
+    DummyGlyphCache cache = testGlyphCacheArray(font);
+
+    Containers::Pointer<AbstractShaper> shaperStorage[3]{
+        font.createShaper(),
+        font.createShaper(),
+        font.createShaper(),
+    };
+    AbstractShaper* shapers[3]{
+        shaperStorage[0].get(),
+        shaperStorage[1].get(),
+        shaperStorage[2].get(),
+    };
+
+    Containers::StringView texts[]{
+        "hello",
+        /* Empty text, should produce no glyphs and a zero-size rectangle at
+           the origin */
+        "",
+        "abc",
+        /* Doesn't fit into its range, should be left untouched */
+        "toolongtext",
+        "xy",
+        /* Not in the update mask, should be left untouched */
+        "unchanged"
+    };
+    Vector2 origins[]{
+        {10.0f, 20.0f},
+        {-5.0f, 3.0f},
+        {},
+        {1.0f, 1.0f},
+        {7.0f, -8.0f},
+        {2.0f, 2.0f}
+    };
+    Range1Dui glyphRanges[]{
+        {0, 6},
+        {6, 8},
+        {8, 11},
+        {11, 14},
+        {14, 16},
+        {16, 25}
+    };
+    Containers::BitArray textsToUpdate{DirectInit, 6, true};
+    textsToUpdate.reset(5);
+
+    Vector2 vertexPositions[25*4];
+    Vector3 vertexTextureCoordinates[25*4];
+    UnsignedInt glyphCounts[6];
+    Range2D rectangles[6];
+    /* Fill everything with garbage to verify what gets touched */
+    for(Vector2& i: vertexPositions) i = Vector2{-1.0f};
+    for(Vector3& i: vertexTextureCoordinates) i = Vector3{-1.0f};
+    for(UnsignedInt& i: glyphCounts) i = ~UnsignedInt{};
+    for(Range2D& i: rectangles) i = {Vector2{-1.0f}, Vector2{-1.0f}};
+
+    renderLinesInto(Containers::arrayView(shapers).prefix(data.shaperCount), 5.0f, cache, LayoutDirection::HorizontalTopToBottom, data.alignment, texts, origins, glyphRanges, textsToUpdate, vertexPositions, vertexTextureCoordinates, glyphCounts, rectangles);
+
+    CORRADE_COMPARE_AS(Containers::arrayView(glyphCounts), Containers::arrayView<UnsignedInt>({
+        5, 0, 3, 11, 2, ~UnsignedInt{}
+    }), TestSuite::Compare::Container);
+
+    /* The output should be the same as when rendering each text with the
+       Renderer, placed at a glyph range offset, and the rest of the range
+       filled with degenerate quads */
+    Renderer renderer{cache};
+    for(UnsignedInt i: {0, 1, 2, 4}) {
+        CORRADE_ITERATION(i);
+
+        renderer.clear()
+            .setCursor(origins[i])
+            .setAlignment(data.alignment);
+        Range2D rectangle = renderer.render(*shapers[0], 5.0f, texts[i]).first();
+        CORRADE_COMPARE(rectangles[i], rectangle);
+
+        const std::size_t vertexBegin = glyphRanges[i].min()*4;
+        const std::size_t vertexGlyphEnd = vertexBegin + glyphCounts[i]*4;
+        const std::size_t vertexEnd = glyphRanges[i].max()*4;
+        CORRADE_COMPARE_AS(Containers::arrayView(vertexPositions).slice(vertexBegin, vertexGlyphEnd),
+            renderer.vertexPositions(),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(Containers::arrayView(vertexTextureCoordinates).slice(vertexBegin, vertexGlyphEnd),
+            renderer.vertexTextureArrayCoordinates(),
+            TestSuite::Compare::Container);
+        for(std::size_t j = vertexGlyphEnd; j != vertexEnd; ++j) {
+            CORRADE_ITERATION(j);
+            CORRADE_COMPARE(vertexPositions[j], Vector2{});
+            CORRADE_COMPARE(vertexTextureCoordinates[j], Vector3{});
+        }
+    }
+
+    /* Texts that didn't fit or weren't updated are left untouched */
+    for(UnsignedInt i: {3, 5}) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(rectangles[i], (Range2D{Vector2{-1.0f}, Vector2{-1.0f}}));
+        for(std::size_t j = glyphRanges[i].min()*4; j != glyphRanges[i].max()*4; ++j) {
+            CORRADE_ITERATION(j);
+            CORRADE_COMPARE(vertexPositions[j], Vector2{-1.0f});
+            CORRADE_COMPARE(vertexTextureCoordinates[j], Vector3{-1.0f});
+        }
+    }
+}
+
+void RendererTest::renderLines2D() {
+    /* Like renderLines(), but with a 2D glyph cache and just the basic case */
+
+    TestFont font;
+    font.openFile({}, 2.5f);
+    DummyGlyphCache cache = testGlyphCache(font);
+
+    Containers::Pointer<AbstractShaper> shaperStorage[2]{
+        font.createShaper(),
+        font.createShaper(),
+    };
+    AbstractShaper* shapers[2]{
+        shaperStorage[0].get(),
+        shaperStorage[1].get(),
+    };
+
+    Containers::StringView texts[]{
+        "hello",
+        "abc",
+        "xy"
+    };
+    Vector2 origins[]{
+        {10.0f, 20.0f},
+        {},
+        {7.0f, -8.0f}
+    };
+    Range1Dui glyphRanges[]{
+        {0, 5},
+        {5, 9},
+        {9, 11}
+    };
+    Containers::BitArray textsToUpdate{DirectInit, 3, true};
+
+    Vector2 vertexPositions[11*4];
+    Vector2 vertexTextureCoordinates[11*4];
+    UnsignedInt glyphCounts[3];
+    Range2D rectangles[3];
+    renderLinesInto(shapers, 5.0f, cache, LayoutDirection::HorizontalTopToBottom, Alignment::MiddleCenter, texts, origins, glyphRanges, textsToUpdate, vertexPositions, vertexTextureCoordinates, glyphCounts, rectangles);
+
+    CORRADE_COMPARE_AS(Containers::arrayView(glyphCounts), Containers::arrayView<UnsignedInt>({
+        5, 3, 2
+    }), TestSuite::Compare::Container);
+
+    Renderer renderer{cache};
+    for(UnsignedInt i = 0; i != 3; ++i) {
+        CORRADE_ITERATION(i);
+
+        renderer.clear()
+            .setCursor(origins[i])
+            .setAlignment(Alignment::MiddleCenter);
+        Range2D rectangle = renderer.render(*shapers[0], 5.0f, texts[i]).first();
+        CORRADE_COMPARE(rectangles[i], rectangle);
+
+        const std::size_t vertexBegin = glyphRanges[i].min()*4;
+        const std::size_t vertexGlyphEnd = vertexBegin + glyphCounts[i]*4;
+        CORRADE_COMPARE_AS(Containers::arrayView(vertexPositions).slice(vertexBegin, vertexGlyphEnd),
+            renderer.vertexPositions(),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(Containers::arrayView(vertexTextureCoordinates).slice(vertexBegin, vertexGlyphEnd),
+            renderer.vertexTextureCoordinates(),
+            TestSuite::Compare::Container);
+    }
+
+    /* The second range has space for one more glyph, which is degenerate */
+    for(std::size_t j = 8*4; j != 9*4; ++j) {
+        CORRADE_ITERATION(j);
+        CORRADE_COMPARE(vertexPositions[j], Vector2{});
+        CORRADE_COMPARE(vertexTextureCoordinates[j], Vector2{});
+    }
+}
+
+void RendererTest::renderLinesInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    TestFont font, fontClosed, fontAnother;
+    font.openFile({}, 2.5f);
+    fontClosed.openFile({}, 2.5f);
+    fontAnother.openFile({}, 2.5f);
+    DummyGlyphCache cache = testGlyphCacheArray(font);
+    DummyGlyphCache cacheNoFont{PixelFormat::R8Unorm, {20, 20, 3}};
+
+    Containers::Pointer<AbstractShaper> shaper = font.createShaper();
+    Containers::Pointer<AbstractShaper> shaperClosed = fontClosed.createShaper();
+    Containers::Pointer<AbstractShaper> shaperAnother = fontAnother.createShaper();
+    /* A shaper can't be created for a closed font, so close it only after */
+    fontClosed.close();
+    AbstractShaper* shapers[]{shaper.get()};
+    AbstractShaper* shapersNull[]{shaper.get(), nullptr};
+    AbstractShaper* shapersDifferent[]{shaper.get(), shaper.get(), shaperAnother.get()};
+    AbstractShaper* shapersClosed[]{shaperClosed.get()};
+
+    Containers::StringView texts[2]{"abc", "de"};
+    Vector2 origins[2];
+    Range1Dui glyphRanges[]{{0, 3}, {3, 6}};
+    Range1Dui glyphRangesOutOfRange[]{{0, 3}, {3, 7}};
+    Range1Dui glyphRangesInverted[]{{3, 0}, {3, 6}};
+    Containers::BitArray textsToUpdate{DirectInit, 2, true};
+    Vector2 vertexPositions[24];
+    Vector3 vertexTextureCoordinates[24];
+    UnsignedInt glyphCounts[2];
+    Range2D rectangles[2];
+
+    Containers::String out;
+    Error redirectError{&out};
+    renderLinesInto({}, 5.0f, cache, LayoutDirection::HorizontalTopToBottom, Alignment::LineLeft, texts, origins, glyphRanges, textsToUpdate, vertexPositions, vertexTextureCoordinates, glyphCounts, rectangles);
+    renderLinesInto(shapersNull, 5.0f, cache, LayoutDirection::HorizontalTopToBottom, Alignment::LineLeft, texts, origins, glyphRanges, textsToUpdate, vertexPositions, vertexTextureCoordinates, glyphCounts, rectangles);
+    renderLinesInto(shapersDifferent, 5.0f, cache, LayoutDirection::HorizontalTopToBottom, Alignment::LineLeft, texts, origins, glyphRanges, textsToUpdate, vertexPositions, vertexTextureCoordinates, glyphCounts, rectangles);
+    renderLinesInto(shapersClosed, 5.0f, cache, LayoutDirection::HorizontalTopToBottom, Alignment::LineLeft, texts, origins, glyphRanges, textsToUpdate, vertexPositions, vertexTextureCoordinates, glyphCounts, rectangles);
+    renderLinesInto(shapers, 5.0f, cache, LayoutDirection::VerticalRightToLeft, Alignment::LineLeft, texts, origins, glyphRanges, textsToUpdate, vertexPositions, vertexTextureCoordinates, glyphCounts, rectangles);
+    renderLinesInto(shapers, 5.0f, cache, LayoutDirection::HorizontalTopToBottom, Alignment::LineLeft, texts, Containers::arrayView(origins).prefix(1), glyphRanges, textsToUpdate, vertexPositions, vertexTextureCoordinates, glyphCounts, rectangles);
+    renderLinesInto(shapers, 5.0f, cache, LayoutDirection::HorizontalTopToBottom, Alignment::LineLeft, texts, origins, Containers::arrayView(glyphRanges).prefix(1), textsToUpdate, vertexPositions, vertexTextureCoordinates, glyphCounts, rectangles);
+    renderLinesInto(shapers, 5.0f, cache, LayoutDirection::HorizontalTopToBottom, Alignment::LineLeft, texts, origins, glyphRanges, Containers::BitArrayView{textsToUpdate}.prefix(1), vertexPositions, vertexTextureCoordinates, glyphCounts, rectangles);
+    renderLinesInto(shapers, 5.0f, cache, LayoutDirection::HorizontalTopToBottom, Alignment::LineLeft, texts, origins, glyphRanges, textsToUpdate, vertexPositions, vertexTextureCoordinates, Containers::arrayView(glyphCounts).prefix(1), rectangles);
+    renderLinesInto(shapers, 5.0f, cache, LayoutDirection::HorizontalTopToBottom, Alignment::LineLeft, texts, origins, glyphRanges, textsToUpdate, vertexPositions, vertexTextureCoordinates, glyphCounts, Containers::arrayView(rectangles).prefix(1));
+    renderLinesInto(shapers, 5.0f, cache, LayoutDirection::HorizontalTopToBottom, Alignment::LineLeft, texts, origins, glyphRanges, textsToUpdate, vertexPositions, Containers::arrayView(vertexTextureCoordinates).prefix(23), glyphCounts, rectangles);
+    renderLinesInto(shapers, 5.0f, cacheNoFont, LayoutDirection::HorizontalTopToBottom, Alignment::LineLeft, texts, origins, glyphRanges, textsToUpdate, vertexPositions, vertexTextureCoordinates, glyphCounts, rectangles);
+    renderLinesInto(shapers, 5.0f, cache, LayoutDirection::HorizontalTopToBottom, Alignment::LineLeft, texts, origins, glyphRangesOutOfRange, textsToUpdate, vertexPositions, vertexTextureCoordinates, glyphCounts, rectangles);
+    renderLinesInto(shapers, 5.0f, cache, LayoutDirection::HorizontalTopToBottom, Alignment::LineLeft, texts, origins, glyphRangesInverted, textsToUpdate, vertexPositions, vertexTextureCoordinates, glyphCounts, rectangles);
+    CORRADE_COMPARE_AS(out,
+        "Text::renderLinesInto(): expected at least one shaper\n"
+        "Text::renderLinesInto(): shaper 1 is null\n"
+        "Text::renderLinesInto(): shaper 2 is from a different font than shaper 0\n"
+        "Text::renderLinesInto(): no font opened\n"
+        "Text::renderLinesInto(): only Text::LayoutDirection::HorizontalTopToBottom is supported right now, got Text::LayoutDirection::VerticalRightToLeft\n"
+        "Text::renderLinesInto(): expected texts, origins, glyphRanges, textsToUpdate, glyphCounts and rectangles views to have the same size, got 2, 1, 2, 2, 2 and 2\n"
+        "Text::renderLinesInto(): expected texts, origins, glyphRanges, textsToUpdate, glyphCounts and rectangles views to have the same size, got 2, 2, 1, 2, 2 and 2\n"
+        "Text::renderLinesInto(): expected texts, origins, glyphRanges, textsToUpdate, glyphCounts and rectangles views to have the same size, got 2, 2, 2, 1, 2 and 2\n"
+        "Text::renderLinesInto(): expected texts, origins, glyphRanges, textsToUpdate, glyphCounts and rectangles views to have the same size, got 2, 2, 2, 2, 1 and 2\n"
+        "Text::renderLinesInto(): expected texts, origins, glyphRanges, textsToUpdate, glyphCounts and rectangles views to have the same size, got 2, 2, 2, 2, 2 and 1\n"
+        "Text::renderLinesInto(): expected vertexPositions and vertexTextureCoordinates views to have the same size, got 24 and 23\n"
+        "Text::renderLinesInto(): shaper font not found among 0 fonts in passed glyph cache\n"
+        "Text::renderLinesInto(): glyph range {3, 7} for text 1 out of range for 6 glyphs\n"
+        "Text::renderLinesInto(): glyph range {3, 0} for text 0 out of range for 6 glyphs\n",
+        TestSuite::Compare::String);
+}
+
+void RendererTest::renderLines2DArrayGlyphCache() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    TestFont font;
+    font.openFile({}, 2.5f);
+    DummyGlyphCache cache = testGlyphCacheArray(font);
+
+    Containers::Pointer<AbstractShaper> shaper = font.createShaper();
+    AbstractShaper* shapers[]{shaper.get()};
+
+    Containers::String out;
+    Error redirectError{&out};
+    renderLinesInto(shapers, 5.0f, cache, LayoutDirection::HorizontalTopToBottom, Alignment::LineLeft, nullptr, nullptr, nullptr, {}, nullptr, Containers::StridedArrayView1D<Vector2>{}, nullptr, nullptr);
+    CORRADE_COMPARE(out, "Text::renderLinesInto(): can't use this overload with an array glyph cache\n");
+}
+
 template<class T> void RendererTest::glyphQuadIndices() {
     setTestCaseTemplateName(Math::TypeTraits<T>::name());
 
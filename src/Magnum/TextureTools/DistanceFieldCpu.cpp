@@ -0,0 +1,331 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "DistanceFieldCpu.h"
+
+#include <Corrade/Cpu.h>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Implementation/parallel.h"
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Packing.h"
+
+#ifdef CORRADE_ENABLE_SSE2
+#include <Corrade/Utility/IntrinsicsSse2.h>
+#endif
+#ifdef CORRADE_ENABLE_NEON
+#include <arm_neon.h>
+#endif
+
+namespace Magnum { namespace TextureTools {
+
+namespace {
+
+/* Kernels for the vertical sweep over a contiguous range of input pixels in
+   a single row. The `white` and `black` arrays contain, for each column, the
+   count of rows since the last white and black pixel, respectively. A white
+   pixel resets the `white` counter to zero and increments the `black` counter,
+   a black pixel vice versa. The counters saturate at `max`, which is the
+   radius -- anything further than that gets clamped in the end anyway. The
+   variant is picked at runtime based on CPU features, the scalar variant is
+   used for the remaining pixels that don't fill a whole vector. */
+typedef void(*SweepKernel)(const UnsignedByte*, UnsignedShort*, UnsignedShort*, UnsignedShort, std::size_t);
+
+void sweepScalar(const UnsignedByte* const pixels, UnsignedShort* const white, UnsignedShort* const black, const UnsignedShort max, const std::size_t count) {
+    for(std::size_t i = 0; i != count; ++i) {
+        const bool isWhite = pixels[i] >= 128;
+        const UnsignedShort nextWhite = Math::min(UnsignedShort(white[i] + 1), max);
+        const UnsignedShort nextBlack = Math::min(UnsignedShort(black[i] + 1), max);
+        white[i] = isWhite ? 0 : nextWhite;
+        black[i] = isWhite ? nextBlack : 0;
+    }
+}
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_ENABLE_SSE2 void sweepSse2(const UnsignedByte* const pixels, UnsignedShort* const white, UnsignedShort* const black, const UnsignedShort max, const std::size_t count) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi16(1);
+    /* The max is at most 32767, so a signed min is fine here. There's no
+       unsigned 16-bit min in SSE2, and the increment has to saturate as well,
+       otherwise a counter equal to 32767 would wrap around to a negative
+       value and pass through the min. */
+    const __m128i max8 = _mm_set1_epi16(max);
+    std::size_t i = 0;
+    for(; i + 16 <= count; i += 16) {
+        /* Pixels with a value of 128 and more have the highest bit set, so
+           a signed comparison with zero gives a mask of white pixels, which
+           is then widened to 16 bits */
+        const __m128i mask = _mm_cmplt_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + i)), zero);
+        const __m128i masks[]{
+            _mm_unpacklo_epi8(mask, mask),
+            _mm_unpackhi_epi8(mask, mask)
+        };
+        for(std::size_t j = 0; j != 2; ++j) {
+            __m128i* const whiteJ = reinterpret_cast<__m128i*>(white + i + j*8);
+            __m128i* const blackJ = reinterpret_cast<__m128i*>(black + i + j*8);
+            _mm_storeu_si128(whiteJ, _mm_andnot_si128(masks[j], _mm_min_epi16(_mm_adds_epi16(_mm_loadu_si128(whiteJ), one), max8)));
+            _mm_storeu_si128(blackJ, _mm_and_si128(masks[j], _mm_min_epi16(_mm_adds_epi16(_mm_loadu_si128(blackJ), one), max8)));
+        }
+    }
+    sweepScalar(pixels + i, white + i, black + i, max, count - i);
+}
+#endif
+
+#ifdef CORRADE_ENABLE_NEON
+CORRADE_ENABLE_NEON void sweepNeon(const UnsignedByte* const pixels, UnsignedShort* const white, UnsignedShort* const black, const UnsignedShort max, const std::size_t count) {
+    const uint8x16_t threshold = vdupq_n_u8(128);
+    const uint16x8_t one = vdupq_n_u16(1);
+    const uint16x8_t max8 = vdupq_n_u16(max);
+    std::size_t i = 0;
+    for(; i + 16 <= count; i += 16) {
+        /* Sign-extending the 8-bit mask to widen it to 16 bits */
+        const int8x16_t mask = vreinterpretq_s8_u8(vcgeq_u8(vld1q_u8(pixels + i), threshold));
+        const uint16x8_t masks[]{
+            vreinterpretq_u16_s16(vmovl_s8(vget_low_s8(mask))),
+            vreinterpretq_u16_s16(vmovl_s8(vget_high_s8(mask)))
+        };
+        for(std::size_t j = 0; j != 2; ++j) {
+            UnsignedShort* const whiteJ = white + i + j*8;
+            UnsignedShort* const blackJ = black + i + j*8;
+            vst1q_u16(whiteJ, vbicq_u16(vminq_u16(vaddq_u16(vld1q_u16(whiteJ), one), max8), masks[j]));
+            vst1q_u16(blackJ, vandq_u16(vminq_u16(vaddq_u16(vld1q_u16(blackJ), one), max8), masks[j]));
+        }
+    }
+    sweepScalar(pixels + i, white + i, black + i, max, count - i);
+}
+#endif
+
+SweepKernel sweepKernel() {
+    const Cpu::Features features = Cpu::runtimeFeatures();
+    #ifdef CORRADE_ENABLE_SSE2
+    if(features & Cpu::Sse2) return sweepSse2;
+    #endif
+    #ifdef CORRADE_ENABLE_NEON
+    if(features & Cpu::Neon) return sweepNeon;
+    #endif
+    static_cast<void>(features);
+    return sweepScalar;
+}
+
+/* Calculates a lower envelope of parabolas `(x - q)² + f[q]`, putting
+   positions of their vertices into `vertices` and boundaries between them
+   into `boundaries`, which is expected to be one item larger. Algorithm 1 from
+   Felzenszwalb & Huttenlocher, see the function docs for a reference. */
+void lowerEnvelope(const Containers::ArrayView<const Float> f, const Containers::ArrayView<Int> vertices, const Containers::ArrayView<Float> boundaries) {
+    CORRADE_INTERNAL_DEBUG_ASSERT(vertices.size() == f.size() && boundaries.size() == f.size() + 1);
+
+    /* Horizontal position of an intersection of parabolas with vertices at `q`
+       and `v`, rearranged to avoid squaring the (potentially large)
+       coordinates and losing precision */
+    const auto intersection = [&f](const Int q, const Int v) {
+        return (f[q] - f[v])/Float(2*(q - v)) + Float(q + v)*0.5f;
+    };
+
+    std::size_t k = 0;
+    vertices[0] = 0;
+    boundaries[0] = -Constants::inf();
+    boundaries[1] = Constants::inf();
+    for(Int q = 1, max = Int(f.size()); q != max; ++q) {
+        Float s = intersection(q, vertices[k]);
+        /* The first boundary is -inf, so this always stops at k = 0 */
+        while(s <= boundaries[k])
+            s = intersection(q, vertices[--k]);
+        ++k;
+        vertices[k] = q;
+        boundaries[k] = s;
+        boundaries[k + 1] = Constants::inf();
+    }
+}
+
+}
+
+void distanceFieldInto(const ImageView2D& input, const MutableImageView2D& output, const UnsignedInt radius, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(input.format() == PixelFormat::R8Unorm,
+        "TextureTools::distanceFieldInto(): expected input to be" << PixelFormat::R8Unorm << "but got" << input.format(), );
+    CORRADE_ASSERT(output.format() == PixelFormat::R8Unorm || output.format() == PixelFormat::R32F,
+        "TextureTools::distanceFieldInto(): expected output to be" << PixelFormat::R8Unorm << "or" << PixelFormat::R32F << "but got" << output.format(), );
+    CORRADE_ASSERT(output.size().min() > 0 &&
+                   input.size() % output.size() == Vector2i{0} &&
+                   (input.size()/output.size()) % 2 == Vector2i{0},
+        "TextureTools::distanceFieldInto(): expected input and output size ratio to be a multiple of 2, got" << Debug::packed << input.size() << "and" << Debug::packed << output.size(), );
+    CORRADE_ASSERT(radius && radius < 32768,
+        "TextureTools::distanceFieldInto(): expected radius to be between 1 and 32767, got" << radius, );
+
+    const Containers::StridedArrayView2D<const UnsignedByte> pixels = input.pixels<UnsignedByte>();
+    const std::size_t inputHeight = input.size().y();
+    const std::size_t width = input.size().x();
+    const std::size_t outputHeight = output.size().y();
+    const std::size_t outputWidth = output.size().x();
+    const Vector2i ratio = input.size()/output.size();
+    const UnsignedShort max = radius;
+    /* Distances are clamped to radius + 0.5, same as in the shader */
+    const Float maxDistance = Float(radius) + 0.5f;
+    const Float maxDistanceSquared = maxDistance*maxDistance;
+
+    /* For each output row and each input column, distance to the nearest white
+       and black pixel in given column from the output pixel centers, which
+       are always between two input rows. Stored as a count of whole pixels,
+       the actual distance is half a pixel more. Plus two rows of counters for
+       the sweeps. */
+    Containers::Array<UnsignedShort> data{NoInit, 2*width*(outputHeight + 1)};
+    const Containers::ArrayView<UnsignedShort> whiteCounters = data.prefix(width);
+    const Containers::ArrayView<UnsignedShort> blackCounters = data.sliceSize(width, width);
+    const Containers::StridedArrayView2D<UnsignedShort> whiteDistances{data.sliceSize(2*width, width*outputHeight), {outputHeight, width}};
+    const Containers::StridedArrayView2D<UnsignedShort> blackDistances{data.exceptPrefix(2*width + width*outputHeight), {outputHeight, width}};
+
+    /* First pass, split among threads by columns. Picking the kernel just
+       once. */
+    static const SweepKernel kernel = sweepKernel();
+    constexpr std::size_t ColumnBlockSize = 64;
+    Magnum::Implementation::parallelFor((width + ColumnBlockSize - 1)/ColumnBlockSize, threadCount, [&](const std::size_t begin, const std::size_t end, UnsignedInt) {
+        const std::size_t columnBegin = begin*ColumnBlockSize;
+        const std::size_t columnCount = Math::min(end*ColumnBlockSize, width) - columnBegin;
+        const Containers::ArrayView<UnsignedShort> white = whiteCounters.sliceSize(columnBegin, columnCount);
+        const Containers::ArrayView<UnsignedShort> black = blackCounters.sliceSize(columnBegin, columnCount);
+
+        /* Top to bottom. There's no white pixel above the first row, and
+           pixels outside of the image are treated as black. The output pixel
+           center is between the input rows `ratio/2 - 1` and `ratio/2`, take
+           the counters right after the former. */
+        for(UnsignedShort& i: white) i = max;
+        for(UnsignedShort& i: black) i = 0;
+        for(std::size_t y = 0, outputY = 0; outputY != outputHeight; ++outputY) {
+            for(const std::size_t rowEnd = outputY*ratio.y() + ratio.y()/2; y != rowEnd; ++y)
+                kernel(&pixels[y][columnBegin], white.data(), black.data(), max, columnCount);
+            Utility::copy(white, whiteDistances[outputY].sliceSize(columnBegin, columnCount));
+            Utility::copy(black, blackDistances[outputY].sliceSize(columnBegin, columnCount));
+        }
+
+        /* Bottom to top, taking the counters right after the latter row and
+           picking the nearer of the two */
+        for(UnsignedShort& i: white) i = max;
+        for(UnsignedShort& i: black) i = 0;
+        for(std::size_t y = inputHeight, outputY = outputHeight; outputY != 0; --outputY) {
+            for(const std::size_t rowEnd = (outputY - 1)*ratio.y() + ratio.y()/2; y != rowEnd; --y)
+                kernel(&pixels[y - 1][columnBegin], white.data(), black.data(), max, columnCount);
+            const Containers::StridedArrayView1D<UnsignedShort> whiteOut = whiteDistances[outputY - 1].sliceSize(columnBegin, columnCount);
+            const Containers::StridedArrayView1D<UnsignedShort> blackOut = blackDistances[outputY - 1].sliceSize(columnBegin, columnCount);
+            for(std::size_t i = 0; i != columnCount; ++i) {
+                whiteOut[i] = Math::min(whiteOut[i], white[i]);
+                blackOut[i] = Math::min(blackOut[i], black[i]);
+            }
+        }
+    });
+
+    /* Second pass, split among threads by output rows. Each thread needs a
+       scratch space for the parabola envelopes, which include also one
+       virtual black column on each side of the image. */
+    const std::size_t envelopeSize = width + 2;
+    const UnsignedInt rowThreadCount = Magnum::Implementation::parallelThreadCount(threadCount, outputHeight);
+    Containers::Array<Float> floatScratch{NoInit, rowThreadCount*(2*envelopeSize + 2*(envelopeSize + 1) + outputWidth)};
+    Containers::Array<Int> intScratch{NoInit, rowThreadCount*2*envelopeSize};
+    Magnum::Implementation::parallelFor(outputHeight, threadCount, [&](const std::size_t begin, const std::size_t end, const UnsignedInt thread) {
+        const Containers::ArrayView<Float> floats = floatScratch.sliceSize(thread*(floatScratch.size()/rowThreadCount), floatScratch.size()/rowThreadCount);
+        const Containers::ArrayView<Int> ints = intScratch.sliceSize(thread*2*envelopeSize, 2*envelopeSize);
+        const Containers::ArrayView<Float> whiteF = floats.prefix(envelopeSize);
+        const Containers::ArrayView<Float> blackF = floats.sliceSize(envelopeSize, envelopeSize);
+        const Containers::ArrayView<Float> whiteBoundaries = floats.sliceSize(2*envelopeSize, envelopeSize + 1);
+        const Containers::ArrayView<Float> blackBoundaries = floats.sliceSize(3*envelopeSize + 1, envelopeSize + 1);
+        const Containers::ArrayView<Float> values = floats.exceptPrefix(4*envelopeSize + 2);
+        const Containers::ArrayView<Int> whiteVertices = ints.prefix(envelopeSize);
+        const Containers::ArrayView<Int> blackVertices = ints.exceptPrefix(envelopeSize);
+
+        for(std::size_t outputY = begin; outputY != end; ++outputY) {
+            /* The virtual columns have no white pixels and black pixels at
+               half a pixel vertical distance from the output pixel center */
+            whiteF[0] = whiteF[envelopeSize - 1] = maxDistanceSquared;
+            blackF[0] = blackF[envelopeSize - 1] = 0.25f;
+            for(std::size_t x = 0; x != width; ++x) {
+                const Float white = Float(whiteDistances[outputY][x]) + 0.5f;
+                const Float black = Float(blackDistances[outputY][x]) + 0.5f;
+                whiteF[x + 1] = white*white;
+                blackF[x + 1] = black*black;
+            }
+            lowerEnvelope(whiteF, whiteVertices, whiteBoundaries);
+            lowerEnvelope(blackF, blackVertices, blackBoundaries);
+
+            /* Position of the bottom left of the four input pixels around the
+               output pixel center, and the center itself, shifted by one
+               because of the virtual column */
+            const std::size_t y = outputY*ratio.y() + ratio.y()/2 - 1;
+            std::size_t whiteK = 0, blackK = 0;
+            for(std::size_t outputX = 0; outputX != outputWidth; ++outputX) {
+                const std::size_t x = outputX*ratio.x() + ratio.x()/2 - 1;
+                const Float center = Float(x) + 1.5f;
+
+                /* Advance the envelopes even if the value isn't needed for
+                   this pixel, to keep the lookup linear */
+                while(whiteBoundaries[whiteK + 1] < center) ++whiteK;
+                while(blackBoundaries[blackK + 1] < center) ++blackK;
+
+                /* Same cases as in the shader, see its source for a detailed
+                   explanation */
+                const bool i = pixels[y][x] >= 128;
+                const bool j = pixels[y][x + 1] >= 128;
+                const bool k = pixels[y + 1][x] >= 128;
+                const bool l = pixels[y + 1][x + 1] >= 128;
+
+                Float minDistance;
+                bool isInside;
+                const Int sum = Int(i) + Int(j) + Int(k) + Int(l);
+                if(sum == 3) {
+                    isInside = false;
+                    minDistance = 0.0f;
+                } else if(sum == 2) {
+                    isInside = false;
+                    if((i && l) || (j && k))
+                        minDistance = 0.0f;
+                    else
+                        minDistance = 0.5f;
+                } else if(sum == 1) {
+                    isInside = false;
+                    minDistance = 0.7071067811865475f;
+                } else {
+                    isInside = sum == 4;
+                    const Containers::ArrayView<Float>& f = isInside ? blackF : whiteF;
+                    const Int vertex = isInside ? blackVertices[blackK] : whiteVertices[whiteK];
+                    const Float distanceSquared = (center - Float(vertex))*(center - Float(vertex)) + f[vertex];
+                    minDistance = Math::sqrt(Math::min(distanceSquared, maxDistanceSquared));
+                }
+
+                values[outputX] = (isInside ? 0.5f : -0.5f)*minDistance/maxDistance + 0.5f;
+            }
+
+            if(output.format() == PixelFormat::R8Unorm) {
+                const Containers::StridedArrayView1D<UnsignedByte> row = output.pixels<UnsignedByte>()[outputY];
+                for(std::size_t outputX = 0; outputX != outputWidth; ++outputX)
+                    row[outputX] = Math::pack<UnsignedByte>(values[outputX]);
+            } else Utility::copy(values, output.pixels<Float>()[outputY]);
+        }
+    });
+}
+
+}}
@@ -0,0 +1,97 @@
+#ifndef Magnum_TextureTools_DistanceFieldCpu_h
+#define Magnum_TextureTools_DistanceFieldCpu_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::TextureTools::distanceFieldInto()
+ * @m_since_latest
+ */
+
+#include "Magnum/Magnum.h"
+#include "Magnum/TextureTools/visibility.h"
+
+namespace Magnum { namespace TextureTools {
+
+/**
+@brief Create a signed distance field on the CPU
+@param[in] input        Input image
+@param[out] output      Output image
+@param[in] radius       Max lookup radius in the input image
+@param[in] threadCount  Number of threads to use. If @cpp 1 @ce, the operation
+    is done serially on the calling thread, @cpp 0 @ce means all hardware
+    threads.
+@m_since_latest
+
+A CPU counterpart to @ref DistanceFieldGL, usable in environments where no GPU
+or OpenGL context is available. Converts a binary black/white @p input image to
+a signed distance field stored in @p output. The @p input is expected to be
+@ref PixelFormat::R8Unorm, with pixel values of @cpp 128 @ce and larger
+treated as white. The @p output is expected to be either
+@ref PixelFormat::R8Unorm or @ref PixelFormat::R32F. Same as with
+@ref DistanceFieldGL, the ratio of the @p input and @p output size is expected
+to be a multiple of 2. To fill just a sub-rectangle of a larger image, such as
+a glyph cache texture, pass a view with @ref PixelStorage::setSkip() and
+@ref PixelStorage::setRowLength() set accordingly.
+
+The output is equivalent to what @ref DistanceFieldGL produces for the same
+@p radius, including the handling of pixels directly on the edge, see
+@ref TextureTools-DistanceFieldGL-algorithm for details. Pixels outside of
+@p input are treated as black, i.e. white areas touching the image edge get a
+falloff towards the edge. For @ref PixelFormat::R8Unorm output the results may
+differ by one from the GPU implementation due to different precision of the
+calculation and rounding. Example usage:
+
+@snippet TextureTools.cpp distanceFieldInto
+
+@section TextureTools-distanceFieldInto-algorithm The algorithm
+
+Instead of searching the whole @p radius neighborhood for each output pixel
+like the shader does, the function calculates an exact Euclidean distance
+transform in two separable passes. The first pass sweeps the input rows from
+top to bottom and back, tracking for each column the distance to the nearest
+white and black pixel above and below each output pixel center. The sweeps
+operate on whole rows at once and are vectorized with SSE2 or NEON, if
+available. The second pass calculates for each output row a lower envelope of
+parabolas formed by the per-column vertical distances, as described in
+*Pedro F. Felzenszwalb, Daniel P. Huttenlocher --- Distance Transforms of
+Sampled Functions, Theory of Computing 8, 2012,
+https://cs.brown.edu/people/pfelzens/papers/dt-final.pdf*, and samples it at
+output pixel centers. The complexity is thus linear in the input size,
+independent of @p radius.
+
+@section TextureTools-distanceFieldInto-multithreading Multithreaded operation
+
+If @p threadCount is not @cpp 1 @ce, the first pass is split among given number
+of threads by input columns and the second pass by output rows. The output is
+exactly the same as with the serial operation, regardless of the thread count.
+See @ref features-multithreading for more information.
+*/
+MAGNUM_TEXTURETOOLS_EXPORT void distanceFieldInto(const ImageView2D& input, const MutableImageView2D& output, UnsignedInt radius, UnsignedInt threadCount = 1);
+
+}}
+
+#endif
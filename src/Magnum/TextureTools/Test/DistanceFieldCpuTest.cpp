@@ -0,0 +1,361 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/PluginManager/Manager.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/String.h>
+#include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/Path.h>
+
+#ifdef CORRADE_TARGET_APPLE
+#include <Corrade/Utility/System.h> /* isSandboxed() */
+#endif
+
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/DebugTools/CompareImage.h"
+#include "Magnum/Math/Packing.h"
+#include "Magnum/Math/Vector2.h"
+#include "Magnum/TextureTools/DistanceFieldCpu.h"
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/ImageData.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace TextureTools { namespace Test { namespace {
+
+struct DistanceFieldCpuTest: TestSuite::Tester {
+    explicit DistanceFieldCpuTest();
+
+    void run();
+    void runFloat();
+    void uniform();
+    void radiusMax();
+    void threads();
+
+    void invalidFormat();
+    void sizeRatioNotMultipleOfTwo();
+    void invalidRadius();
+
+    private:
+        PluginManager::Manager<Trade::AbstractImporter> _manager{"nonexistent"};
+        Containers::String _testDir;
+};
+
+const struct {
+    const char* name;
+    Vector2i size;
+    Vector2i offset;
+    bool flipX, flipY;
+    UnsignedInt threadCount;
+} RunData[]{
+    {"", {64, 64}, {}, false, false, 1},
+    {"flipped on X", {64, 64}, {}, true, false, 1},
+    {"flipped on Y", {64, 64}, {}, false, true, 1},
+    {"with offset", {128, 96}, {64, 32}, false, false, 1},
+    {"three threads", {64, 64}, {}, false, false, 3},
+    {"all hardware threads", {64, 64}, {}, false, false, 0},
+};
+
+const struct {
+    const char* name;
+    UnsignedByte value;
+    Float expected[4];
+} UniformData[]{
+    /* Nearest white pixel is further than the radius everywhere */
+    {"black", 0, {0.0f, 0.0f, 0.0f, 0.0f}},
+    /* The pixels outside are treated as black, so all output pixel centers
+       are 2.5 pixels away horizontally and 0.5 pixels vertically (or vice
+       versa) from the nearest black pixel, i.e. sqrt(6.5) */
+    {"white", 255, {0.7832789f, 0.7832789f, 0.7832789f, 0.7832789f}},
+};
+
+const struct {
+    const char* name;
+    UnsignedInt threadCount;
+} ThreadsData[]{
+    {"two threads", 2},
+    {"five threads", 5},
+    {"all hardware threads", 0},
+};
+
+DistanceFieldCpuTest::DistanceFieldCpuTest() {
+    addInstancedTests({&DistanceFieldCpuTest::run},
+        Containers::arraySize(RunData));
+
+    addTests({&DistanceFieldCpuTest::runFloat});
+
+    addInstancedTests({&DistanceFieldCpuTest::uniform},
+        Containers::arraySize(UniformData));
+
+    addTests({&DistanceFieldCpuTest::radiusMax});
+
+    addInstancedTests({&DistanceFieldCpuTest::threads},
+        Containers::arraySize(ThreadsData));
+
+    addTests({&DistanceFieldCpuTest::invalidFormat,
+              &DistanceFieldCpuTest::sizeRatioNotMultipleOfTwo,
+              &DistanceFieldCpuTest::invalidRadius});
+
+    /* Load the plugin directly from the build tree. Otherwise it's either
+       static and already loaded or not present in the build tree */
+    #ifdef ANYIMAGEIMPORTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_manager.load(ANYIMAGEIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+    #ifdef TGAIMPORTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_manager.load(TGAIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+
+    /* Using the same files as DistanceFieldGLTest, as the output is expected
+       to be the same */
+    #ifdef CORRADE_TARGET_APPLE
+    if(Utility::System::isSandboxed()
+        #if defined(CORRADE_TARGET_IOS) && defined(CORRADE_TESTSUITE_TARGET_XCTEST)
+        /** @todo Fix this once I persuade CMake to run XCTest tests properly */
+        && std::getenv("SIMULATOR_UDID")
+        #endif
+    ) {
+        _testDir = Utility::Path::join(Utility::Path::path(*Utility::Path::executableLocation()), "DistanceFieldGLTestFiles");
+    } else
+    #endif
+    {
+        _testDir = Utility::Path::join(TEXTURETOOLS_TEST_DIR, "DistanceFieldGLTestFiles");
+    }
+}
+
+void DistanceFieldCpuTest::run() {
+    auto&& data = RunData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<Trade::AbstractImporter> importer;
+    if(!(importer = _manager.loadAndInstantiate("TgaImporter")))
+        CORRADE_SKIP("TgaImporter plugin not found.");
+
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(_testDir, "input.tga")));
+    CORRADE_COMPARE(importer->image2DCount(), 1);
+    Containers::Optional<Trade::ImageData2D> inputImage = importer->image2D(0);
+    CORRADE_VERIFY(inputImage);
+    CORRADE_COMPARE(inputImage->format(), PixelFormat::R8Unorm);
+
+    /* Flip the input if desired */
+    if(data.flipX)
+        Utility::flipInPlace<1>(inputImage->mutablePixels());
+    if(data.flipY)
+        Utility::flipInPlace<0>(inputImage->mutablePixels());
+
+    /* Fill the output with some data to verify they don't affect the output
+       and aren't accidentally overwritten when running on just a
+       subrectangle */
+    Containers::Array<char> outputData{DirectInit, std::size_t(data.size.product()), '\x66'};
+    MutableImageView2D output{
+        PixelStorage{}
+            .setAlignment(1)
+            .setRowLength(data.size.x())
+            .setSkip({data.offset, 0}),
+        PixelFormat::R8Unorm, Vector2i{64}, outputData};
+
+    distanceFieldInto(*inputImage, output, 32, data.threadCount);
+
+    /* Verify that the other data weren't overwritten if processing just a
+       subrange -- it should still have the original data kept */
+    if(data.offset.product())
+        CORRADE_COMPARE(outputData[0], '\x66');
+
+    if(!(_manager.loadState("AnyImageImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("AnyImageImporter plugin not found.");
+
+    /* Flip the output back */
+    Containers::StridedArrayView2D<UnsignedByte> pixels = output.pixels<UnsignedByte>();
+    if(data.flipX)
+        Utility::flipInPlace<1>(pixels);
+    if(data.flipY)
+        Utility::flipInPlace<0>(pixels);
+
+    CORRADE_COMPARE_WITH(
+        pixels,
+        Utility::Path::join(_testDir, "output.tga"),
+        /* The ground truth is generated by the GPU implementation, the output
+           differs by one in about 30 pixels out of the total 4k due to
+           different calculation precision */
+        (DebugTools::CompareImageToFile{_manager, 1.0f, 0.01f}));
+}
+
+void DistanceFieldCpuTest::runFloat() {
+    /* A circle in the middle of the image */
+    UnsignedByte inputData[64*64];
+    for(std::size_t y = 0; y != 64; ++y)
+        for(std::size_t x = 0; x != 64; ++x)
+            inputData[y*64 + x] = (Vector2{Float(x), Float(y)} - Vector2{31.5f}).dot() < 20.0f*20.0f ? 255 : 0;
+    const ImageView2D input{PixelFormat::R8Unorm, {64, 64}, inputData};
+
+    UnsignedByte output8Data[16*16];
+    Float output32Data[16*16];
+    distanceFieldInto(input, MutableImageView2D{PixelFormat::R8Unorm, {16, 16}, output8Data}, 8);
+    distanceFieldInto(input, MutableImageView2D{PixelFormat::R32F, {16, 16}, output32Data}, 8);
+
+    /* The pixel in the center is inside, further than the radius from the
+       edge, in the corner outside further than the radius */
+    CORRADE_COMPARE(output32Data[8*16 + 8], 1.0f);
+    CORRADE_COMPARE(output32Data[0], 0.0f);
+
+    /* The 8-bit output should be the same as the packed float output */
+    UnsignedByte expected[16*16];
+    for(std::size_t i = 0; i != 16*16; ++i)
+        expected[i] = Math::pack<UnsignedByte>(output32Data[i]);
+    CORRADE_COMPARE_AS(Containers::arrayView(output8Data),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void DistanceFieldCpuTest::uniform() {
+    auto&& data = UniformData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    UnsignedByte inputData[8*8];
+    for(UnsignedByte& i: inputData) i = data.value;
+
+    Float outputData[4]{};
+    distanceFieldInto(
+        ImageView2D{PixelFormat::R8Unorm, {8, 8}, inputData},
+        MutableImageView2D{PixelFormat::R32F, {2, 2}, outputData}, 4);
+    CORRADE_COMPARE_AS(Containers::arrayView(outputData),
+        Containers::arrayView(data.expected),
+        TestSuite::Compare::Container);
+}
+
+void DistanceFieldCpuTest::radiusMax() {
+    /* With the largest radius, the white counters start at 32767 and get
+       incremented on each black row. If they wouldn't saturate, they'd wrap
+       around to zero after 32769 rows and the output would suddenly get
+       close to a white pixel. The width is large enough to go through the
+       vectorized code. */
+    const Vector2i size{16, 65540};
+    Containers::Array<UnsignedByte> inputData{ValueInit, std::size_t(size.product())};
+    Containers::Array<Float> outputData{ValueInit, std::size_t((size/2).product())};
+    distanceFieldInto(
+        ImageView2D{PixelFormat::R8Unorm, size, inputData},
+        MutableImageView2D{PixelFormat::R32F, size/2, outputData}, 32767);
+
+    /* Nearest white pixel is further than the radius everywhere */
+    CORRADE_COMPARE_AS(outputData,
+        Containers::Array<Float>{ValueInit, outputData.size()},
+        TestSuite::Compare::Container);
+}
+
+void DistanceFieldCpuTest::threads() {
+    auto&& data = ThreadsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* A bunch of rings with a non-power-of-two size to test also uneven
+       splits among threads and the scalar fallback in the vectorized code */
+    const Vector2i size{150, 210};
+    Containers::Array<UnsignedByte> inputData{NoInit, std::size_t(size.product())};
+    for(Int y = 0; y != size.y(); ++y)
+        for(Int x = 0; x != size.x(); ++x)
+            inputData[y*size.x() + x] = Int((Vector2{Float(x), Float(y)} - Vector2{size}*0.4f).length()) / 12 % 2 ? 255 : 0;
+    const ImageView2D input{PixelFormat::R8Unorm, size, inputData};
+
+    Float expectedData[75*35];
+    Float actualData[75*35];
+    distanceFieldInto(input, MutableImageView2D{PixelFormat::R32F, {75, 35}, expectedData}, 10, 1);
+    distanceFieldInto(input, MutableImageView2D{PixelFormat::R32F, {75, 35}, actualData}, 10, data.threadCount);
+
+    /* The output should be bit-exact */
+    CORRADE_COMPARE_AS(Containers::arrayView(actualData),
+        Containers::arrayView(expectedData),
+        TestSuite::Compare::Container);
+}
+
+void DistanceFieldCpuTest::invalidFormat() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const char data[64*64*4]{};
+    char outputData[16*16*4];
+
+    Containers::String out;
+    Error redirectError{&out};
+    distanceFieldInto(ImageView2D{PixelFormat::RGBA8Unorm, {64, 64}, data}, MutableImageView2D{PixelFormat::R8Unorm, {16, 16}, outputData}, 4);
+    distanceFieldInto(ImageView2D{PixelFormat::R8Unorm, {64, 64}, data}, MutableImageView2D{PixelFormat::RG8Unorm, {16, 16}, outputData}, 4);
+    CORRADE_COMPARE_AS(out,
+        "TextureTools::distanceFieldInto(): expected input to be PixelFormat::R8Unorm but got PixelFormat::RGBA8Unorm\n"
+        "TextureTools::distanceFieldInto(): expected output to be PixelFormat::R8Unorm or PixelFormat::R32F but got PixelFormat::RG8Unorm\n",
+        TestSuite::Compare::String);
+}
+
+void DistanceFieldCpuTest::sizeRatioNotMultipleOfTwo() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const char data[23*14*23*14]{};
+    char outputData[46*46];
+
+    /* This should be fine */
+    distanceFieldInto(ImageView2D{PixelFormat::R8Unorm, Vector2i{23*14}, data}, MutableImageView2D{PixelFormat::R8Unorm, Vector2i{23}, outputData}, 4);
+
+    Containers::String out;
+    Error redirectError{&out};
+    distanceFieldInto(ImageView2D{PixelFormat::R8Unorm, Vector2i{23*14}, data}, MutableImageView2D{PixelFormat::R8Unorm, Vector2i{23*2}, outputData}, 4);
+    /* Verify also just one axis wrong */
+    distanceFieldInto(ImageView2D{PixelFormat::R8Unorm, Vector2i{23*14}, data}, MutableImageView2D{PixelFormat::R8Unorm, {23*2, 23}, outputData}, 4);
+    distanceFieldInto(ImageView2D{PixelFormat::R8Unorm, Vector2i{23*14}, data}, MutableImageView2D{PixelFormat::R8Unorm, {23, 23*2}, outputData}, 4);
+    /* Almost correct except that it's not an integer multiply */
+    distanceFieldInto(ImageView2D{PixelFormat::R8Unorm, Vector2i{23*14}, data}, MutableImageView2D{PixelFormat::R8Unorm, {22, 23}, outputData}, 4);
+    distanceFieldInto(ImageView2D{PixelFormat::R8Unorm, Vector2i{23*14}, data}, MutableImageView2D{PixelFormat::R8Unorm, {23, 22}, outputData}, 4);
+    /* Empty output */
+    distanceFieldInto(ImageView2D{PixelFormat::R8Unorm, Vector2i{23*14}, data}, MutableImageView2D{PixelFormat::R8Unorm, {23, 0}, nullptr}, 4);
+    CORRADE_COMPARE_AS(out,
+        "TextureTools::distanceFieldInto(): expected input and output size ratio to be a multiple of 2, got {322, 322} and {46, 46}\n"
+        "TextureTools::distanceFieldInto(): expected input and output size ratio to be a multiple of 2, got {322, 322} and {46, 23}\n"
+        "TextureTools::distanceFieldInto(): expected input and output size ratio to be a multiple of 2, got {322, 322} and {23, 46}\n"
+        "TextureTools::distanceFieldInto(): expected input and output size ratio to be a multiple of 2, got {322, 322} and {22, 23}\n"
+        "TextureTools::distanceFieldInto(): expected input and output size ratio to be a multiple of 2, got {322, 322} and {23, 22}\n"
+        "TextureTools::distanceFieldInto(): expected input and output size ratio to be a multiple of 2, got {322, 322} and {23, 0}\n",
+        TestSuite::Compare::String);
+}
+
+void DistanceFieldCpuTest::invalidRadius() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const char data[8*8]{};
+    char outputData[2*2];
+
+    Containers::String out;
+    Error redirectError{&out};
+    distanceFieldInto(ImageView2D{PixelFormat::R8Unorm, {8, 8}, data}, MutableImageView2D{PixelFormat::R8Unorm, {2, 2}, outputData}, 0);
+    distanceFieldInto(ImageView2D{PixelFormat::R8Unorm, {8, 8}, data}, MutableImageView2D{PixelFormat::R8Unorm, {2, 2}, outputData}, 32768);
+    CORRADE_COMPARE_AS(out,
+        "TextureTools::distanceFieldInto(): expected radius to be between 1 and 32767, got 0\n"
+        "TextureTools::distanceFieldInto(): expected radius to be between 1 and 32767, got 32768\n",
+        TestSuite::Compare::String);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::DistanceFieldCpuTest)
@@ -24,7 +24,10 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/Arguments.h>
 #include <Corrade/Utility/DebugStl.h> /** @todo remove once Arguments is std::string-free */
 #include <Corrade/Utility/Path.h>
@@ -33,12 +36,14 @@
 #include "Magnum/Image.h"
 #include "Magnum/ImageView.h"
 #include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Color.h"
 #include "Magnum/Math/ConfigurationValue.h"
 #include "Magnum/Math/Range.h"
 #include "Magnum/GL/Framebuffer.h"
 #include "Magnum/GL/Renderer.h"
 #include "Magnum/GL/Texture.h"
 #include "Magnum/GL/TextureFormat.h"
+#include "Magnum/TextureTools/DistanceFieldCpu.h"
 #include "Magnum/TextureTools/DistanceFieldGL.h"
 #include "Magnum/Trade/AbstractImporter.h"
 #include "Magnum/Trade/AbstractImageConverter.h"
@@ -96,12 +101,23 @@ This will open monochrome `logo-src.png` image using any plugin that can open
 PNG files and converts it to 256x256 distance field `logo.png` using any plugin
 that can write PNG files.
 
+On machines without a GPU, pass `--cpu` to use
+@ref TextureTools::distanceFieldInto() instead of
+@ref TextureTools::DistanceFieldGL. No GL context is created in that case and
+the conversion is done on all available CPU cores, unless limited with
+`--threads`:
+
+@code{.sh}
+magnum-distancefieldconverter logo-src.png logo.png \
+    --output-size "256 256" --radius 24 --cpu
+@endcode
+
 @section magnum-distancefieldconverter-usage Full usage documentation
 
 @code{.sh}
 magnum-distancefieldconverter [--magnum-...] [-h|--help] [--importer IMPORTER]
-    [--converter CONVERTER] [--plugin-dir DIR] --output-size "X Y" --radius N
-    [--] input output
+    [--converter CONVERTER] [--plugin-dir DIR] [--cpu] [--threads N]
+    --output-size "X Y" --radius N [--] input output
 @endcode
 
 Arguments:
@@ -114,6 +130,10 @@ Arguments:
 -   `--converter CONVERTER` --- image converter plugin (default:
     @ref Trade::AnyImageConverter "AnyImageConverter")
 -   `--plugin-dir DIR` --- override base plugin dir
+-   `--cpu` --- calculate the distance field on the CPU instead of using
+    OpenGL
+-   `--threads N` --- number of threads to use with `--cpu`, @cpp 0 @ce means
+    all hardware threads (default: @cpp 0 @ce)
 -   `--output-size "X Y"` --- size of output image
 -   `--radius N` --- distance field computation radius
 -   `--magnum-...` --- engine-specific options (see
@@ -123,7 +143,7 @@ Images with @ref PixelFormat::R8Unorm, @ref PixelFormat::RGB8Unorm or
 @ref PixelFormat::RGBA8Unorm are accepted on input.
 
 The resulting image can then be used with @ref Shaders::DistanceFieldVectorGL.
-See @ref TextureTools::DistanceField for more information about the algorithm
+See @ref TextureTools::DistanceFieldGL for more information about the algorithm
 and parameters. Size restrictions from it apply here as well, in particular the
 ratio of the source image size and and `--output-size` is expected to be a
 multiple of 2.
@@ -148,13 +168,17 @@ DistanceFieldConverter::DistanceFieldConverter(const Arguments& arguments): Plat
         #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
         .addOption("plugin-dir").setHelp("plugin-dir", "override base plugin dir", "DIR")
         #endif
+        .addBooleanOption("cpu").setHelp("cpu", "calculate the distance field on the CPU instead of using OpenGL")
+        .addOption("threads", "0").setHelp("threads", "number of threads to use with --cpu, 0 means all hardware threads", "N")
         .addNamedArgument("output-size").setHelp("output-size", "size of output image", "\"X Y\"")
         .addNamedArgument("radius").setHelp("radius", "distance field computation radius", "N")
         .addSkippedPrefix("magnum", "engine-specific options")
         .setGlobalHelp("Converts red channel of an image to distance field representation.")
         .parse(arguments.argc, arguments.argv);
 
-    createContext();
+    /* The CPU implementation doesn't need any GL context */
+    if(!args.isSet("cpu"))
+        createContext();
 }
 
 int DistanceFieldConverter::exec() {
@@ -197,6 +221,38 @@ int DistanceFieldConverter::exec() {
         return 5;
     }
 
+    /* Calculate on the CPU, if requested. Only the red channel is used, so
+       for multi-channel formats view just the first byte of each pixel. */
+    if(args.isSet("cpu")) {
+        Containers::StridedArrayView2D<const UnsignedByte> red;
+        if(image->format() == PixelFormat::R8Unorm)
+            red = image->pixels<UnsignedByte>();
+        else if(image->format() == PixelFormat::RGB8Unorm)
+            red = Containers::arrayCast<const UnsignedByte>(image->pixels<Color3ub>());
+        else if(image->format() == PixelFormat::RGBA8Unorm)
+            red = Containers::arrayCast<const UnsignedByte>(image->pixels<Color4ub>());
+        else {
+            Error() << "Unsupported image format" << image->format();
+            return 4;
+        }
+
+        /* The function needs a contiguous R8 input */
+        Image2D input{PixelStorage{}.setAlignment(1), PixelFormat::R8Unorm, image->size(), Containers::Array<char>{NoInit, std::size_t(image->size().product())}};
+        Utility::copy(red, input.pixels<UnsignedByte>());
+
+        Image2D result{PixelStorage{}.setAlignment(1), PixelFormat::R8Unorm, outputSize, Containers::Array<char>{NoInit, std::size_t(outputSize.product())}};
+
+        Debug() << "Converting image of size" << image->size() << "to distance field on the CPU...";
+        TextureTools::distanceFieldInto(input, result, args.value<UnsignedInt>("radius"), args.value<UnsignedInt>("threads"));
+
+        if(!converter->convertToFile(result, args.value("output"))) {
+            Error() << "Cannot save file" << args.value("output");
+            return 5;
+        }
+
+        return 0;
+    }
+
     /* Decide about internal format */
     /** @todo this doesn't work on ES2, the image pixel format is converted to
         a LUMINANCE which doesn't match GL_RED / GL_R8; it also doesn't check
@@ -29,6 +29,7 @@
 #include <string> /** @todo remove once file callbacks are <string>-free */
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/EnumSet.hpp>
+#include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/Containers/StringStl.h> /** @todo remove once file callbacks are <string>-free */
@@ -114,17 +115,39 @@ AbstractImporter::AbstractImporter(PluginManager::Manager<AbstractImporter>& man
 
 AbstractImporter::AbstractImporter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin): PluginManager::AbstractManagingPlugin<AbstractImporter>{manager, plugin} {}
 
-#ifdef MAGNUM_BUILD_DEPRECATED
-/* These twp needed because of the Array<CachedScenes> member */
+struct AbstractImporter::MappedFiles {
+    struct File {
+        Containers::String filename;
+        #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+        Containers::Array<const char, Utility::Path::MapDeleter> data;
+        #else
+        Containers::Array<char> data;
+        #endif
+    };
+
+    Containers::Array<File> files;
+};
+
+/* These two needed because of the Pointer<MappedFiles> and
+   Pointer<CachedScenes> members */
 AbstractImporter::AbstractImporter(AbstractImporter&&) noexcept = default;
 AbstractImporter::~AbstractImporter() = default;
-#endif
 
 void AbstractImporter::setFlags(ImporterFlags flags) {
     CORRADE_ASSERT(!isOpened(),
         "Trade::AbstractImporter::setFlags(): can't be set while a file is opened", );
     _flags = flags;
     doSetFlags(flags);
+
+    /* Install the internal mapping callback if no user callback is set, or
+       remove it if the flag got cleared */
+    if((flags & ImporterFlag::MapFiles) && !_fileCallback && (features() & (ImporterFeature::FileCallback|ImporterFeature::OpenData)))
+        setMapFileCallback();
+    else if(!(flags & ImporterFlag::MapFiles) && _fileCallback == mapFileCallback && _mappedFiles && _fileCallbackUserData == _mappedFiles.get()) {
+        _fileCallback = nullptr;
+        _fileCallbackUserData = nullptr;
+        doSetFileCallback(nullptr, nullptr);
+    }
 }
 
 void AbstractImporter::doSetFlags(ImporterFlags) {}
@@ -141,6 +164,11 @@ void AbstractImporter::setFileCallback(Containers::Optional<Containers::ArrayVie
     CORRADE_ASSERT(!isOpened(), "Trade::AbstractImporter::setFileCallback(): can't be set while a file is opened", );
     CORRADE_ASSERT(features() & (ImporterFeature::FileCallback|ImporterFeature::OpenData), "Trade::AbstractImporter::setFileCallback(): importer supports neither loading from data nor via callbacks, callbacks can't be used", );
 
+    /* If the callback is reset and mapping is enabled, fall back to the
+       internal mapping callback instead */
+    if(!callback && (_flags & ImporterFlag::MapFiles))
+        return setMapFileCallback();
+
     _fileCallback = callback;
     _fileCallbackUserData = userData;
     doSetFileCallback(callback, userData);
@@ -148,6 +176,43 @@ void AbstractImporter::setFileCallback(Containers::Optional<Containers::ArrayVie
 
 void AbstractImporter::doSetFileCallback(Containers::Optional<Containers::ArrayView<const char>>(*)(const std::string&, InputFileCallbackPolicy, void*), void*) {}
 
+void AbstractImporter::setMapFileCallback() {
+    if(!_mappedFiles) _mappedFiles.emplace();
+    _fileCallback = mapFileCallback;
+    _fileCallbackUserData = _mappedFiles.get();
+    doSetFileCallback(_fileCallback, _fileCallbackUserData);
+}
+
+Containers::Optional<Containers::ArrayView<const char>> AbstractImporter::mapFileCallback(const std::string& filename, const InputFileCallbackPolicy policy, void* const userData) {
+    MappedFiles& mappedFiles = *static_cast<MappedFiles*>(userData);
+
+    /* Unmap the most recently mapped file of given name by moving the last
+       file over it. Files that aren't explicitly closed stay mapped until the
+       importer is closed. */
+    if(policy == InputFileCallbackPolicy::Close) {
+        for(std::size_t i = mappedFiles.files.size(); i != 0; --i) {
+            if(mappedFiles.files[i - 1].filename == filename) {
+                if(i != mappedFiles.files.size())
+                    mappedFiles.files[i - 1] = Utility::move(mappedFiles.files.back());
+                arrayRemoveSuffix(mappedFiles.files, 1);
+                break;
+            }
+        }
+        return {};
+    }
+
+    #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+    Containers::Optional<Containers::Array<const char, Utility::Path::MapDeleter>> data = Utility::Path::mapRead(filename);
+    #else
+    Containers::Optional<Containers::Array<char>> data = Utility::Path::read(filename);
+    #endif
+    if(!data) return {};
+
+    const Containers::ArrayView<const char> view = *data;
+    arrayAppend(mappedFiles.files, MappedFiles::File{Containers::String{filename}, *Utility::move(data)});
+    return view;
+}
+
 bool AbstractImporter::openData(Containers::ArrayView<const void> data) {
     CORRADE_ASSERT(features() & ImporterFeature::OpenData,
         "Trade::AbstractImporter::openData(): feature not supported", {});
@@ -228,6 +293,11 @@ bool AbstractImporter::openFile(const Containers::StringView filename) {
               file loading to the default implementation (callback used in the
               base doOpenFile() implementation, because this branch is never
               taken in that case) */
+        if(_fileCallback == mapFileCallback) {
+            openMappedFile(filename);
+            return isOpened();
+        }
+
         const Containers::Optional<Containers::ArrayView<const char>> data = _fileCallback(filename, InputFileCallbackPolicy::LoadTemporary, _fileCallbackUserData);
         if(!data) {
             Error() << "Trade::AbstractImporter::openFile(): cannot open file" << filename;
@@ -253,7 +323,10 @@ void AbstractImporter::doOpenFile(const Containers::StringView filename) {
 
     /* If callbacks are set, use them. This is the same implementation as in
        openFile(), see the comments there for details. */
-    if(_fileCallback) {
+    if(_fileCallback == mapFileCallback) {
+        openMappedFile(filename);
+
+    } else if(_fileCallback) {
         const Containers::Optional<Containers::ArrayView<const char>> data = _fileCallback(filename, InputFileCallbackPolicy::LoadTemporary, _fileCallbackUserData);
         if(!data) {
             Error() << "Trade::AbstractImporter::openFile(): cannot open file" << filename;
@@ -274,11 +347,29 @@ void AbstractImporter::doOpenFile(const Containers::StringView filename) {
     }
 }
 
+void AbstractImporter::openMappedFile(const Containers::StringView filename) {
+    /* The file is mapped as permanent and stays alive until the importer
+       owning the mapping is closed, so it can be passed as externally owned
+       and doesn't need to be copied. It's not necessarily this importer, the
+       callback can be also propagated from e.g. AnySceneImporter. */
+    const Containers::Optional<Containers::ArrayView<const char>> data = _fileCallback(filename, InputFileCallbackPolicy::LoadPermanent, _fileCallbackUserData);
+    if(!data) {
+        Error() << "Trade::AbstractImporter::openFile(): cannot open file" << filename;
+        return;
+    }
+
+    doOpenData(Containers::Array<char>{const_cast<char*>(data->data()), data->size(), Implementation::nonOwnedArrayDeleter}, DataFlag::ExternallyOwned);
+}
+
 void AbstractImporter::close() {
     if(isOpened()) {
         doClose();
         CORRADE_INTERNAL_ASSERT(!isOpened());
     }
+
+    /* Release all files mapped by this importer, after the implementation
+       is done with them */
+    if(_mappedFiles) _mappedFiles->files = {};
 }
 
 Int AbstractImporter::defaultScene() const {
@@ -1652,6 +1743,7 @@ Debug& operator<<(Debug& debug, const ImporterFlag value) {
         #define _c(v) case ImporterFlag::v: return debug << "::" #v;
         _c(Quiet)
         _c(Verbose)
+        _c(MapFiles)
         #undef _c
         /* LCOV_EXCL_STOP */
     }
@@ -1662,7 +1754,8 @@ Debug& operator<<(Debug& debug, const ImporterFlag value) {
 Debug& operator<<(Debug& debug, const ImporterFlags value) {
     return Containers::enumSetDebugOutput(debug, value, "Trade::ImporterFlags{}", {
         ImporterFlag::Quiet,
-        ImporterFlag::Verbose});
+        ImporterFlag::Verbose,
+        ImporterFlag::MapFiles});
 }
 
 }}
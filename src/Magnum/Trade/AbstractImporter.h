@@ -31,6 +31,7 @@
  */
 
 #include <Corrade/Containers/EnumSet.h>
+#include <Corrade/Containers/Pointer.h>
 #include <Corrade/PluginManager/AbstractManagingPlugin.h>
 #include <Corrade/Utility/StlForwardString.h> /** @todo remove once file callbacks are std::string-free */
 
@@ -116,6 +117,30 @@ enum class ImporterFlag: UnsignedByte {
      */
     Verbose = 1 << 0,
 
+    /**
+     * Memory-map files instead of reading them into memory. If set and no
+     * file callback is set with @ref AbstractImporter::setFileCallback(),
+     * the importer installs an internal callback that memory-maps the file
+     * passed to @ref AbstractImporter::openFile() as well as all external
+     * files loaded through @ref AbstractImporter::fileCallback(), such as
+     * buffers or images. The top-level file is then passed to
+     * @ref AbstractImporter::doOpenData() with
+     * @ref DataFlag::ExternallyOwned, allowing the importer to reference it
+     * without a copy.
+     *
+     * The mappings are kept until the importer is closed, another file is
+     * opened or the importer is destroyed, or until a file is closed with
+     * @ref InputFileCallbackPolicy::Close. Has an effect only on importers
+     * that support @ref ImporterFeature::OpenData or
+     * @ref ImporterFeature::FileCallback. On platforms without memory-mapping
+     * support the files are read into memory instead.
+     *
+     * Corresponds to the `--map` option in
+     * @ref magnum-sceneconverter "magnum-sceneconverter".
+     * @m_since_latest
+     */
+    MapFiles = 1 << 2,
+
     /** @todo is warning as error (like in ShaderConverter) usable for anything
         here? in case of a compiler it makes sense, in case of an importer not
         so much probably? it'd also mean expanding each and every Warning
@@ -492,10 +517,10 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
            header. */
         explicit AbstractImporter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin);
 
-        #if defined(MAGNUM_BUILD_DEPRECATED) && !defined(DOXYGEN_GENERATING_OUTPUT)
-        /* These twp needed because of the Array<CachedScenes> member
-           (AnyImageImporter relies on the move), move assignment disabled by
-           AbstractPlugin already */
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        /* These two needed because of the Pointer<MappedFiles> and
+           Pointer<CachedScenes> members (AnyImageImporter relies on the
+           move), move assignment disabled by AbstractPlugin already */
         AbstractImporter(AbstractImporter&&) noexcept;
         ~AbstractImporter();
         #endif
@@ -589,7 +614,10 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
          * @ref openData() directly.
          *
          * In case @p callback is @cpp nullptr @ce, the current callback (if
-         * any) is reset. This function expects that the importer supports
+         * any) is reset. If @ref ImporterFlag::MapFiles is set, an internal
+         * callback that memory-maps the files is used instead of no callback,
+         * and it's also what @ref fileCallback() returns in that case. This
+         * function expects that the importer supports
          * either @ref ImporterFeature::FileCallback or
          * @ref ImporterFeature::OpenData. If an importer supports neither,
          * callbacks can't be used.
@@ -2621,6 +2649,14 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
         /* GCC 4.8 complains loudly about missing initializers otherwise */
         } _fileCallbackTemplate{nullptr, nullptr};
 
+        /* Files mapped by the internal callback installed with
+           ImporterFlag::MapFiles */
+        struct MappedFiles;
+        Containers::Pointer<MappedFiles> _mappedFiles;
+        MAGNUM_TRADE_LOCAL static Containers::Optional<Containers::ArrayView<const char>> mapFileCallback(const std::string& filename, InputFileCallbackPolicy policy, void* userData);
+        MAGNUM_TRADE_LOCAL void setMapFileCallback();
+        MAGNUM_TRADE_LOCAL void openMappedFile(Containers::StringView filename);
+
         #ifdef MAGNUM_BUILD_DEPRECATED
         struct CachedScenes;
         Containers::Pointer<CachedScenes> _cachedScenes;
@@ -26,7 +26,7 @@
 
 #include "SceneData.h"
 
-#include <algorithm> /* std::lower_bound() */
+#include <algorithm> /* std::lower_bound(), std::upper_bound(), std::sort() */
 #include <Corrade/Containers/EnumSet.hpp>
 #include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
@@ -1212,11 +1212,60 @@ template<class T> std::size_t findObject(const SceneFieldFlags flags, const Cont
     return max;
 }
 
+/* Unlike findObject(), the `mapping` view isn't adjusted for `offset` as the
+   index contains offsets into the whole field. Returns the first offset
+   that's not smaller than `offset` and has `object`, or the mapping size if
+   there's no such offset. */
+template<class T> std::size_t findObjectIndexed(const Containers::StridedArrayView1D<const void>& mapping, const Containers::ArrayView<const std::size_t> index, const std::size_t offset, const UnsignedLong object) {
+    const Containers::StridedArrayView1D<const T> mappingT = Containers::arrayCast<const T>(mapping);
+
+    /* The index is sorted by object ID and then by the offset, so a
+       lower_bound() on the (object, offset) pair gives back the first
+       occurrence at or after given offset, if there's any */
+    const std::size_t* const found = std::lower_bound(index.begin(), index.end(), offset, [&](const std::size_t a, const std::size_t b) {
+        return mappingT[a] < object || (mappingT[a] == object && a < b);
+    });
+    if(found == index.end() || mappingT[*found] != object) return mapping.size();
+    return *found;
+}
+
+template<class T> void sortObjectIndex(const Containers::StridedArrayView1D<const void>& mapping, const Containers::ArrayView<std::size_t> index) {
+    const Containers::StridedArrayView1D<const T> mappingT = Containers::arrayCast<const T>(mapping);
+    for(std::size_t i = 0; i != index.size(); ++i)
+        index[i] = i;
+
+    /* Sorting by object ID and then by offset, which is what
+       findObjectIndexed() relies on */
+    std::sort(index.begin(), index.end(), [&](const std::size_t a, const std::size_t b) {
+        return mappingT[a] < mappingT[b] || (mappingT[a] == mappingT[b] && a < b);
+    });
+}
+
 }
 
 std::size_t SceneData::findFieldObjectOffsetInternal(const SceneFieldData& field, const UnsignedLong object, const std::size_t offset) const {
-    const Containers::StridedArrayView1D<const void> mapping = fieldDataMappingViewInternal(field, offset, field._size - offset);
     const SceneMappingType mappingType = field.mappingType();
+
+    /* If there's an object index for this field, use it. It's never built
+       for fields with ordered or implicit mapping, so the flags don't need
+       to be checked here. */
+    if(!_fieldObjectIndices.isEmpty()) {
+        const Containers::ArrayView<const std::size_t> index = _fieldObjectIndices[&field - _fields.data()];
+        if(!index.isEmpty()) {
+            const Containers::StridedArrayView1D<const void> mapping = fieldDataMappingViewInternal(field);
+            if(mappingType == SceneMappingType::UnsignedInt)
+                return findObjectIndexed<UnsignedInt>(mapping, index, offset, object);
+            else if(mappingType == SceneMappingType::UnsignedShort)
+                return findObjectIndexed<UnsignedShort>(mapping, index, offset, object);
+            else if(mappingType == SceneMappingType::UnsignedByte)
+                return findObjectIndexed<UnsignedByte>(mapping, index, offset, object);
+            else if(mappingType == SceneMappingType::UnsignedLong)
+                return findObjectIndexed<UnsignedLong>(mapping, index, offset, object);
+            else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+        }
+    }
+
+    const Containers::StridedArrayView1D<const void> mapping = fieldDataMappingViewInternal(field, offset, field._size - offset);
     if(mappingType == SceneMappingType::UnsignedInt)
         return offset + findObject<UnsignedInt>(field._flags, mapping, offset, object);
     else if(mappingType == SceneMappingType::UnsignedShort)
@@ -1314,6 +1363,90 @@ bool SceneData::hasFieldObject(const SceneField fieldName, const UnsignedLong ob
     return findFieldObjectOffsetInternal(field, object, 0) != field._size;
 }
 
+void SceneData::buildFieldObjectIndexInternal(const UnsignedInt fieldId) {
+    const SceneFieldData& field = _fields[fieldId];
+
+    /* For the parent field, build also a permutation of offsets sorted by
+       the parent and then by the offset, used by childrenFor(). The children
+       lookup goes by the field data, so it's needed regardless of whether
+       the mapping is ordered. */
+    if(field._name == SceneField::Parent && field._size) {
+        Containers::Array<Int> parents{NoInit, std::size_t(field._size)};
+        parentsIntoInternal(fieldId, 0, parents);
+
+        Containers::Array<std::size_t> index{NoInit, std::size_t(field._size)};
+        for(std::size_t i = 0; i != index.size(); ++i)
+            index[i] = i;
+        std::sort(index.begin(), index.end(), [&](const std::size_t a, const std::size_t b) {
+            return parents[a] < parents[b] || (parents[a] == parents[b] && a < b);
+        });
+
+        _childrenIndex = Utility::move(index);
+    }
+
+    /* Fields with implicit or ordered mapping don't need any index.
+       ImplicitMapping is a superset of OrderedMapping so this checks both. */
+    if(field._flags >= SceneFieldFlag::OrderedMapping || !field._size)
+        return;
+
+    if(_fieldObjectIndices.isEmpty())
+        _fieldObjectIndices = Containers::Array<Containers::Array<std::size_t>>{ValueInit, _fields.size()};
+
+    Containers::Array<std::size_t> index{NoInit, std::size_t(field._size)};
+    const Containers::StridedArrayView1D<const void> mapping = fieldDataMappingViewInternal(field);
+    const SceneMappingType mappingType = field.mappingType();
+    if(mappingType == SceneMappingType::UnsignedInt)
+        sortObjectIndex<UnsignedInt>(mapping, index);
+    else if(mappingType == SceneMappingType::UnsignedShort)
+        sortObjectIndex<UnsignedShort>(mapping, index);
+    else if(mappingType == SceneMappingType::UnsignedByte)
+        sortObjectIndex<UnsignedByte>(mapping, index);
+    else if(mappingType == SceneMappingType::UnsignedLong)
+        sortObjectIndex<UnsignedLong>(mapping, index);
+    else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+
+    _fieldObjectIndices[fieldId] = Utility::move(index);
+}
+
+void SceneData::buildFieldObjectIndex(const UnsignedInt fieldId) {
+    CORRADE_ASSERT(fieldId < _fields.size(),
+        "Trade::SceneData::buildFieldObjectIndex(): index" << fieldId << "out of range for" << _fields.size() << "fields", );
+    buildFieldObjectIndexInternal(fieldId);
+}
+
+void SceneData::buildFieldObjectIndex(const SceneField fieldName) {
+    const UnsignedInt fieldId = findFieldIdInternal(fieldName);
+    CORRADE_ASSERT(fieldId != ~UnsignedInt{},
+        "Trade::SceneData::buildFieldObjectIndex(): field" << fieldName << "not found", );
+    buildFieldObjectIndexInternal(fieldId);
+}
+
+void SceneData::buildFieldObjectIndices() {
+    for(UnsignedInt i = 0; i != _fields.size(); ++i)
+        buildFieldObjectIndexInternal(i);
+}
+
+bool SceneData::hasFieldObjectIndexInternal(const UnsignedInt fieldId) const {
+    /* The parent field has the children index built even if it has ordered
+       or implicit mapping, report that as well */
+    if(_fields[fieldId]._name == SceneField::Parent && !_childrenIndex.isEmpty())
+        return true;
+    return !_fieldObjectIndices.isEmpty() && !_fieldObjectIndices[fieldId].isEmpty();
+}
+
+bool SceneData::hasFieldObjectIndex(const UnsignedInt fieldId) const {
+    CORRADE_ASSERT(fieldId < _fields.size(),
+        "Trade::SceneData::hasFieldObjectIndex(): index" << fieldId << "out of range for" << _fields.size() << "fields", {});
+    return hasFieldObjectIndexInternal(fieldId);
+}
+
+bool SceneData::hasFieldObjectIndex(const SceneField fieldName) const {
+    const UnsignedInt fieldId = findFieldIdInternal(fieldName);
+    CORRADE_ASSERT(fieldId != ~UnsignedInt{},
+        "Trade::SceneData::hasFieldObjectIndex(): field" << fieldName << "not found", {});
+    return hasFieldObjectIndexInternal(fieldId);
+}
+
 SceneFieldFlags SceneData::fieldFlags(const SceneField name) const {
     const UnsignedInt fieldId = findFieldIdInternal(name);
     CORRADE_ASSERT(fieldId != ~UnsignedInt{}, "Trade::SceneData::fieldFlags(): field" << name << "not found", {});
@@ -2660,9 +2793,28 @@ Containers::Array<UnsignedLong> SceneData::childrenFor(const Long object) const
 
     const SceneFieldData& parentField = _fields[parentFieldId];
 
+    /* If there's a children index, the children are a contiguous range in
+       it, sorted by their offset in the field */
+    std::size_t begin = 0, end = parentField.size();
+    const Containers::ArrayView<const std::size_t> index = _childrenIndex;
+    if(!index.isEmpty()) {
+        const auto parentAt = [&](const std::size_t offset) {
+            Int parentIndex[1];
+            parentsIntoInternal(parentFieldId, offset, parentIndex);
+            return Long(*parentIndex);
+        };
+        begin = std::lower_bound(index.begin(), index.end(), object, [&](const std::size_t a, const Long b) {
+            return parentAt(a) < b;
+        }) - index.begin();
+        end = std::upper_bound(index.begin() + begin, index.end(), object, [&](const Long a, const std::size_t b) {
+            return a < parentAt(b);
+        }) - index.begin();
+    }
+
     /* Collect IDs of all objects that reference this object */
     Containers::Array<UnsignedLong> out;
-    for(std::size_t offset = 0; offset != parentField.size(); ++offset) {
+    for(std::size_t i = begin; i != end; ++i) {
+        const std::size_t offset = index.isEmpty() ? i : index[i];
         Int parentIndex[1];
         parentsIntoInternal(parentFieldId, offset, parentIndex);
         if(*parentIndex == object) {
@@ -2907,12 +3059,16 @@ std::vector<UnsignedInt> SceneData::children3D() const {
 Containers::Array<SceneFieldData> SceneData::releaseFieldData() {
     Containers::Array<SceneFieldData> out = Utility::move(_fields);
     _fields = {};
+    _fieldObjectIndices = {};
+    _childrenIndex = {};
     return out;
 }
 
 Containers::Array<char> SceneData::releaseData() {
     Containers::Array<char> out = Utility::move(_data);
     _data = {};
+    _fieldObjectIndices = {};
+    _childrenIndex = {};
     return out;
 }
 
@@ -1747,6 +1747,15 @@ scene representations these are suited mainly for introspection and debugging
 purposes and retrieving field data for many objects is better achieved by
 accessing the field data directly.
 
+If the scene comes from a file with no ordering guarantees and reordering the
+data isn't desirable, calling @ref buildFieldObjectIndices() or
+@ref buildFieldObjectIndex() builds an object lookup index for fields that
+have neither @ref SceneFieldFlag::OrderedMapping nor
+@ref SceneFieldFlag::ImplicitMapping set, making the lookup logarithmic for
+them as well:
+
+@snippet Trade.cpp SceneData-per-object-index
+
 @section Trade-SceneData-usage-mutable Mutable data access
 
 The interfaces implicitly provide @cpp const @ce views on the contained object
@@ -2246,9 +2255,10 @@ class MAGNUM_TRADE_EXPORT SceneData {
          *
          * If the field has @ref SceneFieldFlag::ImplicitMapping, the lookup is
          * done in an @f$ \mathcal{O}(1) @f$ complexity. Otherwise, if the
-         * field has @ref SceneFieldFlag::OrderedMapping, the lookup is done in
-         * an @f$ \mathcal{O}(\log{} n) @f$ complexity with @f$ n @f$ being the
-         * size of the field. Otherwise, the lookup is done in an
+         * field has @ref SceneFieldFlag::OrderedMapping or an object index was
+         * built for it with @ref buildFieldObjectIndex(), the lookup is done
+         * in an @f$ \mathcal{O}(\log{} n) @f$ complexity with @f$ n @f$ being
+         * the size of the field. Otherwise, the lookup is done in an
          * @f$ \mathcal{O}(n) @f$ complexity.
          *
          * You can also use @ref findFieldObjectOffset(SceneField, UnsignedLong, std::size_t) const
@@ -2271,7 +2281,8 @@ class MAGNUM_TRADE_EXPORT SceneData {
          * If the field has @ref SceneFieldFlag::ImplicitMapping, the lookup is
          * done in an @f$ \mathcal{O}(m) @f$ complexity with @f$ m @f$ being
          * the field count. Otherwise, if the field has
-         * @ref SceneFieldFlag::OrderedMapping, the lookup is done in an
+         * @ref SceneFieldFlag::OrderedMapping or an object index was built for
+         * it with @ref buildFieldObjectIndex(), the lookup is done in an
          * @f$ \mathcal{O}(m + \log{} n) @f$ complexity with @f$ m @f$ being
          * the field count and @f$ n @f$ the size of the field. Otherwise, the
          * lookup is done in an @f$ \mathcal{O}(m + n) @f$ complexity.
@@ -2326,6 +2337,90 @@ class MAGNUM_TRADE_EXPORT SceneData {
          */
         bool hasFieldObject(SceneField fieldName, UnsignedLong object) const;
 
+        /**
+         * @brief Build an object lookup index for given field
+         * @m_since_latest
+         *
+         * If the field has neither @ref SceneFieldFlag::ImplicitMapping nor
+         * @ref SceneFieldFlag::OrderedMapping and isn't empty, builds a
+         * permutation of its offsets sorted by the object mapping, which
+         * makes @ref findFieldObjectOffset(), @ref fieldObjectOffset(),
+         * @ref hasFieldObject() and all per-object accessors such as
+         * @ref parentFor(), @ref transformation3DFor() or
+         * @ref meshesMaterialsFor() operate in an
+         * @f$ \mathcal{O}(\log{} n) @f$ complexity instead of
+         * @f$ \mathcal{O}(n) @f$ for this field. The index is built in an
+         * @f$ \mathcal{O}(n \log{} n) @f$ complexity and takes
+         * @cpp sizeof(std::size_t) @ce bytes per field entry. If an index
+         * for the field already exists, it's rebuilt. Otherwise, if the
+         * field has any of the above flags or is empty, the function does
+         * nothing. The @p fieldId is expected to be smaller than
+         * @ref fieldCount().
+         *
+         * If the field is @ref SceneField::Parent and isn't empty, this
+         * additionally builds a permutation of its offsets sorted by the
+         * parent, regardless of the flags, which makes @ref childrenFor()
+         * operate in an @f$ \mathcal{O}(\log{} n + m) @f$ complexity, where
+         * @f$ m @f$ is the count of children, instead of
+         * @f$ \mathcal{O}(n) @f$. It takes another
+         * @cpp sizeof(std::size_t) @ce bytes per field entry.
+         *
+         * The index isn't updated when the object mapping is modified
+         * through @ref mutableData() or @ref mutableMapping() --- call this
+         * function again after such a modification. The index is discarded
+         * by @ref releaseFieldData() and @ref releaseData().
+         * @see @ref buildFieldObjectIndex(SceneField),
+         *      @ref buildFieldObjectIndices(),
+         *      @ref hasFieldObjectIndex(UnsignedInt) const
+         */
+        void buildFieldObjectIndex(UnsignedInt fieldId);
+
+        /**
+         * @brief Build an object lookup index for given named field
+         * @m_since_latest
+         *
+         * Like @ref buildFieldObjectIndex(UnsignedInt), but the @p fieldName
+         * is expected to exist.
+         * @see @ref hasField()
+         */
+        void buildFieldObjectIndex(SceneField fieldName);
+
+        /**
+         * @brief Build object lookup indices for all fields
+         * @m_since_latest
+         *
+         * Calls @ref buildFieldObjectIndex(UnsignedInt) for all fields.
+         */
+        void buildFieldObjectIndices();
+
+        /**
+         * @brief Whether given field has an object lookup index
+         * @m_since_latest
+         *
+         * Returns @cpp true @ce if an index was built for the field with
+         * @ref buildFieldObjectIndex() or @ref buildFieldObjectIndices(),
+         * @cpp false @ce otherwise. Always returns @cpp false @ce for empty
+         * fields, and for fields that have
+         * @ref SceneFieldFlag::ImplicitMapping or
+         * @ref SceneFieldFlag::OrderedMapping set, as these never need an
+         * object index. The only exception is @ref SceneField::Parent, for
+         * which this returns @cpp true @ce also if just the parent to
+         * children index used by @ref childrenFor() was built, regardless of
+         * the flags. The @p fieldId is expected to be smaller than
+         * @ref fieldCount().
+         */
+        bool hasFieldObjectIndex(UnsignedInt fieldId) const;
+
+        /**
+         * @brief Whether given named field has an object lookup index
+         * @m_since_latest
+         *
+         * Like @ref hasFieldObjectIndex(UnsignedInt) const, but the
+         * @p fieldName is expected to exist.
+         * @see @ref hasField()
+         */
+        bool hasFieldObjectIndex(SceneField fieldName) const;
+
         /**
          * @brief Flags of a named field
          * @m_since_latest
@@ -3494,6 +3589,10 @@ class MAGNUM_TRADE_EXPORT SceneData {
          * have it listed as the parent. See the lookup function documentation
          * for operation complexity --- for retrieving parent/child info for
          * many objects it's recommended to access the field data directly.
+         * Without an index the whole field is scanned, if an index was built
+         * using @ref buildFieldObjectIndex() for the @ref SceneField::Parent
+         * field, the lookup is done in an @f$ \mathcal{O}(\log{} n + m) @f$
+         * complexity, where @f$ m @f$ is the count of children.
          *
          * If the @ref SceneField::Parent field doesn't exist or there are no
          * objects which would have @p object listed as their parent, returns
@@ -3786,8 +3885,12 @@ class MAGNUM_TRADE_EXPORT SceneData {
 
         /* Returns the offset at which `object` is for field at index `id`, or
            the end offset if the object is not found. The returned offset can
-           be then passed to fieldData{Mapping,Field}ViewInternal(). */
+           be then passed to fieldData{Mapping,Field}ViewInternal(). The
+           `field` is expected to be a reference into `_fields`, its position
+           is used to look up the object index, if present. */
         MAGNUM_TRADE_LOCAL std::size_t findFieldObjectOffsetInternal(const SceneFieldData& field, UnsignedLong object, std::size_t offset) const;
+        MAGNUM_TRADE_LOCAL void buildFieldObjectIndexInternal(UnsignedInt fieldId);
+        MAGNUM_TRADE_LOCAL bool hasFieldObjectIndexInternal(UnsignedInt fieldId) const;
 
         /* Like mapping() / field(), but returning just a 1D view, sliced from
            offset to offset + size. The parameterless overloads are equal to
@@ -3825,6 +3928,14 @@ class MAGNUM_TRADE_EXPORT SceneData {
         const void* _importerState;
         Containers::Array<SceneFieldData> _fields;
         Containers::Array<char> _data;
+        /* Empty if no object index was built, otherwise sized to field count
+           with each item being either empty or a permutation of field offsets
+           sorted by object ID */
+        Containers::Array<Containers::Array<std::size_t>> _fieldObjectIndices;
+        /* Empty if no index was built for the parent field, otherwise a
+           permutation of its offsets sorted by the parent and then by the
+           offset */
+        Containers::Array<std::size_t> _childrenIndex;
 };
 
 namespace Implementation {
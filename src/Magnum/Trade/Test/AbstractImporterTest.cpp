@@ -112,6 +112,12 @@ struct AbstractImporterTest: TestSuite::Tester {
     void setFileCallbackOpenFileAsData();
     void setFileCallbackOpenFileAsDataFailed();
 
+    void mapFilesSetFlags();
+    void mapFilesUserCallback();
+    void mapFilesOpenFileAsData();
+    void mapFilesOpenFileAsDataFailed();
+    void mapFilesFileCallback();
+
     void thingCountNotImplemented();
     void thingCountNoFile();
     void thingForNameNotImplemented();
@@ -436,6 +442,12 @@ AbstractImporterTest::AbstractImporterTest() {
               &AbstractImporterTest::setFileCallbackOpenFileAsData,
               &AbstractImporterTest::setFileCallbackOpenFileAsDataFailed,
 
+              &AbstractImporterTest::mapFilesSetFlags,
+              &AbstractImporterTest::mapFilesUserCallback,
+              &AbstractImporterTest::mapFilesOpenFileAsData,
+              &AbstractImporterTest::mapFilesOpenFileAsDataFailed,
+              &AbstractImporterTest::mapFilesFileCallback,
+
               &AbstractImporterTest::thingCountNotImplemented,
               &AbstractImporterTest::thingCountNoFile,
               &AbstractImporterTest::thingForNameNotImplemented,
@@ -764,14 +776,13 @@ void AbstractImporterTest::setFlags() {
     CORRADE_COMPARE(importer.flags(), ImporterFlag::Verbose);
     CORRADE_COMPARE(importer._flags, ImporterFlag::Verbose);
 
-    /** @todo use a real flag when we have more than one */
-    importer.addFlags(ImporterFlag(4));
-    CORRADE_COMPARE(importer.flags(), ImporterFlag::Verbose|ImporterFlag(4));
-    CORRADE_COMPARE(importer._flags, ImporterFlag::Verbose|ImporterFlag(4));
+    importer.addFlags(ImporterFlag::Quiet);
+    CORRADE_COMPARE(importer.flags(), ImporterFlag::Verbose|ImporterFlag::Quiet);
+    CORRADE_COMPARE(importer._flags, ImporterFlag::Verbose|ImporterFlag::Quiet);
 
     importer.clearFlags(ImporterFlag::Verbose);
-    CORRADE_COMPARE(importer.flags(), ImporterFlag(4));
-    CORRADE_COMPARE(importer._flags, ImporterFlag(4));
+    CORRADE_COMPARE(importer.flags(), ImporterFlag::Quiet);
+    CORRADE_COMPARE(importer._flags, ImporterFlag::Quiet);
 }
 
 void AbstractImporterTest::setFlagsFileOpened() {
@@ -1476,6 +1487,149 @@ void AbstractImporterTest::setFileCallbackOpenFileAsDataFailed() {
     CORRADE_COMPARE(out, "Trade::AbstractImporter::openFile(): cannot open file file.dat\n");
 }
 
+void AbstractImporterTest::mapFilesSetFlags() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::OpenData; }
+        bool doIsOpened() const override { return false; }
+        void doClose() override {}
+        void doSetFileCallback(Containers::Optional<Containers::ArrayView<const char>>(*callback)(const std::string&, InputFileCallbackPolicy, void*), void*) override {
+            hasCallback = !!callback;
+        }
+
+        bool hasCallback = false;
+    } importer;
+
+    /* Setting the flag installs an internal callback */
+    importer.addFlags(ImporterFlag::MapFiles);
+    CORRADE_COMPARE(importer.flags(), ImporterFlag::MapFiles);
+    CORRADE_VERIFY(importer.fileCallback());
+    CORRADE_VERIFY(importer.fileCallbackUserData());
+    CORRADE_VERIFY(importer.hasCallback);
+
+    /* Resetting the callback keeps the internal one */
+    importer.setFileCallback(nullptr);
+    CORRADE_VERIFY(importer.fileCallback());
+    CORRADE_VERIFY(importer.hasCallback);
+
+    /* Clearing the flag removes it */
+    importer.clearFlags(ImporterFlag::MapFiles);
+    CORRADE_VERIFY(!importer.fileCallback());
+    CORRADE_VERIFY(!importer.fileCallbackUserData());
+    CORRADE_VERIFY(!importer.hasCallback);
+}
+
+void AbstractImporterTest::mapFilesUserCallback() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::OpenData; }
+        bool doIsOpened() const override { return false; }
+        void doClose() override {}
+    } importer;
+
+    int a = 0;
+    auto lambda = [](const std::string&, InputFileCallbackPolicy, void*) {
+        return Containers::Optional<Containers::ArrayView<const char>>{};
+    };
+
+    /* A user callback takes precedence over the internal one */
+    importer.setFileCallback(lambda, &a);
+    importer.addFlags(ImporterFlag::MapFiles);
+    CORRADE_COMPARE(importer.fileCallback(), lambda);
+    CORRADE_COMPARE(importer.fileCallbackUserData(), &a);
+
+    /* And clearing the flag doesn't reset it */
+    importer.clearFlags(ImporterFlag::MapFiles);
+    CORRADE_COMPARE(importer.fileCallback(), lambda);
+    CORRADE_COMPARE(importer.fileCallbackUserData(), &a);
+}
+
+void AbstractImporterTest::mapFilesOpenFileAsData() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::OpenData; }
+        bool doIsOpened() const override { return !_data.isEmpty(); }
+        void doClose() override { _data = {}; }
+
+        void doOpenData(Containers::Array<char>&& data, DataFlags dataFlags) override {
+            /* The data are not owned by the implementation, but are
+               guaranteed to stay alive until close */
+            CORRADE_COMPARE(dataFlags, DataFlag::ExternallyOwned);
+            _data = data;
+        }
+
+        Containers::ArrayView<const char> _data;
+    } importer;
+
+    importer.addFlags(ImporterFlag::MapFiles);
+    CORRADE_VERIFY(importer.openFile(Utility::Path::join(TRADE_TEST_DIR, "file.bin")));
+    CORRADE_VERIFY(importer.isOpened());
+
+    /* The memory is still valid after openFile() returned */
+    CORRADE_COMPARE_AS(importer._data,
+        Containers::arrayView({'\xa5'}),
+        TestSuite::Compare::Container);
+
+    importer.close();
+    CORRADE_VERIFY(!importer.isOpened());
+}
+
+void AbstractImporterTest::mapFilesOpenFileAsDataFailed() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::OpenData; }
+        bool doIsOpened() const override { return false; }
+        void doClose() override {}
+    } importer;
+
+    importer.addFlags(ImporterFlag::MapFiles);
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer.openFile("nonexistent.bin"));
+    /* There's an error from Path::mapRead() before */
+    CORRADE_COMPARE_AS(out,
+        "\nTrade::AbstractImporter::openFile(): cannot open file nonexistent.bin\n",
+        TestSuite::Compare::StringHasSuffix);
+}
+
+void AbstractImporterTest::mapFilesFileCallback() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::FileCallback; }
+        bool doIsOpened() const override { return _opened; }
+        void doClose() override { _opened = false; }
+
+        void doOpenFile(Containers::StringView filename) override {
+            /* A temporary file, closed right after */
+            Containers::Optional<Containers::ArrayView<const char>> data = fileCallback()(filename, InputFileCallbackPolicy::LoadTemporary, fileCallbackUserData());
+            CORRADE_VERIFY(data);
+            CORRADE_COMPARE_AS(*data,
+                Containers::arrayView({'\xa5'}),
+                TestSuite::Compare::Container);
+            CORRADE_VERIFY(!fileCallback()(filename, InputFileCallbackPolicy::Close, fileCallbackUserData()));
+
+            /* A permanent dependency that stays alive until close */
+            Containers::Optional<Containers::ArrayView<const char>> dependency = fileCallback()(filename, InputFileCallbackPolicy::LoadPermanent, fileCallbackUserData());
+            CORRADE_VERIFY(dependency);
+            _dependency = *dependency;
+
+            /* A nonexistent dependency */
+            {
+                Containers::String out;
+                Error redirectError{&out};
+                CORRADE_VERIFY(!fileCallback()("nonexistent.bin", InputFileCallbackPolicy::LoadTemporary, fileCallbackUserData()));
+            }
+
+            _opened = true;
+        }
+
+        bool _opened = false;
+        Containers::ArrayView<const char> _dependency;
+    } importer;
+
+    importer.addFlags(ImporterFlag::MapFiles);
+    CORRADE_VERIFY(importer.openFile(Utility::Path::join(TRADE_TEST_DIR, "file.bin")));
+    CORRADE_COMPARE_AS(importer._dependency,
+        Containers::arrayView({'\xa5'}),
+        TestSuite::Compare::Container);
+}
+
 void AbstractImporterTest::thingCountNotImplemented() {
     struct: AbstractImporter {
         ImporterFeatures doFeatures() const override { return {}; }
@@ -7805,8 +7959,8 @@ void AbstractImporterTest::debugFeaturesPacked() {
 void AbstractImporterTest::debugFlag() {
     Containers::String out;
 
-    Debug{&out} << ImporterFlag::Verbose << ImporterFlag(0xf0);
-    CORRADE_COMPARE(out, "Trade::ImporterFlag::Verbose Trade::ImporterFlag(0xf0)\n");
+    Debug{&out} << ImporterFlag::MapFiles << ImporterFlag(0xf0);
+    CORRADE_COMPARE(out, "Trade::ImporterFlag::MapFiles Trade::ImporterFlag(0xf0)\n");
 }
 
 void AbstractImporterTest::debugFlags() {
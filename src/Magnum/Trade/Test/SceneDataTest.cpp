@@ -168,6 +168,9 @@ struct SceneDataTest: TestSuite::Tester {
     void findFieldId();
     template<class T> void findFieldObjectOffset();
     void findFieldObjectOffsetInvalidOffset();
+    void fieldObjectIndex();
+    void fieldObjectIndexParentOrdered();
+    void fieldObjectIndexInvalid();
     void fieldObjectOffsetNotFound();
 
     template<class T> void mappingAsArrayByIndex();
@@ -534,6 +537,9 @@ SceneDataTest::SceneDataTest() {
     }, Containers::arraySize(FindFieldObjectOffsetData));
 
     addTests({&SceneDataTest::findFieldObjectOffsetInvalidOffset,
+              &SceneDataTest::fieldObjectIndex,
+              &SceneDataTest::fieldObjectIndexParentOrdered,
+              &SceneDataTest::fieldObjectIndexInvalid,
               &SceneDataTest::fieldObjectOffsetNotFound,
 
               &SceneDataTest::mappingAsArrayByIndex<UnsignedByte>,
@@ -4290,25 +4296,202 @@ template<class T> void SceneDataTest::findFieldObjectOffset() {
         SceneFieldData{SceneField::Mesh, view.slice(&Field::object), view.slice(&Field::mesh), data.flags}
     }};
 
-    /* An empty field should not find anything for any query with any flags */
-    if(data.offset == 0) {
-        CORRADE_COMPARE(scene.findFieldObjectOffset(0, data.object), Containers::NullOpt);
-        CORRADE_COMPARE(scene.findFieldObjectOffset(SceneField::Parent, data.object), Containers::NullOpt);
-        CORRADE_VERIFY(!scene.hasFieldObject(0, data.object));
-        CORRADE_VERIFY(!scene.hasFieldObject(SceneField::Parent, data.object));
+    /* Second iteration does the same with an object index built, which
+       should give the same results. It's built only for fields that have
+       neither ordered nor implicit mapping, and never for the empty field. */
+    for(bool index: {false, true}) {
+        CORRADE_ITERATION(index);
+
+        if(index) {
+            scene.buildFieldObjectIndices();
+            CORRADE_VERIFY(!scene.hasFieldObjectIndex(0));
+            CORRADE_COMPARE(scene.hasFieldObjectIndex(1), !(data.flags >= SceneFieldFlag::OrderedMapping));
+        } else {
+            CORRADE_VERIFY(!scene.hasFieldObjectIndex(0));
+            CORRADE_VERIFY(!scene.hasFieldObjectIndex(1));
+        }
+
+        /* An empty field should not find anything for any query with any
+           flags */
+        if(data.offset == 0) {
+            CORRADE_COMPARE(scene.findFieldObjectOffset(0, data.object), Containers::NullOpt);
+            CORRADE_COMPARE(scene.findFieldObjectOffset(SceneField::Parent, data.object), Containers::NullOpt);
+            CORRADE_VERIFY(!scene.hasFieldObject(0, data.object));
+            CORRADE_VERIFY(!scene.hasFieldObject(SceneField::Parent, data.object));
+        }
+
+        CORRADE_COMPARE(scene.findFieldObjectOffset(1, data.object, data.offset), data.expected);
+        CORRADE_COMPARE(scene.findFieldObjectOffset(SceneField::Mesh, data.object, data.offset), data.expected);
+        if(data.offset == 0) {
+            CORRADE_COMPARE(scene.hasFieldObject(1, data.object), !!data.expected);
+            CORRADE_COMPARE(scene.hasFieldObject(SceneField::Mesh, data.object), !!data.expected);
+        }
+
+        if(data.expected) {
+            CORRADE_COMPARE(scene.fieldObjectOffset(1, data.object, data.offset), *data.expected);
+            CORRADE_COMPARE(scene.fieldObjectOffset(SceneField::Mesh, data.object, data.offset), *data.expected);
+        }
     }
+}
 
-    CORRADE_COMPARE(scene.findFieldObjectOffset(1, data.object, data.offset), data.expected);
-    CORRADE_COMPARE(scene.findFieldObjectOffset(SceneField::Mesh, data.object, data.offset), data.expected);
-    if(data.offset == 0) {
-        CORRADE_COMPARE(scene.hasFieldObject(1, data.object), !!data.expected);
-        CORRADE_COMPARE(scene.hasFieldObject(SceneField::Mesh, data.object), !!data.expected);
-    }
+void SceneDataTest::fieldObjectIndex() {
+    struct Field {
+        UnsignedInt object;
+        UnsignedInt mesh;
+        Int meshMaterial;
+        Int parent;
+    } fields[]{
+        {4, 1, -1, -1},
+        {1, 3, 0, 4},
+        {2, 4, 1, 1},
+        {2, 5, -1, 1},
+        {0, 1, 0, 4},
+        {2, 1, 0, 1},
+        {4, 2, 3, -1},
+    };
+    Containers::StridedArrayView1D<Field> view = fields;
 
-    if(data.expected) {
-        CORRADE_COMPARE(scene.fieldObjectOffset(1, data.object, data.offset), *data.expected);
-        CORRADE_COMPARE(scene.fieldObjectOffset(SceneField::Mesh, data.object, data.offset), *data.expected);
-    }
+    SceneData scene{SceneMappingType::UnsignedInt, 7, {}, fields, {
+        SceneFieldData{SceneField::Mesh, view.slice(&Field::object), view.slice(&Field::mesh)},
+        SceneFieldData{SceneField::MeshMaterial, view.slice(&Field::object), view.slice(&Field::meshMaterial)},
+        /* Object 2 is there three times, so the parent field isn't really
+           valid, but that's not a problem for the lookup */
+        SceneFieldData{SceneField::Parent, view.slice(&Field::object), view.slice(&Field::parent)},
+        /* Ordered, doesn't get an index */
+        SceneFieldData{SceneField::Light, view.slice(&Field::object).prefix(1), view.slice(&Field::mesh).prefix(1), SceneFieldFlag::OrderedMapping},
+    }};
+
+    /* Building just for one field */
+    scene.buildFieldObjectIndex(SceneField::Mesh);
+    CORRADE_VERIFY(scene.hasFieldObjectIndex(0));
+    CORRADE_VERIFY(scene.hasFieldObjectIndex(SceneField::Mesh));
+    CORRADE_VERIFY(!scene.hasFieldObjectIndex(1));
+    CORRADE_VERIFY(!scene.hasFieldObjectIndex(SceneField::Parent));
+
+    /* Building for all, except the ordered field */
+    scene.buildFieldObjectIndices();
+    CORRADE_VERIFY(scene.hasFieldObjectIndex(0));
+    CORRADE_VERIFY(scene.hasFieldObjectIndex(1));
+    CORRADE_VERIFY(scene.hasFieldObjectIndex(2));
+    CORRADE_VERIFY(!scene.hasFieldObjectIndex(3));
+
+    /* Per-object queries should go through the index and give back entries
+       in the order they are in the field */
+    CORRADE_COMPARE_AS(scene.meshesMaterialsFor(2),
+        (Containers::arrayView<Containers::Pair<UnsignedInt, Int>>({
+            {4, 1}, {5, -1}, {1, 0}
+        })), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.meshesMaterialsFor(4),
+        (Containers::arrayView<Containers::Pair<UnsignedInt, Int>>({
+            {1, -1}, {2, 3}
+        })), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.meshesMaterialsFor(6),
+        (Containers::arrayView<Containers::Pair<UnsignedInt, Int>>({})),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(scene.parentFor(0), 4);
+    CORRADE_COMPARE(scene.parentFor(1), 4);
+    CORRADE_COMPARE(scene.parentFor(2), 1);
+    CORRADE_COMPARE(scene.parentFor(4), -1);
+    CORRADE_COMPARE(scene.parentFor(5), Containers::NullOpt);
+    CORRADE_COMPARE_AS(scene.childrenFor(-1),
+        Containers::arrayView<UnsignedLong>({4, 4}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.childrenFor(4),
+        Containers::arrayView<UnsignedLong>({1, 0}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.childrenFor(1),
+        Containers::arrayView<UnsignedLong>({2, 2, 2}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.childrenFor(3),
+        Containers::arrayView<UnsignedLong>({}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.childrenFor(6),
+        Containers::arrayView<UnsignedLong>({}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(scene.findFieldObjectOffset(SceneField::Mesh, 2, 3), 3);
+    CORRADE_COMPARE(scene.findFieldObjectOffset(SceneField::Mesh, 2, 4), 5);
+    CORRADE_COMPARE(scene.findFieldObjectOffset(SceneField::Mesh, 2, 6), Containers::NullOpt);
+    CORRADE_COMPARE(scene.findFieldObjectOffset(SceneField::Mesh, 4, 1), 6);
+
+    /* The index should survive a move */
+    SceneData moved = Utility::move(scene);
+    CORRADE_VERIFY(moved.hasFieldObjectIndex(0));
+    CORRADE_COMPARE(moved.findFieldObjectOffset(SceneField::Mesh, 2, 4), 5);
+
+    CORRADE_COMPARE_AS(moved.childrenFor(4),
+        Containers::arrayView<UnsignedLong>({1, 0}),
+        TestSuite::Compare::Container);
+
+    /* Modifying the mapping and rebuilding the index gives back updated
+       results */
+    fields[6].object = 5;
+    moved.buildFieldObjectIndex(0);
+    CORRADE_COMPARE(moved.findFieldObjectOffset(SceneField::Mesh, 4, 1), Containers::NullOpt);
+    CORRADE_COMPARE(moved.findFieldObjectOffset(SceneField::Mesh, 5), 6);
+
+    /* Releasing the field data discards the index as well */
+    moved.releaseFieldData();
+    CORRADE_COMPARE(moved.fieldCount(), 0);
+}
+
+void SceneDataTest::fieldObjectIndexParentOrdered() {
+    struct Field {
+        UnsignedByte object;
+        Int parent;
+    } fields[]{
+        {0, -1},
+        {1, 0},
+        {2, -1},
+        {3, 0},
+    };
+    Containers::StridedArrayView1D<Field> view = fields;
+
+    SceneData scene{SceneMappingType::UnsignedByte, 4, {}, fields, {
+        SceneFieldData{SceneField::Parent, view.slice(&Field::object), view.slice(&Field::parent), SceneFieldFlag::ImplicitMapping}
+    }};
+    CORRADE_VERIFY(!scene.hasFieldObjectIndex(0));
+    CORRADE_VERIFY(!scene.hasFieldObjectIndex(SceneField::Parent));
+
+    /* The field has an implicit mapping so it doesn't need an object index,
+       but the children index is built for it and reported */
+    scene.buildFieldObjectIndex(SceneField::Parent);
+    CORRADE_VERIFY(scene.hasFieldObjectIndex(0));
+    CORRADE_VERIFY(scene.hasFieldObjectIndex(SceneField::Parent));
+    CORRADE_COMPARE_AS(scene.childrenFor(0),
+        Containers::arrayView<UnsignedLong>({1, 3}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.childrenFor(-1),
+        Containers::arrayView<UnsignedLong>({0, 2}),
+        TestSuite::Compare::Container);
+}
+
+void SceneDataTest::fieldObjectIndexInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct Field {
+        UnsignedInt object;
+        UnsignedInt mesh;
+    } fields[]{
+        {4, 1},
+        {1, 3},
+    };
+    Containers::StridedArrayView1D<Field> view = fields;
+
+    SceneData scene{SceneMappingType::UnsignedInt, 7, {}, fields, {
+        SceneFieldData{SceneField::Mesh, view.slice(&Field::object), view.slice(&Field::mesh)}
+    }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    scene.buildFieldObjectIndex(1);
+    scene.buildFieldObjectIndex(SceneField::Parent);
+    scene.hasFieldObjectIndex(1);
+    scene.hasFieldObjectIndex(SceneField::Parent);
+    CORRADE_COMPARE(out,
+        "Trade::SceneData::buildFieldObjectIndex(): index 1 out of range for 1 fields\n"
+        "Trade::SceneData::buildFieldObjectIndex(): field Trade::SceneField::Parent not found\n"
+        "Trade::SceneData::hasFieldObjectIndex(): index 1 out of range for 1 fields\n"
+        "Trade::SceneData::hasFieldObjectIndex(): field Trade::SceneField::Parent not found\n");
 }
 
 void SceneDataTest::findFieldObjectOffsetInvalidOffset() {
@@ -7110,6 +7293,24 @@ void SceneDataTest::childrenFor() {
     CORRADE_COMPARE_AS(scene.childrenFor(6),
         Containers::arrayView<UnsignedLong>({}),
         TestSuite::Compare::Container);
+
+    /* With an index the results are the same, in the same order */
+    scene.buildFieldObjectIndex(SceneField::Parent);
+    CORRADE_COMPARE_AS(scene.childrenFor(3),
+        Containers::arrayView<UnsignedLong>({2}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.childrenFor(-1),
+        Containers::arrayView<UnsignedLong>({4, 0}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.childrenFor(4),
+        Containers::arrayView<UnsignedLong>({3, 1, 5}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.childrenFor(5),
+        Containers::arrayView<UnsignedLong>({}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.childrenFor(6),
+        Containers::arrayView<UnsignedLong>({}),
+        TestSuite::Compare::Container);
 }
 
 void SceneDataTest::childrenForTrivialParent() {
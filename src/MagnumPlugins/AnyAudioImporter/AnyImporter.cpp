@@ -105,6 +105,10 @@ UnsignedInt AnyImporter::doFrequency() const { return _in->frequency(); }
 
 Containers::Array<char> AnyImporter::doData() { return _in->data(); }
 
+std::size_t AnyImporter::doDataSize() { return _in->dataSize(); }
+
+std::size_t AnyImporter::doDataInto(const std::size_t offset, const Containers::ArrayView<char> out) { return _in->dataInto(offset, out); }
+
 }}
 
 CORRADE_PLUGIN_REGISTER(AnyAudioImporter, Magnum::Audio::AnyImporter,
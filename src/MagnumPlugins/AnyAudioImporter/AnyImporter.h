@@ -139,6 +139,8 @@ class MAGNUM_ANYAUDIOIMPORTER_EXPORT AnyImporter: public AbstractImporter {
         MAGNUM_ANYAUDIOIMPORTER_LOCAL BufferFormat doFormat() const override;
         MAGNUM_ANYAUDIOIMPORTER_LOCAL UnsignedInt doFrequency() const override;
         MAGNUM_ANYAUDIOIMPORTER_LOCAL Containers::Array<char> doData() override;
+        MAGNUM_ANYAUDIOIMPORTER_LOCAL std::size_t doDataSize() override;
+        MAGNUM_ANYAUDIOIMPORTER_LOCAL std::size_t doDataInto(std::size_t offset, Containers::ArrayView<char> out) override;
 
         Containers::Pointer<AbstractImporter> _in;
 };
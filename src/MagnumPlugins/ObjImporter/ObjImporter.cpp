@@ -26,60 +26,230 @@
 
 #include "ObjImporter.h"
 
-#include <fstream>
-#include <limits>
-#include <sstream>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <string>
 #include <unordered_map>
 #include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Containers/String.h>
-#include <Corrade/Containers/StringStl.h> /** @todo remove once iostream is dropped */
-#include <Corrade/Utility/DebugStl.h>
-#include <Corrade/Utility/String.h>
+#include <Corrade/Containers/StringStl.h>
+#include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/ConfigurationGroup.h>
+#include <Corrade/Utility/Path.h>
 
 #include "Magnum/Mesh.h"
+#include "Magnum/Implementation/parallel.h"
 #include "Magnum/MeshTools/RemoveDuplicates.h"
 #include "Magnum/MeshTools/Duplicate.h"
 #include "Magnum/Math/Color.h"
+#include "Magnum/Math/Functions.h"
 #include "Magnum/Trade/MeshData.h"
 
 namespace Magnum { namespace Trade {
 
+using namespace Containers::Literals;
+
+namespace {
+
+struct Mesh {
+    /* Byte range of the mesh in the file */
+    std::size_t begin, end;
+    /* Index offsets for the mesh, and counts of vertex data it contains */
+    UnsignedInt positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset;
+    UnsignedInt positionCount, textureCoordinateCount, normalCount;
+};
+
+}
+
 struct ObjImporter::File {
     std::unordered_map<std::string, UnsignedInt> meshesForName;
-    std::vector<std::string> meshNames;
-    std::vector<std::tuple<std::streampos, std::streampos, UnsignedInt, UnsignedInt, UnsignedInt>> meshes;
-    Containers::Pointer<std::istream> in;
+    Containers::Array<Containers::String> meshNames;
+    Containers::Array<Mesh> meshes;
+
+    /* File contents. Either a copy, a memory-mapped file, or the data passed
+       to openData() / openMemory() that's owned by the importer or
+       externally. The `in` view always points to the contents. */
+    Containers::Array<char> data;
+    #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+    Containers::Optional<Containers::Array<const char, Utility::Path::MapDeleter>> mapped;
+    #endif
+    Containers::StringView in;
 };
 
 namespace {
 
-void ignoreLine(std::istream& in) {
-    in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+inline bool isWhitespace(const char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+/* Returns the line starting at `it` without the trailing newline and moves
+   `it` to the start of the next line */
+Containers::StringView nextLine(const char*& it, const char* const end) {
+    const char* const begin = it;
+    const char* const newline = static_cast<const char*>(std::memchr(it, '\n', end - it));
+    if(newline) {
+        it = newline + 1;
+        return {begin, std::size_t(newline - begin)};
+    }
+
+    it = end;
+    return {begin, std::size_t(end - begin)};
+}
+
+/* Returns the next whitespace-delimited token and moves `it` after it, an
+   empty view if there's no token left */
+Containers::StringView nextToken(const char*& it, const char* const end) {
+    while(it != end && isWhitespace(*it)) ++it;
+    const char* const begin = it;
+    while(it != end && !isWhitespace(*it)) ++it;
+    return {begin, std::size_t(it - begin)};
+}
+
+/* Scales a value by a power of ten. Powers up to 22 are exactly representable
+   in a double, so for mantissas up to 2^53 the result is correctly rounded. */
+Double scaleByPowerOfTen(Double value, Int exponent) {
+    constexpr Double Powers[]{
+        1.0e0, 1.0e1, 1.0e2, 1.0e3, 1.0e4, 1.0e5, 1.0e6, 1.0e7, 1.0e8, 1.0e9,
+        1.0e10, 1.0e11, 1.0e12, 1.0e13, 1.0e14, 1.0e15, 1.0e16, 1.0e17, 1.0e18,
+        1.0e19, 1.0e20, 1.0e21, 1.0e22};
+    if(exponent < 0) {
+        for(; exponent < -22; exponent += 22) value /= Powers[22];
+        return value/Powers[-exponent];
+    }
+
+    for(; exponent > 22; exponent -= 22) value *= Powers[22];
+    return value*Powers[exponent];
+}
+
+/* Parses a decimal floating-point number spanning the whole token. Unlike
+   std::strtof() it doesn't depend on the locale and doesn't need the input to
+   be null-terminated. */
+bool parseDecimalFloat(const Containers::StringView token, Float& out) {
+    const char* it = token.begin();
+    const char* const end = token.end();
+
+    bool negative = false;
+    if(it != end && (*it == '-' || *it == '+')) {
+        negative = *it == '-';
+        ++it;
+    }
+
+    /* Accumulate at most 18 significant digits, which fits into a 64-bit
+       integer and is way more than a float can represent anyway */
+    UnsignedLong mantissa = 0;
+    Int exponent = 0;
+    bool hasDigits = false;
+    for(; it != end && *it >= '0' && *it <= '9'; ++it) {
+        hasDigits = true;
+        if(mantissa < 100000000000000000ull)
+            mantissa = mantissa*10 + (*it - '0');
+        else ++exponent;
+    }
+    if(it != end && *it == '.') {
+        for(++it; it != end && *it >= '0' && *it <= '9'; ++it) {
+            hasDigits = true;
+            if(mantissa < 100000000000000000ull) {
+                mantissa = mantissa*10 + (*it - '0');
+                --exponent;
+            }
+        }
+    }
+    if(!hasDigits) return false;
+
+    if(it != end && (*it == 'e' || *it == 'E')) {
+        ++it;
+        bool exponentNegative = false;
+        if(it != end && (*it == '-' || *it == '+')) {
+            exponentNegative = *it == '-';
+            ++it;
+        }
+
+        if(it == end) return false;
+        Int explicitExponent = 0;
+        for(; it != end && *it >= '0' && *it <= '9'; ++it)
+            if(explicitExponent < 100000)
+                explicitExponent = explicitExponent*10 + (*it - '0');
+        exponent += exponentNegative ? -explicitExponent : explicitExponent;
+    }
+
+    /* Trailing garbage */
+    if(it != end) return false;
+
+    const Double value = mantissa ? scaleByPowerOfTen(Double(mantissa), exponent) : 0.0;
+    out = Float(negative ? -value : value);
+    return true;
+}
+
+/* Parses a float with the fast path above and falls back to std::strtof()
+   for anything it doesn't handle, such as nan, inf, hexadecimal floats or
+   trailing characters after the number, in order to accept the same input as
+   std::stof() used previously. Values out of range are an error, same as with
+   std::stof(). */
+bool parseFloat(const Containers::StringView token, Float& out) {
+    if(parseDecimalFloat(token, out)) return true;
+
+    const Containers::String nullTerminated = Containers::String::nullTerminatedView(token);
+    char* end;
+    errno = 0;
+    const Float value = std::strtof(nullTerminated.data(), &end);
+    if(end == nullTerminated.data() || errno == ERANGE) return false;
+
+    out = value;
+    return true;
 }
 
-template<std::size_t size> Math::Vector<size, Float> extractFloatData(const std::string& str, Float* extra = nullptr) {
-    std::vector<std::string> data = Utility::String::splitWithoutEmptyParts(str, ' ');
-    if(data.size() < size || data.size() > size + (extra ? 1 : 0)) {
-        Error() << "Trade::ObjImporter::mesh(): invalid float array size";
-        throw 0;
+/* Parses an unsigned decimal integer spanning the whole token */
+bool parseIndex(const Containers::StringView token, UnsignedInt& out) {
+    if(token.isEmpty()) return false;
+
+    UnsignedLong value = 0;
+    for(const char c: token) {
+        if(c < '0' || c > '9') return false;
+        value = value*10 + (c - '0');
+        if(value > ~UnsignedInt{}) return false;
     }
 
-    Math::Vector<size, Float> output;
+    out = UnsignedInt(value);
+    return true;
+}
 
-    for(std::size_t i = 0; i != size; ++i)
-        output[i] = std::stof(data[i]);
+template<std::size_t size> bool extractFloatData(std::ostream* const error, const Containers::StringView contents, Math::Vector<size, Float>& output, Float* extra = nullptr) {
+    /* Gather the tokens first, one more than the max allowed to detect too
+       many values */
+    Containers::StringView tokens[size + 2];
+    std::size_t count = 0;
+    const char* it = contents.begin();
+    while(count != size + 2) {
+        const Containers::StringView token = nextToken(it, contents.end());
+        if(token.isEmpty()) break;
+        tokens[count++] = token;
+    }
 
-    if(data.size() == size+1) {
+    if(count < size || count > size + (extra ? 1 : 0)) {
+        Error{error} << "Trade::ObjImporter::mesh(): invalid float array size";
+        return false;
+    }
+
+    for(std::size_t i = 0; i != size; ++i) if(!parseFloat(tokens[i], output[i])) {
+        Error{error} << "Trade::ObjImporter::mesh(): error while converting numeric data";
+        return false;
+    }
+
+    if(count == size + 1) {
         /* This should be obvious from the first if, but add this just to make
            Clang Analyzer happy */
         CORRADE_INTERNAL_ASSERT(extra);
 
-        *extra = std::stof(data.back());
+        if(!parseFloat(tokens[size], *extra)) {
+            Error{error} << "Trade::ObjImporter::mesh(): error while converting numeric data";
+            return false;
+        }
     }
 
-    return output;
+    return true;
 }
 
 }
@@ -97,117 +267,196 @@ void ObjImporter::doClose() { _file.reset(); }
 bool ObjImporter::doIsOpened() const { return !!_file; }
 
 void ObjImporter::doOpenFile(const Containers::StringView filename) {
-    /** @todo ARGH clean this up, won't work with UTF-8 */
-    Containers::Pointer<std::istream> in{new std::ifstream{filename, std::ios::binary}};
-    if(!in->good()) {
+    /* Memory-map the file where possible, which avoids copying the whole file
+       into memory. Otherwise the base implementation reads it and calls
+       doOpenData(). */
+    #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+    Containers::Optional<Containers::Array<const char, Utility::Path::MapDeleter>> mapped = Utility::Path::mapRead(filename);
+    if(!mapped) {
         Error() << "Trade::ObjImporter::openFile(): cannot open file" << filename;
         return;
     }
 
     _file.reset(new File);
-    _file->in = Utility::move(in);
+    _file->in = {mapped->data(), mapped->size()};
+    _file->mapped = Utility::move(mapped);
     parseMeshNames();
+    #else
+    AbstractImporter::doOpenFile(filename);
+    #endif
 }
 
-void ObjImporter::doOpenData(Containers::Array<char>&& data, DataFlags) {
+void ObjImporter::doOpenData(Containers::Array<char>&& data, const DataFlags dataFlags) {
     _file.reset(new File);
-    /** @todo ARGH MY EYES what is this cursed thing, burn it to the ground */
-    _file->in.reset(new std::istringstream{{data.begin(), data.size()}});
+
+    /* Take over the existing array or copy the data if we can't */
+    if(dataFlags & (DataFlag::Owned|DataFlag::ExternallyOwned)) {
+        _file->data = Utility::move(data);
+    } else {
+        _file->data = Containers::Array<char>{NoInit, data.size()};
+        Utility::copy(data, _file->data);
+    }
+    _file->in = {_file->data.data(), _file->data.size()};
 
     parseMeshNames();
 }
 
+namespace {
+
+/* Files are split into chunks of at least this size for parallel parsing,
+   smaller files are parsed serially */
+constexpr std::size_t MinChunkSize = 64*1024;
+
+/* Splits `in` into `count` chunks of roughly the same size, with each chunk
+   starting at a beginning of a line. Returns `count + 1` boundary offsets. */
+Containers::Array<std::size_t> splitAtLines(const Containers::StringView in, const UnsignedInt count) {
+    Containers::Array<std::size_t> offsets{NoInit, count + std::size_t{1}};
+    offsets[0] = 0;
+    for(UnsignedInt i = 1; i < count; ++i) {
+        const std::size_t offset = Math::max(in.size()*i/count, offsets[i - 1]);
+        const char* const newline = static_cast<const char*>(std::memchr(in.data() + offset, '\n', in.size() - offset));
+        offsets[i] = newline ? newline + 1 - in.data() : in.size();
+    }
+    offsets[count] = in.size();
+    return offsets;
+}
+
+struct Object {
+    /* Offsets of the `o` line and of the line after it in the file */
+    std::size_t lineBegin, dataBegin;
+    Containers::StringView name;
+    /* Vertex data counts in the chunk preceding this object */
+    UnsignedInt positionCount, textureCoordinateCount, normalCount;
+};
+
+struct ObjectChunk {
+    Containers::Array<Object> objects;
+    UnsignedInt positionCount, textureCoordinateCount, normalCount;
+    /* Whether there are any data or indices before the first `o` line in
+       this chunk, or anywhere in the chunk if it has no `o` lines */
+    bool hasDataBeforeFirstObject;
+};
+
+/* Collects object names, offsets and vertex data counts in a chunk */
+void scanObjectChunk(const Containers::StringView in, const std::size_t begin, const std::size_t end, ObjectChunk& out) {
+    out.positionCount = out.textureCoordinateCount = out.normalCount = 0;
+    out.hasDataBeforeFirstObject = false;
+
+    for(const char* it = in.data() + begin; it != in.data() + end; ) {
+        /* The previous object might end at the beginning of this line */
+        const std::size_t lineBegin = it - in.data();
+
+        const Containers::StringView line = nextLine(it, in.data() + end);
+        const char* lineIt = line.begin();
+        const Containers::StringView keyword = nextToken(lineIt, line.end());
+
+        /* Empty line or a comment */
+        if(keyword.isEmpty() || keyword[0] == '#') continue;
+
+        /* Mesh name */
+        if(keyword == "o"_s) {
+            arrayAppend(out.objects, Object{lineBegin, std::size_t(it - in.data()),
+                line.slice(lineIt, line.end()).trimmed(),
+                out.positionCount, out.textureCoordinateCount, out.normalCount});
+
+        /* If there are any data/indices before the first name, it means that
+           the first object is unnamed. We need to check for them. */
+
+        /* Vertex data, update index offset for the following meshes */
+        } else if(keyword == "v"_s) {
+            ++out.positionCount;
+            if(out.objects.isEmpty()) out.hasDataBeforeFirstObject = true;
+        } else if(keyword == "vt"_s) {
+            ++out.textureCoordinateCount;
+            if(out.objects.isEmpty()) out.hasDataBeforeFirstObject = true;
+        } else if(keyword == "vn"_s) {
+            ++out.normalCount;
+            if(out.objects.isEmpty()) out.hasDataBeforeFirstObject = true;
+
+        /* Index data, just mark that we found something for first unnamed
+           object */
+        } else if(keyword == "p"_s || keyword == "l"_s || keyword == "f"_s) {
+            if(out.objects.isEmpty()) out.hasDataBeforeFirstObject = true;
+        }
+    }
+}
+
+}
+
 void ObjImporter::parseMeshNames() {
+    /* Scan the file, in parallel if it's large enough and it's enabled */
+    const UnsignedInt chunkCount = Magnum::Implementation::parallelThreadCount(configuration().value<UnsignedInt>("threads"), _file->in.size()/MinChunkSize);
+    const Containers::Array<std::size_t> chunkOffsets = splitAtLines(_file->in, chunkCount);
+    Containers::Array<ObjectChunk> chunks{chunkCount};
+    Magnum::Implementation::parallelFor(chunkCount, chunkCount, [&](const std::size_t begin, const std::size_t end, UnsignedInt) {
+        for(std::size_t i = begin; i != end; ++i)
+            scanObjectChunk(_file->in, chunkOffsets[i], chunkOffsets[i + 1], chunks[i]);
+    });
+
     /* First mesh starts at the beginning, its indices start from 1. The end
-       offset will be updated to proper value later. */
+       offset and counts will be updated to proper values later. */
     UnsignedInt positionIndexOffset = 1;
     UnsignedInt normalIndexOffset = 1;
     UnsignedInt textureCoordinateIndexOffset = 1;
-    _file->meshes.emplace_back(0, 0, positionIndexOffset, normalIndexOffset, textureCoordinateIndexOffset);
+    arrayAppend(_file->meshes, Mesh{0, 0, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset, 0, 0, 0});
 
     /* The first mesh doesn't have name by default but we might find it later,
        so we need to track whether there are any data before first name */
     bool thisIsFirstMeshAndItHasNoData = true;
-    _file->meshNames.emplace_back();
-
-    while(_file->in->good()) {
-        /* The previous object might end at the beginning of this line */
-        const std::streampos end = _file->in->tellg();
-
-        /* Comment line */
-        if(_file->in->peek() == '#') {
-            ignoreLine(*_file->in);
-            continue;
-        }
-
-        /* Parse the keyword */
-        std::string keyword;
-        *_file->in >> keyword;
+    arrayAppend(_file->meshNames, InPlaceInit);
+
+    /* Set end offset and vertex data counts of the last mesh */
+    const auto finishMesh = [&](const std::size_t meshEnd, const UnsignedInt meshPositionIndexOffset, const UnsignedInt meshTextureCoordinateIndexOffset, const UnsignedInt meshNormalIndexOffset) {
+        Mesh& mesh = _file->meshes.back();
+        mesh.end = meshEnd;
+        mesh.positionCount = meshPositionIndexOffset - mesh.positionIndexOffset;
+        mesh.textureCoordinateCount = meshTextureCoordinateIndexOffset - mesh.textureCoordinateIndexOffset;
+        mesh.normalCount = meshNormalIndexOffset - mesh.normalIndexOffset;
+    };
+
+    /* Combine the chunks, in order */
+    for(const ObjectChunk& chunk: chunks) {
+        if(chunk.hasDataBeforeFirstObject)
+            thisIsFirstMeshAndItHasNoData = false;
 
-        /* Mesh name */
-        if(keyword == "o") {
-            std::string name;
-            std::getline(*_file->in, name);
-            name = Utility::String::trim(name);
+        for(const Object& object: chunk.objects) {
+            const UnsignedInt objectPositionIndexOffset = positionIndexOffset + object.positionCount;
+            const UnsignedInt objectTextureCoordinateIndexOffset = textureCoordinateIndexOffset + object.textureCoordinateCount;
+            const UnsignedInt objectNormalIndexOffset = normalIndexOffset + object.normalCount;
 
             /* This is the name of first mesh */
             if(thisIsFirstMeshAndItHasNoData) {
                 thisIsFirstMeshAndItHasNoData = false;
 
                 /* Update its name and add it to name map */
-                if(!name.empty())
-                    _file->meshesForName.emplace(name, _file->meshes.size() - 1);
-                _file->meshNames.back() = Utility::move(name);
+                if(!object.name.isEmpty())
+                    _file->meshesForName.emplace(object.name, _file->meshes.size() - 1);
+                _file->meshNames.back() = object.name;
 
                 /* Update its begin offset to be more precise */
-                std::get<0>(_file->meshes.back()) = _file->in->tellg();
+                _file->meshes.back().begin = object.dataBegin;
 
             /* Otherwise this is a name of new mesh */
             } else {
                 /* Set end of the previous one */
-                std::get<1>(_file->meshes.back()) = end;
+                finishMesh(object.lineBegin, objectPositionIndexOffset, objectTextureCoordinateIndexOffset, objectNormalIndexOffset);
 
                 /* Save name and offset of the new one. The end offset will be
                    updated later. */
-                if(!name.empty())
-                    _file->meshesForName.emplace(name, _file->meshes.size());
-                _file->meshNames.emplace_back(Utility::move(name));
-                _file->meshes.emplace_back(_file->in->tellg(), 0, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset);
-            }
-
-            continue;
-
-        /* If there are any data/indices before the first name, it means that
-           the first object is unnamed. We need to check for them. */
-
-        /* Vertex data, update index offset for the following meshes */
-        } else if(keyword == "v") {
-            ++positionIndexOffset;
-            thisIsFirstMeshAndItHasNoData = false;
-        } else if(keyword == "vt") {
-            ++textureCoordinateIndexOffset;
-            thisIsFirstMeshAndItHasNoData = false;
-        } else if(keyword == "vn") {
-            ++normalIndexOffset;
-            thisIsFirstMeshAndItHasNoData = false;
-
-        /* Index data, just mark that we found something for first unnamed
-           object */
-        } else if(thisIsFirstMeshAndItHasNoData) for(const std::string data: {"p", "l", "f"}) {
-            if(keyword == data) {
-                thisIsFirstMeshAndItHasNoData = false;
-                break;
+                if(!object.name.isEmpty())
+                    _file->meshesForName.emplace(object.name, _file->meshes.size());
+                arrayAppend(_file->meshNames, InPlaceInit, object.name);
+                arrayAppend(_file->meshes, Mesh{object.dataBegin, 0, objectPositionIndexOffset, objectTextureCoordinateIndexOffset, objectNormalIndexOffset, 0, 0, 0});
             }
         }
 
-        /* Ignore the rest of the line */
-        ignoreLine(*_file->in);
+        positionIndexOffset += chunk.positionCount;
+        textureCoordinateIndexOffset += chunk.textureCoordinateCount;
+        normalIndexOffset += chunk.normalCount;
     }
 
     /* Set end of the last object */
-    _file->in->clear();
-    _file->in->seekg(0, std::ios::end);
-    std::get<1>(_file->meshes.back()) = _file->in->tellg();
+    finishMesh(_file->in.size(), positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset);
 }
 
 UnsignedInt ObjImporter::doMeshCount() const { return _file->meshes.size(); }
@@ -235,15 +484,7 @@ template<class T> bool checkAndDuplicateInto(const Containers::StridedArrayView1
     return true;
 }
 
-}
-
-Containers::Optional<MeshData> ObjImporter::doMesh(UnsignedInt id, UnsignedInt) {
-    /* Seek the file, set mesh parsing parameters */
-    std::streampos begin, end;
-    UnsignedInt positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset;
-    std::tie(begin, end, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset) = _file->meshes[id];
-    _file->in->seekg(begin);
-
+struct MeshChunk {
     Containers::Optional<MeshPrimitive> primitive;
     Containers::Array<Vector3> positions;
     Containers::Array<Vector3> normals;
@@ -252,157 +493,262 @@ Containers::Optional<MeshData> ObjImporter::doMesh(UnsignedInt id, UnsignedInt)
        of data. First positions, then normals, then texture coordinates. */
     Containers::Array<Vector3ui> indices;
     std::size_t textureCoordinateIndexCount = 0, normalIndexCount = 0;
+};
 
-    try { while(_file->in->good() && _file->in->tellg() < end) {
-        /* Ignore comments */
-        if(_file->in->peek() == '#') {
-            ignoreLine(*_file->in);
-            continue;
-        }
-
-        /* Get the line */
-        std::string line;
-        std::getline(*_file->in, line);
-        line = Utility::String::trim(line);
-
-        /* Ignore empty lines */
-        if(line.empty()) continue;
-
+/* Parses given range of a mesh. Errors are printed to `error`, which is
+   nullptr for chunks parsed in parallel. */
+bool parseMeshChunk(std::ostream* const error, const Containers::StringView in, const UnsignedInt positionIndexOffset, const UnsignedInt textureCoordinateIndexOffset, const UnsignedInt normalIndexOffset, MeshChunk& out) {
+    for(const char* it = in.begin(); it != in.end(); ) {
         /* Split the line into keyword and contents */
-        const std::size_t keywordEnd = line.find(' ');
-        const std::string keyword = line.substr(0, keywordEnd);
-        const std::string contents = keywordEnd != std::string::npos ?
-            Utility::String::ltrim(line.substr(keywordEnd+1)) : "";
+        const Containers::StringView line = nextLine(it, in.end());
+        const char* contents = line.begin();
+        const Containers::StringView keyword = nextToken(contents, line.end());
+
+        /* Ignore empty lines and comments */
+        if(keyword.isEmpty() || keyword[0] == '#') continue;
 
         /* Vertex position */
-        if(keyword == "v") {
+        if(keyword == "v"_s) {
+            Vector3 data{NoInit};
             Float extra{1.0f};
-            const Vector3 data = extractFloatData<3>(contents, &extra);
+            if(!extractFloatData(error, line.slice(contents, line.end()), data, &extra))
+                return false;
             if(!Math::TypeTraits<Float>::equals(extra, 1.0f)) {
-                Error() << "Trade::ObjImporter::mesh(): homogeneous coordinates are not supported";
-                return Containers::NullOpt;
+                Error{error} << "Trade::ObjImporter::mesh(): homogeneous coordinates are not supported";
+                return false;
             }
 
-            arrayAppend(positions, data);
+            arrayAppend(out.positions, data);
 
         /* Texture coordinate */
-        } else if(keyword == "vt") {
+        } else if(keyword == "vt"_s) {
+            Vector2 data{NoInit};
             Float extra{0.0f};
-            const Vector2 data = extractFloatData<2>(contents, &extra);
+            if(!extractFloatData(error, line.slice(contents, line.end()), data, &extra))
+                return false;
             if(!Math::TypeTraits<Float>::equals(extra, 0.0f)) {
-                Error() << "Trade::ObjImporter::mesh(): 3D texture coordinates are not supported";
-                return Containers::NullOpt;
+                Error{error} << "Trade::ObjImporter::mesh(): 3D texture coordinates are not supported";
+                return false;
             }
 
-            arrayAppend(textureCoordinates, data);
+            arrayAppend(out.textureCoordinates, data);
 
         /* Normal */
-        } else if(keyword == "vn") {
-            arrayAppend(normals, Vector3{extractFloatData<3>(contents)});
+        } else if(keyword == "vn"_s) {
+            Vector3 data{NoInit};
+            if(!extractFloatData(error, line.slice(contents, line.end()), data))
+                return false;
+
+            arrayAppend(out.normals, data);
 
         /* Indices */
-        } else if(keyword == "p" || keyword == "l" || keyword == "f") {
-            const std::vector<std::string> indexTuples = Utility::String::splitWithoutEmptyParts(contents, ' ');
+        } else if(keyword == "p"_s || keyword == "l"_s || keyword == "f"_s) {
+            /* Gather the index tuples, one more than the max allowed to detect
+               polygons */
+            Containers::StringView indexTuples[4];
+            std::size_t indexTupleCount = 0;
+            while(indexTupleCount != Containers::arraySize(indexTuples)) {
+                const Containers::StringView indexTuple = nextToken(contents, line.end());
+                if(indexTuple.isEmpty()) break;
+                indexTuples[indexTupleCount++] = indexTuple;
+            }
 
             /* Points */
-            if(keyword == "p") {
+            if(keyword == "p"_s) {
                 /* Check that we don't mix the primitives in one mesh */
-                if(primitive && primitive != MeshPrimitive::Points) {
-                    Error() << "Trade::ObjImporter::mesh(): mixed primitive" << *primitive << "and" << MeshPrimitive::Points;
-                    return Containers::NullOpt;
+                if(out.primitive && out.primitive != MeshPrimitive::Points) {
+                    Error{error} << "Trade::ObjImporter::mesh(): mixed primitive" << *out.primitive << "and" << MeshPrimitive::Points;
+                    return false;
                 }
 
                 /* Check vertex count per primitive */
-                if(indexTuples.size() != 1) {
-                    Error() << "Trade::ObjImporter::mesh(): wrong index count for point";
-                    return Containers::NullOpt;
+                if(indexTupleCount != 1) {
+                    Error{error} << "Trade::ObjImporter::mesh(): wrong index count for point";
+                    return false;
                 }
 
-                primitive = MeshPrimitive::Points;
+                out.primitive = MeshPrimitive::Points;
 
             /* Lines */
-            } else if(keyword == "l") {
+            } else if(keyword == "l"_s) {
                 /* Check that we don't mix the primitives in one mesh */
-                if(primitive && primitive != MeshPrimitive::Lines) {
-                    Error() << "Trade::ObjImporter::mesh(): mixed primitive" << *primitive << "and" << MeshPrimitive::Lines;
-                    return Containers::NullOpt;
+                if(out.primitive && out.primitive != MeshPrimitive::Lines) {
+                    Error{error} << "Trade::ObjImporter::mesh(): mixed primitive" << *out.primitive << "and" << MeshPrimitive::Lines;
+                    return false;
                 }
 
                 /* Check vertex count per primitive */
-                if(indexTuples.size() != 2) {
-                    Error() << "Trade::ObjImporter::mesh(): wrong index count for line";
-                    return Containers::NullOpt;
+                if(indexTupleCount != 2) {
+                    Error{error} << "Trade::ObjImporter::mesh(): wrong index count for line";
+                    return false;
                 }
 
-                primitive = MeshPrimitive::Lines;
+                out.primitive = MeshPrimitive::Lines;
 
             /* Faces */
-            } else if(keyword == "f") {
+            } else if(keyword == "f"_s) {
                 /* Check that we don't mix the primitives in one mesh */
-                if(primitive && primitive != MeshPrimitive::Triangles) {
-                    Error() << "Trade::ObjImporter::mesh(): mixed primitive" << *primitive << "and" << MeshPrimitive::Triangles;
-                    return Containers::NullOpt;
+                if(out.primitive && out.primitive != MeshPrimitive::Triangles) {
+                    Error{error} << "Trade::ObjImporter::mesh(): mixed primitive" << *out.primitive << "and" << MeshPrimitive::Triangles;
+                    return false;
                 }
 
                 /* Check vertex count per primitive */
-                if(indexTuples.size() < 3) {
-                    Error() << "Trade::ObjImporter::mesh(): wrong index count for triangle";
-                    return Containers::NullOpt;
-                } else if(indexTuples.size() != 3) {
-                    Error() << "Trade::ObjImporter::mesh(): polygons are not supported";
-                    return Containers::NullOpt;
+                if(indexTupleCount < 3) {
+                    Error{error} << "Trade::ObjImporter::mesh(): wrong index count for triangle";
+                    return false;
+                } else if(indexTupleCount != 3) {
+                    Error{error} << "Trade::ObjImporter::mesh(): polygons are not supported";
+                    return false;
                 }
 
-                primitive = MeshPrimitive::Triangles;
+                out.primitive = MeshPrimitive::Triangles;
 
             } else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
 
-            for(const std::string& indexTuple: indexTuples) {
-                std::vector<std::string> indexStrings = Utility::String::split(indexTuple, '/');
-                if(indexStrings.size() > 3) {
-                    Error() << "Trade::ObjImporter::mesh(): invalid index data";
-                    return Containers::NullOpt;
+            for(std::size_t i = 0; i != indexTupleCount; ++i) {
+                /* Split the tuple on slashes, keeping empty parts */
+                Containers::StringView indexStrings[4];
+                std::size_t indexStringCount = 0;
+                const char* indexIt = indexTuples[i].begin();
+                const char* const indexEnd = indexTuples[i].end();
+                for(;;) {
+                    const char* const slash = static_cast<const char*>(std::memchr(indexIt, '/', indexEnd - indexIt));
+                    const char* const partEnd = slash ? slash : indexEnd;
+                    if(indexStringCount == Containers::arraySize(indexStrings)) {
+                        ++indexStringCount;
+                        break;
+                    }
+                    indexStrings[indexStringCount++] = {indexIt, std::size_t(partEnd - indexIt)};
+                    if(!slash) break;
+                    indexIt = slash + 1;
+                }
+                if(indexStringCount > 3) {
+                    Error{error} << "Trade::ObjImporter::mesh(): invalid index data";
+                    return false;
                 }
 
                 Vector3ui index;
 
                 /* Position indices */
-                index[0] = std::stoul(indexStrings[0]) - positionIndexOffset;
+                if(!parseIndex(indexStrings[0], index[0])) {
+                    Error{error} << "Trade::ObjImporter::mesh(): error while converting numeric data";
+                    return false;
+                }
+                index[0] -= positionIndexOffset;
 
                 /* Texture coordinates */
-                if(indexStrings.size() == 2 || (indexStrings.size() == 3 && !indexStrings[1].empty())) {
-                    index[2] = std::stoul(indexStrings[1]) - textureCoordinateIndexOffset;
-                    ++textureCoordinateIndexCount;
+                if(indexStringCount == 2 || (indexStringCount == 3 && !indexStrings[1].isEmpty())) {
+                    if(!parseIndex(indexStrings[1], index[2])) {
+                        Error{error} << "Trade::ObjImporter::mesh(): error while converting numeric data";
+                        return false;
+                    }
+                    index[2] -= textureCoordinateIndexOffset;
+                    ++out.textureCoordinateIndexCount;
                 }
 
                 /* Normal indices */
-                if(indexStrings.size() == 3) {
-                    index[1] = std::stoul(indexStrings[2]) - normalIndexOffset;
-                    ++normalIndexCount;
+                if(indexStringCount == 3) {
+                    if(!parseIndex(indexStrings[2], index[1])) {
+                        Error{error} << "Trade::ObjImporter::mesh(): error while converting numeric data";
+                        return false;
+                    }
+                    index[1] -= normalIndexOffset;
+                    ++out.normalIndexCount;
                 }
 
-                arrayAppend(indices, index);
+                arrayAppend(out.indices, index);
             }
 
         /* Ignore unsupported keywords, error out on unknown keywords */
-        } else if(![&keyword](){
-            /* Using lambda to emulate for-else construct like in Python */
-            for(const std::string expected: {"mtllib", "usemtl", "g", "s"})
-                if(keyword == expected) return true;
+        } else if(keyword != "mtllib"_s && keyword != "usemtl"_s && keyword != "g"_s && keyword != "s"_s) {
+            Error{error} << "Trade::ObjImporter::mesh(): unknown keyword" << keyword;
             return false;
-        }()) {
-            Error() << "Trade::ObjImporter::mesh(): unknown keyword" << keyword;
+        }
+    }
+
+    return true;
+}
+
+}
+
+Containers::Optional<MeshData> ObjImporter::doMesh(UnsignedInt id, UnsignedInt) {
+    /* Get the mesh range, set mesh parsing parameters */
+    const Mesh& mesh = _file->meshes[id];
+    const UnsignedInt positionIndexOffset = mesh.positionIndexOffset;
+    const UnsignedInt textureCoordinateIndexOffset = mesh.textureCoordinateIndexOffset;
+    const UnsignedInt normalIndexOffset = mesh.normalIndexOffset;
+    const Containers::StringView in = _file->in.slice(mesh.begin, mesh.end);
+
+    /* Parse the mesh, in parallel if it's large enough and it's enabled */
+    const UnsignedInt chunkCount = Magnum::Implementation::parallelThreadCount(configuration().value<UnsignedInt>("threads"), in.size()/MinChunkSize);
+    MeshChunk data;
+    if(chunkCount == 1) {
+        /* Vertex data counts are known from parseMeshNames(), so reserve them
+           upfront */
+        arrayReserve(data.positions, mesh.positionCount);
+        arrayReserve(data.normals, mesh.normalCount);
+        arrayReserve(data.textureCoordinates, mesh.textureCoordinateCount);
+        if(!parseMeshChunk(Error::output(), in, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset, data))
+            return Containers::NullOpt;
+
+    } else {
+        /* The chunks are parsed with errors silenced. As OBJ indices are
+           absolute, the chunks don't depend on each other and only need to be
+           concatenated in order afterwards. */
+        const Containers::Array<std::size_t> chunkOffsets = splitAtLines(in, chunkCount);
+        Containers::Array<MeshChunk> chunks{chunkCount};
+        Containers::Array<bool> chunkSuccess{ValueInit, chunkCount};
+        Magnum::Implementation::parallelFor(chunkCount, chunkCount, [&](const std::size_t begin, const std::size_t end, UnsignedInt) {
+            for(std::size_t i = begin; i != end; ++i)
+                chunkSuccess[i] = parseMeshChunk(nullptr, in.slice(chunkOffsets[i], chunkOffsets[i + 1]), positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset, chunks[i]);
+        });
+
+        /* If any chunk failed or the chunks have different primitives, the
+           mesh is invalid. Parse it again serially to print the same error
+           as the serial import would, which is the first error in the
+           file. */
+        bool success = true;
+        for(std::size_t i = 0; i != chunkCount; ++i) {
+            if(!chunkSuccess[i] || (chunks[i].primitive && data.primitive && *chunks[i].primitive != *data.primitive)) {
+                success = false;
+                break;
+            }
+            if(chunks[i].primitive) data.primitive = chunks[i].primitive;
+        }
+        if(!success) {
+            MeshChunk serial;
+            CORRADE_INTERNAL_ASSERT_OUTPUT(!parseMeshChunk(Error::output(), in, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset, serial));
             return Containers::NullOpt;
         }
 
-    }} catch(const std::exception&) {
-        Error() << "Trade::ObjImporter::mesh(): error while converting numeric data";
-        return Containers::NullOpt;
-    } catch(...) {
-        /* Error message already printed */
-        return Containers::NullOpt;
+        /* Concatenate the chunks */
+        std::size_t indexCount = 0;
+        for(const MeshChunk& chunk: chunks) {
+            indexCount += chunk.indices.size();
+            data.textureCoordinateIndexCount += chunk.textureCoordinateIndexCount;
+            data.normalIndexCount += chunk.normalIndexCount;
+        }
+        arrayReserve(data.positions, mesh.positionCount);
+        arrayReserve(data.normals, mesh.normalCount);
+        arrayReserve(data.textureCoordinates, mesh.textureCoordinateCount);
+        arrayReserve(data.indices, indexCount);
+        for(const MeshChunk& chunk: chunks) {
+            arrayAppend(data.positions, chunk.positions);
+            arrayAppend(data.normals, chunk.normals);
+            arrayAppend(data.textureCoordinates, chunk.textureCoordinates);
+            arrayAppend(data.indices, chunk.indices);
+        }
     }
 
+    const Containers::Optional<MeshPrimitive>& primitive = data.primitive;
+    const Containers::Array<Vector3>& positions = data.positions;
+    const Containers::Array<Vector3>& normals = data.normals;
+    const Containers::Array<Vector2>& textureCoordinates = data.textureCoordinates;
+    Containers::Array<Vector3ui>& indices = data.indices;
+    const std::size_t textureCoordinateIndexCount = data.textureCoordinateIndexCount;
+    const std::size_t normalIndexCount = data.normalIndexCount;
+
     /* There should be at least indexed position data */
     if(positions.isEmpty() || indices.isEmpty()) {
         Error() << "Trade::ObjImporter::mesh(): incomplete position data";
@@ -106,6 +106,31 @@ positions with optional @ref VertexFormat::Vector3 normals and
 @ref VertexFormat::Vector2 texture coordinates, if present in the source file.
 
 Polygons (quads etc.) and material properties are currently not supported.
+
+The file is parsed directly from memory without any intermediate copies. On
+platforms that support it, @ref openFile() memory-maps the file, data passed
+to @ref openMemory() are referenced without a copy and data passed to
+@ref openData() are taken over if they're owned. Plain decimal numbers are
+parsed independently of the current C locale. Special values such as
+@cb{.ini} nan @ce or @cb{.ini} inf @ce, hexadecimal floats and numbers with
+trailing characters are accepted as well, those are delegated to
+@ref std::strtof() and thus depend on the C locale.
+
+Large files can be parsed on multiple threads by setting the
+@cb{.ini} threads @ce @ref Trade-ObjImporter-configuration "configuration option".
+The file and each mesh are then split into chunks at line boundaries, which
+are parsed in parallel and concatenated afterwards. The imported data as well
+as error messages are the same as with a serial import.
+
+@section Trade-ObjImporter-configuration Plugin-specific configuration
+
+It's possible to tune various import options through @ref configuration(). See
+below for all options and their default values:
+
+@snippet MagnumPlugins/ObjImporter/ObjImporter.conf configuration_
+
+See @ref plugins-configuration for more information and an example showing how
+to edit the configuration values.
 */
 class MAGNUM_OBJIMPORTER_EXPORT ObjImporter: public AbstractImporter {
     public:
@@ -24,14 +24,21 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/String.h>
+#include <Corrade/Containers/StringView.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/ConfigurationGroup.h>
 #include <Corrade/Utility/Format.h>
 #include <Corrade/Utility/Path.h>
 
 #include "Magnum/Mesh.h"
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Vector3.h"
 #include "Magnum/Trade/AbstractImporter.h"
 #include "Magnum/Trade/MeshData.h"
@@ -40,6 +47,8 @@
 
 namespace Magnum { namespace Trade { namespace Test { namespace {
 
+using namespace Containers::Literals;
+
 struct ObjImporterTest: TestSuite::Tester {
     explicit ObjImporterTest();
 
@@ -57,11 +66,15 @@ struct ObjImporterTest: TestSuite::Tester {
     void meshTextureCoordinatesNormals();
 
     void meshIgnoredKeyword();
+    void meshWhitespaceNumberFormats();
+    void meshSpecialNumberFormats();
 
     void meshNamed();
     void meshNamedFirstUnnamed();
 
     void moreMeshes();
+    void moreMeshesMultithreaded();
+    void moreMeshesMultithreadedInvalid();
 
     /* Technically, all invalid cases could be put into a single file, but
        because the indexing is global, it would get increasingly hard to
@@ -76,6 +89,7 @@ struct ObjImporterTest: TestSuite::Tester {
     void invalidIncompleteData();
     void invalidOptionalCoordinate();
 
+    void openMemory();
     void openTwice();
     void importTwice();
 
@@ -166,6 +180,45 @@ const struct {
     {"texture with optional third component not zero", "3D texture coordinates are not supported"}
 };
 
+const struct {
+    const char* name;
+    UnsignedInt threadCount;
+} MultithreadedData[]{
+    {"2 threads", 2},
+    {"3 threads", 3},
+    {"7 threads", 7},
+    {"all threads", 0},
+};
+
+const struct {
+    const char* name;
+    const char* suffix;
+    const char* message;
+} MultithreadedInvalidData[]{
+    {"mixed primitives", "p 1\n",
+        "mixed primitive MeshPrimitive::Triangles and MeshPrimitive::Points"},
+    {"unknown keyword", "bleh\n",
+        "unknown keyword bleh"},
+    {"invalid float literal", "v 1 bleh 2\n",
+        "error while converting numeric data"},
+};
+
+/* Shared among all plugins that implement data copying optimizations */
+const struct {
+    const char* name;
+    bool(*open)(AbstractImporter&, Containers::ArrayView<const void>);
+} OpenMemoryData[]{
+    {"data", [](AbstractImporter& importer, Containers::ArrayView<const void> data) {
+        /* Copy to ensure the original memory isn't referenced */
+        Containers::Array<char> copy{NoInit, data.size()};
+        Utility::copy(Containers::arrayCast<const char>(data), copy);
+        return importer.openData(copy);
+    }},
+    {"memory", [](AbstractImporter& importer, Containers::ArrayView<const void> data) {
+        return importer.openMemory(data);
+    }},
+};
+
 ObjImporterTest::ObjImporterTest() {
     addTests({&ObjImporterTest::empty,
 
@@ -180,6 +233,8 @@ ObjImporterTest::ObjImporterTest() {
               &ObjImporterTest::meshTextureCoordinatesNormals,
 
               &ObjImporterTest::meshIgnoredKeyword,
+              &ObjImporterTest::meshWhitespaceNumberFormats,
+              &ObjImporterTest::meshSpecialNumberFormats,
 
               &ObjImporterTest::meshNamed});
 
@@ -188,6 +243,12 @@ ObjImporterTest::ObjImporterTest() {
 
     addTests({&ObjImporterTest::moreMeshes});
 
+    addInstancedTests({&ObjImporterTest::moreMeshesMultithreaded},
+        Containers::arraySize(MultithreadedData));
+
+    addInstancedTests({&ObjImporterTest::moreMeshesMultithreadedInvalid},
+        Containers::arraySize(MultithreadedInvalidData));
+
     addInstancedTests({&ObjImporterTest::invalid},
         Containers::arraySize(InvalidData));
 
@@ -209,6 +270,9 @@ ObjImporterTest::ObjImporterTest() {
     addInstancedTests({&ObjImporterTest::invalidOptionalCoordinate},
         Containers::arraySize(InvalidOptionalCoordinateData));
 
+    addInstancedTests({&ObjImporterTest::openMemory},
+        Containers::arraySize(OpenMemoryData));
+
     addTests({&ObjImporterTest::openTwice,
               &ObjImporterTest::importTwice});
 
@@ -451,6 +515,69 @@ void ObjImporterTest::meshIgnoredKeyword() {
         TestSuite::Compare::Container);
 }
 
+void ObjImporterTest::meshWhitespaceNumberFormats() {
+    /* CRLF line endings, tabs, redundant whitespace, various number formats
+       and no newline at the end of the file */
+    const char data[] =
+        "# comment\r\n"
+        "  \t# indented comment\r\n"
+        "\r\n"
+        "o\tMesh name with spaces \t\r\n"
+        "v 1.5e1 -.25\t+3\r\n"
+        "\tv  0.1   -2E-1 4.\r\n"
+        "v 1e+2 0 -0 1.0\r\n"
+        "vn 0.0 1.000000000000000000000000001 0\r\n"
+        "f   1//1\t2//1  3//1 \r\n"
+        "f 3//1 2//1 1//1";
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    CORRADE_VERIFY(importer->openData(Containers::arrayView(data).exceptSuffix(1)));
+    CORRADE_COMPARE(importer->meshCount(), 1);
+    CORRADE_COMPARE(importer->meshName(0), "Mesh name with spaces");
+    CORRADE_COMPARE(importer->meshForName("Mesh name with spaces"), 0);
+
+    const Containers::Optional<MeshData> mesh = importer->mesh(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE_AS(mesh->attribute<Vector3>(MeshAttribute::Position),
+        Containers::arrayView<Vector3>({
+            {15.0f, -0.25f, 3.0f},
+            {0.1f, -0.2f, 4.0f},
+            {100.0f, 0.0f, -0.0f}
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(mesh->attribute<Vector3>(MeshAttribute::Normal),
+        Containers::arrayView<Vector3>({
+            {0.0f, 1.0f, 0.0f},
+            {0.0f, 1.0f, 0.0f},
+            {0.0f, 1.0f, 0.0f}
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(mesh->indices<UnsignedInt>(),
+        Containers::arrayView<UnsignedInt>({0, 1, 2, 2, 1, 0}),
+        TestSuite::Compare::Container);
+}
+
+void ObjImporterTest::meshSpecialNumberFormats() {
+    /* Formats that aren't handled by the fast float parsing path but are
+       accepted by std::strtof() */
+    const char data[] =
+        "v nan inf -INF\n"
+        "v 0x1p3 1.5abc -0x.8p1\n"
+        "p 1\n"
+        "p 2\n";
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    CORRADE_VERIFY(importer->openData(Containers::arrayView(data).exceptSuffix(1)));
+
+    const Containers::Optional<MeshData> mesh = importer->mesh(0);
+    CORRADE_VERIFY(mesh);
+    const Containers::StridedArrayView1D<const Vector3> positions = mesh->attribute<Vector3>(MeshAttribute::Position);
+    CORRADE_COMPARE(positions.size(), 2);
+    CORRADE_VERIFY(Math::isNan(positions[0].x()));
+    CORRADE_COMPARE(positions[0].y(), Constants::inf());
+    CORRADE_COMPARE(positions[0].z(), -Constants::inf());
+    CORRADE_COMPARE(positions[1], (Vector3{8.0f, 1.5f, -1.0f}));
+}
+
 void ObjImporterTest::meshNamed() {
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
     CORRADE_VERIFY(importer->openFile(Utility::Path::join(OBJIMPORTER_TEST_DIR, "mesh-named.obj")));
@@ -554,6 +681,126 @@ void ObjImporterTest::moreMeshes() {
         TestSuite::Compare::Container);
 }
 
+void appendString(Containers::Array<char>& out, const Containers::StringView string) {
+    arrayAppend(out, Containers::arrayView(string.data(), string.size()));
+}
+
+/* Large enough to be split into several chunks. Two meshes, each with 3000
+   positions and texture coordinates, 1000 normals and 6000 triangles. */
+Containers::Array<char> manyMeshesData() {
+    Containers::Array<char> out;
+    for(const char* name: {"first", "second"}) {
+        appendString(out, Utility::format("o {}\n# {} positions\n", name, 3000));
+        for(UnsignedInt i = 0; i != 3000; ++i)
+            appendString(out, Utility::format("v {} {} {}\n", i*0.25f, -Float(i%17), i*1.5e-3f));
+        for(UnsignedInt i = 0; i != 3000; ++i)
+            appendString(out, Utility::format("vt {} {}\n", (i%100)*0.01f, (i/100)*0.01f));
+        for(UnsignedInt i = 0; i != 1000; ++i)
+            appendString(out, Utility::format("vn {} {} 1\n", (i%10)*0.1f, (i/10)*0.01f));
+    }
+
+    /* The second mesh is referencing data after the first mesh, put the
+       faces at the end so the offsets are exercised */
+    for(UnsignedInt i = 0; i != 6000; ++i) {
+        const UnsignedInt a = 3001 + i % 3000,
+            b = 3001 + (i*7 + 1) % 3000,
+            c = 3001 + (i*13 + 2) % 3000,
+            n = 1001 + i % 1000;
+        appendString(out, Utility::format("f {0}/{0}/{3} {1}/{1}/{3} {2}/{2}/{3}\n", a, b, c, n));
+    }
+
+    return out;
+}
+
+void ObjImporterTest::moreMeshesMultithreaded() {
+    auto&& data = MultithreadedData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Containers::Array<char> file = manyMeshesData();
+    CORRADE_COMPARE_AS(file.size(), 256*1024,
+        TestSuite::Compare::Greater);
+
+    Containers::Pointer<AbstractImporter> serialImporter = _manager.instantiate("ObjImporter");
+    CORRADE_COMPARE(serialImporter->configuration().value<UnsignedInt>("threads"), 1);
+    CORRADE_VERIFY(serialImporter->openData(file));
+    CORRADE_COMPARE(serialImporter->meshCount(), 2);
+    CORRADE_COMPARE(serialImporter->meshName(0), "first");
+    CORRADE_COMPARE(serialImporter->meshName(1), "second");
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    importer->configuration().setValue("threads", data.threadCount);
+    CORRADE_VERIFY(importer->openData(file));
+    CORRADE_COMPARE(importer->meshCount(), 2);
+    CORRADE_COMPARE(importer->meshName(0), "first");
+    CORRADE_COMPARE(importer->meshName(1), "second");
+    CORRADE_COMPARE(importer->meshForName("second"), 1);
+
+    /* The first mesh has only vertex data and no indices */
+    {
+        Containers::String out;
+        Error redirectError{&out};
+        CORRADE_VERIFY(!importer->mesh(0));
+        CORRADE_COMPARE(out, "Trade::ObjImporter::mesh(): incomplete position data\n");
+    }
+
+    Containers::Optional<MeshData> expected = serialImporter->mesh(1);
+    CORRADE_VERIFY(expected);
+    CORRADE_COMPARE(expected->indexCount(), 18000);
+
+    Containers::Optional<MeshData> mesh = importer->mesh(1);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->primitive(), expected->primitive());
+    CORRADE_COMPARE(mesh->attributeCount(), 3);
+    CORRADE_COMPARE(mesh->vertexCount(), expected->vertexCount());
+    CORRADE_COMPARE_AS(mesh->indexData(),
+        expected->indexData(),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(mesh->vertexData(),
+        expected->vertexData(),
+        TestSuite::Compare::Container);
+}
+
+void ObjImporterTest::moreMeshesMultithreadedInvalid() {
+    auto&& data = MultithreadedInvalidData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Put an invalid line both at the end and after the first quarter of the
+       second mesh to verify the first error is reported, same as with the
+       serial import */
+    Containers::Array<char> file = manyMeshesData();
+    const Containers::StringView fileView{file.data(), file.size()};
+    const Containers::StringView faces = fileView.find("\nf ");
+    CORRADE_VERIFY(faces.data());
+    const std::size_t quarter = faces.begin() + 1 - fileView.begin() + (fileView.end() - faces.begin())/4;
+    const Containers::StringView quarterLine = fileView.slice(quarter, fileView.size()).find("\n");
+    CORRADE_VERIFY(quarterLine.data());
+    const std::size_t split = quarterLine.end() - fileView.begin();
+
+    Containers::Array<char> invalid;
+    arrayAppend(invalid, file.prefix(split));
+    appendString(invalid, data.suffix);
+    arrayAppend(invalid, file.exceptPrefix(split));
+    appendString(invalid, "p 1 2\n"_s);
+
+    Containers::String expected;
+    {
+        Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+        CORRADE_VERIFY(importer->openData(invalid));
+        Error redirectError{&expected};
+        CORRADE_VERIFY(!importer->mesh("second"));
+    }
+    CORRADE_COMPARE(expected, Utility::format("Trade::ObjImporter::mesh(): {}\n", data.message));
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    importer->configuration().setValue("threads", 4);
+    CORRADE_VERIFY(importer->openData(invalid));
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->mesh("second"));
+    CORRADE_COMPARE(out, expected);
+}
+
 void ObjImporterTest::invalid() {
     auto&& data = InvalidData[testCaseInstanceId()];
     setTestCaseDescription(data.name);
@@ -665,6 +912,34 @@ void ObjImporterTest::invalidOptionalCoordinate() {
     CORRADE_COMPARE(out, Utility::format("Trade::ObjImporter::mesh(): {}\n", data.message));
 }
 
+void ObjImporterTest::openMemory() {
+    /* Same as meshPrimitivePoints() except that it uses openData() &
+       openMemory() to test data copying on import */
+
+    auto&& data = OpenMemoryData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Optional<Containers::Array<char>> file = Utility::Path::read(Utility::Path::join(OBJIMPORTER_TEST_DIR, "mesh-primitive-points.obj"));
+    CORRADE_VERIFY(file);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    CORRADE_VERIFY(data.open(*importer, Containers::arrayView(*file)));
+    CORRADE_COMPARE(importer->meshCount(), 1);
+
+    const Containers::Optional<MeshData> mesh = importer->mesh(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Points);
+    CORRADE_COMPARE_AS(mesh->attribute<Vector3>(MeshAttribute::Position),
+        Containers::arrayView<Vector3>({
+            {0.5f, 2.0f, 3.0f},
+            {2.0f, 3.0f, 5.0f},
+            {0.0f, 1.5f, 1.0f}
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(mesh->indices<UnsignedInt>(),
+        Containers::arrayView<UnsignedInt>({0, 1, 2, 0}),
+        TestSuite::Compare::Container);
+}
+
 void ObjImporterTest::openTwice() {
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
 
@@ -27,6 +27,7 @@
 
 #include <string> /** @todo remove once AbstractImporter is <string>-free */
 #include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/Containers/StringStl.h> /** @todo remove once AbstractImporter is <string>-free */
 #include <Corrade/TestSuite/Tester.h>
@@ -39,6 +40,14 @@
 
 namespace Magnum { namespace Audio { namespace Test { namespace {
 
+const struct {
+    const char* name;
+    bool openData;
+} DataIntoData[]{
+    {"memory-mapped file", false},
+    {"data", true}
+};
+
 struct WavImporterTest: TestSuite::Tester {
     explicit WavImporterTest();
 
@@ -80,6 +89,8 @@ struct WavImporterTest: TestSuite::Tester {
     void surround51Channel16();
     void surround71Channel24();
 
+    void dataInto();
+
     /* Explicitly forbid system-wide plugin dependencies */
     PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
 };
@@ -123,6 +134,9 @@ WavImporterTest::WavImporterTest() {
               &WavImporterTest::surround51Channel16,
               &WavImporterTest::surround71Channel24});
 
+    addInstancedTests({&WavImporterTest::dataInto},
+        Containers::arraySize(DataIntoData));
+
     /* Load the plugin directly from the build tree. Otherwise it's static and
        already loaded. */
     #ifdef WAVAUDIOIMPORTER_PLUGIN_FILENAME
@@ -471,6 +485,40 @@ void WavImporterTest::surround71Channel24() {
     CORRADE_COMPARE(out, "Audio::WavImporter::openData(): unsupported format Audio::WavAudioFormat::Extensible\n");
 }
 
+void WavImporterTest::dataInto() {
+    auto&& data = DataIntoData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Big-Endian data to verify the endian swap is done on the chunks as
+       well */
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
+    const Containers::String filename = Utility::Path::join(WAVAUDIOIMPORTER_TEST_DIR, "stereo64fbe.wav");
+    if(data.openData) {
+        Containers::Optional<Containers::Array<char>> file = Utility::Path::read(filename);
+        CORRADE_VERIFY(file);
+        CORRADE_VERIFY(importer->openData(*file));
+    } else CORRADE_VERIFY(importer->openFile(filename));
+
+    CORRADE_COMPARE(importer->format(), BufferFormat::StereoDouble);
+    CORRADE_COMPARE(importer->dataSize(), 8*8);
+
+    /* Reading three samples at a time, the last chunk is shorter */
+    Double out[8]{};
+    CORRADE_COMPARE(importer->dataInto(0, Containers::arrayCast<char>(Containers::arrayView(out).prefix(3))), 3*8);
+    CORRADE_COMPARE(importer->dataInto(3*8, Containers::arrayCast<char>(Containers::arrayView(out).sliceSize(3, 3))), 3*8);
+    Double last[3]{};
+    CORRADE_COMPARE(importer->dataInto(6*8, Containers::arrayCast<char>(Containers::arrayView(last))), 2*8);
+    out[6] = last[0];
+    out[7] = last[1];
+    CORRADE_COMPARE_AS(Containers::arrayView(out),
+        Containers::arrayView<Double>({
+            0.0, 0.0, 0.0, 0.0, 3.0517578125e-05, 6.103515625e-05, -9.1552734375e-05, 0.0}),
+        TestSuite::Compare::Container);
+
+    /* Reading at the end gives back nothing */
+    CORRADE_COMPARE(importer->dataInto(8*8, Containers::arrayCast<char>(Containers::arrayView(last))), 0);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Audio::Test::WavImporterTest)
@@ -27,10 +27,17 @@
 
 #include "WavImporter.h"
 
+#include <string> /** @todo remove once AbstractImporter is <string>-free */
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StringStl.h> /** @todo remove once AbstractImporter is <string>-free */
 #include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/Assert.h>
 #include <Corrade/Utility/Debug.h>
+#include <Corrade/Utility/DebugStl.h> /** @todo remove once AbstractImporter is <string>-free */
 #include <Corrade/Utility/EndiannessBatch.h>
+#include <Corrade/Utility/Path.h>
+
+#include "Magnum/Math/Functions.h"
 
 #include "MagnumPlugins/WavAudioImporter/WavHeader.h"
 
@@ -41,19 +48,67 @@ using Implementation::WavAudioFormat;
 using Implementation::WavFormatChunk;
 using Implementation::WavHeaderChunk;
 
+struct WavImporter::MappedFile {
+    #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+    Containers::Array<const char, Utility::Path::MapDeleter> data;
+    #endif
+};
+
 WavImporter::WavImporter() = default;
 
 WavImporter::WavImporter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin): AbstractImporter{manager, plugin} {}
 
+WavImporter::~WavImporter() = default;
+
 ImporterFeatures WavImporter::doFeatures() const { return ImporterFeature::OpenData; }
 
-bool WavImporter::doIsOpened() const { return !!_data; }
+bool WavImporter::doIsOpened() const { return _opened; }
 
 void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
+    if(!openInternal(data)) return;
+
+    /* Copy the data, as the view isn't guaranteed to stay in scope, and fix
+       the endianness on the copy so it doesn't need to be done on access */
+    _data = Containers::Array<char>{NoInit, _samples.size()};
+    Utility::copy(_samples, _data);
+    if(_swapSize == 2)
+        Utility::Endianness::swapInPlace(Containers::arrayCast<std::uint16_t>(_data));
+    else if(_swapSize == 4)
+        Utility::Endianness::swapInPlace(Containers::arrayCast<std::uint32_t>(_data));
+    else if(_swapSize == 8)
+        Utility::Endianness::swapInPlace(Containers::arrayCast<std::uint64_t>(_data));
+    else CORRADE_INTERNAL_ASSERT(_swapSize == 0);
+
+    _samples = _data;
+    _swapSize = 0;
+    _opened = true;
+}
+
+void WavImporter::doOpenFile(const std::string& filename) {
+    #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+    /* Map the file and keep it mapped, the data are then converted only when
+       accessed */
+    Containers::Optional<Containers::Array<const char, Utility::Path::MapDeleter>> data = Utility::Path::mapRead(filename);
+    if(!data) {
+        Error() << "Audio::WavImporter::openFile(): cannot open file" << filename;
+        return;
+    }
+
+    if(!openInternal(*data)) return;
+
+    _mappedFile.emplace();
+    _mappedFile->data = *std::move(data);
+    _opened = true;
+    #else
+    AbstractImporter::doOpenFile(filename);
+    #endif
+}
+
+bool WavImporter::openInternal(const Containers::ArrayView<const char> data) {
     /* Check file size */
     if(data.size() < sizeof(WavHeaderChunk) + sizeof(WavFormatChunk) + sizeof(RiffChunk)) {
         Error() << "Audio::WavImporter::openData(): the file is too short:" << data.size() << "bytes";
-        return;
+        return {};
     }
 
     /* Get the RIFF/WAV header */
@@ -63,7 +118,7 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
     if((std::strncmp(header.chunk.chunkId, "RIFF", 4) != 0 && std::strncmp(header.chunk.chunkId, "RIFX", 4) != 0) ||
        std::strncmp(header.format, "WAVE", 4) != 0) {
         Error() << "Audio::WavImporter::openData(): the file signature is invalid";
-        return;
+        return {};
     }
 
     /* Check if the file is Big-Endian. While RIFX files are extremely rare,
@@ -78,7 +133,7 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
     if(header.chunk.chunkSize < 36 || header.chunk.chunkSize + 8 != data.size()) {
         Error() << "Audio::WavImporter::openData(): the file has improper size, expected"
                 << header.chunk.chunkSize + 8 << "but got" << data.size();
-        return;
+        return {};
     }
 
     const RiffChunk* dataChunk = nullptr;
@@ -102,7 +157,7 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
         if(std::strncmp(currChunk->chunkId, "fmt ", 4) == 0) {
             if(formatChunk) {
                 Error() << "Audio::WavImporter::openData(): the file contains too many format chunks";
-                return;
+                return {};
             }
 
             formatChunk = WavFormatChunk{*reinterpret_cast<const WavFormatChunk*>(currChunk)};
@@ -110,7 +165,7 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
         } else if(std::strncmp(currChunk->chunkId, "data", 4) == 0) {
             if(dataChunk != nullptr) {
                 Error() << "Audio::WavImporter::openData(): the file contains too many data chunks";
-                return;
+                return {};
             }
 
             dataChunk = currChunk;
@@ -122,13 +177,13 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
     /* Make sure we actually got a format chunk */
     if(!formatChunk) {
         Error() << "Audio::WavImporter::openData(): the file contains no format chunk";
-        return;
+        return {};
     }
 
     /* Make sure we actually got a data chunk */
     if(dataChunk == nullptr) {
         Error() << "Audio::WavImporter::openData(): the file contains no data chunk";
-        return;
+        return {};
     }
 
     /* Fix endianness on Format chunk */
@@ -154,7 +209,7 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
             Error() << "Audio::WavImporter::openData(): PCM with unsupported channel count"
                     << formatChunk->numChannels << "with" << formatChunk->bitsPerSample
                     << "bits per sample";
-            return;
+            return {};
         }
 
     /* Check IEEE Float format */
@@ -171,7 +226,7 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
             Error() << "Audio::WavImporter::openData(): IEEE with unsupported channel count"
                     << formatChunk->numChannels << "with" << formatChunk->bitsPerSample
                     << "bits per sample";
-            return;
+            return {};
         }
 
     /* Check A-Law format */
@@ -184,7 +239,7 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
             Error() << "Audio::WavImporter::openData(): ALaw with unsupported channel count"
                     << formatChunk->numChannels << "with" << formatChunk->bitsPerSample
                     << "bits per sample";
-            return;
+            return {};
         }
 
     /* Check μ-Law format */
@@ -197,59 +252,82 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
             Error() << "Audio::WavImporter::openData(): MuLaw with unsupported channel count"
                     << formatChunk->numChannels << "with" << formatChunk->bitsPerSample
                     << "bits per sample";
-            return;
+            return {};
         }
 
     /* Unknown/unimplemented format */
     } else {
         Error() << "Audio::WavImporter::openData(): unsupported format" << formatChunk->audioFormat;
-        return;
+        return {};
     }
 
     /* Size sanity checks */
     if(headerSize + offset > data.size()) {
         Error() << "Audio::WavImporter::openData(): file size doesn't match computed size";
-        return;
+        return {};
     }
 
     /* Format sanity checks */
     if(formatChunk->blockAlign != formatChunk->numChannels * formatChunk->bitsPerSample / 8 ||
        formatChunk->byteRate != formatChunk->sampleRate * formatChunk->blockAlign) {
         Error() << "Audio::WavImporter::openData(): the file is corrupted";
-        return;
+        return {};
     }
 
     /* Save frequency */
     _frequency = formatChunk->sampleRate;
 
-    /* Copy the data */
-    _data = Containers::Array<char>{NoInit, dataChunkSize};
-    Utility::copy(Containers::arrayView(reinterpret_cast<const char*>(dataChunk + 1), dataChunkSize), *_data);
+    /* Save a view on the data, remember if the data need endian swapping */
+    _samples = Containers::arrayView(reinterpret_cast<const char*>(dataChunk + 1), dataChunkSize);
+    if(hasBigEndianData != Utility::Endianness::isBigEndian() && formatChunk->bitsPerSample != 8) {
+        CORRADE_INTERNAL_ASSERT(formatChunk->bitsPerSample == 16 || formatChunk->bitsPerSample == 32 || formatChunk->bitsPerSample == 64);
+        _swapSize = formatChunk->bitsPerSample/8;
+    } else _swapSize = 0;
 
-    /* Fix the data endianness */
-    if(hasBigEndianData != Utility::Endianness::isBigEndian()) {
-        if(formatChunk->bitsPerSample == 16)
-            Utility::Endianness::swapInPlace(Containers::arrayCast<std::uint16_t>(*_data));
-        else if(formatChunk->bitsPerSample == 32)
-            Utility::Endianness::swapInPlace(Containers::arrayCast<std::uint32_t>(*_data));
-        else if(formatChunk->bitsPerSample == 64)
-            Utility::Endianness::swapInPlace(Containers::arrayCast<std::uint64_t>(*_data));
-        else CORRADE_INTERNAL_ASSERT(formatChunk->bitsPerSample == 8);
-    }
+    return true;
 }
 
-void WavImporter::doClose() { _data = Containers::NullOpt; }
+void WavImporter::doClose() {
+    _data = nullptr;
+    _mappedFile = nullptr;
+    _samples = nullptr;
+    _opened = false;
+}
 
 BufferFormat WavImporter::doFormat() const { return _format; }
 
 UnsignedInt WavImporter::doFrequency() const { return _frequency; }
 
 Containers::Array<char> WavImporter::doData() {
-    Containers::Array<char> copy{NoInit, _data->size()};
-    Utility::copy(*_data, copy);
+    Containers::Array<char> copy{NoInit, _samples.size()};
+    doDataInto(0, copy);
     return copy;
 }
 
+std::size_t WavImporter::doDataSize() {
+    return _samples.size();
+}
+
+std::size_t WavImporter::doDataInto(const std::size_t offset, const Containers::ArrayView<char> out) {
+    const std::size_t size = Math::min(out.size(), _samples.size() - offset);
+    CORRADE_ASSERT(!_swapSize || (offset % _swapSize == 0 && size % _swapSize == 0),
+        "Audio::WavImporter::dataInto(): expected offset and size to be a multiple of" << _swapSize << "bytes for data with a different endianness, got" << offset << "and" << size, {});
+
+    const Containers::ArrayView<char> chunk = out.prefix(size);
+    Utility::copy(_samples.sliceSize(offset, size), chunk);
+
+    /* Fix the data endianness */
+    if(_swapSize == 2)
+        Utility::Endianness::swapInPlace(Containers::arrayCast<std::uint16_t>(chunk));
+    else if(_swapSize == 4)
+        Utility::Endianness::swapInPlace(Containers::arrayCast<std::uint32_t>(chunk));
+    else if(_swapSize == 8)
+        Utility::Endianness::swapInPlace(Containers::arrayCast<std::uint64_t>(chunk));
+    else CORRADE_INTERNAL_ASSERT(_swapSize == 0);
+
+    return size;
+}
+
 }}
 
 CORRADE_PLUGIN_REGISTER(WavAudioImporter, Magnum::Audio::WavImporter,
@@ -32,7 +32,7 @@
  */
 
 #include <Corrade/Containers/Array.h>
-#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Pointer.h>
 
 #include "Magnum/Audio/AbstractImporter.h"
 
@@ -117,6 +117,14 @@ Supports mono and stereo files of the following formats:
 Both Little-Endian files (with a `RIFF` header) and Big-Endian files (with
 a `RIFX` header) are supported, data is converted to machine endian on import.
 
+Files opened with @ref openFile() are memory-mapped on platforms that support
+it and the data are converted on access, so retrieving them in chunks with
+@ref dataInto() doesn't need to keep a copy of the whole file in memory. With
+@ref openData(), the sample data are copied out of the passed view, as it's
+not guaranteed to stay in scope. For Big-Endian files, the @p offset and the
+output size passed to @ref dataInto() are expected to be a multiple of the
+sample size, otherwise the data can't be converted.
+
 Multi-channel formats are not supported.
 */
 class MAGNUM_WAVAUDIOIMPORTER_EXPORT WavImporter: public AbstractImporter {
@@ -127,17 +135,37 @@ class MAGNUM_WAVAUDIOIMPORTER_EXPORT WavImporter: public AbstractImporter {
         /** @brief Plugin manager constructor */
         explicit WavImporter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin);
 
+        ~WavImporter();
+
     private:
+        struct MappedFile;
+
         MAGNUM_WAVAUDIOIMPORTER_LOCAL ImporterFeatures doFeatures() const override;
         MAGNUM_WAVAUDIOIMPORTER_LOCAL bool doIsOpened() const override;
         MAGNUM_WAVAUDIOIMPORTER_LOCAL void doOpenData(Containers::ArrayView<const char> data) override;
+        MAGNUM_WAVAUDIOIMPORTER_LOCAL void doOpenFile(const std::string& filename) override;
         MAGNUM_WAVAUDIOIMPORTER_LOCAL void doClose() override;
 
         MAGNUM_WAVAUDIOIMPORTER_LOCAL BufferFormat doFormat() const override;
         MAGNUM_WAVAUDIOIMPORTER_LOCAL UnsignedInt doFrequency() const override;
         MAGNUM_WAVAUDIOIMPORTER_LOCAL Containers::Array<char> doData() override;
-
-        Containers::Optional<Containers::Array<char>> _data;
+        MAGNUM_WAVAUDIOIMPORTER_LOCAL std::size_t doDataSize() override;
+        MAGNUM_WAVAUDIOIMPORTER_LOCAL std::size_t doDataInto(std::size_t offset, Containers::ArrayView<char> out) override;
+
+        /* Parses the file, on success fills _format, _frequency, _samples and
+           _swapSize and returns true */
+        MAGNUM_WAVAUDIOIMPORTER_LOCAL bool openInternal(Containers::ArrayView<const char> data);
+
+        /* Either an owned copy of the sample data for openData(), or a
+           memory-mapped file for openFile(), _samples point into one of
+           them */
+        Containers::Array<char> _data;
+        Containers::Pointer<MappedFile> _mappedFile;
+        Containers::ArrayView<const char> _samples;
+        bool _opened{};
+        /* Size of a single sample if the data need to be endian-swapped on
+           access, 0 otherwise */
+        UnsignedByte _swapSize{};
         BufferFormat _format;
         UnsignedInt _frequency;
 };
@@ -41,6 +41,10 @@
    a (slower) fallback instead. */
 #pragma ACME enable MAGNUM_SINGLES_NO_UTILITY_ALGORITHMS_DEPENDENCY
 
+/* The SIMD code paths for contiguous views need Cpu::runtimeFeatures(), which
+   is in Corrade::Utility. Use just the scalar code instead. */
+#pragma ACME enable MAGNUM_SINGLES_NO_CPU_DISPATCH
+
 /* We don't need anything from configure.h here that isn't pulled in by
    MagnumMath already */
 #pragma ACME enable Corrade_configure_h
@@ -60,6 +64,7 @@
 #pragma ACME enable Magnum_Types_h
 #pragma ACME enable Magnum_Math_Functions_h
 #pragma ACME enable Magnum_Math_Packing_h
+#pragma ACME enable Magnum_Math_Constants_h
 /* This guard is there only for tests I think, not needed for anything else */
 #pragma ACME disable Magnum_Math_halfTables_hpp
 #include "MagnumMath.hpp"